@@ -0,0 +1,206 @@
+/*
+ * Microbenchmark: graph layout.
+ *
+ * Builds the same random import graph twice: once with the previous layout
+ * (one malloc'd Edge per import in a per-node linked list, deduplicated by a
+ * linear scan on insert) and once with the frozen CSR Graph. Reports build
+ * time, heap bytes per edge and the time of a full iterative DFS over each.
+ *
+ * Usage: bench_graph [edges] [nodes]
+ */
+#include "../include/graph.h"
+#include "bench_util.h"
+#include <malloc.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct LegacyEdge {
+  int target_id;
+  int line_number;
+  struct LegacyEdge *next;
+} LegacyEdge;
+
+typedef struct {
+  LegacyEdge **heads;
+  size_t node_count;
+} LegacyGraph;
+
+static size_t heap_in_use(void) {
+  struct mallinfo2 mi = mallinfo2();
+  return mi.uordblks + mi.hblkhd;
+}
+
+static void legacy_add_edge(LegacyGraph *lg, int from, int to, int line) {
+  for (LegacyEdge *e = lg->heads[from]; e; e = e->next) {
+    if (e->target_id == to)
+      return;
+  }
+  LegacyEdge *e = (LegacyEdge *)calloc(1, sizeof(LegacyEdge));
+  e->target_id = to;
+  e->line_number = line;
+  e->next = lg->heads[from];
+  lg->heads[from] = e;
+}
+
+/* Iterative DFS from every unvisited node; returns the number of edges
+ * followed so the compiler cannot drop the traversal. */
+static size_t legacy_dfs(const LegacyGraph *lg, char *seen, int *stack,
+                         LegacyEdge **cursor) {
+  size_t followed = 0;
+  memset(seen, 0, lg->node_count);
+  for (size_t root = 0; root < lg->node_count; root++) {
+    if (seen[root])
+      continue;
+    size_t depth = 0;
+    seen[root] = 1;
+    stack[depth] = (int)root;
+    cursor[depth++] = lg->heads[root];
+    while (depth > 0) {
+      LegacyEdge *e = cursor[depth - 1];
+      if (!e) {
+        depth--;
+        continue;
+      }
+      cursor[depth - 1] = e->next;
+      followed++;
+      if (!seen[e->target_id]) {
+        seen[e->target_id] = 1;
+        stack[depth] = e->target_id;
+        cursor[depth++] = lg->heads[e->target_id];
+      }
+    }
+  }
+  return followed;
+}
+
+static size_t csr_dfs(const Graph *g, char *seen, int *stack, size_t *cursor) {
+  size_t followed = 0;
+  memset(seen, 0, g->node_count);
+  for (size_t root = 0; root < g->node_count; root++) {
+    if (seen[root])
+      continue;
+    size_t depth = 0;
+    seen[root] = 1;
+    stack[depth] = (int)root;
+    cursor[depth++] = graph_edges_begin(g, (int)root);
+    while (depth > 0) {
+      int v = stack[depth - 1];
+      if (cursor[depth - 1] >= graph_edges_end(g, v)) {
+        depth--;
+        continue;
+      }
+      int w = g->edge_targets[cursor[depth - 1]++];
+      followed++;
+      if (!seen[w]) {
+        seen[w] = 1;
+        stack[depth] = w;
+        cursor[depth++] = graph_edges_begin(g, w);
+      }
+    }
+  }
+  return followed;
+}
+
+int main(int argc, char **argv) {
+  size_t edges = argc > 1 ? strtoul(argv[1], NULL, 10) : 1000000;
+  size_t nodes = argc > 2 ? strtoul(argv[2], NULL, 10) : 100000;
+
+  /* Real import graphs are skewed: a few hub modules (utils, settings) are
+   * imported by a large share of the project. */
+  int *from = (int *)malloc(edges * sizeof(int));
+  int *to = (int *)malloc(edges * sizeof(int));
+  for (size_t i = 0; i < edges; i++) {
+    from[i] = (int)(bench_random() % nodes);
+    unsigned r = bench_random();
+    to[i] = (r % 10 == 0) ? (int)(r / 10 % 16) : (int)(r / 10 % nodes);
+    if (to[i] == from[i]) /* Self-imports are never stored */
+      to[i] = (to[i] + 1) % (int)nodes;
+  }
+
+  printf("Graph: %zu nodes, %zu edges (10%% into 16 hub modules)\n\n", nodes,
+         edges);
+
+  size_t before = heap_in_use();
+  double t0 = bench_now_seconds();
+  LegacyGraph lg = {(LegacyEdge **)calloc(nodes, sizeof(LegacyEdge *)), nodes};
+  for (size_t i = 0; i < edges; i++)
+    legacy_add_edge(&lg, from[i], to[i], (int)(i % 500) + 1);
+  double legacy_build = bench_now_seconds() - t0;
+  size_t legacy_bytes = heap_in_use() - before;
+
+  before = heap_in_use();
+  t0 = bench_now_seconds();
+  Graph *g = graph_create(nodes);
+  char name[32];
+  for (size_t v = 0; v < nodes; v++) {
+    snprintf(name, sizeof(name), "m%zu", v);
+    graph_add_node(g, name);
+  }
+  size_t names_bytes = heap_in_use() - before;
+  double t_edges = bench_now_seconds();
+  for (size_t i = 0; i < edges; i++)
+    graph_add_edge(g, from[i], to[i], (int)(i % 500) + 1);
+  graph_freeze(g);
+  double csr_build = bench_now_seconds() - t_edges;
+  size_t csr_bytes = heap_in_use() - before - names_bytes;
+
+  char *seen = (char *)malloc(nodes);
+  int *stack = (int *)malloc(nodes * sizeof(int));
+  LegacyEdge **legacy_cursor = (LegacyEdge **)malloc(nodes * sizeof(void *));
+  size_t *csr_cursor = (size_t *)malloc(nodes * sizeof(size_t));
+
+  double legacy_walk = 1e30, csr_walk = 1e30;
+  size_t legacy_followed = 0, csr_followed = 0;
+  for (int r = 0; r < 5; r++) {
+    t0 = bench_now_seconds();
+    legacy_followed = legacy_dfs(&lg, seen, stack, legacy_cursor);
+    double t = bench_now_seconds() - t0;
+    if (t < legacy_walk)
+      legacy_walk = t;
+
+    t0 = bench_now_seconds();
+    csr_followed = csr_dfs(g, seen, stack, csr_cursor);
+    t = bench_now_seconds() - t0;
+    if (t < csr_walk)
+      csr_walk = t;
+  }
+
+  t0 = bench_now_seconds();
+  SccList *sccs = graph_find_sccs(g);
+  double scc_time = bench_now_seconds() - t0;
+
+  printf("%-26s %12s %14s %12s\n", "layout", "build (ms)", "bytes/edge",
+         "DFS (ms)");
+  printf("%-26s %12.1f %14.1f %12.1f\n", "linked lists (previous)",
+         legacy_build * 1e3, (double)legacy_bytes / (double)csr_followed,
+         legacy_walk * 1e3);
+  printf("%-26s %12.1f %14.1f %12.1f\n", "CSR (frozen)", csr_build * 1e3,
+         (double)csr_bytes / (double)g->edge_count, csr_walk * 1e3);
+  printf("\nUnique edges: %zu, Tarjan SCC on CSR: %.1f ms (%zu components)\n",
+         g->edge_count, scc_time * 1e3, sccs ? sccs->count : 0);
+
+  int status = legacy_followed == csr_followed ? 0 : 1;
+  if (status)
+    fprintf(stderr, "Mismatch: legacy followed %zu edges, CSR %zu\n",
+            legacy_followed, csr_followed);
+
+  for (size_t v = 0; v < nodes; v++) {
+    LegacyEdge *e = lg.heads[v];
+    while (e) {
+      LegacyEdge *next = e->next;
+      free(e);
+      e = next;
+    }
+  }
+  free(lg.heads);
+  scc_list_free(sccs);
+  graph_free(g);
+  free(seen);
+  free(stack);
+  free(legacy_cursor);
+  free(csr_cursor);
+  free(from);
+  free(to);
+  return status;
+}
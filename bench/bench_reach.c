@@ -0,0 +1,114 @@
+/*
+ * Microbenchmark: "does A depend on B" queries.
+ *
+ * Builds a project-shaped graph (modules import mostly low-level modules,
+ * with a few hubs, plus some back edges that create import cycles), then
+ * indexes it both ways and compares, on the same random pairs:
+ *
+ *   - a BFS over the CSR graph per question, which is what every tool did
+ *     before the index;
+ *   - the bitset index (one bit test);
+ *   - the interval index (a binary search in the source's ranges).
+ *
+ * Every answer of both indexes is checked against the BFS.
+ *
+ * Usage: bench_reach [nodes] [edges]
+ */
+#include "../include/reach.h"
+#include "bench_util.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BFS_QUERIES 2000
+#define INDEX_QUERIES 10000000
+
+static bool bfs_depends(const Graph *g, int from, int to, int *queue,
+                        unsigned *seen, unsigned stamp) {
+  size_t head = 0, tail = 0;
+  queue[tail++] = from;
+  while (head < tail) {
+    int v = queue[head++];
+    for (size_t e = graph_edges_begin(g, v); e < graph_edges_end(g, v); e++) {
+      int w = g->edge_targets[e];
+      if (w == to)
+        return true;
+      if (seen[w] != stamp) {
+        seen[w] = stamp;
+        queue[tail++] = w;
+      }
+    }
+  }
+  return false;
+}
+
+int main(int argc, char **argv) {
+  size_t nodes = argc > 1 ? strtoul(argv[1], NULL, 10) : 20000;
+  size_t edges = argc > 2 ? strtoul(argv[2], NULL, 10) : 200000;
+  if (nodes < 2)
+    nodes = 2;
+
+  Graph *g = bench_project_graph(nodes, edges, NULL);
+  ReachIndex *bitset = reach_index_build(g, REACH_BITSET);
+  ReachIndex *intervals = reach_index_build(g, REACH_INTERVALS);
+  if (g == NULL || bitset == NULL || intervals == NULL) {
+    fprintf(stderr, "Out of memory.\n");
+    return 1;
+  }
+
+  printf("Graph: %zu modules, %zu imports, %zu components\n\n",
+         g->node_count, g->edge_count, bitset->sccs->count);
+  printf("%-12s %12s %12s %14s\n", "method", "build (ms)", "memory (KiB)",
+         "ns/query");
+
+  int *queue = (int *)malloc(nodes * sizeof(int));
+  unsigned *seen = (unsigned *)calloc(nodes, sizeof(unsigned));
+  int *pairs = (int *)malloc(2 * BFS_QUERIES * sizeof(int));
+  bool *expected = (bool *)malloc(BFS_QUERIES * sizeof(bool));
+  for (size_t i = 0; i < 2 * BFS_QUERIES; i++)
+    pairs[i] = (int)(bench_random() % nodes);
+
+  double t0 = bench_now_seconds();
+  for (unsigned i = 0; i < BFS_QUERIES; i++)
+    expected[i] = bfs_depends(g, pairs[2 * i], pairs[2 * i + 1], queue, seen,
+                              i + 1);
+  double bfs = (bench_now_seconds() - t0) / BFS_QUERIES;
+  printf("%-12s %12s %12s %14.0f\n", "BFS", "-", "-", bfs * 1e9);
+
+  int status = 0;
+  ReachIndex *indexes[] = {bitset, intervals};
+  for (size_t k = 0; k < 2; k++) {
+    const ReachIndex *idx = indexes[k];
+    for (unsigned i = 0; i < BFS_QUERIES; i++) {
+      if (reach_index_depends(idx, pairs[2 * i], pairs[2 * i + 1]) !=
+          expected[i]) {
+        fprintf(stderr, "%s index disagrees with BFS on m%d -> m%d\n",
+                reach_kind_name(idx->kind), pairs[2 * i], pairs[2 * i + 1]);
+        status = 1;
+        break;
+      }
+    }
+
+    size_t hits = 0;
+    t0 = bench_now_seconds();
+    for (size_t i = 0; i < INDEX_QUERIES; i++) {
+      size_t q = i % BFS_QUERIES;
+      hits += reach_index_depends(idx, pairs[2 * q], pairs[2 * q + 1]);
+    }
+    double per_query = (bench_now_seconds() - t0) / INDEX_QUERIES;
+    printf("%-12s %12.2f %12.1f %14.1f\n", reach_kind_name(idx->kind),
+           (double)idx->build_ns / 1e6, (double)idx->memory / 1024.0,
+           per_query * 1e9);
+    if (hits == (size_t)-1) /* Keeps the loop from being optimized away */
+      puts("");
+  }
+
+  free(queue);
+  free(seen);
+  free(pairs);
+  free(expected);
+  reach_index_free(bitset);
+  reach_index_free(intervals);
+  graph_free(g);
+  return status;
+}
@@ -0,0 +1,163 @@
+/*
+ * Microbenchmark: module registry lookups.
+ *
+ * Compares the previous registry (separate chaining, one calloc + strdup per
+ * key, djb2 with % modulo, strcmp on every probe, rehash on resize) with the
+ * Robin Hood Hashmap on a lookup-heavy workload of module-like names.
+ *
+ * Usage: bench_registry [keys] [lookups]
+ */
+#include "../include/arena.h"
+#include "../include/hashmap.h"
+#include "bench_util.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct LegacyItem {
+  char *key;
+  int value;
+  struct LegacyItem *next;
+} LegacyItem;
+
+typedef struct {
+  LegacyItem **buckets;
+  size_t capacity;
+  size_t count;
+} LegacyMap;
+
+static unsigned long djb2(const char *str) {
+  unsigned long hash = 5381;
+  int c;
+  while ((c = *str++))
+    hash = ((hash << 5) + hash) + c;
+  return hash;
+}
+
+static void legacy_put(LegacyMap *map, const char *key, int value) {
+  if (map->count >= map->capacity) {
+    size_t new_capacity = map->capacity * 2;
+    LegacyItem **nb = (LegacyItem **)calloc(new_capacity, sizeof(LegacyItem *));
+    for (size_t i = 0; i < map->capacity; i++) {
+      LegacyItem *item = map->buckets[i];
+      while (item) {
+        LegacyItem *next = item->next;
+        size_t idx = djb2(item->key) % new_capacity;
+        item->next = nb[idx];
+        nb[idx] = item;
+        item = next;
+      }
+    }
+    free(map->buckets);
+    map->buckets = nb;
+    map->capacity = new_capacity;
+  }
+  size_t idx = djb2(key) % map->capacity;
+  LegacyItem *item = (LegacyItem *)calloc(1, sizeof(LegacyItem));
+  item->key = strdup(key);
+  item->value = value;
+  item->next = map->buckets[idx];
+  map->buckets[idx] = item;
+  map->count++;
+}
+
+static int legacy_get(const LegacyMap *map, const char *key) {
+  for (LegacyItem *item = map->buckets[djb2(key) % map->capacity]; item;
+       item = item->next) {
+    if (strcmp(item->key, key) == 0)
+      return item->value;
+  }
+  return -1;
+}
+
+static void legacy_free(LegacyMap *map) {
+  for (size_t i = 0; i < map->capacity; i++) {
+    LegacyItem *item = map->buckets[i];
+    while (item) {
+      LegacyItem *next = item->next;
+      free(item->key);
+      free(item);
+      item = next;
+    }
+  }
+  free(map->buckets);
+}
+
+int main(int argc, char **argv) {
+  size_t keys = argc > 1 ? strtoul(argv[1], NULL, 10) : 200000;
+  size_t lookups = argc > 2 ? strtoul(argv[2], NULL, 10) : 10000000;
+
+  /* Names shaped like real module paths; queries are separate copies so
+   * every hit has to compare bytes, as in the lexer. */
+  Arena strings;
+  arena_init(&strings, 0, "bench");
+  char **names = (char **)malloc(keys * sizeof(char *));
+  char **queries = (char **)malloc(keys * 2 * sizeof(char *));
+  char buf[128];
+  for (size_t i = 0; i < keys; i++) {
+    int len = snprintf(buf, sizeof(buf), "company.service%zu.models.module_%zu",
+                       i % 97, i);
+    names[i] = arena_strndup(&strings, buf, (size_t)len);
+    queries[i] = arena_strndup(&strings, buf, (size_t)len);
+    len = snprintf(buf, sizeof(buf), "company.service%zu.models.missing_%zu",
+                   i % 97, i);
+    queries[keys + i] = arena_strndup(&strings, buf, (size_t)len);
+  }
+
+  size_t *order = (size_t *)malloc(lookups * sizeof(size_t));
+  unsigned seed = 7;
+  for (size_t i = 0; i < lookups; i++) {
+    seed = seed * 1103515245u + 12345u;
+    size_t k = (seed >> 4) % keys;
+    /* 80% hits, 20% misses */
+    order[i] = ((seed >> 24) % 5 == 0) ? keys + k : k;
+  }
+
+  printf("Registry: %zu keys, %zu lookups (80%% hits)\n\n", keys, lookups);
+  printf("%-28s %12s %14s\n", "implementation", "insert (ms)",
+         "lookups/sec");
+
+  LegacyMap legacy = {(LegacyItem **)calloc(1024, sizeof(LegacyItem *)), 1024,
+                      0};
+  double t0 = bench_now_seconds();
+  for (size_t i = 0; i < keys; i++)
+    legacy_put(&legacy, names[i], (int)i);
+  double legacy_insert = bench_now_seconds() - t0;
+
+  long long legacy_sum = 0;
+  t0 = bench_now_seconds();
+  for (size_t i = 0; i < lookups; i++)
+    legacy_sum += legacy_get(&legacy, queries[order[i]]);
+  double legacy_lookup = bench_now_seconds() - t0;
+  printf("%-28s %12.1f %14.0f\n", "chained djb2 (previous)",
+         legacy_insert * 1e3, (double)lookups / legacy_lookup);
+
+  Hashmap *map = hashmap_create(1024);
+  t0 = bench_now_seconds();
+  for (size_t i = 0; i < keys; i++)
+    hashmap_put(map, names[i], (int)i);
+  double insert = bench_now_seconds() - t0;
+
+  long long sum = 0;
+  t0 = bench_now_seconds();
+  for (size_t i = 0; i < lookups; i++)
+    sum += hashmap_get(map, queries[order[i]]);
+  double lookup = bench_now_seconds() - t0;
+  printf("%-28s %12.1f %14.0f\n", "Robin Hood (Hashmap)", insert * 1e3,
+         (double)lookups / lookup);
+
+  printf("\nSpeedup: %.2fx lookups, %.2fx inserts\n", legacy_lookup / lookup,
+         legacy_insert / insert);
+
+  int status = (sum == legacy_sum) ? 0 : 1;
+  if (status)
+    fprintf(stderr, "Mismatch: lookup checksums differ\n");
+
+  legacy_free(&legacy);
+  hashmap_free(map);
+  arena_release(&strings);
+  free(names);
+  free(queries);
+  free(order);
+  return status;
+}
@@ -0,0 +1,135 @@
+/*
+ * Microbenchmark: round-trip latency of the query daemon.
+ *
+ * Forks a server that keeps a project-shaped graph resident on a temporary
+ * socket, then sends every kind of read request over one connection and
+ * reports the mean and worst microseconds per request (socket round trip,
+ * answer and formatting included). The first request of a kind also pays
+ * for the lazily built structures, so it is timed separately.
+ *
+ * Usage: bench_serve [nodes] [edges] [requests]
+ */
+#include "../include/serve.h"
+#include "bench_util.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/**
+ * @brief Sends one request and reads the whole response.
+ * @return The number of result lines, or -1 on error.
+ */
+static long round_trip(int fd, FILE *in, const char *request, char **line,
+                       size_t *cap) {
+  size_t len = strlen(request);
+  if (write(fd, request, len) != (ssize_t)len)
+    return -1;
+  if (getline(line, cap, in) <= 0 || strncmp(*line, "ok ", 3) != 0)
+    return -1;
+  long count = strtol(*line + 3, NULL, 10);
+  for (long i = 0; i < count; i++) {
+    if (getline(line, cap, in) <= 0)
+      return -1;
+  }
+  return count;
+}
+
+int main(int argc, char **argv) {
+  size_t nodes = argc > 1 ? strtoul(argv[1], NULL, 10) : 20000;
+  size_t edges = argc > 2 ? strtoul(argv[2], NULL, 10) : 200000;
+  size_t requests = argc > 3 ? strtoul(argv[3], NULL, 10) : 2000;
+  if (nodes < 2)
+    nodes = 2;
+  if (requests == 0)
+    requests = 1;
+
+  Hashmap *map = NULL;
+  Graph *g = bench_project_graph(nodes, edges, &map);
+  if (g == NULL || map == NULL) {
+    fprintf(stderr, "Out of memory.\n");
+    return 1;
+  }
+
+  char socket_path[64];
+  snprintf(socket_path, sizeof(socket_path), "/tmp/bench_serve.%d.sock",
+           (int)getpid());
+
+  pid_t child = fork();
+  if (child == 0) {
+    freopen("/dev/null", "w", stderr);
+    _exit(serve_graph(socket_path, "/nonexistent", g, map) == 0 ? 0 : 1);
+  }
+
+  int fd = -1;
+  for (int attempt = 0; attempt < 500 && fd == -1; attempt++) {
+    fd = serve_connect(socket_path);
+    if (fd == -1)
+      usleep(10000);
+  }
+  FILE *in = fd == -1 ? NULL : fdopen(fd, "r");
+  if (in == NULL) {
+    fprintf(stderr, "Could not connect to the server.\n");
+    return 1;
+  }
+
+  printf("Graph: %zu modules, %zu imports, %zu requests per kind\n\n",
+         g->node_count, g->edge_count, requests);
+  printf("%-20s %12s %12s %12s %10s\n", "request", "first (us)", "mean (us)",
+         "max (us)", "lines");
+
+  static const char *const kinds[] = {
+      "stats",           "cycles %s",    "dependencies %s direct",
+      "dependencies %s", "dependents %s", "path %s %s",
+      "depends %s %s",
+  };
+  char *line = NULL, request[128], a[32], b[32];
+  size_t cap = 0;
+  int status = 0;
+
+  for (size_t k = 0; k < sizeof(kinds) / sizeof(kinds[0]); k++) {
+    double first = 0, total = 0, worst = 0;
+    long lines = 0;
+    for (size_t i = 0; i <= requests; i++) {
+      snprintf(a, sizeof(a), "m%u", bench_random() % (unsigned)nodes);
+      snprintf(b, sizeof(b), "m%u", bench_random() % (unsigned)nodes);
+      snprintf(request, sizeof(request), kinds[k], a, b);
+      strcat(request, "\n");
+
+      double t0 = bench_now_seconds();
+      long count = round_trip(fd, in, request, &line, &cap);
+      double elapsed = bench_now_seconds() - t0;
+      if (count < 0) {
+        fprintf(stderr, "Request failed: %s", request);
+        status = 1;
+        break;
+      }
+      if (i == 0) {
+        first = elapsed;
+        continue;
+      }
+      total += elapsed;
+      lines += count;
+      if (elapsed > worst)
+        worst = elapsed;
+    }
+
+    char label[32];
+    snprintf(label, sizeof(label), "%s", kinds[k]);
+    label[strcspn(label, " ")] = '\0';
+    if (strstr(kinds[k], "direct"))
+      strcat(label, " direct");
+    printf("%-20s %12.1f %12.1f %12.1f %10.1f\n", label, first * 1e6,
+           total / (double)requests * 1e6, worst * 1e6,
+           (double)lines / (double)requests);
+  }
+
+  round_trip(fd, in, "shutdown\n", &line, &cap);
+  fclose(in);
+  free(line);
+  waitpid(child, NULL, 0);
+  hashmap_free(map);
+  graph_free(g);
+  return status;
+}
@@ -0,0 +1,168 @@
+/*
+ * Microbenchmark: import extraction throughput.
+ *
+ * Compares the original per-line lexer (copy each line, strncmp for the
+ * keywords, strcspn/strncpy for every name) against lex_python_buffer, the
+ * single-pass tokenizer that tracks strings, comments, brackets and
+ * continuations, with each structural classifier the CPU supports. Both
+ * extract the same kind of targets; the tokenizer finds more of them
+ * (parenthesized and continued imports) and none from inside strings.
+ *
+ * Usage: bench_tokenizer [file.py ...]
+ * Without arguments a 64 MiB synthetic Python source is generated.
+ */
+#include "../include/lexer.h"
+#include "../include/prefilter.h"
+#include "bench_util.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ROUNDS 5
+
+static const char *skip_blanks(const char *ptr) {
+  while (*ptr == ' ' || *ptr == '\t')
+    ptr++;
+  return ptr;
+}
+
+/**
+ * The original lexer's loop over one line: every target is copied out with
+ * strncpy, as it was before being handed to the resolver.
+ */
+static size_t parse_line(const char *line) {
+  const char *ptr = skip_blanks(line);
+  size_t targets = 0;
+  char name[256];
+
+  if (strncmp(ptr, "import ", 7) == 0) {
+    ptr += 7;
+    while (*ptr != '\0' && *ptr != '\n' && *ptr != '\r') {
+      ptr = skip_blanks(ptr);
+      size_t len = strcspn(ptr, " \t\r\n,");
+      if (len > 0) {
+        strncpy(name, ptr, len < 255 ? len : 255);
+        name[len < 255 ? len : 255] = '\0';
+        targets++;
+      }
+      while (*ptr != '\0' && *ptr != ',' && *ptr != '\n' && *ptr != '\r')
+        ptr++;
+      if (*ptr == ',')
+        ptr++;
+    }
+  } else if (strncmp(ptr, "from ", 5) == 0) {
+    ptr += 5;
+    size_t base_len = strcspn(ptr, " \t\r\n");
+    strncpy(name, ptr, base_len < 255 ? base_len : 255);
+    name[base_len < 255 ? base_len : 255] = '\0';
+    targets++;
+    ptr = skip_blanks(ptr + base_len);
+
+    if (strncmp(ptr, "import ", 7) == 0) {
+      ptr += 7;
+      while (*ptr != '\0' && *ptr != '\n' && *ptr != '\r') {
+        ptr = skip_blanks(ptr);
+        size_t len = strcspn(ptr, " \t\r\n,");
+        if (len > 0 && !(len == 1 && *ptr == '*')) {
+          strncpy(name, ptr, len < 255 ? len : 255);
+          name[len < 255 ? len : 255] = '\0';
+          targets++;
+        }
+        while (*ptr != '\0' && *ptr != ',' && *ptr != '\n' && *ptr != '\r')
+          ptr++;
+        if (*ptr == ',')
+          ptr++;
+      }
+    }
+  }
+  return targets;
+}
+
+/** The original strategy: fgets-style copy of every line, then parse it. */
+static size_t count_line_loop(const char *buf, size_t size) {
+  const char *cursor = buf, *end = buf + size;
+  size_t targets = 0;
+  char line[1024];
+
+  while (cursor < end) {
+    const char *eol = (const char *)memchr(cursor, '\n', (size_t)(end - cursor));
+    size_t len = eol ? (size_t)(eol - cursor) + 1 : (size_t)(end - cursor);
+    size_t copy = len < sizeof(line) - 1 ? len : sizeof(line) - 1;
+    memcpy(line, cursor, copy);
+    line[copy] = '\0';
+    targets += parse_line(line);
+    cursor += len;
+  }
+  return targets;
+}
+
+int main(int argc, char **argv) {
+  size_t size = 0;
+  char *buf = bench_python_input(argc, argv, &size);
+  if (!buf || size == 0) {
+    fprintf(stderr, "No input.\n");
+    return 1;
+  }
+
+  printf("Input: %.1f MiB, best of %d rounds\n\n", (double)size / (1 << 20),
+         ROUNDS);
+
+  double baseline = 1e30;
+  size_t targets = 0;
+  for (int r = 0; r < ROUNDS; r++) {
+    double t0 = bench_now_seconds();
+    targets = count_line_loop(buf, size);
+    double t = bench_now_seconds() - t0;
+    if (t < baseline)
+      baseline = t;
+  }
+  bench_report_throughput("per-line (baseline)", size, baseline, targets);
+
+  /* The auto-selected classifier is the one pycycle runs with, and the one
+   * that has to keep up with the baseline; the others are for comparison. */
+  const PrefilterImpl impls[] = {PREFILTER_AUTO, PREFILTER_SCALAR,
+                                 PREFILTER_SSE2, PREFILTER_AVX2};
+  Arena scratch;
+  arena_init(&scratch, 0, "lexer");
+  int status = 0;
+
+  for (size_t k = 0; k < sizeof(impls) / sizeof(impls[0]); k++) {
+    PrefilterImpl selected = prefilter_select(impls[k]);
+    if (impls[k] != PREFILTER_AUTO && selected != impls[k])
+      continue; /* Not supported on this CPU */
+
+    char name[64];
+    snprintf(name, sizeof(name), "tokenizer %s%s",
+             prefilter_impl_name(selected),
+             impls[k] == PREFILTER_AUTO ? " (auto)" : "");
+
+    double best = 1e30;
+    size_t found = 0;
+    for (int r = 0; r < ROUNDS; r++) {
+      ImportList out = {.arena = &scratch};
+      double t0 = bench_now_seconds();
+      if (lex_python_buffer(buf, size, &out) == -1)
+        status = 1;
+      double t = bench_now_seconds() - t0;
+      if (t < best)
+        best = t;
+      found = out.count;
+      arena_reset(&scratch);
+    }
+    bench_report_throughput(name, size, best, found);
+
+    if (impls[k] == PREFILTER_AUTO) {
+      printf("%-22s %10.2fx\n", "speedup", baseline / best);
+      if (best > baseline) {
+        fprintf(stderr, "Slower than the baseline: %s at %.2fx\n", name,
+                baseline / best);
+        status = 1;
+      }
+    }
+  }
+
+  prefilter_select(PREFILTER_AUTO);
+  arena_release(&scratch);
+  free(buf);
+  return status;
+}
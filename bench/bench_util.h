@@ -0,0 +1,177 @@
+/*
+ * Helpers shared by the benchmarks: a clock, a reproducible random stream,
+ * the synthetic project graph and the Python input of the throughput runs.
+ * Every benchmark is a single file linked against the library objects, so
+ * the helpers are static inline here rather than another object file.
+ */
+#ifndef PYCYCLE_BENCH_UTIL_H
+#define PYCYCLE_BENCH_UTIL_H
+
+#include "../include/graph.h"
+#include "../include/hashmap.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/** Size of the Python source bench_python_input generates. */
+#define BENCH_SYNTHETIC_SIZE (64u << 20)
+
+/**
+ * @brief Monotonic wall clock, in seconds.
+ */
+static inline double bench_now_seconds(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+/**
+ * @brief The next number of a linear congruential stream that starts from
+ * the same seed in every run, so results are comparable between runs.
+ */
+static inline unsigned bench_random(void) {
+  static unsigned seed = 42;
+  seed = seed * 1103515245u + 12345u;
+  return seed >> 8;
+}
+
+/**
+ * @brief Builds and freezes a project-shaped graph of modules m0, m1, ...:
+ * module r imports lower ranks with a cubic skew towards the bottom, and one
+ * edge in 500 points upwards and may close a loop.
+ * @param nodes Number of modules (at least 2).
+ * @param edges Number of imports to draw (duplicates are merged).
+ * @param map If not NULL, receives a name -> node ID map of the modules.
+ */
+static inline Graph *bench_project_graph(size_t nodes, size_t edges,
+                                         Hashmap **map) {
+  Graph *g = graph_create(nodes);
+  if (map)
+    *map = hashmap_create(nodes);
+  char name[32];
+  for (size_t v = 0; v < nodes; v++) {
+    snprintf(name, sizeof(name), "m%zu", v);
+    int id = graph_add_node(g, name);
+    if (map)
+      hashmap_put(*map, g->nodes[id].name, id);
+  }
+  for (size_t i = 0; i < edges; i++) {
+    size_t from = 1 + bench_random() % (nodes - 1);
+    double u = (double)(bench_random() % 1000000) / 1e6;
+    size_t to = (size_t)(u * u * u * (double)from);
+    if (bench_random() % 500 == 0)
+      to = from + bench_random() % (nodes - from);
+    graph_add_edge(g, (int)from, (int)to, 1);
+  }
+  graph_freeze(g);
+  return g;
+}
+
+/**
+ * @brief Generates BENCH_SYNTHETIC_SIZE bytes of Python: functions, classes,
+ * docstrings and comments, with roughly one chunk in 40 an import (plain,
+ * indented, relative and parenthesized).
+ */
+static inline char *bench_synthesize_python(size_t *size_out) {
+  static const char *chunks[] = {
+      "def handler(request, *args, **kwargs):\n",
+      "    \"\"\"Process the incoming request and return a response.\n"
+      "\n"
+      "    Callers should not import this module directly.\n"
+      "    \"\"\"\n",
+      "    if request.method == 'POST':\n",
+      "        for item in request.items:\n",
+      "            value = compute(item, factor=3)  # it's an inline comment\n",
+      "        return Response(status=201, body={'key': [1, 2, 3]})\n",
+      "\n",
+      "class Model(Base):\n",
+      "    field = Column(Integer, primary_key=True)\n",
+      "import os, sys\n",
+      "from app.models import User, Group\n",
+      "    from .utils import helper\n",
+      "from app.views import (\n    index,\n    detail as show,\n)\n",
+  };
+
+  char *buf = (char *)malloc(BENCH_SYNTHETIC_SIZE);
+  if (!buf)
+    return NULL;
+
+  size_t size = 0;
+  unsigned seed = 12345;
+  for (;;) {
+    seed = seed * 1103515245u + 12345u;
+    /* Imports are rare: roughly 1 chunk in 40. */
+    size_t pick = ((seed >> 16) % 40 == 0) ? 9 + (seed >> 8) % 4
+                                           : (seed >> 16) % 9;
+    size_t len = strlen(chunks[pick]);
+    if (size + len > BENCH_SYNTHETIC_SIZE)
+      break;
+    memcpy(buf + size, chunks[pick], len);
+    size += len;
+  }
+
+  *size_out = size;
+  return buf;
+}
+
+/**
+ * @brief Concatenates the files named by argv[1..argc) into one buffer.
+ * Files that cannot be opened are skipped with a message.
+ */
+static inline char *bench_load_files(int argc, char **argv,
+                                     size_t *size_out) {
+  size_t size = 0, cap = 1 << 20;
+  char *buf = (char *)malloc(cap);
+  if (!buf)
+    return NULL;
+
+  for (int i = 1; i < argc; i++) {
+    FILE *f = fopen(argv[i], "rb");
+    if (!f) {
+      fprintf(stderr, "Could not open %s\n", argv[i]);
+      continue;
+    }
+    size_t n;
+    char chunk[1 << 16];
+    while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) {
+      while (size + n > cap) {
+        cap *= 2;
+        char *grown = (char *)realloc(buf, cap);
+        if (!grown) {
+          free(buf);
+          fclose(f);
+          return NULL;
+        }
+        buf = grown;
+      }
+      memcpy(buf + size, chunk, n);
+      size += n;
+    }
+    fclose(f);
+  }
+
+  *size_out = size;
+  return buf;
+}
+
+/**
+ * @brief The Python source a throughput benchmark runs on: the files given
+ * on the command line, or a synthetic source without arguments.
+ */
+static inline char *bench_python_input(int argc, char **argv,
+                                       size_t *size_out) {
+  return argc > 1 ? bench_load_files(argc, argv, size_out)
+                  : bench_synthesize_python(size_out);
+}
+
+/**
+ * @brief Prints one line of a throughput table.
+ */
+static inline void bench_report_throughput(const char *name, size_t bytes,
+                                           double seconds, size_t targets) {
+  printf("%-22s %10.1f MB/s %12zu import targets\n", name,
+         (double)bytes / seconds / 1e6, targets);
+}
+
+#endif /* PYCYCLE_BENCH_UTIL_H */
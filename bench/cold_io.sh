@@ -0,0 +1,66 @@
+#!/bin/sh
+# Compares the read backends (--io mmap, pread, uring) on a cold page cache:
+# the kernel caches are dropped before every run, so each run pays for the
+# disk reads the way a first scan after boot or checkout does. Every backend
+# must print the same report.
+#
+# Usage: bench/cold_io.sh <python_project_directory> [runs] [depth]
+#
+# Dropping caches needs root (/proc/sys/vm/drop_caches); without it the runs
+# are warm and a warning says so.
+
+set -eu
+
+BIN=${PYCYCLE:-./pycycle}
+DIR=${1:?usage: $0 <python_project_directory> [runs] [depth]}
+RUNS=${2:-3}
+DEPTH=${3:-256}
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+if [ -w /proc/sys/vm/drop_caches ]; then
+  COLD=1
+else
+  COLD=0
+  echo "Warning: cannot write /proc/sys/vm/drop_caches, timing warm runs" >&2
+fi
+
+now() { date +%s.%N; }
+
+drop_caches() {
+  if [ "$COLD" -eq 1 ]; then
+    sync
+    echo 3 > /proc/sys/vm/drop_caches
+  fi
+}
+
+# Best-of-RUNS wall time in seconds for the given pycycle arguments.
+best_time() {
+  best=""
+  i=0
+  while [ "$i" -lt "$RUNS" ]; do
+    drop_caches
+    start=$(now)
+    "$BIN" "$DIR" "$@" > "$TMP/out.txt"
+    end=$(now)
+    best=$(awk -v s="$start" -v e="$end" -v b="$best" \
+      'BEGIN { t = e - s; if (b == "" || t < b) b = t; print b }')
+    i=$((i + 1))
+  done
+  echo "$best"
+}
+
+base=$(best_time --io mmap)
+cp "$TMP/out.txt" "$TMP/mmap.txt"
+printf "%-8s %10s %8s\n" "io" "seconds" "speedup"
+printf "%-8s %10.3f %8s\n" "mmap" "$base" "1.00x"
+
+for io in pread uring; do
+  t=$(best_time --io "$io" --io-depth "$DEPTH")
+  if ! cmp -s "$TMP/out.txt" "$TMP/mmap.txt"; then
+    echo "Mismatch: --io $io output differs from --io mmap" >&2
+    exit 1
+  fi
+  printf "%-8s %10.3f %7.2fx\n" "$io" "$t" \
+    "$(awk -v b="$base" -v t="$t" 'BEGIN { print b / t }')"
+done
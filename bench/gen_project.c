@@ -0,0 +1,314 @@
+/*
+ * Synthetic Python project generator for the end-to-end benchmarks.
+ *
+ * Emits a reproducible package tree: the same options and seed always give
+ * byte-identical files. Modules are numbered in a hidden topological order
+ * and only import lower-numbered modules, with a skew towards the bottom so
+ * a few low-level modules act as hubs; the project is therefore acyclic
+ * except for the loops injected on purpose.
+ *
+ * Usage: gen_project [options] <output_directory>
+ *
+ *   --modules N      number of modules (default 1000)
+ *   --depth D        depth of the package tree (default 3)
+ *   --fanout F       average imports per module (default 6)
+ *   --relative P     percentage of imports written relative (default 20)
+ *   --init P         percentage of packages with an __init__.py (default 90)
+ *   --cycles K       import loops to inject (default 0)
+ *   --lines L        average lines of filler code per module (default 60)
+ *   --seed S         random seed (default 1)
+ *
+ * Prints one summary line: modules, files, packages, imports and loops.
+ */
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#define MODULES_PER_PACKAGE 24
+
+typedef struct {
+  int *items;
+  size_t count;
+  size_t capacity;
+} IntList;
+
+typedef struct {
+  size_t modules;
+  int depth;
+  int fanout;
+  int relative;
+  int init_density;
+  int cycles;
+  int lines;
+  unsigned long seed;
+} Options;
+
+static unsigned long long rng_state;
+
+/* splitmix64: fast, and identical on every platform for a given seed. */
+static unsigned long long next_random(void) {
+  unsigned long long z = (rng_state += 0x9e3779b97f4a7c15ULL);
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+  return z ^ (z >> 31);
+}
+
+static size_t random_below(size_t n) {
+  return n ? (size_t)(next_random() % n) : 0;
+}
+
+static void list_push(IntList *list, int v) {
+  if (list->count >= list->capacity) {
+    list->capacity = list->capacity ? list->capacity * 2 : 8;
+    list->items = (int *)realloc(list->items, list->capacity * sizeof(int));
+    if (list->items == NULL) {
+      fprintf(stderr, "gen_project: out of memory\n");
+      exit(1);
+    }
+  }
+  list->items[list->count++] = v;
+}
+
+static bool list_contains(const IntList *list, int v) {
+  for (size_t i = 0; i < list->count; i++) {
+    if (list->items[i] == v)
+      return true;
+  }
+  return false;
+}
+
+static int make_dir(const char *path) {
+  if (mkdir(path, 0755) != 0 && errno != EEXIST) {
+    fprintf(stderr, "gen_project: cannot create %s: %s\n", path,
+            strerror(errno));
+    return -1;
+  }
+  return 0;
+}
+
+/* Package p's parent in a complete tree with the given branching factor. */
+static size_t package_parent(size_t p, size_t branching) {
+  return (p - 1) / branching;
+}
+
+/* Writes the path (sep '/') or dotted name (sep '.') of package p. */
+static void package_name(size_t p, size_t branching, char sep, char *buf,
+                         size_t size) {
+  size_t chain[64], n = 0;
+  for (size_t q = p; q != 0 && n < 64; q = package_parent(q, branching))
+    chain[n++] = q;
+
+  size_t len = 0;
+  buf[0] = '\0';
+  for (size_t i = n; i-- > 0 && len + 1 < size;) {
+    if (len > 0)
+      buf[len++] = sep;
+    len += (size_t)snprintf(buf + len, size - len, "pkg%zu", chain[i]);
+  }
+}
+
+static int parse_options(int argc, char **argv, Options *opts,
+                         const char **out_dir) {
+  *opts = (Options){.modules = 1000,
+                    .depth = 3,
+                    .fanout = 6,
+                    .relative = 20,
+                    .init_density = 90,
+                    .cycles = 0,
+                    .lines = 60,
+                    .seed = 1};
+  *out_dir = NULL;
+
+  for (int i = 1; i < argc; i++) {
+    const char *arg = argv[i];
+    if (arg[0] != '-') {
+      *out_dir = arg;
+      continue;
+    }
+    if (i + 1 >= argc)
+      return -1;
+    unsigned long value = strtoul(argv[++i], NULL, 10);
+    if (strcmp(arg, "--modules") == 0)
+      opts->modules = value ? value : 1;
+    else if (strcmp(arg, "--depth") == 0)
+      opts->depth = value ? (int)value : 1;
+    else if (strcmp(arg, "--fanout") == 0)
+      opts->fanout = (int)value;
+    else if (strcmp(arg, "--relative") == 0)
+      opts->relative = value > 100 ? 100 : (int)value;
+    else if (strcmp(arg, "--init") == 0)
+      opts->init_density = value > 100 ? 100 : (int)value;
+    else if (strcmp(arg, "--cycles") == 0)
+      opts->cycles = (int)value;
+    else if (strcmp(arg, "--lines") == 0)
+      opts->lines = (int)value;
+    else if (strcmp(arg, "--seed") == 0)
+      opts->seed = value;
+    else
+      return -1;
+  }
+  return *out_dir ? 0 : -1;
+}
+
+/* Filler that exercises the lexer without adding imports: functions,
+ * docstrings, comments and strings that merely mention "import". */
+static void write_filler(FILE *f, size_t module, int lines) {
+  int target = lines > 0 ? (int)random_below((size_t)lines * 2 + 1) : 0;
+  for (int written = 0; written < target; written += 6) {
+    fprintf(f,
+            "\n\ndef helper_%zu_%d(value, scale=%d):\n"
+            "    \"\"\"Scales value; see the import notes.\"\"\"\n"
+            "    # from the old API: import value\n"
+            "    result = [value * scale for _ in range(%d)]\n"
+            "    return sum(result)\n",
+            module, written, written % 7 + 1, written % 5 + 2);
+  }
+}
+
+int main(int argc, char **argv) {
+  Options opts;
+  const char *out_dir;
+  if (parse_options(argc, argv, &opts, &out_dir) != 0) {
+    fprintf(stderr,
+            "Usage: %s [--modules N] [--depth D] [--fanout F] "
+            "[--relative PERCENT] [--init PERCENT] [--cycles K] "
+            "[--lines L] [--seed S] <output_directory>\n",
+            argv[0]);
+    return 1;
+  }
+  rng_state = opts.seed;
+
+  size_t n = opts.modules;
+  size_t packages = n / MODULES_PER_PACKAGE + 1;
+
+  /* Smallest branching factor whose tree of the given depth holds every
+   * package; package 0 is the project root and has no name. */
+  size_t branching = 1;
+  for (;;) {
+    size_t total = 1, level = 1;
+    for (int d = 0; d < opts.depth && total < packages + 1; d++) {
+      level *= branching;
+      total += level;
+    }
+    if (total >= packages + 1 || branching > packages)
+      break;
+    branching++;
+  }
+
+  size_t *package_of = (size_t *)malloc(n * sizeof(size_t));
+  IntList *imports = (IntList *)calloc(n, sizeof(IntList));
+  IntList *package_members = (IntList *)calloc(packages + 1, sizeof(IntList));
+  if (!package_of || !imports || !package_members) {
+    fprintf(stderr, "gen_project: out of memory\n");
+    return 1;
+  }
+  for (size_t m = 0; m < n; m++) {
+    package_of[m] = 1 + m % packages;
+    list_push(&package_members[package_of[m]], (int)m);
+  }
+
+  /* Acyclic imports: module m only imports lower-numbered modules, either
+   * a sibling (written relative) or anything below it, skewed to hubs. */
+  size_t import_count = 0;
+  for (size_t m = 1; m < n; m++) {
+    size_t count = random_below((size_t)opts.fanout * 2 + 1);
+    const IntList *siblings = &package_members[package_of[m]];
+    for (size_t k = 0; k < count; k++) {
+      int target;
+      if ((int)random_below(100) < opts.relative && siblings->items[0] < (int)m) {
+        /* Siblings are sorted; pick one numbered below m. */
+        size_t below = 0;
+        while (below < siblings->count && siblings->items[below] < (int)m)
+          below++;
+        target = siblings->items[random_below(below)];
+      } else {
+        double u = (double)random_below(1000000) / 1e6;
+        target = (int)(u * u * u * (double)m);
+      }
+      if (!list_contains(&imports[m], target)) {
+        list_push(&imports[m], target);
+        import_count++;
+      }
+    }
+  }
+
+  /* Loops: follow 1 to 3 imports down from a random module and import it
+   * back from the last one. */
+  int injected = 0;
+  for (int c = 0; c < opts.cycles * 4 && injected < opts.cycles; c++) {
+    size_t start = random_below(n), w = start;
+    size_t hops = 1 + random_below(3);
+    for (size_t h = 0; h < hops && imports[w].count > 0; h++)
+      w = (size_t)imports[w].items[random_below(imports[w].count)];
+    if (w == start || list_contains(&imports[w], (int)start))
+      continue;
+    list_push(&imports[w], (int)start);
+    import_count++;
+    injected++;
+  }
+
+  if (make_dir(out_dir) != 0)
+    return 1;
+
+  char path[4096], name[2048], target_name[2048];
+  size_t files = 0;
+  for (size_t p = 1; p <= packages; p++) {
+    package_name(p, branching, '/', name, sizeof(name));
+    /* Parents come first: package_parent(p) < p. */
+    snprintf(path, sizeof(path), "%s/%s", out_dir, name);
+    if (make_dir(path) != 0)
+      return 1;
+    if ((int)random_below(100) < opts.init_density) {
+      snprintf(path, sizeof(path), "%s/%s/__init__.py", out_dir, name);
+      FILE *f = fopen(path, "w");
+      if (f == NULL)
+        return 1;
+      fprintf(f, "\"\"\"Package %zu.\"\"\"\n", p);
+      fclose(f);
+      files++;
+    }
+  }
+
+  for (size_t m = 0; m < n; m++) {
+    package_name(package_of[m], branching, '/', name, sizeof(name));
+    snprintf(path, sizeof(path), "%s/%s/m%zu.py", out_dir, name, m);
+    FILE *f = fopen(path, "w");
+    if (f == NULL) {
+      fprintf(stderr, "gen_project: cannot write %s\n", path);
+      return 1;
+    }
+
+    fprintf(f, "\"\"\"Module %zu.\"\"\"\n", m);
+    for (size_t k = 0; k < imports[m].count; k++) {
+      size_t t = (size_t)imports[m].items[k];
+      if (package_of[t] == package_of[m]) {
+        fprintf(f, "from . import m%zu\n", t);
+      } else {
+        package_name(package_of[t], branching, '.', target_name,
+                     sizeof(target_name));
+        if (k % 2 == 0)
+          fprintf(f, "import %s.m%zu\n", target_name, t);
+        else
+          fprintf(f, "from %s import m%zu\n", target_name, t);
+      }
+    }
+    write_filler(f, m, opts.lines);
+    fclose(f);
+    files++;
+  }
+
+  printf("modules=%zu files=%zu packages=%zu imports=%zu cycles=%d\n", n,
+         files, packages, import_count, injected);
+
+  for (size_t m = 0; m < n; m++)
+    free(imports[m].items);
+  for (size_t p = 0; p <= packages; p++)
+    free(package_members[p].items);
+  free(imports);
+  free(package_members);
+  free(package_of);
+  return 0;
+}
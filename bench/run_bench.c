@@ -0,0 +1,353 @@
+/*
+ * End-to-end benchmark harness.
+ *
+ * For every scale (number of modules) it generates a synthetic project with
+ * gen_project (once; projects are reused while their parameters match), runs
+ * the pycycle binary over it several times and records the best wall time,
+ * files per second and the peak RSS of the child (from wait4). Results are
+ * written as CSV; with a baseline file, any scenario that got slower or
+ * bigger than the threshold allows fails the run.
+ *
+ * Usage: run_bench [options] <modules>...
+ *
+ *   --pycycle PATH      binary to measure (default ./pycycle)
+ *   --generator PATH    gen_project binary (default obj/bench/gen_project)
+ *   --work DIR          where projects are generated (default obj/bench/projects)
+ *   --results FILE      CSV to write (default obj/bench/results.csv)
+ *   --baseline FILE     CSV to compare against (skipped if missing)
+ *   --threshold PCT     allowed regression in percent (default 20)
+ *   --runs N            runs per scenario, best is kept (default 3)
+ *   --update-baseline   copy the results to the baseline instead of comparing
+ *   --gen-args "ARGS"   extra options for gen_project (e.g. "--cycles 50")
+ *   --args "ARGS"       extra options for pycycle (e.g. "--jobs 4")
+ */
+#include "bench_util.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#define MAX_ARGS 64
+#define MAX_SCENARIOS 32
+/* Wall-time changes below this are noise, whatever the percentage. */
+#define MIN_WALL_DELTA_MS 5.0
+
+typedef struct {
+  char name[64];
+  size_t modules;
+  size_t files;
+  double wall_ms;
+  double files_per_sec;
+  long peak_rss_kb;
+} Result;
+
+/* Splits a space-separated option string into argv (modifies it). */
+static size_t split_args(char *args, char **argv, size_t max) {
+  size_t n = 0;
+  for (char *tok = strtok(args, " "); tok && n < max; tok = strtok(NULL, " "))
+    argv[n++] = tok;
+  return n;
+}
+
+/*
+ * Runs argv with stdout sent to out_path (or /dev/null) and waits for it.
+ * Returns the exit status, or -1; *usage receives the child's rusage.
+ */
+static int run(char **argv, const char *out_path, struct rusage *usage) {
+  fflush(stdout); /* or the child's freopen writes our buffer again */
+  pid_t pid = fork();
+  if (pid == 0) {
+    FILE *out = freopen(out_path ? out_path : "/dev/null", "w", stdout);
+    if (out == NULL)
+      _exit(126);
+    execv(argv[0], argv);
+    _exit(127);
+  }
+  if (pid == -1)
+    return -1;
+
+  int status;
+  if (wait4(pid, &status, 0, usage) != pid)
+    return -1;
+  return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+}
+
+/* Counts the .py files gen_project reported ("files=N" in its summary). */
+static size_t read_file_count(const char *summary_path) {
+  FILE *f = fopen(summary_path, "r");
+  if (f == NULL)
+    return 0;
+  char line[256] = "";
+  size_t files = 0;
+  if (fgets(line, sizeof(line), f)) {
+    const char *p = strstr(line, "files=");
+    if (p)
+      files = strtoul(p + 6, NULL, 10);
+  }
+  fclose(f);
+  return files;
+}
+
+/*
+ * Generates the project for one scale unless an identical one exists: the
+ * generator's command line is stored next to it and compared.
+ */
+static int prepare_project(const char *generator, const char *dir,
+                           size_t modules, const char *gen_args,
+                           size_t *files) {
+  char command[1024], stamp_path[1100], summary_path[1100];
+  snprintf(command, sizeof(command), "--modules %zu %s", modules, gen_args);
+  snprintf(stamp_path, sizeof(stamp_path), "%s.args", dir);
+  snprintf(summary_path, sizeof(summary_path), "%s.summary", dir);
+
+  FILE *stamp = fopen(stamp_path, "r");
+  if (stamp) {
+    char stored[1024] = "";
+    bool same = fgets(stored, sizeof(stored), stamp) != NULL &&
+                strcmp(stored, command) == 0;
+    fclose(stamp);
+    if (same && (*files = read_file_count(summary_path)) > 0)
+      return 0;
+  }
+
+  char rm_command[1100];
+  snprintf(rm_command, sizeof(rm_command), "rm -rf '%s'", dir);
+  if (system(rm_command) != 0)
+    return -1;
+
+  char args_copy[1024];
+  snprintf(args_copy, sizeof(args_copy), "%s", command);
+  char *argv[MAX_ARGS];
+  argv[0] = (char *)generator;
+  size_t argc = 1 + split_args(args_copy, argv + 1, MAX_ARGS - 3);
+  argv[argc++] = (char *)dir;
+  argv[argc] = NULL;
+
+  fprintf(stderr, "generating %zu modules in %s\n", modules, dir);
+  struct rusage usage;
+  if (run(argv, summary_path, &usage) != 0) {
+    fprintf(stderr, "run_bench: %s failed\n", generator);
+    return -1;
+  }
+
+  stamp = fopen(stamp_path, "w");
+  if (stamp == NULL)
+    return -1;
+  fputs(command, stamp);
+  fclose(stamp);
+
+  *files = read_file_count(summary_path);
+  return *files > 0 ? 0 : -1;
+}
+
+static int write_results(const char *path, const Result *results,
+                         size_t count) {
+  FILE *f = fopen(path, "w");
+  if (f == NULL) {
+    fprintf(stderr, "run_bench: cannot write %s\n", path);
+    return -1;
+  }
+  fprintf(f, "scenario,modules,files,wall_ms,files_per_sec,peak_rss_kb\n");
+  for (size_t i = 0; i < count; i++) {
+    fprintf(f, "%s,%zu,%zu,%.3f,%.0f,%ld\n", results[i].name,
+            results[i].modules, results[i].files, results[i].wall_ms,
+            results[i].files_per_sec, results[i].peak_rss_kb);
+  }
+  fclose(f);
+  return 0;
+}
+
+/* Reads a results CSV; returns the number of rows, or -1 if missing. */
+static int read_results(const char *path, Result *results, size_t max) {
+  FILE *f = fopen(path, "r");
+  if (f == NULL)
+    return -1;
+
+  char line[512];
+  size_t count = 0;
+  while (fgets(line, sizeof(line), f) && count < max) {
+    Result *r = &results[count];
+    if (sscanf(line, "%63[^,],%zu,%zu,%lf,%lf,%ld", r->name, &r->modules,
+               &r->files, &r->wall_ms, &r->files_per_sec,
+               &r->peak_rss_kb) == 6)
+      count++;
+  }
+  fclose(f);
+  return (int)count;
+}
+
+/* Prints the comparison; returns the number of regressions. */
+static int compare(const Result *results, size_t count, const Result *base,
+                   size_t base_count, double threshold) {
+  int regressions = 0;
+  printf("\n%-16s %12s %12s %9s %12s %12s %9s\n", "scenario", "base ms",
+         "ms", "change", "base RSS KB", "RSS KB", "change");
+
+  for (size_t i = 0; i < count; i++) {
+    const Result *r = &results[i], *b = NULL;
+    for (size_t j = 0; j < base_count && !b; j++) {
+      if (strcmp(base[j].name, r->name) == 0)
+        b = &base[j];
+    }
+    if (b == NULL) {
+      printf("%-16s %12s (not in baseline)\n", r->name, "-");
+      continue;
+    }
+
+    double wall_change = (r->wall_ms / b->wall_ms - 1.0) * 100.0;
+    double rss_change =
+        ((double)r->peak_rss_kb / (double)b->peak_rss_kb - 1.0) * 100.0;
+    bool slower = wall_change > threshold &&
+                  r->wall_ms - b->wall_ms > MIN_WALL_DELTA_MS;
+    bool bigger = rss_change > threshold;
+    printf("%-16s %12.1f %12.1f %+8.1f%% %12ld %12ld %+8.1f%%%s\n", r->name,
+           b->wall_ms, r->wall_ms, wall_change, b->peak_rss_kb,
+           r->peak_rss_kb, rss_change,
+           slower || bigger ? "  REGRESSION" : "");
+    regressions += slower || bigger;
+  }
+  return regressions;
+}
+
+int main(int argc, char **argv) {
+  const char *pycycle = "./pycycle";
+  const char *generator = "obj/bench/gen_project";
+  const char *work = "obj/bench/projects";
+  const char *results_path = "obj/bench/results.csv";
+  const char *baseline_path = NULL;
+  const char *gen_args = "";
+  const char *extra_args = "";
+  double threshold = 20.0;
+  int runs = 3;
+  bool update_baseline = false;
+  size_t scales[MAX_SCENARIOS];
+  size_t scale_count = 0;
+
+  for (int i = 1; i < argc; i++) {
+    const char *arg = argv[i];
+    const char *value = i + 1 < argc ? argv[i + 1] : NULL;
+    if (strcmp(arg, "--update-baseline") == 0) {
+      update_baseline = true;
+    } else if (arg[0] == '-' && arg[1] == '-' && value == NULL) {
+      fprintf(stderr, "run_bench: %s needs a value\n", arg);
+      return 2;
+    } else if (strcmp(arg, "--pycycle") == 0) {
+      pycycle = argv[++i];
+    } else if (strcmp(arg, "--generator") == 0) {
+      generator = argv[++i];
+    } else if (strcmp(arg, "--work") == 0) {
+      work = argv[++i];
+    } else if (strcmp(arg, "--results") == 0) {
+      results_path = argv[++i];
+    } else if (strcmp(arg, "--baseline") == 0) {
+      baseline_path = argv[++i];
+    } else if (strcmp(arg, "--threshold") == 0) {
+      threshold = atof(argv[++i]);
+    } else if (strcmp(arg, "--runs") == 0) {
+      runs = atoi(argv[++i]);
+      if (runs < 1)
+        runs = 1;
+    } else if (strcmp(arg, "--gen-args") == 0) {
+      gen_args = argv[++i];
+    } else if (strcmp(arg, "--args") == 0) {
+      extra_args = argv[++i];
+    } else if (scale_count < MAX_SCENARIOS && strtoul(arg, NULL, 10) > 0) {
+      scales[scale_count++] = strtoul(arg, NULL, 10);
+    } else {
+      fprintf(stderr, "run_bench: unexpected argument %s\n", arg);
+      return 2;
+    }
+  }
+  if (scale_count == 0) {
+    scales[scale_count++] = 1000;
+    scales[scale_count++] = 10000;
+  }
+
+  mkdir(work, 0755);
+  Result results[MAX_SCENARIOS];
+  printf("%-16s %10s %12s %14s %14s\n", "scenario", "files", "wall ms",
+         "files/sec", "peak RSS KB");
+
+  for (size_t s = 0; s < scale_count; s++) {
+    Result *r = &results[s];
+    memset(r, 0, sizeof(*r));
+    r->modules = scales[s];
+    snprintf(r->name, sizeof(r->name), "scan_%zu", scales[s]);
+
+    char dir[1024];
+    if (snprintf(dir, sizeof(dir), "%s/%s", work, r->name) >=
+            (int)sizeof(dir) ||
+        prepare_project(generator, dir, r->modules, gen_args, &r->files) != 0)
+      return 1;
+
+    char args_copy[1024];
+    snprintf(args_copy, sizeof(args_copy), "%s", extra_args);
+    char *child_argv[MAX_ARGS];
+    child_argv[0] = (char *)pycycle;
+    child_argv[1] = dir;
+    size_t child_argc = 2 + split_args(args_copy, child_argv + 2, MAX_ARGS - 3);
+    child_argv[child_argc] = NULL;
+
+    /* One untimed run warms the page cache, so every run reads from it. */
+    struct rusage usage;
+    if (run(child_argv, NULL, &usage) != 0) {
+      fprintf(stderr, "run_bench: %s failed on %s\n", pycycle, dir);
+      return 1;
+    }
+
+    r->wall_ms = -1;
+    for (int k = 0; k < runs; k++) {
+      double start = bench_now_seconds() * 1e3;
+      int status = run(child_argv, NULL, &usage);
+      double elapsed = bench_now_seconds() * 1e3 - start;
+      if (status != 0) {
+        fprintf(stderr, "run_bench: %s failed on %s\n", pycycle, dir);
+        return 1;
+      }
+      if (r->wall_ms < 0 || elapsed < r->wall_ms)
+        r->wall_ms = elapsed;
+      if (usage.ru_maxrss > r->peak_rss_kb)
+        r->peak_rss_kb = usage.ru_maxrss;
+    }
+    r->files_per_sec = (double)r->files / (r->wall_ms / 1e3);
+
+    printf("%-16s %10zu %12.1f %14.0f %14ld\n", r->name, r->files, r->wall_ms,
+           r->files_per_sec, r->peak_rss_kb);
+    fflush(stdout);
+  }
+
+  if (write_results(results_path, results, scale_count) != 0)
+    return 1;
+  printf("\nResults written to %s\n", results_path);
+
+  if (baseline_path == NULL)
+    return 0;
+  if (update_baseline) {
+    if (write_results(baseline_path, results, scale_count) != 0)
+      return 1;
+    printf("Baseline updated: %s\n", baseline_path);
+    return 0;
+  }
+
+  Result base[MAX_SCENARIOS];
+  int base_count = read_results(baseline_path, base, MAX_SCENARIOS);
+  if (base_count < 0) {
+    printf("No baseline at %s; run `make bench-baseline` to store one.\n",
+           baseline_path);
+    return 0;
+  }
+
+  int regressions =
+      compare(results, scale_count, base, (size_t)base_count, threshold);
+  if (regressions > 0) {
+    printf("\n%d scenario%s regressed by more than %.0f%%.\n", regressions,
+           regressions == 1 ? "" : "s", threshold);
+    return 1;
+  }
+  printf("\nNo regressions beyond %.0f%%.\n", threshold);
+  return 0;
+}
@@ -0,0 +1,48 @@
+#!/bin/sh
+# Compares the serial scan against --jobs N for N = 1, 2, 4, ... up to the
+# core count, and checks that every parallel run prints the same report.
+#
+# Usage: bench/scale_jobs.sh <python_project_directory> [runs]
+
+set -eu
+
+BIN=${PYCYCLE:-./pycycle}
+DIR=${1:?usage: $0 <python_project_directory> [runs]}
+RUNS=${2:-3}
+CORES=$(getconf _NPROCESSORS_ONLN 2>/dev/null || echo 1)
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+now() { date +%s.%N; }
+
+# Best-of-RUNS wall time in seconds for the given pycycle arguments.
+best_time() {
+  best=""
+  i=0
+  while [ "$i" -lt "$RUNS" ]; do
+    start=$(now)
+    "$BIN" "$DIR" "$@" > "$TMP/out.txt"
+    end=$(now)
+    best=$(awk -v s="$start" -v e="$end" -v b="$best" \
+      'BEGIN { t = e - s; if (b == "" || t < b) b = t; print b }')
+    i=$((i + 1))
+  done
+  echo "$best"
+}
+
+serial=$(best_time)
+cp "$TMP/out.txt" "$TMP/serial.txt"
+printf "%-8s %10s %8s\n" "jobs" "seconds" "speedup"
+printf "%-8s %10.3f %8s\n" "serial" "$serial" "1.00x"
+
+jobs=1
+while [ "$jobs" -le "$CORES" ]; do
+  t=$(best_time --jobs "$jobs")
+  if ! cmp -s "$TMP/out.txt" "$TMP/serial.txt"; then
+    echo "Mismatch: --jobs $jobs output differs from the serial run" >&2
+    exit 1
+  fi
+  printf "%-8s %10.3f %7.2fx\n" "$jobs" "$t" \
+    "$(awk -v s="$serial" -v t="$t" 'BEGIN { print s / t }')"
+  jobs=$((jobs * 2))
+done
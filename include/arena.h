@@ -0,0 +1,120 @@
+#ifndef PYCYCLE_ARENA_H
+#define PYCYCLE_ARENA_H
+
+#include <stddef.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct Arena Arena;
+typedef struct ArenaChunk ArenaChunk;
+typedef struct ArenaPhaseStats ArenaPhaseStats;
+
+/**
+ * @struct ArenaChunk
+ * @brief One mmap'd block of arena memory. Chunks form a singly linked list,
+ * newest first.
+ */
+struct ArenaChunk {
+  ArenaChunk *next; /**< The previously filled chunk */
+  size_t size;      /**< Usable bytes in data */
+  size_t used;      /**< Bytes handed out so far */
+  size_t mapped;    /**< Total bytes mapped, header included */
+  char data[];      /**< The memory itself */
+};
+
+/**
+ * @struct Arena
+ * @brief A bump allocator. Allocations are never freed individually; the
+ * whole arena is reset or released at once, which costs one munmap per chunk.
+ *
+ * Every arena belongs to a phase (e.g. "graph" for long-lived data, "lexer"
+ * for per-file scratch memory). Usage is accounted per phase so a run can
+ * report where its memory went.
+ */
+struct Arena {
+  ArenaChunk *head;  /**< The chunk currently being filled */
+  size_t chunk_size; /**< Default size of new chunks */
+  int phase;         /**< Index of the phase this arena is accounted to */
+  size_t allocated;  /**< Bytes handed out since the last reset */
+};
+
+/**
+ * @struct ArenaPhaseStats
+ * @brief Process-wide usage of all arenas of one phase.
+ */
+struct ArenaPhaseStats {
+  const char *name;       /**< The phase name given to arena_init */
+  size_t total_allocated; /**< Bytes handed out over the whole run */
+  size_t reserved;        /**< Bytes currently mapped */
+  size_t peak_reserved;   /**< Highest value reserved ever reached */
+  size_t chunks_mapped;   /**< Number of chunks mapped over the whole run */
+};
+
+/**
+ * @brief Initializes an empty arena. No memory is mapped until first use.
+ * @param arena Pointer to the Arena.
+ * @param chunk_size Default chunk size in bytes (0 picks 64 KiB).
+ * @param phase Name of the phase to account this arena to (a string literal).
+ */
+void arena_init(Arena *arena, size_t chunk_size, const char *phase);
+
+/**
+ * @brief Allocates size bytes aligned to align (a power of two).
+ * @return Pointer to the memory, or NULL if memory fails.
+ */
+void *arena_alloc(Arena *arena, size_t size, size_t align);
+
+/**
+ * @brief Grows an allocation. If ptr is the most recent allocation and the
+ * chunk has room, it is extended in place; otherwise the data is copied to a
+ * new block and the old one is simply abandoned until the next reset.
+ * @param ptr The previous allocation, or NULL.
+ * @param old_size Its size in bytes.
+ * @param new_size The requested size in bytes.
+ * @param align The alignment used for the original allocation.
+ * @return Pointer to the grown memory, or NULL if memory fails.
+ */
+void *arena_realloc(Arena *arena, void *ptr, size_t old_size, size_t new_size,
+                    size_t align);
+
+/**
+ * @brief Copies len bytes of str into the arena and NUL-terminates them.
+ * @return Pointer to the copy, or NULL if memory fails.
+ */
+char *arena_strndup(Arena *arena, const char *str, size_t len);
+
+/**
+ * @brief Forgets every allocation but keeps the newest chunk mapped for
+ * reuse, so a scratch arena reset per file never touches the kernel.
+ * @param arena Pointer to the Arena.
+ */
+void arena_reset(Arena *arena);
+
+/**
+ * @brief Unmaps every chunk of the arena and leaves it empty and reusable.
+ * @param arena Pointer to the Arena.
+ */
+void arena_release(Arena *arena);
+
+/**
+ * @brief Copies the per-phase accounting into out.
+ * @param out Array receiving at most max entries.
+ * @param max Capacity of out.
+ * @return The number of phases written.
+ */
+size_t arena_phase_stats(ArenaPhaseStats *out, size_t max);
+
+/**
+ * @brief Prints the peak and total bytes of every phase.
+ * @param out The stream to print to.
+ */
+void arena_report(FILE *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PYCYCLE_ARENA_H */
@@ -0,0 +1,158 @@
+#ifndef PYCYCLE_CACHE_H
+#define PYCYCLE_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "lexer.h"
+#include <stdint.h>
+
+typedef struct CacheHeader CacheHeader;
+typedef struct CacheEntry CacheEntry;
+typedef struct CacheRecord CacheRecord;
+
+#define CACHE_MAGIC "PYCYCACH"
+#define CACHE_VERSION 3
+#define CACHE_FILE_NAME "imports.cache"
+
+/**
+ * @struct CacheHeader
+ * @brief The start of a cache file. The file is laid out as the header, the
+ * entry table (sorted by path hash), the record table and the string pool,
+ * all in host byte order.
+ */
+struct CacheHeader {
+  char magic[8];          /**< CACHE_MAGIC, not NUL-terminated */
+  uint32_t version;       /**< CACHE_VERSION */
+  uint32_t entry_count;   /**< Number of CacheEntry items */
+  uint32_t lexer_version; /**< LEXER_VERSION of the cached imports */
+  uint32_t reserved;      /**< Zero */
+  uint64_t record_count;  /**< Number of CacheRecord items */
+  uint64_t strings_size;  /**< Size of the string pool in bytes */
+  uint64_t file_size;     /**< Total size, to detect truncated files */
+};
+
+/**
+ * @struct CacheEntry
+ * @brief The cached lexer output of one file, keyed by its path relative to
+ * the scanned directory.
+ */
+struct CacheEntry {
+  uint64_t path_hash;    /**< hashmap_hash_bytes of the relative path */
+  uint64_t content_hash; /**< hashmap_hash_bytes of the file contents */
+  int64_t mtime_sec;     /**< Modification time when the file was lexed */
+  int64_t mtime_nsec;
+  uint64_t size;         /**< File size in bytes */
+  uint64_t inode;        /**< Inode number */
+  uint64_t line_count;   /**< Lines in the file */
+  uint32_t path_offset;  /**< Offset of the relative path in the pool */
+  uint32_t path_len;     /**< Length of the relative path */
+  uint32_t first_record; /**< Index of the first import in the record table */
+  uint32_t record_count; /**< Number of imports */
+};
+
+/**
+ * @struct CacheRecord
+ * @brief One raw import, as stored in ImportList.
+ */
+struct CacheRecord {
+  uint32_t target_offset; /**< Offset of the raw target in the pool */
+  uint32_t target_len;    /**< Length of the raw target */
+  int32_t line_number;    /**< The line number where the import occurs */
+};
+
+/**
+ * @struct ImportCache
+ * @brief The import cache of a --cache directory. The previous run's file is
+ * mapped read-only and looked up in place (safe from any thread); the
+ * entries of this run are collected separately and written out by
+ * import_cache_save.
+ */
+struct ImportCache {
+  char *path;                /**< Path of the cache file */
+  void *map;                 /**< The mapped previous cache, or NULL */
+  size_t map_size;           /**< Size of the mapping */
+  const CacheEntry *entries; /**< Entry table of the previous cache */
+  size_t entry_count;
+  const CacheRecord *records; /**< Record table of the previous cache */
+  size_t record_count;
+  const char *strings;        /**< String pool of the previous cache */
+  size_t strings_size;
+
+  CacheEntry *next_entries;   /**< Entries collected during this run */
+  size_t next_count;
+  size_t next_capacity;
+  CacheRecord *next_records;  /**< Records collected during this run */
+  size_t next_record_count;
+  size_t next_record_capacity;
+  char *next_strings;         /**< String pool collected during this run */
+  size_t next_strings_len;
+  size_t next_strings_cap;
+
+  size_t hits;   /**< Files whose imports came from the cache */
+  size_t misses; /**< Files that had to be lexed */
+};
+
+/**
+ * @brief Opens the cache stored in a directory, creating the directory if
+ * needed. A missing, truncated or incompatible cache file is ignored, so the
+ * run simply starts with an empty cache.
+ * @param dir The cache directory.
+ * @return Pointer to the cache, or NULL if the directory cannot be used.
+ */
+ImportCache *import_cache_open(const char *dir);
+
+/**
+ * @brief Unmaps the previous cache and frees the collected entries.
+ * @param cache Pointer to the cache (may be NULL).
+ */
+void import_cache_close(ImportCache *cache);
+
+/**
+ * @brief Returns the cache key of a file: its path relative to base_dir.
+ * @return A pointer into filepath.
+ */
+const char *import_cache_key(const char *filepath, const char *base_dir);
+
+/**
+ * @brief Looks up the previous run's entry for a key.
+ * @param cache Pointer to the cache.
+ * @param key The relative path returned by import_cache_key.
+ * @return The entry, or NULL if the file was not in the cache.
+ */
+const CacheEntry *import_cache_find(const ImportCache *cache, const char *key);
+
+/**
+ * @brief Appends the imports of a cached entry to an ImportList.
+ * @return 0 on success, -1 on memory allocation failure.
+ */
+int import_cache_fill(const ImportCache *cache, const CacheEntry *entry,
+                      ImportList *out);
+
+/**
+ * @brief Stores the imports of a lexed (or cache-served) file for the next
+ * run and updates the hit/miss counters. Must not be called concurrently.
+ * @param cache Pointer to the cache.
+ * @param filepath The path the file was read from.
+ * @param base_dir The root directory of the project.
+ * @param list The list produced by lex_python_file with this cache.
+ * @return 0 on success, -1 on memory allocation failure.
+ */
+int import_cache_record(ImportCache *cache, const char *filepath,
+                        const char *base_dir, const ImportList *list);
+
+/**
+ * @brief Writes the entries recorded during this run to the cache file.
+ * The file is written under a temporary name and renamed into place, so a
+ * concurrent run sees either the old or the new cache, never a torn one.
+ * @param cache Pointer to the cache.
+ * @return 0 on success, -1 on failure.
+ */
+int import_cache_save(ImportCache *cache);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PYCYCLE_CACHE_H */
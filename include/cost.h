@@ -0,0 +1,99 @@
+#ifndef PYCYCLE_COST_H
+#define PYCYCLE_COST_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "graph.h"
+#include <stdint.h>
+
+typedef struct CostWeight CostWeight;
+typedef struct CostEdge CostEdge;
+typedef struct ImportCost ImportCost;
+
+/**
+ * Above this many strongly connected components the transitive closure no
+ * longer fits in exact bitsets (components^2 / 8 bytes, 32 MiB here) and the
+ * costs are estimated from bottom-k sketches instead.
+ */
+#define COST_EXACT_LIMIT 16384
+
+/** Entries per bottom-k sketch. Sets this small are counted exactly. */
+#define COST_SKETCH_SIZE 64
+
+#define COST_DEFAULT_TOP 20
+
+/**
+ * @struct CostWeight
+ * @brief What loading a set of modules costs.
+ */
+struct CostWeight {
+  uint64_t modules; /**< Number of modules */
+  uint64_t lines;   /**< Lines of source */
+  uint64_t bytes;   /**< Bytes of source */
+};
+
+/**
+ * @struct CostEdge
+ * @brief An import between two components and what it adds to its importer:
+ * the modules that become unreachable from the importing component if this
+ * import (and every other import between the same two components) is
+ * removed, e.g. made lazy.
+ */
+struct CostEdge {
+  int from;         /**< Importing module (the lowest ID with such an import) */
+  int to;           /**< Imported module */
+  int line;         /**< Line of the import in from's file */
+  CostWeight added; /**< Weight only reachable through this import */
+};
+
+/**
+ * @struct ImportCost
+ * @brief The transitive import cost of every module. All members of a strongly
+ * connected component import each other, so costs are kept per component.
+ */
+struct ImportCost {
+  SccList *sccs;      /**< Components of the graph, imported ones first */
+  CostWeight *self;   /**< Weight of the members of each component */
+  CostWeight *total;  /**< Weight of everything each component loads,
+                         itself included */
+  CostEdge *edges;    /**< One entry per edge of the condensed graph */
+  size_t edge_count;  /**< Number of entries in edges */
+  bool exact;         /**< False if the totals are sketch estimates */
+};
+
+/**
+ * @brief Weighs every module by the size and line count of its file,
+ * condenses the graph by strongly connected component and computes, in
+ * reverse topological order, the weight each component loads transitively
+ * and the weight each condensed edge adds.
+ *
+ * Up to COST_EXACT_LIMIT components the reachable sets are exact bitsets
+ * (O(C * E / 64) word operations). Above it every component keeps a
+ * bottom-k sketch of COST_SKETCH_SIZE entries, which is O(k * (V + E)) time
+ * and memory; sets with fewer than k components are still counted exactly.
+ * Freezes the graph first if needed.
+ * @param g Pointer to the Graph.
+ * @return The costs, or NULL if memory fails. Free with import_cost_free.
+ */
+ImportCost *graph_import_cost(Graph *g);
+
+/**
+ * @brief Frees an ImportCost returned by graph_import_cost.
+ */
+void import_cost_free(ImportCost *cost);
+
+/**
+ * @brief Prints the heaviest entry points (one line per component, ranked by
+ * transitive bytes) and the imports that add the most to their importer.
+ * @param g Pointer to the Graph.
+ * @param top How many rows each ranking shows.
+ */
+void graph_report_import_cost(Graph *g, size_t top);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PYCYCLE_COST_H */
@@ -0,0 +1,59 @@
+#ifndef PYCYCLE_CYCLES_H
+#define PYCYCLE_CYCLES_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "graph.h"
+
+typedef struct CycleOptions CycleOptions;
+
+/**
+ * @enum CycleMode
+ * @brief How many concrete import loops to report per strongly connected
+ * component.
+ */
+typedef enum {
+  CYCLES_ALL = 0,  /**< Every elementary cycle (Johnson's algorithm) */
+  CYCLES_SHORTEST, /**< The shortest loop through each member module */
+} CycleMode;
+
+/**
+ * @struct CycleOptions
+ * @brief Bounds for cycle enumeration. Both caps are hard: enumeration stops
+ * as soon as either one is hit.
+ */
+struct CycleOptions {
+  CycleMode mode;        /**< Enumeration strategy */
+  size_t max_cycles;     /**< Stop after reporting this many cycles */
+  double time_limit_sec; /**< Stop after this much wall-clock time */
+};
+
+#define CYCLES_DEFAULT_MAX 100000
+#define CYCLES_DEFAULT_TIME_LIMIT 10.0
+
+/**
+ * @brief Parses a --cycles argument ("all", "shortest" or "limit=N").
+ * @param arg The argument string.
+ * @param opts Options to update. Caps not mentioned in arg are left as is.
+ * @return 0 on success, -1 if the argument is not recognized.
+ */
+int cycle_options_parse(const char *arg, CycleOptions *opts);
+
+/**
+ * @brief Enumerates concrete import loops inside every non-trivial strongly
+ * connected component. Each cycle is rotated so that its lowest node ID comes
+ * first, deduplicated by fingerprint, and written through report_cycle as
+ * soon as it is found, so memory stays bounded by the cycle cap.
+ * @param g Pointer to the Graph.
+ * @param opts Enumeration mode and caps.
+ * @return The number of distinct cycles reported.
+ */
+size_t graph_enumerate_cycles(Graph *g, const CycleOptions *opts);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PYCYCLE_CYCLES_H */
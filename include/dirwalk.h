@@ -0,0 +1,106 @@
+#ifndef PYCYCLE_DIRWALK_H
+#define PYCYCLE_DIRWALK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "exclude.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+/** Bytes of directory entries fetched per getdents64 call. */
+#define DIRWALK_BUFFER 32768
+
+typedef struct PathBuf PathBuf;
+
+/**
+ * @struct PathBuf
+ * @brief A growable path: components are appended while descending and cut
+ * off again on the way up, so no depth or length is too much.
+ */
+struct PathBuf {
+  char *buf;       /**< NUL-terminated path */
+  size_t len;      /**< Length of the path, without the NUL */
+  size_t capacity; /**< Allocated size of buf */
+};
+
+/**
+ * @brief Sets a path buffer to a copy of path. The buffer must be
+ * zero-initialized or freed before the first call.
+ * @return 0 on success, -1 on memory allocation failure.
+ */
+int path_buf_set(PathBuf *p, const char *path);
+
+/**
+ * @brief Appends "/" and name to the path.
+ * @param p The path buffer.
+ * @param name The component to append (need not be NUL-terminated).
+ * @param len Length of name.
+ * @return The length of the path before the call (for path_buf_truncate), or
+ * (size_t)-1 on memory allocation failure.
+ */
+size_t path_buf_push(PathBuf *p, const char *name, size_t len);
+
+/**
+ * @brief Cuts the path back to a length returned by path_buf_push.
+ */
+void path_buf_truncate(PathBuf *p, size_t len);
+
+/**
+ * @brief Frees the path storage.
+ */
+void path_buf_free(PathBuf *p);
+
+/**
+ * @struct WalkEntry
+ * @brief A regular file or directory met by dir_walk. The strings are only
+ * valid during the callback.
+ */
+typedef struct {
+  const char *path; /**< The root, "/", then every component down to name */
+  size_t path_len;
+  const char *relative; /**< The part of path below the base directory */
+  size_t relative_len;
+  const char *name; /**< The last component */
+  size_t name_len;
+  bool is_dir;
+  size_t depth; /**< 1 for the entries of the root itself */
+} WalkEntry;
+
+/**
+ * @brief Called for every regular file and directory below the root, in the
+ * order readdir would list them, depth first.
+ * @return For a directory, 1 to descend into it and 0 to skip it; for a file
+ * the value is ignored unless it is -1, which stops the walk.
+ */
+typedef int (*WalkVisitFn)(const WalkEntry *entry, void *ctx);
+
+/**
+ * @brief Walks everything below root without recursion: an explicit stack
+ * holds one directory fd per level, opened with openat relative to its
+ * parent, and entries are read with getdents64. The file type comes from
+ * d_type; only symlinks and DT_UNKNOWN entries (some file systems) cost an
+ * fstatat, which follows the link as stat does. Entries other than regular
+ * files and directories are skipped. A directory that cannot be opened is
+ * skipped with a warning. Open directories are capped at half the fd limit:
+ * past that, the ancestors are closed and reopened by path on the way back
+ * up, so no depth is too much.
+ * @param root The directory to walk.
+ * @param base_dir The project root that root lies in, which anchored exclude
+ * patterns and WalkEntry::relative start from; NULL if it is root itself.
+ * @param exclude Entries this set matches are skipped before visit sees
+ * them, so an excluded directory is never opened; NULL for none.
+ * @param visit Callback for every entry.
+ * @param ctx Passed to visit.
+ * @return 0 on success, -1 if root cannot be opened, visit returned -1 or
+ * memory failed.
+ */
+int dir_walk(const char *root, const char *base_dir,
+             const ExcludeSet *exclude, WalkVisitFn visit, void *ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PYCYCLE_DIRWALK_H */
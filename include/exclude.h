@@ -0,0 +1,144 @@
+#ifndef PYCYCLE_EXCLUDE_H
+#define PYCYCLE_EXCLUDE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "arena.h"
+#include "hashmap.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/** Most tokens a wildcard pattern compiles to (one bit of state each). */
+#define EXCLUDE_MAX_TOKENS 63
+
+typedef struct ExcludeSet ExcludeSet;
+
+/**
+ * @enum ExcludeKind
+ * @brief What a compiled rule is checked with.
+ */
+typedef enum {
+  EXCLUDE_LITERAL, /**< "venv": one hash lookup */
+  EXCLUDE_PREFIX,  /**< "build*": prefix table, by first byte */
+  EXCLUDE_SUFFIX,  /**< "*.egg-info": suffix table, by last byte */
+  EXCLUDE_GLOB,    /**< Anything else: a small automaton */
+} ExcludeKind;
+
+/**
+ * @struct ExcludeToken
+ * @brief One step of a compiled wildcard pattern.
+ */
+typedef struct {
+  uint8_t op;   /**< A byte, '?', a class, '*' or "**" */
+  bool skip;    /**< "**" before a '/': may also match no directory */
+  uint16_t arg; /**< The byte, or the class index */
+} ExcludeToken;
+
+/**
+ * @struct ExcludeRule
+ * @brief One compiled pattern, in .gitignore syntax.
+ */
+typedef struct {
+  ExcludeKind kind;
+  bool negate;   /**< "!pattern": re-includes what earlier rules excluded */
+  bool dir_only; /**< "pattern/": matches directories only */
+  bool anchored; /**< Contains a '/': matched against the path below the
+                    root instead of the entry name */
+  const char *text; /**< Literal, prefix or suffix bytes */
+  size_t len;
+  const ExcludeToken *tokens; /**< EXCLUDE_GLOB program */
+  size_t token_count;
+  int next; /**< Earlier rule in the same table slot, or -1 */
+} ExcludeRule;
+
+/**
+ * @struct ExcludeSet
+ * @brief Patterns compiled once and checked for every directory entry of a
+ * walk. Each table slot chains its rules newest first, so the rule that
+ * decides (the last one that matches, as in git) is found without trying
+ * every pattern.
+ */
+struct ExcludeSet {
+  ExcludeRule *rules;
+  size_t count, capacity;
+  Hashmap *names;         /**< Literal name -> newest rule */
+  Hashmap *paths;         /**< Literal anchored path -> newest rule */
+  int prefix_head[256];   /**< Newest prefix rule by first byte */
+  int suffix_head[256];   /**< Newest suffix rule by last byte */
+  int glob_head;          /**< Newest glob rule */
+  uint64_t (*classes)[4]; /**< Byte sets of [...] tokens */
+  size_t class_count, class_capacity;
+  bool has_negation; /**< Without "!" rules the first match decides */
+  Arena strings;     /**< Pattern text, tokens and the hash tables */
+};
+
+/**
+ * @brief The rules every walk applies (walk_directory, the parallel and
+ * batched walks, watch mode and git history), or NULL for none. Set from the
+ * command line, like internal_only.
+ */
+extern ExcludeSet *walk_excludes;
+
+/**
+ * @brief Creates an empty set.
+ * @return The set, or NULL if memory fails. Free with exclude_set_free.
+ */
+ExcludeSet *exclude_set_create(void);
+
+/**
+ * @brief Frees a set returned by exclude_set_create.
+ */
+void exclude_set_free(ExcludeSet *set);
+
+/**
+ * @brief Compiles one pattern in .gitignore syntax: '*' and '?' do not
+ * cross '/', "**" does, [a-z] and [!a-z] are byte classes, a leading '!'
+ * negates, a trailing '/' limits the rule to directories and any other '/'
+ * anchors it to the root. Blank lines and '#' comments are ignored.
+ * @param set The set.
+ * @param pattern The pattern (need not be NUL-terminated).
+ * @param len Length of pattern.
+ * @return 0 on success (or an ignored line), -1 for a pattern longer than
+ * EXCLUDE_MAX_TOKENS tokens or a memory allocation failure.
+ */
+int exclude_set_add(ExcludeSet *set, const char *pattern, size_t len);
+
+/**
+ * @brief Adds the trees that are never part of a project: .git, venv, .venv,
+ * .tox, node_modules and site-packages directories anywhere, and build at the
+ * root (packages named build, like pip's, are kept below it).
+ * @return 0 on success, -1 on memory allocation failure.
+ */
+int exclude_set_add_defaults(ExcludeSet *set);
+
+/**
+ * @brief Adds every line of an ignore file. Lines that do not compile are
+ * skipped with a warning.
+ * @param set The set.
+ * @param path The file, e.g. "<project>/.gitignore".
+ * @return 0 on success, -1 if the file cannot be read.
+ */
+int exclude_set_load(ExcludeSet *set, const char *path);
+
+/**
+ * @brief Decides whether a directory entry is excluded.
+ * @param set The set.
+ * @param relative The path below the walk root ("pkg/build").
+ * @param relative_len Length of relative.
+ * @param name The last component ("build").
+ * @param name_len Length of name.
+ * @param is_dir Whether the entry is a directory.
+ * @return true if the newest matching rule excludes the entry.
+ */
+bool exclude_set_match(const ExcludeSet *set, const char *relative,
+                       size_t relative_len, const char *name, size_t name_len,
+                       bool is_dir);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PYCYCLE_EXCLUDE_H */
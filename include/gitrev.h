@@ -0,0 +1,46 @@
+#ifndef PYCYCLE_GITREV_H
+#define PYCYCLE_GITREV_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "graph.h"
+#include "hashmap.h"
+
+/**
+ * @brief Builds the import graph of a directory as it was at a git revision,
+ * without checking it out. The .py blobs are listed from the revision's tree
+ * and streamed through the lexer by one `git cat-file --batch` process.
+ * @param directory A directory inside a git work tree. Module names are
+ * relative to it, as in walk_directory.
+ * @param rev Any revision git understands (e.g. "HEAD~3", a tag, an oid).
+ * @param map_out Receives the registry of the graph (it lives in the graph's
+ * arena).
+ * @return The frozen Graph, or NULL if git or the revision is unavailable.
+ */
+Graph *git_build_graph(const char *directory, const char *rev,
+                       Hashmap **map_out);
+
+/**
+ * @brief Analyses every commit of a range (as listed by
+ * `git rev-list --reverse A..B`) and prints, per commit, the circular
+ * dependencies that appeared or disappeared since the previous one, starting
+ * from A.
+ *
+ * One graph is kept across the range. Between two commits only subtrees
+ * whose tree id changed are read, only modules whose blob changed are merged
+ * again (graph_replace_edges), and lexed imports are cached by blob id, so a
+ * file version is lexed once however many commits contain it.
+ *
+ * @param directory A directory inside a git work tree.
+ * @param range The range, of the form A..B (an empty side means HEAD).
+ * @return 0 on success, -1 if git, the range or memory failed.
+ */
+int git_report_range(const char *directory, const char *range);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PYCYCLE_GITREV_H */
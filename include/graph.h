@@ -5,54 +5,128 @@
 extern "C" {
 #endif
 
-#define COLOR_RED "\x1b[31m"
-#define COLOR_GREEN "\x1b[32m"
-#define COLOR_YELLOW "\x1b[33m"
-#define COLOR_CYAN "\x1b[36m"
-#define COLOR_RESET "\x1b[0m"
-#define STYLE_BOLD "\x1b[1m"
-
+#include "arena.h"
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
+
+/** True if output may contain ANSI escapes (stdout is a terminal). */
+extern bool color_output;
+
+#define ANSI(code) (color_output ? "\x1b[" code "m" : "")
+#define COLOR_RED ANSI("31")
+#define COLOR_GREEN ANSI("32")
+#define COLOR_YELLOW ANSI("33")
+#define COLOR_CYAN ANSI("36")
+#define COLOR_RESET ANSI("0")
+#define STYLE_BOLD ANSI("1")
 
 typedef struct Edge Edge;
 typedef struct Node Node;
 typedef struct Graph Graph;
+typedef struct SccList SccList;
 
 /**
  * @struct Edge
- * @brief Represents a single directed import from one module to another.
+ * @brief Represents a single directed import from one module to another, as
+ * recorded in the append-only build buffer.
  */
 struct Edge {
+  int from_id;     /**< The integer ID of the importing module */
   int target_id;   /**< The integer ID of the imported module */
   int line_number; /**< The line number in the source file where this import
                       occurs */
-  Edge *next; /**< Pointer to the next edge in the linked list (for chaining) */
 };
 
 /**
  * @struct Node
- * @brief Represents a single module in the graph, containing its name and a
- * linked list of outgoing edges.
+ * @brief Represents a single module in the graph.
  */
 struct Node {
-  char *name;   /**< The name of the module */
-  Edge *edges;  /**< Pointer to the head of the linked list of outgoing edges */
-  bool visited; /**< Flag for DFS: has this node been fully processed? */
-  bool in_stack; /**< Flag for DFS: is this node in the current traversal path?
-                  */
+  char *name; /**< The name of the module, interned in Graph::arena */
+  char *path; /**< The file that defines the module, relative to the analysed
+                 directory and interned in Graph::arena (or in the snapshot);
+                 NULL for modules that are only imported */
+  uint64_t source_bytes; /**< Size of that file; 0 if there is none */
+  uint64_t source_lines; /**< Lines in that file; 0 if there is none */
 };
 
 /**
  * @struct Graph
  * @brief Represents the entire graph of modules and their imports.
+ *
+ * Edges are appended to a build buffer by graph_add_edge. graph_freeze then
+ * sorts, deduplicates and packs them into compressed sparse row (CSR) arrays:
+ * the imports of node v are edge_targets/edge_lines[edge_offsets[v] ..
+ * edge_offsets[v + 1]), sorted by target ID. Every traversal walks these
+ * contiguous arrays and requires a frozen graph.
  */
 struct Graph {
-  Node **nodes;      /**< Dynamic array of pointers to Nodes */
+  Node *nodes;       /**< Dynamic array of Nodes, indexed by node ID */
   size_t node_count; /**< Current number of nodes in the graph */
   size_t capacity;   /**< Current capacity of the nodes array */
+  Arena arena;       /**< Long-lived storage for every Node::name and the
+                        registry table; the registry's keys point here */
+
+  Edge *pending;           /**< Edges added since the last freeze */
+  size_t pending_count;    /**< Number of pending edges */
+  size_t pending_capacity; /**< Allocated capacity of the pending buffer */
+
+  size_t *edge_offsets;  /**< CSR row offsets, frozen_nodes + 1 entries */
+  int *edge_targets;     /**< CSR column array: imported node IDs */
+  int *edge_lines;       /**< Line number of each CSR edge */
+  size_t edge_count;     /**< Number of edges in the CSR arrays */
+  size_t frozen_nodes;   /**< node_count at the time of the last freeze */
+
+  void *snapshot;        /**< Mapped snapshot file the names (and, while
+                            csr_mapped, the CSR arrays) point into, or NULL */
+  size_t snapshot_size;  /**< Size of the mapping */
+  bool csr_mapped;       /**< True while the CSR arrays are read-only views
+                            into the snapshot */
+};
+
+/**
+ * @brief Returns true if the CSR arrays reflect every node and edge added.
+ */
+static inline bool graph_is_frozen(const Graph *g) {
+  return g->pending_count == 0 && g->frozen_nodes == g->node_count &&
+         (g->edge_offsets != NULL || g->node_count == 0);
+}
+
+/**
+ * @brief Index of the first outgoing edge of node v in the CSR arrays.
+ */
+static inline size_t graph_edges_begin(const Graph *g, int v) {
+  return g->edge_offsets[v];
+}
+
+/**
+ * @brief One past the index of the last outgoing edge of node v.
+ */
+static inline size_t graph_edges_end(const Graph *g, int v) {
+  return g->edge_offsets[v + 1];
+}
+
+/**
+ * @struct SccList
+ * @brief The strongly connected components of a graph. Components are stored
+ * in the order Tarjan's algorithm completes them, which is a reverse
+ * topological order of the condensed graph (imported components first).
+ */
+struct SccList {
+  int *members;      /**< Node IDs grouped by component */
+  size_t *offsets;   /**< Component c spans members[offsets[c]..offsets[c+1]) */
+  size_t count;      /**< Number of components */
+  int *component_of; /**< Component index of every node, by node ID */
 };
 
+/**
+ * @brief Returns the number of modules in component c.
+ */
+static inline size_t scc_size(const SccList *sccs, size_t c) {
+  return sccs->offsets[c + 1] - sccs->offsets[c];
+}
+
 /**
  * @brief Allocates and initializes a new Graph.
  * @param initial_capacity The starting size of the node array.
@@ -62,7 +136,9 @@ Graph *graph_create(size_t initial_capacity);
 
 /**
  * @brief Safely frees all memory inside the graph (Nodes, Edges, and the
- * Graph itself).
+ * Graph itself). Names live in the graph arena (or a snapshot mapping), so
+ * this is a handful of free/munmap calls regardless of the number of
+ * modules.
  * @param g Pointer to the Graph.
  */
 void graph_free(Graph *g);
@@ -76,7 +152,9 @@ void graph_free(Graph *g);
 int graph_add_node(Graph *g, const char *name);
 
 /**
- * @brief Adds a directed edge from one node to another in the graph.
+ * @brief Adds a directed edge from one node to another in the graph. The edge
+ * is appended to the build buffer in O(1); duplicates are removed by the next
+ * graph_freeze, which keeps the first line number seen.
  * @param g Pointer to the Graph.
  * @param from_id The integer ID of the source node (the importer).
  * @param to_id The integer ID of the target node (the imported module).
@@ -87,7 +165,102 @@ int graph_add_node(Graph *g, const char *name);
 int graph_add_edge(Graph *g, int from_id, int to_id, int line_number);
 
 /**
- * @brief Traverses the graph to find and print all circular dependencies.
+ * @brief Packs all edges added so far into the CSR arrays. Edges are sorted
+ * and deduplicated with two stable counting-sort passes, in O(V + E). Cheap to
+ * call again when nothing changed.
+ * @param g Pointer to the Graph.
+ * @return 0 on success, -1 on memory allocation failure.
+ */
+int graph_freeze(Graph *g);
+
+/**
+ * @brief Replaces the frozen outgoing edges of node v with the edges added
+ * since the last freeze, which must all originate from v (e.g. one file
+ * merged again after it changed). Rows of nodes added since the freeze are
+ * created empty. Costs one pass over the CSR tail instead of a full
+ * graph_freeze.
+ * @param g Pointer to a Graph that has been frozen before.
+ * @param v The node whose imports are replaced.
+ * @return 1 if the graph changed, 0 if the new imports are identical, or -1
+ * on failure (invalid arguments or memory allocation failure).
+ */
+int graph_replace_edges(Graph *g, int v);
+
+/**
+ * @brief Looks up the line number of the import from_id -> to_id with a
+ * binary search of from_id's CSR row. The graph must be frozen.
+ * @return The line number, or 0 if there is no such edge.
+ */
+int graph_edge_line(const Graph *g, int from_id, int to_id);
+
+/**
+ * @brief Computes the strongly connected components of the graph with an
+ * iterative (explicit-stack) Tarjan pass in O(V + E) time. Every module that
+ * takes part in a circular import ends up in a component of size > 1.
+ * Freezes the graph first if needed.
+ * @param g Pointer to the Graph.
+ * @return The components, or NULL if memory fails. Free with scc_list_free.
+ */
+SccList *graph_find_sccs(Graph *g);
+
+/**
+ * @brief Frees an SccList returned by graph_find_sccs.
+ * @param sccs Pointer to the SccList.
+ */
+void scc_list_free(SccList *sccs);
+
+/**
+ * @brief Builds the condensed graph of a set of components, as CSR arrays:
+ * the components imported by component c are targets[offsets[c] ..
+ * offsets[c + 1]), each listed once. Since components come in reverse
+ * topological order, every target is lower than its row. O(V + E).
+ * @param g Pointer to the frozen Graph.
+ * @param sccs The components of g.
+ * @param offsets_out Receives the row offsets, sccs->count + 1 entries.
+ * @param targets_out Receives the component targets.
+ * @param imports_out If not NULL, receives for every condensed edge the CSR
+ * index of one import it stands for: the one from the lowest module ID.
+ * @return 0 on success, -1 on memory allocation failure. The arrays are
+ * freed with free().
+ */
+int scc_condense(const Graph *g, const SccList *sccs, size_t **offsets_out,
+                 int **targets_out, size_t **imports_out);
+
+/**
+ * @brief Finds a shortest import loop through start that stays inside its
+ * strongly connected component, using a BFS.
+ * @param g Pointer to the frozen Graph.
+ * @param sccs The components of g.
+ * @param start The node the loop must pass through.
+ * @param parent Scratch array of node_count entries, all -1 on entry. It is
+ * restored to all -1 on return.
+ * @param queue Scratch array of node_count entries.
+ * @param path Output array of node_count entries receiving the loop, which
+ * starts at start.
+ * @return The number of nodes in the loop, or 0 if start is on no cycle.
+ */
+int graph_shortest_loop(const Graph *g, const SccList *sccs, int start,
+                        int *parent, int *queue, int *path);
+
+/**
+ * @brief Prints one circular dependency: a shortest import loop through the
+ * lowest node ID of component c and, if the component has more imports than
+ * the loop, every import between its members.
+ * @param g Pointer to the frozen Graph.
+ * @param sccs The components of g (members of c are sorted in place).
+ * @param c The component to report. Must have at least two members.
+ * @param parent Scratch array of node_count entries, all -1 on entry.
+ * @param queue Scratch array of node_count entries.
+ * @param path Scratch array of node_count entries.
+ */
+void graph_report_component(const Graph *g, const SccList *sccs, size_t c,
+                            int *parent, int *queue, int *path);
+
+/**
+ * @brief Finds and prints every circular dependency. Each non-trivial strongly
+ * connected component is reported once, with a shortest import loop through
+ * it and (in text reports) every import line between its members. Components
+ * are written as they are found and stdout is flushed at the end.
  * @param g Pointer to the Graph.
  */
 void graph_find_cycles(Graph *g);
@@ -1,66 +1,120 @@
 #ifndef PYCYCLE_HASHMAP_H
 #define PYCYCLE_HASHMAP_H
 
+#include "arena.h"
 #include <stddef.h>
+#include <stdint.h>
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 typedef struct Hashmap Hashmap;
-typedef struct HashmapItem HashmapItem;
+typedef struct HashmapSlot HashmapSlot;
 
 /**
- * @struct HashmapItem
- * @brief Represents a single key-value pair in the hashmap.
- * Uses a linked list node structure to handle hash collisions (Separate
- * Chaining).
+ * @struct HashmapSlot
+ * @brief One slot of the open-addressing table. The full 64-bit hash is
+ * cached so probes compare hashes before touching the key bytes, and resizes
+ * never rehash a string.
  */
-struct HashmapItem {
-  char *key;         /**< The module name (e.g., "app.models.user") */
-  int value;         /**< The corresponding Graph Node ID */
-  HashmapItem *next; /**< Pointer to the next item in the same bucket */
+struct HashmapSlot {
+  uint64_t hash;    /**< Cached hash of the key */
+  const char *key;  /**< Borrowed module name (e.g., "app.models.user"), or
+                       NULL if the slot is empty */
+  uint32_t key_len; /**< Length of the key in bytes */
+  int value;        /**< The corresponding Graph Node ID */
 };
 
 /**
  * @struct Hashmap
  * @brief The registry mapping Python module string names to integer IDs.
+ * Uses Robin Hood open addressing over a power-of-two table. Keys are not
+ * copied: they point into the interned name storage of the Graph, so every
+ * module name exists exactly once in memory.
  */
 struct Hashmap {
-  HashmapItem **buckets; /**< Array of pointers to HashmapItems (the buckets) */
-  size_t capacity;       /**< Total number of buckets allocated */
-  size_t count;          /**< Total number of items stored in the map */
+  HashmapSlot *slots; /**< The table itself */
+  size_t capacity;    /**< Number of slots (a power of two) */
+  size_t count;       /**< Total number of items stored in the map */
+  Arena *arena;       /**< Arena the map allocates from, or NULL for heap */
 };
 
+/**
+ * @brief 64-bit hash that consumes 8 bytes per step. Module names are short,
+ * so a multiply-xorshift mix per word is both fast and well distributed
+ * across the low bits used for the table index.
+ * @param str The bytes to hash.
+ * @param len Number of bytes.
+ * @return The 64-bit hash.
+ */
+uint64_t hashmap_hash_bytes(const char *str, size_t len);
+
 /**
  * @brief Allocates and initializes a new Hashmap.
- * @param capacity The number of buckets (should ideally be a prime number).
+ * @param capacity Expected number of entries. Rounded up to a power of two.
  * @return Pointer to the allocated Hashmap, or NULL if memory fails.
  */
 Hashmap *hashmap_create(size_t capacity);
 
 /**
- * @brief Safely frees the hashmap, including all duplicated string keys and
- * items.
+ * @brief Allocates a Hashmap whose struct and tables live in an arena, such
+ * as the graph's, so it is torn down together with it. Tables outgrown by a
+ * resize stay in the arena until it is released.
+ * @param arena The arena to allocate from.
+ * @param capacity Expected number of entries. Rounded up to a power of two.
+ * @return Pointer to the allocated Hashmap, or NULL if memory fails.
+ */
+Hashmap *hashmap_create_in(Arena *arena, size_t capacity);
+
+/**
+ * @brief Frees the hashmap table. Does nothing for arena-backed maps. Keys
+ * are borrowed and are not freed.
  * @param map Pointer to the Hashmap.
  */
 void hashmap_free(Hashmap *map);
 
 /**
- * @brief Inserts a new key-value pair into the hashmap.
+ * @brief Inserts a key-value pair, or updates the value if the key exists.
  * @param map Pointer to the Hashmap.
- * @param key The module name string to insert.
+ * @param key The module name to insert. It is not copied and must outlive
+ * the map (use the Graph's interned Node::name).
  * @param value The Graph Node ID associated with this module.
  * @return 0 on success, -1 on memory allocation failure or invalid inputs.
  */
 int hashmap_put(Hashmap *map, const char *key, int value);
 
+/**
+ * @brief Removes every entry and keeps the table at its current size, e.g.
+ * to register the nodes of a renumbered graph again.
+ * @param map Pointer to the Hashmap.
+ */
+void hashmap_clear(Hashmap *map);
+
 /**
  * @brief Retrieves the integer ID for a given module name.
  * @param map Pointer to the Hashmap.
  * @param key The module name string to look up.
  * @return The integer ID if found, or -1 if the key does not exist.
  */
-int hashmap_get(Hashmap *map, const char *key);
+int hashmap_get(const Hashmap *map, const char *key);
+
+/**
+ * @brief Like hashmap_get, for a key that is not NUL-terminated.
+ * @param map Pointer to the Hashmap.
+ * @param key Pointer to the first byte of the key.
+ * @param len Length of the key in bytes.
+ * @return The integer ID if found, or -1 if the key does not exist.
+ */
+int hashmap_get_n(const Hashmap *map, const char *key, size_t len);
+
+/**
+ * @brief Measures how far entries sit from their ideal slot, for --stats.
+ * @param map Pointer to the Hashmap.
+ * @param max_probe Receives the longest probe sequence (0 = in place).
+ * @param mean_probe Receives the average probe distance.
+ */
+void hashmap_probe_stats(const Hashmap *map, size_t *max_probe,
+                         double *mean_probe);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,78 @@
+#ifndef PYCYCLE_IOREAD_H
+#define PYCYCLE_IOREAD_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <sys/stat.h>
+
+/**
+ * @enum IoBackend
+ * @brief How the walk reads source files.
+ */
+typedef enum {
+  IO_MMAP = 0, /**< open + mmap per file, inside lex_python_file (default) */
+  IO_PREAD,    /**< open + pread into a reused buffer, one file at a time */
+  IO_URING,    /**< io_uring: many opens and reads in flight at once */
+} IoBackend;
+
+/** Default number of files an IO_URING batch keeps in flight. */
+#define IO_DEFAULT_DEPTH 256
+
+/** Largest accepted depth (the submission queue holds this many entries). */
+#define IO_MAX_DEPTH 4096
+
+/**
+ * @struct ReadHandler
+ * @brief What a batch calls back, always on the calling thread. With
+ * IO_URING the calls come in completion order, while the kernel keeps
+ * working on the other files.
+ */
+typedef struct {
+  /** A file was opened: return 1 to read it, 0 if it needs no contents
+   * (served from a cache), -1 to stop the batch. */
+  int (*opened)(size_t index, const struct stat *st, void *ctx);
+  /** The whole contents of a file. The buffer is reused after the call. */
+  int (*contents)(size_t index, const char *data, size_t size, void *ctx);
+  /** A file could not be opened or read (error is an errno value). */
+  void (*failed)(size_t index, int error, void *ctx);
+  void *ctx;
+} ReadHandler;
+
+/**
+ * @brief Parses "mmap", "pread" or "uring".
+ * @return 0 on success, -1 for an unknown name.
+ */
+int io_backend_parse(const char *name, IoBackend *out);
+
+/**
+ * @brief Returns "mmap", "pread" or "uring".
+ */
+const char *io_backend_name(IoBackend backend);
+
+/**
+ * @brief Reads a batch of files and hands each one to the handler. With
+ * IO_URING, up to depth files are in flight: their opens and reads are
+ * queued on one io_uring, and every buffer is handed over as soon as it is
+ * complete, so parsing overlaps the I/O of the rest. If io_uring is not
+ * available (old kernel, seccomp, io_uring_disabled), the batch falls back to
+ * IO_PREAD.
+ * @param paths The files to read.
+ * @param count Number of paths.
+ * @param backend IO_PREAD or IO_URING.
+ * @param depth Files in flight for IO_URING (1 .. IO_MAX_DEPTH).
+ * @param handler The callbacks.
+ * @return The backend that did the reading, or -1 if the batch was stopped
+ * or memory failed.
+ */
+int read_files(char *const *paths, size_t count, IoBackend backend,
+               size_t depth, const ReadHandler *handler);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PYCYCLE_IOREAD_H */
@@ -7,6 +7,202 @@ extern "C" {
 
 #include "graph.h"
 #include "hashmap.h"
+#include <sys/stat.h>
+
+typedef struct ImportRecord ImportRecord;
+typedef struct ImportList ImportList;
+typedef struct FileStamp FileStamp;
+typedef struct ImportCache ImportCache;
+typedef struct NodeList NodeList;
+
+/**
+ * Version of what the lexer extracts from a file. Bump it with every change
+ * that makes some file lex to different imports, so import caches written by
+ * an older lexer are not reused.
+ */
+#define LEXER_VERSION 2
+
+/**
+ * @struct ImportRecord
+ * @brief A single raw import target as written in the source file, before it
+ * is resolved against the importing module (e.g. "..models.User").
+ */
+struct ImportRecord {
+  size_t offset;   /**< Offset of the NUL-terminated raw target (possibly
+                      relative, e.g. "..models.User") in ImportList::strings */
+  size_t length;   /**< Length of the raw target, excluding the NUL */
+  int line_number; /**< The line number where this import occurs */
+};
+
+/**
+ * @struct FileStamp
+ * @brief What the import cache needs to know about a file to decide whether
+ * its imports can be reused.
+ */
+struct FileStamp {
+  int64_t mtime_sec;     /**< Modification time (seconds) */
+  int64_t mtime_nsec;    /**< Modification time (nanoseconds) */
+  uint64_t size;         /**< File size in bytes */
+  uint64_t inode;        /**< Inode number */
+  uint64_t content_hash; /**< Hash of the contents (only set with a cache) */
+};
+
+/**
+ * @struct ImportList
+ * @brief Everything the lexer extracted from one file. Lists are produced
+ * independently (possibly on worker threads) and merged into the Graph later.
+ */
+struct ImportList {
+  char *module_name;    /**< The module this file defines (e.g. "app.models") */
+  char *file_path;      /**< The file, relative to the base directory */
+  bool is_package;      /**< True if the file is a package's __init__.py */
+  int status;           /**< 0 if the file was read, -1 if it could not be */
+  ImportRecord *items;  /**< Dynamic array of raw imports, in file order */
+  size_t count;         /**< Number of imports stored */
+  size_t capacity;      /**< Allocated capacity of the items array */
+  char *strings;        /**< Pool holding every target back to back */
+  size_t strings_len;   /**< Bytes used in the pool */
+  size_t strings_cap;   /**< Allocated size of the pool */
+  Arena *arena;         /**< Scratch arena all of the above live in */
+  FileStamp stamp;      /**< Stat fields and content hash of the file */
+  uint64_t line_count;  /**< Lines in the file */
+  bool cached;          /**< True if the imports came from the cache */
+};
+
+/**
+ * @brief Returns the NUL-terminated raw target of the i-th import.
+ */
+static inline const char *import_target(const ImportList *list, size_t i) {
+  return list->strings + list->items[i].offset;
+}
+
+/**
+ * @brief Reads a Python file and extracts its raw imports without touching
+ * the graph. Safe to call concurrently on different lists.
+ * @param filepath The full path to the .py file (e.g., "src/app/main.py")
+ * @param base_dir The root directory being scanned (e.g., "src/")
+ * @param cache Import cache to serve unchanged files from, or NULL. It is
+ * only read, so workers may share it.
+ * @param out The list to fill. Must be zero-initialized except for
+ * out->arena, the scratch arena to allocate from.
+ * @return 0 on success, -1 on failure (out->status is set accordingly).
+ */
+int lex_python_file(const char *filepath, const char *base_dir,
+                    const ImportCache *cache, ImportList *out);
+
+/**
+ * @brief The first half of lex_python_file, for callers that read files
+ * themselves (see ioread.h): records the stat fields of a file and serves it
+ * from the cache if they match. The list's module must already be set with
+ * import_list_set_module.
+ * @param filepath The full path to the .py file.
+ * @param base_dir The root directory being scanned.
+ * @param cache Import cache, or NULL.
+ * @param st The file's stat fields.
+ * @param out The list to fill.
+ * @return 1 if the list is complete without the contents (a cache hit or an
+ * empty file), 0 if lex_python_contents must follow, -1 on failure.
+ */
+int lex_python_stat(const char *filepath, const char *base_dir,
+                    const ImportCache *cache, const struct stat *st,
+                    ImportList *out);
+
+/**
+ * @brief The second half of lex_python_file: extracts the imports from the
+ * whole contents of a file prepared by lex_python_stat, or reuses the cached
+ * ones if the contents did not change.
+ * @return 0 on success, -1 on failure (out->status is set accordingly).
+ */
+int lex_python_contents(const char *filepath, const char *base_dir,
+                        const ImportCache *cache, const char *source,
+                        size_t size, ImportList *out);
+
+/**
+ * @brief Extracts the raw imports from an in-memory Python source buffer.
+ * The buffer is scanned in place and does not need to be NUL-terminated.
+ * @param source Pointer to the first byte of the source.
+ * @param size Number of bytes in the buffer.
+ * @param out The list to append to (out->arena must be set).
+ * @return 0 on success, -1 on memory allocation failure.
+ */
+int lex_python_buffer(const char *source, size_t size, ImportList *out);
+
+/**
+ * @brief Resolves the raw imports of a lexed file and adds the corresponding
+ * nodes and edges to the graph. Must not be called concurrently.
+ * @param list The list produced by lex_python_file.
+ * @param g Pointer to the Graph.
+ * @param map Pointer to the Hashmap.
+ * @return The integer ID of the file's module node, or -1 on failure.
+ */
+int merge_import_list(const ImportList *list, Graph *g, Hashmap *map);
+
+/**
+ * @struct NodeList
+ * @brief A growable set of node IDs, in the order they were added.
+ */
+struct NodeList {
+  int *ids;        /**< Dynamic array of node IDs */
+  size_t count;    /**< Number of IDs stored */
+  size_t capacity; /**< Allocated capacity of the ids array */
+};
+
+/**
+ * @brief Adds a node ID to the list unless it is already in it.
+ * @param list Pointer to the NodeList (zero-initialized before first use).
+ * @return 0 on success, -1 on memory allocation failure.
+ */
+int node_list_add(NodeList *list, int id);
+
+/**
+ * @brief Frees the IDs of a NodeList and resets it to empty.
+ */
+void node_list_free(NodeList *list);
+
+/**
+ * @brief merge_import_list for a graph that has been frozen before (watch
+ * mode, the query daemon, git history). Imports are resolved against the
+ * modules that have a file at the time, so when this file gives its module a
+ * file for the first time, the modules that imported a name below it were
+ * tied to a shorter prefix (or to a module-less node) instead. Those modules
+ * are added to stale, and the caller merges their files again.
+ * @param list The list produced by lex_python_file.
+ * @param g Pointer to the Graph.
+ * @param map Pointer to the Hashmap.
+ * @param stale Receives the modules to merge again.
+ * @return The integer ID of the file's module node, or -1 on failure.
+ */
+int merge_import_update(const ImportList *list, Graph *g, Hashmap *map,
+                        NodeList *stale);
+
+/**
+ * @brief Sets the module name, relative file path and package flag of a list
+ * from a file path, as lex_python_file does, without reading the file.
+ * @param list The list to fill (list->arena must be set).
+ * @param filepath The path of the .py file (e.g., "src/app/main.py")
+ * @param base_dir The root directory the module name is relative to.
+ * @return 0 on success, -1 on memory allocation failure.
+ */
+int import_list_set_module(ImportList *list, const char *filepath,
+                           const char *base_dir);
+
+/**
+ * @brief Appends one raw import target to the list.
+ * @param list The list to append to (list->arena must be set).
+ * @param target The raw target (not necessarily NUL-terminated).
+ * @param length Length of target in bytes.
+ * @param line_number The line number where the import occurs.
+ * @return 0 on success, -1 on memory allocation failure.
+ */
+int import_list_append(ImportList *list, const char *target, size_t length,
+                       int line_number);
+
+/**
+ * @brief Clears an ImportList, keeping its arena. The memory itself is
+ * reclaimed when the arena is reset or released.
+ * @param list Pointer to the list.
+ */
+void import_list_free(ImportList *list);
 
 /**
  * @brief Reads a Python file, extracts its imports, and updates the graph.
@@ -14,9 +210,11 @@ extern "C" {
  * @param base_dir The root directory being scanned (e.g., "src/")
  * @param g Pointer to the Graph.
  * @param map Pointer to the Hashmap.
+ * @param cache Import cache to read from and record into, or NULL.
  * @return 0 on success, -1 on failure.
  */
-int process_python_file(const char *filepath, const char *base_dir, Graph *g, Hashmap *map);
+int process_python_file(const char *filepath, const char *base_dir, Graph *g,
+                        Hashmap *map, ImportCache *cache);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,67 @@
+#ifndef PYCYCLE_ORIGIN_H
+#define PYCYCLE_ORIGIN_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @enum ImportOrigin
+ * @brief Where the module named by an absolute import comes from, judged by
+ * its first dotted segment.
+ */
+typedef enum {
+  ORIGIN_FIRST_PARTY, /**< A top-level package or module of the project */
+  ORIGIN_STDLIB,      /**< The Python standard library */
+  ORIGIN_THIRD_PARTY, /**< Anything else: an installed distribution */
+} ImportOrigin;
+
+/**
+ * True (the default) to drop imports of stdlib and third-party modules
+ * before they become nodes; --all-imports turns it off. External modules
+ * cannot take part in a project cycle, so only the graph size changes.
+ */
+extern bool internal_only;
+
+/**
+ * @brief Tells whether a top-level name belongs to the standard library,
+ * with a lookup in a compile-time perfect hash table (generated from
+ * tools/stdlib_modules.txt into src/stdlib_table.c).
+ * @param name The name, which need not be NUL-terminated.
+ * @param len Its length in bytes.
+ */
+bool stdlib_module_is(const char *name, size_t len);
+
+/**
+ * @brief Registers a top-level first-party name ("app" for app/ or app.py).
+ * Must not be called concurrently.
+ * @return 0 on success, -1 on memory allocation failure.
+ */
+int origin_add_first_party(const char *name, size_t len);
+
+/**
+ * @brief Registers every directory and .py file directly inside a project
+ * root as a first-party name, so imports of packages the walk has not
+ * reached yet are kept.
+ * @param base_dir The project root.
+ * @return 0 on success, -1 if the directory cannot be read.
+ */
+int origin_scan_first_party(const char *base_dir);
+
+/**
+ * @brief Classifies an absolute import target. The project's own names win
+ * over stdlib names they shadow. Until some first-party name is known (e.g.
+ * no walk has run), only stdlib targets are classified as external.
+ * @param target A dotted module name without leading dots.
+ */
+ImportOrigin import_origin(const char *target);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PYCYCLE_ORIGIN_H */
@@ -0,0 +1,39 @@
+#ifndef PYCYCLE_POOL_H
+#define PYCYCLE_POOL_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief A unit of work executed by the pool.
+ * @param index The index of the task, in [0, task_count).
+ * @param worker_id The ID of the worker running the task, in [0, jobs).
+ * @param ctx The user context passed to pool_run.
+ */
+typedef void (*PoolTaskFn)(size_t index, int worker_id, void *ctx);
+
+/**
+ * @brief Returns the number of online CPU cores (at least 1).
+ */
+int pool_default_jobs(void);
+
+/**
+ * @brief Runs task_count tasks across a pool of worker threads and waits for
+ * all of them to finish. Tasks are handed out dynamically, so uneven file
+ * sizes do not leave workers idle.
+ * @param task_count The number of tasks to run.
+ * @param jobs The number of worker threads (<= 1 runs inline on the caller).
+ * @param fn The task function.
+ * @param ctx User context forwarded to every task.
+ * @return 0 on success, -1 if the threads could not be started.
+ */
+int pool_run(size_t task_count, int jobs, PoolTaskFn fn, void *ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PYCYCLE_POOL_H */
@@ -0,0 +1,67 @@
+#ifndef PYCYCLE_PREFILTER_H
+#define PYCYCLE_PREFILTER_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct TokenMasks TokenMasks;
+
+/**
+ * @enum PrefilterImpl
+ * @brief The scanner implementations that can be selected at runtime.
+ */
+typedef enum {
+  PREFILTER_AUTO = 0, /**< Best implementation the CPU supports */
+  PREFILTER_SCALAR,   /**< Portable byte-at-a-time bitmask builder */
+  PREFILTER_SSE2,     /**< 4 x 16-byte compares per 64-byte block */
+  PREFILTER_AVX2      /**< 2 x 32-byte compares per 64-byte block */
+} PrefilterImpl;
+
+/**
+ * @brief Forces a specific implementation (used by benchmarks). Requests for
+ * an implementation the CPU lacks fall back to the best available one.
+ * @param impl The implementation to use, or PREFILTER_AUTO.
+ * @return The implementation that will actually be used.
+ */
+PrefilterImpl prefilter_select(PrefilterImpl impl);
+
+/**
+ * @brief Returns a short name for an implementation (e.g. "avx2").
+ */
+const char *prefilter_impl_name(PrefilterImpl impl);
+
+/**
+ * @struct TokenMasks
+ * @brief Classification of one 64-byte block for the Python tokenizer, one
+ * bit per byte.
+ */
+struct TokenMasks {
+  uint64_t newline; /**< '\n' */
+  uint64_t blank;   /**< ' ' or '\t' */
+  uint64_t keyword; /**< "im" or "fr", the first letters of import/from */
+  uint64_t special; /**< Quotes, '#' and '\\': bytes that change the state */
+  uint64_t open;    /**< '(', '[' or '{' */
+  uint64_t close;   /**< ')', ']' or '}' */
+  uint64_t sep;     /**< ':' or ';', after which a statement may start */
+};
+
+/**
+ * @brief Classifies block[0..63]. It may read block[64] to look at the byte
+ * after a keyword letter, so callers must guarantee it is readable.
+ */
+typedef void (*TokenClassifyFn)(const char *block, TokenMasks *masks);
+
+/**
+ * @brief Returns the token classifier of the implementation selected with
+ * prefilter_select (or the best one the CPU supports).
+ */
+TokenClassifyFn prefilter_token_classifier(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PYCYCLE_PREFILTER_H */
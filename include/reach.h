@@ -0,0 +1,90 @@
+#ifndef PYCYCLE_REACH_H
+#define PYCYCLE_REACH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "graph.h"
+#include <stdint.h>
+
+typedef struct ReachIndex ReachIndex;
+
+/**
+ * @enum ReachKind
+ * @brief How a ReachIndex stores the transitive closure.
+ */
+typedef enum {
+  REACH_AUTO = 0,  /**< Bitsets if they fit in REACH_BITSET_LIMIT, else
+                      intervals */
+  REACH_BITSET,    /**< One row of bits per component: O(1) queries */
+  REACH_INTERVALS, /**< Compressed interval labels: O(log k) queries */
+} ReachKind;
+
+/** Largest bitset matrix REACH_AUTO builds (components^2 / 8 bytes). */
+#define REACH_BITSET_LIMIT ((size_t)128 << 20)
+
+/**
+ * @struct ReachIndex
+ * @brief A precomputed "does A import B, directly or not" relation over the
+ * strongly connected components of a graph.
+ *
+ * Bitset rows are padded to whole 64-byte lines and filled in reverse
+ * topological order (imported components first), so each row is the OR of
+ * its successors' rows. Interval labels number the components in DFS
+ * post-order; a component's label is the union of its own DFS subtree range
+ * and its successors' labels, with adjacent ranges merged, and B is
+ * reachable from A if B's post-order number falls in one of A's ranges.
+ */
+struct ReachIndex {
+  ReachKind kind;    /**< REACH_BITSET or REACH_INTERVALS */
+  SccList *sccs;     /**< Components of the indexed graph */
+  uint8_t *cyclic;   /**< 1 if the component's members import each other
+                        (two or more members, or a self-import) */
+
+  uint64_t *bits;    /**< Bitset rows, count * words (REACH_BITSET) */
+  size_t words;      /**< 64-bit words per row */
+
+  uint32_t *post;        /**< Post-order number of each component */
+  size_t *label_offsets; /**< Component c's ranges are labels[2 *
+                            label_offsets[c] .. 2 * label_offsets[c + 1]) */
+  uint32_t *labels;      /**< Sorted, disjoint [first, last] pairs */
+
+  size_t memory;     /**< Bytes held by the index, components included */
+  uint64_t build_ns; /**< Time taken by reach_index_build */
+};
+
+/**
+ * @brief Builds the reachability index of a graph. Freezes the graph first
+ * if needed. The index does not follow later changes to the graph.
+ * @param g Pointer to the Graph.
+ * @param kind The representation, or REACH_AUTO.
+ * @return The index, or NULL if memory fails. Free with reach_index_free.
+ */
+ReachIndex *reach_index_build(Graph *g, ReachKind kind);
+
+/**
+ * @brief Frees an index returned by reach_index_build.
+ */
+void reach_index_free(ReachIndex *idx);
+
+/**
+ * @brief Tells whether module from imports module to, directly or through
+ * other modules. A module depends on itself only if it is part of a cycle.
+ * @param idx The index.
+ * @param from Node ID of the importing module.
+ * @param to Node ID of the imported module.
+ * @return true if there is a non-empty import path from -> to.
+ */
+bool reach_index_depends(const ReachIndex *idx, int from, int to);
+
+/**
+ * @brief Returns "bitset" or "intervals".
+ */
+const char *reach_kind_name(ReachKind kind);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PYCYCLE_REACH_H */
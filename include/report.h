@@ -0,0 +1,85 @@
+#ifndef PYCYCLE_REPORT_H
+#define PYCYCLE_REPORT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "graph.h"
+#include <stdio.h>
+
+/**
+ * @enum ReportFormat
+ * @brief How circular dependencies are written to stdout.
+ */
+typedef enum {
+  REPORT_TEXT = 0, /**< The human-readable trace (colored on a terminal) */
+  REPORT_JSON,     /**< One JSON document with a cycles array */
+  REPORT_SARIF,    /**< A SARIF 2.1.0 log with one result per cycle */
+} ReportFormat;
+
+/** The format selected with --format. */
+extern ReportFormat report_format;
+
+/**
+ * @brief Parses a --format argument ("text", "json" or "sarif").
+ * @return 0 on success, -1 if the argument is not recognized.
+ */
+int report_format_parse(const char *arg, ReportFormat *format);
+
+/**
+ * @brief The stream for progress and summary lines: stdout for text reports,
+ * stderr otherwise so that stdout holds nothing but the document.
+ */
+static inline FILE *report_info(void) {
+  return report_format == REPORT_TEXT ? stdout : stderr;
+}
+
+/**
+ * @brief Opens the JSON or SARIF document. Does nothing for text reports.
+ * @param g The analysed graph.
+ * @param target The analysed directory, revision or snapshot.
+ */
+void report_begin(const Graph *g, const char *target);
+
+/**
+ * @brief Writes one import loop as soon as it is found: every hop with the
+ * importing module's file and the line of the import.
+ * @param g Pointer to the frozen Graph.
+ * @param loop The nodes of the loop; the last one imports loop[0].
+ * @param length Number of nodes in loop.
+ * @param component_size Modules in the strongly connected component that
+ * contains the loop.
+ */
+void report_cycle(const Graph *g, const int *loop, int length,
+                  size_t component_size);
+
+/**
+ * @brief Writes every import between members of component c. Text reports
+ * only; structured reports carry the loop alone.
+ */
+void report_component_imports(const Graph *g, const SccList *sccs, size_t c);
+
+/**
+ * @brief Records that cycle enumeration stopped early.
+ * @param reported Number of cycles written.
+ * @param reason Why enumeration stopped.
+ */
+void report_truncated(size_t reported, const char *reason);
+
+/**
+ * @brief Closes the JSON or SARIF document and flushes stdout.
+ */
+void report_end(void);
+
+/**
+ * @brief Writes everything buffered so far to stdout. Call before printing to
+ * stdout by other means.
+ */
+void report_flush(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PYCYCLE_REPORT_H */
@@ -0,0 +1,72 @@
+#ifndef PYCYCLE_RESOLVE_H
+#define PYCYCLE_RESOLVE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "graph.h"
+#include "hashmap.h"
+
+typedef struct ModuleTrie ModuleTrie;
+
+/**
+ * @struct ModuleTrie
+ * @brief A prefix tree over the dotted names of the modules that have a
+ * file. Segments are interned once, so a child is found by a hash of
+ * (parent, segment ID) and "app.models.User" is resolved in one descent that
+ * remembers the deepest module passed ("app.models").
+ */
+struct ModuleTrie {
+  int *module;         /**< Node ID of the module ending at each trie node,
+                          or -1; trie node 0 is the root */
+  size_t count;        /**< Trie nodes in use */
+  uint64_t *child_key; /**< Open-addressing table of (parent << 32 | segment)
+                          keys, UINT64_MAX when empty */
+  int *child;          /**< Trie node reached by each key */
+  size_t child_mask;   /**< Table size - 1 (a power of two) */
+  Arena segments;      /**< Interned segment strings and their registry */
+  Hashmap *segment_ids;
+};
+
+/**
+ * @brief Builds the trie of every node that has a defining file.
+ * @param g Pointer to the Graph.
+ * @return The trie, or NULL if memory fails. Free with module_trie_free.
+ */
+ModuleTrie *module_trie_build(const Graph *g);
+
+/**
+ * @brief Frees a trie returned by module_trie_build.
+ */
+void module_trie_free(ModuleTrie *trie);
+
+/**
+ * @brief Finds the module with the longest dotted prefix of name (name
+ * itself included).
+ * @param trie The trie.
+ * @param name A dotted name, e.g. "app.models.User".
+ * @return The node ID of that module, or -1 if no prefix has a file.
+ */
+int module_trie_longest(const ModuleTrie *trie, const char *name);
+
+/**
+ * @brief The resolution stage that runs after the walk, before the first
+ * graph_freeze. "from app.models import User" records an import of
+ * "app.models.User"; every such node that no file defines is folded into the
+ * module with its longest defined prefix. Its imports are redirected there
+ * (an import of a module's own name is dropped), the folded nodes are
+ * removed, the rest are renumbered in order and the registry is rebuilt.
+ * Names with no defined prefix (namespace packages, missing modules) stay.
+ * @param g Pointer to a Graph that has not been frozen yet.
+ * @param map Pointer to the Hashmap of g.
+ * @return The number of nodes folded, or -1 on failure (a frozen graph or a
+ * memory allocation failure).
+ */
+long graph_resolve_modules(Graph *g, Hashmap *map);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PYCYCLE_RESOLVE_H */
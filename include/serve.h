@@ -0,0 +1,77 @@
+#ifndef PYCYCLE_SERVE_H
+#define PYCYCLE_SERVE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "graph.h"
+#include "hashmap.h"
+
+/** Longest request line the server accepts. */
+#define SERVE_MAX_LINE (64 * 1024)
+
+/** Most clients connected at once; later ones wait in the listen backlog. */
+#define SERVE_MAX_CLIENTS 64
+
+/**
+ * @brief Keeps an already built graph and its registry resident and answers
+ * requests on a Unix domain socket until SIGINT, SIGTERM or a shutdown
+ * request.
+ *
+ * The protocol is line based. A request is one line of space-separated
+ * words; the response is either "ok N" followed by N result lines, or one
+ * "error <message>" line. Requests:
+ *
+ *   cycles [MODULE]        A shortest import loop through MODULE, one
+ *                          "from<TAB>to<TAB>line" hop per line; without
+ *                          MODULE, every cycle as one line of members
+ *   dependencies MODULE [direct]
+ *                          Modules MODULE imports, transitively by default
+ *   dependents MODULE [direct]
+ *                          Modules that import MODULE
+ *   path A B               A shortest import path from A to B, as hops
+ *   depends A B            "yes" or "no", from a reachability index
+ *   update FILE...         Lexes the files again (relative to the served
+ *                          directory or absolute) and replaces their imports;
+ *                          a deleted file loses them, and a file that cannot
+ *                          be read is an error
+ *   stats                  "modules N imports E cycles C"
+ *   shutdown               Stops the server
+ *
+ * Components, the reverse graph and the reachability index are built on
+ * first use and dropped when an update changes the graph. Several clients
+ * may stay connected; requests are answered one at a time.
+ *
+ * @param socket_path Where to create the socket. A stale socket file (no
+ * server answering) is replaced.
+ * @param base_dir The root directory the graph was built from.
+ * @param g Pointer to the frozen Graph.
+ * @param map Pointer to the Hashmap of g.
+ * @return 0 when stopped, -1 if the socket could not be set up.
+ */
+int serve_graph(const char *socket_path, const char *base_dir, Graph *g,
+                Hashmap *map);
+
+/**
+ * @brief Sends requests to a running server and prints the result lines on
+ * stdout. With a request, sends it and exits; without one, sends every line
+ * read from stdin.
+ * @param socket_path The server's socket.
+ * @param request One request line, or NULL to read requests from stdin.
+ * @return 0 if every request succeeded, 1 if the server reported an error,
+ * 2 if the server could not be reached.
+ */
+int serve_client(const char *socket_path, const char *request);
+
+/**
+ * @brief Connects to a server's socket.
+ * @return The connected descriptor, or -1 (with errno set).
+ */
+int serve_connect(const char *socket_path);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PYCYCLE_SERVE_H */
@@ -0,0 +1,78 @@
+#ifndef PYCYCLE_SNAPSHOT_H
+#define PYCYCLE_SNAPSHOT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "graph.h"
+#include "hashmap.h"
+#include <stdint.h>
+
+typedef struct SnapshotHeader SnapshotHeader;
+
+#define SNAPSHOT_MAGIC "PYCYSNAP"
+#define SNAPSHOT_VERSION 3
+
+/**
+ * @struct SnapshotHeader
+ * @brief The start of a graph snapshot. All integers are little-endian and
+ * every section starts on an 8-byte boundary:
+ *
+ *   name offsets  uint64[node_count + 1], into the string table
+ *   path offsets  uint64[node_count], into the string table, or
+ *                 UINT64_MAX for modules with no file (Node::path)
+ *   strings       every module name, then every file path, NUL-terminated,
+ *                 back to back
+ *   edge offsets  uint64[node_count + 1] (Graph::edge_offsets)
+ *   targets       int32[edge_count]      (Graph::edge_targets)
+ *   lines         int32[edge_count]      (Graph::edge_lines)
+ *   weights       uint64[2 * node_count] (Node::source_bytes and
+ *                                         Node::source_lines, per node)
+ *
+ * so a loaded graph uses the mapped sections in place.
+ */
+struct SnapshotHeader {
+  char magic[8];             /**< SNAPSHOT_MAGIC, not NUL-terminated */
+  uint32_t version;          /**< SNAPSHOT_VERSION */
+  uint32_t reserved;         /**< Zero */
+  uint64_t node_count;       /**< Number of modules */
+  uint64_t edge_count;       /**< Number of CSR edges */
+  uint64_t file_size;        /**< Total size, to detect truncated files */
+  uint64_t name_offsets_pos; /**< File offset of each section */
+  uint64_t path_offsets_pos;
+  uint64_t strings_pos;
+  uint64_t strings_size;
+  uint64_t edge_offsets_pos;
+  uint64_t targets_pos;
+  uint64_t lines_pos;
+  uint64_t weights_pos;
+};
+
+/**
+ * @brief Writes a frozen graph to a snapshot file. The file is written under
+ * a temporary name and renamed into place.
+ * @param g Pointer to the Graph. It is frozen if needed.
+ * @param path The file to write.
+ * @return 0 on success, -1 on failure.
+ */
+int graph_save_snapshot(Graph *g, const char *path);
+
+/**
+ * @brief Loads a snapshot with a single mmap. Names, paths and CSR arrays are
+ * used in place; the only allocations are the Graph, its node array and the
+ * registry table. The graph stays usable for updates: the CSR arrays are
+ * copied to the heap the first time they change.
+ * @param path The snapshot file.
+ * @param map_out Receives the registry of the loaded graph (it lives in the
+ * graph's arena).
+ * @return The frozen Graph, or NULL if the file is missing, truncated, of
+ * another version or inconsistent.
+ */
+Graph *graph_load_snapshot(const char *path, Hashmap **map_out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PYCYCLE_SNAPSHOT_H */
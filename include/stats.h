@@ -0,0 +1,92 @@
+#ifndef PYCYCLE_STATS_H
+#define PYCYCLE_STATS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "graph.h"
+#include "hashmap.h"
+#include <stdint.h>
+#include <stdio.h>
+
+/**
+ * @enum StatsPhase
+ * @brief The timed phases of a run. Lexing happens inside the walk (and, with
+ * --jobs, on several threads at once), so its time is a sum over files.
+ */
+typedef enum {
+  STATS_WALK,   /**< walk_directory / walk_directory_parallel, end to end */
+  STATS_LEX,    /**< lex_python_file, summed over every file */
+  STATS_GRAPH,  /**< merge_import_list (graph_add_edge) and graph_freeze */
+  STATS_CYCLES, /**< graph_find_cycles / graph_enumerate_cycles */
+  STATS_EXPORT, /**< graph_export_dot */
+  STATS_COST,   /**< graph_report_import_cost */
+  STATS_PHASE_COUNT
+} StatsPhase;
+
+/**
+ * @enum StatsCounter
+ * @brief Work counters, updated from any thread.
+ */
+typedef enum {
+  STATS_FILES,    /**< .py files lexed or served from the cache */
+  STATS_EXCLUDED, /**< Directory entries skipped by exclude rules */
+  STATS_BYTES,    /**< Bytes of source read */
+  STATS_LINES,    /**< Lines scanned by the tokenizer */
+  STATS_IMPORTS,  /**< Raw import targets found */
+  STATS_EXTERNAL, /**< Stdlib and third-party imports dropped at merge */
+  STATS_FOLDED,   /**< Imported-symbol nodes folded into their module */
+  STATS_COUNTER_COUNT
+} StatsCounter;
+
+/** True while --stats is on; everything below is a no-op otherwise. */
+extern bool stats_enabled;
+extern uint64_t stats_phase_ns[STATS_PHASE_COUNT];
+extern uint64_t stats_counters[STATS_COUNTER_COUNT];
+
+/**
+ * @brief Reads the monotonic clock in nanoseconds.
+ */
+uint64_t stats_clock_ns(void);
+
+/**
+ * @brief Starts timing a phase.
+ * @return The start time, or 0 when stats are off (no clock read).
+ */
+static inline uint64_t stats_start(void) {
+  return stats_enabled ? stats_clock_ns() : 0;
+}
+
+/**
+ * @brief Adds the time since start to a phase. Safe from worker threads.
+ */
+static inline void stats_stop(StatsPhase phase, uint64_t start) {
+  if (stats_enabled)
+    __atomic_fetch_add(&stats_phase_ns[phase], stats_clock_ns() - start,
+                       __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief Adds n to a counter. Safe from worker threads.
+ */
+static inline void stats_count(StatsCounter counter, uint64_t n) {
+  if (stats_enabled)
+    __atomic_fetch_add(&stats_counters[counter], n, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief Prints every phase time, counter, throughput, graph and registry
+ * metric and the peak RSS of the process.
+ * @param out The stream to print to.
+ * @param g The analysed graph (may be NULL).
+ * @param map Its registry (may be NULL).
+ * @param json True for a single JSON object, false for a table.
+ */
+void stats_report(FILE *out, const Graph *g, const Hashmap *map, bool json);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PYCYCLE_STATS_H */
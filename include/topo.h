@@ -0,0 +1,127 @@
+#ifndef PYCYCLE_TOPO_H
+#define PYCYCLE_TOPO_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "graph.h"
+#include <stdint.h>
+
+typedef struct TopoOrder TopoOrder;
+typedef struct TopoAdjacency TopoAdjacency;
+typedef struct TopoCycle TopoCycle;
+
+/**
+ * @struct TopoAdjacency
+ * @brief A growable list of neighbour IDs.
+ */
+struct TopoAdjacency {
+  int *items;      /**< Neighbour node IDs */
+  size_t count;    /**< Number of neighbours */
+  size_t capacity; /**< Allocated capacity of items */
+};
+
+/**
+ * @struct TopoCycle
+ * @brief The loop an edge insertion would have closed: nodes[0] is the
+ * importer of the rejected edge, nodes[1] the imported module, and the
+ * existing imports lead from there back to nodes[0].
+ */
+struct TopoCycle {
+  const int *nodes; /**< Points into the TopoOrder; valid until its next call */
+  size_t count;     /**< Number of modules in the loop */
+};
+
+/**
+ * @struct TopoOrder
+ * @brief A topological order of an acyclic import graph that is maintained
+ * while edges are inserted, with the Pearce-Kelly algorithm: an insertion
+ * x -> y that already agrees with the order costs O(1); otherwise only the
+ * nodes whose position lies between y and x are searched and reordered.
+ * Edges that would close a loop are rejected.
+ *
+ * The order keeps its own adjacency lists in both directions, so it can be
+ * updated without freezing a Graph.
+ */
+struct TopoOrder {
+  size_t node_count;  /**< Number of nodes in the order */
+  size_t capacity;    /**< Allocated capacity of the per-node arrays */
+  size_t edge_count;  /**< Number of distinct edges inserted */
+  int *ord;           /**< Position of every node in the order */
+  int *node_at;       /**< Node at every position (inverse of ord) */
+  TopoAdjacency *out; /**< Imports of every node */
+  TopoAdjacency *in;  /**< Importers of every node */
+
+  uint32_t *mark;     /**< Visit stamps, compared against epoch */
+  uint32_t epoch;     /**< Stamp of the current search */
+  int *parent;        /**< DFS tree of the forward search */
+  int *stack;         /**< Explicit DFS stack */
+  int *delta_f;       /**< Positions reached by the forward search */
+  int *delta_b;       /**< Positions reached by the backward search */
+  int *merged;        /**< Reordering scratch */
+  int *cycle;         /**< Storage of the last reported cycle */
+};
+
+/**
+ * @brief Allocates an empty order.
+ * @param initial_capacity Expected number of nodes.
+ * @return Pointer to the order, or NULL if memory fails.
+ */
+TopoOrder *topo_create(size_t initial_capacity);
+
+/**
+ * @brief Builds the order of every edge of a graph. Edges that go between
+ * strongly connected components are added directly in the order of the
+ * components; only edges inside cyclic components go through topo_add_edge,
+ * and those that would close a loop are left out.
+ * @param g Pointer to the Graph. It is frozen if needed.
+ * @param rejected If not NULL, receives the number of edges left out.
+ * @return Pointer to the order, or NULL if memory fails.
+ */
+TopoOrder *topo_from_graph(Graph *g, size_t *rejected);
+
+/**
+ * @brief Frees an order and everything it owns.
+ * @param t Pointer to the order (may be NULL).
+ */
+void topo_free(TopoOrder *t);
+
+/**
+ * @brief Makes sure nodes [0, node_count) exist. New nodes have no edges
+ * and are placed at the end of the order.
+ * @return 0 on success, -1 on memory allocation failure.
+ */
+int topo_ensure_nodes(TopoOrder *t, size_t node_count);
+
+/**
+ * @brief Inserts the edge from -> to unless it would close a loop.
+ * @param t Pointer to the order.
+ * @param from The importer.
+ * @param to The imported module.
+ * @param cycle If not NULL, receives the loop when the edge is rejected.
+ * @return 0 if the edge was inserted (or already present, or a self import),
+ * 1 if it was rejected because it closes a loop, -1 on failure.
+ */
+int topo_add_edge(TopoOrder *t, int from, int to, TopoCycle *cycle);
+
+/**
+ * @brief graph_add_edge for callers that must keep the graph acyclic (a
+ * pre-commit hook, an editor plugin): the import is checked against the
+ * order first and only added to the graph if it closes no loop.
+ * @param g Pointer to the Graph.
+ * @param t The order of g's edges (see topo_from_graph).
+ * @param from_id The importer.
+ * @param to_id The imported module.
+ * @param line_number The line number of the import.
+ * @param cycle If not NULL, receives the loop when the import is rejected.
+ * @return 0 if added, 1 if rejected because it closes a loop, -1 on failure.
+ */
+int graph_add_edge_acyclic(Graph *g, TopoOrder *t, int from_id, int to_id,
+                           int line_number, TopoCycle *cycle);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PYCYCLE_TOPO_H */
@@ -7,6 +7,22 @@ extern "C" {
 
 #include "graph.h"
 #include "hashmap.h"
+#include "ioread.h"
+#include "lexer.h"
+
+typedef struct FileList FileList;
+
+/**
+ * @struct FileList
+ * @brief An ordered list of .py file paths, in the order the serial walk
+ * would visit them.
+ */
+struct FileList {
+  char **paths;    /**< Dynamic array of file paths */
+  size_t count;    /**< Number of paths stored */
+  size_t capacity; /**< Allocated capacity of the paths array */
+  Arena strings;   /**< Arena holding the path strings themselves */
+};
 
 /**
  * @brief Recursively walks a directory, finding all .py files and passing them to the Lexer.
@@ -14,9 +30,71 @@ extern "C" {
  * @param base_dir The root directory of the project.
  * @param g Pointer to the Graph.
  * @param map Pointer to the Hashmap.
+ * @param cache Import cache to read from and record into, or NULL.
+ * @return 0 on success, -1 on failure.
+ */
+int walk_directory(const char *directory, const char *base_dir, Graph *g,
+                   Hashmap *map, ImportCache *cache);
+
+/**
+ * @brief Recursively collects all .py files below a directory without lexing
+ * them.
+ * @param directory The directory to scan.
+ * @param out The list to append to. Must be zero-initialized.
+ * @return 0 on success, -1 on failure.
+ */
+int collect_python_files(const char *directory, FileList *out);
+
+/**
+ * @brief Appends a copy of a path to the list. The copy lives in the list's
+ * string arena, which is set up on first use.
+ * @param list Pointer to the FileList (zero-initialized before first use).
+ * @param path The path to copy.
+ * @return 0 on success, -1 on memory allocation failure.
+ */
+int file_list_push(FileList *list, const char *path);
+
+/**
+ * @brief Releases the path arena and the list storage itself.
+ * @param list Pointer to the FileList.
+ */
+void file_list_free(FileList *list);
+
+/**
+ * @brief Parallel variant of walk_directory. Files are lexed by a pool of
+ * worker threads, each producing its own import lists, which are then merged
+ * into the graph in walk order so the result is identical to the serial run.
+ * @param directory The root directory to scan.
+ * @param base_dir The root directory of the project.
+ * @param g Pointer to the Graph.
+ * @param map Pointer to the Hashmap.
+ * @param cache Import cache to read from and record into, or NULL. Workers
+ * only read it; entries are recorded during the serial merge.
+ * @param jobs Number of worker threads.
+ * @return 0 on success, -1 on failure.
+ */
+int walk_directory_parallel(const char *directory, const char *base_dir,
+                            Graph *g, Hashmap *map, ImportCache *cache,
+                            int jobs);
+
+/**
+ * @brief Batched variant of walk_directory. The file list is collected first,
+ * then read_files reads it with the chosen backend and every file is lexed on
+ * the calling thread as soon as its contents arrive. Files already valid in
+ * the cache are opened but never read. The import lists are merged in walk
+ * order, so the result is identical to the serial run.
+ * @param directory The root directory to scan.
+ * @param base_dir The root directory of the project.
+ * @param g Pointer to the Graph.
+ * @param map Pointer to the Hashmap.
+ * @param cache Import cache to read from and record into, or NULL.
+ * @param backend IO_PREAD or IO_URING.
+ * @param depth Files in flight for IO_URING.
  * @return 0 on success, -1 on failure.
  */
-int walk_directory(const char *directory, const char *base_dir, Graph *g, Hashmap *map);
+int walk_directory_batched(const char *directory, const char *base_dir,
+                           Graph *g, Hashmap *map, ImportCache *cache,
+                           IoBackend backend, size_t depth);
 
 #ifdef __cplusplus
 }
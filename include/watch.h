@@ -0,0 +1,36 @@
+#ifndef PYCYCLE_WATCH_H
+#define PYCYCLE_WATCH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "graph.h"
+#include "hashmap.h"
+
+/**
+ * @brief Keeps an already built graph resident and re-analyses it whenever a
+ * .py file below directory is written, moved or deleted, until SIGINT or
+ * SIGTERM.
+ *
+ * Only the touched files are lexed again. Their outgoing edges are replaced
+ * in place (graph_replace_edges) and only the components they belong to are
+ * re-checked: an edited module whose imports still point "down" the
+ * topological order of the components cannot close a new loop, and its own
+ * component survives if the module still reaches every other member. Any
+ * other change recomputes the components.
+ *
+ * @param directory The directory to watch (the one that was scanned).
+ * @param base_dir The root directory of the project.
+ * @param g Pointer to the frozen Graph built from directory.
+ * @param map Pointer to the Hashmap of g.
+ * @return 0 when stopped by a signal, -1 if inotify could not be set up.
+ */
+int watch_directory(const char *directory, const char *base_dir, Graph *g,
+                    Hashmap *map);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PYCYCLE_WATCH_H */
@@ -0,0 +1,101 @@
+#ifndef PYCYCLE_WRITER_H
+#define PYCYCLE_WRITER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+typedef struct Writer Writer;
+
+/**
+ * @struct Writer
+ * @brief An output buffer that is handed to the underlying stream in large
+ * blocks. Strings, padding, integers and JSON escapes are formatted directly
+ * into the buffer, without going through printf.
+ */
+struct Writer {
+  char *buf;       /**< The buffer, capacity bytes */
+  size_t len;      /**< Bytes waiting to be written */
+  size_t capacity; /**< Size of buf */
+  FILE *out;       /**< Where the buffer is flushed to, or NULL to keep
+                      everything in a growing buffer (an output queue that
+                      its owner sends and empties) */
+  bool failed;     /**< Set once a write to out fails; later output is dropped */
+};
+
+/**
+ * @brief Initializes a writer with a buffer of the given size.
+ * @param out The stream to write to, or NULL for an output queue.
+ * @return 0 on success, -1 on memory allocation failure.
+ */
+int writer_init(Writer *w, FILE *out, size_t capacity);
+
+/**
+ * @brief Writes everything buffered to the stream and flushes the stream.
+ */
+void writer_flush(Writer *w);
+
+/**
+ * @brief Flushes the writer and frees its buffer.
+ */
+void writer_free(Writer *w);
+
+/**
+ * @brief Appends len raw bytes.
+ */
+void writer_bytes(Writer *w, const char *s, size_t len);
+
+/**
+ * @brief Appends a NUL-terminated string.
+ */
+void writer_str(Writer *w, const char *s);
+
+/**
+ * @brief Appends s, padded with spaces on the right to at least width bytes
+ * (like printf's "%-*s").
+ */
+void writer_pad(Writer *w, const char *s, size_t width);
+
+/**
+ * @brief Appends the decimal form of an unsigned integer.
+ */
+void writer_uint(Writer *w, uint64_t v);
+
+/**
+ * @brief Appends the decimal form of a signed integer.
+ */
+void writer_int(Writer *w, int64_t v);
+
+/**
+ * @brief Appends s escaped for use inside a JSON string, without the quotes.
+ * Quotes, backslashes and control characters are escaped; well-formed
+ * UTF-8 sequences are copied as they are, and every byte that is not part of
+ * one is replaced by U+FFFD, so the output is always valid JSON.
+ */
+void writer_json_escape(Writer *w, const char *s);
+
+/**
+ * @brief Appends s as a quoted JSON string, or null if s is NULL.
+ */
+void writer_json_string(Writer *w, const char *s);
+
+/**
+ * @brief Appends a single byte.
+ */
+static inline void writer_char(Writer *w, char c) {
+  if (w->len == w->capacity)
+    writer_bytes(w, &c, 1);
+  else
+    w->buf[w->len++] = c;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PYCYCLE_WRITER_H */
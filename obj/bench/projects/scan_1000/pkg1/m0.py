@@ -0,0 +1,43 @@
+"""Module 0."""
+
+
+def helper_0_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_0_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_0_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_0_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_0_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_0_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,101 @@
+"""Module 126."""
+from . import m0
+from pkg2.pkg10 import m93
+
+
+def helper_126_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_126_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_126_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_126_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_126_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_126_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_126_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_126_42(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_126_48(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_126_54(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_126_60(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_126_66(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_126_72(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_126_78(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,71 @@
+"""Module 168."""
+from . import m126
+from pkg2.pkg9.pkg37 import m120
+import pkg2.pkg9.pkg39.m164
+from pkg2.pkg12 import m11
+import pkg1.pkg5.pkg24.m149
+from pkg1.pkg5 import m4
+from . import m0
+
+
+def helper_168_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_168_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_168_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_168_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_168_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_168_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_168_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_168_42(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_168_48(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 210."""
+import pkg1.pkg5.pkg21.m20
+from pkg2.pkg10.pkg42 import m209
+from . import m0
+
+
+def helper_210_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_210_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_210_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
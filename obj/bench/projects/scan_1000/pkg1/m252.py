@@ -0,0 +1,84 @@
+"""Module 252."""
+import pkg3.pkg15.m14
+from pkg2 import m43
+from . import m168
+from pkg2 import m127
+import pkg1.pkg8.pkg33.m32
+from . import m210
+
+
+def helper_252_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_252_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_252_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_252_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_252_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_252_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_252_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_252_42(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_252_48(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_252_54(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_252_60(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
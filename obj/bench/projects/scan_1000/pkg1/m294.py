@@ -0,0 +1,70 @@
+"""Module 294."""
+import pkg4.pkg17.m184
+from pkg1.pkg8.pkg33 import m74
+from . import m252
+from pkg3.pkg14 import m181
+from . import m84
+from . import m0
+
+
+def helper_294_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_294_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_294_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_294_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_294_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_294_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_294_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_294_42(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_294_48(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
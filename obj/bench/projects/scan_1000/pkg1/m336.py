@@ -0,0 +1,20 @@
+"""Module 336."""
+from . import m0
+from . import m294
+import pkg1.pkg5.pkg22.m189
+from . import m126
+import pkg1.pkg7.pkg32.m283
+
+
+def helper_336_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_336_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,22 @@
+"""Module 546."""
+import pkg1.pkg7.m48
+from pkg3.pkg15 import m14
+from . import m252
+from . import m168
+import pkg2.pkg10.m387
+from pkg1.pkg6.pkg26 import m67
+import pkg4.m3
+
+
+def helper_546_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_546_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
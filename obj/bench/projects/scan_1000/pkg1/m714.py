@@ -0,0 +1,18 @@
+"""Module 714."""
+import pkg2.pkg12.m11
+from pkg1.pkg7.pkg30 import m29
+from . import m0
+from . import m420
+import pkg4.pkg17.m16
+from pkg1.pkg7 import m6
+import pkg2.pkg12.m515
+from . import m84
+import pkg2.pkg10.pkg42.m41
+from pkg1.pkg6 import m5
+
+
+def helper_714_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
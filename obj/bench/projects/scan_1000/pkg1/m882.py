@@ -0,0 +1,14 @@
+"""Module 882."""
+import pkg4.m3
+from pkg3.pkg15 import m14
+from . import m42
+from pkg2 import m1
+import pkg4.pkg18.m605
+from . import m294
+
+
+def helper_882_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
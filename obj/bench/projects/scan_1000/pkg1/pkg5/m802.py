@@ -0,0 +1,33 @@
+"""Module 802."""
+from . import m466
+from pkg1.pkg7.pkg29 import m154
+import pkg2.pkg12.m11
+from . import m760
+import pkg2.pkg9.pkg38.m289
+from pkg1.pkg8.pkg36 import m77
+from . import m382
+from pkg1 import m0
+import pkg2.pkg9.pkg38.m163
+from pkg1.pkg6.pkg27 import m68
+import pkg1.m546
+
+
+def helper_802_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_802_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_802_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
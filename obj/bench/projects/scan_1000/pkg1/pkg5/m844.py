@@ -0,0 +1,15 @@
+"""Module 844."""
+import pkg3.pkg14.m139
+from pkg1.pkg5.pkg24 import m191
+import pkg3.pkg15.m98
+from . import m508
+import pkg3.pkg14.m223
+from pkg1.pkg6.pkg28 import m237
+import pkg1.pkg5.pkg21.m20
+
+
+def helper_844_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
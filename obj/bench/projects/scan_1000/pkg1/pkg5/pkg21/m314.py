@@ -0,0 +1,55 @@
+"""Module 314."""
+import pkg2.pkg10.m135
+from pkg1.pkg6 import m5
+import pkg3.m2
+from pkg2.pkg9.pkg40 import m39
+import pkg2.pkg12.m137
+from . import m272
+import pkg1.pkg5.m4
+from pkg1.pkg5 import m46
+import pkg2.m127
+from . import m188
+import pkg1.pkg6.m257
+from pkg1.pkg6.pkg27 import m26
+
+
+def helper_314_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_314_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_314_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_314_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_314_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_314_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
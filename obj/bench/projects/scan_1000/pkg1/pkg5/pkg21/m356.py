@@ -0,0 +1,38 @@
+"""Module 356."""
+import pkg1.pkg5.m4
+from pkg1 import m0
+import pkg4.pkg18.m101
+from pkg1.pkg6.pkg27 import m26
+import pkg1.m84
+from pkg4.pkg19 import m270
+import pkg1.pkg5.pkg22.m189
+from pkg1.pkg7.pkg30 import m155
+import pkg4.pkg19.m186
+
+
+def helper_356_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_356_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_356_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_356_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
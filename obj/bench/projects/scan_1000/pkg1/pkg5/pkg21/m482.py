@@ -0,0 +1,26 @@
+"""Module 482."""
+import pkg4.pkg17.m100
+from pkg3.pkg13 import m12
+import pkg1.pkg5.pkg23.m64
+from pkg2.pkg9 import m50
+
+
+def helper_482_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_482_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_482_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,47 @@
+"""Module 860."""
+import pkg1.pkg5.pkg22.m63
+from pkg2.pkg9.pkg38 import m37
+import pkg1.pkg8.m133
+from pkg3 import m44
+import pkg4.pkg19.m18
+from pkg1.pkg6.pkg25 import m444
+import pkg1.pkg6.m383
+from pkg4 import m3
+import pkg1.pkg8.pkg33.m242
+from pkg2 import m1
+import pkg1.m0
+
+
+def helper_860_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_860_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_860_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_860_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_860_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
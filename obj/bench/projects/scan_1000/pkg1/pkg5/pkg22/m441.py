@@ -0,0 +1,29 @@
+"""Module 441."""
+import pkg1.pkg5.pkg24.m107
+from . import m231
+import pkg1.pkg5.pkg21.m104
+from pkg3.pkg14 import m265
+import pkg3.pkg14.m223
+from pkg3.pkg14 import m13
+import pkg2.pkg9.m8
+
+
+def helper_441_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_441_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_441_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 651."""
+import pkg2.pkg11.m10
+from pkg1.pkg5.pkg21 import m440
+import pkg1.pkg8.pkg35.m538
+from . import m63
+import pkg1.pkg8.pkg33.m158
+from pkg2 import m1
+import pkg1.pkg8.pkg33.m32
+from pkg1.pkg7.pkg31 import m408
+from . import m441
+
+
+def helper_651_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,22 @@
+"""Module 693."""
+from . import m567
+from pkg1.pkg5.pkg21 import m20
+import pkg1.m0
+from . import m441
+import pkg2.pkg9.m8
+from . import m189
+import pkg1.pkg5.m466
+
+
+def helper_693_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_693_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,28 @@
+"""Module 903."""
+import pkg4.pkg17.m562
+from pkg2.pkg11 import m52
+import pkg3.pkg14.m55
+from . import m189
+import pkg1.pkg6.pkg27.m782
+from pkg1 import m0
+
+
+def helper_903_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_903_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_903_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
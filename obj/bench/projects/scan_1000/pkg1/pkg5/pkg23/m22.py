@@ -0,0 +1,17 @@
+"""Module 22."""
+import pkg1.m0
+from pkg1.pkg8 import m7
+
+
+def helper_22_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_22_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
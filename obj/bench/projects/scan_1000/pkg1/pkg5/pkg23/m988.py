@@ -0,0 +1,48 @@
+"""Module 988."""
+from . import m778
+from . import m484
+import pkg1.pkg8.pkg34.m201
+from pkg1.pkg7.pkg30 import m29
+import pkg1.pkg7.pkg32.m787
+from pkg4.pkg19 import m606
+import pkg1.m0
+from . import m358
+import pkg1.pkg8.pkg33.m158
+from pkg1 import m126
+import pkg3.pkg15.m266
+from pkg4 import m87
+
+
+def helper_988_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_988_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_988_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_988_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_988_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
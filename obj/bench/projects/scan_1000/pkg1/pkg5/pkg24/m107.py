@@ -0,0 +1,37 @@
+"""Module 107."""
+from . import m23
+from . import m65
+import pkg4.pkg20.m19
+from pkg3 import m2
+import pkg1.pkg6.pkg26.m67
+from pkg2.pkg10 import m93
+import pkg1.m0
+from pkg1.pkg7 import m6
+
+
+def helper_107_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_107_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_107_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_107_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
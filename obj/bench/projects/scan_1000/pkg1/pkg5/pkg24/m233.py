@@ -0,0 +1,16 @@
+"""Module 233."""
+from . import m23
+from pkg1.pkg7 import m48
+import pkg1.pkg8.m7
+from pkg1.pkg8.pkg34 import m33
+import pkg1.m0
+from pkg1.pkg5.pkg22 import m21
+import pkg3.pkg15.m14
+from pkg4.pkg17 import m16
+
+
+def helper_233_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
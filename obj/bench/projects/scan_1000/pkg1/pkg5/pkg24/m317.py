@@ -0,0 +1,11 @@
+"""Module 317."""
+import pkg3.m2
+from pkg1.pkg8.pkg35 import m118
+from . import m23
+
+
+def helper_317_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,21 @@
+"""Module 485."""
+import pkg1.pkg5.pkg22.m21
+from pkg2.pkg12 import m431
+from . import m401
+from pkg2 import m1
+import pkg2.pkg11.m52
+from pkg2.pkg9.pkg40 import m165
+
+
+def helper_485_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_485_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,10 @@
+"""Module 695."""
+import pkg1.m84
+from pkg3.pkg16 import m141
+
+
+def helper_695_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
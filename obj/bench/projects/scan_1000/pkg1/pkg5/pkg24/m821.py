@@ -0,0 +1,44 @@
+"""Module 821."""
+import pkg2.pkg9.pkg38.m121
+from pkg2.pkg12 import m11
+import pkg4.pkg17.m310
+from pkg3.pkg16 import m309
+import pkg2.pkg9.pkg38.m79
+from pkg1.pkg5.pkg23 import m190
+import pkg1.pkg8.pkg35.m34
+from pkg1.pkg7.pkg30 import m29
+
+
+def helper_821_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_821_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_821_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_821_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_821_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 215."""
+import pkg1.m42
+from pkg1 import m0
+import pkg4.m3
+from pkg3.pkg14 import m13
+import pkg1.pkg7.pkg32.m115
+
+
+def helper_215_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_215_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_215_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,30 @@
+"""Module 299."""
+import pkg4.pkg18.m17
+from pkg3.pkg13 import m138
+import pkg1.pkg8.pkg35.m34
+from pkg1.pkg6.pkg27 import m26
+import pkg1.pkg6.pkg25.m192
+from pkg1.pkg5.pkg24 import m23
+import pkg4.pkg19.m102
+from . import m89
+
+
+def helper_299_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_299_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_299_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 47."""
+import pkg1.pkg6.pkg28.m27
+from . import m5
+
+
+def helper_47_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_47_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
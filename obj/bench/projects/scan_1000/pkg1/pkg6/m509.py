@@ -0,0 +1,9 @@
+"""Module 509."""
+from . import m173
+from pkg1 import m0
+import pkg1.pkg8.pkg33.m116
+from . import m299
+import pkg1.pkg8.pkg33.m200
+from pkg1 import m210
+import pkg4.m3
+from pkg1.pkg7 import m90
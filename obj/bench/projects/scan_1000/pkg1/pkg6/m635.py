@@ -0,0 +1,11 @@
+"""Module 635."""
+from . import m131
+from pkg1.pkg5 import m4
+from . import m5
+
+
+def helper_635_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
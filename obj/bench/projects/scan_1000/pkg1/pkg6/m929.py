@@ -0,0 +1,16 @@
+"""Module 929."""
+import pkg1.m0
+from pkg1.pkg6.pkg25 import m108
+import pkg4.pkg18.m479
+from pkg1.pkg7.pkg32 import m115
+import pkg1.m84
+from pkg1.pkg7.pkg30 import m701
+import pkg1.pkg8.m763
+from . import m5
+
+
+def helper_929_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
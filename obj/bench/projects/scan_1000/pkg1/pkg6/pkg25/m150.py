@@ -0,0 +1,16 @@
+"""Module 150."""
+import pkg2.pkg9.pkg40.m81
+from pkg1.pkg8.pkg34 import m33
+import pkg3.m128
+from pkg3.pkg13 import m54
+import pkg2.pkg9.m8
+from pkg3.pkg14 import m97
+import pkg2.pkg11.m52
+from pkg2.pkg10.pkg42 import m83
+
+
+def helper_150_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
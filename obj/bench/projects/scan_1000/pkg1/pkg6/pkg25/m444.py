@@ -0,0 +1,41 @@
+"""Module 444."""
+import pkg1.pkg8.pkg36.m329
+from pkg3.pkg16 import m141
+import pkg1.pkg8.m301
+from pkg3 import m2
+from . import m192
+from pkg1.pkg5.pkg21 import m20
+import pkg3.m170
+from pkg1 import m0
+import pkg2.pkg9.m218
+from pkg2 import m1
+import pkg1.pkg6.pkg27.m236
+from pkg1.pkg8.pkg36 import m245
+
+
+def helper_444_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_444_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_444_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_444_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,53 @@
+"""Module 486."""
+import pkg1.pkg7.pkg29.m28
+from . import m276
+import pkg1.pkg6.pkg28.m69
+from pkg2.pkg9.pkg39 import m38
+from . import m402
+from pkg2.pkg10 import m93
+import pkg1.pkg8.pkg36.m161
+from pkg1 import m0
+import pkg2.pkg9.pkg37.m414
+from pkg1.pkg5 import m4
+
+
+def helper_486_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_486_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_486_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_486_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_486_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_486_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
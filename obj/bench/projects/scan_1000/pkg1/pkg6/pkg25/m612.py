@@ -0,0 +1,22 @@
+"""Module 612."""
+import pkg2.pkg9.m260
+from pkg3 import m422
+import pkg1.m0
+from pkg2.pkg12 import m221
+import pkg2.m1
+from . import m234
+import pkg1.pkg7.pkg30.m29
+
+
+def helper_612_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_612_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 654."""
+import pkg1.pkg7.pkg31.m450
+from pkg4.pkg19 import m144
+import pkg3.m44
+from pkg1.pkg5.pkg23 import m568
+import pkg3.m2
+from pkg1.pkg5 import m4
+from . import m318
+from pkg1.pkg8.pkg36 import m245
+from . import m528
+
+
+def helper_654_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
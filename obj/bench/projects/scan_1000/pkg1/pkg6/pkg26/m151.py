@@ -0,0 +1,23 @@
+"""Module 151."""
+from . import m25
+from pkg1 import m0
+import pkg1.pkg5.m4
+from . import m109
+from . import m67
+from pkg1.pkg5.pkg22 import m105
+import pkg2.pkg9.m92
+from pkg2 import m1
+
+
+def helper_151_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_151_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
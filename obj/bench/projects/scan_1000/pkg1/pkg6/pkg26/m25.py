@@ -0,0 +1,20 @@
+"""Module 25."""
+import pkg3.m2
+from pkg1.pkg8 import m7
+import pkg1.m0
+from pkg4 import m3
+import pkg2.m1
+
+
+def helper_25_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_25_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
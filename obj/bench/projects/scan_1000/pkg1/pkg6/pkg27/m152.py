@@ -0,0 +1,17 @@
+"""Module 152."""
+import pkg1.m0
+from pkg3.pkg16 import m99
+
+
+def helper_152_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_152_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 320."""
+import pkg2.pkg10.pkg41.m40
+from pkg1.pkg6.pkg28 import m27
+from . import m194
+from pkg1.pkg8.pkg34 import m243
+import pkg1.m0
+from pkg3 import m128
+import pkg2.m1
+from pkg3.pkg13 import m12
+import pkg2.pkg9.pkg37.m36
+from . import m26
+from . import m68
+
+
+def helper_320_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
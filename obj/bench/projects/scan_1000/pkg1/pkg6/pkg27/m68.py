@@ -0,0 +1,36 @@
+"""Module 68."""
+import pkg3.m44
+from pkg1.pkg5.pkg22 import m63
+from . import m26
+from pkg1.pkg5 import m4
+import pkg3.pkg14.m13
+from pkg1 import m0
+import pkg1.pkg7.pkg31.m30
+
+
+def helper_68_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_68_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_68_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_68_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
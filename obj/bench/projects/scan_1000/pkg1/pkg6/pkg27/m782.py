@@ -0,0 +1,22 @@
+"""Module 782."""
+import pkg1.pkg7.m6
+from . import m698
+import pkg1.pkg5.pkg23.m22
+from pkg1.pkg7.pkg30 import m365
+import pkg2.pkg9.pkg39.m38
+from pkg1.pkg8.pkg35 import m34
+import pkg3.pkg16.m435
+
+
+def helper_782_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_782_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 950."""
+import pkg3.pkg15.m854
+from pkg3 import m2
+from . import m110
+from pkg2.pkg9.pkg39 import m38
+from . import m530
+
+
+def helper_950_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_950_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,24 @@
+"""Module 405."""
+import pkg2.pkg9.pkg40.m39
+from pkg1.pkg8.pkg35 import m76
+from . import m153
+from pkg2.pkg9.pkg37 import m120
+import pkg3.pkg13.m96
+from pkg1.pkg8.pkg33 import m32
+import pkg1.m0
+from pkg1.pkg8 import m301
+import pkg2.pkg10.pkg41.m40
+
+
+def helper_405_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_405_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
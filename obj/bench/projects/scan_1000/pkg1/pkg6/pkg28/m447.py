@@ -0,0 +1,16 @@
+"""Module 447."""
+import pkg3.m212
+from pkg1.pkg7.pkg31 import m198
+import pkg2.pkg10.pkg41.m166
+from . import m237
+from . import m153
+from pkg1 import m0
+import pkg2.pkg12.m53
+from . import m27
+
+
+def helper_447_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,24 @@
+"""Module 783."""
+import pkg2.pkg10.m9
+from pkg1.pkg5.pkg24 import m275
+import pkg3.pkg14.m13
+from . import m447
+import pkg4.pkg20.m397
+from pkg1.pkg5.pkg22 import m21
+import pkg1.pkg6.pkg26.m361
+from pkg2.pkg10.pkg41 import m40
+import pkg1.m0
+
+
+def helper_783_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_783_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
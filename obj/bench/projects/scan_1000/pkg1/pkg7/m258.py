@@ -0,0 +1,34 @@
+"""Module 258."""
+import pkg2.pkg10.pkg41.m40
+from pkg1.pkg8 import m7
+import pkg1.pkg6.pkg25.m66
+from pkg1.pkg8.pkg33 import m74
+import pkg1.pkg6.pkg28.m195
+
+
+def helper_258_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_258_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_258_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_258_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 342."""
+import pkg3.pkg14.m55
+from pkg1 import m0
+from . import m300
+from pkg2.pkg10 import m93
+import pkg1.pkg5.m4
+
+
+def helper_342_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_342_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,38 @@
+"""Module 552."""
+import pkg1.pkg8.pkg34.m33
+from . import m258
+import pkg2.pkg9.pkg37.m288
+from pkg1.pkg8.pkg35 import m76
+import pkg4.pkg20.m187
+from pkg3.pkg13 import m12
+import pkg2.m1
+from . import m216
+import pkg1.m0
+
+
+def helper_552_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_552_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_552_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_552_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
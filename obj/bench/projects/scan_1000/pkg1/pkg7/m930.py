@@ -0,0 +1,25 @@
+"""Module 930."""
+import pkg1.pkg7.pkg31.m30
+from pkg1.pkg5.pkg23 import m106
+import pkg2.pkg9.pkg39.m248
+
+
+def helper_930_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_930_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_930_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,2 @@
+"""Module 532."""
+import pkg3.m2
@@ -0,0 +1,22 @@
+"""Module 742."""
+from . import m700
+from . import m616
+from . import m70
+from pkg2 import m673
+from . import m280
+from . import m490
+import pkg1.pkg6.pkg28.m153
+
+
+def helper_742_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_742_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,60 @@
+"""Module 784."""
+import pkg1.pkg8.pkg33.m32
+from pkg1.pkg6.pkg25 import m738
+import pkg1.pkg7.m6
+from pkg1.pkg8.pkg33 import m74
+import pkg4.pkg17.m100
+from pkg1.pkg6.pkg26 import m151
+import pkg1.pkg5.pkg23.m274
+from pkg1.pkg6.pkg27 import m68
+import pkg1.pkg5.pkg24.m317
+from pkg1.pkg8.pkg36 import m581
+
+
+def helper_784_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_784_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_784_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_784_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_784_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_784_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_784_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
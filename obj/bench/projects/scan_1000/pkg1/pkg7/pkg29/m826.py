@@ -0,0 +1,45 @@
+"""Module 826."""
+import pkg1.pkg5.pkg21.m188
+from . import m364
+import pkg3.pkg14.m559
+from pkg1.pkg8.pkg33 import m410
+import pkg2.pkg9.pkg40.m711
+from pkg1.pkg8.pkg35 import m538
+import pkg1.pkg5.pkg23.m190
+from pkg1.pkg7 import m762
+from . import m532
+
+
+def helper_826_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_826_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_826_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_826_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_826_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,3 @@
+"""Module 197."""
+from . import m155
+from pkg2.pkg9.pkg39 import m164
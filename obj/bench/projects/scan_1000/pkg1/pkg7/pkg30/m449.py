@@ -0,0 +1,55 @@
+"""Module 449."""
+import pkg3.pkg14.m13
+from . import m407
+import pkg4.m3
+from pkg1.pkg6 import m89
+import pkg2.m1
+from pkg4.pkg20 import m229
+import pkg1.pkg5.pkg24.m401
+from pkg1.pkg7.pkg32 import m199
+from . import m281
+from pkg1 import m0
+import pkg1.pkg7.m6
+from . import m239
+
+
+def helper_449_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_449_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_449_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_449_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_449_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_449_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
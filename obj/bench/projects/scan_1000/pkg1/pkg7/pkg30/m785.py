@@ -0,0 +1,38 @@
+"""Module 785."""
+import pkg2.m1
+from pkg2.pkg11 import m304
+import pkg1.pkg5.m88
+from pkg2.pkg9.pkg40 import m207
+import pkg4.pkg20.m61
+from pkg1.pkg5.pkg21 import m62
+from . import m659
+from pkg2.pkg10.pkg41 import m40
+import pkg1.pkg5.m4
+
+
+def helper_785_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_785_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_785_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_785_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
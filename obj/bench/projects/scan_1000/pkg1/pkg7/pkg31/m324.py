@@ -0,0 +1,19 @@
+"""Module 324."""
+import pkg1.pkg8.pkg36.m161
+from pkg1.pkg8.pkg36 import m203
+from . import m282
+from pkg1.pkg8.pkg36 import m35
+
+
+def helper_324_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_324_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 450."""
+from . import m198
+from pkg2.pkg9.pkg40 import m81
+import pkg4.pkg19.m18
+from pkg1 import m0
+
+
+def helper_450_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_450_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_450_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 115."""
+import pkg2.pkg10.m9
+from pkg4 import m87
+import pkg1.m0
+
+
+def helper_115_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
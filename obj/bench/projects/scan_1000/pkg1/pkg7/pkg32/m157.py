@@ -0,0 +1,17 @@
+"""Module 157."""
+import pkg1.m0
+from pkg1.pkg8.pkg34 import m117
+
+
+def helper_157_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_157_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
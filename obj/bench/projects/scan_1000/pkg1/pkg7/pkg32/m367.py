@@ -0,0 +1,14 @@
+"""Module 367."""
+import pkg1.pkg7.m216
+from pkg1.pkg6.pkg25 import m318
+from . import m241
+from pkg4.pkg19 import m18
+import pkg1.pkg8.pkg36.m35
+from pkg2.pkg12 import m11
+
+
+def helper_367_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,16 @@
+"""Module 535."""
+import pkg1.pkg5.pkg21.m188
+from pkg2.pkg12 import m347
+import pkg2.pkg10.pkg42.m251
+from pkg1.pkg8 import m7
+import pkg4.pkg18.m269
+from pkg1.pkg6 import m5
+import pkg1.m0
+from . import m367
+
+
+def helper_535_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
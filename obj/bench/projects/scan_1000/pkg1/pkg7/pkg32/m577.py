@@ -0,0 +1,19 @@
+"""Module 577."""
+import pkg2.m1
+from pkg1.pkg7.pkg31 import m408
+import pkg1.pkg5.pkg22.m21
+from . import m283
+
+
+def helper_577_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_577_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 73."""
+import pkg4.pkg19.m18
+from pkg1.pkg6.pkg25 import m24
+import pkg1.pkg6.pkg27.m68
+from pkg1.pkg8.pkg36 import m35
+
+
+def helper_73_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_73_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
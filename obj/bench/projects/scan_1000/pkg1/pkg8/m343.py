@@ -0,0 +1,27 @@
+"""Module 343."""
+import pkg4.m213
+from pkg4.pkg19 import m186
+from . import m301
+from pkg4 import m3
+import pkg1.pkg6.m5
+
+
+def helper_343_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_343_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_343_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,9 @@
+"""Module 553."""
+import pkg2.pkg9.m302
+
+
+def helper_553_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,54 @@
+"""Module 872."""
+import pkg1.pkg7.pkg32.m31
+from pkg2.pkg9.pkg39 import m164
+import pkg2.pkg9.pkg38.m541
+from pkg2.pkg9.pkg38 import m751
+import pkg1.pkg5.pkg24.m149
+from pkg3.pkg16 import m15
+from . import m410
+from pkg4.pkg17 import m184
+import pkg1.pkg5.pkg23.m274
+from pkg1.pkg6 import m5
+from . import m284
+
+
+def helper_872_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_872_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_872_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_872_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_872_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_872_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,24 @@
+"""Module 285."""
+import pkg2.m1
+from pkg1.pkg6.pkg28 import m69
+import pkg4.m3
+from . import m159
+import pkg4.pkg19.m102
+from pkg1.pkg5 import m4
+import pkg2.pkg12.m11
+from pkg3.pkg13 import m54
+import pkg1.m0
+
+
+def helper_285_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_285_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
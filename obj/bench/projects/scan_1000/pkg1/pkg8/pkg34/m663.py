@@ -0,0 +1,47 @@
+"""Module 663."""
+import pkg2.pkg11.m10
+from pkg1.pkg8.pkg33 import m74
+from . import m75
+from pkg1.pkg5 import m424
+import pkg1.m0
+from pkg2.pkg10 import m9
+import pkg2.m43
+from pkg1.pkg8 import m7
+import pkg1.pkg7.pkg31.m30
+from pkg3.pkg14 import m433
+import pkg1.pkg7.m6
+
+
+def helper_663_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_663_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_663_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_663_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_663_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
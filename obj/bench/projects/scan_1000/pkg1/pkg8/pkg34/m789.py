@@ -0,0 +1,26 @@
+"""Module 789."""
+import pkg2.pkg10.pkg42.m41
+from pkg1.pkg7 import m6
+from . import m537
+from pkg2.pkg12 import m641
+import pkg2.pkg10.pkg41.m586
+from pkg2.pkg10.pkg41 import m40
+import pkg1.pkg6.pkg28.m195
+from pkg1.pkg6.pkg27 import m110
+import pkg2.pkg9.pkg38.m415
+from . import m327
+import pkg2.pkg9.pkg39.m290
+
+
+def helper_789_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_789_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,37 @@
+"""Module 286."""
+import pkg4.pkg19.m18
+from pkg4 import m171
+import pkg1.m0
+from pkg1 import m126
+import pkg1.pkg6.pkg28.m27
+from pkg2.pkg9.pkg40 import m207
+from . import m118
+from pkg2.pkg10.pkg42 import m125
+
+
+def helper_286_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_286_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_286_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_286_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
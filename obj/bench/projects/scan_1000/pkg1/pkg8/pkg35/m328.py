@@ -0,0 +1,27 @@
+"""Module 328."""
+from . import m202
+from pkg2.pkg9.pkg38 import m121
+import pkg3.pkg13.m96
+from . import m286
+import pkg1.pkg7.pkg32.m283
+
+
+def helper_328_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_328_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_328_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
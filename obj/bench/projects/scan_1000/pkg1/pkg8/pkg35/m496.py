@@ -0,0 +1,21 @@
+"""Module 496."""
+from . import m370
+from . import m76
+import pkg1.m0
+from pkg1.pkg5 import m4
+import pkg1.pkg5.pkg22.m441
+from pkg1.pkg6.pkg26 import m487
+
+
+def helper_496_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_496_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
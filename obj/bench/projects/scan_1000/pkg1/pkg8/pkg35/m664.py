@@ -0,0 +1,26 @@
+"""Module 664."""
+import pkg1.m630
+from . import m580
+import pkg2.m1
+from pkg2.pkg9 import m8
+import pkg1.pkg8.pkg33.m32
+from pkg1.pkg8.pkg36 import m119
+import pkg4.m3
+from pkg3.pkg16 import m57
+import pkg1.pkg7.pkg31.m408
+from pkg3.pkg16 import m15
+import pkg4.pkg17.m16
+
+
+def helper_664_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_664_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
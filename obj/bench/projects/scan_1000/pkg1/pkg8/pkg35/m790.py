@@ -0,0 +1,48 @@
+"""Module 790."""
+import pkg1.pkg6.m509
+from pkg2.pkg9.pkg40 import m39
+import pkg1.pkg6.pkg25.m108
+from pkg3.pkg14 import m307
+import pkg4.pkg19.m690
+from pkg3.pkg16 import m477
+import pkg1.pkg6.m467
+from pkg2.pkg11 import m262
+from . import m748
+from pkg2.pkg10.pkg42 import m335
+import pkg2.pkg9.pkg38.m79
+from pkg1.pkg5 import m592
+
+
+def helper_790_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_790_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_790_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_790_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_790_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
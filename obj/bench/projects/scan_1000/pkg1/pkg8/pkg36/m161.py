@@ -0,0 +1,28 @@
+"""Module 161."""
+import pkg2.pkg10.pkg42.m41
+from pkg1.pkg6.pkg27 import m152
+from . import m77
+from pkg1.pkg6.pkg27 import m110
+import pkg1.m0
+from . import m35
+
+
+def helper_161_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_161_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_161_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,23 @@
+"""Module 245."""
+from . import m161
+from pkg1.pkg5.pkg24 import m23
+import pkg1.pkg7.pkg32.m31
+from pkg1.pkg6.pkg25 import m150
+import pkg2.pkg12.m11
+from . import m35
+import pkg1.m0
+from pkg1.pkg5.pkg21 import m146
+
+
+def helper_245_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_245_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 371."""
+import pkg4.pkg18.m185
+from pkg1.pkg7.pkg32 import m73
+import pkg1.pkg5.pkg22.m231
+
+
+def helper_371_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_371_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,38 @@
+"""Module 421."""
+from . import m1
+from . import m337
+from . import m43
+from pkg1.pkg7.pkg30 import m71
+from . import m295
+from pkg1.pkg5.pkg21 import m20
+import pkg3.pkg15.m266
+from pkg2.pkg9.pkg37 import m36
+import pkg1.m0
+
+
+def helper_421_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_421_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_421_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_421_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
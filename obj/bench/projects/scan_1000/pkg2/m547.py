@@ -0,0 +1,31 @@
+"""Module 547."""
+import pkg2.pkg11.m304
+from . import m505
+import pkg1.m0
+from pkg1.pkg7 import m48
+from . import m169
+from pkg2.pkg9.pkg40 import m501
+import pkg4.m87
+from pkg2.pkg9 import m8
+import pkg3.m2
+
+
+def helper_547_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_547_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_547_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
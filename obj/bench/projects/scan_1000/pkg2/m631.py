@@ -0,0 +1,29 @@
+"""Module 631."""
+import pkg3.pkg16.m351
+from . import m1
+from . import m43
+from pkg1 import m0
+from . import m463
+from pkg4.pkg17 import m142
+import pkg4.pkg20.m481
+
+
+def helper_631_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_631_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_631_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
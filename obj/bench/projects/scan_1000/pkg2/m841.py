@@ -0,0 +1,40 @@
+"""Module 841."""
+from . import m1
+from . import m463
+import pkg4.pkg19.m732
+from pkg1.pkg6.pkg27 import m656
+import pkg1.m0
+from pkg3.pkg15 import m14
+import pkg4.pkg18.m17
+from pkg1.pkg5.pkg23 import m358
+import pkg4.pkg18.m185
+from pkg1 import m42
+import pkg1.pkg5.pkg24.m191
+
+
+def helper_841_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_841_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_841_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_841_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,23 @@
+"""Module 387."""
+import pkg1.pkg6.pkg28.m27
+from . import m219
+import pkg1.m0
+from pkg2.pkg9.pkg37 import m36
+import pkg3.pkg13.m12
+from pkg1.pkg8 import m7
+from . import m261
+from pkg4.pkg17 import m58
+
+
+def helper_387_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_387_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,13 @@
+"""Module 429."""
+import pkg2.pkg11.m10
+from pkg1.pkg7.pkg29 import m322
+import pkg1.pkg8.m49
+from pkg1.pkg5 import m424
+import pkg1.m0
+from pkg3.pkg16 import m15
+from . import m219
+from pkg1.pkg8.pkg35 import m286
+import pkg1.pkg7.pkg30.m407
+from pkg1.pkg6.pkg25 import m150
+from . import m135
+from pkg4 import m3
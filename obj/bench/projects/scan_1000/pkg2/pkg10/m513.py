@@ -0,0 +1,18 @@
+"""Module 513."""
+from . import m387
+from pkg3.pkg13 import m12
+import pkg2.pkg9.pkg38.m415
+from pkg3 import m2
+import pkg4.pkg20.m19
+from pkg1.pkg5 import m4
+import pkg2.pkg10.pkg42.m83
+from . import m9
+import pkg2.pkg10.pkg42.m167
+from pkg4 import m3
+
+
+def helper_513_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,15 @@
+"""Module 765."""
+import pkg1.m0
+from . import m93
+from . import m177
+from pkg1.pkg5 import m676
+import pkg1.pkg6.m131
+from . import m135
+import pkg1.pkg6.pkg28.m111
+
+
+def helper_765_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,15 @@
+"""Module 250."""
+import pkg1.m0
+from pkg4.pkg19 import m186
+import pkg2.pkg11.m94
+from pkg3.pkg16 import m99
+import pkg1.pkg5.pkg23.m64
+from pkg2.pkg12 import m11
+import pkg3.pkg13.m12
+
+
+def helper_250_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,15 @@
+"""Module 292."""
+import pkg1.m0
+from pkg2 import m1
+import pkg1.pkg7.pkg30.m155
+from . import m208
+from . import m124
+from pkg1.pkg5.pkg23 import m106
+import pkg1.pkg8.pkg33.m74
+
+
+def helper_292_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
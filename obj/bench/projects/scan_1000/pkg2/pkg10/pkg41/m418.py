@@ -0,0 +1,16 @@
+"""Module 418."""
+import pkg1.pkg5.pkg23.m22
+from pkg1 import m0
+import pkg2.pkg10.pkg42.m335
+from pkg1.pkg5 import m46
+import pkg2.pkg9.pkg40.m375
+from pkg2.pkg11 import m220
+import pkg1.pkg6.pkg28.m111
+from pkg3.pkg16 import m267
+
+
+def helper_418_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
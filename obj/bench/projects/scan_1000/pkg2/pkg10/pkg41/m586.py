@@ -0,0 +1,39 @@
+"""Module 586."""
+import pkg4.pkg18.m59
+from pkg1 import m0
+import pkg1.pkg8.pkg35.m412
+from . import m418
+from . import m124
+from pkg1 import m168
+import pkg3.m212
+from . import m82
+import pkg3.pkg15.m308
+from . import m376
+
+
+def helper_586_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_586_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_586_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_586_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
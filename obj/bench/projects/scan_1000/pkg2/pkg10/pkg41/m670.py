@@ -0,0 +1,29 @@
+"""Module 670."""
+import pkg1.m0
+from pkg1.pkg7 import m132
+import pkg2.pkg11.m52
+from pkg1.pkg8 import m427
+import pkg1.pkg5.pkg22.m147
+from pkg2.pkg9.pkg39 import m290
+import pkg1.pkg8.pkg36.m161
+
+
+def helper_670_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_670_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_670_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,45 @@
+"""Module 838."""
+from . import m124
+from pkg4.pkg18 import m353
+import pkg1.pkg6.pkg27.m656
+from pkg4.pkg20 import m439
+import pkg2.pkg9.m680
+from . import m502
+import pkg3.pkg15.m14
+from . import m166
+import pkg1.pkg7.pkg32.m703
+
+
+def helper_838_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_838_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_838_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_838_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_838_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,36 @@
+"""Module 922."""
+import pkg1.pkg5.pkg24.m23
+from pkg2.pkg10 import m9
+from . import m208
+from pkg4.pkg18 import m59
+from . import m292
+from pkg1.pkg8.pkg35 import m202
+import pkg2.pkg12.m473
+
+
+def helper_922_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_922_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_922_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_922_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
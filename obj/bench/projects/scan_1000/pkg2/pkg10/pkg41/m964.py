@@ -0,0 +1,26 @@
+"""Module 964."""
+from . import m712
+from pkg4.pkg20 import m19
+import pkg1.pkg5.pkg23.m442
+from pkg1.pkg6.pkg26 import m445
+
+
+def helper_964_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_964_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_964_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,36 @@
+"""Module 125."""
+import pkg1.pkg5.pkg24.m23
+from . import m41
+import pkg1.pkg7.pkg32.m73
+from . import m83
+import pkg4.m3
+from pkg1.pkg7.pkg30 import m71
+import pkg2.pkg10.pkg41.m40
+
+
+def helper_125_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_125_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_125_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_125_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,12 @@
+"""Module 388."""
+from . import m346
+from pkg1.pkg8 import m175
+from . import m262
+from pkg1.pkg5.pkg22 import m21
+
+
+def helper_388_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 472."""
+import pkg2.pkg9.pkg38.m415
+from pkg1.pkg8.pkg35 import m286
+import pkg1.pkg7.pkg30.m29
+
+
+def helper_472_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_472_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 514."""
+import pkg1.m0
+from pkg1.pkg8.pkg33 import m368
+from . import m178
+from . import m94
+import pkg1.pkg8.pkg33.m410
+
+
+def helper_514_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_514_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_514_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
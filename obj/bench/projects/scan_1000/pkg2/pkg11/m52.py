@@ -0,0 +1,15 @@
+"""Module 52."""
+from . import m10
+from pkg1.pkg7 import m6
+import pkg1.pkg8.pkg34.m33
+from pkg1 import m0
+import pkg2.m1
+from pkg1.pkg8.pkg35 import m34
+import pkg1.pkg6.pkg25.m24
+
+
+def helper_52_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
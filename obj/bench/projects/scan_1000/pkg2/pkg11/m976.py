@@ -0,0 +1,37 @@
+"""Module 976."""
+import pkg4.pkg17.m16
+from pkg1.pkg8.pkg33 import m746
+import pkg3.pkg15.m98
+from pkg2.pkg9.pkg40 import m333
+from . import m388
+from pkg2 import m1
+import pkg3.pkg13.m12
+from pkg1.pkg5 import m172
+
+
+def helper_976_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_976_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_976_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_976_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,3 @@
+"""Module 263."""
+import pkg1.m0
+from . import m53
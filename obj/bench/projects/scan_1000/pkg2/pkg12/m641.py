@@ -0,0 +1,20 @@
+"""Module 641."""
+import pkg1.m0
+from pkg1.pkg6.pkg27 import m278
+import pkg4.pkg18.m395
+from pkg1.pkg7.pkg31 import m618
+import pkg1.pkg5.pkg21.m20
+
+
+def helper_641_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_641_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 260."""
+from . import m134
+from pkg1.pkg5 import m4
+import pkg2.pkg9.pkg40.m39
+
+
+def helper_260_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_260_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
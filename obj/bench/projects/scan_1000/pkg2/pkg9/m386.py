@@ -0,0 +1,13 @@
+"""Module 386."""
+import pkg1.pkg6.m215
+from pkg1.pkg8.pkg33 import m284
+import pkg1.m0
+from . import m134
+import pkg1.pkg8.m175
+
+
+def helper_386_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
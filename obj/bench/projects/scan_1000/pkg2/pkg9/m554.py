@@ -0,0 +1,19 @@
+"""Module 554."""
+import pkg2.pkg12.m11
+from pkg2.pkg9.pkg38 import m289
+import pkg1.pkg6.m131
+from . import m428
+
+
+def helper_554_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_554_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 806."""
+import pkg3.pkg16.m729
+from . import m386
+import pkg2.pkg12.m725
+
+
+def helper_806_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
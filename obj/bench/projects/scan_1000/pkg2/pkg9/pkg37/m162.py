@@ -0,0 +1,17 @@
+"""Module 162."""
+from . import m120
+from pkg1.pkg6.pkg27 import m110
+
+
+def helper_162_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_162_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
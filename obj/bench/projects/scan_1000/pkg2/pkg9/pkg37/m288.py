@@ -0,0 +1,35 @@
+"""Module 288."""
+import pkg1.m0
+from pkg4.pkg18 import m17
+import pkg2.pkg10.pkg42.m83
+from pkg2.pkg11 import m10
+from . import m246
+from pkg1.pkg7 import m6
+
+
+def helper_288_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_288_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_288_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_288_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,44 @@
+"""Module 36."""
+import pkg4.pkg18.m17
+from pkg1.pkg5.pkg24 import m23
+import pkg4.m3
+from pkg3.pkg13 import m12
+import pkg1.pkg6.pkg25.m24
+from pkg1.pkg7.pkg29 import m28
+import pkg1.m0
+from pkg2 import m1
+
+
+def helper_36_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_36_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_36_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_36_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_36_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
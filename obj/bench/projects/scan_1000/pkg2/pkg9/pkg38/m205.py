@@ -0,0 +1,44 @@
+"""Module 205."""
+import pkg1.pkg6.pkg25.m24
+from pkg2 import m1
+import pkg4.m3
+from pkg1.pkg7 import m6
+import pkg4.pkg17.m142
+from pkg1 import m0
+import pkg1.pkg5.pkg21.m104
+from pkg1.pkg5.pkg24 import m23
+
+
+def helper_205_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_205_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_205_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_205_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_205_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,38 @@
+"""Module 247."""
+import pkg2.pkg9.pkg39.m164
+from . import m163
+import pkg3.pkg15.m182
+from . import m37
+import pkg4.m171
+from pkg3 import m86
+import pkg2.pkg11.m10
+from pkg1.pkg5.pkg21 import m230
+import pkg2.m85
+
+
+def helper_247_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_247_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_247_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_247_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 415."""
+import pkg1.pkg6.pkg26.m277
+from pkg1.pkg8 import m7
+import pkg1.pkg5.pkg23.m22
+from pkg4.pkg18 import m17
+import pkg1.m0
+
+
+def helper_415_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_415_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,47 @@
+"""Module 667."""
+import pkg2.pkg12.m53
+from pkg1 import m0
+import pkg1.pkg8.pkg35.m76
+from . import m37
+import pkg3.pkg16.m15
+from pkg1.pkg5.pkg21 import m272
+from . import m457
+from . import m583
+import pkg1.pkg8.pkg33.m158
+from pkg2.pkg12 import m305
+import pkg2.pkg10.m9
+
+
+def helper_667_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_667_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_667_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_667_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_667_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 835."""
+import pkg2.pkg9.pkg40.m123
+from pkg1.pkg6.pkg27 import m26
+import pkg4.pkg17.m226
+from . import m79
+import pkg1.m0
+
+
+def helper_835_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_835_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
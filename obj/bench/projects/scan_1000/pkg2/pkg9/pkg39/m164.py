@@ -0,0 +1,25 @@
+"""Module 164."""
+import pkg4.m3
+from pkg2 import m1
+import pkg1.m0
+from pkg1.pkg7 import m48
+import pkg1.pkg8.pkg35.m34
+from pkg4.pkg19 import m60
+import pkg1.pkg7.m6
+from pkg1.pkg7.pkg29 import m28
+import pkg2.pkg12.m11
+from pkg2.pkg9 import m8
+
+
+def helper_164_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_164_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,9 @@
+"""Module 500."""
+import pkg2.pkg11.m178
+from . import m374
+import pkg1.pkg5.m4
+from pkg1.pkg5 import m88
+import pkg1.pkg6.pkg26.m25
+from pkg1.pkg7.pkg30 import m29
+import pkg4.pkg20.m271
+from pkg1 import m0
@@ -0,0 +1,11 @@
+"""Module 626."""
+from . import m80
+from . import m374
+import pkg1.pkg6.pkg25.m24
+
+
+def helper_626_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
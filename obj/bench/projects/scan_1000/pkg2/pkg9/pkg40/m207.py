@@ -0,0 +1,18 @@
+"""Module 207."""
+import pkg1.pkg8.m49
+from pkg2.pkg10 import m51
+import pkg1.m0
+from . import m39
+import pkg1.pkg5.pkg22.m105
+from pkg1.pkg5 import m46
+import pkg1.pkg8.pkg33.m116
+from pkg2.pkg12 import m11
+import pkg1.pkg5.pkg23.m148
+from pkg3.pkg15 import m14
+
+
+def helper_207_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 501."""
+from . import m333
+from pkg2.pkg11 import m52
+from . import m375
+from pkg1.pkg8 import m301
+import pkg2.pkg10.pkg42.m167
+from pkg4 import m3
+import pkg3.m2
+from pkg1.pkg6.pkg27 import m194
+import pkg2.pkg10.m51
+from pkg1 import m0
+from . import m291
+
+
+def helper_501_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,14 @@
+"""Module 711."""
+import pkg1.m0
+from pkg2.pkg10 import m9
+import pkg1.pkg7.pkg30.m113
+from . import m333
+import pkg2.pkg9.pkg37.m708
+from pkg1.pkg6.pkg27 import m26
+
+
+def helper_711_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
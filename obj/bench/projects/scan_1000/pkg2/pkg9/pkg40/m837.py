@@ -0,0 +1,19 @@
+"""Module 837."""
+from . import m669
+from pkg2.pkg10.pkg42 import m335
+import pkg1.pkg5.pkg23.m22
+from pkg3.pkg13 import m12
+
+
+def helper_837_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_837_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
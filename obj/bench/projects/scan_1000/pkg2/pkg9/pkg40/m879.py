@@ -0,0 +1,18 @@
+"""Module 879."""
+from . import m39
+from pkg2.pkg9.pkg38 import m625
+import pkg3.pkg13.m768
+
+
+def helper_879_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_879_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 380."""
+from . import m2
+from pkg2 import m1
+import pkg1.pkg5.pkg23.m22
+
+
+def helper_380_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 590."""
+import pkg4.pkg17.m352
+from . import m44
+import pkg1.pkg8.pkg36.m329
+from pkg1.pkg7.pkg31 import m30
+
+
+def helper_590_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_590_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_590_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,14 @@
+"""Module 632."""
+import pkg2.m43
+from . import m338
+import pkg2.pkg10.m387
+from pkg2.pkg9.pkg38 import m37
+import pkg3.pkg15.m266
+from . import m380
+
+
+def helper_632_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,38 @@
+"""Module 674."""
+import pkg4.pkg17.m184
+from pkg1.pkg5.pkg21 import m20
+import pkg3.pkg15.m14
+from pkg1.pkg8.pkg33 import m200
+from . import m632
+from pkg1.pkg8 import m7
+import pkg2.pkg9.pkg37.m372
+from . import m422
+from . import m44
+
+
+def helper_674_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_674_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_674_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_674_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,41 @@
+"""Module 800."""
+import pkg2.pkg12.m221
+from pkg1.pkg8.pkg35 import m538
+import pkg1.pkg8.m511
+from pkg4 import m3
+import pkg2.pkg9.pkg40.m501
+from pkg1.pkg5.pkg24 import m23
+import pkg1.pkg6.pkg27.m782
+from pkg1.pkg5 import m4
+from . import m380
+from pkg1.pkg8.pkg33 import m116
+import pkg1.pkg8.pkg33.m32
+from pkg2.pkg10 import m51
+
+
+def helper_800_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_800_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_800_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_800_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,10 @@
+"""Module 222."""
+import pkg1.m0
+from pkg1.pkg8.pkg36 import m161
+
+
+def helper_222_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
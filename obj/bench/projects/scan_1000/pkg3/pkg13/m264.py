@@ -0,0 +1,11 @@
+"""Module 264."""
+import pkg1.m0
+from pkg1.pkg6.pkg28 import m195
+import pkg4.m129
+
+
+def helper_264_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
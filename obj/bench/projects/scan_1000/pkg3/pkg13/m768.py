@@ -0,0 +1,26 @@
+"""Module 768."""
+from . import m516
+from pkg3.pkg16 import m15
+import pkg2.pkg10.pkg42.m629
+from pkg4.pkg18 import m227
+
+
+def helper_768_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_768_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_768_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
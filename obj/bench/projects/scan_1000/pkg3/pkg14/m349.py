@@ -0,0 +1,8 @@
+"""Module 349."""
+from . import m181
+from . import m265
+import pkg4.pkg18.m269
+from pkg2.pkg10.pkg42 import m209
+import pkg3.m2
+from pkg1.pkg6 import m215
+import pkg1.m0
@@ -0,0 +1,39 @@
+"""Module 391."""
+import pkg1.pkg8.pkg36.m245
+from pkg1 import m0
+from . import m97
+from . import m223
+from . import m349
+from pkg1.pkg5.pkg23 import m274
+from . import m13
+from pkg2.pkg10.pkg41 import m40
+import pkg3.m2
+from pkg1.pkg6 import m5
+
+
+def helper_391_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_391_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_391_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_391_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
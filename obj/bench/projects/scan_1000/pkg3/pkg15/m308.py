@@ -0,0 +1,37 @@
+"""Module 308."""
+import pkg1.pkg7.m6
+from pkg1.pkg8.pkg33 import m32
+from . import m182
+from pkg1.pkg8.pkg33 import m74
+import pkg2.pkg9.m176
+from . import m98
+import pkg2.pkg10.pkg41.m208
+from . import m56
+
+
+def helper_308_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_308_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_308_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_308_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 56."""
+import pkg2.pkg9.m8
+from pkg1 import m0
+import pkg1.pkg6.m5
+from pkg1.pkg5 import m4
+from . import m14
+
+
+def helper_56_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_56_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,38 @@
+"""Module 602."""
+import pkg4.pkg18.m269
+from pkg1.pkg7.pkg32 import m535
+import pkg1.m0
+from pkg3.pkg16 import m57
+import pkg2.pkg9.pkg39.m248
+from . import m392
+import pkg1.pkg7.pkg32.m31
+from pkg1.pkg8.pkg35 import m34
+import pkg4.m129
+
+
+def helper_602_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_602_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_602_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_602_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
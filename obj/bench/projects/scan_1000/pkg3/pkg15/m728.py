@@ -0,0 +1,19 @@
+"""Module 728."""
+import pkg4.pkg17.m16
+from pkg1.pkg5.pkg21 import m20
+from . import m686
+from pkg2.pkg11 import m94
+import pkg3.pkg14.m13
+from pkg2 import m715
+import pkg2.pkg12.m725
+from pkg2.pkg9.pkg37 import m498
+import pkg2.pkg10.m51
+from pkg1.pkg5.pkg23 import m106
+from . import m644
+
+
+def helper_728_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
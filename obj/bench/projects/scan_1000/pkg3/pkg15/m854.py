@@ -0,0 +1,22 @@
+"""Module 854."""
+from . import m602
+from . import m728
+import pkg1.pkg7.pkg29.m532
+from pkg4.pkg18 import m815
+import pkg2.pkg11.m94
+from pkg1 import m0
+import pkg1.pkg8.pkg35.m244
+
+
+def helper_854_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_854_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,21 @@
+"""Module 351."""
+import pkg1.m0
+from pkg1.pkg8.pkg35 import m34
+import pkg1.pkg5.m214
+from . import m15
+import pkg1.pkg7.m6
+from pkg1.pkg8.pkg34 import m75
+
+
+def helper_351_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_351_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,39 @@
+"""Module 435."""
+from . import m183
+from pkg3.pkg14 import m55
+import pkg1.m0
+from . import m225
+from . import m99
+from . import m309
+import pkg2.pkg9.pkg37.m36
+from pkg1.pkg8.pkg33 import m158
+import pkg4.pkg20.m61
+from pkg1 import m84
+
+
+def helper_435_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_435_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_435_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_435_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,16 @@
+"""Module 255."""
+from . import m45
+from pkg1 import m0
+import pkg1.pkg7.pkg31.m72
+from . import m3
+import pkg1.pkg5.pkg22.m21
+from pkg3.pkg15 import m14
+import pkg4.pkg17.m100
+from pkg2.pkg10.pkg42 import m83
+
+
+def helper_255_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
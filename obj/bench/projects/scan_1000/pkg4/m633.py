@@ -0,0 +1,18 @@
+"""Module 633."""
+from . import m45
+from . import m87
+import pkg3.pkg13.m12
+
+
+def helper_633_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_633_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
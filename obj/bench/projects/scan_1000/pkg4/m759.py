@@ -0,0 +1,12 @@
+"""Module 759."""
+from . import m339
+from pkg1 import m0
+import pkg3.pkg15.m392
+from . import m129
+
+
+def helper_759_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
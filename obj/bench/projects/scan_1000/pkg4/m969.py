@@ -0,0 +1,44 @@
+"""Module 969."""
+import pkg1.pkg6.pkg25.m24
+from pkg3.pkg15 import m14
+import pkg2.pkg9.m8
+from pkg2.pkg9.pkg38 import m709
+import pkg1.m0
+from pkg2.pkg9.pkg40 import m207
+import pkg2.pkg9.pkg40.m39
+from . import m171
+
+
+def helper_969_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_969_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_969_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_969_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_969_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
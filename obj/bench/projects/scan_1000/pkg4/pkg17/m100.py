@@ -0,0 +1,36 @@
+"""Module 100."""
+from . import m16
+from pkg1 import m0
+import pkg4.pkg19.m18
+from . import m58
+import pkg2.m1
+from pkg1.pkg6.pkg28 import m69
+import pkg1.pkg7.m6
+
+
+def helper_100_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_100_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_100_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_100_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
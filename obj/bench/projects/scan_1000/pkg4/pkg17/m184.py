@@ -0,0 +1,32 @@
+"""Module 184."""
+import pkg1.pkg7.pkg32.m31
+from . import m16
+import pkg4.pkg18.m17
+from pkg1.pkg7.pkg31 import m156
+from . import m58
+from pkg1.pkg6 import m5
+import pkg4.m3
+from pkg1.pkg5.pkg22 import m21
+from . import m142
+from pkg2.pkg11 import m52
+
+
+def helper_184_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_184_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_184_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,31 @@
+"""Module 856."""
+import pkg1.m0
+from pkg1.pkg8.pkg35 import m622
+from . import m688
+from pkg3.pkg16 import m57
+from . import m100
+from . import m142
+import pkg1.pkg8.m7
+from . import m352
+from . import m520
+
+
+def helper_856_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_856_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_856_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,12 @@
+"""Module 143."""
+import pkg1.m0
+from pkg2 import m127
+from . import m17
+from pkg1.pkg5.pkg21 import m104
+
+
+def helper_143_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 185."""
+import pkg2.pkg12.m137
+from pkg1 import m42
+import pkg2.pkg10.pkg41.m82
+
+
+def helper_185_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_185_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
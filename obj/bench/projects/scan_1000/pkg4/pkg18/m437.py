@@ -0,0 +1,32 @@
+"""Module 437."""
+import pkg1.pkg6.pkg27.m278
+from . import m101
+import pkg1.pkg5.pkg21.m104
+from pkg1.pkg7.pkg31 import m72
+from . import m185
+from pkg4.pkg19 import m354
+import pkg4.pkg20.m145
+from pkg2.pkg11 import m10
+import pkg1.pkg8.m133
+from pkg4 import m3
+
+
+def helper_437_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_437_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_437_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,39 @@
+"""Module 521."""
+import pkg1.pkg7.pkg30.m113
+from pkg1.pkg8.pkg34 import m75
+from . import m269
+from . import m395
+import pkg1.pkg6.m467
+from pkg1.pkg7.pkg29 import m448
+import pkg2.pkg10.pkg41.m166
+from pkg2.pkg9 import m470
+from . import m437
+from pkg1.pkg5.pkg22 import m21
+
+
+def helper_521_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_521_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_521_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_521_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,40 @@
+"""Module 648."""
+import pkg1.pkg5.pkg24.m23
+from pkg1.pkg8 import m49
+import pkg3.pkg14.m13
+from . import m144
+import pkg1.pkg5.m214
+from . import m312
+from . import m480
+from pkg1.pkg8.pkg36 import m623
+import pkg2.pkg9.pkg39.m38
+from pkg1.pkg5.pkg21 import m482
+import pkg2.pkg11.m346
+
+
+def helper_648_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_648_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_648_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_648_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
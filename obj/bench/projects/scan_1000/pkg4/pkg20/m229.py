@@ -0,0 +1,26 @@
+"""Module 229."""
+import pkg1.m0
+from pkg3 import m2
+import pkg1.pkg5.pkg23.m148
+from . import m19
+import pkg1.pkg7.pkg31.m30
+from pkg3.pkg15 import m14
+import pkg1.pkg6.pkg28.m27
+from . import m145
+from . import m187
+from pkg2.pkg12 import m53
+import pkg3.pkg13.m138
+
+
+def helper_229_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_229_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
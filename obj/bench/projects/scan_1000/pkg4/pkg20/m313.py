@@ -0,0 +1,28 @@
+"""Module 313."""
+import pkg3.pkg15.m56
+from pkg2.pkg11 import m10
+from . import m103
+from pkg1 import m0
+from . import m271
+from pkg1.pkg8.pkg33 import m158
+
+
+def helper_313_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_313_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_313_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
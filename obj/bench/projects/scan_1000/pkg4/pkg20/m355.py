@@ -0,0 +1,18 @@
+"""Module 355."""
+from . import m229
+from pkg1.pkg7.pkg31 import m72
+import pkg4.pkg17.m184
+from pkg1.pkg5.pkg22 import m231
+import pkg1.m0
+from pkg4.pkg18 import m59
+import pkg2.pkg10.m9
+from pkg2.pkg12 import m137
+import pkg4.pkg19.m60
+from . import m145
+
+
+def helper_355_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
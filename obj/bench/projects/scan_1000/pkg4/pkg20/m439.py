@@ -0,0 +1,15 @@
+"""Module 439."""
+import pkg1.m0
+from pkg1.pkg7.pkg30 import m71
+import pkg2.m1
+from pkg1.pkg5.pkg24 import m107
+from . import m271
+from pkg4 import m339
+import pkg1.pkg6.pkg26.m151
+
+
+def helper_439_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
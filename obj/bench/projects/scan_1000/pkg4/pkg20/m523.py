@@ -0,0 +1,38 @@
+"""Module 523."""
+import pkg1.pkg5.pkg24.m23
+from . import m61
+import pkg2.pkg10.pkg41.m250
+from . import m103
+import pkg4.m45
+from pkg3 import m86
+from . import m19
+from pkg1.pkg6 import m131
+import pkg4.m213
+
+
+def helper_523_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_523_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_523_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_523_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
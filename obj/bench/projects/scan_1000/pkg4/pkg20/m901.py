@@ -0,0 +1,33 @@
+"""Module 901."""
+import pkg1.pkg6.m509
+from . import m733
+import pkg2.pkg11.m10
+from pkg4 import m3
+import pkg1.pkg5.pkg21.m146
+from pkg1.pkg6 import m5
+import pkg2.pkg10.m681
+from pkg2.pkg9.pkg38 import m373
+import pkg1.pkg7.pkg31.m198
+from . import m607
+import pkg1.pkg5.pkg23.m22
+
+
+def helper_901_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_901_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_901_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
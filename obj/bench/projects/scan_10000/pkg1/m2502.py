@@ -0,0 +1,37 @@
+"""Module 2502."""
+import pkg4.pkg33.pkg271.m1521
+from . import m1668
+from . import m1251
+from pkg4.pkg35.pkg287 import m1537
+import pkg2.pkg19.pkg154.m570
+from pkg5.pkg45.pkg365 import m364
+import pkg6.pkg50.pkg403.m402
+from pkg3.pkg25.pkg202 import m1452
+
+
+def helper_2502_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2502_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2502_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2502_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
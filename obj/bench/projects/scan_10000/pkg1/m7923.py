@@ -0,0 +1,27 @@
+"""Module 7923."""
+import pkg3.pkg32.pkg261.m3596
+from pkg1.pkg10.pkg83 import m82
+import pkg3.pkg30.pkg245.m244
+from pkg3.pkg29.pkg239 import m5659
+import pkg4.pkg38.pkg311.m6565
+from pkg2.pkg22.pkg179 import m178
+import pkg3.pkg28.pkg229.m1062
+from pkg1.pkg11.pkg95 import m1345
+import pkg5.pkg47.m5050
+from pkg2.pkg21.pkg176 import m592
+from . import m3336
+from pkg8.pkg69 import m68
+
+
+def helper_7923_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7923_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
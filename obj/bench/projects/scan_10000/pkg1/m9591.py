@@ -0,0 +1,35 @@
+"""Module 9591."""
+import pkg4.pkg40.pkg325.m2409
+from . import m9174
+import pkg1.pkg13.m5850
+from pkg3.pkg32 import m1699
+import pkg2.pkg17.pkg141.m2642
+from pkg4.pkg35 import m2536
+
+
+def helper_9591_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9591_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9591_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9591_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,34 @@
+"""Module 3345."""
+import pkg2.m1
+from pkg4.pkg35.pkg284 import m700
+import pkg1.m0
+from pkg3.pkg25 import m2526
+import pkg2.pkg23.m22
+from pkg4.pkg39 import m2540
+import pkg5.pkg46.m45
+from pkg7.pkg58 import m891
+import pkg7.pkg63.m896
+from pkg8.pkg72 import m71
+import pkg3.pkg30.m29
+from . import m426
+
+
+def helper_3345_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3345_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3345_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
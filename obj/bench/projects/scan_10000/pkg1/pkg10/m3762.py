@@ -0,0 +1,17 @@
+"""Module 3762."""
+import pkg6.pkg55.m888
+from pkg2.pkg19.pkg158 import m1408
+
+
+def helper_3762_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3762_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
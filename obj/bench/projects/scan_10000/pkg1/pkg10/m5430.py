@@ -0,0 +1,12 @@
+"""Module 5430."""
+from . import m3345
+from . import m3762
+from . import m1260
+from pkg8.pkg67 import m66
+import pkg1.pkg15.pkg124.m2625
+from pkg5.pkg41.pkg331 import m1581
+import pkg2.pkg20.pkg164.m580
+from pkg1 import m0
+import pkg4.m3
+from pkg5.pkg48.pkg389 import m1222
+from . import m5013
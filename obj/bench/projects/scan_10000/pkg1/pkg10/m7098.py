@@ -0,0 +1,19 @@
+"""Module 7098."""
+import pkg2.pkg19.m18
+from pkg1.pkg12 import m4598
+from . import m6681
+from pkg2.pkg20.pkg162 import m2663
+
+
+def helper_7098_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7098_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 8349."""
+import pkg1.m0
+from pkg1.pkg15.pkg123 import m122
+import pkg8.m7
+
+
+def helper_8349_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
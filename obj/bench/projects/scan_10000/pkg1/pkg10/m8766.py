@@ -0,0 +1,15 @@
+"""Module 8766."""
+import pkg4.pkg35.pkg282.m281
+from pkg4.pkg39 import m38
+import pkg2.pkg21.m20
+from pkg3.pkg29 import m28
+import pkg6.pkg50.pkg402.m4988
+from pkg3.pkg29.pkg234 import m3986
+import pkg6.pkg50.pkg407.m823
+
+
+def helper_8766_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,30 @@
+"""Module 3833."""
+from . import m914
+from pkg1.pkg16.pkg129 import m3047
+import pkg4.pkg36.m1286
+from . import m2582
+import pkg4.pkg34.pkg279.m3614
+from pkg6.pkg49.pkg399 import m815
+import pkg5.pkg43.pkg346.m3681
+from pkg1.pkg13.pkg112 import m111
+
+
+def helper_3833_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3833_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3833_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
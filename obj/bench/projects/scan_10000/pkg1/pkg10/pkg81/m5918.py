@@ -0,0 +1,12 @@
+"""Module 5918."""
+import pkg3.pkg32.pkg263.m2764
+from . import m914
+import pkg5.pkg41.pkg336.m335
+from . import m5501
+from . import m2582
+from pkg4.pkg39.pkg317 import m5320
+import pkg2.pkg18.pkg151.m2235
+from pkg5.pkg43.pkg350 import m766
+import pkg6.pkg49.pkg393.m4979
+from pkg2.pkg21.pkg175 import m174
+from . import m2165
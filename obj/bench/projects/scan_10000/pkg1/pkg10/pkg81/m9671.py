@@ -0,0 +1,19 @@
+"""Module 9671."""
+import pkg1.pkg9.m425
+from . import m80
+import pkg7.pkg63.m62
+from pkg3.pkg32 import m865
+import pkg2.pkg19.pkg157.m156
+from pkg8.pkg71 import m1738
+import pkg5.pkg45.pkg366.m1616
+from pkg2.pkg20 import m7525
+import pkg3.m2
+from pkg4 import m3
+from . import m497
+
+
+def helper_9671_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,41 @@
+"""Module 3417."""
+import pkg4.pkg33.pkg268.m1101
+from pkg2.pkg23.pkg189 import m2273
+import pkg4.pkg38.pkg307.m1974
+from pkg1.pkg14 import m13
+import pkg2.pkg20.pkg163.m162
+from pkg6.pkg49.pkg394 import m810
+import pkg3.pkg27.pkg218.m217
+from pkg3.pkg32 import m2116
+from . import m915
+from pkg2.pkg17.pkg144 import m143
+import pkg2.pkg20.pkg161.m160
+from pkg4.pkg39.pkg317 import m1567
+
+
+def helper_3417_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3417_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3417_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3417_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,21 @@
+"""Module 4668."""
+import pkg6.pkg53.m2554
+from pkg2.pkg17.pkg139 import m1806
+import pkg1.m0
+from pkg2.pkg23.pkg189 import m3107
+import pkg3.pkg26.m25
+from pkg3.pkg29.pkg240 import m239
+
+
+def helper_4668_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4668_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,28 @@
+"""Module 498."""
+import pkg1.pkg15.pkg122.m121
+from . import m81
+import pkg4.m3
+from pkg1.pkg14 import m13
+import pkg2.pkg24.m23
+from pkg8.pkg66 import m65
+
+
+def helper_498_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_498_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_498_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,47 @@
+"""Module 7170."""
+import pkg1.pkg9.pkg74.m73
+from . import m4251
+from . import m4668
+from pkg3.pkg27.pkg220 import m219
+import pkg6.pkg54.m53
+from . import m3000
+import pkg4.pkg39.pkg315.m2816
+from pkg5.pkg42.pkg344 import m343
+import pkg1.m0
+from pkg4.pkg36.pkg292 import m291
+import pkg5.pkg44.pkg358.m5361
+
+
+def helper_7170_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7170_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7170_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7170_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_7170_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
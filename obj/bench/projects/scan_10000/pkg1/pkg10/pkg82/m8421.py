@@ -0,0 +1,3 @@
+"""Module 8421."""
+import pkg1.pkg14.pkg116.m5953
+from pkg1.pkg15.pkg126 import m125
@@ -0,0 +1,33 @@
+"""Module 915."""
+import pkg8.pkg72.m71
+from . import m498
+import pkg4.pkg33.pkg268.m684
+from pkg1.pkg14.pkg117 import m533
+import pkg5.m4
+from pkg1.pkg16.pkg134 import m550
+import pkg6.m5
+from pkg6.pkg49.pkg399 import m815
+from . import m81
+from pkg1 import m0
+import pkg1.pkg16.pkg135.m134
+
+
+def helper_915_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_915_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_915_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,37 @@
+"""Module 9255."""
+import pkg4.pkg33.pkg265.m4017
+from pkg3.pkg25.pkg206 import m1873
+import pkg6.pkg51.pkg409.m7914
+from pkg5.pkg47.pkg378 import m9134
+import pkg3.pkg29.pkg234.m1067
+from . import m8421
+from . import m1332
+from pkg1.pkg14 import m13
+
+
+def helper_9255_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9255_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9255_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9255_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
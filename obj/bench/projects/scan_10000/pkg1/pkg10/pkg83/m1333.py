@@ -0,0 +1,17 @@
+"""Module 1333."""
+import pkg3.pkg31.m30
+from pkg1 import m0
+
+
+def helper_1333_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1333_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
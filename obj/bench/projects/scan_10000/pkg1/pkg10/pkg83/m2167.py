@@ -0,0 +1,25 @@
+"""Module 2167."""
+import pkg4.pkg33.pkg267.m266
+from pkg4.pkg40.pkg324 import m1157
+import pkg6.pkg51.m1718
+from pkg2.pkg24 import m23
+import pkg2.pkg18.m17
+from . import m499
+import pkg2.pkg21.m20
+from pkg1.pkg11 import m2095
+from . import m82
+from pkg5.pkg42.pkg342 import m758
+
+
+def helper_2167_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2167_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
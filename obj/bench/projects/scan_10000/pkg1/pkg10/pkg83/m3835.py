@@ -0,0 +1,32 @@
+"""Module 3835."""
+from . import m3001
+from pkg1.pkg12.pkg98 import m514
+import pkg2.pkg20.pkg161.m2245
+from pkg2.pkg23.pkg191 import m1024
+from . import m2584
+from pkg1 import m0
+import pkg6.pkg53.m52
+from . import m1333
+import pkg5.pkg44.m460
+from pkg7.pkg63 import m62
+
+
+def helper_3835_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3835_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3835_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
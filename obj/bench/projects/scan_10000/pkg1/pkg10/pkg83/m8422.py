@@ -0,0 +1,32 @@
+"""Module 8422."""
+from . import m1333
+from pkg2.pkg22.pkg178 import m2679
+import pkg7.pkg59.m58
+from pkg3.pkg25.pkg203 import m2287
+import pkg3.pkg30.pkg248.m247
+from pkg8 import m1258
+from . import m3001
+from . import m3835
+import pkg7.pkg60.m59
+from . import m2167
+
+
+def helper_8422_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8422_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8422_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
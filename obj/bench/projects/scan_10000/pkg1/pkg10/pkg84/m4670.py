@@ -0,0 +1,31 @@
+"""Module 4670."""
+from . import m2168
+from pkg3.pkg26.pkg214 import m213
+import pkg1.m0
+from pkg4.pkg39 import m38
+import pkg3.pkg26.m25
+from pkg7.pkg59 import m475
+import pkg3.pkg28.pkg231.m1481
+from pkg3.pkg30.pkg244 import m243
+import pkg2.pkg22.pkg182.m181
+
+
+def helper_4670_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4670_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4670_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
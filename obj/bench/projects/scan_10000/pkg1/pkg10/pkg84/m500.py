@@ -0,0 +1,37 @@
+"""Module 500."""
+import pkg2.pkg22.pkg179.m178
+from . import m83
+import pkg5.m4
+from pkg1.pkg11.pkg89 import m88
+import pkg3.pkg26.m25
+from pkg3.pkg30 import m29
+import pkg4.pkg33.pkg272.m271
+from pkg1 import m0
+
+
+def helper_500_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_500_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_500_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_500_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,28 @@
+"""Module 5087."""
+import pkg2.pkg23.pkg189.m1022
+from pkg1 import m0
+import pkg6.pkg53.m52
+from pkg1.pkg10.pkg83 import m499
+import pkg4.pkg33.pkg272.m271
+from pkg3.pkg25.pkg206 import m1039
+
+
+def helper_5087_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5087_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5087_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,23 @@
+"""Module 7589."""
+import pkg1.m0
+from pkg6.pkg52.pkg417 import m2084
+from . import m3836
+from pkg2.pkg20 import m3772
+import pkg2.pkg17.pkg140.m3475
+from pkg3.pkg31.pkg249 import m1082
+from . import m4253
+from pkg2.pkg21 import m20
+
+
+def helper_7589_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7589_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 9257."""
+import pkg3.pkg28.pkg225.m6062
+from pkg5.pkg41.pkg331 import m330
+import pkg5.pkg48.pkg390.m389
+
+
+def helper_9257_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9257_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9257_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,34 @@
+"""Module 3003."""
+import pkg4.pkg37.pkg301.m1551
+from pkg1.pkg12.pkg104 import m937
+import pkg2.pkg24.pkg199.m198
+from pkg1.pkg12 import m11
+import pkg4.m3
+
+
+def helper_3003_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3003_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3003_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3003_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
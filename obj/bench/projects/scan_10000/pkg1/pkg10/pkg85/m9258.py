@@ -0,0 +1,17 @@
+"""Module 9258."""
+import pkg2.pkg17.pkg138.m5558
+from pkg5.pkg47.pkg383 import m4135
+
+
+def helper_9258_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9258_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,59 @@
+"""Module 9675."""
+import pkg3.pkg28.pkg227.m226
+from pkg1.pkg11.pkg96 import m95
+import pkg3.pkg28.pkg227.m3979
+from pkg1.pkg11 import m10
+import pkg1.pkg9.pkg77.m76
+from pkg2.pkg19.pkg160 import m159
+import pkg2.pkg22.pkg182.m1015
+from pkg1.pkg12.pkg100 import m99
+import pkg3.pkg27.pkg223.m639
+
+
+def helper_9675_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9675_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9675_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9675_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_9675_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_9675_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9675_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,24 @@
+"""Module 2171."""
+import pkg1.pkg14.m430
+from pkg6.pkg52 import m51
+import pkg2.pkg20.pkg165.m164
+from pkg5.pkg45.pkg367 import m783
+import pkg1.m0
+from . import m86
+import pkg1.pkg13.pkg108.m941
+from pkg3.pkg25.pkg204 import m1871
+import pkg2.pkg20.m19
+
+
+def helper_2171_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2171_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 2588."""
+import pkg2.pkg17.pkg139.m138
+from pkg3.pkg28.pkg226 import m225
+from . import m1337
+from pkg1.pkg12.pkg102 import m101
+import pkg8.pkg70.m69
+from pkg2.pkg22.pkg184 import m183
+import pkg2.m1
+from pkg1.pkg15.pkg121 import m2205
+import pkg8.m7
+from pkg7.pkg57 import m56
+import pkg1.pkg10.pkg82.m498
+
+
+def helper_2588_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,35 @@
+"""Module 2172."""
+import pkg3.pkg26.pkg216.m215
+from . import m1338
+import pkg5.pkg48.pkg388.m387
+from pkg1 import m0
+import pkg3.m2
+from pkg4.pkg39 import m38
+
+
+def helper_2172_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2172_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2172_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2172_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 2589."""
+import pkg3.pkg29.pkg239.m1489
+from pkg7 import m6
+import pkg4.pkg34.m33
+from pkg1.pkg9.pkg77 import m493
+import pkg1.m0
+from pkg1.pkg9.pkg78 import m77
+import pkg5.pkg47.pkg377.m1627
+from pkg3.pkg32.pkg257 import m256
+import pkg7.pkg61.m60
+from pkg1.pkg12.pkg101 import m2185
+
+
+def helper_2589_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2589_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 87."""
+import pkg3.pkg32.m31
+from pkg4.pkg40 import m39
+import pkg1.pkg15.m14
+from pkg1 import m0
+import pkg5.m4
+from pkg8 import m7
+import pkg1.pkg9.m8
+from pkg1.pkg14 import m13
+import pkg7.pkg62.m61
+from pkg3 import m2
+import pkg6.pkg52.m51
+
+
+def helper_87_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,54 @@
+"""Module 7933."""
+import pkg5.pkg42.pkg339.m338
+from pkg6.pkg54 import m53
+import pkg2.pkg20.pkg168.m167
+from pkg2.pkg19.pkg159 import m1409
+import pkg2.m1
+from pkg1.pkg11.pkg96 import m929
+import pkg1.pkg13.pkg108.m524
+from pkg2.pkg20.pkg166 import m2667
+import pkg1.pkg16.pkg132.m965
+from pkg2.pkg24.pkg199 import m615
+import pkg1.pkg14.pkg116.m6370
+
+
+def helper_7933_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7933_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7933_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7933_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_7933_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_7933_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,40 @@
+"""Module 9601."""
+import pkg1.m417
+from . import m3346
+import pkg4.pkg38.pkg306.m4475
+from pkg8.pkg71 import m1738
+import pkg6.m5
+from pkg1.pkg15.pkg126 import m125
+import pkg6.pkg54.m2138
+from . import m7516
+import pkg4.pkg36.pkg293.m1543
+from pkg6.pkg51.pkg414 import m2081
+import pkg2.pkg17.pkg138.m7643
+
+
+def helper_9601_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9601_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9601_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9601_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 5509."""
+import pkg3.pkg31.pkg256.m4008
+from pkg4.pkg33.pkg265 import m264
+import pkg5.pkg47.pkg382.m381
+from . import m2173
+from . import m1756
+from . import m2590
+import pkg5.pkg47.pkg384.m2468
+from pkg3.pkg25 import m24
+import pkg1.pkg9.m8
+from pkg5.pkg48.pkg389 import m805
+import pkg2.pkg17.pkg144.m143
+
+
+def helper_5509_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5509_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,13 @@
+"""Module 5926."""
+import pkg4.pkg39.m2123
+from pkg6.pkg50.pkg408 import m1241
+from . import m3007
+from pkg1.pkg10.pkg88 import m87
+import pkg2.pkg17.pkg137.m553
+
+
+def helper_5926_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
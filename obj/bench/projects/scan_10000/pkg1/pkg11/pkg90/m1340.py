@@ -0,0 +1,22 @@
+"""Module 1340."""
+import pkg6.pkg52.m51
+from pkg3.pkg30.pkg245 import m244
+import pkg4.pkg40.m39
+from . import m506
+import pkg5.pkg47.m46
+from pkg2.pkg24.pkg194 import m193
+from . import m89
+
+
+def helper_1340_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1340_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,46 @@
+"""Module 2174."""
+import pkg4.m3
+from pkg5.pkg48 import m47
+import pkg3.pkg26.pkg209.m208
+from pkg4.pkg38 import m37
+import pkg2.pkg17.m16
+from . import m506
+import pkg3.pkg29.pkg239.m238
+from pkg2.pkg22 import m21
+import pkg4.pkg33.m449
+from pkg4.pkg39.pkg313 import m1563
+
+
+def helper_2174_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2174_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2174_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2174_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_2174_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
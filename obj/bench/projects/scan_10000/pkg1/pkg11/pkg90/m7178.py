@@ -0,0 +1,27 @@
+"""Module 7178."""
+import pkg3.pkg32.pkg259.m2343
+from pkg5.pkg42 import m458
+import pkg4.pkg36.m35
+from pkg1.pkg12.pkg100 import m5937
+import pkg6.pkg49.pkg399.m1649
+
+
+def helper_7178_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7178_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7178_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
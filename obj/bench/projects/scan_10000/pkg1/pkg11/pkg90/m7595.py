@@ -0,0 +1,10 @@
+"""Module 7595."""
+from . import m4676
+from pkg2.pkg23.pkg192 import m6029
+import pkg3.pkg25.pkg201.m617
+from pkg3.pkg30.pkg241 import m5244
+import pkg8.pkg67.m5904
+from pkg5.pkg44.pkg360 import m776
+import pkg5.pkg42.pkg340.m1173
+from pkg5.pkg42.pkg338 import m2005
+from . import m89
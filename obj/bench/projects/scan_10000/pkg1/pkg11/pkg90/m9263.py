@@ -0,0 +1,35 @@
+"""Module 9263."""
+from . import m923
+from pkg1.pkg13.pkg108 import m2609
+import pkg3.pkg25.pkg205.m8127
+from . import m4259
+import pkg2.pkg20.pkg163.m1413
+from pkg5.pkg44.pkg359 import m7030
+
+
+def helper_9263_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9263_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9263_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9263_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
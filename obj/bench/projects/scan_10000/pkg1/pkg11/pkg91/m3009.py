@@ -0,0 +1,36 @@
+"""Module 3009."""
+import pkg5.pkg45.m461
+from pkg7.pkg60 import m59
+import pkg3.pkg25.pkg208.m207
+from pkg3.pkg31.pkg251 import m2752
+import pkg6.pkg51.m467
+from pkg1.pkg9.pkg76 import m1743
+import pkg5.pkg47.m2131
+
+
+def helper_3009_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3009_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3009_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3009_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
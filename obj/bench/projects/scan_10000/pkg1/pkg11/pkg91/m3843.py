@@ -0,0 +1,26 @@
+"""Module 3843."""
+import pkg4.pkg38.pkg305.m1138
+from pkg2 import m1
+import pkg1.pkg12.pkg100.m933
+from pkg5.pkg42.pkg340 import m1590
+
+
+def helper_3843_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3843_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3843_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
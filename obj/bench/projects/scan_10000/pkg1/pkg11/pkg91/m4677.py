@@ -0,0 +1,12 @@
+"""Module 4677."""
+import pkg2.pkg21.m20
+from pkg7.pkg62 import m61
+import pkg2.pkg24.m440
+from pkg4.pkg39.pkg315 import m314
+
+
+def helper_4677_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,38 @@
+"""Module 507."""
+import pkg2.pkg21.pkg169.m168
+from pkg2.pkg24 import m23
+import pkg2.pkg22.pkg178.m177
+from pkg2.pkg18 import m17
+import pkg5.pkg41.pkg336.m335
+from pkg1.pkg9 import m8
+import pkg2.pkg24.pkg197.m196
+from pkg1.pkg10 import m9
+from . import m90
+
+
+def helper_507_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_507_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_507_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_507_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,36 @@
+"""Module 7179."""
+import pkg1.pkg15.m14
+from pkg7 import m6
+from . import m5511
+from pkg6.pkg49.pkg400 import m4986
+import pkg5.pkg46.pkg373.m5376
+from pkg6.pkg49.pkg397 import m5400
+import pkg3.pkg32.pkg261.m4847
+
+
+def helper_7179_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7179_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7179_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7179_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
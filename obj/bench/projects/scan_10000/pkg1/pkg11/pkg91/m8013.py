@@ -0,0 +1,29 @@
+"""Module 8013."""
+from . import m6345
+from . import m7596
+from . import m2592
+from pkg6.pkg49.pkg397 import m1647
+from . import m6762
+from pkg4.pkg33.pkg265 import m7770
+import pkg3.pkg26.pkg210.m209
+
+
+def helper_8013_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8013_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8013_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
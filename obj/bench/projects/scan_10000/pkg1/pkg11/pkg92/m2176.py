@@ -0,0 +1,39 @@
+"""Module 2176."""
+import pkg4.pkg33.pkg270.m1103
+from pkg1 import m0
+from . import m91
+from . import m1759
+from . import m508
+from . import m1342
+import pkg2.pkg19.m18
+from pkg6.pkg50.pkg402 import m2069
+from . import m925
+from pkg4.pkg37.pkg304 import m303
+
+
+def helper_2176_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2176_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2176_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2176_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 2593."""
+import pkg1.pkg9.pkg73.m72
+from pkg6.pkg49.pkg400 import m816
+import pkg4.pkg40.pkg322.m321
+
+
+def helper_2593_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2593_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,13 @@
+"""Module 6346."""
+from . import m3427
+from pkg3.pkg26.pkg212 import m211
+import pkg5.pkg43.pkg345.m344
+from pkg6.pkg51 import m5888
+import pkg4.pkg35.pkg281.m1531
+
+
+def helper_6346_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
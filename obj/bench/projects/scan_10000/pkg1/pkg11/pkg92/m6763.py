@@ -0,0 +1,21 @@
+"""Module 6763."""
+import pkg4.pkg36.pkg292.m708
+from pkg1 import m0
+import pkg4.pkg39.m5459
+from pkg5.pkg43.pkg346 import m345
+import pkg2.pkg19.pkg156.m5159
+from pkg4.pkg34.pkg279 import m6533
+
+
+def helper_6763_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6763_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
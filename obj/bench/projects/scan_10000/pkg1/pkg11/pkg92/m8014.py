@@ -0,0 +1,22 @@
+"""Module 8014."""
+from . import m5095
+from . import m1342
+from . import m4261
+from pkg4.pkg35.pkg288 import m7376
+import pkg2.pkg18.pkg151.m3486
+from . import m2593
+import pkg4.m3
+
+
+def helper_8014_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8014_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
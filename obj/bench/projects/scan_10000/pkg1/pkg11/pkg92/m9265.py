@@ -0,0 +1,37 @@
+"""Module 9265."""
+import pkg7.m2508
+from pkg1.pkg15.pkg128 import m127
+from . import m7180
+from . import m2593
+import pkg7.pkg57.m1307
+from pkg1.pkg14.pkg119 import m118
+from . import m2176
+from pkg5.pkg46.pkg369 import m2453
+
+
+def helper_9265_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9265_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9265_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9265_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
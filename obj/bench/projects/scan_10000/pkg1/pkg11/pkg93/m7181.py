@@ -0,0 +1,34 @@
+"""Module 7181."""
+from . import m4262
+from pkg3.pkg27 import m1277
+import pkg6.pkg50.pkg403.m3321
+from pkg2.pkg21.pkg176 import m175
+import pkg4.pkg39.pkg317.m6154
+
+
+def helper_7181_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7181_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7181_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7181_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
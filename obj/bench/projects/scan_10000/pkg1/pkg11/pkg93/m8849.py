@@ -0,0 +1,45 @@
+"""Module 8849."""
+import pkg2.pkg21.pkg176.m2260
+from pkg1.pkg10.pkg86 import m3004
+from . import m6764
+from pkg5.pkg42.pkg344 import m1177
+import pkg3.pkg27.pkg218.m217
+from pkg2.pkg22 import m21
+from . import m1343
+from . import m2594
+import pkg7.pkg57.m890
+
+
+def helper_8849_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8849_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8849_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8849_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_8849_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,16 @@
+"""Module 926."""
+from . import m509
+from pkg2.pkg18.pkg149 import m148
+import pkg3.pkg26.pkg214.m630
+from pkg1.pkg11.pkg95 import m511
+import pkg4.pkg37.m870
+from pkg8.pkg72 import m71
+import pkg2.pkg22.m21
+from pkg5.pkg44.pkg358 import m774
+
+
+def helper_926_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
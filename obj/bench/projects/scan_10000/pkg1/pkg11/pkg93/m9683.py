@@ -0,0 +1,36 @@
+"""Module 9683."""
+import pkg4.pkg33.pkg266.m1099
+from . import m92
+import pkg3.pkg28.pkg232.m7737
+from . import m5096
+import pkg6.pkg51.pkg416.m1249
+from pkg6.pkg51.pkg409 import m1242
+import pkg4.pkg38.pkg306.m722
+
+
+def helper_9683_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9683_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9683_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9683_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
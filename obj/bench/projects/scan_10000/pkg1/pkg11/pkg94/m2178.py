@@ -0,0 +1,26 @@
+"""Module 2178."""
+import pkg2.pkg22.pkg177.m593
+from pkg1.pkg9.pkg73 import m489
+import pkg6.m5
+from pkg6.pkg51.pkg415 import m414
+from . import m93
+from pkg2.pkg19.pkg154 import m570
+import pkg2.pkg23.m22
+from . import m1761
+import pkg1.pkg13.m12
+from pkg5 import m838
+import pkg1.pkg10.m9
+
+
+def helper_2178_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2178_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
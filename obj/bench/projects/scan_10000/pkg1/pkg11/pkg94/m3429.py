@@ -0,0 +1,39 @@
+"""Module 3429."""
+from . import m2178
+from pkg3.pkg28.pkg231 import m647
+import pkg2.pkg19.pkg155.m571
+from pkg6.pkg49.pkg394 import m3312
+import pkg8.pkg71.m2155
+from . import m1761
+import pkg2.pkg23.pkg190.m1857
+from . import m3012
+import pkg5.pkg47.m46
+from pkg4.pkg37.pkg298 import m2799
+
+
+def helper_3429_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3429_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3429_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3429_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
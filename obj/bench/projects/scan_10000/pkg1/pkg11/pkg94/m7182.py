@@ -0,0 +1,18 @@
+"""Module 7182."""
+import pkg1.pkg14.pkg117.m950
+from pkg5.pkg46.pkg376 import m375
+from . import m927
+from pkg5.pkg45.pkg362 import m4948
+import pkg4.pkg37.m36
+from pkg2.pkg19.pkg154 import m5991
+import pkg1.m0
+from . import m6348
+import pkg5.pkg43.pkg349.m4518
+from . import m2595
+
+
+def helper_7182_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
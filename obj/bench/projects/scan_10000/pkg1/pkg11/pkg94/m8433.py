@@ -0,0 +1,36 @@
+"""Module 8433."""
+from . import m927
+from pkg2.pkg20.pkg167 import m5170
+import pkg3.pkg26.pkg211.m1461
+from pkg8.pkg71 import m70
+from . import m93
+from pkg5.pkg47.pkg378 import m4547
+import pkg3.pkg25.m24
+
+
+def helper_8433_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8433_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8433_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8433_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,22 @@
+"""Module 1762."""
+import pkg6.pkg50.pkg405.m1655
+from pkg3.pkg27.pkg220 import m1053
+from . import m1345
+from . import m511
+from . import m94
+from pkg2 import m1
+import pkg3.pkg30.pkg245.m244
+
+
+def helper_1762_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1762_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
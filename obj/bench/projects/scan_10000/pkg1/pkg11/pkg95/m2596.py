@@ -0,0 +1,36 @@
+"""Module 2596."""
+import pkg5.pkg48.pkg385.m801
+from pkg5.pkg44.pkg354 import m1187
+import pkg5.pkg45.m44
+from pkg4.pkg34 import m2118
+import pkg3.pkg29.pkg234.m650
+from pkg1.pkg9.pkg78 import m1328
+import pkg4.pkg38.m37
+
+
+def helper_2596_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2596_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2596_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2596_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
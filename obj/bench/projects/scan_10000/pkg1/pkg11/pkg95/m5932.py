@@ -0,0 +1,30 @@
+"""Module 5932."""
+import pkg4.pkg36.pkg295.m4464
+from pkg1.pkg10.pkg88 import m504
+import pkg3.pkg30.pkg241.m5244
+from pkg1.pkg10 import m9
+from . import m94
+from pkg2.pkg17.pkg138 import m971
+import pkg6.pkg55.m1305
+from . import m2596
+
+
+def helper_5932_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5932_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5932_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
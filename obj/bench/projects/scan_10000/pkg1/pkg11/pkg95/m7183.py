@@ -0,0 +1,60 @@
+"""Module 7183."""
+import pkg1.pkg13.pkg108.m107
+from pkg4.pkg35.pkg283 import m282
+import pkg7.pkg61.m4647
+from pkg1 import m0
+import pkg5.pkg47.pkg380.m4966
+from pkg5.pkg42.pkg337 import m1587
+import pkg7.pkg61.m60
+from pkg3.pkg25.pkg205 import m2706
+import pkg4.pkg35.pkg287.m703
+from pkg2.pkg20.pkg167 import m1834
+
+
+def helper_7183_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7183_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7183_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7183_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_7183_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_7183_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7183_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 8017."""
+import pkg1.pkg14.pkg119.m7624
+from . import m94
+from . import m3013
+from pkg2.pkg20.pkg167 import m1834
+import pkg2.pkg19.pkg155.m154
+from . import m1762
+import pkg5.pkg48.pkg387.m2471
+from . import m2596
+import pkg5.pkg46.pkg372.m2456
+
+
+def helper_8017_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 928."""
+import pkg1.m0
+from pkg3.pkg29.pkg237 import m236
+from . import m511
+
+
+def helper_928_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_928_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 1346."""
+import pkg1.pkg10.pkg86.m919
+from pkg1.pkg16.pkg131 import m130
+import pkg2.pkg24.pkg199.m198
+from pkg5.pkg41 import m40
+from . import m512
+from pkg7.pkg59 import m58
+import pkg3.pkg31.pkg255.m254
+from pkg2 import m1
+import pkg1.pkg10.pkg81.m80
+
+
+def helper_1346_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
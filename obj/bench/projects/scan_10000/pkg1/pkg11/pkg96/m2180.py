@@ -0,0 +1,54 @@
+"""Module 2180."""
+import pkg1.m0
+from pkg8.pkg66 import m2150
+import pkg5.m4
+from pkg3.pkg32 import m31
+import pkg2.pkg19.m18
+from pkg7.pkg60 import m59
+import pkg2.pkg21.pkg171.m1421
+from pkg5.pkg47 import m46
+from . import m1346
+from pkg1.pkg12 import m11
+import pkg8.pkg69.m68
+
+
+def helper_2180_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2180_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2180_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2180_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_2180_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_2180_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
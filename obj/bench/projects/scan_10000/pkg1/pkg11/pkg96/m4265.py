@@ -0,0 +1,20 @@
+"""Module 4265."""
+import pkg5.pkg41.m40
+from pkg3.pkg30.pkg247 import m1497
+import pkg1.pkg13.pkg109.m525
+from pkg2.pkg20.pkg167 import m1000
+import pkg1.pkg16.m3351
+from pkg2.pkg21.pkg170 import m3505
+import pkg1.pkg9.pkg77.m2578
+from pkg1.pkg15 import m2099
+import pkg2.pkg22.pkg180.m596
+from pkg3.pkg30.pkg247 import m246
+import pkg3.pkg29.pkg236.m235
+from . import m2597
+
+
+def helper_4265_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
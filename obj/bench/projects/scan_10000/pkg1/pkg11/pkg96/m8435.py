@@ -0,0 +1,26 @@
+"""Module 8435."""
+import pkg2.pkg18.pkg152.m151
+from pkg1.pkg15.pkg122 import m121
+from . import m5933
+from pkg1.pkg11 import m10
+import pkg5.pkg45.pkg367.m366
+from pkg2.pkg24 import m23
+from . import m8018
+from pkg4.pkg38.pkg305 import m1138
+import pkg3.pkg29.pkg233.m232
+from pkg2.pkg18.pkg145 import m978
+import pkg3.pkg31.m30
+
+
+def helper_8435_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8435_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,37 @@
+"""Module 929."""
+import pkg1.m0
+from pkg1.pkg13.pkg109 import m108
+import pkg7.pkg63.m479
+from pkg1.pkg14.pkg116 import m115
+import pkg1.pkg10.pkg85.m84
+from pkg4.pkg35.pkg285 import m701
+import pkg5.pkg43.pkg347.m763
+from pkg6 import m5
+
+
+def helper_929_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_929_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_929_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_929_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 3347."""
+import pkg6.pkg51.m50
+from . import m11
+import pkg2.pkg19.pkg154.m2655
+
+
+def helper_3347_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,46 @@
+"""Module 4598."""
+import pkg5.pkg42.m1292
+from pkg5.pkg46.pkg375 import m4544
+import pkg6.m5
+from pkg5.pkg45.pkg363 import m779
+import pkg2.pkg24.pkg199.m615
+from pkg1 import m0
+import pkg5.pkg43.pkg349.m2016
+from . import m1679
+import pkg2.m1
+from pkg4 import m3
+
+
+def helper_4598_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4598_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4598_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4598_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_4598_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
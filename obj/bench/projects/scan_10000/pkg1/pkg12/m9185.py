@@ -0,0 +1,5 @@
+"""Module 9185."""
+from . import m1679
+from pkg2.pkg23.pkg186 import m6440
+import pkg5.pkg41.pkg330.m4916
+from pkg4.pkg34.pkg274 import m6528
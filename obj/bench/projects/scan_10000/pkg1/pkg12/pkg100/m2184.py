@@ -0,0 +1,21 @@
+"""Module 2184."""
+import pkg3.pkg28.m27
+from pkg3.pkg26.pkg211 import m210
+import pkg2.pkg21.pkg174.m1007
+from pkg8.pkg67 import m483
+import pkg1.pkg10.pkg88.m504
+from pkg5.pkg46.pkg374 import m790
+
+
+def helper_2184_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2184_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,14 @@
+"""Module 3018."""
+import pkg1.pkg11.m10
+from pkg5 import m4
+import pkg3.pkg27.pkg223.m222
+from pkg7.pkg57 import m56
+import pkg4.pkg35.m2536
+from pkg4.pkg36.pkg296 import m1129
+
+
+def helper_3018_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
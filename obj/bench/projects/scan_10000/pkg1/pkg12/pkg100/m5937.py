@@ -0,0 +1,13 @@
+"""Module 5937."""
+from . import m1350
+from pkg5.pkg47.pkg381 import m797
+import pkg2.pkg20.pkg167.m1000
+from pkg1 import m0
+import pkg4.pkg36.pkg291.m5294
+
+
+def helper_5937_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
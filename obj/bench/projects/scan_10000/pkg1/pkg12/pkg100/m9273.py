@@ -0,0 +1,18 @@
+"""Module 9273."""
+import pkg3.pkg28.m2529
+from . import m6771
+import pkg3.pkg27.pkg224.m6061
+from pkg4.pkg38.pkg312 import m311
+from . import m3852
+from pkg5.pkg42.pkg344 import m2845
+import pkg1.m0
+from pkg6.pkg49.pkg400 import m2067
+import pkg1.pkg15.m14
+from pkg2.pkg23 import m856
+
+
+def helper_9273_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
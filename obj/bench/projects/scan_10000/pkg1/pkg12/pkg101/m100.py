@@ -0,0 +1,28 @@
+"""Module 100."""
+import pkg4.pkg39.m38
+from pkg1 import m0
+import pkg2.pkg19.m18
+from pkg2 import m1
+import pkg8.pkg70.m69
+from pkg7 import m6
+
+
+def helper_100_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_100_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_100_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,35 @@
+"""Module 4270."""
+import pkg2.pkg21.pkg175.m1008
+from pkg3.pkg27.pkg217 import m633
+import pkg1.pkg16.pkg130.m963
+from pkg4.pkg36.pkg294 import m3629
+from . import m934
+from pkg2.pkg23.pkg191 import m1441
+
+
+def helper_4270_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4270_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4270_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4270_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,69 @@
+"""Module 4687."""
+import pkg2.pkg19.pkg153.m1403
+from pkg2.pkg24.pkg198 import m197
+import pkg1.pkg16.pkg129.m2630
+from . import m4270
+import pkg4.pkg35.pkg284.m283
+from pkg5.pkg47.pkg380 import m796
+import pkg5.pkg46.m45
+from pkg5.pkg47.pkg378 import m2462
+import pkg8.pkg69.m68
+from pkg1.pkg10.pkg86 import m2587
+import pkg2.pkg23.pkg189.m188
+from pkg4.pkg38 import m37
+
+
+def helper_4687_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4687_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4687_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4687_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_4687_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_4687_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4687_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4687_42(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 6355."""
+import pkg2.pkg20.pkg164.m163
+from pkg3.pkg26 import m25
+import pkg2.pkg23.pkg188.m187
+from . import m5521
+
+
+def helper_6355_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6355_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 7606."""
+import pkg3.pkg31.pkg255.m254
+from . import m6772
+import pkg5.pkg41.pkg335.m1585
+from pkg2.pkg20.pkg165 import m998
+
+
+def helper_7606_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7606_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7606_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
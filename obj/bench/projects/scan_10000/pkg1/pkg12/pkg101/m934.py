@@ -0,0 +1,15 @@
+"""Module 934."""
+import pkg5.pkg44.m43
+from pkg4.pkg35.pkg285 import m284
+import pkg5.m4
+from pkg2.pkg20.pkg163 import m579
+import pkg1.m0
+from pkg2.pkg23.pkg188 import m187
+import pkg5.pkg48.pkg389.m805
+
+
+def helper_934_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
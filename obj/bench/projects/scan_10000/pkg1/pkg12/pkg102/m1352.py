@@ -0,0 +1,47 @@
+"""Module 1352."""
+import pkg4.pkg40.m1290
+from pkg2.pkg19.pkg159 import m158
+import pkg1.m0
+from pkg5 import m838
+from . import m935
+from pkg3.pkg26 import m25
+from . import m518
+from pkg2.pkg22.pkg183 import m599
+import pkg1.pkg10.pkg81.m80
+from pkg5.pkg48.pkg385 import m384
+import pkg1.pkg15.pkg126.m125
+
+
+def helper_1352_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1352_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1352_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1352_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_1352_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
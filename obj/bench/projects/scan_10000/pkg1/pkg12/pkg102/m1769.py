@@ -0,0 +1,26 @@
+"""Module 1769."""
+import pkg6.pkg51.pkg410.m826
+from pkg3.pkg32.pkg259 import m1092
+import pkg2.pkg17.pkg138.m554
+from pkg2 import m418
+import pkg1.pkg14.pkg116.m115
+from pkg7.pkg64 import m63
+import pkg2.pkg17.m433
+from pkg2.pkg22.pkg178 import m177
+import pkg5.pkg43.pkg348.m764
+from pkg1 import m0
+import pkg3.pkg25.pkg206.m205
+
+
+def helper_1769_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1769_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,21 @@
+"""Module 4688."""
+from . import m1769
+from pkg6.pkg50 import m49
+import pkg7.m6
+from pkg1.pkg14.pkg113 import m112
+import pkg1.pkg11.pkg93.m2177
+from pkg2.pkg20.pkg164 import m3499
+
+
+def helper_4688_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4688_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 5522."""
+import pkg5.m4
+from pkg3.pkg32.pkg263 import m2764
+import pkg4.pkg38.pkg306.m1139
+from pkg1.pkg11.pkg94 import m93
+import pkg4.pkg39.pkg320.m4489
+
+
+def helper_5522_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5522_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5522_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,21 @@
+"""Module 8441."""
+import pkg1.pkg10.pkg83.m3418
+from . import m6773
+from . import m7607
+from pkg1.pkg16.pkg132 import m131
+from . import m4271
+from pkg3.pkg32.pkg264 import m5684
+
+
+def helper_8441_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8441_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
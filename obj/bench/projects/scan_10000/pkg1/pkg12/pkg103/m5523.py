@@ -0,0 +1,20 @@
+"""Module 5523."""
+import pkg1.m0
+from pkg5.pkg45.pkg366 import m365
+import pkg5.pkg45.pkg364.m3282
+from pkg2.pkg18 import m2102
+import pkg2.pkg21.m20
+
+
+def helper_5523_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5523_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
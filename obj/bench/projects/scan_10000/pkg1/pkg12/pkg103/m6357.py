@@ -0,0 +1,28 @@
+"""Module 6357."""
+import pkg2.pkg22.pkg181.m180
+from pkg8 import m7
+import pkg5.pkg48.m47
+from . import m5940
+import pkg5.pkg46.pkg373.m3291
+from pkg2.pkg21.pkg173 import m589
+
+
+def helper_6357_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6357_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6357_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
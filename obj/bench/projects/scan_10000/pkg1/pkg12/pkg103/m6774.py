@@ -0,0 +1,45 @@
+"""Module 6774."""
+import pkg4.pkg40.pkg328.m1995
+from pkg1.pkg10.pkg84 import m83
+from . import m3855
+from pkg2.pkg23 import m22
+import pkg4.pkg35.pkg282.m6536
+from pkg5.pkg44.pkg357 import m1607
+from . import m5523
+from pkg1.pkg10 import m9
+import pkg1.pkg9.pkg80.m79
+
+
+def helper_6774_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6774_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6774_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6774_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_6774_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
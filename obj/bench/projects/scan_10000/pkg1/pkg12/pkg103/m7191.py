@@ -0,0 +1,15 @@
+"""Module 7191."""
+import pkg4.pkg38.pkg311.m1144
+from pkg2.pkg17.pkg139 import m555
+import pkg8.pkg67.m66
+from . import m102
+import pkg5.pkg47.pkg379.m378
+from pkg7.pkg60 import m59
+import pkg4.pkg34.pkg273.m272
+
+
+def helper_7191_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,44 @@
+"""Module 8442."""
+from . import m2187
+from pkg5.pkg41.pkg334 import m1167
+from . import m6357
+from . import m5523
+import pkg1.pkg9.pkg76.m8415
+from pkg2.pkg20.pkg167 import m3919
+import pkg2.pkg17.pkg139.m5142
+from . import m519
+
+
+def helper_8442_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8442_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8442_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8442_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_8442_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
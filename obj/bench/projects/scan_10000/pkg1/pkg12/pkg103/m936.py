@@ -0,0 +1,6 @@
+"""Module 936."""
+import pkg3.pkg29.pkg236.m652
+from . import m102
+import pkg6.pkg53.m469
+from pkg4.pkg40.pkg323 import m739
+import pkg1.pkg10.m9
@@ -0,0 +1,12 @@
+"""Module 3439."""
+import pkg1.m0
+from pkg4 import m3
+import pkg2.pkg24.pkg197.m196
+from pkg1.pkg12.pkg101 import m2185
+
+
+def helper_3439_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
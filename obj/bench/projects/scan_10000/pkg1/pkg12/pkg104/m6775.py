@@ -0,0 +1,19 @@
+"""Module 6775."""
+import pkg1.m0
+from pkg1.pkg9.pkg80 import m79
+import pkg2.pkg21.m2522
+from . import m5524
+import pkg4.pkg37.pkg301.m1134
+from . import m4273
+import pkg2.pkg23.pkg190.m1440
+from pkg2.pkg22.pkg180 import m179
+import pkg2.m1
+from pkg3.pkg27.pkg218 import m4804
+from . import m2188
+
+
+def helper_6775_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
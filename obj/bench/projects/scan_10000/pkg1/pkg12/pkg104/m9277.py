@@ -0,0 +1,61 @@
+"""Module 9277."""
+import pkg4.pkg37.pkg298.m7386
+from pkg6.pkg51.pkg414 import m8336
+import pkg1.pkg16.pkg134.m1384
+from pkg2.pkg22.pkg177 import m3095
+import pkg2.pkg18.pkg150.m566
+from pkg4.pkg34.pkg280 import m2364
+import pkg7.pkg63.m479
+from pkg4.pkg36 import m35
+import pkg4.pkg36.pkg295.m6132
+from pkg8.pkg68 import m7156
+import pkg5.pkg45.pkg361.m2862
+
+
+def helper_9277_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9277_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9277_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9277_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_9277_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_9277_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9277_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,52 @@
+"""Module 9694."""
+import pkg4.pkg37.pkg301.m4470
+from . import m5524
+import pkg2.pkg22.pkg181.m1014
+from pkg3.pkg25.pkg206 import m8128
+import pkg6.pkg55.m7560
+from pkg1 import m0
+import pkg2.pkg18.pkg146.m1813
+from pkg3.pkg32 import m4201
+import pkg1.pkg11.pkg92.m91
+
+
+def helper_9694_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9694_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9694_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9694_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_9694_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_9694_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,33 @@
+"""Module 2181."""
+import pkg1.pkg13.m429
+from pkg1.pkg10 import m9
+import pkg1.pkg11.pkg94.m1761
+from pkg3.pkg30.pkg243 import m1076
+import pkg2.pkg22.pkg181.m180
+from pkg6.pkg49 import m48
+from . import m1347
+from pkg3 import m2
+import pkg5.pkg43.pkg346.m762
+from pkg2.pkg20.pkg167 import m166
+import pkg5.pkg42.m41
+
+
+def helper_2181_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2181_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2181_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
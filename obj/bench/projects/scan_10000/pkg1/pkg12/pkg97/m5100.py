@@ -0,0 +1,11 @@
+"""Module 5100."""
+import pkg4.pkg34.pkg279.m1946
+from pkg2.pkg22.pkg180 import m1013
+import pkg2.pkg22.pkg179.m178
+
+
+def helper_5100_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
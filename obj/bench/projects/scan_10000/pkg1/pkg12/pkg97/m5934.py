@@ -0,0 +1,32 @@
+"""Module 5934."""
+import pkg4.pkg37.m36
+from pkg3.pkg32.pkg264 import m263
+from . import m3015
+from pkg4.pkg40 import m39
+from . import m4683
+from pkg5.pkg48.pkg387 import m4973
+import pkg5.pkg45.m1712
+from pkg1.pkg14.pkg118 import m3453
+import pkg4.pkg39.m1706
+from pkg4.pkg35.pkg288 import m287
+
+
+def helper_5934_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5934_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5934_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,31 @@
+"""Module 8436."""
+import pkg1.pkg9.pkg75.m491
+from pkg4.pkg38.pkg306 import m722
+import pkg3.pkg28.m27
+from pkg2.pkg19 import m18
+import pkg1.pkg13.pkg110.m109
+from pkg5.pkg47 import m2965
+import pkg5.pkg41.pkg331.m1581
+from . import m1347
+import pkg3.pkg30.pkg245.m6916
+
+
+def helper_8436_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8436_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8436_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,54 @@
+"""Module 9687."""
+import pkg1.pkg16.pkg130.m129
+from pkg5.pkg46.pkg373 import m6627
+import pkg3.pkg25.pkg208.m5628
+from pkg1.pkg12 import m11
+import pkg2.pkg21.pkg169.m7257
+from . import m5100
+import pkg6.pkg52.m51
+from pkg4.pkg39.pkg313 import m1146
+import pkg2.pkg20.pkg168.m3086
+from pkg2.pkg22.pkg184 import m600
+import pkg1.pkg13.pkg112.m2196
+
+
+def helper_9687_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9687_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9687_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9687_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_9687_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_9687_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,36 @@
+"""Module 2599."""
+import pkg4.pkg39.pkg317.m316
+from pkg3.pkg32.pkg264 import m680
+from . import m1765
+from pkg5.pkg45.pkg362 import m778
+import pkg1.m0
+from pkg1.pkg11.pkg89 import m1339
+import pkg3.pkg31.pkg255.m2339
+
+
+def helper_2599_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2599_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2599_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2599_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 6769."""
+import pkg1.m0
+from pkg3.pkg28 import m5865
+from . import m5935
+from pkg5.pkg43.pkg352 import m351
+import pkg4.pkg33.pkg267.m266
+from pkg3.pkg32.pkg263 import m6100
+import pkg4.pkg37.m36
+from pkg2 import m1
+import pkg1.pkg9.pkg73.m906
+from pkg1.pkg9.pkg80 import m2164
+
+
+def helper_6769_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,62 @@
+"""Module 7186."""
+import pkg3.pkg28.pkg228.m2729
+from pkg2.pkg22.pkg181 import m1848
+import pkg3.pkg28.m27
+from pkg2.pkg17.pkg142 import m558
+import pkg6.pkg50.pkg403.m5406
+from pkg2.pkg23 import m3775
+import pkg4.m3
+from . import m5518
+import pkg4.pkg36.pkg289.m288
+from pkg1.pkg12.pkg104 import m103
+import pkg2.pkg23.pkg187.m4773
+from pkg4.pkg40.pkg326 import m1159
+
+
+def helper_7186_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7186_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7186_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7186_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_7186_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_7186_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7186_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
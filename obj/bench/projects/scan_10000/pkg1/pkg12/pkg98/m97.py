@@ -0,0 +1,3 @@
+"""Module 97."""
+import pkg6.pkg50.m49
+from pkg1 import m0
@@ -0,0 +1,26 @@
+"""Module 6353."""
+import pkg2.pkg24.pkg198.m1448
+from . import m932
+import pkg7.m6
+from pkg4.pkg33.pkg271 import m270
+
+
+def helper_6353_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6353_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6353_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
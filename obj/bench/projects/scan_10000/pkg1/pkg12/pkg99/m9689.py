@@ -0,0 +1,20 @@
+"""Module 9689."""
+import pkg2.pkg21.pkg169.m2253
+from pkg1.pkg12.pkg104 import m103
+import pkg1.pkg9.pkg79.m1329
+from pkg1.pkg15 import m14
+import pkg2.pkg17.m1684
+from pkg3.pkg26.pkg210 import m4379
+import pkg4.pkg40.pkg326.m4078
+from pkg3.pkg25.pkg203 import m9376
+import pkg5.pkg48.pkg388.m804
+from pkg5.pkg47.pkg377 import m4963
+import pkg1.pkg14.m2098
+from pkg6.pkg50.pkg407 import m406
+
+
+def helper_9689_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,16 @@
+"""Module 2097."""
+from . import m1263
+from pkg1 import m0
+import pkg3.pkg30.m29
+from . import m1680
+import pkg4.pkg35.pkg281.m697
+from pkg5.pkg46.pkg375 import m374
+import pkg5.pkg45.m1712
+from pkg5 import m2089
+
+
+def helper_2097_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
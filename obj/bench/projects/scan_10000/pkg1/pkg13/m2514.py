@@ -0,0 +1,37 @@
+"""Module 2514."""
+import pkg4.pkg39.m38
+from pkg1.pkg16 import m15
+import pkg5.pkg48.pkg388.m1221
+from . import m2097
+import pkg3.pkg27.m26
+from . import m429
+import pkg3.pkg32.pkg262.m261
+from pkg5.pkg45 import m44
+
+
+def helper_2514_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2514_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2514_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2514_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 4182."""
+import pkg3.pkg31.pkg250.m1917
+from pkg3.pkg25 import m24
+import pkg5.pkg46.m45
+from pkg2.pkg19.pkg157 import m3075
+import pkg2.pkg21.pkg173.m3508
+from . import m3348
+import pkg2.pkg21.m20
+from pkg8.pkg66 import m65
+import pkg1.m0
+from pkg1.pkg12 import m11
+
+
+def helper_4182_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4182_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,30 @@
+"""Module 4599."""
+from . import m429
+from pkg1 import m0
+import pkg5.pkg46.pkg374.m2041
+from pkg3.pkg25 import m3777
+import pkg3.pkg32.pkg258.m1091
+from pkg5.pkg48 import m47
+import pkg4.pkg34.pkg273.m272
+from . import m4182
+
+
+def helper_4599_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4599_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4599_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
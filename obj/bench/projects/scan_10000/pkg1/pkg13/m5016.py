@@ -0,0 +1,36 @@
+"""Module 5016."""
+import pkg5.pkg47.pkg382.m381
+from pkg4.pkg35.pkg286 import m285
+import pkg1.pkg10.m2094
+from . import m2514
+import pkg5.pkg44.m2545
+from . import m846
+import pkg3.pkg32.pkg263.m1930
+
+
+def helper_5016_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5016_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5016_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5016_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
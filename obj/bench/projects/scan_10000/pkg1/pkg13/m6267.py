@@ -0,0 +1,38 @@
+"""Module 6267."""
+from . import m5433
+from pkg2.pkg18.pkg145 import m144
+import pkg4.pkg36.pkg294.m293
+from pkg1.pkg11.pkg89 import m1756
+from . import m1263
+from pkg1.pkg9 import m8
+import pkg1.m0
+from pkg8.pkg65 import m3400
+import pkg2.pkg17.m16
+
+
+def helper_6267_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6267_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6267_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6267_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,47 @@
+"""Module 8352."""
+from . import m6267
+from pkg4.pkg34.pkg279 import m695
+from . import m846
+from pkg1 import m0
+import pkg1.pkg16.pkg133.m549
+from pkg5.pkg47.pkg384 import m1634
+import pkg2.pkg18.pkg145.m2646
+from pkg2.pkg18.pkg147 import m3899
+import pkg1.m7923
+from . import m1263
+import pkg2.pkg20.pkg165.m2249
+
+
+def helper_8352_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8352_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8352_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8352_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_8352_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,22 @@
+"""Module 846."""
+import pkg5.pkg43.pkg345.m344
+from pkg4.pkg37.pkg302 import m301
+import pkg2.pkg17.m16
+from pkg2.pkg17.pkg143 import m142
+import pkg1.pkg9.pkg76.m492
+from . import m12
+import pkg2.pkg21.pkg173.m172
+
+
+def helper_846_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_846_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,41 @@
+"""Module 5108."""
+import pkg4.pkg39.m5042
+from . import m3857
+import pkg3.pkg25.pkg203.m202
+from pkg6.pkg50 import m2968
+import pkg4.pkg39.pkg317.m316
+from pkg1 import m0
+import pkg2.pkg17.m16
+from pkg5.pkg42.pkg343 import m4512
+import pkg4.pkg36.pkg289.m288
+from pkg3.pkg29.pkg237 import m1070
+import pkg1.pkg12.m11
+from pkg5.pkg46.pkg371 import m2872
+
+
+def helper_5108_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5108_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5108_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5108_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
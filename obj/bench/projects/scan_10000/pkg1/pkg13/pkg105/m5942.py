@@ -0,0 +1,39 @@
+"""Module 5942."""
+import pkg7.pkg59.m58
+from . import m5525
+import pkg3.pkg28.pkg227.m1477
+from . import m3857
+import pkg2.pkg21.m2522
+from pkg2.pkg21.pkg175 import m4344
+import pkg4.pkg37.pkg302.m5305
+from pkg2.pkg24.pkg199 import m198
+import pkg7.pkg58.m1308
+from pkg4.pkg40.pkg325 import m1158
+
+
+def helper_5942_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5942_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5942_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5942_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
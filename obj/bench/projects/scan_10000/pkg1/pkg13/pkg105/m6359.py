@@ -0,0 +1,35 @@
+"""Module 6359."""
+import pkg2.pkg23.pkg192.m1859
+from pkg4.pkg36.pkg296 import m712
+import pkg5.pkg46.pkg371.m370
+from pkg3.pkg30.pkg241 import m240
+import pkg1.pkg11.m10
+from pkg3.pkg32.pkg260 import m676
+
+
+def helper_6359_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6359_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6359_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6359_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
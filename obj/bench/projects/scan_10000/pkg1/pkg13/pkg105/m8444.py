@@ -0,0 +1,33 @@
+"""Module 8444."""
+import pkg6.pkg49.pkg393.m1226
+from pkg3.pkg29.pkg234 import m2735
+import pkg2.pkg23.pkg186.m1853
+from pkg4.pkg37 import m36
+import pkg1.pkg16.m15
+from . import m3023
+import pkg5.pkg45.pkg362.m1612
+from pkg2.pkg21.pkg170 import m4756
+import pkg4.pkg34.pkg274.m2358
+from . import m6359
+import pkg3.pkg30.pkg248.m3166
+
+
+def helper_8444_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8444_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8444_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,55 @@
+"""Module 8861."""
+import pkg3.pkg26.pkg209.m1042
+from . import m3023
+import pkg8.pkg66.m2567
+from pkg1.pkg16.pkg133 import m132
+import pkg4.pkg37.pkg302.m4888
+from pkg2.pkg19.pkg160 import m576
+import pkg2.m1
+from pkg5.pkg41.pkg332 import m4501
+import pkg6.pkg56.m1723
+from pkg3.pkg27.pkg222 import m1055
+import pkg3.pkg28.pkg231.m1898
+from pkg4.pkg33.pkg272 import m5692
+
+
+def helper_8861_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8861_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8861_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8861_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_8861_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_8861_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 4692."""
+import pkg1.pkg10.m9
+from pkg2.pkg20 import m19
+
+
+def helper_4692_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4692_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
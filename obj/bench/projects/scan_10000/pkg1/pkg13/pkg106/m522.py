@@ -0,0 +1,31 @@
+"""Module 522."""
+import pkg3.pkg32.pkg257.m256
+from pkg3.pkg29 import m28
+import pkg7.pkg59.m58
+from pkg2.pkg23.pkg191 import m190
+from . import m105
+from pkg6.pkg50.pkg406 import m405
+import pkg1.pkg12.pkg98.m514
+from pkg4 import m3
+import pkg6.m5
+
+
+def helper_522_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_522_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_522_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
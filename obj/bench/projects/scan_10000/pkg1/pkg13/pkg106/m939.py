@@ -0,0 +1,25 @@
+"""Module 939."""
+import pkg1.m0
+from . import m522
+import pkg2.m1
+from pkg5.pkg46.pkg373 import m372
+from . import m105
+from pkg8 import m7
+import pkg1.pkg15.pkg127.m126
+from pkg5.pkg45.pkg361 import m360
+import pkg2.pkg18.pkg151.m150
+from pkg2.pkg22.pkg178 import m177
+
+
+def helper_939_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_939_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
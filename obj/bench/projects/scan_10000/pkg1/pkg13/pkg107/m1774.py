@@ -0,0 +1,36 @@
+"""Module 1774."""
+import pkg1.m0
+from pkg3 import m2
+from . import m1357
+from pkg2 import m1
+import pkg6.pkg49.pkg394.m1644
+from pkg1.pkg10.pkg86 import m85
+from . import m106
+
+
+def helper_1774_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1774_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1774_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1774_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
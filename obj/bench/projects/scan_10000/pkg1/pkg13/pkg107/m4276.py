@@ -0,0 +1,15 @@
+"""Module 4276."""
+import pkg1.m0
+from pkg3.pkg28.pkg226 import m225
+import pkg3.pkg31.pkg254.m2755
+from pkg1.pkg9.pkg74 import m490
+import pkg3.pkg29.m28
+from . import m1774
+import pkg6.pkg51.pkg416.m3751
+
+
+def helper_4276_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
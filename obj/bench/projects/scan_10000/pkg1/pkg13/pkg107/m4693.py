@@ -0,0 +1,25 @@
+"""Module 4693."""
+import pkg3.pkg32.pkg261.m1511
+from pkg1 import m0
+import pkg4.pkg33.pkg266.m265
+from pkg2.pkg23 import m22
+import pkg3.pkg27.pkg217.m3552
+from pkg3.pkg25 import m24
+import pkg4.pkg36.pkg294.m1961
+from pkg3 import m2
+import pkg7.pkg62.m61
+from . import m106
+
+
+def helper_4693_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4693_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
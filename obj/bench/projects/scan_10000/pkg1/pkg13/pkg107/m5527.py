@@ -0,0 +1,52 @@
+"""Module 5527."""
+import pkg5.pkg48.m47
+from pkg3.pkg27.pkg224 import m223
+import pkg4.pkg37.pkg303.m4472
+from pkg1.pkg16.pkg136 import m2220
+import pkg5.pkg47.pkg384.m383
+from pkg2.pkg17.pkg138 import m971
+import pkg1.m0
+from pkg5.pkg41.pkg334 import m333
+from . import m4693
+
+
+def helper_5527_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5527_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5527_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5527_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_5527_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_5527_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,21 @@
+"""Module 6361."""
+from . import m1357
+from . import m2191
+import pkg1.m0
+from pkg2.pkg22.pkg182 import m2683
+import pkg1.pkg15.pkg128.m127
+from pkg5.pkg42.pkg340 import m6177
+
+
+def helper_6361_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6361_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
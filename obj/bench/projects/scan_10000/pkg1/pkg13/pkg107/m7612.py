@@ -0,0 +1,18 @@
+"""Module 7612."""
+import pkg4.pkg40.pkg321.m737
+from pkg1 import m0
+from . import m7195
+from pkg1.pkg15.pkg126 import m3044
+import pkg4.pkg39.pkg313.m729
+from pkg5.pkg42.pkg338 import m5341
+import pkg4.pkg33.pkg265.m7353
+from pkg6.pkg54 import m53
+from . import m3442
+from pkg6.pkg49.pkg397 import m1647
+
+
+def helper_7612_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
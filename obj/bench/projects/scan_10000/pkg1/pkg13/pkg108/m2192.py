@@ -0,0 +1,27 @@
+"""Module 2192."""
+import pkg5.pkg47.pkg378.m2045
+from pkg3.pkg28 import m27
+import pkg4.m3
+from pkg4.pkg38 import m37
+import pkg6.pkg54.m470
+from pkg7.pkg62 import m478
+import pkg2.pkg22.m21
+from pkg5.pkg47 import m1297
+import pkg1.pkg9.pkg73.m72
+from . import m1775
+import pkg4.pkg35.pkg287.m286
+from . import m107
+
+
+def helper_2192_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2192_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,37 @@
+"""Module 2609."""
+import pkg4.pkg38.pkg309.m725
+from pkg2.pkg24.pkg194 import m193
+import pkg4.m3
+from . import m1358
+import pkg1.m0
+from . import m524
+from . import m107
+from pkg1.pkg12.pkg101 import m1768
+
+
+def helper_2609_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2609_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2609_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2609_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
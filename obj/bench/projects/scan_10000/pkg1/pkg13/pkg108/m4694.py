@@ -0,0 +1,46 @@
+"""Module 4694."""
+import pkg1.pkg16.pkg136.m2220
+from pkg1.pkg12.pkg98 import m3016
+import pkg2.pkg24.m23
+from pkg4 import m4590
+from . import m524
+from pkg2.pkg17.pkg143 import m1393
+from . import m1775
+from pkg1.pkg13.pkg105 import m104
+import pkg1.pkg9.pkg77.m4246
+from pkg2.pkg24.pkg199 import m198
+
+
+def helper_4694_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4694_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4694_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4694_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_4694_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
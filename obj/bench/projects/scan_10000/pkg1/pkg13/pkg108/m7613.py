@@ -0,0 +1,38 @@
+"""Module 7613."""
+from . import m1358
+from pkg5.pkg43.pkg350 import m766
+from . import m4277
+from pkg1.pkg14.pkg116 import m3868
+import pkg3.pkg29.pkg236.m7324
+from pkg3.pkg26 import m4612
+import pkg3.pkg26.pkg210.m5630
+from pkg4.pkg33.pkg269 import m2770
+import pkg2.pkg24.pkg195.m1028
+
+
+def helper_7613_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7613_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7613_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7613_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
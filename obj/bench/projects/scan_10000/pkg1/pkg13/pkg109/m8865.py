@@ -0,0 +1,44 @@
+"""Module 8865."""
+import pkg3.pkg32.m1282
+from . import m5946
+import pkg2.pkg18.m434
+from pkg2.pkg24.pkg193 import m6030
+import pkg2.pkg21.m20
+from pkg3.pkg25.pkg205 import m2289
+from . import m3861
+from pkg6.pkg50.pkg407 import m8746
+
+
+def helper_8865_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8865_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8865_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8865_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_8865_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,5 @@
+"""Module 3028."""
+import pkg1.m0
+from pkg4.pkg36 import m869
+import pkg5.m4
+from pkg5.pkg44 import m43
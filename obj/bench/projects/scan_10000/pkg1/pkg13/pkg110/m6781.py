@@ -0,0 +1,54 @@
+"""Module 6781."""
+import pkg3.pkg31.pkg255.m4424
+from pkg1.pkg11 import m10
+import pkg6.pkg53.m1303
+from pkg4.pkg37.pkg303 import m4472
+import pkg2.pkg19.pkg153.m5990
+from . import m3445
+import pkg1.pkg16.pkg131.m547
+from . import m4279
+import pkg6.pkg49.pkg393.m3311
+from pkg5.pkg48.pkg390 import m806
+import pkg4.pkg37.m36
+
+
+def helper_6781_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6781_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6781_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6781_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_6781_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_6781_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,37 @@
+"""Module 8449."""
+from . import m526
+from pkg3 import m2
+import pkg5.pkg41.m2959
+from pkg5.pkg44.pkg358 import m2025
+import pkg1.pkg14.pkg114.m4700
+from pkg5.pkg46 import m45
+from . import m5113
+from pkg3.pkg25.pkg202 import m6456
+
+
+def helper_8449_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8449_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8449_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8449_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 8866."""
+import pkg1.pkg15.pkg121.m3039
+from . import m7198
+from . import m7615
+from pkg4.pkg37.pkg302 import m1135
+import pkg4.pkg34.pkg279.m1112
+
+
+def helper_8866_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8866_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
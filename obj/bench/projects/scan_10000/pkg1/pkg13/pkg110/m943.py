@@ -0,0 +1,27 @@
+"""Module 943."""
+import pkg5.pkg41.pkg336.m335
+from pkg1 import m0
+import pkg1.pkg13.m12
+from pkg7.pkg61 import m60
+import pkg2.pkg19.m18
+
+
+def helper_943_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_943_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_943_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
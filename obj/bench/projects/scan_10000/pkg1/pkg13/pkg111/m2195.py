@@ -0,0 +1,33 @@
+"""Module 2195."""
+import pkg2.pkg18.pkg152.m151
+from pkg3.pkg28.pkg225 import m224
+import pkg2.pkg18.pkg146.m145
+from pkg1.pkg14.pkg117 import m116
+import pkg2.pkg18.pkg149.m1816
+from pkg1.pkg13 import m2097
+import pkg1.pkg10.pkg82.m1749
+from pkg5.pkg42.pkg343 import m1176
+import pkg1.m0
+from pkg2.pkg19.pkg155 import m1822
+from . import m110
+
+
+def helper_2195_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2195_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2195_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
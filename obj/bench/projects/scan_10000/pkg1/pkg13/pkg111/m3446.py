@@ -0,0 +1,34 @@
+"""Module 3446."""
+import pkg2.pkg24.pkg200.m2701
+from . import m1778
+import pkg1.pkg11.pkg91.m3009
+from pkg3.pkg30 import m29
+import pkg6.pkg51.pkg411.m410
+from . import m2612
+import pkg1.m0
+from pkg4.pkg33.pkg266 import m1516
+import pkg2.pkg17.pkg139.m138
+from pkg3.pkg25.pkg204 import m2288
+import pkg5.pkg44.pkg359.m2026
+from pkg5.pkg41.pkg329 import m3247
+
+
+def helper_3446_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3446_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3446_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,33 @@
+"""Module 4280."""
+from . import m3863
+from . import m3446
+import pkg1.pkg16.pkg136.m1386
+from pkg1.pkg11.pkg96 import m95
+import pkg2.pkg21.m2522
+from pkg2.pkg18.pkg151 import m150
+from . import m2195
+from pkg6.pkg49.pkg393 import m1643
+import pkg8.pkg69.m68
+from pkg3.pkg32.pkg257 import m2341
+import pkg3.pkg30.pkg248.m247
+
+
+def helper_4280_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4280_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4280_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 527."""
+import pkg4.pkg39.pkg313.m312
+from pkg1.pkg11.pkg93 import m509
+
+
+def helper_527_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_527_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,44 @@
+"""Module 5531."""
+import pkg6.pkg49.pkg398.m1648
+from pkg2.pkg19.pkg155 import m1405
+from . import m4697
+from pkg3 import m1253
+import pkg1.pkg16.pkg134.m1801
+from pkg1.pkg15.pkg122 import m955
+import pkg2.pkg20.m19
+from pkg2.pkg22.pkg180 import m3098
+
+
+def helper_5531_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5531_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5531_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5531_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_5531_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,14 @@
+"""Module 9701."""
+import pkg3.pkg31.pkg249.m6086
+from pkg2.pkg22.pkg183 import m182
+from . import m3029
+from . import m8867
+import pkg2.pkg18.pkg150.m149
+from pkg2.pkg22.pkg177 import m3512
+
+
+def helper_9701_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
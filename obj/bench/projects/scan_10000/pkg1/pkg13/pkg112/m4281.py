@@ -0,0 +1,37 @@
+"""Module 4281."""
+import pkg2.pkg22.pkg178.m2262
+from pkg3 import m2
+import pkg4.pkg35.pkg283.m699
+from . import m1362
+import pkg6.pkg52.m1719
+from pkg2.pkg21.pkg169 import m585
+from . import m945
+from pkg1 import m0
+
+
+def helper_4281_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4281_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4281_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4281_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
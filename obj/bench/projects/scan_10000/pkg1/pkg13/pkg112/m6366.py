@@ -0,0 +1,28 @@
+"""Module 6366."""
+import pkg1.m417
+from pkg2.pkg22.pkg179 import m1429
+import pkg1.pkg16.pkg132.m131
+from pkg2.pkg23.pkg185 import m1435
+from . import m1779
+from pkg1.pkg12.pkg97 import m513
+
+
+def helper_6366_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6366_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6366_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,31 @@
+"""Module 7200."""
+import pkg5.pkg44.pkg358.m357
+from . import m6366
+import pkg1.pkg9.pkg73.m906
+from . import m5532
+import pkg2.pkg23.pkg188.m6859
+from . import m4281
+import pkg4.pkg39.pkg316.m3651
+from pkg3.pkg26.pkg209 import m5212
+from . import m2613
+
+
+def helper_7200_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7200_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7200_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
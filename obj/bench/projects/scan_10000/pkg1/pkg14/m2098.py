@@ -0,0 +1,61 @@
+"""Module 2098."""
+import pkg4.m3
+from pkg5.pkg47 import m46
+import pkg2.pkg19.pkg154.m570
+from pkg5.pkg44.pkg355 import m354
+import pkg1.pkg16.m15
+from pkg3.pkg32.pkg262 import m1512
+import pkg2.pkg20.pkg164.m163
+from pkg8.pkg70 import m69
+import pkg1.m0
+from pkg6.pkg49.pkg398 import m1648
+from . import m1264
+
+
+def helper_2098_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2098_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2098_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2098_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_2098_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_2098_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2098_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 847."""
+from . import m430
+from pkg3.pkg29.pkg239 import m238
+import pkg1.m0
+
+
+def helper_847_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
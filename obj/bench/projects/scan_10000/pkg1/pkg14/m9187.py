@@ -0,0 +1,19 @@
+"""Module 9187."""
+import pkg3.pkg28.pkg226.m225
+from pkg3.pkg28.pkg232 import m1482
+import pkg4.pkg35.pkg288.m1538
+from . import m8353
+
+
+def helper_9187_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9187_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
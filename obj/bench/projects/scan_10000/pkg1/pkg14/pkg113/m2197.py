@@ -0,0 +1,18 @@
+"""Module 2197."""
+import pkg2.pkg20.m19
+from . import m1780
+from . import m1363
+
+
+def helper_2197_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2197_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
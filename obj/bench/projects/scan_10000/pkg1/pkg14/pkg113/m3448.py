@@ -0,0 +1,5 @@
+"""Module 3448."""
+import pkg5.pkg45.m44
+from . import m2614
+import pkg1.pkg12.pkg99.m98
+from . import m1780
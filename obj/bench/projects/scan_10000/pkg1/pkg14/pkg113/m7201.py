@@ -0,0 +1,53 @@
+"""Module 7201."""
+import pkg1.m0
+from pkg2.pkg19 import m5856
+import pkg2.pkg17.m433
+from pkg5.pkg46 import m879
+import pkg1.pkg14.pkg116.m949
+from pkg5.pkg43.pkg345 import m7016
+from . import m1780
+from pkg3.pkg25 import m2526
+import pkg3.pkg28.pkg225.m641
+from pkg2 import m1
+
+
+def helper_7201_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7201_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7201_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7201_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_7201_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_7201_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
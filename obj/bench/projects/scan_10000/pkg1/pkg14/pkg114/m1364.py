@@ -0,0 +1,15 @@
+"""Module 1364."""
+import pkg1.pkg14.pkg113.m529
+from pkg1 import m0
+import pkg4.pkg36.pkg289.m288
+from pkg4.pkg38 import m871
+import pkg2.pkg18.m17
+from . import m947
+import pkg2.m1
+
+
+def helper_1364_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
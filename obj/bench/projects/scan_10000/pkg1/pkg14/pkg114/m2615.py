@@ -0,0 +1,27 @@
+"""Module 2615."""
+import pkg7.pkg60.m59
+from pkg5.pkg43.pkg351 import m767
+import pkg2.pkg17.m16
+from . import m113
+import pkg7.pkg64.m480
+
+
+def helper_2615_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2615_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2615_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
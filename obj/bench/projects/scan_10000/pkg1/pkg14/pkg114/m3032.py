@@ -0,0 +1,41 @@
+"""Module 3032."""
+import pkg5.pkg47.pkg378.m377
+from pkg4.pkg33.pkg269 import m2770
+import pkg4.pkg39.pkg313.m2397
+from . import m947
+import pkg5.pkg45.m44
+from pkg5.pkg43.pkg346 import m345
+import pkg2.pkg24.m23
+from . import m1364
+import pkg3.pkg25.pkg206.m2290
+from pkg2.pkg20.pkg167 import m166
+import pkg6.pkg49.pkg393.m809
+from . import m113
+
+
+def helper_3032_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3032_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3032_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3032_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,12 @@
+"""Module 530."""
+import pkg2.pkg19.pkg160.m159
+from pkg1.pkg13.pkg106 import m105
+import pkg1.pkg9.m8
+from pkg5.pkg44.pkg360 import m359
+
+
+def helper_530_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,30 @@
+"""Module 5951."""
+import pkg4.pkg40.m39
+from pkg6.pkg50.pkg404 import m1237
+import pkg3.pkg28.pkg227.m5647
+from pkg3.pkg28.pkg227 import m226
+import pkg3.pkg26.pkg211.m3546
+from pkg4.pkg38 import m1705
+import pkg3.pkg30.pkg245.m1495
+from pkg5.pkg44 import m43
+
+
+def helper_5951_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5951_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5951_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
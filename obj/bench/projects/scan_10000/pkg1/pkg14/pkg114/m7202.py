@@ -0,0 +1,30 @@
+"""Module 7202."""
+import pkg6.pkg50.pkg404.m6241
+from pkg6.pkg49.pkg400 import m1233
+import pkg3.pkg28.pkg230.m229
+from pkg5.pkg45 import m1712
+import pkg3.m2
+from pkg2.pkg20.pkg161 import m1411
+import pkg1.pkg11.pkg91.m2592
+from pkg1 import m0
+
+
+def helper_7202_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7202_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7202_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
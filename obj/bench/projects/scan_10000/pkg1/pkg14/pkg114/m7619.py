@@ -0,0 +1,33 @@
+"""Module 7619."""
+import pkg2.pkg17.pkg143.m559
+from pkg4.pkg34.pkg278 import m277
+import pkg5.pkg42.pkg339.m338
+from . import m1364
+import pkg4.m837
+from pkg6.pkg51.pkg409 import m1242
+import pkg4.pkg38.pkg305.m1138
+from . import m3032
+import pkg5.pkg47.pkg380.m796
+from pkg3.pkg28.pkg232 import m231
+import pkg3.pkg25.pkg202.m618
+
+
+def helper_7619_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7619_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7619_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,61 @@
+"""Module 8870."""
+import pkg5.pkg41.pkg330.m4499
+from . import m5534
+import pkg5.pkg45.pkg365.m7036
+from pkg3.pkg29.pkg235 import m234
+import pkg4.pkg37.pkg297.m1964
+from pkg5.pkg41.pkg336 import m335
+import pkg1.pkg11.pkg89.m505
+from pkg5.pkg45 import m44
+import pkg5.pkg47.pkg384.m800
+from pkg5 import m4
+import pkg3.pkg31.pkg249.m1916
+
+
+def helper_8870_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8870_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8870_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8870_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_8870_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_8870_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8870_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
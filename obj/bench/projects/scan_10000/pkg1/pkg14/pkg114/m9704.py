@@ -0,0 +1,14 @@
+"""Module 9704."""
+import pkg2.pkg20.pkg161.m4330
+from pkg1.pkg15.pkg128 import m8467
+from . import m3449
+from . import m9287
+from . import m3032
+from pkg4.pkg34.pkg274 import m3609
+
+
+def helper_9704_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 4701."""
+import pkg5.pkg47.pkg383.m1633
+from pkg7 import m6
+import pkg1.pkg13.pkg107.m106
+
+
+def helper_4701_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4701_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
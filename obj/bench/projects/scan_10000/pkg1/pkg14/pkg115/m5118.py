@@ -0,0 +1,31 @@
+"""Module 5118."""
+import pkg3.pkg27.pkg218.m3136
+from pkg5.pkg42.pkg342 import m758
+import pkg7.m6
+from . import m3867
+import pkg2.pkg20.pkg162.m3497
+from pkg5.pkg48.pkg386 import m1636
+import pkg5.pkg46.pkg373.m1206
+from . import m2616
+import pkg4.pkg34.pkg280.m279
+
+
+def helper_5118_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5118_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5118_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,10 @@
+"""Module 6369."""
+import pkg2.pkg24.pkg200.m199
+from pkg6.pkg51.pkg413 import m412
+
+
+def helper_6369_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
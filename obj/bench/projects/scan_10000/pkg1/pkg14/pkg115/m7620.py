@@ -0,0 +1,24 @@
+"""Module 7620."""
+import pkg4.pkg37.pkg304.m303
+from pkg2.pkg24.pkg199 import m2283
+import pkg5.pkg44.pkg356.m355
+from pkg4.pkg38.pkg306 import m722
+import pkg8.pkg66.m65
+from . import m1782
+import pkg4.pkg35.pkg286.m3621
+from pkg1.pkg12.pkg103 import m1770
+import pkg2.m5839
+
+
+def helper_7620_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7620_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,21 @@
+"""Module 6370."""
+from . import m2200
+from pkg4.pkg34.pkg280 import m2364
+import pkg1.m0
+from . import m5536
+import pkg3.pkg32.pkg257.m256
+from . import m4702
+
+
+def helper_6370_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6370_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,15 @@
+"""Module 949."""
+import pkg1.m0
+from pkg5.pkg41 import m40
+from . import m532
+from pkg2 import m1
+import pkg1.pkg13.pkg106.m939
+from . import m115
+import pkg6.pkg49.pkg396.m812
+
+
+def helper_949_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
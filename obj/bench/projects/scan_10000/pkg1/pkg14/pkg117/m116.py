@@ -0,0 +1,11 @@
+"""Module 116."""
+import pkg1.pkg11.m10
+from pkg3.pkg31 import m30
+import pkg6.m5
+
+
+def helper_116_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
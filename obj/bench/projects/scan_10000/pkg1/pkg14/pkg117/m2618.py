@@ -0,0 +1,62 @@
+"""Module 2618."""
+import pkg8.pkg70.m1320
+from pkg1.pkg16 import m15
+import pkg4.m3
+from pkg2.pkg23.pkg186 import m602
+import pkg3.pkg27.pkg222.m2306
+from pkg6.pkg49 import m48
+import pkg2.m1
+from pkg5.pkg44.pkg360 import m1610
+import pkg2.pkg23.pkg186.m185
+from pkg2.pkg17 import m16
+import pkg5.pkg42.pkg338.m337
+from pkg6 import m5
+
+
+def helper_2618_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2618_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2618_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2618_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_2618_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_2618_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2618_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
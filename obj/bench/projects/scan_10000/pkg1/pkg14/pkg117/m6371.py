@@ -0,0 +1,27 @@
+"""Module 6371."""
+import pkg1.pkg13.m429
+from pkg1.pkg10.pkg87 import m503
+import pkg3.pkg31.pkg255.m1088
+from pkg7.pkg58 import m57
+import pkg4.pkg38.pkg305.m1555
+
+
+def helper_6371_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6371_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6371_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
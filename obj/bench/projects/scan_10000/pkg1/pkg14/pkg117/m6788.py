@@ -0,0 +1,46 @@
+"""Module 6788."""
+import pkg8.m6679
+from pkg3.pkg27.pkg224 import m3976
+from . import m4703
+from pkg4.pkg39.pkg317 import m316
+import pkg4.pkg39.m38
+from pkg5.pkg44 import m4213
+import pkg6.pkg50.pkg406.m4992
+from pkg1 import m0
+from . import m6371
+from . import m950
+
+
+def helper_6788_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6788_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6788_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6788_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_6788_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 9707."""
+import pkg4.pkg40.pkg322.m2823
+from pkg2.pkg17 import m1684
+import pkg5.pkg44.pkg354.m770
+from pkg3.pkg28.pkg232 import m6903
+from . import m5954
+from pkg4.pkg35.pkg285 import m701
+import pkg3.pkg25.pkg205.m9378
+from pkg2.pkg24 import m440
+import pkg1.pkg9.m8
+from . import m8039
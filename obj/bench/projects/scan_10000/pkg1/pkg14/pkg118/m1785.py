@@ -0,0 +1,15 @@
+"""Module 1785."""
+import pkg2.pkg20.m19
+from pkg2.pkg21.pkg173 import m589
+import pkg5.pkg43.pkg345.m761
+from pkg2 import m1
+import pkg7.pkg62.m61
+from pkg2.pkg24.pkg194 import m610
+import pkg1.pkg15.pkg123.m122
+
+
+def helper_1785_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
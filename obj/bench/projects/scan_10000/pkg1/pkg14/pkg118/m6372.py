@@ -0,0 +1,13 @@
+"""Module 6372."""
+import pkg5.pkg47.pkg384.m3719
+from pkg1 import m0
+from . import m951
+from pkg5.pkg42.pkg340 import m3258
+import pkg5.pkg42.pkg344.m2011
+
+
+def helper_6372_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 3037."""
+import pkg2.pkg20.pkg161.m577
+from pkg6.pkg50 import m49
+import pkg3.pkg30.m29
+from . import m2620
+from . import m2203
+
+
+def helper_3037_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3037_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3037_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
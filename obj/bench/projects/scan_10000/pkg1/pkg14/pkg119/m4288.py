@@ -0,0 +1,9 @@
+"""Module 4288."""
+import pkg1.pkg15.pkg125.m124
+
+
+def helper_4288_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
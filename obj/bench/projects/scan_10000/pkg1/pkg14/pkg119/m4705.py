@@ -0,0 +1,47 @@
+"""Module 4705."""
+import pkg5.m4
+from pkg4.pkg40.pkg328 import m1578
+import pkg1.pkg12.pkg104.m937
+from . import m1786
+import pkg6.m5
+from pkg1.pkg15.pkg121 import m120
+import pkg4.pkg33.pkg270.m2354
+from pkg2.pkg20.pkg164 import m997
+import pkg1.m0
+from pkg2.pkg24.pkg198 import m197
+import pkg3.pkg26.m25
+
+
+def helper_4705_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4705_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4705_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4705_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_4705_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
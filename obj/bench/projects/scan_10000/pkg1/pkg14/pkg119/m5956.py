@@ -0,0 +1,34 @@
+"""Module 5956."""
+import pkg4.pkg37.pkg298.m714
+from pkg1 import m0
+import pkg5.pkg48.m47
+from pkg3.pkg26.pkg210 import m5213
+import pkg1.pkg9.pkg74.m73
+from pkg5.pkg44.pkg353 import m769
+import pkg6.pkg51.m3803
+from pkg5.pkg44.pkg359 import m5779
+import pkg1.pkg11.m3346
+from . import m3871
+import pkg2.pkg17.pkg144.m3062
+from pkg1 import m5421
+
+
+def helper_5956_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5956_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5956_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
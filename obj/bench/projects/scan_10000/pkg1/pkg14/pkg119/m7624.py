@@ -0,0 +1,45 @@
+"""Module 7624."""
+from . import m5539
+from pkg6.pkg52 import m468
+import pkg2.pkg19.pkg157.m1824
+from . import m1369
+import pkg3.pkg27.m26
+from pkg1.pkg10 import m9
+import pkg5.pkg48.pkg388.m7059
+from pkg4.pkg39.pkg316 import m2400
+import pkg1.pkg16.pkg131.m547
+
+
+def helper_7624_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7624_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7624_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7624_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_7624_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 9709."""
+import pkg1.pkg12.pkg99.m7187
+from pkg7 import m6
+from . import m118
+from pkg6 import m5
+import pkg4.pkg40.pkg322.m2406
+from pkg5.pkg41.pkg329 import m5749
+import pkg1.pkg16.m15
+from pkg6.pkg50.pkg401 import m4570
+import pkg1.pkg9.pkg79.m78
+from . import m8041
+import pkg2.pkg22.m21
+from pkg5.pkg44.pkg360 import m2027
+
+
+def helper_9709_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
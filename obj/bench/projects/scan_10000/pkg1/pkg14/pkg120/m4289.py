@@ -0,0 +1,38 @@
+"""Module 4289."""
+import pkg3.pkg29.pkg237.m236
+from pkg2.pkg18 import m17
+import pkg6.pkg52.m2970
+from pkg2.pkg23 import m1273
+from . import m953
+from . import m119
+import pkg4.pkg33.pkg265.m2349
+from pkg5.pkg43 import m459
+import pkg5.pkg48.pkg391.m390
+
+
+def helper_4289_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4289_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4289_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4289_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,38 @@
+"""Module 5123."""
+from . import m4706
+from pkg1 import m0
+import pkg5.pkg41.pkg331.m747
+from pkg3.pkg25.pkg203 import m2287
+import pkg5.pkg46.m462
+from pkg2.pkg24 import m23
+from . import m2621
+from pkg1.pkg14.pkg117 import m533
+import pkg3.pkg29.pkg234.m1901
+
+
+def helper_5123_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5123_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5123_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5123_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,54 @@
+"""Module 5540."""
+import pkg3.pkg27.pkg224.m223
+from pkg4.pkg33.pkg265 import m4851
+import pkg5.pkg48.m3800
+from pkg1.pkg10 import m9
+import pkg3.pkg29.pkg240.m1490
+from pkg4.pkg38.pkg307 import m2391
+import pkg6.pkg51.m467
+from pkg2.pkg23.pkg185 import m1852
+import pkg3.pkg26.pkg210.m209
+from pkg1 import m0
+import pkg3.pkg25.pkg205.m621
+
+
+def helper_5540_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5540_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5540_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5540_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_5540_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_5540_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
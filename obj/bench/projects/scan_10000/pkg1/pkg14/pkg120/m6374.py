@@ -0,0 +1,48 @@
+"""Module 6374."""
+import pkg3.pkg28.m27
+from pkg1 import m0
+import pkg6.pkg51.pkg409.m825
+from pkg3.pkg29.pkg236 import m2320
+import pkg5.m4
+from pkg4.pkg35.pkg288 import m6125
+from . import m953
+from pkg1.pkg16.pkg136 import m135
+import pkg7.pkg63.m62
+from pkg1.pkg15 import m14
+import pkg3.pkg28.pkg226.m1893
+from pkg1.pkg12.pkg98 import m2599
+
+
+def helper_6374_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6374_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6374_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6374_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_6374_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
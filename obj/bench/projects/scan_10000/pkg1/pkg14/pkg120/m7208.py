@@ -0,0 +1,44 @@
+"""Module 7208."""
+import pkg2.pkg21.pkg169.m585
+from pkg3.pkg26.pkg212 import m2713
+import pkg1.m0
+from . import m5957
+from . import m536
+from pkg1.pkg12.pkg98 import m514
+import pkg3.pkg25.m24
+from pkg4.pkg39.pkg320 import m319
+
+
+def helper_7208_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7208_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7208_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7208_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_7208_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,55 @@
+"""Module 2933."""
+from . import m2099
+from pkg5.pkg43.pkg345 import m2846
+import pkg6.m1673
+from pkg1.pkg11 import m427
+import pkg1.pkg10.m9
+from pkg3.pkg25.pkg208 import m1041
+import pkg3.pkg30.pkg245.m244
+from pkg4.pkg36.pkg296 import m295
+import pkg2.pkg22.pkg182.m2683
+from pkg4.pkg33 import m32
+import pkg2.m1
+from . import m1682
+
+
+def helper_2933_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2933_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2933_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2933_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_2933_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_2933_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
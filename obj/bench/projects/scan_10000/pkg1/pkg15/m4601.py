@@ -0,0 +1,53 @@
+"""Module 4601."""
+import pkg6.pkg51.pkg410.m3328
+from pkg7.pkg59 import m58
+import pkg4.pkg33.pkg271.m687
+from pkg1.pkg12.pkg103 import m102
+import pkg3.pkg31.m30
+from pkg1.pkg9.pkg73 import m72
+import pkg1.pkg12.pkg100.m933
+from pkg1.pkg15.pkg127 import m3462
+import pkg2.pkg19.m18
+from pkg2.pkg18.pkg152 import m568
+
+
+def helper_4601_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4601_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4601_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4601_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_4601_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_4601_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,55 @@
+"""Module 7937."""
+import pkg3.pkg25.pkg206.m1039
+from pkg4.pkg35.pkg286 import m6957
+import pkg4.pkg35.pkg283.m1116
+from pkg6.pkg52.pkg417 import m4169
+import pkg2.pkg24.pkg199.m7287
+from . import m6269
+import pkg4.pkg38.m454
+from . import m6686
+import pkg2.pkg18.pkg149.m2650
+from pkg6.pkg49.pkg393 import m4562
+import pkg3.m2
+from pkg4.pkg40.pkg321 import m1571
+
+
+def helper_7937_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7937_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7937_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7937_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_7937_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_7937_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,45 @@
+"""Module 9188."""
+import pkg8.m7
+from pkg5.pkg46.pkg370 import m3705
+import pkg3.pkg32.pkg261.m6932
+from pkg7.pkg62 import m2563
+import pkg4.pkg34.pkg278.m277
+from . import m2099
+import pkg1.pkg14.m2098
+from pkg8 import m2092
+import pkg3.pkg25.m1275
+
+
+def helper_9188_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9188_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9188_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9188_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_9188_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
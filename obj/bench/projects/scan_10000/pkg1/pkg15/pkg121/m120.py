@@ -0,0 +1,17 @@
+"""Module 120."""
+import pkg4.pkg36.m35
+from pkg2.pkg18 import m17
+import pkg1.m0
+from pkg1.pkg12 import m11
+import pkg1.pkg13.pkg107.m106
+from pkg3.pkg29 import m28
+import pkg2.pkg22.m21
+from pkg1.pkg9.pkg79 import m78
+import pkg4.m3
+
+
+def helper_120_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
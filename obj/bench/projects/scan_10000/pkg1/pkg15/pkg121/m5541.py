@@ -0,0 +1,28 @@
+"""Module 5541."""
+from . import m2205
+from pkg7.pkg59 import m58
+import pkg1.pkg16.m1683
+from pkg5.pkg46.pkg369 import m2453
+import pkg4.pkg35.pkg281.m1531
+from pkg1 import m0
+
+
+def helper_5541_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5541_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5541_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
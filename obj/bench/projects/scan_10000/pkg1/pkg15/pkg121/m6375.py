@@ -0,0 +1,22 @@
+"""Module 6375."""
+import pkg8.pkg68.m67
+from . import m2205
+import pkg4.m6258
+from pkg6.pkg49 import m465
+import pkg3.pkg31.pkg254.m4423
+from pkg4.pkg38.pkg307 import m4059
+import pkg4.pkg38.pkg311.m310
+
+
+def helper_6375_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6375_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,28 @@
+"""Module 7209."""
+from . import m6375
+from pkg1.pkg10 import m9
+import pkg3.pkg30.pkg241.m240
+from pkg1 import m0
+from . import m1371
+from . import m3873
+
+
+def helper_7209_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7209_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7209_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,12 @@
+"""Module 954."""
+import pkg1.pkg13.pkg107.m106
+from . import m120
+from . import m537
+from pkg1 import m0
+
+
+def helper_954_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
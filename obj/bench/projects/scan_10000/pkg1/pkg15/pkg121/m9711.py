@@ -0,0 +1,26 @@
+"""Module 9711."""
+import pkg5.pkg41.pkg336.m752
+from pkg4.pkg33 import m5453
+import pkg1.pkg12.pkg102.m4271
+from pkg7.pkg63 import m5900
+import pkg2.pkg18.m1685
+from pkg4.pkg36.pkg291 import m4877
+import pkg1.pkg11.m10
+from pkg3.pkg31.pkg250 import m2751
+import pkg4.pkg34.pkg274.m5277
+from pkg3.pkg32.pkg258 import m4844
+import pkg1.pkg10.m1260
+
+
+def helper_9711_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9711_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 5542."""
+import pkg5.pkg43.pkg348.m764
+from pkg4.pkg39.pkg313 import m2397
+from . import m955
+
+
+def helper_5542_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 8461."""
+from . import m7627
+from pkg1.pkg12.pkg99 import m98
+import pkg5.pkg43.pkg345.m344
+from pkg4.pkg39.pkg319 import m6990
+import pkg1.pkg9.m8
+
+
+def helper_8461_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8461_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8461_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 9295."""
+from . import m5542
+from pkg3.pkg29.pkg235 import m2736
+import pkg1.pkg16.pkg135.m3470
+from . import m4708
+
+
+def helper_9295_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9295_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9295_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,7 @@
+"""Module 955."""
+import pkg5.pkg47.pkg380.m796
+from pkg2.pkg19 import m18
+import pkg4.pkg39.pkg319.m318
+from pkg1.pkg16.pkg136 import m135
+import pkg2.pkg18.m17
+from pkg3.pkg26 import m25
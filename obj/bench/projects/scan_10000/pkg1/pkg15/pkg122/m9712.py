@@ -0,0 +1,26 @@
+"""Module 9712."""
+import pkg3.pkg27.pkg224.m2725
+from pkg1.pkg15.pkg127 import m6798
+import pkg5.pkg48.pkg387.m803
+from pkg6.pkg49.pkg396 import m9569
+from . import m5125
+from . import m2206
+import pkg5.pkg44.pkg353.m352
+from pkg5.pkg44.pkg358 import m2859
+from . import m4291
+from . import m8461
+import pkg3.pkg32.pkg263.m4015
+
+
+def helper_9712_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9712_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,9 @@
+"""Module 3875."""
+import pkg5.pkg42.pkg344.m2845
+
+
+def helper_3875_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
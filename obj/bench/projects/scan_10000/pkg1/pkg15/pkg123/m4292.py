@@ -0,0 +1,10 @@
+"""Module 4292."""
+from . import m3458
+from pkg5.pkg45.pkg368 import m1618
+
+
+def helper_4292_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 8879."""
+import pkg2.m1
+from . import m956
+import pkg5.pkg43.pkg346.m3264
+from . import m2207
+
+
+def helper_8879_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8879_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
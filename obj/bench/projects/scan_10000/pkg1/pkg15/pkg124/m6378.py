@@ -0,0 +1,34 @@
+"""Module 6378."""
+import pkg4.pkg34.pkg279.m5282
+from pkg1.pkg16.pkg133 import m3468
+import pkg4.pkg36.m2120
+from pkg5.pkg47.pkg382 import m1215
+import pkg1.m0
+
+
+def helper_6378_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6378_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6378_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6378_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,44 @@
+"""Module 6795."""
+import pkg5.pkg47.m46
+from pkg3.pkg30.pkg241 import m657
+from . import m4293
+from pkg1.pkg9.pkg79 import m4665
+import pkg4.pkg34.m33
+from pkg1.pkg14.pkg113 import m112
+from . import m2625
+from pkg4.pkg37.pkg299 import m1132
+
+
+def helper_6795_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6795_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6795_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6795_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_6795_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
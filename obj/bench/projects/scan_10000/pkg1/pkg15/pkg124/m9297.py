@@ -0,0 +1,39 @@
+"""Module 9297."""
+import pkg3.pkg26.pkg214.m7302
+from pkg5.pkg48.pkg386 import m6640
+from . import m8463
+from . import m1791
+import pkg6.pkg51.pkg415.m6669
+from pkg1.pkg14 import m13
+from . import m5961
+from pkg2.pkg21.pkg175 import m174
+from . import m540
+from pkg1.pkg14.pkg115 import m8871
+
+
+def helper_9297_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9297_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9297_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9297_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 1792."""
+import pkg3.pkg27.pkg217.m216
+from pkg3.pkg26 import m1693
+
+
+def helper_1792_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1792_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 3877."""
+import pkg2.pkg24.pkg193.m2694
+from pkg2 import m835
+import pkg4.pkg34.pkg280.m1113
+from pkg5.pkg48.pkg387 import m386
+import pkg3.pkg29.m28
+
+
+def helper_3877_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3877_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,44 @@
+"""Module 7213."""
+import pkg5.pkg48.m47
+from . import m2209
+import pkg5.pkg42.pkg340.m339
+from pkg1.pkg14 import m430
+import pkg4.pkg37.pkg301.m717
+from pkg3.pkg25.pkg202 import m201
+import pkg1.pkg13.pkg108.m7196
+from pkg3.pkg32.pkg260 import m259
+
+
+def helper_7213_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7213_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7213_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7213_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_7213_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,22 @@
+"""Module 7630."""
+import pkg1.pkg16.m15
+from pkg6.pkg52 import m468
+import pkg6.pkg49.pkg396.m812
+from pkg4.pkg34.pkg277 import m276
+import pkg5.m4
+from . import m2626
+import pkg3.pkg28.m27
+
+
+def helper_7630_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7630_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 8464."""
+import pkg1.pkg10.m9
+from pkg4.pkg36.pkg291 import m1124
+from . import m1375
+from pkg8.pkg68 import m2986
+import pkg2.pkg22.pkg182.m181
+from pkg1 import m0
+import pkg2.pkg22.pkg184.m6855
+from pkg4.pkg37.pkg301 import m4470
+from . import m7630
+from pkg7.pkg57 import m473
+from . import m958
+
+
+def helper_8464_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
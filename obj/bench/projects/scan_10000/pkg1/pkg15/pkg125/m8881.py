@@ -0,0 +1,43 @@
+"""Module 8881."""
+from . import m2626
+from pkg1 import m0
+import pkg1.pkg10.pkg88.m4257
+from pkg1.pkg9.pkg79 import m5082
+import pkg5.pkg41.m3376
+from pkg1.pkg13.pkg109 import m3861
+import pkg1.pkg11.pkg90.m89
+
+
+def helper_8881_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8881_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8881_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8881_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_8881_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
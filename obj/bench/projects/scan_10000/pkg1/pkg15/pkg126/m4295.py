@@ -0,0 +1,32 @@
+"""Module 4295."""
+import pkg3.pkg32.pkg264.m680
+from . import m3044
+from . import m3461
+from pkg3.pkg29.pkg240 import m239
+import pkg1.pkg12.m3347
+from . import m125
+from . import m2210
+from . import m542
+import pkg3.m2
+from pkg4.pkg33.pkg272 import m688
+
+
+def helper_4295_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4295_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4295_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
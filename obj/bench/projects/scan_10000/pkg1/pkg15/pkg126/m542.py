@@ -0,0 +1,14 @@
+"""Module 542."""
+import pkg4.pkg36.m35
+from pkg4.pkg37 import m36
+import pkg2.pkg20.pkg165.m164
+from . import m125
+import pkg2.m1
+from pkg1.pkg12.pkg98 import m97
+
+
+def helper_542_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
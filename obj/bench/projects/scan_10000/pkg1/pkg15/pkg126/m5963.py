@@ -0,0 +1,35 @@
+"""Module 5963."""
+from . import m3044
+from . import m959
+import pkg4.pkg38.m37
+from pkg1.pkg11.pkg95 import m511
+import pkg2.pkg24.pkg198.m3950
+from pkg2.pkg18 import m17
+
+
+def helper_5963_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5963_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5963_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5963_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
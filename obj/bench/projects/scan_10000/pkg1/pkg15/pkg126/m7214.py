@@ -0,0 +1,41 @@
+"""Module 7214."""
+import pkg2.pkg19.pkg153.m4322
+from . import m3044
+import pkg3.pkg28.pkg230.m2314
+from pkg1.pkg11 import m844
+import pkg5.pkg46.pkg370.m2454
+from pkg1 import m0
+import pkg1.pkg16.pkg132.m131
+from pkg4.pkg39 import m872
+import pkg6.pkg51.pkg414.m1664
+from pkg1.pkg15.pkg125 import m124
+import pkg1.pkg10.pkg88.m87
+from pkg1.pkg16.pkg129 import m128
+
+
+def helper_7214_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7214_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7214_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7214_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,15 @@
+"""Module 8048."""
+import pkg7.pkg57.m6311
+from pkg5.pkg47.pkg382 import m6636
+import pkg1.pkg15.pkg122.m1789
+from pkg4.pkg34 import m450
+import pkg6.pkg50.pkg403.m6240
+from pkg6.pkg50.pkg408 import m1658
+from . import m3461
+
+
+def helper_8048_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,23 @@
+"""Module 543."""
+from . import m126
+from pkg1.pkg16 import m15
+import pkg2.pkg18.pkg150.m149
+from pkg4 import m3
+import pkg6.m5
+from pkg1 import m0
+import pkg5.pkg47.pkg381.m380
+from pkg1.pkg9.pkg74 import m73
+
+
+def helper_543_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_543_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
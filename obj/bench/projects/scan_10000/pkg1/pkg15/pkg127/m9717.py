@@ -0,0 +1,61 @@
+"""Module 9717."""
+from . import m4713
+from pkg5.pkg41.pkg334 import m7839
+import pkg1.pkg9.pkg73.m72
+from pkg1.pkg12.pkg99 import m1349
+import pkg2.pkg23.pkg192.m608
+from . import m6381
+from . import m2628
+from pkg5.pkg47.pkg382 import m798
+import pkg3.pkg30.pkg243.m8165
+from pkg2.pkg21.pkg171 import m2255
+import pkg5.pkg44.pkg353.m7024
+
+
+def helper_9717_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9717_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9717_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9717_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_9717_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_9717_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9717_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 1378."""
+import pkg5.pkg44.pkg357.m773
+from pkg3.pkg31.pkg249 import m665
+import pkg2.pkg24.m857
+
+
+def helper_1378_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1378_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1378_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
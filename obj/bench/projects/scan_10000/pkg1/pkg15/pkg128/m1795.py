@@ -0,0 +1,44 @@
+"""Module 1795."""
+import pkg2.pkg19.m18
+from pkg1.pkg10.pkg86 import m502
+import pkg1.pkg12.pkg99.m98
+from pkg4.pkg35.pkg286 import m285
+import pkg3.pkg31.pkg253.m252
+from pkg2.pkg20 import m19
+import pkg1.m0
+from pkg4.pkg40 import m1290
+
+
+def helper_1795_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1795_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1795_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1795_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_1795_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
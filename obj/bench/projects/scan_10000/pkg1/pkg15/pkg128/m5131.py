@@ -0,0 +1,48 @@
+"""Module 5131."""
+import pkg2.pkg23.pkg187.m603
+from . import m961
+import pkg1.pkg15.m14
+from . import m4714
+import pkg4.pkg38.pkg311.m310
+from pkg3.pkg26.pkg216 import m1466
+import pkg7.pkg60.m5063
+from pkg2.pkg21.pkg169 import m585
+from . import m4297
+from pkg5.pkg44.pkg356 import m772
+import pkg2.pkg19.pkg157.m573
+from pkg3.pkg29.pkg236 import m2737
+
+
+def helper_5131_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5131_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5131_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5131_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_5131_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,55 @@
+"""Module 5548."""
+import pkg3.pkg32.pkg261.m260
+from pkg2.pkg20 import m4606
+import pkg8.pkg72.m4241
+from pkg3.pkg30.pkg243 import m2327
+import pkg4.pkg33.pkg269.m685
+from pkg4.pkg37 import m36
+import pkg2.pkg19.pkg155.m154
+from pkg2 import m1
+from . import m3463
+from pkg1.pkg16.pkg136 import m135
+import pkg3.pkg27.pkg220.m2721
+from pkg1 import m0
+
+
+def helper_5548_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5548_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5548_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5548_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_5548_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_5548_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,48 @@
+"""Module 9301."""
+import pkg1.pkg10.pkg84.m2585
+from pkg2.pkg23.pkg186 import m5606
+import pkg4.pkg40.pkg321.m1154
+from . import m3046
+import pkg1.pkg15.m4601
+from pkg1.pkg16.pkg134 import m3469
+import pkg2.pkg18.pkg151.m5154
+from pkg4.pkg33.pkg267 import m266
+import pkg4.pkg34.m3369
+from pkg1.pkg10.pkg85 import m3420
+import pkg6.pkg51.pkg415.m831
+from pkg4.pkg40.pkg325 import m9081
+
+
+def helper_9301_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9301_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9301_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9301_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_9301_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,28 @@
+"""Module 9718."""
+from . import m6799
+from . import m3463
+import pkg3.pkg28.pkg226.m225
+from . import m1378
+import pkg1.m0
+from pkg1.pkg11.pkg90 import m89
+
+
+def helper_9718_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9718_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9718_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 6687."""
+import pkg5.pkg42.pkg343.m4512
+from pkg6.pkg53 import m1720
+import pkg8.m424
+from . import m2517
+import pkg1.pkg14.pkg120.m1787
+
+
+def helper_6687_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6687_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,28 @@
+"""Module 7104."""
+from . import m849
+from . import m1683
+from . import m3351
+from pkg4 import m3
+import pkg2.pkg19.pkg156.m1406
+from . import m4602
+
+
+def helper_7104_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7104_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7104_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,47 @@
+"""Module 7521."""
+import pkg3.m2
+from pkg5.pkg47.pkg378 import m794
+import pkg2.m1
+from pkg4.pkg34.pkg278 import m2362
+import pkg3.pkg27.pkg223.m6060
+from pkg5.pkg44.pkg359 import m3277
+import pkg4.pkg37.pkg301.m2385
+from pkg2.pkg19.pkg153 import m1820
+import pkg2.pkg21.m20
+from pkg4.pkg38.pkg305 import m304
+import pkg4.pkg33.pkg267.m6104
+
+
+def helper_7521_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7521_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7521_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7521_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_7521_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 7938."""
+from . import m2100
+from pkg2.pkg24.pkg195 import m611
+from . import m1266
+
+
+def helper_7938_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,14 @@
+"""Module 9189."""
+import pkg1.pkg12.pkg98.m3850
+from pkg4.pkg38.pkg309 import m6563
+import pkg1.m0
+from pkg2.pkg23 import m2107
+import pkg1.pkg9.m7514
+from pkg5.pkg42.pkg342 import m5345
+
+
+def helper_9189_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,13 @@
+"""Module 128."""
+import pkg2.m1
+from pkg7.pkg62 import m61
+import pkg6.pkg54.m53
+from pkg1.pkg9.pkg77 import m76
+import pkg1.pkg13.m12
+
+
+def helper_128_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
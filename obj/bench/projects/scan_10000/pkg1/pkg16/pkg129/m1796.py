@@ -0,0 +1,47 @@
+"""Module 1796."""
+import pkg4.pkg39.pkg319.m735
+from pkg2.pkg24.pkg195 import m1445
+import pkg3.pkg29.pkg235.m1068
+from pkg2.pkg20.pkg165 import m164
+import pkg2.pkg23.pkg189.m605
+from pkg5.pkg47.pkg377 import m793
+import pkg4.pkg35.pkg283.m1533
+from pkg2.pkg22.pkg182 import m1432
+import pkg7.pkg60.m59
+from . import m545
+import pkg1.m0
+
+
+def helper_1796_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1796_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1796_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1796_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_1796_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
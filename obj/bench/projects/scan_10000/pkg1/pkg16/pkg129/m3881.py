@@ -0,0 +1,30 @@
+"""Module 3881."""
+import pkg2.pkg20.pkg161.m160
+from pkg1.pkg16.pkg135 import m2219
+import pkg5.pkg48.pkg392.m2476
+from pkg1.pkg11.pkg96 import m1346
+import pkg4.pkg39.pkg314.m730
+from pkg1.pkg11.pkg96 import m929
+import pkg5.m421
+from pkg1.pkg14.pkg116 import m2617
+
+
+def helper_3881_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3881_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3881_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,62 @@
+"""Module 4715."""
+import pkg5.pkg44.pkg354.m2021
+from pkg7.pkg62 import m61
+import pkg7.pkg63.m62
+from pkg5.pkg41.pkg333 import m2000
+import pkg1.pkg9.pkg75.m4244
+from pkg6.pkg51.pkg410 import m3745
+from . import m3881
+from pkg2.pkg17.pkg141 import m1808
+import pkg3.pkg25.pkg202.m201
+from pkg5.pkg47 import m46
+import pkg5.pkg41.m40
+from pkg1.pkg9 import m8
+
+
+def helper_4715_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4715_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4715_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4715_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_4715_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_4715_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4715_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
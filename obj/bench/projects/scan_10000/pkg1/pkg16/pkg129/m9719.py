@@ -0,0 +1,40 @@
+"""Module 9719."""
+import pkg2.m1
+from pkg5.pkg44.pkg355 import m4107
+import pkg2.pkg20.pkg164.m7669
+from pkg1.pkg10.pkg88 import m87
+from . import m5132
+from . import m545
+from . import m2213
+from . import m1379
+from . import m3881
+from pkg1.pkg13.pkg112 import m3447
+import pkg2.pkg24.m440
+
+
+def helper_9719_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9719_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9719_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9719_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
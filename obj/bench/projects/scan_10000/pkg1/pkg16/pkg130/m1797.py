@@ -0,0 +1,16 @@
+"""Module 1797."""
+import pkg5.pkg46.pkg372.m788
+from pkg3.pkg31.pkg254 import m1087
+import pkg1.pkg14.pkg119.m118
+from pkg3.pkg26 import m1276
+import pkg4.pkg39.pkg314.m1147
+from . import m129
+from . import m546
+from pkg3.pkg27.pkg217 import m1050
+
+
+def helper_1797_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
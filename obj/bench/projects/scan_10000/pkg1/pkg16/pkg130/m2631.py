@@ -0,0 +1,9 @@
+"""Module 2631."""
+import pkg6.pkg54.m53
+
+
+def helper_2631_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,24 @@
+"""Module 7218."""
+import pkg3.pkg26.pkg215.m4801
+from pkg2.pkg21.pkg174 import m590
+import pkg3.pkg26.pkg210.m6047
+from pkg4.pkg37.pkg297 import m5300
+from . import m1797
+from pkg1.pkg16 import m15
+import pkg1.m0
+from pkg1.pkg12.pkg101 import m7189
+import pkg1.pkg15.m2099
+
+
+def helper_7218_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7218_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 8886."""
+from . import m546
+from pkg2.pkg20.pkg167 import m3919
+import pkg4.pkg39.m872
+from pkg3.pkg30.pkg241 import m6912
+import pkg3.pkg30.pkg242.m1492
+
+
+def helper_8886_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8886_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8886_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
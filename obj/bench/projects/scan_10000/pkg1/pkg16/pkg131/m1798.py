@@ -0,0 +1,62 @@
+"""Module 1798."""
+import pkg2.pkg23.m22
+from pkg1.pkg12.pkg102 import m101
+import pkg5.pkg44.pkg360.m1193
+from pkg1 import m0
+import pkg5.pkg43.pkg350.m349
+from pkg3.pkg26.pkg216 import m1466
+import pkg3.pkg26.pkg215.m631
+from pkg6.pkg51.pkg415 import m831
+import pkg1.pkg16.pkg136.m969
+from . import m547
+import pkg1.pkg15.m14
+from pkg2 import m1
+
+
+def helper_1798_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1798_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1798_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1798_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_1798_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_1798_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1798_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,37 @@
+"""Module 5551."""
+import pkg2.pkg18.pkg150.m1817
+from pkg5.pkg46.pkg376 import m375
+import pkg1.pkg16.pkg129.m128
+from pkg3.pkg32.pkg259 import m3177
+import pkg4.pkg39.pkg319.m1152
+from pkg2 import m1
+from . import m2632
+from . import m547
+
+
+def helper_5551_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5551_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5551_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5551_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 8887."""
+import pkg5.pkg44.pkg356.m8278
+from pkg3.pkg27.pkg217 import m633
+import pkg1.pkg12.pkg103.m5106
+from pkg4.pkg38.pkg308 import m7813
+import pkg4.pkg34.pkg273.m4859
+from . import m1381
+import pkg6.pkg51.pkg413.m5833
+from pkg2.pkg18.pkg150 import m5153
+import pkg2.pkg23.pkg186.m1019
+from pkg2.pkg18.pkg152 import m151
+from . import m1798
+
+
+def helper_8887_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8887_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,22 @@
+"""Module 9304."""
+import pkg5.pkg41.pkg333.m9089
+from pkg8.pkg69 import m5906
+import pkg1.pkg12.m11
+from pkg1.pkg13 import m12
+import pkg4.pkg38.m37
+from pkg7 import m423
+import pkg1.m0
+
+
+def helper_9304_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9304_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 3050."""
+import pkg2.pkg22.pkg181.m597
+from pkg5.pkg43.pkg350 import m766
+import pkg5.pkg44.pkg353.m352
+from . import m1799
+
+
+def helper_3050_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3050_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
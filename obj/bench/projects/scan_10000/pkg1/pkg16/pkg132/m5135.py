@@ -0,0 +1,25 @@
+"""Module 5135."""
+import pkg4.pkg33.m32
+from pkg3.pkg27.pkg220 import m2721
+import pkg7.pkg57.m56
+
+
+def helper_5135_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5135_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5135_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
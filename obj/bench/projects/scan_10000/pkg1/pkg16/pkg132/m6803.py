@@ -0,0 +1,23 @@
+"""Module 6803."""
+import pkg1.pkg14.pkg119.m2203
+from pkg2.pkg22 import m21
+import pkg1.pkg9.pkg77.m493
+from . import m1382
+import pkg5.pkg43.pkg347.m346
+from pkg4.pkg36.pkg294 import m293
+import pkg7.pkg62.m61
+from pkg4.pkg34.pkg276 import m692
+
+
+def helper_6803_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6803_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 8054."""
+import pkg1.pkg9.pkg75.m6329
+from pkg4.pkg34.pkg280 import m5700
+import pkg6.pkg49.pkg397.m3315
+from pkg2.pkg23.pkg187 import m603
+import pkg2.pkg17.pkg139.m1389
+
+
+def helper_8054_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8054_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8054_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
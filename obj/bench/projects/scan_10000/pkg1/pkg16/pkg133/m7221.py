@@ -0,0 +1,12 @@
+"""Module 7221."""
+from . import m1800
+from pkg1.pkg12.pkg97 import m7185
+from . import m5970
+from pkg6.pkg51 import m2969
+import pkg2.pkg19.pkg157.m573
+from . import m549
+from . import m2217
+from pkg3.pkg27.pkg223 import m222
+import pkg2.pkg17.pkg139.m4308
+from pkg1 import m0
+from . import m3468
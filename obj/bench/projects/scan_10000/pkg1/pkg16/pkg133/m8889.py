@@ -0,0 +1,23 @@
+"""Module 8889."""
+import pkg2.pkg23.m22
+from pkg4.pkg35.pkg283 import m699
+from . import m8472
+from pkg5 import m4
+import pkg5.pkg48.pkg391.m390
+from pkg8.pkg65 import m64
+import pkg6.pkg50.m466
+from pkg4.pkg39.pkg315 import m314
+
+
+def helper_8889_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8889_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
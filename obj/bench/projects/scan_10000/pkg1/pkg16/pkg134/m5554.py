@@ -0,0 +1,30 @@
+"""Module 5554."""
+import pkg1.m0
+from pkg2.pkg23 import m22
+import pkg3.pkg26.m25
+from pkg4 import m837
+import pkg6.pkg49.pkg394.m1644
+from pkg4.pkg40.pkg322 import m738
+import pkg5.pkg46.pkg370.m4122
+from pkg4.pkg40.pkg328 import m1578
+
+
+def helper_5554_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5554_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5554_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
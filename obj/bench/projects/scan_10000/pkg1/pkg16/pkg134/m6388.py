@@ -0,0 +1,22 @@
+"""Module 6388."""
+import pkg4.pkg33.pkg266.m1516
+from pkg5.pkg41.pkg335 import m751
+import pkg5.pkg47.m46
+from pkg2.pkg19 import m3771
+import pkg4.pkg35.m34
+from pkg2.pkg21 import m2939
+import pkg5.pkg41.m4627
+
+
+def helper_6388_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6388_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
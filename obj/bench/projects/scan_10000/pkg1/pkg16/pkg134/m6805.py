@@ -0,0 +1,62 @@
+"""Module 6805."""
+import pkg3.pkg30.pkg246.m662
+from pkg4.pkg35.pkg287 import m2788
+import pkg1.pkg9.pkg79.m495
+from pkg6.pkg49.pkg395 import m811
+from . import m6388
+from pkg2.pkg21.pkg171 import m170
+import pkg3.m2
+from pkg2.pkg17.pkg138 import m137
+import pkg5.pkg46.m45
+from pkg2.pkg22 import m21
+import pkg1.pkg9.m8
+from pkg2.pkg19 import m18
+
+
+def helper_6805_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6805_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6805_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6805_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_6805_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_6805_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6805_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,12 @@
+"""Module 1385."""
+import pkg2.pkg21.pkg172.m1005
+from pkg1.pkg14.pkg114 import m113
+import pkg1.pkg11.pkg89.m88
+from pkg1.pkg14 import m430
+
+
+def helper_1385_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
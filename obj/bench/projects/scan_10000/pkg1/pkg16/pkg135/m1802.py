@@ -0,0 +1,46 @@
+"""Module 1802."""
+import pkg4.pkg35.pkg286.m1119
+from pkg1.pkg11.pkg92 import m1342
+import pkg4.pkg37.pkg302.m301
+from pkg1 import m0
+import pkg4.pkg40.pkg328.m744
+from pkg2.pkg21.pkg174 import m173
+import pkg1.pkg16.pkg133.m132
+from pkg4.pkg36.pkg293 import m709
+import pkg5.pkg47.pkg380.m379
+from pkg2.pkg18.pkg151 import m150
+
+
+def helper_1802_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1802_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1802_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1802_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_1802_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,9 @@
+"""Module 3470."""
+import pkg6.pkg49.pkg397.m396
+from pkg2.pkg18.pkg147 import m146
+from . import m1802
+from pkg1 import m0
+from . import m2219
+from pkg1.pkg15.pkg124 import m123
+from . import m968
+from pkg3.pkg25.pkg202 import m201
@@ -0,0 +1,22 @@
+"""Module 3887."""
+from . import m551
+from pkg1 import m0
+import pkg2.pkg18.pkg145.m561
+from pkg2 import m1
+import pkg1.pkg9.pkg79.m1746
+from pkg8.pkg69 import m902
+from . import m3053
+
+
+def helper_3887_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3887_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,24 @@
+"""Module 4304."""
+import pkg4.pkg37.pkg301.m2802
+from pkg4.pkg40 import m3375
+from . import m3887
+from pkg3.pkg29 import m28
+from . import m551
+from pkg1 import m0
+import pkg4.pkg40.pkg326.m1159
+from pkg2.pkg22.pkg181 import m1431
+from . import m3470
+
+
+def helper_4304_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4304_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,52 @@
+"""Module 5138."""
+import pkg2.pkg18.m1268
+from pkg5.pkg42.pkg337 import m336
+from . import m2219
+from . import m134
+import pkg5.pkg48.pkg392.m808
+from pkg2.pkg24.pkg197 import m1447
+import pkg5.pkg47.pkg381.m380
+from pkg1.pkg15 import m14
+import pkg1.pkg14.pkg116.m3868
+
+
+def helper_5138_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5138_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5138_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5138_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_5138_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_5138_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,7 @@
+"""Module 5555."""
+import pkg3.pkg28.pkg230.m229
+from pkg1.pkg12.pkg97 import m96
+import pkg3.pkg30.pkg244.m243
+from pkg7.pkg63 import m62
+import pkg1.pkg10.pkg88.m5508
+from pkg1.pkg12 import m11
@@ -0,0 +1,11 @@
+"""Module 8057."""
+import pkg4.pkg34.pkg273.m272
+from pkg2 import m1
+import pkg4.pkg38.pkg309.m5729
+from pkg2.pkg18.pkg148 import m5568
+import pkg6.pkg50.pkg406.m4158
+from pkg1 import m0
+import pkg1.pkg10.pkg88.m921
+from . import m134
+import pkg3.pkg29.pkg234.m233
+from pkg4.pkg35.pkg288 import m1538
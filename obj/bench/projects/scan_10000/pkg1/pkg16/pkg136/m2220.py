@@ -0,0 +1,53 @@
+"""Module 2220."""
+from . import m552
+from pkg4.pkg38.pkg310 import m309
+import pkg2.pkg24.m23
+from . import m135
+import pkg1.pkg14.pkg117.m950
+from pkg5.pkg43.pkg351 import m350
+from . import m1386
+from pkg5.pkg44.pkg355 import m771
+import pkg1.m0
+from pkg4.pkg38.pkg305 import m1972
+
+
+def helper_2220_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2220_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2220_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2220_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_2220_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_2220_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,31 @@
+"""Module 3054."""
+import pkg5.pkg41.pkg332.m331
+from pkg3.pkg31.pkg250 import m249
+import pkg2.pkg22.pkg179.m178
+from . import m1803
+import pkg3.pkg31.pkg254.m253
+from pkg7.pkg63 import m62
+import pkg3.pkg27.m26
+from pkg2.pkg24 import m23
+import pkg1.pkg11.m10
+
+
+def helper_3054_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3054_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3054_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
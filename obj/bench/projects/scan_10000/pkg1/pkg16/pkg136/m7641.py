@@ -0,0 +1,53 @@
+"""Module 7641."""
+import pkg5.pkg45.pkg362.m778
+from pkg5.pkg42.pkg337 import m6174
+import pkg1.pkg10.pkg81.m2999
+from pkg3.pkg32.pkg261 import m260
+import pkg2.pkg19.pkg153.m1820
+from pkg3.pkg29.pkg234 import m6905
+from . import m6807
+from . import m135
+from . import m3471
+from pkg1.pkg10.pkg84 import m5087
+
+
+def helper_7641_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7641_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7641_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7641_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_7641_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_7641_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
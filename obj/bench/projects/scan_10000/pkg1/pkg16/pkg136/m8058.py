@@ -0,0 +1,38 @@
+"""Module 8058."""
+import pkg6.pkg53.m52
+from pkg1.pkg16.pkg134 import m133
+import pkg3.pkg26.pkg216.m1466
+from . import m5973
+from . import m5139
+from pkg1.pkg15.pkg124 import m3876
+import pkg3.pkg32.pkg259.m2760
+from pkg5.pkg48.pkg390 import m4976
+from . import m3888
+
+
+def helper_8058_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8058_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8058_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8058_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
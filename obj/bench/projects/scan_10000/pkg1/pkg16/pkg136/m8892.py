@@ -0,0 +1,25 @@
+"""Module 8892."""
+import pkg1.pkg10.m843
+from . import m1386
+import pkg3.pkg29.pkg238.m654
+from pkg1.pkg9.pkg73 import m7161
+import pkg3.pkg29.pkg238.m1071
+from . import m6390
+import pkg1.pkg16.m15
+from pkg2.pkg21.pkg171 import m170
+import pkg4.pkg39.pkg314.m7819
+from pkg5.pkg42 import m2543
+
+
+def helper_8892_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8892_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
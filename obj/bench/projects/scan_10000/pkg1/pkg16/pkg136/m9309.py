@@ -0,0 +1,30 @@
+"""Module 9309."""
+import pkg4.pkg39.m6710
+from . import m1386
+from . import m3888
+from pkg2.pkg20.pkg166 import m999
+import pkg5.pkg46.pkg375.m2459
+from pkg5.pkg48.pkg390 import m2057
+import pkg1.pkg12.pkg98.m1765
+from pkg4.pkg39.pkg320 import m2404
+
+
+def helper_9309_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9309_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9309_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
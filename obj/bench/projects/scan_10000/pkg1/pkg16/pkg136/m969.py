@@ -0,0 +1,16 @@
+"""Module 969."""
+import pkg3.pkg25.m24
+from pkg1.pkg15 import m14
+import pkg1.pkg9.m8
+from pkg4.pkg36.pkg293 import m709
+import pkg1.m0
+from pkg3.pkg25.pkg208 import m207
+import pkg4.pkg40.m39
+from . import m552
+
+
+def helper_969_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,37 @@
+"""Module 9726."""
+import pkg4.pkg33.pkg267.m5687
+from pkg4.pkg38.pkg308 import m7396
+import pkg2.pkg20.pkg166.m4752
+from pkg1.pkg10 import m9
+import pkg1.pkg16.pkg129.m4298
+from pkg1.pkg13.pkg105 import m521
+from . import m135
+from pkg2.pkg17.pkg138 import m8894
+
+
+def helper_9726_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9726_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9726_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9726_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
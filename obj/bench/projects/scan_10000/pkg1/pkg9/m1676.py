@@ -0,0 +1,12 @@
+"""Module 1676."""
+import pkg1.m0
+from pkg4.pkg37 import m36
+import pkg1.pkg13.m12
+from pkg2.pkg17.pkg137 import m1387
+
+
+def helper_1676_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
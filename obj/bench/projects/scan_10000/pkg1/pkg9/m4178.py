@@ -0,0 +1,28 @@
+"""Module 4178."""
+import pkg4.pkg36.pkg295.m294
+from pkg6.pkg53 import m52
+import pkg6.pkg49.pkg395.m811
+from pkg4.pkg39.pkg314 import m1981
+import pkg1.pkg10.pkg85.m84
+from pkg1.pkg12.pkg101 import m517
+
+
+def helper_4178_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4178_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4178_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
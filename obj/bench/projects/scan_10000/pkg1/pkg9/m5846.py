@@ -0,0 +1,32 @@
+"""Module 5846."""
+import pkg1.pkg14.pkg119.m535
+from pkg3.pkg27 import m4196
+import pkg5.pkg48.pkg391.m807
+from pkg8.pkg65 import m2149
+from . import m2093
+from pkg5.pkg46.pkg371 import m4540
+import pkg4.pkg38.pkg311.m727
+from pkg1.pkg11.pkg93 import m92
+import pkg1.m0
+from pkg4.pkg35 import m34
+
+
+def helper_5846_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5846_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5846_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
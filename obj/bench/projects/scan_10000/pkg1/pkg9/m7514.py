@@ -0,0 +1,34 @@
+"""Module 7514."""
+from . import m1676
+from pkg5.pkg42.pkg337 import m753
+import pkg3.pkg28.m27
+from pkg3.pkg31.pkg255 import m254
+import pkg8.pkg70.m69
+from pkg1.pkg12.pkg103 import m936
+import pkg6.m1256
+from pkg1.pkg12.pkg97 import m96
+import pkg1.pkg14.pkg115.m948
+from pkg2.pkg23.pkg187 import m1020
+from . import m6263
+from pkg3.pkg32 import m31
+
+
+def helper_7514_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7514_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7514_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
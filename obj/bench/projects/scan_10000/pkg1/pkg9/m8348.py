@@ -0,0 +1,27 @@
+"""Module 8348."""
+import pkg1.pkg12.pkg102.m101
+from pkg6.pkg53 import m52
+import pkg4.pkg36.m35
+from pkg4.pkg38.pkg305 import m8227
+import pkg3.m419
+
+
+def helper_8348_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8348_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8348_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
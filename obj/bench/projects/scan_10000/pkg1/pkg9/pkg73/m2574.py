@@ -0,0 +1,38 @@
+"""Module 2574."""
+from . import m489
+from pkg4.pkg36.pkg289 import m1122
+import pkg3.pkg31.pkg251.m1918
+from pkg3.pkg30.pkg246 import m662
+import pkg2.pkg21.m2105
+from pkg1.pkg10.pkg88 import m87
+import pkg2.pkg20.pkg161.m160
+from pkg6.pkg49.pkg400 import m2484
+from . import m72
+
+
+def helper_2574_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2574_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2574_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2574_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
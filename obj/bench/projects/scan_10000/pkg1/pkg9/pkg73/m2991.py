@@ -0,0 +1,20 @@
+"""Module 2991."""
+import pkg4.pkg37.pkg298.m297
+from . import m906
+from . import m489
+from pkg1.pkg12.pkg101 import m517
+import pkg1.pkg9.pkg77.m76
+from pkg5.pkg46 import m45
+import pkg1.pkg16.pkg131.m1798
+from pkg1.pkg14.pkg115 import m1365
+import pkg2.pkg17.pkg143.m559
+from pkg3 import m2
+import pkg1.pkg9.m8
+from pkg3.pkg28 import m27
+
+
+def helper_2991_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,47 @@
+"""Module 3408."""
+import pkg1.pkg12.pkg99.m932
+from pkg4.pkg37.pkg301 import m3219
+import pkg1.pkg14.m13
+from pkg5.pkg47.pkg379 import m378
+import pkg7.pkg58.m1725
+from pkg4.pkg37.pkg298 import m2382
+import pkg2.pkg19.pkg154.m1821
+from pkg3.pkg32.pkg260 import m1510
+import pkg6.pkg56.m3391
+from pkg2.pkg18.pkg145 import m2229
+from . import m1323
+
+
+def helper_3408_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3408_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3408_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3408_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_3408_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
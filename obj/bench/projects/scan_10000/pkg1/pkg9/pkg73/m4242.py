@@ -0,0 +1,19 @@
+"""Module 4242."""
+import pkg2.pkg18.m17
+from . import m2574
+from . import m3825
+from pkg3.pkg30.pkg247 import m246
+
+
+def helper_4242_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4242_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
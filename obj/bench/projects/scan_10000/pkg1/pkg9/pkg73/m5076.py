@@ -0,0 +1,4 @@
+"""Module 5076."""
+from . import m1323
+from pkg5.pkg48.pkg385 import m801
+import pkg5.pkg44.pkg356.m3691
@@ -0,0 +1,45 @@
+"""Module 8829."""
+import pkg1.pkg13.m429
+from . import m5493
+from . import m2157
+from pkg1.pkg16 import m15
+import pkg3.pkg30.m29
+from pkg6.pkg54 import m53
+import pkg1.m0
+from pkg5.pkg48 import m4217
+import pkg5.pkg42.pkg343.m4512
+
+
+def helper_8829_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8829_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8829_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8829_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_8829_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 906."""
+import pkg4.pkg40.pkg322.m321
+from pkg1 import m0
+import pkg5.pkg47.pkg380.m796
+from pkg1.pkg14.pkg114 import m113
+import pkg1.pkg14.pkg118.m117
+from pkg3 import m2
+import pkg2.pkg18.pkg148.m564
+from pkg2.pkg18.pkg148 import m147
+import pkg1.pkg10.pkg83.m499
+from pkg4.pkg40.pkg321 import m320
+from . import m72
+from pkg3.pkg28.pkg232 import m231
+
+
+def helper_906_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_906_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,21 @@
+"""Module 9663."""
+import pkg5.pkg47.pkg380.m3298
+from pkg4.pkg33.pkg268 import m2352
+import pkg3.pkg26.pkg214.m1047
+from . import m1323
+import pkg3.pkg27.pkg224.m6061
+from pkg2.pkg22.pkg179 import m1012
+
+
+def helper_9663_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9663_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,37 @@
+"""Module 1324."""
+import pkg4.pkg39.pkg316.m1149
+from pkg2.pkg21 import m20
+import pkg4.pkg40.m1290
+from pkg5.pkg48.pkg385 import m384
+import pkg1.pkg15.pkg121.m120
+from pkg2.pkg20.pkg165 import m581
+import pkg6.pkg55.m54
+from pkg2.pkg21 import m437
+
+
+def helper_1324_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1324_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1324_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1324_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
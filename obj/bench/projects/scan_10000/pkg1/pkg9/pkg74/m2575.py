@@ -0,0 +1,28 @@
+"""Module 2575."""
+import pkg2.pkg20.pkg167.m2251
+from pkg1.pkg16 import m849
+import pkg2.pkg23.pkg185.m1018
+from pkg2.pkg22 import m21
+import pkg1.pkg10.pkg83.m2167
+from . import m73
+
+
+def helper_2575_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2575_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2575_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
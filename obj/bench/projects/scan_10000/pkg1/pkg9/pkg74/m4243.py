@@ -0,0 +1,29 @@
+"""Module 4243."""
+import pkg1.pkg12.m428
+from pkg5.pkg45 import m44
+import pkg5.pkg41.pkg330.m1163
+from . import m1324
+import pkg3.pkg28.m3780
+from pkg4.pkg35.pkg285 import m284
+import pkg3.pkg29.pkg234.m1484
+
+
+def helper_4243_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4243_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4243_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
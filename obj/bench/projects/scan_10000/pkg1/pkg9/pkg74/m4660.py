@@ -0,0 +1,46 @@
+"""Module 4660."""
+import pkg2.pkg18.pkg145.m144
+from pkg4.pkg37.pkg297 import m713
+import pkg1.pkg12.m11
+from pkg8.pkg67 import m66
+from . import m1741
+from pkg5.pkg41.pkg334 import m333
+import pkg1.m0
+from . import m907
+import pkg5.pkg41.pkg335.m334
+from pkg1.pkg15.pkg122 import m121
+
+
+def helper_4660_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4660_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4660_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4660_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_4660_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 6328."""
+import pkg3.pkg25.pkg208.m1041
+from pkg5.pkg41.pkg329 import m1162
+import pkg5.pkg42.pkg340.m6177
+from . import m1741
+import pkg2.pkg24.pkg195.m194
+from . import m2575
+import pkg1.m0
+from pkg2.pkg23.pkg188 import m187
+import pkg7.m6
+from pkg1.pkg12.pkg98 import m5101
+
+
+def helper_6328_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
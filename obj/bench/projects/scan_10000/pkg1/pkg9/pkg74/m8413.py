@@ -0,0 +1,20 @@
+"""Module 8413."""
+import pkg3.pkg26.pkg216.m215
+from . import m490
+import pkg2.pkg20.pkg166.m4335
+from pkg4.pkg35.pkg284 import m5287
+import pkg2.pkg22.m21
+
+
+def helper_8413_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8413_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
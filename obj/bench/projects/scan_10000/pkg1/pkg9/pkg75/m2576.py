@@ -0,0 +1,13 @@
+"""Module 2576."""
+import pkg1.pkg11.pkg91.m90
+from pkg2.pkg19 import m18
+import pkg2.pkg24.pkg197.m613
+from pkg3.pkg30.pkg243 import m1493
+import pkg1.pkg9.m425
+from . import m491
+import pkg2.pkg20.m19
+from pkg5.pkg43.pkg352 import m1185
+import pkg2.m1
+from pkg1 import m0
+from . import m2159
+from pkg3 import m2
@@ -0,0 +1,26 @@
+"""Module 3410."""
+import pkg1.pkg10.pkg84.m1334
+from pkg2.pkg21.pkg171 import m170
+import pkg2.pkg22.pkg182.m1849
+from pkg2 import m1
+import pkg3.pkg30.pkg243.m1493
+from pkg3.pkg31 import m30
+import pkg1.pkg9.m8
+from . import m1742
+import pkg5.pkg42.pkg337.m3255
+from pkg3 import m2
+import pkg6.pkg50.pkg404.m403
+
+
+def helper_3410_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3410_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,33 @@
+"""Module 4244."""
+import pkg4.pkg36.pkg292.m2793
+from pkg1.pkg15.pkg121 import m120
+import pkg1.m0
+from pkg3.pkg30.pkg243 import m3161
+import pkg1.pkg16.pkg129.m3881
+from pkg4.pkg35.pkg286 import m2787
+import pkg2.pkg17.pkg141.m1391
+from pkg5.pkg46.pkg372 import m2456
+import pkg1.pkg13.pkg106.m939
+from pkg2.pkg19.pkg153 import m569
+import pkg3.pkg26.m859
+
+
+def helper_4244_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4244_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4244_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
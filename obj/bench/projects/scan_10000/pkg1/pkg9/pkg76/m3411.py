@@ -0,0 +1,21 @@
+"""Module 3411."""
+import pkg3.pkg28.pkg227.m226
+from pkg1.pkg9.pkg73 import m2574
+import pkg4.pkg40.pkg328.m327
+from pkg1.pkg13.pkg110 import m2194
+import pkg1.pkg16.m15
+from pkg2.pkg23.pkg188 import m2689
+
+
+def helper_3411_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3411_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,45 @@
+"""Module 4662."""
+import pkg1.pkg16.pkg129.m128
+from pkg1.pkg12.pkg99 import m932
+import pkg2.pkg24.pkg197.m4366
+from pkg1.pkg9.pkg80 import m79
+import pkg3.pkg32.pkg258.m257
+from . import m75
+import pkg8.pkg72.m1322
+from pkg3.pkg31 import m30
+import pkg1.pkg14.pkg116.m4285
+
+
+def helper_4662_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4662_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4662_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4662_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_4662_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
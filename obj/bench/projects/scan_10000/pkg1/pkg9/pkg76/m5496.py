@@ -0,0 +1,31 @@
+"""Module 5496."""
+import pkg5.pkg47.pkg381.m797
+from pkg7.pkg59 import m58
+import pkg5.pkg43.pkg349.m1599
+from pkg7.pkg64 import m63
+from . import m4662
+from . import m2160
+import pkg4.pkg37.pkg297.m2798
+from . import m909
+from . import m4245
+
+
+def helper_5496_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5496_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5496_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
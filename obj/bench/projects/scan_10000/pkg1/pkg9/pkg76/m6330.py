@@ -0,0 +1,62 @@
+"""Module 6330."""
+from . import m5496
+from pkg4.pkg34 import m33
+import pkg4.pkg36.pkg296.m2380
+from pkg6.pkg51.pkg416 import m3334
+import pkg5.pkg41.m1708
+from . import m5079
+import pkg2.pkg23.m22
+from pkg2.pkg18 import m434
+import pkg1.pkg11.pkg89.m922
+from pkg5 import m4
+import pkg6.pkg55.m2973
+from pkg1 import m0
+
+
+def helper_6330_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6330_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6330_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6330_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_6330_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_6330_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6330_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,30 @@
+"""Module 7164."""
+from . import m3828
+from . import m4662
+from . import m5913
+from pkg3.pkg31.pkg256 import m2340
+import pkg5.pkg48.m47
+from pkg5.pkg44.pkg358 import m4944
+from . import m909
+from pkg4 import m3
+
+
+def helper_7164_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7164_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7164_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,34 @@
+"""Module 8415."""
+import pkg1.m0
+from pkg1.pkg15.pkg124 import m1791
+import pkg5.pkg48.pkg387.m2888
+from pkg3.pkg31.pkg254 import m4423
+import pkg1.pkg9.m8
+from . import m7581
+import pkg1.pkg11.pkg95.m5098
+from . import m4245
+from . import m6747
+from pkg8.pkg70 import m4656
+import pkg3.pkg31.pkg255.m4841
+from pkg5 import m4
+
+
+def helper_8415_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8415_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8415_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 9249."""
+import pkg2.pkg19.pkg157.m5577
+from pkg2.pkg22.pkg180 import m8519
+import pkg3.pkg31.m2115
+from pkg2.pkg24.pkg199 import m2283
+
+
+def helper_9249_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9249_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,62 @@
+"""Module 1744."""
+import pkg5.pkg41.pkg332.m331
+from pkg6.pkg51.pkg415 import m414
+import pkg1.pkg15.pkg128.m127
+from pkg2.pkg24.pkg198 import m1031
+import pkg8.pkg72.m71
+from pkg2.pkg18.pkg147 import m1397
+import pkg6.pkg49.pkg399.m1649
+from pkg5.pkg48.pkg390 import m806
+import pkg2.pkg18.m17
+from . import m910
+import pkg1.m0
+from pkg8 import m7
+
+
+def helper_1744_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1744_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1744_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1744_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_1744_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_1744_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1744_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,15 @@
+"""Module 5914."""
+import pkg5.pkg42.pkg339.m1589
+from pkg1.pkg12.pkg97 import m3849
+import pkg5.pkg45.pkg365.m364
+from pkg1.pkg9.pkg73 import m906
+import pkg2.pkg17.pkg138.m137
+from . import m493
+import pkg6.pkg51.pkg416.m1666
+
+
+def helper_5914_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,22 @@
+"""Module 6331."""
+import pkg1.pkg15.m14
+from . import m2578
+import pkg3.pkg31.pkg249.m2750
+from pkg3.pkg30.pkg248 import m2332
+from . import m3412
+from pkg1.pkg11 import m10
+import pkg6.pkg55.m54
+
+
+def helper_6331_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6331_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
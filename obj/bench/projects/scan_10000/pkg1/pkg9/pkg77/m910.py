@@ -0,0 +1,14 @@
+"""Module 910."""
+import pkg2.pkg20.pkg163.m579
+from pkg8.pkg66 import m65
+import pkg1.m0
+from pkg3.pkg25 import m24
+import pkg1.pkg16.m15
+from . import m76
+
+
+def helper_910_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,12 @@
+"""Module 9250."""
+import pkg3.pkg26.pkg212.m211
+from pkg5.pkg42.pkg340 import m2007
+import pkg5.pkg46.pkg374.m1207
+from pkg2.pkg18.pkg151 import m984
+import pkg1.pkg10.pkg87.m86
+from pkg5.pkg44.pkg357 import m356
+import pkg5.pkg41.pkg329.m4915
+from pkg1 import m0
+import pkg1.pkg10.pkg86.m1336
+from . import m6331
+import pkg3.pkg29.pkg233.m649
@@ -0,0 +1,11 @@
+"""Module 9667."""
+import pkg4.pkg39.pkg313.m4482
+from pkg5.pkg41.pkg336 import m2003
+from . import m2161
+
+
+def helper_9667_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,21 @@
+"""Module 3830."""
+from . import m3413
+from pkg4.pkg37.pkg303 import m2387
+from . import m2579
+from . import m77
+import pkg4.pkg35.m34
+from pkg1 import m0
+
+
+def helper_3830_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3830_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
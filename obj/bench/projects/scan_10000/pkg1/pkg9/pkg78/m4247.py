@@ -0,0 +1,26 @@
+"""Module 4247."""
+import pkg6.pkg50.pkg404.m1654
+from pkg2.pkg20.pkg166 import m1416
+import pkg2.pkg21.pkg171.m3923
+from pkg1.pkg16.pkg130 import m129
+from . import m2579
+from pkg3.pkg27 import m1277
+import pkg1.pkg9.pkg76.m2577
+from pkg2.pkg24.pkg196 import m3948
+import pkg3.pkg29.pkg235.m2319
+from pkg1.pkg12 import m11
+import pkg4.m3
+
+
+def helper_4247_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4247_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
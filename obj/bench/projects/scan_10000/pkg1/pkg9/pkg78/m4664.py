@@ -0,0 +1,10 @@
+"""Module 4664."""
+import pkg2.pkg19.pkg153.m152
+from . import m2996
+
+
+def helper_4664_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
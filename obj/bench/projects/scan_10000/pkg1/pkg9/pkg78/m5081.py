@@ -0,0 +1,54 @@
+"""Module 5081."""
+import pkg5.pkg46.pkg372.m1622
+from pkg1.pkg11.pkg94 import m1761
+import pkg4.pkg37.pkg298.m3216
+from . import m4664
+from . import m911
+from pkg6.pkg51.pkg413 import m1246
+import pkg4.pkg33.pkg272.m4858
+from pkg7.pkg60 import m3812
+import pkg2.pkg18.m17
+from pkg1.pkg13.pkg112 import m111
+import pkg3.pkg30.pkg241.m3159
+
+
+def helper_5081_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5081_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5081_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5081_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_5081_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_5081_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
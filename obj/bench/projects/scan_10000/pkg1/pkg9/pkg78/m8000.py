@@ -0,0 +1,47 @@
+"""Module 8000."""
+import pkg2.pkg17.pkg139.m3891
+from pkg1.pkg14.pkg113 import m2614
+import pkg1.pkg13.m846
+from pkg4.pkg37.pkg303 import m1136
+from . import m2996
+from pkg5.pkg42.pkg343 import m7014
+import pkg4.pkg33.pkg268.m4854
+from pkg2.pkg21.pkg174 import m3509
+import pkg3.pkg29.pkg234.m233
+from . import m7166
+from . import m5915
+
+
+def helper_8000_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8000_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8000_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8000_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_8000_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,24 @@
+"""Module 8834."""
+import pkg6.pkg50.pkg402.m401
+from pkg1 import m0
+import pkg5.pkg42.pkg339.m338
+from pkg2.pkg24.pkg195 import m2279
+import pkg1.pkg13.pkg107.m523
+from pkg5.pkg45.pkg365 import m3283
+import pkg3.pkg29.pkg236.m5239
+from pkg4.pkg40.pkg321 import m3656
+import pkg4.m4173
+
+
+def helper_8834_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8834_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 911."""
+import pkg8.pkg71.m70
+from . import m77
+import pkg1.m0
+from pkg5.pkg48 import m47
+import pkg2.pkg19.m18
+
+
+def helper_911_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_911_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,41 @@
+"""Module 5499."""
+import pkg2.pkg17.m433
+from pkg3.pkg29 import m2947
+import pkg1.pkg14.pkg115.m114
+from pkg6.pkg51.pkg411 import m4580
+from . import m4665
+from pkg1.pkg16.pkg136 import m135
+import pkg3.pkg31.pkg253.m669
+from pkg4.pkg38 import m37
+import pkg1.m0
+from . import m3831
+import pkg6.pkg55.m888
+from . import m912
+
+
+def helper_5499_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5499_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5499_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5499_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,37 @@
+"""Module 5916."""
+import pkg1.pkg11.pkg95.m3847
+from . import m4665
+import pkg5.pkg45.pkg365.m1615
+from pkg3.pkg28.pkg227 import m2728
+import pkg2.pkg23.pkg187.m186
+from pkg5.pkg41.pkg333 import m2834
+import pkg5.pkg46.pkg370.m4122
+from . import m912
+
+
+def helper_5916_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5916_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5916_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5916_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
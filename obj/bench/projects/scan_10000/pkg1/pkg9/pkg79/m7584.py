@@ -0,0 +1,41 @@
+"""Module 7584."""
+import pkg1.pkg10.pkg82.m1749
+from pkg1.pkg9.pkg74 import m2992
+import pkg1.m0
+from pkg6.pkg51.pkg415 import m831
+import pkg2.pkg22.pkg180.m5183
+from pkg3.pkg31.pkg253 import m252
+import pkg1.pkg12.m11
+from pkg1.pkg16 import m7104
+import pkg4.pkg37.pkg298.m4884
+from . import m3414
+from . import m2163
+from pkg4.pkg34.pkg280 import m3615
+
+
+def helper_7584_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7584_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7584_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7584_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,8 @@
+"""Module 2998."""
+import pkg5.pkg42.m41
+from . import m1747
+import pkg5.pkg42.pkg337.m336
+from pkg3.pkg28.pkg225 import m224
+from . import m79
+from pkg4.pkg33.pkg270 import m686
+import pkg1.pkg11.pkg95.m94
@@ -0,0 +1,27 @@
+"""Module 496."""
+from . import m79
+from pkg1 import m0
+import pkg5.m4
+from pkg3.pkg25 import m441
+import pkg8.pkg71.m487
+
+
+def helper_496_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_496_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_496_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
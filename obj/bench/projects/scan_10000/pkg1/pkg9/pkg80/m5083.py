@@ -0,0 +1,19 @@
+"""Module 5083."""
+from . import m2581
+from pkg1.pkg13.pkg107 import m106
+import pkg2.pkg22.pkg181.m597
+from pkg6.pkg49.pkg400 import m1233
+
+
+def helper_5083_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5083_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 6334."""
+import pkg5.pkg48.m3383
+from pkg4.pkg33.pkg265 import m1098
+import pkg1.pkg16.m15
+from pkg1.pkg9.pkg74 import m490
+from . import m2581
+from pkg6.pkg56 import m5893
+from . import m2998
+from pkg2.pkg19.pkg156 import m1406
+from . import m79
+from pkg5.pkg48.pkg387 import m803
+import pkg1.pkg9.pkg73.m2157
+
+
+def helper_6334_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 6751."""
+from . import m5500
+from pkg4.pkg36.pkg295 import m5715
+import pkg6.pkg50.pkg408.m1241
+from . import m4249
+import pkg5.m4
+from pkg6.pkg52 import m51
+from . import m2581
+from pkg2.pkg18.pkg145 import m3063
+import pkg7.m423
+from pkg5.pkg42.pkg339 import m755
+
+
+def helper_6751_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6751_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 7168."""
+import pkg4.pkg38.pkg309.m6563
+from . import m5500
+from . import m4249
+
+
+def helper_7168_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7168_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,47 @@
+"""Module 8419."""
+import pkg3.m2
+from pkg3.pkg29.pkg238 import m1488
+import pkg3.pkg25.pkg203.m202
+from pkg5.pkg43.pkg352 import m2853
+import pkg5.pkg41.pkg331.m1998
+from pkg1.pkg10 import m9
+import pkg3.pkg29.pkg240.m239
+from pkg4.pkg40.pkg323 import m4075
+from . import m7585
+from pkg6.pkg50 import m3802
+from . import m5500
+
+
+def helper_8419_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8419_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8419_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8419_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_8419_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
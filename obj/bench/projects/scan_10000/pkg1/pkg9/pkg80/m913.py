@@ -0,0 +1,39 @@
+"""Module 913."""
+import pkg1.pkg16.m15
+from pkg2 import m1
+import pkg5.pkg47.pkg380.m379
+from pkg2.pkg24.pkg196 import m612
+from . import m79
+from pkg5.pkg42 import m41
+import pkg5.pkg41.pkg336.m752
+from pkg1 import m0
+from . import m496
+from pkg4.pkg37 import m453
+
+
+def helper_913_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_913_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_913_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_913_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
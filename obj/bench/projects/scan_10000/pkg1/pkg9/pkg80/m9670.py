@@ -0,0 +1,29 @@
+"""Module 9670."""
+import pkg1.pkg13.pkg105.m104
+from . import m6334
+import pkg2.pkg20.pkg162.m7667
+from . import m9253
+import pkg1.pkg16.pkg129.m128
+from pkg4.pkg35.pkg288 import m1955
+import pkg6.pkg54.m53
+
+
+def helper_9670_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9670_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9670_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,55 @@
+"""Module 4171."""
+import pkg1.m0
+from pkg3.pkg31.pkg253 import m1086
+from . import m2086
+from pkg3.pkg29.pkg235 import m2736
+import pkg5.pkg44.m43
+from . import m1
+import pkg4.pkg36.pkg292.m708
+from pkg4.pkg34.pkg278 import m1111
+import pkg4.pkg39.pkg319.m1152
+from pkg3.pkg28.pkg228 import m1061
+import pkg2.pkg24.pkg193.m192
+from pkg5.pkg41.pkg336 import m1169
+
+
+def helper_4171_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4171_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4171_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4171_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_4171_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_4171_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,30 @@
+"""Module 418."""
+import pkg2.pkg23.m22
+from pkg1 import m0
+import pkg5.pkg41.pkg336.m335
+from pkg5.pkg47 import m46
+import pkg5.pkg46.pkg376.m375
+from pkg3.pkg27.pkg221 import m220
+import pkg1.pkg13.pkg112.m111
+from pkg4.pkg33.pkg268 import m267
+
+
+def helper_418_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_418_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_418_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
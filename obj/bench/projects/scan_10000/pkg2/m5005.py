@@ -0,0 +1,29 @@
+"""Module 5005."""
+import pkg7.m6
+from pkg1.pkg15.pkg128 import m1378
+import pkg4.pkg36.pkg295.m711
+from pkg4.pkg34.pkg277 import m693
+import pkg4.pkg40.pkg328.m1578
+from pkg2.pkg23.pkg185 import m3103
+from . import m1252
+
+
+def helper_5005_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5005_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5005_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 6673."""
+import pkg2.pkg22.pkg178.m177
+from . import m6256
+from . import m1669
+from pkg3.pkg29 import m2113
+import pkg2.pkg20.pkg163.m5583
+from . import m2503
+import pkg1.pkg14.pkg118.m117
+from pkg2.pkg17 import m3352
+import pkg4.pkg35.pkg282.m4868
+from pkg6.pkg49.pkg394 import m2061
+import pkg3.pkg28.pkg226.m1476
+
+
+def helper_6673_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6673_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
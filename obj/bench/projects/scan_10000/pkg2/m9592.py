@@ -0,0 +1,41 @@
+"""Module 9592."""
+import pkg2.pkg19.pkg155.m2239
+from . import m3337
+from . import m1252
+from pkg4.pkg35 import m3370
+import pkg6.pkg51.m6722
+from pkg5.pkg41.pkg336 import m752
+from . import m7507
+from pkg3.pkg25.pkg206 import m2290
+import pkg2.pkg21.pkg176.m3511
+from pkg1.pkg16.pkg136 import m3054
+import pkg2.pkg20.pkg161.m1828
+from pkg1.pkg11.pkg95 import m94
+
+
+def helper_9592_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9592_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9592_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9592_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,32 @@
+"""Module 2935."""
+from . import m2101
+from pkg3.pkg29.pkg236 import m235
+import pkg6.pkg51.pkg416.m415
+from pkg2 import m1
+import pkg3.pkg30.m1280
+from pkg1.pkg11.pkg95 import m94
+import pkg5.m4
+from pkg1 import m0
+import pkg4.pkg36.pkg295.m711
+from pkg4.pkg40.pkg322 import m1155
+
+
+def helper_2935_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2935_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2935_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 3352."""
+from . import m433
+from pkg7.pkg59 import m475
+from . import m850
+from pkg5.pkg43.pkg352 import m2019
+import pkg5.pkg41.m1291
+from pkg1.pkg11 import m10
+from . import m2518
+from pkg4.pkg36.pkg290 import m289
+import pkg2.pkg20.pkg168.m167
+from . import m16
+from . import m2101
+
+
+def helper_3352_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3352_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 3769."""
+import pkg6.pkg50.pkg402.m2486
+from . import m2935
+import pkg5.pkg46.m2964
+from pkg2.pkg19 import m18
+from . import m2101
+
+
+def helper_3769_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3769_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3769_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 6271."""
+import pkg4.pkg38.pkg312.m1979
+from . import m2935
+import pkg3.pkg29.pkg240.m6077
+
+
+def helper_6271_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 3055."""
+import pkg1.m0
+from pkg1.pkg16.pkg131 import m130
+import pkg3.pkg29.m1696
+from . import m136
+from . import m1804
+from pkg1.pkg15.pkg126 import m125
+from . import m1387
+from pkg5.pkg46.pkg370 import m2454
+import pkg1.pkg14.pkg114.m2615
+from pkg4.pkg34.pkg277 import m693
+from . import m2221
+from pkg1.pkg9 import m8
+
+
+def helper_3055_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3055_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
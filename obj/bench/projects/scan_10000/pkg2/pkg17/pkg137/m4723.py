@@ -0,0 +1,15 @@
+"""Module 4723."""
+import pkg8.pkg66.m2567
+from . import m3055
+import pkg1.pkg9.pkg77.m76
+from pkg5 import m4
+from . import m2221
+from pkg7.pkg64 import m63
+import pkg5.pkg41.m457
+
+
+def helper_4723_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 5974."""
+import pkg2.pkg21.pkg170.m4756
+from . import m553
+import pkg5.pkg41.pkg336.m335
+from pkg2.pkg20.pkg163 import m162
+import pkg2.pkg19.pkg154.m5574
+from pkg6.pkg50.pkg408 import m4994
+import pkg2.pkg17.pkg141.m140
+from pkg8.pkg72 import m71
+import pkg3.pkg30.pkg248.m247
+from . import m5140
+import pkg5.pkg45.m878
+
+
+def helper_5974_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5974_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,9 @@
+"""Module 8476."""
+import pkg5.pkg48.pkg389.m3724
+
+
+def helper_8476_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
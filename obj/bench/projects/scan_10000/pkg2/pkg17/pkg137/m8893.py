@@ -0,0 +1,17 @@
+"""Module 8893."""
+import pkg3.pkg31.pkg250.m7755
+from pkg4.pkg39.pkg316 import m5319
+
+
+def helper_8893_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8893_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,34 @@
+"""Module 3473."""
+import pkg5.pkg44.pkg359.m1609
+from pkg3.pkg30 import m29
+from . import m2639
+from . import m1388
+import pkg5.pkg46.pkg376.m2043
+from pkg7.pkg63 import m479
+import pkg6.pkg54.m53
+from pkg4.pkg36.pkg293 import m709
+import pkg3.pkg26.pkg211.m210
+from pkg3 import m2
+import pkg3.pkg30.pkg247.m663
+from . import m971
+
+
+def helper_3473_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3473_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3473_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
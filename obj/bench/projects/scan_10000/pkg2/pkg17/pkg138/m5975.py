@@ -0,0 +1,14 @@
+"""Module 5975."""
+from . import m137
+from pkg2.pkg18.pkg149 import m1399
+import pkg3.pkg31.pkg249.m2750
+from pkg4.pkg35.pkg281 import m5701
+import pkg6.pkg50.pkg408.m4994
+from pkg5.pkg43.pkg351 import m2852
+
+
+def helper_5975_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
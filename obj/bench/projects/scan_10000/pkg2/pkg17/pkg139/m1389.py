@@ -0,0 +1,23 @@
+"""Module 1389."""
+from . import m138
+from pkg5.pkg44.pkg353 import m769
+from . import m972
+from pkg3.pkg27.pkg223 import m222
+from . import m555
+from pkg1.pkg16.pkg129 import m128
+import pkg8.pkg72.m71
+from pkg2.pkg19.pkg156 import m155
+
+
+def helper_1389_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1389_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
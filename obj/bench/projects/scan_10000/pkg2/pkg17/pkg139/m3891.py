@@ -0,0 +1,10 @@
+"""Module 3891."""
+import pkg1.pkg12.m11
+from pkg1.pkg10.pkg86 import m3004
+
+
+def helper_3891_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,34 @@
+"""Module 5142."""
+import pkg5.m4
+from pkg1.pkg16.pkg132 import m1382
+import pkg1.pkg14.pkg117.m950
+from . import m972
+import pkg1.pkg15.pkg128.m3046
+from pkg1.pkg11.pkg91 import m90
+import pkg3.pkg30.m4616
+from . import m2223
+import pkg4.pkg38.pkg310.m309
+from pkg1.pkg16.pkg136 import m552
+from . import m3057
+from . import m555
+
+
+def helper_5142_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5142_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5142_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
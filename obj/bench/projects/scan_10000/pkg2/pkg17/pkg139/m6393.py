@@ -0,0 +1,19 @@
+"""Module 6393."""
+import pkg1.pkg16.pkg131.m547
+from pkg3.pkg30 import m446
+import pkg1.pkg15.pkg123.m122
+from pkg3.pkg26.pkg211 import m1044
+from . import m5142
+from pkg2.pkg21 import m4607
+from . import m1389
+from pkg4.pkg39.pkg318 import m734
+import pkg4.pkg36.pkg292.m1959
+from pkg2.pkg22.pkg177 import m593
+import pkg6.pkg51.pkg413.m2080
+
+
+def helper_6393_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,54 @@
+"""Module 8895."""
+import pkg4.pkg38.pkg306.m305
+from pkg1.pkg16.pkg132 import m548
+import pkg4.pkg39.m1706
+from pkg6.pkg50 import m49
+from . import m2223
+from pkg5.pkg45.pkg364 import m7869
+import pkg7.pkg61.m6732
+from pkg1.pkg13.pkg112 import m945
+import pkg6.pkg49.pkg394.m5814
+from pkg3.pkg29.pkg235 import m651
+import pkg1.pkg9.pkg73.m72
+
+
+def helper_8895_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8895_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8895_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8895_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_8895_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_8895_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,47 @@
+"""Module 2641."""
+import pkg4.pkg35.pkg283.m282
+from pkg6.pkg53 import m1303
+import pkg4.pkg37.pkg298.m297
+from . import m973
+import pkg5.pkg43.m42
+from pkg7.pkg59 import m58
+import pkg1.m0
+from . import m556
+import pkg1.pkg9.m8
+from . import m1390
+import pkg7.pkg58.m57
+
+
+def helper_2641_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2641_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2641_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2641_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_2641_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
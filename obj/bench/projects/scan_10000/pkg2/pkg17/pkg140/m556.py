@@ -0,0 +1,38 @@
+"""Module 556."""
+import pkg2.pkg21.pkg173.m172
+from pkg2 import m1
+import pkg1.pkg11.pkg90.m89
+from . import m139
+import pkg6.pkg55.m54
+from pkg3 import m2
+import pkg2.pkg23.pkg187.m186
+from pkg1 import m0
+import pkg4.pkg35.pkg284.m283
+
+
+def helper_556_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_556_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_556_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_556_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
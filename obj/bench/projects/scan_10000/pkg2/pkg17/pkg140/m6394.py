@@ -0,0 +1,38 @@
+"""Module 6394."""
+import pkg3.pkg28.pkg229.m228
+from pkg6.pkg51.pkg416 import m2083
+import pkg3.pkg32.pkg259.m1509
+from . import m4726
+from . import m1807
+from pkg4.pkg36 import m2954
+import pkg5.pkg48.pkg386.m385
+from pkg4.pkg40.pkg325 import m1158
+import pkg3.pkg32.pkg262.m1929
+
+
+def helper_6394_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6394_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6394_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6394_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,33 @@
+"""Module 8062."""
+import pkg4.pkg36.pkg291.m4460
+from pkg3.pkg29 import m28
+import pkg5.pkg48.pkg389.m4558
+from pkg5.pkg46.pkg372 import m371
+import pkg4.pkg38.m4624
+from . import m2224
+from . import m556
+from . import m5977
+import pkg1.pkg10.pkg86.m6340
+from pkg1.pkg10.pkg88 import m6342
+import pkg3.pkg31.pkg253.m2754
+
+
+def helper_8062_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8062_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8062_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,9 @@
+"""Module 140."""
+import pkg1.m0
+from pkg7.pkg63 import m62
+import pkg1.pkg12.pkg98.m97
+from pkg1.pkg10.pkg84 import m83
+import pkg1.pkg11.pkg89.m88
+from pkg8.pkg70 import m69
+import pkg1.pkg10.m9
+from pkg1.pkg14 import m13
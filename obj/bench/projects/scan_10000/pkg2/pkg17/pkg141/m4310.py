@@ -0,0 +1,69 @@
+"""Module 4310."""
+from . import m3893
+from pkg2.pkg24.pkg196 import m195
+import pkg2.pkg23.pkg188.m187
+from pkg1.pkg16.pkg134 import m967
+import pkg5.pkg48.pkg388.m804
+from pkg1.pkg10.pkg86 import m3421
+from . import m557
+from pkg1.pkg9.pkg78 import m77
+import pkg3.pkg30.pkg246.m245
+from pkg2.pkg24.pkg198 import m614
+import pkg6.pkg51.pkg411.m1661
+from pkg6.pkg52 import m885
+
+
+def helper_4310_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4310_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4310_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4310_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_4310_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_4310_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4310_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4310_42(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,36 @@
+"""Module 8897."""
+from . import m1808
+from pkg5.pkg44 import m43
+import pkg1.pkg12.pkg97.m96
+from pkg1.pkg11.pkg95 import m94
+import pkg8.m7
+from pkg6.pkg49.pkg395 import m811
+import pkg1.pkg12.pkg99.m98
+
+
+def helper_8897_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8897_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8897_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8897_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 3060."""
+import pkg1.pkg12.pkg97.m96
+from pkg4.pkg33.pkg272 import m688
+import pkg2.pkg20.pkg163.m162
+from pkg5 import m838
+import pkg2.pkg17.pkg144.m2645
+from pkg4.pkg35.pkg283 import m282
+import pkg7.m6
+from . import m558
+from . import m2226
+from pkg2.pkg19.pkg154 import m570
+from . import m141
+from pkg1.pkg9 import m8
+
+
+def helper_3060_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1 @@
+"""Module 6396."""
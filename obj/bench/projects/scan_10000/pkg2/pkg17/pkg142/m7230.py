@@ -0,0 +1,53 @@
+"""Module 7230."""
+import pkg6.m5
+from pkg1.pkg13.pkg110 import m943
+import pkg3.pkg30.pkg243.m1910
+from . import m558
+import pkg4.pkg39.pkg319.m2403
+from pkg4.pkg39.pkg318 import m317
+import pkg3.pkg30.m6701
+from pkg4.pkg40.pkg324 import m740
+import pkg1.pkg9.pkg75.m74
+from pkg3.pkg31.pkg251 import m1501
+
+
+def helper_7230_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7230_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7230_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7230_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_7230_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_7230_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
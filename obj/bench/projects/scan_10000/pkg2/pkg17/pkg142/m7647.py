@@ -0,0 +1,29 @@
+"""Module 7647."""
+import pkg1.pkg9.pkg79.m495
+from . import m2643
+import pkg2.pkg18.pkg146.m562
+from pkg4.pkg35.pkg286 import m702
+import pkg6.pkg51.pkg416.m1249
+from pkg5 import m2923
+import pkg1.pkg13.m12
+
+
+def helper_7647_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7647_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7647_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 8481."""
+import pkg6.pkg50.pkg402.m1235
+from . import m7230
+import pkg4.pkg37.pkg298.m6552
+from . import m4728
+from . import m8064
+from pkg5.pkg47.pkg380 import m1630
+import pkg4.pkg38.pkg309.m308
+from pkg2.pkg22.pkg180 import m1430
+import pkg1.pkg9.m8
+
+
+def helper_8481_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
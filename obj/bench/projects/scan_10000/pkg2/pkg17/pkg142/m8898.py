@@ -0,0 +1,54 @@
+"""Module 8898."""
+import pkg3.pkg30.pkg241.m4410
+from pkg1 import m0
+from . import m7230
+from . import m1809
+import pkg4.pkg34.pkg278.m277
+from pkg1.pkg13.pkg107 import m1357
+import pkg4.pkg38.pkg306.m305
+from pkg5.pkg43.pkg347 import m6184
+import pkg3.pkg25.m24
+from pkg5.pkg43.pkg345 import m8267
+import pkg3.pkg28.m27
+
+
+def helper_8898_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8898_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8898_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8898_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_8898_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_8898_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 975."""
+import pkg6.pkg55.m54
+from pkg3.pkg28.pkg231 import m230
+import pkg8.pkg69.m68
+
+
+def helper_975_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
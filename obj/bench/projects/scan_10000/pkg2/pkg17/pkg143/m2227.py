@@ -0,0 +1,17 @@
+"""Module 2227."""
+import pkg3.pkg25.pkg203.m202
+from pkg6.pkg49.pkg393 import m1643
+
+
+def helper_2227_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2227_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
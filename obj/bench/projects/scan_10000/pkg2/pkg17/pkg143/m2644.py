@@ -0,0 +1,19 @@
+"""Module 2644."""
+import pkg4.pkg39.pkg315.m314
+from pkg2.pkg18.pkg145 import m978
+import pkg1.m0
+from pkg1.pkg15.pkg127 import m126
+import pkg3.m2
+from . import m1810
+import pkg4.pkg37.m870
+from pkg1.pkg15.pkg124 import m2625
+import pkg3.pkg30.m29
+from pkg1.pkg10.pkg86 import m919
+import pkg3.pkg25.pkg202.m201
+
+
+def helper_2644_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
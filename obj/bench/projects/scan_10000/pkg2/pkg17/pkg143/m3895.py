@@ -0,0 +1,13 @@
+"""Module 3895."""
+from . import m142
+from pkg1 import m0
+import pkg1.pkg11.m10
+from pkg6.pkg51.pkg415 import m831
+import pkg4.pkg35.pkg281.m1531
+
+
+def helper_3895_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,32 @@
+"""Module 4312."""
+import pkg1.pkg15.pkg125.m958
+from pkg4.pkg36.pkg290 import m289
+import pkg3.pkg26.pkg214.m213
+from pkg3.pkg25.pkg203 import m2287
+import pkg3.pkg26.pkg209.m3961
+from pkg4.pkg35.pkg282 import m698
+import pkg3.pkg29.pkg236.m235
+from pkg3.pkg25.pkg207 import m206
+import pkg3.m2
+from pkg5.pkg45.pkg366 import m2867
+
+
+def helper_4312_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4312_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4312_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,13 @@
+"""Module 4729."""
+import pkg2.pkg19.pkg156.m3074
+from pkg8.pkg69 import m68
+import pkg5.pkg46.pkg371.m2872
+from pkg1.pkg14 import m13
+import pkg3.pkg27.pkg217.m216
+
+
+def helper_4729_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,14 @@
+"""Module 7648."""
+import pkg1.pkg12.pkg102.m518
+from pkg4.pkg33.pkg270 import m6107
+import pkg2.pkg19.pkg160.m2244
+from pkg1.pkg10.pkg81 import m7586
+from . import m976
+from pkg1.pkg15.pkg123 import m1373
+
+
+def helper_7648_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 8899."""
+import pkg1.pkg9.pkg75.m74
+from . import m559
+import pkg1.pkg9.pkg74.m6745
+from pkg3.pkg26.pkg212 import m211
+from . import m4312
+from pkg4.pkg38.pkg310 import m7398
+import pkg6.pkg49.pkg393.m3728
+from pkg2.pkg21 import m5024
+import pkg2.pkg21.pkg175.m4761
+from pkg2.pkg18 import m3353
+import pkg5.pkg44.pkg354.m1187
+
+
+def helper_8899_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8899_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
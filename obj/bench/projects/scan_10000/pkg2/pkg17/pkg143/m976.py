@@ -0,0 +1,30 @@
+"""Module 976."""
+import pkg2.pkg17.m16
+from pkg5.pkg41.pkg330 import m746
+import pkg1.pkg12.pkg99.m98
+from pkg5.pkg41.pkg334 import m333
+from . import m559
+from pkg2 import m1
+import pkg1.pkg13.m12
+from pkg2.pkg21.pkg173 import m172
+
+
+def helper_976_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_976_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_976_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,40 @@
+"""Module 3896."""
+import pkg4.pkg40.pkg324.m1157
+from . import m3062
+import pkg1.pkg14.m13
+from pkg4.pkg33.pkg269 import m3604
+import pkg4.pkg33.pkg266.m265
+from pkg3.pkg28.pkg230 import m1480
+import pkg2.pkg24.pkg198.m1448
+from pkg3.pkg29.pkg234 import m2318
+from . import m560
+from . import m2645
+import pkg1.pkg10.m9
+
+
+def helper_3896_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3896_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3896_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3896_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,41 @@
+"""Module 5147."""
+import pkg2.pkg18.pkg146.m145
+from pkg3.pkg25.pkg208 import m1041
+import pkg3.pkg28.pkg228.m3146
+from pkg8 import m7
+import pkg8.pkg66.m65
+from pkg1.pkg14.pkg115 import m4284
+from . import m3062
+from . import m3896
+import pkg7.pkg57.m56
+from pkg3.pkg30 import m3365
+import pkg7.m6
+from pkg3.pkg27.pkg224 import m2308
+
+
+def helper_5147_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5147_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5147_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5147_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 6815."""
+import pkg5.pkg43.pkg350.m2851
+from pkg3.pkg30 import m3782
+import pkg4.pkg34.pkg273.m1940
+
+
+def helper_6815_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6815_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6815_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,30 @@
+"""Module 7232."""
+import pkg3.pkg31.m1281
+from pkg6.pkg50 import m5053
+from . import m4730
+from pkg1.pkg10.pkg87 import m4256
+import pkg5.pkg43.pkg349.m2016
+from . import m977
+import pkg4.pkg35.pkg287.m286
+from pkg2.pkg18.pkg147 import m146
+
+
+def helper_7232_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7232_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7232_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,12 @@
+"""Module 8066."""
+import pkg2.pkg22.pkg179.m178
+from pkg6.pkg49.pkg397 import m813
+import pkg4.pkg38.pkg305.m3640
+from pkg1.pkg10.pkg83 import m82
+
+
+def helper_8066_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
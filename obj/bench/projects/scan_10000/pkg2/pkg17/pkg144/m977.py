@@ -0,0 +1,21 @@
+"""Module 977."""
+import pkg1.m0
+from . import m143
+import pkg3.pkg26.pkg213.m212
+from pkg2.pkg19.pkg154 import m153
+import pkg1.pkg10.pkg83.m82
+from pkg5.pkg45.pkg363 import m779
+
+
+def helper_977_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_977_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,54 @@
+"""Module 1685."""
+import pkg7.m6
+from . import m851
+import pkg1.m0
+from . import m434
+import pkg5.pkg48.pkg387.m803
+from pkg5.pkg41.pkg334 import m333
+import pkg2.pkg17.pkg141.m140
+from . import m17
+import pkg6.pkg51.pkg416.m415
+from pkg3.pkg25.pkg205 import m621
+import pkg3.pkg30.m29
+
+
+def helper_1685_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1685_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1685_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1685_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_1685_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_1685_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
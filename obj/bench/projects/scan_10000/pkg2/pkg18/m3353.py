@@ -0,0 +1,23 @@
+"""Module 3353."""
+import pkg5.pkg46.pkg369.m2870
+from . import m1268
+import pkg3.pkg26.m2944
+from pkg4.pkg37.pkg300 import m299
+import pkg2.pkg17.pkg142.m2226
+from pkg5.pkg44.pkg355 import m771
+import pkg4.pkg33.pkg266.m1516
+from pkg5.pkg47 import m46
+
+
+def helper_3353_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3353_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
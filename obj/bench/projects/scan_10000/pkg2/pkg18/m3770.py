@@ -0,0 +1,37 @@
+"""Module 3770."""
+import pkg3.pkg25.pkg207.m206
+from pkg1.pkg16 import m15
+import pkg1.pkg14.pkg117.m533
+from . import m2519
+import pkg1.pkg16.pkg130.m129
+from pkg3.pkg28.pkg225 import m1892
+import pkg6.pkg51.pkg411.m1244
+from pkg3.pkg27.pkg223 import m222
+
+
+def helper_3770_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3770_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3770_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3770_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,14 @@
+"""Module 5021."""
+import pkg1.pkg12.m11
+from pkg3.pkg30 import m863
+from . import m4604
+from . import m1268
+import pkg2.pkg24.pkg200.m2701
+from pkg1.pkg14.pkg118 import m1368
+
+
+def helper_5021_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
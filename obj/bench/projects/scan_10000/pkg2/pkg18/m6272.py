@@ -0,0 +1,12 @@
+"""Module 6272."""
+import pkg1.pkg14.m13
+from pkg1.pkg15.pkg127 import m2211
+import pkg3.pkg25.pkg203.m2704
+from . import m2519
+
+
+def helper_6272_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
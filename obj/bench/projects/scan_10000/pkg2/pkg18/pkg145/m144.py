@@ -0,0 +1,14 @@
+"""Module 144."""
+import pkg1.pkg9.m8
+from pkg8.pkg65 import m64
+import pkg6.pkg50.m49
+from pkg1 import m0
+import pkg6.m5
+from pkg1.pkg14 import m13
+
+
+def helper_144_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
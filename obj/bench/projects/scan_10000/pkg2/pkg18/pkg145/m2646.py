@@ -0,0 +1,45 @@
+"""Module 2646."""
+import pkg5.pkg44.pkg353.m2437
+from pkg2.pkg20.pkg165 import m1415
+import pkg6.pkg53.m52
+from pkg5.pkg46.pkg369 import m368
+from . import m1395
+from pkg6.pkg49 import m48
+import pkg3.m1253
+from pkg3.pkg27.pkg224 import m1891
+import pkg2.pkg19.pkg159.m2243
+
+
+def helper_2646_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2646_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2646_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2646_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_2646_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 3063."""
+from . import m1812
+from pkg1.pkg12.pkg103 import m519
+import pkg7.m6
+from pkg3.pkg27 import m2528
+import pkg1.pkg12.pkg103.m102
+from pkg6.pkg52.pkg417 import m416
+import pkg3.pkg29.m28
+from pkg3.pkg32.pkg260 import m259
+import pkg1.pkg15.pkg124.m540
+from pkg3.pkg28.pkg229 import m1062
+
+
+def helper_3063_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
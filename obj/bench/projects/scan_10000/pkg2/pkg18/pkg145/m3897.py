@@ -0,0 +1,21 @@
+"""Module 3897."""
+import pkg1.pkg12.pkg101.m100
+from pkg6.pkg55 import m471
+import pkg4.pkg37.pkg304.m2388
+from pkg2.pkg21 import m20
+import pkg5.pkg48.pkg385.m384
+from pkg6.pkg50.pkg401 import m817
+
+
+def helper_3897_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3897_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 4731."""
+import pkg1.pkg12.pkg104.m4690
+from pkg3.pkg26.pkg212 import m1462
+
+
+def helper_4731_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4731_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
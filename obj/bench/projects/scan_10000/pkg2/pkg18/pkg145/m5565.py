@@ -0,0 +1,60 @@
+"""Module 5565."""
+import pkg3.pkg25.m24
+from pkg1.pkg14.pkg120 import m1787
+import pkg4.pkg39.pkg320.m4906
+from pkg2 import m1
+import pkg4.pkg37.pkg304.m303
+from pkg2.pkg23.pkg186 import m185
+import pkg3.pkg26.pkg209.m208
+from pkg3.pkg27.pkg219 import m3137
+import pkg1.m0
+from pkg6.pkg50.pkg403 import m1236
+
+
+def helper_5565_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5565_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5565_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5565_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_5565_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_5565_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5565_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
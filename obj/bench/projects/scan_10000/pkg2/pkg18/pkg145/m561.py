@@ -0,0 +1,27 @@
+"""Module 561."""
+import pkg2.pkg17.pkg143.m142
+from pkg1.pkg16.pkg136 import m135
+from . import m144
+from pkg1 import m0
+import pkg7.pkg58.m474
+
+
+def helper_561_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_561_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_561_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 6399."""
+import pkg4.pkg35.pkg286.m285
+from pkg6.pkg54 import m53
+from . import m1812
+from pkg7 import m6
+import pkg2.pkg17.pkg139.m3474
+from pkg2.pkg20 import m19
+import pkg4.pkg35.pkg287.m5290
+from . import m5982
+import pkg1.pkg9.m8
+from . import m5148
+
+
+def helper_6399_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
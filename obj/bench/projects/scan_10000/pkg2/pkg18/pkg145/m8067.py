@@ -0,0 +1,7 @@
+"""Module 8067."""
+import pkg2.pkg21.pkg174.m173
+from pkg7.pkg62 import m2563
+import pkg5.pkg42.pkg339.m338
+from . import m1812
+import pkg3.pkg27.pkg220.m3138
+from pkg4.pkg39.pkg320 import m6991
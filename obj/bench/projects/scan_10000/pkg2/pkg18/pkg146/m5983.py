@@ -0,0 +1,38 @@
+"""Module 5983."""
+import pkg5.pkg41.m40
+from pkg1 import m0
+import pkg3.pkg31.m30
+from pkg2.pkg21.pkg173 import m172
+import pkg4.pkg36.pkg292.m2376
+from pkg7 import m423
+from . import m2647
+from . import m1396
+import pkg2.pkg23.pkg188.m604
+
+
+def helper_5983_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5983_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5983_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5983_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
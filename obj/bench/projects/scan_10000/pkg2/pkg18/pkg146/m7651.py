@@ -0,0 +1,22 @@
+"""Module 7651."""
+import pkg2.pkg18.pkg145.m144
+from pkg1.pkg13.pkg105 import m104
+from . import m145
+from pkg4.pkg39.pkg316 import m1149
+import pkg6.pkg51.pkg416.m2500
+from pkg7.pkg57 import m1724
+from . import m1396
+
+
+def helper_7651_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7651_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,33 @@
+"""Module 8485."""
+from . import m5983
+from pkg1.pkg9.pkg73 import m72
+import pkg3.pkg31.pkg249.m248
+from pkg4.pkg39 import m2540
+from . import m7651
+from . import m979
+from . import m1396
+from pkg4.pkg38.pkg309 import m3644
+from . import m3064
+from pkg2 import m1
+import pkg4.pkg39.m38
+
+
+def helper_8485_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8485_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8485_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
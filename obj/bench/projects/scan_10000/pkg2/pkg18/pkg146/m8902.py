@@ -0,0 +1,47 @@
+"""Module 8902."""
+from . import m7234
+from . import m6817
+import pkg1.pkg14.pkg113.m529
+from pkg2.pkg17.pkg138 import m3890
+import pkg6.pkg53.m52
+from pkg1.pkg10.pkg85 import m2586
+import pkg3.pkg25.pkg205.m5625
+from . import m3064
+from . import m7651
+from pkg1.pkg10.pkg81 import m1748
+import pkg3.pkg31.pkg254.m5257
+
+
+def helper_8902_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8902_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8902_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8902_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_8902_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,32 @@
+"""Module 1814."""
+import pkg2.pkg23.pkg191.m190
+from pkg2 import m418
+import pkg2.pkg23.pkg189.m1022
+from pkg6.pkg51 import m50
+from . import m146
+from pkg6.pkg50.pkg403 import m819
+import pkg6.pkg49.pkg400.m1650
+from pkg2.pkg18.pkg149 import m148
+import pkg2.pkg18.pkg150.m1400
+from pkg2.pkg22 import m1272
+
+
+def helper_1814_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1814_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1814_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,15 @@
+"""Module 9737."""
+import pkg1.pkg14.pkg116.m4702
+from pkg6.pkg52 import m6306
+import pkg2.pkg18.pkg146.m145
+from pkg4.pkg36.pkg289 import m3207
+import pkg2.pkg17.pkg137.m136
+from pkg1 import m0
+import pkg2.pkg24.pkg195.m2696
+
+
+def helper_9737_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 2232."""
+import pkg1.pkg11.m2095
+from pkg5.pkg48.pkg392 import m1225
+from . import m981
+from . import m1398
+import pkg3.pkg27.pkg219.m1052
+
+
+def helper_2232_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2232_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
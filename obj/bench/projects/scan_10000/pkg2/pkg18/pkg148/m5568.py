@@ -0,0 +1,21 @@
+"""Module 5568."""
+import pkg3.pkg27.pkg219.m635
+from pkg1 import m0
+import pkg3.pkg31.pkg250.m2334
+from pkg4.pkg33.pkg267 import m2351
+import pkg1.pkg11.pkg90.m5093
+from pkg6 import m5
+
+
+def helper_5568_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5568_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,23 @@
+"""Module 8904."""
+import pkg5.pkg42.pkg338.m337
+from pkg5.pkg48.pkg391 import m390
+import pkg4.pkg40.pkg322.m6993
+from pkg1.pkg9.pkg75 import m4244
+from . import m5151
+from pkg1.pkg16.pkg130 import m129
+import pkg3.pkg30.pkg248.m7336
+from pkg6 import m839
+
+
+def helper_8904_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8904_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,31 @@
+"""Module 9738."""
+import pkg2.pkg23.pkg190.m6861
+from . import m564
+import pkg2.pkg20.pkg164.m580
+from pkg3.pkg26 import m442
+from . import m3066
+from pkg4.pkg35.pkg287 import m286
+import pkg1.pkg11.pkg95.m4681
+from pkg3.pkg27 import m2111
+import pkg1.m0
+
+
+def helper_9738_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9738_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9738_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 981."""
+import pkg6.pkg49.pkg398.m397
+from pkg2.pkg21.pkg175 import m591
+import pkg1.pkg11.pkg92.m91
+
+
+def helper_981_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_981_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_981_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
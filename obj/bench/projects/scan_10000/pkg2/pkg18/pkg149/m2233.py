@@ -0,0 +1,54 @@
+"""Module 2233."""
+import pkg2.pkg22.pkg177.m1844
+from pkg3.pkg25 import m24
+from . import m148
+from pkg6.pkg50.pkg401 import m400
+import pkg5.pkg42.pkg338.m2005
+from pkg2.pkg24.pkg194 import m1027
+import pkg3.pkg31.pkg249.m248
+from pkg1.pkg9 import m8
+from . import m565
+from pkg4.pkg34.pkg273 import m689
+import pkg3.pkg27.pkg217.m1884
+
+
+def helper_2233_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2233_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2233_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2233_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_2233_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_2233_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 2650."""
+import pkg4.pkg34.m1284
+from pkg2 import m1
+import pkg4.pkg33.pkg265.m264
+from . import m565
+import pkg8.m424
+from pkg5 import m4
+import pkg5.pkg43.pkg346.m1596
+from pkg8.pkg68 import m67
+import pkg5.pkg44.pkg354.m1187
+from . import m148
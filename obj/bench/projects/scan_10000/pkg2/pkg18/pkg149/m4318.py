@@ -0,0 +1,11 @@
+"""Module 4318."""
+import pkg2.pkg22.pkg182.m598
+from pkg6.pkg51 import m50
+import pkg3.pkg26.pkg216.m632
+from pkg2.pkg19.pkg158 import m3076
+import pkg3.pkg25.m24
+from pkg1.pkg9.pkg73 import m72
+import pkg4.pkg35.pkg284.m1534
+from pkg2.pkg17.pkg140 import m139
+from . import m982
+from pkg7 import m6
@@ -0,0 +1,45 @@
+"""Module 4735."""
+import pkg5.pkg43.pkg345.m344
+from pkg2.pkg23 import m22
+import pkg1.pkg15.pkg128.m961
+from pkg6.pkg50.pkg403 import m819
+import pkg1.m0
+from . import m982
+from . import m1399
+from . import m565
+import pkg1.pkg16.pkg132.m4301
+
+
+def helper_4735_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4735_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4735_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4735_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_4735_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,24 @@
+"""Module 7654."""
+import pkg1.pkg16.m15
+from pkg1.pkg12.pkg101 import m100
+import pkg7.pkg59.m1309
+from pkg1.pkg14.pkg113 import m7201
+import pkg1.pkg11.m5431
+from pkg2.pkg18 import m17
+import pkg5.pkg48.m3383
+from pkg3.pkg29.pkg235 import m234
+import pkg4.pkg40.pkg327.m4496
+
+
+def helper_7654_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7654_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
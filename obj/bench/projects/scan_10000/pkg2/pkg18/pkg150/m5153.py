@@ -0,0 +1,36 @@
+"""Module 5153."""
+import pkg3.pkg27.pkg220.m1053
+from pkg1 import m0
+import pkg4.m3
+from pkg1.pkg9.pkg74 import m490
+from . import m3485
+from pkg1.pkg14.pkg116 import m4285
+import pkg8.pkg68.m67
+
+
+def helper_5153_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5153_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5153_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5153_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
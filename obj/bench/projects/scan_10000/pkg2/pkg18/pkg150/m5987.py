@@ -0,0 +1,25 @@
+"""Module 5987."""
+import pkg4.pkg33.pkg272.m1939
+from pkg4.pkg36.pkg296 import m1546
+import pkg5.pkg45.pkg367.m366
+from pkg2 import m1
+import pkg4.pkg35.pkg288.m2372
+from . import m4736
+import pkg1.m0
+from . import m5153
+from . import m2234
+from . import m4319
+
+
+def helper_5987_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5987_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 7238."""
+import pkg6.pkg51.pkg409.m408
+from pkg3.pkg27.pkg223 import m3141
+import pkg3.pkg29.m28
+from pkg3.pkg28.pkg231 import m2315
+import pkg4.pkg40.pkg326.m2827
+
+
+def helper_7238_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7238_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,12 @@
+"""Module 7655."""
+import pkg1.pkg10.pkg82.m81
+from pkg5.pkg46 import m45
+from . import m1400
+from pkg1 import m0
+import pkg4.pkg40.pkg328.m744
+from . import m7238
+import pkg6.pkg49.pkg394.m2478
+from pkg3.pkg30.pkg242 import m241
+import pkg7.pkg57.m56
+from pkg1.pkg14.pkg116 import m2200
+import pkg5.pkg44.pkg354.m353
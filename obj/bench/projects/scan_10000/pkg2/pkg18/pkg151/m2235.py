@@ -0,0 +1,32 @@
+"""Module 2235."""
+from . import m984
+from pkg1 import m0
+import pkg5.m421
+from pkg2.pkg20.pkg162 import m161
+import pkg6.pkg55.m888
+from pkg3.pkg29 import m28
+import pkg4.pkg35.m868
+from pkg3.pkg31 import m30
+import pkg1.pkg15.pkg125.m541
+from . import m150
+
+
+def helper_2235_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2235_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2235_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,47 @@
+"""Module 3903."""
+import pkg2.pkg24.pkg199.m198
+from pkg5.pkg43.pkg352 import m2436
+import pkg2.pkg24.pkg193.m1026
+from . import m3486
+import pkg4.pkg40.m39
+from pkg2.pkg23.pkg189 import m605
+import pkg3.pkg31.pkg253.m669
+from pkg5.pkg44.pkg360 import m359
+import pkg5.pkg48.pkg390.m389
+from pkg3.pkg30.pkg242 import m241
+import pkg1.m0
+
+
+def helper_3903_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3903_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3903_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3903_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_3903_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,47 @@
+"""Module 4320."""
+import pkg2.pkg20.pkg168.m3086
+from pkg2 import m1
+from . import m3486
+from pkg4.pkg34.pkg278 import m277
+import pkg3.pkg30.pkg248.m1081
+from pkg4.pkg33.pkg270 import m269
+import pkg1.pkg16.pkg130.m129
+from pkg8.pkg69 import m3821
+import pkg1.pkg9.m8
+from pkg3.pkg25.pkg207 import m206
+import pkg5.pkg48.pkg386.m4138
+
+
+def helper_4320_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4320_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4320_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4320_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_4320_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
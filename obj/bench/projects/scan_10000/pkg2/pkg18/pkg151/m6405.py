@@ -0,0 +1,48 @@
+"""Module 6405."""
+from . import m4320
+from pkg4.pkg37.pkg302 import m3220
+from . import m3486
+from pkg2.pkg22 import m21
+import pkg3.pkg25.pkg204.m203
+from pkg5.pkg44 import m2545
+import pkg5.pkg43.pkg349.m765
+from pkg5.pkg45.pkg364 import m363
+import pkg5.m4
+from pkg5.pkg46.pkg370 import m1620
+from . import m1818
+from pkg5.pkg41.pkg331 import m1581
+
+
+def helper_6405_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6405_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6405_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6405_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_6405_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
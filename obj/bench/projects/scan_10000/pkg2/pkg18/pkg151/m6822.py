@@ -0,0 +1,33 @@
+"""Module 6822."""
+import pkg3.pkg29.pkg238.m4407
+from pkg3.pkg25.pkg203 import m1036
+import pkg5.pkg47.pkg383.m5803
+from pkg4.pkg39.pkg317 import m316
+from . import m567
+from pkg4.pkg33 import m32
+from . import m4737
+from pkg2.pkg20.pkg167 import m3085
+import pkg1.pkg13.pkg106.m939
+from pkg6.pkg55 import m888
+from . import m3903
+
+
+def helper_6822_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6822_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6822_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 8073."""
+from . import m4737
+from pkg5.pkg46.pkg374 import m3709
+import pkg3.pkg28.pkg227.m5230
+from pkg5.pkg45.pkg364 import m2448
+import pkg6.pkg50.pkg406.m822
+from pkg3.pkg27.pkg222 import m3974
+import pkg3.pkg32.pkg259.m258
+from pkg3.pkg29 import m28
+from . import m7656
+
+
+def helper_8073_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
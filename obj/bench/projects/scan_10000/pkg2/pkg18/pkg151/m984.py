@@ -0,0 +1,54 @@
+"""Module 984."""
+import pkg7.m6
+from . import m150
+import pkg2.pkg19.pkg159.m575
+from pkg2.pkg22 import m21
+import pkg4.pkg40.pkg328.m327
+from pkg2 import m1
+import pkg3.pkg30.pkg241.m240
+from pkg5.pkg45.pkg361 import m360
+import pkg4.m3
+from pkg6.pkg51 import m50
+import pkg5.pkg41.pkg334.m750
+
+
+def helper_984_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_984_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_984_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_984_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_984_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_984_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,53 @@
+"""Module 2236."""
+import pkg1.m0
+from pkg1.pkg9.pkg80 import m79
+import pkg1.pkg13.pkg110.m109
+from pkg5.pkg48.pkg389 import m388
+import pkg1.pkg11.m10
+from . import m985
+import pkg2.pkg23.pkg192.m1859
+from pkg1.pkg15.pkg123 import m1790
+from . import m1819
+from pkg1.pkg9 import m8
+
+
+def helper_2236_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2236_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2236_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2236_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_2236_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_2236_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
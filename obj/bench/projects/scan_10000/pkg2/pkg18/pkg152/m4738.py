@@ -0,0 +1,47 @@
+"""Module 4738."""
+import pkg5.pkg47.m46
+from . import m1402
+import pkg1.pkg15.m1265
+from pkg3.pkg29.pkg236 import m652
+import pkg4.pkg37.pkg299.m3634
+from pkg5.pkg46.pkg373 import m4542
+import pkg1.pkg12.pkg103.m2187
+from pkg1.pkg11.pkg95 import m511
+from . import m2236
+from pkg1 import m0
+import pkg7.pkg63.m479
+
+
+def helper_4738_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4738_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4738_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4738_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_4738_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,39 @@
+"""Module 5155."""
+import pkg5.pkg44.pkg356.m355
+from . import m3070
+import pkg1.pkg14.pkg115.m948
+from pkg6 import m5
+import pkg1.pkg16.pkg129.m2630
+from pkg4.pkg34.pkg275 import m1108
+from . import m2236
+from pkg3.pkg28.pkg225 import m224
+import pkg2.pkg21.pkg170.m2254
+from pkg6.pkg51.pkg410 import m826
+
+
+def helper_5155_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5155_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5155_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5155_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,54 @@
+"""Module 4188."""
+import pkg5.pkg41.pkg333.m332
+from pkg6.pkg50 import m49
+import pkg4.pkg38.pkg305.m4057
+from pkg7 import m1257
+import pkg3.m2
+from pkg2.pkg20.pkg164 import m3499
+import pkg1.m0
+from . import m2103
+import pkg5.pkg48.pkg389.m4141
+from pkg6.pkg49.pkg399 import m815
+import pkg6.pkg51.pkg413.m412
+
+
+def helper_4188_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4188_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4188_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4188_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_4188_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_4188_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
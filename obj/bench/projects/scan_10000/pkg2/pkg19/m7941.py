@@ -0,0 +1,33 @@
+"""Module 7941."""
+import pkg2.pkg17.pkg137.m136
+from pkg2.pkg23.pkg188 import m3106
+from . import m5022
+from pkg2.pkg20.pkg167 import m166
+import pkg2.pkg20.m19
+from . import m3771
+from . import m6690
+from . import m18
+import pkg6.m4592
+from pkg1.pkg16.pkg136 import m135
+import pkg4.pkg37.m36
+
+
+def helper_7941_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7941_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7941_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 8358."""
+import pkg1.pkg15.pkg128.m6799
+from . import m6690
+import pkg3.pkg25.m441
+from . import m7107
+import pkg4.pkg33.pkg267.m266
+from pkg1.pkg15 import m14
+import pkg5.pkg41.pkg336.m1586
+from pkg5.pkg43.pkg347 import m2848
+import pkg1.m0
+from . import m435
+import pkg6.pkg52.m5472
+from pkg1.pkg14.pkg116 import m4702
+
+
+def helper_8358_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
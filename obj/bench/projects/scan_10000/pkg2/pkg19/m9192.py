@@ -0,0 +1,34 @@
+"""Module 9192."""
+import pkg2.pkg18.m3770
+from pkg3.pkg26.pkg211 import m3129
+import pkg6.pkg50.pkg408.m2075
+from pkg2.pkg21 import m1271
+import pkg4.pkg34.pkg275.m274
+
+
+def helper_9192_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9192_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9192_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9192_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,39 @@
+"""Module 9609."""
+import pkg3.pkg28.m27
+from pkg4.pkg38.pkg308 import m5311
+import pkg2.pkg22.pkg178.m177
+from pkg7 import m6261
+import pkg5.m4
+from pkg6.pkg53 import m52
+import pkg6.pkg50.m4636
+from . import m7941
+import pkg1.pkg9.pkg77.m2161
+from pkg8.pkg72 import m905
+
+
+def helper_9609_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9609_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9609_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9609_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
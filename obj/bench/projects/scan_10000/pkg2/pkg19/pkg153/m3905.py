@@ -0,0 +1,20 @@
+"""Module 3905."""
+import pkg6.pkg51.pkg416.m1666
+from pkg2.pkg24 import m23
+import pkg4.pkg40.pkg324.m323
+from pkg2.pkg19.pkg154 import m153
+import pkg1.pkg14.pkg120.m953
+
+
+def helper_3905_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3905_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
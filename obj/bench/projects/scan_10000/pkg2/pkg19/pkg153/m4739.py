@@ -0,0 +1,19 @@
+"""Module 4739."""
+import pkg4.pkg34.pkg279.m695
+from . import m4322
+import pkg7.pkg59.m1309
+from pkg1 import m0
+
+
+def helper_4739_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4739_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
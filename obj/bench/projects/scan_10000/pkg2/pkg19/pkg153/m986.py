@@ -0,0 +1,17 @@
+"""Module 986."""
+import pkg4.pkg38.pkg305.m304
+from pkg6.pkg51.pkg416 import m832
+from . import m569
+from . import m152
+import pkg1.m0
+from pkg4.pkg34.pkg279 import m695
+import pkg1.pkg13.pkg107.m106
+from pkg1.pkg10 import m843
+import pkg4.pkg35.m34
+
+
+def helper_986_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
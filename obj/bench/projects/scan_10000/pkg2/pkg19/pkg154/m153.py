@@ -0,0 +1,33 @@
+"""Module 153."""
+import pkg1.pkg11.pkg96.m95
+from pkg1 import m0
+import pkg7.m6
+from pkg4 import m3
+import pkg8.pkg66.m65
+from pkg3.pkg32 import m31
+import pkg1.pkg15.pkg128.m127
+from pkg7.pkg59 import m58
+import pkg1.pkg14.pkg118.m117
+from pkg3.pkg28 import m27
+import pkg6.m5
+
+
+def helper_153_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_153_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_153_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
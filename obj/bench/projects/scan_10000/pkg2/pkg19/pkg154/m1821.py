@@ -0,0 +1,19 @@
+"""Module 1821."""
+import pkg2.pkg18.m434
+from pkg3.pkg25.pkg206 import m205
+from . import m153
+from pkg1 import m0
+
+
+def helper_1821_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1821_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,54 @@
+"""Module 2655."""
+import pkg1.pkg11.pkg91.m1341
+from pkg2.pkg22.pkg177 import m176
+from . import m2238
+from . import m1404
+import pkg1.pkg9.pkg77.m76
+from pkg7.pkg63 import m479
+import pkg1.pkg15.m14
+from pkg1.pkg15.pkg125 import m958
+import pkg2.m1
+from pkg4.pkg38 import m37
+import pkg8.pkg72.m1322
+
+
+def helper_2655_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2655_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2655_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2655_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_2655_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_2655_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
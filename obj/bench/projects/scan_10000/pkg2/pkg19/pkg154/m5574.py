@@ -0,0 +1,15 @@
+"""Module 5574."""
+import pkg5.pkg47.m46
+from . import m1404
+import pkg5.pkg42.pkg339.m2840
+from . import m3072
+import pkg5.pkg43.pkg346.m2013
+from . import m570
+import pkg1.pkg9.pkg79.m78
+
+
+def helper_5574_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,4 @@
+"""Module 570."""
+import pkg3.pkg26.pkg213.m212
+from . import m153
+import pkg3.pkg28.m27
@@ -0,0 +1,34 @@
+"""Module 6825."""
+import pkg3.pkg27.pkg221.m2305
+from pkg5.pkg41.pkg334 import m2835
+import pkg3.pkg25.pkg207.m206
+from pkg3.pkg32 import m865
+import pkg2.pkg20.pkg161.m6415
+
+
+def helper_6825_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6825_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6825_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6825_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
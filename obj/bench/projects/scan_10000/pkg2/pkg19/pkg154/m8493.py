@@ -0,0 +1,19 @@
+"""Module 8493."""
+import pkg1.pkg13.pkg111.m7199
+from pkg4 import m2922
+import pkg4.pkg38.pkg310.m6147
+from pkg5.pkg43.pkg351 import m767
+
+
+def helper_8493_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8493_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
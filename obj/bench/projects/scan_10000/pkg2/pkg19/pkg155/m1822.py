@@ -0,0 +1,26 @@
+"""Module 1822."""
+from . import m1405
+from pkg8.pkg72 import m71
+import pkg5.pkg43.pkg350.m766
+from . import m988
+import pkg4.pkg39.pkg316.m1149
+from . import m571
+import pkg2.pkg17.pkg137.m1387
+from pkg2 import m1
+import pkg1.m0
+from . import m154
+import pkg2.pkg24.pkg198.m1448
+
+
+def helper_1822_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1822_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,55 @@
+"""Module 7243."""
+import pkg1.pkg15.pkg124.m957
+from pkg1 import m0
+import pkg4.pkg34.pkg278.m4030
+from pkg3.pkg30.pkg245 import m244
+import pkg1.pkg12.pkg101.m4270
+from pkg4.pkg33 import m3368
+import pkg4.pkg35.pkg288.m287
+from pkg5.pkg47.pkg383 import m1216
+import pkg2.pkg17.pkg139.m555
+from pkg1.pkg14.pkg118 import m1785
+import pkg2.pkg21.pkg173.m6844
+from pkg1.pkg14.pkg120 import m1787
+
+
+def helper_7243_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7243_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7243_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7243_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_7243_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_7243_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,39 @@
+"""Module 8077."""
+import pkg8.pkg66.m65
+from pkg3.pkg28.pkg227 import m1894
+import pkg3.pkg28.pkg227.m1477
+from pkg2.pkg19.pkg156 import m155
+import pkg3.pkg27.pkg218.m1051
+from pkg1 import m0
+import pkg2.pkg19.pkg157.m5577
+from pkg1.pkg16.pkg134 import m133
+import pkg4.pkg36.pkg290.m2374
+from pkg5.pkg48.pkg390 import m7895
+
+
+def helper_8077_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8077_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8077_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8077_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
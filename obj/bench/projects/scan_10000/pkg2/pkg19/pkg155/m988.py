@@ -0,0 +1,33 @@
+"""Module 988."""
+from . import m571
+from pkg3.pkg25.pkg202 import m201
+import pkg3.pkg30.m29
+from pkg5.pkg46.pkg371 import m787
+import pkg2.pkg23.pkg190.m606
+from pkg1 import m0
+from . import m154
+from pkg2.pkg19.pkg159 import m158
+import pkg1.pkg15.pkg127.m126
+from pkg4.pkg33.pkg267 import m266
+import pkg1.pkg10.pkg88.m87
+
+
+def helper_988_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_988_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_988_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 1406."""
+import pkg4.pkg35.pkg281.m280
+from . import m989
+import pkg4.pkg36.pkg295.m294
+from . import m155
+import pkg7.pkg58.m57
+
+
+def helper_1406_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1406_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
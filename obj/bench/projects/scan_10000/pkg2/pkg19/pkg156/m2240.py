@@ -0,0 +1,24 @@
+"""Module 2240."""
+from . import m1406
+from . import m1823
+import pkg1.pkg13.pkg107.m106
+from pkg3.pkg32 import m448
+import pkg3.pkg26.m25
+from pkg2 import m1
+import pkg3.pkg29.m28
+from pkg2.pkg17 import m850
+from . import m155
+
+
+def helper_2240_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2240_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
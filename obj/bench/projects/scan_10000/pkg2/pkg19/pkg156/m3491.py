@@ -0,0 +1,12 @@
+"""Module 3491."""
+import pkg1.pkg10.m9
+from pkg2.pkg21 import m854
+import pkg4.pkg38.pkg309.m2393
+from pkg4.pkg37.pkg303 import m2387
+
+
+def helper_3491_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 7661."""
+from . import m1823
+from pkg2.pkg18.pkg147 import m4733
+from . import m3491
+from pkg4.pkg34.pkg279 import m278
+import pkg1.pkg9.pkg73.m72
+from pkg1.pkg9.pkg77 import m7582
+import pkg3.pkg27.pkg221.m1054
+from pkg6 import m839
+import pkg5.pkg42.pkg340.m339
+from pkg2.pkg22.pkg179 import m4765
+import pkg3.pkg28.pkg230.m1063
+from pkg4.pkg35.pkg281 import m4867
+
+
+def helper_7661_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7661_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
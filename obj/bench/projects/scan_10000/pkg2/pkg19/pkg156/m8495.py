@@ -0,0 +1,35 @@
+"""Module 8495."""
+import pkg1.pkg12.pkg103.m519
+from pkg3.pkg32.pkg257 import m6094
+import pkg5.pkg43.pkg351.m2018
+from pkg5.pkg44.pkg354 import m5357
+import pkg1.pkg12.m11
+from pkg3.pkg31.pkg251 import m1501
+
+
+def helper_8495_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8495_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8495_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8495_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
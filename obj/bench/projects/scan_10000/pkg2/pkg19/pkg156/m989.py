@@ -0,0 +1,21 @@
+"""Module 989."""
+from . import m155
+from pkg3.pkg28.pkg228 import m644
+from . import m572
+from pkg3.pkg32.pkg263 import m679
+import pkg5.pkg43.pkg346.m345
+from pkg1.pkg14.pkg115 import m531
+
+
+def helper_989_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_989_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 156."""
+import pkg6.pkg51.m50
+from pkg5 import m4
+
+
+def helper_156_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_156_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,21 @@
+"""Module 4326."""
+import pkg2.pkg23.pkg189.m1856
+from . import m3492
+import pkg1.pkg11.m10
+from pkg5.pkg45 import m44
+import pkg3.pkg25.pkg207.m206
+from . import m2658
+
+
+def helper_4326_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4326_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
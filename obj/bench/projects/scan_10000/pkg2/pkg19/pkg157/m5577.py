@@ -0,0 +1,54 @@
+"""Module 5577."""
+import pkg2.pkg22.pkg181.m180
+from pkg1 import m1251
+import pkg5.m421
+from . import m2241
+import pkg1.pkg11.pkg89.m922
+from . import m990
+import pkg5.pkg41.pkg330.m746
+from pkg6.pkg51.pkg410 import m4996
+import pkg3.pkg30.pkg248.m247
+from pkg2.pkg22.pkg178 import m177
+from . import m4743
+
+
+def helper_5577_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5577_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5577_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5577_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_5577_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_5577_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
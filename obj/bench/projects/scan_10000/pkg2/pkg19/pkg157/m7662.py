@@ -0,0 +1,21 @@
+"""Module 7662."""
+import pkg2.pkg19.m1269
+from pkg1 import m0
+import pkg1.pkg16.pkg130.m5967
+from . import m6828
+import pkg3.pkg29.pkg239.m238
+from . import m990
+
+
+def helper_7662_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7662_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
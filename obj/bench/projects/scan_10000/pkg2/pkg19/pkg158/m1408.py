@@ -0,0 +1,35 @@
+"""Module 1408."""
+import pkg3.pkg28.pkg226.m642
+from pkg3.pkg26.pkg210 import m209
+import pkg2.pkg23.m22
+from pkg1 import m0
+import pkg6.m5
+from . import m574
+
+
+def helper_1408_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1408_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1408_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1408_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
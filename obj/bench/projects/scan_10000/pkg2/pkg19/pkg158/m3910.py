@@ -0,0 +1,31 @@
+"""Module 3910."""
+import pkg3.pkg26.pkg215.m1048
+from pkg2.pkg19.pkg157 import m573
+import pkg2.pkg22.pkg180.m179
+from pkg1 import m0
+import pkg5.pkg46.pkg369.m3287
+from pkg6.pkg49.pkg393 import m1643
+import pkg7.pkg59.m58
+from pkg4.pkg40.pkg321 import m320
+import pkg6.pkg56.m472
+
+
+def helper_3910_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3910_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3910_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
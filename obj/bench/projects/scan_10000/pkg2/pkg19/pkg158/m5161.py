@@ -0,0 +1,16 @@
+"""Module 5161."""
+import pkg1.pkg13.pkg107.m2191
+from pkg1.pkg16 import m15
+from . import m4744
+from pkg3.pkg32.pkg264 import m1931
+import pkg7.pkg61.m894
+from pkg3.pkg29.pkg234 import m233
+import pkg4.pkg38.m3790
+from pkg5.pkg42.pkg344 import m2428
+
+
+def helper_5161_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
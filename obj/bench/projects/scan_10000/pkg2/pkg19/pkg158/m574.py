@@ -0,0 +1,9 @@
+"""Module 574."""
+import pkg1.pkg13.pkg112.m111
+
+
+def helper_574_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 7246."""
+from . import m2659
+from pkg4.pkg39.pkg314 import m1564
+
+
+def helper_7246_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7246_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
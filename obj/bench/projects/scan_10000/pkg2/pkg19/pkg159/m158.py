@@ -0,0 +1,23 @@
+"""Module 158."""
+import pkg6.pkg56.m55
+from pkg1 import m0
+import pkg1.pkg9.m8
+from pkg1.pkg10.pkg86 import m85
+import pkg1.pkg9.pkg77.m76
+from pkg3 import m2
+import pkg4.m3
+from pkg2 import m1
+
+
+def helper_158_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_158_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
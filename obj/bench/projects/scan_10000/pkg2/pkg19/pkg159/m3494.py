@@ -0,0 +1,29 @@
+"""Module 3494."""
+import pkg2.pkg19.pkg153.m152
+from pkg1.pkg15.pkg121 import m2622
+import pkg4.pkg40.pkg321.m320
+from pkg1 import m0
+from . import m1826
+from pkg4.pkg38 import m37
+import pkg4.pkg36.pkg293.m2377
+
+
+def helper_3494_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3494_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3494_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 7665."""
+import pkg1.pkg12.pkg102.m518
+from . import m2661
+from . import m5163
+from pkg2.pkg20.pkg166 import m3501
+import pkg3.pkg26.pkg209.m625
+from pkg5.pkg47.pkg382 import m1632
+import pkg1.m0
+from pkg5.pkg44.pkg354 import m2021
+import pkg5.pkg42.pkg343.m5346
+from pkg3.pkg27.pkg219 import m5222
+from . import m6414
+
+
+def helper_7665_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7665_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
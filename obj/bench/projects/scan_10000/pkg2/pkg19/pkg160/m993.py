@@ -0,0 +1,30 @@
+"""Module 993."""
+from . import m159
+from . import m576
+import pkg3.pkg31.m30
+from pkg3.pkg26.pkg209 import m208
+import pkg2.pkg19.pkg155.m154
+from pkg1.pkg15.pkg127 import m126
+import pkg4.pkg35.pkg288.m287
+from pkg4.pkg33.pkg272 import m271
+
+
+def helper_993_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_993_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_993_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,37 @@
+"""Module 1270."""
+import pkg1.pkg12.pkg98.m97
+from pkg5 import m838
+from . import m436
+from pkg4.pkg40 import m39
+from . import m853
+from pkg1.pkg10 import m426
+import pkg1.pkg11.m427
+from pkg4.pkg35.pkg282 import m281
+
+
+def helper_1270_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1270_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1270_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1270_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
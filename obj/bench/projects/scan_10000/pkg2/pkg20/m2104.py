@@ -0,0 +1,39 @@
+"""Module 2104."""
+import pkg2.pkg24.pkg197.m196
+from pkg1.pkg16.pkg133 import m132
+import pkg3.pkg25.pkg208.m1041
+from pkg4.pkg36.pkg289 import m288
+import pkg2.pkg23.pkg191.m1441
+from pkg3 import m2
+import pkg4.pkg35.pkg288.m704
+from pkg1.pkg14.pkg113 import m1780
+from . import m1270
+from pkg4 import m3
+
+
+def helper_2104_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2104_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2104_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2104_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
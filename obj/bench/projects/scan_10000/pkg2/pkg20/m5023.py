@@ -0,0 +1,9 @@
+"""Module 5023."""
+from . import m19
+from pkg2.pkg20.pkg164 import m997
+import pkg2.pkg18.pkg149.m1816
+from pkg5.pkg44.pkg360 import m1610
+import pkg2.pkg22.m21
+from pkg5.pkg44.pkg356 import m355
+from . import m1270
+from pkg1.pkg14.pkg114 import m113
@@ -0,0 +1,32 @@
+"""Module 5857."""
+import pkg1.pkg11.pkg93.m1760
+from pkg4.pkg40.pkg328 import m3246
+import pkg2.pkg19.pkg155.m571
+from pkg1.pkg11 import m10
+from . import m1270
+from pkg1.pkg10.pkg84 import m2585
+from . import m3772
+from pkg2.pkg23.pkg185 import m1018
+import pkg1.pkg12.pkg101.m2185
+from pkg2 import m1
+
+
+def helper_5857_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5857_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5857_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
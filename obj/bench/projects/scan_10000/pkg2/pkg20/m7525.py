@@ -0,0 +1,18 @@
+"""Module 7525."""
+import pkg2.pkg23.pkg190.m1440
+from . import m436
+import pkg2.pkg21.pkg171.m4757
+
+
+def helper_7525_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7525_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 4330."""
+import pkg5.m4
+from pkg5.pkg47.pkg380 import m379
+
+
+def helper_4330_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4330_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
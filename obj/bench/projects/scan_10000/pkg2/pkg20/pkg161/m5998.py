@@ -0,0 +1,19 @@
+"""Module 5998."""
+import pkg1.pkg16.pkg130.m129
+from pkg2.pkg17.pkg140 import m3058
+import pkg1.m0
+from pkg4.pkg36.pkg296 import m4048
+import pkg6.pkg50.pkg407.m3742
+from pkg1.pkg11 import m10
+from . import m1411
+from pkg5.pkg41.pkg330 import m5750
+from . import m577
+from pkg2 import m1
+import pkg3.pkg29.pkg233.m1483
+
+
+def helper_5998_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,53 @@
+"""Module 7249."""
+import pkg3.pkg25.pkg207.m206
+from pkg3 import m2
+import pkg1.pkg10.m426
+from pkg7.pkg62 import m61
+import pkg5.pkg45.pkg364.m4116
+from pkg5.pkg48 import m5468
+import pkg2.pkg18.pkg151.m2652
+from pkg1.pkg9.pkg74 import m2575
+import pkg1.m0
+from pkg3.pkg27.pkg218 import m634
+
+
+def helper_7249_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7249_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7249_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7249_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_7249_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_7249_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
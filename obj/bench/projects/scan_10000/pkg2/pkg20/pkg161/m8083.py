@@ -0,0 +1,16 @@
+"""Module 8083."""
+import pkg7.pkg59.m58
+from pkg3.pkg30.pkg245 import m244
+from . import m4747
+from pkg1.pkg15.pkg127 import m2211
+import pkg2.pkg21.pkg175.m174
+from pkg3.pkg32 import m7120
+import pkg1.m0
+from pkg5.pkg43.pkg352 import m351
+
+
+def helper_8083_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,6 @@
+"""Module 9334."""
+import pkg2.pkg22.pkg178.m177
+from pkg2.pkg20.pkg167 import m166
+import pkg1.pkg16.pkg134.m550
+from . import m3079
+import pkg3.pkg26.pkg215.m1882
@@ -0,0 +1,39 @@
+"""Module 6833."""
+import pkg2.pkg18.pkg149.m982
+from pkg3.pkg30 import m29
+import pkg8.pkg67.m1734
+from . import m5582
+from . import m995
+from . import m3080
+import pkg3.pkg27.pkg223.m6060
+from . import m578
+import pkg4.pkg37.pkg298.m1131
+from pkg1.pkg16.pkg131 import m130
+
+
+def helper_6833_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6833_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6833_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6833_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,48 @@
+"""Module 7250."""
+import pkg4.pkg39.pkg319.m735
+from pkg8.pkg66 import m65
+import pkg4.pkg36.pkg292.m708
+from pkg5.pkg42 import m41
+import pkg1.m0
+from pkg2 import m1
+import pkg1.pkg10.pkg85.m84
+from . import m3497
+import pkg1.pkg15.pkg123.m122
+from pkg6.pkg51.pkg413 import m5833
+import pkg4.pkg37.m870
+from pkg4.pkg35.pkg281 import m1948
+
+
+def helper_7250_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7250_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7250_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7250_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_7250_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
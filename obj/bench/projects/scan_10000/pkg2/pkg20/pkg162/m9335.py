@@ -0,0 +1,16 @@
+"""Module 9335."""
+import pkg2.pkg23.pkg191.m4360
+from pkg2.pkg22 import m21
+import pkg2.pkg22.pkg183.m1433
+from . import m7667
+import pkg2.m1
+from pkg1.pkg9.pkg77 import m3412
+import pkg1.m0
+from pkg1.pkg14 import m13
+
+
+def helper_9335_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,2 @@
+"""Module 6000."""
+import pkg1.pkg9.pkg75.m2159
@@ -0,0 +1,15 @@
+"""Module 6417."""
+import pkg3.pkg31.pkg253.m252
+from pkg4.pkg40.pkg323 import m322
+from . import m1830
+from pkg1 import m0
+import pkg4.pkg34.pkg280.m279
+from pkg5.pkg46.pkg375 import m791
+import pkg3.pkg28.pkg226.m4812
+
+
+def helper_6417_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
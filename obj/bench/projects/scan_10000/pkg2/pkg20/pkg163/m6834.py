@@ -0,0 +1,10 @@
+"""Module 6834."""
+import pkg4.pkg35.pkg287.m3205
+from pkg5.pkg48.pkg385 import m384
+
+
+def helper_6834_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,54 @@
+"""Module 7251."""
+import pkg1.m0
+from pkg1.pkg9.pkg79 import m495
+from . import m996
+from . import m4749
+from . import m162
+from pkg2 import m1
+from . import m6000
+from pkg4.pkg38.pkg308 import m2392
+import pkg3.pkg31.pkg253.m252
+from pkg3.pkg28.pkg229 import m1896
+import pkg1.pkg9.pkg77.m910
+
+
+def helper_7251_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7251_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7251_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7251_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_7251_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_7251_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
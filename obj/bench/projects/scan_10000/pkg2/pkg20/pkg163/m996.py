@@ -0,0 +1,10 @@
+"""Module 996."""
+from . import m579
+from pkg2.pkg21.pkg169 import m585
+
+
+def helper_996_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,15 @@
+"""Module 8503."""
+import pkg3.pkg28.pkg231.m2732
+from . import m4333
+from . import m6001
+from pkg5.pkg44.pkg354 import m1187
+import pkg5.pkg47.pkg379.m4965
+from pkg3.pkg30 import m3365
+from . import m8086
+
+
+def helper_8503_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,37 @@
+"""Module 1415."""
+import pkg6.pkg51.pkg415.m414
+from pkg5.pkg47.pkg381 import m380
+import pkg3.pkg30.pkg243.m1076
+from . import m164
+import pkg2.pkg19.pkg153.m152
+from pkg1 import m0
+import pkg5.pkg48.pkg389.m1222
+from pkg3 import m2
+
+
+def helper_1415_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1415_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1415_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1415_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
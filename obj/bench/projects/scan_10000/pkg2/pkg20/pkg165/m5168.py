@@ -0,0 +1,23 @@
+"""Module 5168."""
+from . import m4751
+from pkg5.pkg45.pkg366 import m1199
+import pkg2.pkg18.pkg146.m979
+from pkg5.pkg45 import m878
+import pkg3.pkg32.pkg261.m1928
+from pkg1.pkg10 import m9
+import pkg4.pkg38.pkg311.m310
+from pkg3.pkg32 import m31
+
+
+def helper_5168_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5168_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 581."""
+import pkg2.pkg23.m22
+from pkg1.pkg15.pkg124 import m123
+
+
+def helper_581_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_581_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,24 @@
+"""Module 6002."""
+import pkg1.pkg12.pkg98.m97
+from pkg4.pkg33.pkg271 import m270
+import pkg3.pkg32.pkg262.m4431
+from . import m5585
+import pkg3.m2
+from pkg4.pkg38.pkg312 import m4898
+from . import m4334
+from pkg5.pkg46.pkg369 import m368
+import pkg4.pkg39.pkg314.m313
+
+
+def helper_6002_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6002_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
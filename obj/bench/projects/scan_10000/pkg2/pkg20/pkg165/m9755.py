@@ -0,0 +1,17 @@
+"""Module 9755."""
+import pkg4.pkg33.pkg265.m5685
+from . import m8504
+import pkg4.m3
+from pkg2.pkg19.pkg159 import m4745
+from . import m2666
+from pkg4.pkg40 import m39
+import pkg4.pkg35.m34
+from pkg4.pkg39.pkg320 import m736
+from . import m998
+
+
+def helper_9755_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 998."""
+import pkg3.pkg25.pkg202.m618
+from pkg4.pkg33.pkg270 import m686
+import pkg2.pkg17.m433
+
+
+def helper_998_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_998_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,23 @@
+"""Module 1833."""
+from . import m999
+from pkg1 import m0
+import pkg1.pkg13.m12
+from pkg4.pkg37 import m36
+import pkg2.m1
+from pkg1.pkg16.pkg136 import m552
+import pkg4.pkg40.m39
+from . import m582
+
+
+def helper_1833_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1833_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
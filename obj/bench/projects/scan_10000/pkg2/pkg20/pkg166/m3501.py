@@ -0,0 +1,34 @@
+"""Module 3501."""
+import pkg5.pkg41.pkg334.m1584
+from pkg3.pkg32.pkg259 import m258
+import pkg3.pkg31.pkg249.m1499
+from . import m1833
+import pkg3.pkg29.pkg236.m235
+
+
+def helper_3501_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3501_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3501_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3501_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,2 @@
+"""Module 6837."""
+import pkg1.pkg10.m9
@@ -0,0 +1,46 @@
+"""Module 1000."""
+import pkg5.pkg46.pkg371.m787
+from pkg3 import m2
+import pkg1.pkg13.pkg106.m105
+from pkg7.pkg62 import m61
+import pkg5.pkg42.pkg341.m340
+from pkg5.pkg41 import m40
+import pkg5.pkg44.pkg358.m357
+from pkg8.pkg71 import m70
+import pkg5.pkg48.pkg389.m388
+from pkg3.pkg30.pkg242 import m241
+
+
+def helper_1000_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1000_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1000_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1000_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_1000_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 1417."""
+import pkg1.pkg16.pkg132.m548
+from pkg6.pkg51.pkg412 import m828
+import pkg3.pkg29.m28
+from pkg5.pkg47.pkg379 import m795
+
+
+def helper_1417_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1417_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1417_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
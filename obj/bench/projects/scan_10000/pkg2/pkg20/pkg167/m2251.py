@@ -0,0 +1,9 @@
+"""Module 2251."""
+from . import m583
+
+
+def helper_2251_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 4336."""
+import pkg6.pkg53.m1303
+from pkg3 import m2921
+import pkg3.pkg30.pkg248.m1081
+from . import m583
+
+
+def helper_4336_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4336_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
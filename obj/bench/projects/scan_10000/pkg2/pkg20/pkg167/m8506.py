@@ -0,0 +1,21 @@
+"""Module 8506."""
+import pkg1.pkg14.pkg114.m113
+from pkg3.pkg30.pkg246 import m245
+import pkg4.pkg36.pkg294.m710
+from pkg3.pkg30.pkg241 import m4410
+import pkg2.pkg17.pkg141.m557
+from pkg3.pkg27.pkg218 import m6472
+
+
+def helper_8506_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8506_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
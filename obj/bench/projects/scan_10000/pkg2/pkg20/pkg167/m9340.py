@@ -0,0 +1,9 @@
+"""Module 9340."""
+import pkg6.pkg51.pkg413.m412
+
+
+def helper_9340_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 5588."""
+import pkg2.pkg17.pkg137.m4723
+from pkg1.pkg15.pkg123 import m1790
+
+
+def helper_5588_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5588_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,48 @@
+"""Module 6422."""
+import pkg2.pkg18.pkg146.m562
+from pkg5.pkg46.pkg372 import m1622
+from . import m6005
+from pkg5.pkg41 import m40
+import pkg5.pkg42.pkg339.m1589
+from pkg5.pkg44.pkg360 import m5780
+import pkg5.pkg45.pkg366.m365
+from pkg3.pkg28.pkg231 import m647
+import pkg3.pkg29.m28
+from pkg3.pkg30.pkg242 import m6079
+import pkg4.pkg37.pkg298.m1965
+from pkg5.pkg46.pkg372 import m5375
+
+
+def helper_6422_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6422_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6422_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6422_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_6422_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
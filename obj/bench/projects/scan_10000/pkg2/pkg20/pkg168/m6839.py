@@ -0,0 +1,30 @@
+"""Module 6839."""
+import pkg2.pkg21.pkg171.m4340
+from pkg1.pkg13.pkg105 import m521
+import pkg4.pkg35.pkg283.m1950
+from pkg2.pkg18.pkg145 import m4314
+import pkg5.pkg43.m1710
+from pkg4.pkg39.pkg314 import m4900
+import pkg4.pkg40.pkg322.m6576
+from pkg1.pkg10.pkg82 import m1332
+
+
+def helper_6839_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6839_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6839_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 8924."""
+import pkg2.pkg21.m4607
+from pkg2.pkg17.pkg143 import m5980
+from . import m3920
+from pkg4.pkg36.pkg293 import m292
+import pkg2.m1
+from pkg2.pkg21.pkg173 import m1006
+import pkg1.pkg13.m5016
+from . import m4754
+import pkg2.pkg17.pkg141.m974
+from pkg8.pkg71 import m6742
+import pkg2.pkg23.m7945
+from pkg7.pkg63 import m1313
+
+
+def helper_8924_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8924_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
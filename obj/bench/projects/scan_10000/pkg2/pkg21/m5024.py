@@ -0,0 +1,53 @@
+"""Module 5024."""
+import pkg2.pkg18.pkg152.m151
+from pkg2.pkg22.pkg184 import m600
+from . import m4607
+from . import m4190
+import pkg3.pkg26.pkg213.m3965
+from . import m2939
+import pkg3.pkg28.pkg232.m648
+from pkg4.pkg36.pkg289 import m288
+import pkg8.pkg70.m486
+from pkg4 import m3
+
+
+def helper_5024_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5024_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5024_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5024_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_5024_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_5024_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,24 @@
+"""Module 5441."""
+import pkg4.pkg40.pkg324.m4910
+from pkg2.pkg21.pkg174 import m5177
+import pkg5.pkg46.pkg375.m2042
+from pkg3.pkg25.pkg207 import m3542
+import pkg7.pkg64.m480
+from . import m854
+from . import m1688
+from pkg1.pkg16.pkg129 import m962
+import pkg1.pkg14.pkg117.m3452
+
+
+def helper_5441_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5441_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
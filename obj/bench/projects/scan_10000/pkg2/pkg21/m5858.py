@@ -0,0 +1,27 @@
+"""Module 5858."""
+import pkg1.pkg13.pkg109.m5112
+from pkg5.pkg48.pkg390 import m389
+from . import m4607
+from . import m3356
+from . import m4190
+from . import m1688
+from . import m2522
+from pkg2.pkg24.pkg195 import m3113
+import pkg7.pkg63.m3398
+from . import m2939
+import pkg6.pkg50.pkg402.m818
+from . import m2105
+
+
+def helper_5858_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5858_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,24 @@
+"""Module 7526."""
+import pkg3.pkg25.m24
+from pkg4.pkg35 import m34
+import pkg6.pkg51.pkg412.m2079
+from . import m437
+import pkg5.pkg42.pkg344.m1594
+from pkg1.pkg11.pkg96 import m512
+import pkg2.pkg17.pkg138.m137
+from . import m4607
+from . import m20
+
+
+def helper_7526_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7526_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,15 @@
+"""Module 854."""
+from . import m20
+from . import m437
+import pkg1.pkg14.pkg116.m532
+from pkg6.pkg49.pkg399 import m815
+import pkg1.pkg11.pkg95.m94
+from pkg1 import m0
+import pkg3.pkg30.pkg245.m244
+
+
+def helper_854_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
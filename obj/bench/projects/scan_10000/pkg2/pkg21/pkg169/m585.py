@@ -0,0 +1,17 @@
+"""Module 585."""
+import pkg2.pkg21.pkg170.m169
+from . import m168
+import pkg1.pkg9.pkg78.m77
+from pkg2.pkg21 import m20
+import pkg1.pkg12.pkg104.m103
+from pkg3.pkg32.pkg261 import m260
+import pkg4.m3
+from pkg8.pkg72 import m71
+import pkg2.pkg19.m18
+
+
+def helper_585_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 6423."""
+import pkg2.m1
+from pkg1.pkg9.pkg74 import m73
+import pkg5.pkg47.m1714
+from pkg4.pkg33 import m32
+
+
+def helper_6423_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6423_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6423_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
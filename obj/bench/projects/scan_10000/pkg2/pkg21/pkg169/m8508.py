@@ -0,0 +1,30 @@
+"""Module 8508."""
+from . import m585
+from pkg5.pkg45.pkg363 import m362
+import pkg2.pkg18.m7106
+from pkg6.pkg49.pkg398 import m1231
+from . import m8091
+from pkg1.pkg13 import m7518
+import pkg6.pkg50.pkg407.m5410
+from . import m5589
+
+
+def helper_8508_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8508_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8508_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
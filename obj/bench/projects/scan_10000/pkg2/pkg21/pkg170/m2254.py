@@ -0,0 +1,43 @@
+"""Module 2254."""
+from . import m1837
+from pkg1.pkg11.pkg96 import m95
+import pkg1.pkg12.m11
+from pkg1.pkg9.pkg76 import m909
+import pkg2.pkg20.pkg165.m1832
+from pkg5.pkg45.pkg365 import m781
+import pkg4.pkg33.m866
+
+
+def helper_2254_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2254_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2254_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2254_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_2254_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 3088."""
+import pkg3.pkg31.pkg251.m250
+from pkg5.pkg47.pkg382 import m381
+import pkg3.m2
+from pkg4.pkg37 import m36
+import pkg3.pkg31.pkg250.m249
+from pkg1.pkg13.pkg111 import m110
+import pkg2.pkg24.pkg198.m197
+from pkg1.pkg14.pkg120 import m1787
+import pkg2.pkg19.m18
+from pkg6 import m5
+
+
+def helper_3088_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,9 @@
+"""Module 3505."""
+import pkg2.m1
+
+
+def helper_3505_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
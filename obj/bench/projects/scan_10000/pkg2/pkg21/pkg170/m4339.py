@@ -0,0 +1,37 @@
+"""Module 4339."""
+import pkg2.pkg17.pkg138.m554
+from pkg3.pkg29 import m1696
+import pkg5.pkg46.pkg373.m2874
+from pkg4.pkg40.pkg321 import m1571
+import pkg4.pkg34.pkg276.m3611
+from pkg2.pkg20.pkg166 import m3084
+from . import m1420
+from . import m1837
+
+
+def helper_4339_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4339_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4339_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4339_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,48 @@
+"""Module 4756."""
+import pkg6.m5
+from pkg1.pkg11.pkg90 import m506
+from . import m4339
+from pkg3 import m2
+import pkg1.pkg9.pkg80.m496
+from pkg6.pkg49.pkg393 import m2060
+from . import m169
+from pkg5.pkg47.pkg384 import m383
+from . import m1003
+from . import m586
+import pkg2.pkg18.pkg152.m3487
+from pkg4.pkg38.pkg305 import m1138
+
+
+def helper_4756_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4756_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4756_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4756_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_4756_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
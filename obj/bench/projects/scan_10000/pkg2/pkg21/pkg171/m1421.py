@@ -0,0 +1,11 @@
+"""Module 1421."""
+import pkg5.pkg45.pkg363.m362
+from . import m170
+import pkg4.pkg39.m38
+
+
+def helper_1421_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,54 @@
+"""Module 2255."""
+from . import m1838
+from pkg1 import m0
+import pkg2.pkg18.m434
+from pkg1.pkg14.pkg119 import m1786
+import pkg2.pkg21.m854
+from pkg1.pkg15 import m14
+import pkg2.pkg21.m20
+from pkg3.pkg32.pkg258 import m674
+import pkg6.m5
+from pkg1.pkg12 import m11
+import pkg7.m6
+
+
+def helper_2255_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2255_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2255_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2255_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_2255_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_2255_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,47 @@
+"""Module 3506."""
+from . import m170
+from pkg1.pkg16.pkg130 import m129
+import pkg8.pkg69.m485
+from pkg5.pkg46.pkg371 import m370
+import pkg3.pkg26.m25
+from pkg1.pkg12.pkg104 import m2605
+import pkg5.pkg45.pkg366.m2867
+from pkg3.pkg28.pkg230 import m1063
+import pkg1.pkg14.pkg120.m119
+from pkg5.pkg48.pkg389 import m2890
+import pkg2.pkg20.pkg163.m996
+
+
+def helper_3506_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3506_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3506_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3506_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_3506_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,29 @@
+"""Module 5591."""
+import pkg3.pkg32.m31
+from . import m1421
+import pkg7.pkg60.m2561
+from . import m4340
+import pkg4.m3
+from . import m2672
+import pkg1.pkg9.pkg79.m5082
+
+
+def helper_5591_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5591_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5591_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,39 @@
+"""Module 6008."""
+import pkg2.pkg23.pkg185.m601
+from pkg2.pkg17.pkg143 import m142
+import pkg7.pkg63.m3398
+from . import m2255
+import pkg1.m0
+from pkg7 import m6
+import pkg6.pkg51.pkg413.m3331
+from pkg7.pkg63 import m2981
+from . import m170
+from pkg3.pkg30.pkg244 import m660
+
+
+def helper_6008_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6008_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6008_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6008_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,54 @@
+"""Module 8093."""
+import pkg3.m2
+from pkg2.pkg24.pkg194 import m4363
+import pkg3.pkg30.pkg241.m240
+from pkg1.pkg16.pkg129 import m128
+import pkg6.pkg49.m1299
+from pkg4 import m3
+from . import m6425
+from pkg4.pkg38.pkg308 import m3643
+import pkg5.pkg45.pkg362.m2029
+from pkg1.pkg9.pkg73 import m489
+import pkg3.pkg26.pkg209.m208
+
+
+def helper_8093_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8093_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8093_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8093_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_8093_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_8093_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
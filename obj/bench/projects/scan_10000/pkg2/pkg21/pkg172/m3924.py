@@ -0,0 +1,14 @@
+"""Module 3924."""
+from . import m1005
+from pkg3.pkg25.pkg204 import m1454
+import pkg4.pkg36.pkg290.m1123
+from pkg3.pkg32.pkg260 import m1093
+from . import m588
+from pkg1.pkg9.pkg78 import m77
+
+
+def helper_3924_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
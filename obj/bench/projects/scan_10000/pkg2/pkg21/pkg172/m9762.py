@@ -0,0 +1,54 @@
+"""Module 9762."""
+import pkg2.pkg18.pkg147.m146
+from . import m2673
+import pkg6.pkg50.pkg408.m3326
+from pkg5.pkg44.pkg356 import m4942
+from . import m5175
+from pkg6.pkg49.pkg399 import m1232
+import pkg4.pkg38.pkg309.m725
+from pkg3.pkg30 import m29
+import pkg4.m3
+from pkg4.pkg36.pkg290 import m1540
+from . import m1422
+
+
+def helper_9762_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9762_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9762_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9762_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_9762_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_9762_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,15 @@
+"""Module 1423."""
+from . import m589
+from . import m1006
+import pkg2.pkg24.pkg198.m1031
+from pkg3.pkg31 import m30
+import pkg2.pkg24.pkg197.m196
+from pkg5.pkg47.pkg383 import m1216
+from . import m172
+
+
+def helper_1423_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 1840."""
+import pkg4.pkg38.pkg305.m1138
+from pkg3.pkg29.pkg236 import m1069
+import pkg8.m7
+from pkg5.pkg43 import m876
+
+
+def helper_1840_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1840_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1840_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
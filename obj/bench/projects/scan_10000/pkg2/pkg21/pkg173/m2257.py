@@ -0,0 +1,23 @@
+"""Module 2257."""
+from . import m1840
+from pkg3.pkg27.pkg217 import m633
+import pkg4.pkg35.pkg283.m1533
+from pkg3.pkg27.pkg224 import m640
+from . import m1006
+from pkg5.pkg44.pkg360 import m2027
+import pkg4.pkg39.pkg316.m1983
+from pkg3.pkg28 import m1278
+
+
+def helper_2257_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2257_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,28 @@
+"""Module 3091."""
+import pkg3.pkg27.pkg220.m1470
+from . import m2674
+import pkg1.pkg12.pkg102.m1352
+from pkg2.pkg19.pkg159 import m158
+import pkg3.pkg27.pkg217.m2301
+from pkg3.pkg28.pkg230 import m2314
+
+
+def helper_3091_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3091_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3091_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
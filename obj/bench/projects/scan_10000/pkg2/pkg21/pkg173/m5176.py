@@ -0,0 +1,10 @@
+"""Module 5176."""
+import pkg6.pkg56.m55
+from pkg5 import m4
+
+
+def helper_5176_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
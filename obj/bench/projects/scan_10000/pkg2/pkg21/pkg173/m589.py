@@ -0,0 +1,39 @@
+"""Module 589."""
+import pkg1.pkg15.pkg125.m124
+from pkg2.pkg24 import m23
+from . import m172
+from pkg4.pkg37 import m36
+import pkg4.pkg40.pkg326.m325
+from pkg1.pkg13.pkg112 import m111
+import pkg3.pkg27.m443
+from pkg5.pkg45.pkg365 import m364
+import pkg3.m2
+from pkg1 import m0
+
+
+def helper_589_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_589_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_589_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_589_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 6427."""
+import pkg1.pkg11.pkg92.m5929
+from . import m1006
+from . import m5176
+from pkg2.pkg20.pkg167 import m2668
+import pkg6.pkg49.pkg398.m2065
+from pkg5.pkg45.pkg361 import m2028
+import pkg5.pkg47.pkg383.m1216
+from pkg5.pkg45.pkg363 import m3698
+import pkg1.pkg10.pkg85.m84
+from pkg4.pkg34.pkg277 import m2361
+
+
+def helper_6427_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6427_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
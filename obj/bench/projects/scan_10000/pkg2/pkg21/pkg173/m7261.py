@@ -0,0 +1,37 @@
+"""Module 7261."""
+import pkg3.m2
+from pkg3.pkg26.pkg212 import m628
+import pkg1.pkg13.pkg106.m939
+from pkg1 import m0
+import pkg2.pkg19.pkg153.m2654
+from . import m5176
+from . import m3091
+from pkg3.pkg32.pkg264 import m6101
+
+
+def helper_7261_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7261_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7261_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7261_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,54 @@
+"""Module 7678."""
+from . import m1006
+from pkg3.pkg26.pkg210 import m626
+from . import m6844
+from pkg3.pkg32 import m1282
+import pkg4.m3
+from pkg8.pkg69 import m1319
+import pkg5.pkg41.pkg336.m3254
+from pkg5.pkg48.pkg392 import m808
+import pkg2.pkg21.pkg172.m6009
+from pkg5 import m3757
+import pkg1.pkg16.pkg129.m1379
+
+
+def helper_7678_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7678_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7678_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7678_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_7678_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_7678_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1 @@
+"""Module 8929."""
@@ -0,0 +1,20 @@
+"""Module 3509."""
+import pkg5.pkg46.pkg376.m375
+from pkg2.pkg21.pkg173 import m2674
+import pkg2.pkg20.pkg162.m161
+from pkg3.pkg27.pkg218 import m3136
+import pkg5.pkg41.pkg331.m747
+
+
+def helper_3509_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3509_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
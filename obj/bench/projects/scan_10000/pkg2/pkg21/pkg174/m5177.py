@@ -0,0 +1,54 @@
+"""Module 5177."""
+from . import m3509
+from pkg5.pkg46 import m45
+import pkg1.m0
+from pkg1.pkg12.pkg100 import m933
+from . import m2675
+from . import m1007
+import pkg5.pkg42.pkg344.m3679
+from pkg1.pkg12.pkg100 import m2601
+import pkg1.pkg12.pkg97.m1347
+from . import m173
+import pkg4.pkg36.pkg296.m295
+
+
+def helper_5177_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5177_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5177_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5177_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_5177_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_5177_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,45 @@
+"""Module 6845."""
+import pkg5.pkg41.pkg330.m5333
+from pkg5.pkg41.pkg334 import m750
+from . import m2258
+from pkg4.pkg39.pkg317 import m316
+import pkg4.pkg33.pkg267.m4436
+from pkg1.pkg13 import m2931
+import pkg4.pkg38.m37
+from pkg5.pkg48.pkg387 import m803
+import pkg3.pkg27.pkg224.m3976
+
+
+def helper_6845_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6845_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6845_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6845_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_6845_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
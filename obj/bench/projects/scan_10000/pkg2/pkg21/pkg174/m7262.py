@@ -0,0 +1,31 @@
+"""Module 7262."""
+import pkg1.pkg16.pkg136.m6807
+from . import m4343
+import pkg4.pkg37.m36
+from pkg1.pkg12 import m11
+import pkg3.pkg30.m29
+from pkg4.pkg33 import m449
+import pkg4.pkg37.pkg302.m3220
+from pkg8 import m7
+import pkg5.pkg47.pkg381.m797
+
+
+def helper_7262_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7262_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7262_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,34 @@
+"""Module 8096."""
+from . import m1841
+from pkg5.pkg44.pkg354 import m2855
+import pkg3.pkg25.pkg204.m6875
+from pkg3.pkg26.pkg210 import m209
+import pkg4.pkg37.pkg301.m300
+from pkg2.pkg19 import m18
+import pkg2.pkg23.pkg188.m5608
+from pkg4.pkg35.pkg284 import m283
+from . import m6428
+from pkg4.pkg37.pkg300 import m2384
+import pkg5.pkg44.m5464
+from pkg1.pkg11 import m844
+
+
+def helper_8096_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8096_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8096_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
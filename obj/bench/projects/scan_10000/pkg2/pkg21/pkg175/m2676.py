@@ -0,0 +1,15 @@
+"""Module 2676."""
+import pkg4.pkg36.pkg295.m294
+from pkg2.pkg24 import m23
+import pkg1.pkg14.m13
+from pkg7.pkg59 import m475
+import pkg4.pkg35.pkg286.m1119
+from pkg1.pkg9 import m8
+from . import m591
+
+
+def helper_2676_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 591."""
+import pkg1.pkg15.m14
+from pkg5.pkg41 import m457
+
+
+def helper_591_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_591_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
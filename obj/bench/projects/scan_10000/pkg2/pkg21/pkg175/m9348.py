@@ -0,0 +1,27 @@
+"""Module 9348."""
+import pkg4.pkg36.pkg291.m3626
+from pkg3.pkg26.pkg211 import m1044
+from . import m2259
+from pkg1 import m0
+import pkg3.pkg26.pkg211.m1461
+
+
+def helper_9348_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9348_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9348_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,41 @@
+"""Module 1843."""
+import pkg1.pkg13.pkg106.m105
+from pkg1.pkg14 import m13
+import pkg5.m4
+from pkg5.pkg47 import m46
+from . import m175
+from pkg8.pkg71 import m70
+import pkg4.pkg38.m37
+from pkg4 import m3
+import pkg2.pkg17.pkg138.m137
+from pkg1.pkg14.pkg116 import m115
+import pkg1.pkg9.pkg80.m79
+from pkg1.pkg16.pkg129 import m1796
+
+
+def helper_1843_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1843_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1843_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1843_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
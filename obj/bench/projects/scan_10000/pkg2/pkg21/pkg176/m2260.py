@@ -0,0 +1,22 @@
+"""Module 2260."""
+import pkg4.pkg40.pkg323.m1573
+from pkg1 import m0
+import pkg5.pkg44.pkg354.m353
+from pkg3.pkg28 import m27
+import pkg4.pkg38.pkg311.m1978
+from pkg4.pkg38 import m454
+import pkg3.m2
+
+
+def helper_2260_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2260_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
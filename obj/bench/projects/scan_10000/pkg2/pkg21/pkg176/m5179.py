@@ -0,0 +1,21 @@
+"""Module 5179."""
+import pkg1.pkg16.pkg133.m132
+from pkg1 import m3753
+import pkg2.pkg24.pkg194.m610
+from . import m1009
+import pkg1.pkg11.pkg89.m505
+from pkg2 import m1669
+
+
+def helper_5179_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5179_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 6013."""
+import pkg6.pkg53.m4639
+from pkg4.pkg34.pkg273 import m1106
+import pkg2.pkg19.pkg156.m572
+from pkg6.pkg54 import m53
+import pkg3.pkg25.pkg203.m619
+from pkg4 import m3
+from . import m3511
+from . import m592
+import pkg3.pkg27.m26
+from pkg1 import m0
+
+
+def helper_6013_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6013_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 9766."""
+import pkg6.pkg53.m8809
+from pkg4.pkg40 import m39
+import pkg4.pkg40.pkg327.m5330
+
+
+def helper_9766_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
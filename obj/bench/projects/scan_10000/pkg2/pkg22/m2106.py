@@ -0,0 +1,9 @@
+"""Module 2106."""
+import pkg5.pkg46.pkg372.m371
+
+
+def helper_2106_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
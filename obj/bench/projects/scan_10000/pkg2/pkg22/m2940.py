@@ -0,0 +1,25 @@
+"""Module 2940."""
+import pkg8.pkg72.m488
+from pkg2.pkg17 import m16
+import pkg1.pkg14.pkg115.m1365
+from pkg3.pkg27.pkg223 import m1056
+from . import m21
+from pkg2.pkg21 import m437
+import pkg2.m1
+from pkg1.pkg15 import m14
+import pkg4.pkg38.pkg310.m726
+from pkg1.pkg11.pkg95 import m94
+
+
+def helper_2940_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2940_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 5025."""
+from . import m438
+from pkg1.pkg12.pkg100 import m1350
+import pkg5.pkg43.m459
+from . import m4608
+import pkg1.pkg15.pkg121.m2622
+
+
+def helper_5025_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5025_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
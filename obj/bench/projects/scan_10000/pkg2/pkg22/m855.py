@@ -0,0 +1,27 @@
+"""Module 855."""
+from . import m438
+from pkg2 import m1
+import pkg1.pkg14.pkg113.m112
+from pkg3.pkg29 import m445
+import pkg5.m4
+
+
+def helper_855_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_855_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_855_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
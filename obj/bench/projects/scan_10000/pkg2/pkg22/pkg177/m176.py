@@ -0,0 +1,23 @@
+"""Module 176."""
+import pkg2.pkg17.pkg140.m139
+from pkg3.pkg31 import m30
+import pkg2.m1
+from pkg8.pkg65 import m64
+import pkg2.pkg18.m17
+from pkg1.pkg16 import m15
+import pkg6.pkg53.m52
+from pkg1 import m0
+
+
+def helper_176_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_176_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
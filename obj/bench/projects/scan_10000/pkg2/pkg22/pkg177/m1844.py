@@ -0,0 +1,37 @@
+"""Module 1844."""
+from . import m1010
+from pkg1 import m0
+import pkg2.pkg20.pkg161.m577
+from pkg1.pkg15.pkg127 import m960
+from . import m1427
+from pkg3.pkg25.pkg202 import m201
+import pkg6.pkg50.pkg405.m821
+from pkg2.pkg17 import m16
+
+
+def helper_1844_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1844_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1844_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1844_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,5 @@
+"""Module 593."""
+import pkg8.pkg71.m70
+from pkg1 import m0
+import pkg2.m1
+from . import m176
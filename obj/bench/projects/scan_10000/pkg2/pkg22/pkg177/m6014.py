@@ -0,0 +1,35 @@
+"""Module 6014."""
+from . import m5180
+from pkg4.pkg35.pkg282 import m5702
+import pkg1.pkg15.pkg123.m2207
+from pkg1.pkg9.pkg78 import m77
+import pkg2.pkg23.pkg187.m3105
+from pkg1 import m0
+
+
+def helper_6014_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6014_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6014_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6014_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
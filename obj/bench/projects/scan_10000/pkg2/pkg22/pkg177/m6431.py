@@ -0,0 +1,27 @@
+"""Module 6431."""
+import pkg4.pkg37.m36
+from pkg4.pkg39.pkg317 import m5320
+import pkg3.pkg25.pkg204.m5207
+from pkg2.pkg18.pkg151 import m150
+import pkg1.m0
+
+
+def helper_6431_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6431_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6431_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 8933."""
+import pkg3.pkg29.pkg235.m4821
+from pkg6.pkg50 import m8389
+import pkg4.pkg35.pkg286.m702
+from pkg2.pkg20.pkg163 import m996
+
+
+def helper_8933_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8933_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8933_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
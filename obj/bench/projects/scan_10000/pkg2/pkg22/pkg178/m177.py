@@ -0,0 +1,26 @@
+"""Module 177."""
+import pkg2.pkg17.m16
+from pkg2.pkg17.pkg142 import m141
+import pkg3.m2
+from pkg3.pkg30 import m29
+
+
+def helper_177_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_177_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_177_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
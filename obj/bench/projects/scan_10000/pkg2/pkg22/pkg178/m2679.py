@@ -0,0 +1,37 @@
+"""Module 2679."""
+import pkg4.pkg35.pkg285.m701
+from . import m1845
+import pkg4.pkg33.pkg272.m688
+from pkg3.pkg30 import m2531
+import pkg1.m0
+from pkg6.pkg51.pkg409 import m408
+from . import m594
+from pkg1.pkg13.pkg109 import m525
+
+
+def helper_2679_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2679_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2679_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2679_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
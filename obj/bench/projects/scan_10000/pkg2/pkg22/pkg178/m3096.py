@@ -0,0 +1,38 @@
+"""Module 3096."""
+import pkg8.pkg66.m482
+from pkg2.pkg24.pkg195 import m611
+import pkg1.pkg11.m10
+from pkg4 import m3
+import pkg4.pkg36.m35
+from pkg1.pkg12.pkg104 import m1771
+import pkg6.pkg51.pkg414.m830
+from pkg5.pkg46 import m1296
+import pkg3.pkg28.pkg231.m1064
+
+
+def helper_3096_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3096_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3096_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3096_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,46 @@
+"""Module 3513."""
+import pkg1.pkg15.pkg128.m2629
+from pkg1.pkg10.pkg82 import m81
+import pkg1.pkg11.pkg90.m506
+from pkg2.pkg18 import m17
+import pkg5.m4
+from . import m594
+from . import m1011
+from pkg2.pkg18.pkg149 import m565
+from . import m2262
+from pkg7.pkg59 import m2143
+
+
+def helper_3513_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3513_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3513_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3513_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_3513_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
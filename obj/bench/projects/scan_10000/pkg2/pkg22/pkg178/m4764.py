@@ -0,0 +1,35 @@
+"""Module 4764."""
+import pkg4.pkg34.pkg277.m1527
+from . import m2679
+import pkg5.pkg44.pkg360.m359
+from pkg3.pkg29.pkg234 import m2735
+from . import m1845
+from pkg5.pkg48.pkg388 import m3723
+
+
+def helper_4764_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4764_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4764_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4764_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
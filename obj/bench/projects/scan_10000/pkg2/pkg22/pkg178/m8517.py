@@ -0,0 +1,19 @@
+"""Module 8517."""
+import pkg1.m0
+from . import m7683
+import pkg7.pkg63.m62
+from pkg4.pkg35.pkg283 import m2367
+
+
+def helper_8517_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8517_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 1846."""
+import pkg3.m2
+from pkg5.pkg43 import m876
+import pkg5.pkg43.pkg350.m349
+from pkg2.pkg18.pkg146 import m145
+from . import m595
+
+
+def helper_1846_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1846_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1846_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
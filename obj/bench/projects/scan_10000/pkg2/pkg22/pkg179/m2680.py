@@ -0,0 +1,15 @@
+"""Module 2680."""
+from . import m1012
+from pkg2.pkg17.pkg138 import m137
+import pkg4.pkg35.pkg287.m286
+from pkg7.pkg60 import m59
+import pkg1.pkg11.pkg92.m2593
+from pkg2.pkg24 import m23
+from . import m1846
+
+
+def helper_2680_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
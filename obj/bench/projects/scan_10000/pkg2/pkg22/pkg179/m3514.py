@@ -0,0 +1,53 @@
+"""Module 3514."""
+import pkg2.m1
+from pkg1.pkg15 import m3350
+import pkg2.pkg20.pkg165.m1415
+from pkg2.pkg19.pkg154 import m153
+import pkg1.pkg10.m9
+from pkg2.pkg20.pkg164 import m997
+import pkg5.pkg44.pkg355.m771
+from pkg4.pkg40.pkg327 import m326
+import pkg2.pkg20.pkg166.m582
+from pkg4.pkg38.pkg305 import m1138
+
+
+def helper_3514_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3514_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3514_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3514_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_3514_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_3514_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
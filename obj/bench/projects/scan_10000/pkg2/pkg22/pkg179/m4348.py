@@ -0,0 +1,29 @@
+"""Module 4348."""
+import pkg1.m0
+from pkg7.pkg62 import m61
+import pkg1.pkg12.m11
+from pkg3.pkg30 import m29
+from . import m3931
+from pkg3.pkg27.pkg223 import m2724
+import pkg2.m1
+
+
+def helper_4348_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4348_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4348_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,15 @@
+"""Module 7267."""
+import pkg2.pkg19.pkg156.m572
+from pkg1.pkg16.pkg129 import m128
+import pkg5.pkg43.pkg348.m3683
+from pkg3.pkg32.pkg264 import m4433
+from . import m6850
+from pkg5.pkg48 import m4634
+from . import m1012
+
+
+def helper_7267_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,40 @@
+"""Module 8101."""
+import pkg6.pkg50.pkg408.m1658
+from pkg4.pkg35.pkg284 import m3202
+from . import m5599
+from pkg1.pkg14.pkg115 import m948
+import pkg1.pkg14.pkg116.m532
+from . import m1846
+from . import m3097
+from pkg4.pkg38.pkg307 import m723
+import pkg1.pkg16.pkg133.m132
+from pkg2.pkg21.pkg176 import m175
+import pkg8.pkg72.m905
+
+
+def helper_8101_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8101_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8101_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8101_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,41 @@
+"""Module 8935."""
+import pkg3.pkg32.pkg262.m261
+from . import m8101
+import pkg1.pkg9.pkg79.m1329
+from . import m5599
+import pkg4.pkg39.pkg317.m2818
+from pkg2.pkg24.pkg195 import m7700
+import pkg4.pkg38.m3790
+from pkg2.pkg24.pkg200 import m616
+from . import m3931
+from pkg6.pkg50 import m5470
+import pkg2.pkg19.pkg157.m8496
+from pkg3.pkg28.pkg226 import m4812
+
+
+def helper_8935_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8935_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8935_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8935_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,54 @@
+"""Module 1847."""
+import pkg1.m0
+from pkg7.pkg60 import m59
+import pkg6.pkg51.pkg410.m409
+from pkg6.pkg51.pkg416 import m1249
+import pkg2.pkg20.pkg165.m1415
+from pkg2.pkg20.pkg165 import m164
+import pkg3.pkg28.pkg226.m225
+from pkg6.pkg51.pkg411 import m827
+from . import m179
+from pkg1.pkg10.pkg88 import m87
+import pkg5.pkg48.pkg390.m389
+
+
+def helper_1847_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1847_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1847_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1847_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_1847_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_1847_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 6017."""
+import pkg1.pkg13.pkg109.m1359
+from pkg1.pkg9 import m8
+import pkg3.pkg31.pkg254.m4423
+from pkg1.pkg11.pkg89 import m3007
+import pkg5.pkg44.pkg359.m3277
+from pkg1.pkg14.pkg120 import m119
+import pkg5.pkg45.pkg365.m5785
+from pkg3 import m2
+from . import m179
+
+
+def helper_6017_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
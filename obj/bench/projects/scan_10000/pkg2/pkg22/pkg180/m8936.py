@@ -0,0 +1,26 @@
+"""Module 8936."""
+import pkg5.pkg44.pkg356.m7027
+from pkg6.pkg56 import m55
+from . import m1430
+from pkg4.pkg38.pkg307 import m5727
+
+
+def helper_8936_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8936_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8936_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
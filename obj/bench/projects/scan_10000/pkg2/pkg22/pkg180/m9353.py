@@ -0,0 +1,34 @@
+"""Module 9353."""
+import pkg2.pkg20.pkg168.m167
+from pkg3.pkg25.pkg208 import m2292
+import pkg2.pkg18.pkg147.m2231
+from pkg6.pkg56 import m55
+import pkg4.pkg33.pkg265.m1098
+from pkg3.pkg32.pkg263 import m6100
+from . import m5183
+from pkg7 import m6
+import pkg1.pkg9.pkg77.m76
+from . import m1013
+import pkg5.pkg48.m5051
+from pkg2.pkg17 import m16
+
+
+def helper_9353_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9353_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9353_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
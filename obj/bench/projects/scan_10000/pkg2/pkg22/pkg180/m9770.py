@@ -0,0 +1,38 @@
+"""Module 9770."""
+import pkg4.pkg36.pkg290.m1540
+from pkg2.pkg22.pkg179 import m178
+import pkg3.pkg25.m441
+from pkg3.pkg27.pkg217 import m1467
+import pkg4.pkg36.m2537
+from pkg1.pkg12.pkg103 import m9693
+from . import m596
+from . import m8102
+import pkg7.pkg59.m58
+
+
+def helper_9770_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9770_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9770_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9770_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 1431."""
+import pkg3.pkg30.m29
+from . import m597
+import pkg4.pkg34.pkg276.m275
+from pkg2.pkg24.pkg199 import m198
+import pkg4.pkg38.pkg306.m305
+from . import m1014
+import pkg5.pkg45.pkg363.m779
+from pkg4.pkg40.pkg328 import m744
+from . import m180
+from pkg1 import m0
+
+
+def helper_1431_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1431_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,15 @@
+"""Module 2682."""
+from . import m597
+from . import m1014
+import pkg2.pkg19.pkg160.m993
+from pkg5.pkg44 import m43
+import pkg6.pkg54.m470
+from pkg1 import m0
+import pkg1.pkg16.pkg136.m1386
+
+
+def helper_2682_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 3516."""
+import pkg1.m0
+from pkg2.pkg18.pkg146 import m2647
+import pkg5.pkg47.m46
+from . import m2265
+import pkg2.pkg20.pkg163.m996
+from pkg1.pkg12.pkg101 import m100
+from . import m3099
+from pkg1.pkg12.pkg98 import m97
+import pkg2.pkg24.pkg194.m610
+from pkg5.pkg47.pkg378 import m1628
+import pkg5.m4
+
+
+def helper_3516_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,15 @@
+"""Module 4767."""
+import pkg3.pkg29.pkg236.m1903
+from pkg1.pkg12.pkg101 import m934
+import pkg5.pkg47.m46
+from pkg3 import m2
+import pkg1.m0
+from pkg3.pkg27.pkg217 import m1050
+from . import m597
+
+
+def helper_4767_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,53 @@
+"""Module 6852."""
+import pkg2.pkg19.pkg155.m571
+from pkg1 import m0
+import pkg1.pkg10.pkg83.m1750
+from . import m2682
+import pkg3.m2
+from pkg6.pkg56 import m4225
+import pkg1.pkg10.pkg87.m6758
+from pkg2.pkg23.pkg186 import m602
+import pkg6.pkg50.m49
+from pkg1.pkg9.pkg80 import m4666
+
+
+def helper_6852_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6852_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6852_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6852_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_6852_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_6852_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,62 @@
+"""Module 8103."""
+import pkg1.pkg13.m3765
+from pkg1.pkg15.pkg124 import m3042
+from . import m6435
+from pkg1.pkg11.pkg93 import m1760
+import pkg7.pkg60.m893
+from pkg7.pkg61 import m60
+import pkg1.pkg9.pkg76.m4245
+from pkg1.pkg11.pkg95 import m928
+import pkg5.pkg44.m43
+from pkg1.pkg11.pkg95 import m7600
+import pkg5.pkg41.pkg336.m752
+from pkg8.pkg68 import m67
+
+
+def helper_8103_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8103_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8103_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8103_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_8103_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_8103_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8103_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
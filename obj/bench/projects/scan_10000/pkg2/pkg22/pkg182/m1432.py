@@ -0,0 +1,54 @@
+"""Module 1432."""
+import pkg4.pkg38.pkg306.m722
+from . import m1015
+import pkg5.pkg43.pkg348.m764
+from pkg3.pkg30.pkg247 import m246
+import pkg1.pkg13.pkg106.m105
+from pkg4.pkg36 import m35
+import pkg8.pkg67.m66
+from pkg7.pkg59 import m475
+from . import m181
+from pkg7.pkg64 import m480
+import pkg5.pkg44.m43
+
+
+def helper_1432_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1432_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1432_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1432_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_1432_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_1432_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 181."""
+import pkg5.pkg42.m41
+from pkg4 import m3
+import pkg1.pkg13.m12
+
+
+def helper_181_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_181_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
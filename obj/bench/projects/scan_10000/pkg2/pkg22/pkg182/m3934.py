@@ -0,0 +1,31 @@
+"""Module 3934."""
+import pkg5.pkg43.pkg351.m350
+from pkg3.pkg29 import m2530
+import pkg6.pkg52.m51
+from pkg2.pkg18.pkg146 import m145
+import pkg1.m0
+from pkg2.pkg19.pkg153 import m986
+from . import m3100
+from . import m181
+import pkg5.pkg45.pkg365.m781
+
+
+def helper_3934_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3934_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3934_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
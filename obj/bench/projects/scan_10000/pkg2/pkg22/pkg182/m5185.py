@@ -0,0 +1,20 @@
+"""Module 5185."""
+import pkg5.pkg44.pkg359.m358
+from pkg7 import m6
+import pkg1.pkg12.m11
+from pkg2.pkg23 import m856
+from . import m2683
+from . import m4768
+import pkg1.pkg14.pkg117.m3452
+from pkg5.pkg47.pkg381 import m2465
+import pkg1.pkg13.m12
+from pkg3.pkg26.pkg210 import m626
+import pkg1.pkg10.pkg88.m87
+from pkg7.pkg57 import m473
+
+
+def helper_5185_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
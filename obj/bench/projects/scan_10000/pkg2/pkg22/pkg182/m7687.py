@@ -0,0 +1,12 @@
+"""Module 7687."""
+import pkg2.m1
+from . import m2266
+import pkg4.pkg36.pkg289.m2373
+from pkg2.pkg20 import m1687
+
+
+def helper_7687_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
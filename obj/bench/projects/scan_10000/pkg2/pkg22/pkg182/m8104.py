@@ -0,0 +1,16 @@
+"""Module 8104."""
+import pkg1.pkg14.pkg118.m3036
+from pkg2.pkg21 import m20
+import pkg4.pkg35.pkg284.m3202
+from pkg5.pkg48.pkg392 import m4561
+import pkg1.pkg11.pkg92.m5929
+from pkg3.pkg29.pkg238 import m2322
+import pkg4.pkg38.pkg312.m4064
+from pkg4.pkg39.pkg314 import m7402
+
+
+def helper_8104_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
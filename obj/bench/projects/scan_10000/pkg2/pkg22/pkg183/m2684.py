@@ -0,0 +1,12 @@
+"""Module 2684."""
+import pkg1.m0
+from pkg7.pkg64 import m897
+import pkg6.pkg50.m49
+from pkg3.pkg25 import m24
+
+
+def helper_2684_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,38 @@
+"""Module 4769."""
+import pkg5.pkg46.pkg374.m1207
+from pkg2.pkg21.pkg175 import m174
+from . import m182
+from pkg3.pkg26.pkg210 import m626
+from . import m3518
+from . import m3101
+from . import m1016
+from pkg2.pkg21.pkg169 import m4755
+import pkg1.pkg14.pkg118.m534
+
+
+def helper_4769_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4769_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4769_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4769_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
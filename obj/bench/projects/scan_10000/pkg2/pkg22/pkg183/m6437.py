@@ -0,0 +1,38 @@
+"""Module 6437."""
+import pkg2.pkg20.pkg164.m3916
+from . import m2267
+import pkg1.m0
+from . import m2684
+import pkg4.pkg39.m1289
+from pkg1.pkg13.pkg106 import m2190
+import pkg4.pkg33.pkg266.m1099
+from pkg5.pkg47.pkg379 import m378
+import pkg6.pkg52.m51
+
+
+def helper_6437_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6437_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6437_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6437_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,55 @@
+"""Module 8105."""
+import pkg1.m0
+from . import m4352
+import pkg4.pkg37.pkg301.m2385
+from . import m5603
+import pkg1.pkg10.pkg82.m7587
+from . import m7688
+import pkg5.pkg46.m45
+from . import m4769
+import pkg2.m1
+from pkg3.pkg26 import m25
+import pkg2.pkg22.pkg179.m4348
+from . import m1850
+
+
+def helper_8105_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8105_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8105_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8105_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_8105_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_8105_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
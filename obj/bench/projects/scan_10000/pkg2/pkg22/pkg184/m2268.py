@@ -0,0 +1,39 @@
+"""Module 2268."""
+import pkg1.pkg11.m10
+from pkg2.pkg21.pkg170 import m169
+import pkg1.m0
+from pkg6.pkg53 import m1303
+from . import m1851
+from pkg2.pkg23.pkg186 import m1853
+import pkg4.m3
+from pkg6.pkg50.pkg407 import m406
+from . import m1434
+from pkg2.pkg18.pkg145 import m1812
+
+
+def helper_2268_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2268_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2268_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2268_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,15 @@
+"""Module 3936."""
+import pkg2.pkg20.pkg167.m2668
+from pkg3.pkg27.pkg221 import m1054
+import pkg2.pkg19.pkg157.m156
+from pkg6 import m5
+import pkg5.pkg43.pkg351.m350
+from . import m1851
+import pkg4.pkg35.pkg286.m285
+
+
+def helper_3936_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
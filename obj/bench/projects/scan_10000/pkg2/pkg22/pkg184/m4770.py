@@ -0,0 +1,37 @@
+"""Module 4770."""
+import pkg4.pkg37.m36
+from . import m3102
+from . import m4353
+from pkg5 import m4
+import pkg2.pkg17.pkg139.m138
+from . import m183
+import pkg1.pkg15.pkg127.m2211
+from pkg1 import m0
+
+
+def helper_4770_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4770_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4770_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4770_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
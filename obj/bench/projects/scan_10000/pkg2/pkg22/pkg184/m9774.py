@@ -0,0 +1,43 @@
+"""Module 9774."""
+import pkg3.pkg27.pkg221.m3556
+from pkg2.pkg18.pkg150 import m149
+import pkg4.pkg39.pkg313.m729
+from pkg1.pkg9.pkg79 import m8001
+import pkg1.pkg9.pkg79.m912
+from pkg6.pkg51.pkg410 import m2911
+import pkg5.pkg48.pkg390.m389
+
+
+def helper_9774_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9774_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9774_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9774_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_9774_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
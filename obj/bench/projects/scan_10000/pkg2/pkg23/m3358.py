@@ -0,0 +1,26 @@
+"""Module 3358."""
+import pkg5.pkg47.pkg384.m383
+from pkg4.pkg35.pkg282 import m698
+import pkg8.pkg70.m486
+from pkg3.pkg31.pkg252 import m1085
+import pkg3.pkg28.pkg227.m1477
+from . import m1690
+import pkg2.pkg20.pkg162.m161
+from . import m439
+import pkg5.pkg46.pkg374.m373
+from pkg8.pkg65 import m64
+import pkg5.pkg46.m45
+
+
+def helper_3358_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3358_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,15 @@
+"""Module 439."""
+import pkg1.m0
+from pkg8.pkg72 import m71
+import pkg2.m1
+from pkg1.pkg13.pkg108 import m107
+from . import m22
+from pkg5.pkg42.pkg340 import m339
+import pkg2.pkg18.pkg152.m151
+
+
+def helper_439_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,22 @@
+"""Module 5026."""
+import pkg6.m5
+from pkg2.pkg17.pkg139 import m138
+from . import m3358
+from pkg2.pkg21 import m437
+import pkg4.pkg38.pkg305.m304
+from pkg2.pkg22.pkg181 import m1848
+import pkg3.pkg27.pkg220.m636
+
+
+def helper_5026_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5026_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
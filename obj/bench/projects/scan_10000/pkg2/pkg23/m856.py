@@ -0,0 +1,21 @@
+"""Module 856."""
+import pkg1.m0
+from pkg3.pkg25.pkg206 import m622
+from . import m22
+from pkg7.pkg58 import m57
+from . import m439
+from pkg8 import m7
+
+
+def helper_856_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_856_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 9196."""
+from . import m7528
+from pkg4.pkg34.pkg279 import m1529
+import pkg2.pkg17.pkg139.m138
+from pkg8.pkg69 import m4238
+import pkg5.pkg46.m45
+from pkg6.pkg50.pkg407 import m9163
+import pkg5.pkg42.pkg343.m7014
+from pkg3.pkg26.pkg216 import m215
+import pkg2.pkg23.pkg189.m188
+from pkg1.pkg13.pkg110 import m1360
+
+
+def helper_9196_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9196_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
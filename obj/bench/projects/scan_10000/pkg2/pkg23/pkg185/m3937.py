@@ -0,0 +1,12 @@
+"""Module 3937."""
+import pkg3.pkg28.pkg230.m2731
+from . import m2686
+import pkg7.pkg58.m2142
+from . import m1852
+
+
+def helper_3937_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,16 @@
+"""Module 5605."""
+import pkg2.pkg18.pkg150.m3068
+from pkg3.pkg26.pkg216 import m215
+import pkg6.pkg49.pkg397.m1647
+from pkg5.pkg46.pkg373 import m2040
+import pkg3.pkg29.pkg237.m236
+from . import m1018
+import pkg2.pkg24.pkg196.m195
+from pkg3.pkg25.pkg203 import m202
+
+
+def helper_5605_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,40 @@
+"""Module 8941."""
+from . import m2686
+from pkg2.pkg19 import m1269
+import pkg4.pkg40.pkg325.m1992
+from pkg3.pkg30.pkg242 import m4828
+import pkg2.pkg18.pkg151.m150
+from pkg3.pkg32.pkg260 import m4846
+import pkg6.pkg56.m55
+from pkg4.pkg33.pkg265 import m264
+import pkg4.pkg38.pkg307.m306
+from pkg4.pkg40.pkg325 import m4077
+import pkg1.m0
+
+
+def helper_8941_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8941_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8941_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8941_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
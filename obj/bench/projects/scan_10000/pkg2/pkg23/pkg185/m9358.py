@@ -0,0 +1,55 @@
+"""Module 9358."""
+import pkg3.pkg28.pkg231.m2315
+from pkg3.pkg26.pkg213 import m629
+import pkg3.m2
+from pkg2.pkg17.pkg137 import m4723
+from . import m2686
+from pkg2.pkg19.pkg157 import m3909
+import pkg1.m0
+from pkg1.pkg9.pkg78 import m5081
+import pkg6.pkg51.pkg409.m8331
+from pkg1.pkg13.pkg109 import m1359
+import pkg2.pkg20.m7942
+from pkg2.pkg22.pkg184 import m1434
+
+
+def helper_9358_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9358_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9358_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9358_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_9358_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_9358_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,13 @@
+"""Module 1019."""
+from . import m602
+from pkg3.pkg25 import m24
+import pkg5.pkg48.pkg390.m389
+from pkg2.pkg24.pkg200 import m199
+import pkg1.pkg16.pkg135.m551
+
+
+def helper_1019_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
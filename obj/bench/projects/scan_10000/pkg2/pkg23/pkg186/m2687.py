@@ -0,0 +1,39 @@
+"""Module 2687."""
+import pkg1.pkg12.pkg98.m1348
+from . import m185
+import pkg5.pkg45.pkg367.m1200
+from pkg2.pkg22.pkg181 import m1431
+import pkg1.pkg10.pkg81.m497
+from pkg3.pkg29.pkg234 import m1901
+import pkg1.pkg15.m14
+from pkg1.pkg11.pkg91 import m507
+import pkg1.pkg10.pkg87.m86
+from pkg1 import m0
+
+
+def helper_2687_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2687_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2687_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2687_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
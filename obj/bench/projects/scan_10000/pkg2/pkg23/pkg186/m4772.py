@@ -0,0 +1,15 @@
+"""Module 4772."""
+import pkg2.pkg20.pkg167.m1000
+from pkg2.pkg21.pkg174 import m1007
+import pkg1.pkg10.pkg83.m499
+from . import m185
+import pkg7.pkg61.m2145
+from pkg2.pkg19.pkg159 import m1409
+import pkg1.pkg9.pkg73.m4659
+
+
+def helper_4772_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
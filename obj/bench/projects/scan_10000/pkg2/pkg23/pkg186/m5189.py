@@ -0,0 +1,24 @@
+"""Module 5189."""
+from . import m3104
+from pkg1.pkg13.pkg108 import m107
+import pkg4.pkg34.pkg274.m2358
+from pkg7.pkg63 import m2564
+import pkg1.pkg12.m2096
+from pkg1 import m0
+import pkg3.pkg30.pkg244.m243
+from pkg2 import m1
+import pkg4.pkg36.pkg289.m1539
+
+
+def helper_5189_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5189_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,8 @@
+"""Module 6857."""
+import pkg1.pkg10.pkg81.m80
+from pkg1.pkg14.pkg114 import m3866
+from . import m6440
+from pkg1.pkg15 import m14
+import pkg4.pkg34.pkg279.m4031
+from pkg2.pkg23 import m22
+import pkg5.pkg46.pkg369.m1202
@@ -0,0 +1,15 @@
+"""Module 7274."""
+import pkg4.m3
+from pkg3 import m2
+from . import m2270
+from pkg3.pkg31.pkg251 import m4003
+import pkg3.pkg28.m4614
+from pkg5.pkg43.pkg349 import m3267
+import pkg2.pkg20.pkg168.m584
+
+
+def helper_7274_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,33 @@
+"""Module 8525."""
+import pkg4.pkg33.pkg270.m2771
+from pkg5.pkg42.pkg337 import m1170
+import pkg6.pkg49.pkg399.m3317
+from pkg3.pkg32.pkg263 import m1930
+import pkg1.pkg15.pkg123.m1790
+from pkg1.pkg16.pkg136 import m3888
+from . import m6440
+from pkg3.pkg25.pkg208 import m207
+import pkg2.pkg22.pkg182.m1432
+from pkg3.pkg26 import m25
+import pkg8.pkg70.m69
+
+
+def helper_8525_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8525_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8525_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
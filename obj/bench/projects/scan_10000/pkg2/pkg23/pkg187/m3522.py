@@ -0,0 +1,35 @@
+"""Module 3522."""
+from . import m1437
+from . import m186
+import pkg3.pkg26.pkg216.m3134
+from pkg3.pkg25.pkg205 import m2706
+import pkg3.pkg31.pkg256.m1506
+from pkg6.pkg51.pkg415 import m2082
+
+
+def helper_3522_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3522_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3522_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3522_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 8943."""
+import pkg3.pkg31.m8787
+from pkg4.pkg33 import m32
+import pkg1.pkg16.pkg129.m1796
+from pkg2.pkg20.pkg166 import m7671
+import pkg5.pkg41.pkg333.m2417
+from . import m6441
+import pkg4.pkg39.pkg319.m6573
+from pkg6 import m5
+from . import m1854
+from pkg4 import m3
+
+
+def helper_8943_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8943_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,34 @@
+"""Module 1021."""
+import pkg2.pkg17.pkg141.m140
+from pkg1.pkg9 import m8
+import pkg4.pkg34.pkg276.m692
+from pkg2.pkg17.pkg144 import m143
+import pkg4.m3
+from pkg4.pkg36.pkg292 import m291
+import pkg2.pkg23.pkg190.m606
+from pkg2.pkg18.pkg145 import m144
+import pkg4.pkg40.pkg328.m327
+from pkg2.pkg21.pkg171 import m170
+import pkg3.pkg27.pkg222.m638
+from pkg2.pkg20.pkg165 import m581
+
+
+def helper_1021_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1021_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1021_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 3523."""
+import pkg1.pkg10.pkg85.m84
+from pkg5.pkg48 import m47
+import pkg2.pkg18.pkg146.m3481
+from pkg2.pkg24.pkg197 import m1864
+import pkg3.pkg30.m1280
+from pkg1.pkg15 import m14
+import pkg2.pkg18.pkg152.m151
+from pkg1.pkg9.pkg75 import m1325
+from . import m3106
+from . import m1438
+
+
+def helper_3523_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
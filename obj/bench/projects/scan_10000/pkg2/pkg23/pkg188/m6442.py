@@ -0,0 +1,38 @@
+"""Module 6442."""
+import pkg5.pkg42.pkg343.m1176
+from pkg1.pkg13.pkg106 import m522
+import pkg5.pkg48.m464
+from pkg2.pkg18.pkg146 import m145
+import pkg6.m422
+from pkg6 import m5
+import pkg1.pkg16.pkg134.m133
+from pkg2.pkg22.pkg184 import m183
+import pkg6.pkg49.pkg399.m1232
+
+
+def helper_6442_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6442_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6442_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6442_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
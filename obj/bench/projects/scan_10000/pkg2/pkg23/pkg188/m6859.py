@@ -0,0 +1,36 @@
+"""Module 6859."""
+import pkg3.pkg30.pkg241.m240
+from . import m2272
+import pkg2.pkg19.m852
+from pkg5 import m4
+import pkg7.pkg64.m63
+from . import m6442
+import pkg1.m0
+
+
+def helper_6859_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6859_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6859_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6859_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 8527."""
+from . import m1855
+from pkg1.pkg12.pkg98 import m3433
+import pkg2.pkg20.pkg167.m583
+from pkg3.pkg29.pkg237 import m236
+import pkg5.pkg41.m1708
+from pkg4.pkg36.pkg290 import m289
+from . import m6025
+from . import m8110
+import pkg1.pkg12.pkg104.m8026
+
+
+def helper_8527_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
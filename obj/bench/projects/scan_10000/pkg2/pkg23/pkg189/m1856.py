@@ -0,0 +1,19 @@
+"""Module 1856."""
+from . import m605
+from pkg2.pkg24.pkg193 import m192
+import pkg5.pkg44.pkg356.m355
+from pkg1.pkg11.pkg95 import m94
+
+
+def helper_1856_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1856_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
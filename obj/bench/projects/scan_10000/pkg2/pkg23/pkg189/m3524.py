@@ -0,0 +1,47 @@
+"""Module 3524."""
+import pkg5.pkg48.m464
+from pkg4.pkg34.pkg274 import m273
+import pkg4.pkg37.pkg300.m299
+from . import m2690
+import pkg3.pkg30.m3365
+from pkg5.pkg48.pkg392 import m1225
+from . import m1856
+from pkg2.pkg24.pkg193 import m1026
+from . import m3107
+from pkg3.pkg28.pkg231 import m2732
+import pkg7.pkg63.m3398
+
+
+def helper_3524_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3524_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3524_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3524_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_3524_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
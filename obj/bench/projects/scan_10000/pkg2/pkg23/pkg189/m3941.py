@@ -0,0 +1,40 @@
+"""Module 3941."""
+from . import m1439
+from . import m3107
+import pkg5.pkg42.pkg339.m2006
+from pkg8 import m7
+import pkg5.pkg42.pkg340.m3675
+from pkg5.pkg48.pkg391 import m3726
+import pkg4.pkg33.pkg269.m268
+from pkg4 import m3
+import pkg1.m0
+from pkg6.pkg49.pkg399 import m1649
+import pkg5.m4
+
+
+def helper_3941_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3941_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3941_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3941_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
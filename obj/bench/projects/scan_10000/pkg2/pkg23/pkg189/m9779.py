@@ -0,0 +1,23 @@
+"""Module 9779."""
+import pkg7.m6
+from pkg1.pkg10.pkg87 import m5090
+import pkg2.pkg22.pkg180.m8102
+from pkg2.pkg23.pkg185 import m184
+import pkg7.pkg57.m5894
+from pkg2.pkg20.pkg168 import m167
+import pkg2.pkg20.m6691
+from . import m188
+
+
+def helper_9779_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9779_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
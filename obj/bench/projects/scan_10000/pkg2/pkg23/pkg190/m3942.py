@@ -0,0 +1,10 @@
+"""Module 3942."""
+import pkg3.pkg28.pkg231.m647
+from pkg3.pkg30.pkg243 import m242
+
+
+def helper_3942_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
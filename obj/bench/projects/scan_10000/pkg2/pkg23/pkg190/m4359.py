@@ -0,0 +1,16 @@
+"""Module 4359."""
+import pkg2.pkg18.pkg145.m4314
+from pkg1 import m0
+import pkg4.m2088
+from . import m1440
+import pkg5.pkg42.pkg338.m2005
+from pkg5 import m4
+import pkg4.pkg35.pkg288.m704
+from pkg5.pkg45 import m44
+
+
+def helper_4359_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,36 @@
+"""Module 5193."""
+import pkg3.pkg32.pkg262.m261
+from pkg7.pkg59 import m58
+import pkg3.pkg30.pkg247.m1497
+from pkg4.pkg37.pkg300 import m299
+import pkg1.pkg15.pkg121.m3039
+from pkg1.pkg15.pkg125 import m124
+import pkg7.pkg62.m895
+
+
+def helper_5193_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5193_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5193_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5193_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
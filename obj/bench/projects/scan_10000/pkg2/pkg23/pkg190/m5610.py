@@ -0,0 +1,10 @@
+"""Module 5610."""
+from . import m3525
+from pkg1.pkg10.pkg81 import m80
+
+
+def helper_5610_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
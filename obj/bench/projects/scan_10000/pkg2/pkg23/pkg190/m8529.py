@@ -0,0 +1,53 @@
+"""Module 8529."""
+import pkg1.pkg12.pkg103.m5523
+from pkg1 import m0
+import pkg5.pkg46.pkg376.m1209
+from pkg3.pkg32.pkg261 import m3179
+from . import m5610
+from pkg3.pkg30.pkg241 import m6912
+from . import m189
+from pkg5.pkg44.pkg360 import m1610
+from . import m6444
+from pkg5.pkg48.pkg390 import m1640
+
+
+def helper_8529_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8529_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8529_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8529_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_8529_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_8529_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,13 @@
+"""Module 8946."""
+import pkg1.pkg9.m8
+from . import m7278
+from . import m7695
+from pkg2.pkg24.pkg197 import m196
+import pkg3.pkg32.pkg263.m6100
+
+
+def helper_8946_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
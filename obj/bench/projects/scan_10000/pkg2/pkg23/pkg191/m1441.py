@@ -0,0 +1,18 @@
+"""Module 1441."""
+import pkg6.m5
+from pkg4.pkg35.pkg283 import m699
+import pkg2.pkg21.m20
+from . import m607
+import pkg7.pkg62.m895
+from pkg1.pkg9.pkg79 import m1329
+import pkg1.pkg13.pkg110.m943
+from pkg3.pkg30.pkg247 import m1080
+import pkg8.pkg68.m484
+from pkg5.pkg47.pkg377 import m793
+
+
+def helper_1441_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
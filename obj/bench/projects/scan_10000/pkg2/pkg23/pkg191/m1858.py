@@ -0,0 +1,3 @@
+"""Module 1858."""
+import pkg4.pkg36.pkg295.m294
+from pkg3.pkg28.pkg227 import m226
@@ -0,0 +1,54 @@
+"""Module 3526."""
+from . import m1024
+from pkg1.pkg14.pkg116 import m532
+import pkg7.pkg63.m2564
+from . import m3109
+import pkg1.pkg10.pkg85.m84
+from pkg1.pkg9.pkg80 import m913
+import pkg5.pkg41.m40
+from . import m1441
+import pkg3.pkg28.m444
+from pkg7.pkg59 import m58
+import pkg1.pkg9.pkg76.m75
+
+
+def helper_3526_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3526_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3526_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3526_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_3526_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_3526_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
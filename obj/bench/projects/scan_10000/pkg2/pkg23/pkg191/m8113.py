@@ -0,0 +1,17 @@
+"""Module 8113."""
+import pkg5.pkg47.pkg384.m7055
+from pkg1.pkg11.pkg94 import m93
+import pkg5.pkg41.pkg329.m5332
+from pkg1.pkg15.pkg127 import m3045
+import pkg2.m1
+from pkg8.pkg65 import m3400
+import pkg6.pkg49.pkg396.m5816
+from pkg3.pkg28.pkg226 import m1059
+import pkg2.pkg18.pkg148.m5151
+
+
+def helper_8113_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
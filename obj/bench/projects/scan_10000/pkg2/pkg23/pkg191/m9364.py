@@ -0,0 +1,39 @@
+"""Module 9364."""
+import pkg4.pkg40.pkg324.m7829
+from pkg7.pkg59 import m4228
+import pkg1.pkg16.pkg131.m3883
+from pkg2.pkg24.pkg197 import m196
+import pkg5.pkg41.pkg329.m328
+from pkg4.pkg39.pkg314 import m730
+import pkg5.pkg42.m2960
+from . import m3526
+from . import m5611
+from pkg2.pkg20.pkg161 import m1411
+
+
+def helper_9364_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9364_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9364_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9364_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,45 @@
+"""Module 1025."""
+import pkg6.m5
+from pkg5.pkg44.pkg357 import m773
+import pkg1.pkg14.pkg117.m116
+from . import m191
+import pkg3.pkg26.m25
+from pkg1.pkg12 import m11
+import pkg4.pkg33.pkg270.m269
+from pkg2.pkg22.pkg180 import m179
+import pkg5.pkg46.pkg369.m368
+
+
+def helper_1025_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1025_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1025_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1025_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_1025_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
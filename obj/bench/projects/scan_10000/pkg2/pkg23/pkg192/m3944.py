@@ -0,0 +1,25 @@
+"""Module 3944."""
+from . import m2693
+from pkg6.pkg50.pkg403 import m1653
+import pkg4.pkg35.pkg288.m1955
+from . import m608
+import pkg1.pkg14.m847
+from pkg6 import m839
+import pkg1.pkg11.pkg93.m92
+from pkg1.pkg12.pkg103 import m102
+import pkg2.pkg23.m22
+from pkg1.pkg9.pkg73 import m1323
+
+
+def helper_3944_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3944_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,14 @@
+"""Module 6029."""
+import pkg3.pkg32.m31
+from pkg4.pkg39.pkg314 import m313
+import pkg1.m0
+from pkg5.pkg43 import m2544
+import pkg5.pkg43.pkg348.m1181
+from . import m2276
+
+
+def helper_6029_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
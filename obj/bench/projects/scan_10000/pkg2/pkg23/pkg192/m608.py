@@ -0,0 +1,18 @@
+"""Module 608."""
+from . import m191
+from pkg8.pkg66 import m65
+import pkg5.pkg43.m42
+
+
+def helper_608_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_608_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 7280."""
+from . import m6863
+from pkg3.pkg30.pkg241 import m3993
+import pkg7.m6
+from . import m5612
+from . import m6446
+
+
+def helper_7280_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7280_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7280_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
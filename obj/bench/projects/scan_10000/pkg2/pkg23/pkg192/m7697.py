@@ -0,0 +1,25 @@
+"""Module 7697."""
+import pkg3.pkg27.pkg218.m3970
+from pkg2.pkg20.pkg166 import m2667
+import pkg2.pkg22.pkg178.m7266
+
+
+def helper_7697_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7697_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7697_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
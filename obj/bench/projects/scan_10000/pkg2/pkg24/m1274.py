@@ -0,0 +1,9 @@
+"""Module 1274."""
+import pkg2.pkg18.pkg152.m151
+
+
+def helper_1274_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,24 @@
+"""Module 5027."""
+from . import m2108
+from pkg4.pkg34.pkg277 import m276
+import pkg3.pkg27.pkg222.m3557
+from pkg1.pkg16.pkg134 import m133
+import pkg5.pkg42.pkg343.m759
+from pkg2.pkg19.pkg156 import m3074
+import pkg1.pkg15.pkg124.m540
+from pkg2.pkg19.pkg153 import m4322
+import pkg2.pkg22.pkg180.m3932
+
+
+def helper_5027_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5027_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,41 @@
+"""Module 7112."""
+import pkg5.pkg46.pkg375.m2042
+from pkg2.pkg24.pkg200 import m199
+from . import m6278
+from pkg1.pkg11.pkg92 import m91
+from . import m5861
+from pkg2.pkg19 import m4188
+import pkg3.pkg31.pkg249.m665
+from pkg4.pkg40 import m873
+import pkg4.pkg37.m1287
+from . import m23
+import pkg2.pkg21.pkg174.m1424
+from pkg2.pkg20.pkg164 import m580
+
+
+def helper_7112_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7112_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7112_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7112_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,34 @@
+"""Module 7946."""
+import pkg1.pkg11.pkg96.m3014
+from . import m1691
+import pkg2.m1
+from pkg1 import m0
+import pkg4.pkg33.pkg268.m2352
+from pkg6.pkg51 import m2135
+import pkg2.pkg19.pkg156.m572
+from pkg4.pkg34 import m33
+import pkg2.pkg18.m17
+from pkg3.pkg32.pkg264 import m4433
+import pkg1.pkg10.pkg85.m501
+from pkg3.pkg25.pkg204 import m203
+
+
+def helper_7946_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7946_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7946_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
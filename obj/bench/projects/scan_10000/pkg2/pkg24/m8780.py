@@ -0,0 +1,40 @@
+"""Module 8780."""
+import pkg2.pkg22.pkg177.m3095
+from . import m4610
+from . import m6278
+from pkg1.pkg13.pkg108 import m1775
+import pkg7.pkg58.m57
+from pkg1.pkg14.pkg117 import m8456
+import pkg4.pkg36.pkg291.m290
+from . import m4193
+from . import m440
+from pkg4.pkg38.pkg305 import m721
+import pkg6.m5009
+
+
+def helper_8780_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8780_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8780_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8780_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,14 @@
+"""Module 3945."""
+import pkg2.pkg24.m3776
+from . import m3528
+import pkg7.pkg61.m3396
+from . import m1443
+from . import m192
+from pkg1.pkg15.pkg125 import m3043
+
+
+def helper_3945_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
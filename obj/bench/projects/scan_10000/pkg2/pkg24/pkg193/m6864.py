@@ -0,0 +1,32 @@
+"""Module 6864."""
+import pkg3.pkg27.pkg219.m3137
+from pkg2.pkg22.pkg177 import m3929
+import pkg3.pkg26.m25
+from pkg1 import m0
+from . import m6030
+from pkg4.pkg35 import m2953
+import pkg2.pkg24.m857
+from pkg1.pkg11.pkg96 import m2597
+from . import m1026
+from pkg3.pkg25.pkg202 import m4371
+
+
+def helper_6864_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6864_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6864_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 8115."""
+import pkg1.m0
+from . import m5613
+import pkg5.pkg42.pkg341.m2425
+from . import m3528
+import pkg8.pkg71.m70
+
+
+def helper_8115_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8115_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
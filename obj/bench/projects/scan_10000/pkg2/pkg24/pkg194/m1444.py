@@ -0,0 +1,14 @@
+"""Module 1444."""
+import pkg2.pkg22.pkg182.m1015
+from pkg1.pkg10.pkg81 import m80
+from . import m1027
+from . import m193
+import pkg4.pkg34.pkg278.m277
+from pkg5.pkg44.pkg357 import m356
+
+
+def helper_1444_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,10 @@
+"""Module 3946."""
+import pkg1.pkg9.pkg80.m79
+from pkg5.pkg48.pkg391 import m2475
+
+
+def helper_3946_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
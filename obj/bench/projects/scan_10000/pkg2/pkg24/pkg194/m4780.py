@@ -0,0 +1,27 @@
+"""Module 4780."""
+import pkg5.pkg45.pkg365.m4534
+from pkg4.pkg39.pkg314 import m313
+from . import m1444
+from pkg1.pkg16.pkg131 import m547
+from . import m4363
+
+
+def helper_4780_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4780_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4780_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
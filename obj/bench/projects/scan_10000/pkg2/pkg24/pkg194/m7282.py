@@ -0,0 +1,38 @@
+"""Module 7282."""
+import pkg1.m0
+from pkg2.pkg23.pkg188 import m6442
+import pkg1.pkg14.m6685
+from . import m4363
+import pkg2.pkg21.pkg175.m2676
+from pkg6.pkg49.pkg394 import m393
+from . import m5197
+from pkg7 import m6
+from . import m6031
+
+
+def helper_7282_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7282_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7282_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7282_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
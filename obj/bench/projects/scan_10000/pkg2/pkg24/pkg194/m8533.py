@@ -0,0 +1,26 @@
+"""Module 8533."""
+import pkg4.pkg34.pkg273.m4025
+from pkg4.pkg33.pkg265 import m264
+import pkg1.pkg14.pkg114.m113
+from pkg4.pkg35.pkg288 import m2789
+
+
+def helper_8533_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8533_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8533_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
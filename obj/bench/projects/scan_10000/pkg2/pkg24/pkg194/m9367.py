@@ -0,0 +1,48 @@
+"""Module 9367."""
+import pkg3.pkg31.m447
+from . import m1444
+import pkg5.pkg41.pkg333.m1166
+from pkg3.pkg28.pkg230 import m4399
+import pkg3.pkg32.pkg258.m257
+from pkg3.pkg27.pkg223 import m639
+import pkg3.pkg29.pkg235.m1902
+from pkg1.pkg16.pkg129 import m128
+import pkg2.pkg24.m7112
+from . import m4780
+import pkg2.m1
+from pkg4.pkg34 import m33
+
+
+def helper_9367_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9367_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9367_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9367_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_9367_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
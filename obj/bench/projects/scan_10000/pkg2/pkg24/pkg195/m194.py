@@ -0,0 +1,14 @@
+"""Module 194."""
+import pkg4.m3
+from pkg8.pkg72 import m71
+import pkg2.m1
+from pkg8.pkg70 import m69
+import pkg6.m5
+from pkg2.pkg21.pkg172 import m171
+
+
+def helper_194_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
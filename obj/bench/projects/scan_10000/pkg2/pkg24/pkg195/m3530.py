@@ -0,0 +1,29 @@
+"""Module 3530."""
+import pkg2.pkg21.pkg171.m1004
+from pkg4.pkg33.pkg271 import m3189
+import pkg2.pkg21.pkg175.m2676
+from pkg5.pkg46.pkg375 import m374
+from . import m1862
+from pkg6.pkg51.pkg412 import m828
+from . import m611
+
+
+def helper_3530_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3530_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3530_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,4 @@
+"""Module 4364."""
+import pkg5.pkg48.pkg390.m1640
+from pkg4.pkg40.pkg325 import m741
+import pkg1.pkg16.pkg132.m131
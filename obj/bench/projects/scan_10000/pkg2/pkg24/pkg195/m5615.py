@@ -0,0 +1,11 @@
+"""Module 5615."""
+import pkg5.pkg43.pkg350.m766
+from pkg2.pkg22.pkg179 import m3931
+import pkg4.pkg40.pkg324.m1574
+
+
+def helper_5615_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
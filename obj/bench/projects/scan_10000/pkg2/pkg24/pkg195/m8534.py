@@ -0,0 +1,34 @@
+"""Module 8534."""
+import pkg6.pkg51.pkg416.m2083
+from pkg5.pkg41.pkg330 import m1163
+import pkg2.pkg23.pkg191.m607
+from pkg5.pkg46.pkg371 import m4540
+import pkg5.pkg48.m47
+
+
+def helper_8534_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8534_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8534_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8534_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,31 @@
+"""Module 1029."""
+import pkg1.m0
+from . import m612
+import pkg3.pkg31.pkg253.m252
+from pkg2.pkg22.pkg179 import m178
+import pkg1.pkg10.m9
+from pkg4.pkg35.pkg282 import m698
+import pkg4.m3
+from . import m195
+import pkg1.pkg14.pkg118.m117
+
+
+def helper_1029_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1029_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1029_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,24 @@
+"""Module 195."""
+import pkg2.pkg20.m19
+from pkg1.pkg10.pkg87 import m86
+import pkg1.pkg9.m8
+from pkg2.pkg17.pkg139 import m138
+import pkg1.pkg12.pkg98.m97
+from pkg3 import m2
+import pkg4.pkg39.m38
+from pkg5.pkg42 import m41
+import pkg2.pkg17.m16
+
+
+def helper_195_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_195_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,44 @@
+"""Module 5199."""
+import pkg1.pkg10.m9
+from pkg4.pkg35 import m34
+import pkg2.pkg20.pkg162.m161
+from pkg5.pkg45 import m44
+import pkg1.pkg11.m10
+from pkg2.pkg21.pkg170 import m586
+import pkg1.pkg9.pkg79.m4248
+from pkg1 import m0
+
+
+def helper_5199_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5199_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5199_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5199_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_5199_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
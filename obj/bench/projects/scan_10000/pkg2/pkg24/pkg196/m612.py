@@ -0,0 +1,15 @@
+"""Module 612."""
+import pkg3.pkg32.pkg261.m260
+from pkg6 import m422
+import pkg1.m0
+from pkg3.pkg27.pkg222 import m221
+import pkg2.m1
+from . import m195
+import pkg3.pkg30.m29
+
+
+def helper_612_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
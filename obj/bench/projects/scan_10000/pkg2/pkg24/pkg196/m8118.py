@@ -0,0 +1,30 @@
+"""Module 8118."""
+import pkg1.m0
+from pkg5.pkg41.pkg334 import m2418
+import pkg1.pkg14.m13
+from pkg4.pkg37.pkg297 import m296
+import pkg1.pkg11.pkg92.m925
+from pkg6.pkg49.pkg399 import m398
+import pkg1.pkg14.pkg118.m951
+from . import m4365
+
+
+def helper_8118_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8118_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8118_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
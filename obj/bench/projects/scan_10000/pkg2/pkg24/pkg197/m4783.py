@@ -0,0 +1,31 @@
+"""Module 4783."""
+import pkg1.pkg10.pkg86.m85
+from pkg2.pkg20.pkg165 import m998
+import pkg1.pkg10.pkg85.m84
+from pkg1 import m0
+import pkg1.pkg13.m2931
+from pkg2.pkg17.pkg141 import m140
+import pkg4.pkg33.pkg271.m687
+from pkg4.pkg35.pkg287 import m1954
+import pkg2.pkg21.m854
+
+
+def helper_4783_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4783_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4783_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
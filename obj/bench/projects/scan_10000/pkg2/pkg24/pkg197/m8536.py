@@ -0,0 +1,25 @@
+"""Module 8536."""
+import pkg1.pkg9.pkg80.m79
+from pkg1.pkg14 import m13
+from . import m6034
+from pkg4.pkg38.pkg305 import m1555
+from . import m196
+from pkg5.pkg48 import m1298
+from . import m613
+from . import m8119
+import pkg5.m7510
+from pkg3.pkg30.pkg241 import m5661
+
+
+def helper_8536_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8536_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
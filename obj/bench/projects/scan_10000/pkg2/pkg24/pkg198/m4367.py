@@ -0,0 +1,5 @@
+"""Module 4367."""
+import pkg6.pkg50.pkg407.m2491
+from pkg2.pkg17 import m16
+import pkg4.pkg36.pkg296.m712
+from pkg1.pkg9.pkg80 import m2581
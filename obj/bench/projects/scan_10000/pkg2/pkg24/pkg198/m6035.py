@@ -0,0 +1,17 @@
+"""Module 6035."""
+import pkg5.pkg44.pkg355.m354
+from . import m197
+import pkg4.pkg37.pkg304.m303
+from pkg3.pkg29 import m28
+import pkg5.pkg48.pkg390.m5810
+from pkg4.pkg40.pkg322 import m1989
+import pkg4.m1254
+from pkg1 import m0
+import pkg1.pkg14.pkg118.m5955
+
+
+def helper_6035_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
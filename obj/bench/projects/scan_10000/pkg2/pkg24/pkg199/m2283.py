@@ -0,0 +1,61 @@
+"""Module 2283."""
+import pkg3.m2
+from pkg1 import m0
+import pkg4.pkg38.pkg308.m307
+from . import m1032
+import pkg1.pkg14.pkg116.m532
+from pkg2.pkg17.pkg141 import m1808
+import pkg3.pkg28.pkg230.m229
+from pkg3.pkg31.pkg252 import m1502
+import pkg4.pkg40.pkg328.m1161
+from pkg2.pkg20.pkg167 import m583
+import pkg6.pkg51.pkg410.m409
+
+
+def helper_2283_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2283_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2283_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2283_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_2283_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_2283_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2283_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 3534."""
+import pkg4.pkg40.pkg322.m1989
+from pkg3 import m2
+import pkg4.pkg37.pkg300.m1550
+
+
+def helper_3534_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,13 @@
+"""Module 4368."""
+import pkg2.pkg17.pkg144.m143
+from . import m198
+import pkg4.pkg39.pkg317.m316
+from pkg1.pkg12.pkg101 import m3853
+import pkg8.pkg69.m2153
+
+
+def helper_4368_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,12 @@
+"""Module 2701."""
+import pkg8.pkg66.m482
+from pkg4.pkg38.pkg306 import m305
+import pkg3.pkg32.pkg258.m674
+from pkg5.pkg42.pkg341 import m340
+
+
+def helper_2701_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
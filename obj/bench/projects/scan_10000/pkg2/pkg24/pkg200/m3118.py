@@ -0,0 +1,11 @@
+"""Module 3118."""
+import pkg1.pkg10.m1260
+from . import m2284
+import pkg1.pkg9.m8
+
+
+def helper_3118_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 7288."""
+import pkg1.pkg16.pkg135.m3470
+from pkg1 import m0
+
+
+def helper_7288_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7288_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,14 @@
+"""Module 2087."""
+import pkg1.m0
+from pkg3.pkg29 import m28
+from . import m1670
+from pkg4.pkg39.pkg318 import m1985
+from . import m2
+from pkg2.pkg23.pkg189 import m1439
+
+
+def helper_2087_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,41 @@
+"""Module 4589."""
+import pkg3.pkg28.m27
+from pkg3.pkg32.pkg263 import m1096
+from . import m2
+from pkg2.pkg17.pkg141 import m1808
+import pkg4.pkg37.pkg304.m3639
+from pkg3.pkg28.pkg226 import m1476
+import pkg4.pkg34.m4203
+from pkg1.pkg14.pkg120 import m536
+import pkg1.m0
+from . import m1670
+import pkg1.pkg10.pkg87.m2588
+from pkg3.pkg31.pkg250 import m1083
+
+
+def helper_4589_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4589_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4589_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4589_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
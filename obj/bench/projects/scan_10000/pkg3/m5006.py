@@ -0,0 +1,26 @@
+"""Module 5006."""
+import pkg1.m0
+from pkg1.pkg9.pkg78 import m2162
+import pkg3.pkg28.m27
+from pkg5.pkg45.pkg361 import m3279
+import pkg2.pkg21.pkg174.m3926
+from pkg1.pkg16 import m432
+import pkg1.pkg14.pkg113.m112
+from pkg2.pkg22.pkg182 import m181
+from . import m4589
+from pkg4.pkg33.pkg270 import m1937
+import pkg2.m1
+
+
+def helper_5006_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5006_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
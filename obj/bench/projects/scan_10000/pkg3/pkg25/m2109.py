@@ -0,0 +1,35 @@
+"""Module 2109."""
+import pkg2.pkg23.pkg192.m191
+from pkg1.pkg11.pkg90 import m506
+import pkg1.pkg9.pkg80.m1747
+from pkg1 import m0
+import pkg1.pkg10.pkg85.m84
+from pkg1.pkg9.pkg75 import m1742
+
+
+def helper_2109_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2109_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2109_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2109_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
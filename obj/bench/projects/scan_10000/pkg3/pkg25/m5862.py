@@ -0,0 +1,22 @@
+"""Module 5862."""
+import pkg5.pkg47.pkg384.m2468
+from pkg5.pkg42.pkg344 import m760
+from . import m1275
+from pkg5.pkg42.pkg342 import m341
+import pkg4.pkg37.pkg300.m1550
+from pkg7.pkg60 import m59
+import pkg3.pkg31.pkg253.m1086
+
+
+def helper_5862_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5862_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
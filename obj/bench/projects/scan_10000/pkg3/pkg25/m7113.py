@@ -0,0 +1,33 @@
+"""Module 7113."""
+from . import m5445
+from pkg4 import m3
+import pkg2.pkg22.pkg180.m1847
+from pkg8.pkg66 import m65
+from . import m1275
+from . import m5028
+from . import m1692
+from pkg4.pkg34.pkg274 import m273
+import pkg5.pkg43.pkg346.m6600
+from pkg4.pkg36 import m1703
+import pkg2.pkg17.pkg141.m1808
+
+
+def helper_7113_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7113_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7113_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
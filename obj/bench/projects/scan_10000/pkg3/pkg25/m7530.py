@@ -0,0 +1,45 @@
+"""Module 7530."""
+import pkg3.pkg26.pkg214.m3966
+from pkg4.pkg35.pkg284 import m1951
+import pkg6.pkg51.m50
+from . import m2109
+from . import m858
+from pkg8.pkg68 import m3820
+import pkg3.pkg25.pkg207.m5627
+from pkg4.pkg36.pkg289 import m288
+import pkg5.pkg47.pkg381.m380
+
+
+def helper_7530_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7530_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7530_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7530_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_7530_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,12 @@
+"""Module 9615."""
+import pkg2.pkg17.pkg137.m9310
+from pkg5.pkg42.pkg342 import m341
+from . import m1275
+from pkg5.pkg42 import m458
+
+
+def helper_9615_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
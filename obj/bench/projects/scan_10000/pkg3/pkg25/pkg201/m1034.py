@@ -0,0 +1,11 @@
+"""Module 1034."""
+import pkg5.pkg47.m463
+from pkg1 import m0
+import pkg1.pkg13.pkg111.m944
+
+
+def helper_1034_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
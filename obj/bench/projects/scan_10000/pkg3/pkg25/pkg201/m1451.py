@@ -0,0 +1,9 @@
+"""Module 1451."""
+import pkg4.pkg33.pkg267.m266
+
+
+def helper_1451_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,12 @@
+"""Module 3953."""
+import pkg3.m2
+from pkg6.pkg51.pkg410 import m826
+import pkg2.pkg17.pkg140.m1807
+from pkg6.pkg49.pkg393 import m809
+
+
+def helper_3953_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
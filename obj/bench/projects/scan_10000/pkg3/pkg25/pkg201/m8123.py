@@ -0,0 +1,47 @@
+"""Module 8123."""
+import pkg3.pkg28.pkg232.m231
+from pkg2.pkg23.pkg186 import m602
+from . import m6455
+from pkg3.pkg26.pkg210 import m209
+import pkg5.pkg47.pkg384.m383
+from pkg2.pkg17.pkg137 import m1804
+import pkg2.pkg22.pkg181.m180
+from . import m3119
+import pkg3.pkg29.pkg240.m1907
+from pkg5.pkg42.pkg339 import m338
+import pkg2.pkg21.pkg175.m174
+
+
+def helper_8123_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8123_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8123_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8123_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_8123_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
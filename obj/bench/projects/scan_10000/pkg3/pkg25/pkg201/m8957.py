@@ -0,0 +1,12 @@
+"""Module 8957."""
+import pkg1.pkg11.pkg95.m4681
+from pkg4.pkg34.pkg273 import m3608
+import pkg2.pkg22.pkg184.m6438
+from . import m7706
+
+
+def helper_8957_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
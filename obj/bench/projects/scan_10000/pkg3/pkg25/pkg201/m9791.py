@@ -0,0 +1,34 @@
+"""Module 9791."""
+import pkg7.m6
+from pkg1 import m0
+import pkg7.pkg57.m1307
+from . import m6872
+import pkg4.pkg37.pkg299.m1132
+from pkg4.pkg34.pkg279 import m7784
+import pkg2.m1
+from pkg3.pkg28.pkg227 import m1060
+import pkg1.pkg15.pkg123.m6794
+from pkg4.pkg38 import m37
+import pkg1.pkg10.pkg81.m80
+from pkg8.pkg71 import m1321
+
+
+def helper_9791_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9791_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9791_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,15 @@
+"""Module 3954."""
+import pkg1.pkg15.pkg125.m124
+from . import m618
+import pkg2.pkg19.m435
+from pkg1.pkg14.pkg116 import m949
+import pkg4.pkg35.pkg285.m284
+from pkg2.pkg24 import m23
+import pkg1.pkg9.pkg76.m75
+
+
+def helper_3954_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,28 @@
+"""Module 4371."""
+import pkg6.pkg51.pkg410.m409
+from . import m3537
+import pkg1.pkg10.m9
+from pkg5.pkg43.pkg349 import m1182
+import pkg5.pkg46.m462
+from pkg4.pkg33.pkg271 import m1104
+
+
+def helper_4371_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4371_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4371_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,62 @@
+"""Module 6039."""
+from . import m5622
+from pkg3.pkg29.pkg238 import m237
+import pkg7.pkg61.m4230
+from pkg1.pkg9.pkg77 import m76
+from . import m3120
+from pkg1.pkg15 import m14
+import pkg2.pkg23.pkg187.m2688
+from . import m2703
+import pkg3.pkg32.pkg257.m1090
+from pkg1 import m0
+import pkg1.pkg10.pkg81.m497
+from pkg1.pkg9.pkg80 import m913
+
+
+def helper_6039_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6039_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6039_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6039_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_6039_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_6039_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6039_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,16 @@
+"""Module 6456."""
+import pkg2.pkg23.pkg190.m5610
+from pkg5.pkg47 import m2965
+import pkg4.pkg35.m34
+from pkg1 import m0
+import pkg1.pkg10.pkg84.m3419
+from pkg2.pkg22.pkg184 import m183
+from . import m3120
+from pkg6 import m5
+
+
+def helper_6456_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
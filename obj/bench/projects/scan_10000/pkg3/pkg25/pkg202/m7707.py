@@ -0,0 +1,17 @@
+"""Module 7707."""
+import pkg2.pkg21.pkg169.m1419
+from pkg4.pkg39.pkg316 import m1149
+import pkg3.pkg30.pkg244.m4830
+from pkg4 import m4173
+import pkg2.pkg21.pkg171.m1004
+from pkg4.pkg36.pkg293 import m4045
+import pkg6.pkg50.pkg408.m2492
+from pkg3 import m2
+import pkg6.pkg52.pkg417.m416
+
+
+def helper_7707_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 8541."""
+import pkg1.m0
+from pkg5.pkg42.pkg339 import m755
+from . import m201
+from pkg3.pkg28.pkg232 import m4401
+
+
+def helper_8541_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8541_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
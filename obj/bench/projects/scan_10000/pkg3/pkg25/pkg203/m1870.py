@@ -0,0 +1,36 @@
+"""Module 1870."""
+import pkg7.pkg58.m57
+from pkg2.pkg24.pkg200 import m199
+import pkg3.m2
+from pkg4.pkg37.pkg299 import m298
+import pkg5.m4
+from pkg1.pkg13.pkg109 import m525
+import pkg1.pkg15.m14
+
+
+def helper_1870_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1870_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1870_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1870_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
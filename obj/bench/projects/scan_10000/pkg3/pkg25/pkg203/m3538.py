@@ -0,0 +1,25 @@
+"""Module 3538."""
+import pkg2.pkg17.pkg137.m2221
+from . import m2287
+import pkg4.pkg33.pkg268.m267
+from pkg1.pkg15.pkg126 import m542
+import pkg8.m7
+from pkg5.pkg41.pkg331 import m1581
+import pkg5.pkg42.pkg341.m1591
+from . import m3121
+from . import m619
+from pkg1.pkg9.pkg74 import m73
+
+
+def helper_3538_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3538_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
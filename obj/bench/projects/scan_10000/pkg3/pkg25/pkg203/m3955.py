@@ -0,0 +1,53 @@
+"""Module 3955."""
+import pkg1.pkg13.m12
+from pkg1.pkg12.pkg104 import m103
+import pkg3.pkg25.pkg201.m3119
+from pkg1.pkg10 import m9
+import pkg7.pkg63.m479
+from pkg3.pkg26.pkg211 import m210
+import pkg2.pkg22.pkg180.m179
+from . import m2287
+import pkg1.pkg11.pkg90.m923
+from pkg5.pkg43.pkg352 import m3687
+
+
+def helper_3955_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3955_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3955_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3955_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_3955_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_3955_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,29 @@
+"""Module 619."""
+from . import m202
+from pkg6.pkg55 import m471
+import pkg2.pkg20.pkg168.m167
+from pkg2.pkg18.pkg145 import m144
+import pkg6.m5
+from pkg3.pkg30 import m29
+import pkg1.m0
+
+
+def helper_619_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_619_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_619_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 8542."""
+import pkg4.m1254
+from pkg3.pkg28.pkg225 import m641
+import pkg2.pkg22.pkg184.m3519
+from pkg6.pkg54 import m53
+import pkg7.pkg64.m63
+from pkg4.pkg37.pkg298 import m2382
+import pkg2.pkg24.pkg194.m610
+from pkg4.pkg34 import m3786
+from . import m3121
+from pkg2.pkg23 import m5860
+import pkg2.pkg23.pkg187.m1437
+from pkg1.pkg16.pkg136 import m1386
+
+
+def helper_8542_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 1871."""
+import pkg2.pkg23.pkg190.m189
+from pkg2.pkg19.pkg153 import m1820
+from . import m1037
+from . import m203
+import pkg6.pkg51.pkg410.m409
+
+
+def helper_1871_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1871_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 2288."""
+import pkg1.pkg10.pkg88.m921
+from pkg4.pkg39.pkg319 import m1569
+import pkg1.pkg11.pkg93.m92
+from pkg1.pkg11.pkg92 import m91
+import pkg5.pkg44.pkg354.m770
+from pkg8 import m7
+import pkg6.pkg52.m51
+from pkg2.pkg24.pkg197 import m196
+import pkg4.pkg36.m452
+
+
+def helper_2288_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,40 @@
+"""Module 7292."""
+import pkg1.pkg11.pkg96.m2180
+from pkg5.pkg46.pkg375 import m374
+from . import m3956
+from pkg1.pkg12.pkg101 import m3853
+import pkg1.pkg9.pkg78.m2579
+from pkg1 import m0
+import pkg1.pkg11.m3346
+from pkg6 import m5
+import pkg4.pkg34.pkg277.m1527
+from pkg7.pkg59 import m58
+import pkg1.pkg9.pkg78.m77
+
+
+def helper_7292_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7292_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7292_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7292_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,61 @@
+"""Module 3957."""
+import pkg4.pkg35.pkg283.m282
+from pkg3.pkg27.pkg224 import m223
+from . import m2289
+from pkg2.pkg24.pkg200 import m3952
+import pkg1.pkg14.pkg119.m535
+from . import m1038
+import pkg4.pkg33.pkg270.m269
+from pkg1.pkg16.pkg136 import m135
+import pkg1.m0
+from pkg1.pkg10.pkg88 import m3006
+import pkg4.pkg38.pkg311.m310
+
+
+def helper_3957_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3957_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3957_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3957_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_3957_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_3957_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3957_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,39 @@
+"""Module 4374."""
+import pkg3.pkg27.pkg224.m1891
+from pkg3.pkg32.pkg258 import m3593
+from . import m204
+from . import m1872
+import pkg8.pkg65.m1732
+from pkg6 import m5
+import pkg2.pkg24.pkg197.m196
+from pkg2.pkg20.pkg162 import m161
+import pkg5.pkg42.pkg338.m1171
+from . import m3123
+
+
+def helper_4374_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4374_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4374_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4374_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
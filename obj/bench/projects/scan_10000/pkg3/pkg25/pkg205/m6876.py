@@ -0,0 +1,24 @@
+"""Module 6876."""
+import pkg2.m1
+from pkg3 import m2
+import pkg1.pkg11.pkg96.m95
+from . import m1038
+import pkg1.pkg10.pkg84.m6338
+from . import m3540
+import pkg1.pkg15.pkg123.m539
+from pkg2.pkg22.pkg182 import m6019
+from . import m4791
+
+
+def helper_6876_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6876_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,45 @@
+"""Module 8544."""
+import pkg3.pkg31.pkg251.m250
+from pkg2.pkg21.pkg174 import m7679
+import pkg2.pkg22.pkg179.m178
+from . import m1872
+from . import m6876
+from pkg2.pkg24.pkg199 import m7287
+from . import m8127
+from . import m204
+import pkg8.pkg67.m4236
+
+
+def helper_8544_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8544_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8544_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8544_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_8544_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
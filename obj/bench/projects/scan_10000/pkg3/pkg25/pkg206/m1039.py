@@ -0,0 +1,39 @@
+"""Module 1039."""
+from . import m205
+from pkg1.pkg9.pkg75 import m74
+import pkg2.pkg23.m22
+from pkg3.pkg30 import m29
+import pkg5.m4
+from pkg2.pkg22 import m21
+import pkg2.pkg18.pkg152.m151
+from . import m622
+import pkg2.pkg17.m16
+from pkg2.pkg24 import m23
+
+
+def helper_1039_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1039_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1039_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1039_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,9 @@
+"""Module 1873."""
+import pkg1.pkg12.pkg98.m97
+
+
+def helper_1873_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
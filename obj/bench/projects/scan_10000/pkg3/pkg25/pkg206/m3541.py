@@ -0,0 +1,19 @@
+"""Module 3541."""
+import pkg5.m4
+from pkg2.pkg23.pkg188 import m187
+import pkg2.pkg19.pkg159.m158
+from . import m1873
+import pkg3.pkg27.pkg221.m220
+from pkg1.pkg9.pkg74 import m73
+import pkg2.pkg22.pkg179.m1012
+from . import m2707
+import pkg1.m0
+from pkg4.pkg33.pkg267 import m683
+import pkg2.pkg22.pkg177.m593
+
+
+def helper_3541_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
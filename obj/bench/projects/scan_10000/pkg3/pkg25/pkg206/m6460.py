@@ -0,0 +1,33 @@
+"""Module 6460."""
+import pkg4.pkg35.pkg285.m701
+from pkg2.pkg23 import m22
+from . import m3958
+from pkg2.pkg23.pkg188 import m187
+from . import m1873
+from pkg4.pkg35.pkg288 import m287
+import pkg5.m4
+from pkg3.pkg28.pkg232 import m2733
+import pkg3.pkg28.pkg232.m648
+from . import m1456
+import pkg1.pkg10.m9
+
+
+def helper_6460_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6460_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6460_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,10 @@
+"""Module 7711."""
+import pkg3.pkg31.m30
+from pkg3.pkg32.pkg260 import m1093
+import pkg2.pkg21.pkg174.m5594
+from pkg1.pkg10.pkg87 import m6341
+import pkg2.pkg23.pkg186.m1019
+from pkg4.pkg38.pkg309 import m2393
+import pkg1.pkg15.pkg122.m121
+from pkg5.pkg42.pkg341 import m2842
+import pkg1.pkg12.pkg104.m7609
@@ -0,0 +1,10 @@
+"""Module 8128."""
+import pkg4.m3
+from pkg2.pkg19.pkg160 import m5997
+
+
+def helper_8128_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 1040."""
+import pkg1.m0
+from pkg2.pkg22 import m21
+import pkg3.pkg30.pkg247.m246
+from . import m623
+
+
+def helper_1040_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1040_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1040_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
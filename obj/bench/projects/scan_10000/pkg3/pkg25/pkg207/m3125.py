@@ -0,0 +1,22 @@
+"""Module 3125."""
+import pkg3.pkg32.pkg262.m261
+from pkg1.pkg13.pkg112 import m3030
+import pkg5.pkg48.pkg387.m1637
+from pkg6.pkg50.pkg407 import m1657
+import pkg6.pkg51.pkg416.m1249
+from . import m623
+import pkg4.pkg33.pkg269.m2770
+
+
+def helper_3125_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3125_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,40 @@
+"""Module 4376."""
+import pkg3.pkg25.pkg205.m3957
+from pkg2 import m1
+import pkg5.pkg47.m46
+from pkg1.pkg9 import m3761
+import pkg2.pkg17.pkg137.m136
+from . import m206
+import pkg4.pkg33.m1283
+from pkg1.pkg15.pkg124 import m1374
+import pkg4.pkg33.pkg270.m269
+from pkg2.pkg17.pkg140 import m1390
+import pkg2.pkg22.m2940
+
+
+def helper_4376_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4376_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4376_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4376_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
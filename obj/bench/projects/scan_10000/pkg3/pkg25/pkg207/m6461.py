@@ -0,0 +1,55 @@
+"""Module 6461."""
+import pkg3.pkg25.pkg203.m1036
+from pkg2.pkg17.pkg138 import m137
+import pkg5.pkg46.m6300
+from pkg2.pkg21.pkg176 import m4762
+import pkg1.m0
+from . import m2291
+import pkg2.pkg24.pkg197.m196
+from . import m5627
+import pkg2.pkg20.pkg166.m3501
+from pkg2.pkg22.pkg181 import m180
+from . import m1457
+from pkg2.pkg18 import m17
+
+
+def helper_6461_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6461_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6461_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6461_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_6461_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_6461_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
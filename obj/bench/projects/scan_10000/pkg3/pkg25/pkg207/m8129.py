@@ -0,0 +1,20 @@
+"""Module 8129."""
+import pkg5.pkg42.pkg337.m7842
+from . import m206
+import pkg5.m4
+from pkg5.pkg43.pkg346 import m1179
+import pkg4.pkg35.pkg288.m2789
+
+
+def helper_8129_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8129_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 1875."""
+import pkg1.pkg13.pkg107.m106
+from pkg1 import m0
+import pkg2.pkg20.pkg168.m167
+from pkg5.pkg46.pkg373 import m1206
+import pkg4.pkg37.pkg298.m1548
+from pkg4.pkg37 import m870
+import pkg1.pkg14.pkg120.m119
+from pkg8.pkg65 import m64
+from . import m1458
+from pkg1.pkg15.pkg122 import m955
+import pkg3.m2
+from pkg8.pkg66 import m1316
+
+
+def helper_1875_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1875_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,37 @@
+"""Module 3126."""
+import pkg3.pkg26.pkg213.m629
+from pkg7 import m6
+import pkg3.pkg26.pkg211.m627
+from pkg1 import m0
+import pkg5.pkg44.pkg359.m1609
+from pkg2.pkg23.pkg185 import m1435
+from . import m1875
+from pkg4.pkg39.pkg313 import m729
+
+
+def helper_3126_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3126_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3126_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3126_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 4377."""
+import pkg5.pkg48.pkg390.m2057
+from pkg1 import m0
+import pkg7.pkg62.m1312
+from pkg5.pkg42.pkg344 import m2845
+import pkg2.pkg21.pkg176.m175
+from pkg6.pkg52.pkg417 import m2918
+import pkg4.pkg40.m39
+from pkg8 import m7
+from . import m3126
+from pkg4.pkg38 import m37
+import pkg2.pkg24.pkg197.m2698
+
+
+def helper_4377_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4377_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
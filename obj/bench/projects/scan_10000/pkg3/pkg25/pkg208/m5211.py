@@ -0,0 +1,8 @@
+"""Module 5211."""
+from . import m624
+from pkg5.pkg42 import m4628
+import pkg3.pkg28.m27
+from pkg3.pkg28.pkg232 import m4818
+import pkg4.pkg38.pkg306.m305
+from pkg1.pkg11.pkg89 import m505
+import pkg6.pkg54.m1721
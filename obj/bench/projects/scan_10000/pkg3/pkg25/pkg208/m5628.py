@@ -0,0 +1,35 @@
+"""Module 5628."""
+import pkg2.pkg19.pkg155.m1405
+from pkg5.pkg43.pkg351 import m3686
+from . import m1458
+from pkg6.pkg50.pkg406 import m4158
+import pkg4.pkg37.pkg299.m4051
+from pkg3 import m2
+
+
+def helper_5628_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5628_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5628_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5628_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
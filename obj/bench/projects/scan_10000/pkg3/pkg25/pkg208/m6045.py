@@ -0,0 +1,24 @@
+"""Module 6045."""
+import pkg3.pkg25.m1275
+from pkg4.pkg40.pkg321 import m1154
+import pkg2.pkg21.m20
+from . import m5211
+import pkg2.pkg18.pkg150.m1817
+from pkg2.pkg21.pkg176 import m1009
+import pkg1.pkg12.pkg99.m1766
+from pkg4.pkg38.pkg311 import m4897
+import pkg1.m0
+
+
+def helper_6045_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6045_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
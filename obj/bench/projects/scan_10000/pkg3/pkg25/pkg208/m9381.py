@@ -0,0 +1,18 @@
+"""Module 9381."""
+import pkg4.pkg40.pkg323.m4492
+from pkg1.pkg16.pkg131 import m2215
+import pkg1.pkg10.m9
+
+
+def helper_9381_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9381_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,23 @@
+"""Module 1693."""
+import pkg2.pkg23.pkg185.m1018
+from pkg1.pkg9.pkg73 import m489
+import pkg2.m1
+from pkg1.pkg10.pkg81 import m1331
+import pkg5.pkg43.pkg350.m766
+from pkg6 import m5
+import pkg1.pkg9.m8
+from . import m442
+
+
+def helper_1693_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1693_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 4195."""
+import pkg1.pkg14.pkg120.m536
+from pkg3.pkg28.pkg230 import m646
+import pkg1.pkg12.pkg102.m101
+from . import m25
+from . import m2527
+
+
+def helper_4195_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4195_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
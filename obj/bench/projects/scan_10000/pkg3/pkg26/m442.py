@@ -0,0 +1,45 @@
+"""Module 442."""
+import pkg3.pkg32.m31
+from pkg2.pkg19 import m18
+import pkg5.pkg46.m45
+from pkg5.pkg42 import m41
+from . import m25
+from pkg6.pkg49.pkg398 import m397
+import pkg3.pkg27.pkg219.m218
+from pkg7 import m6
+import pkg3.m2
+
+
+def helper_442_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_442_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_442_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_442_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_442_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
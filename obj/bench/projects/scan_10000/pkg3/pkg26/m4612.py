@@ -0,0 +1,16 @@
+"""Module 4612."""
+import pkg3.pkg32.pkg261.m1928
+from . import m442
+import pkg3.pkg31.pkg254.m2338
+from pkg1.pkg11.pkg89 import m88
+import pkg1.pkg14.pkg113.m946
+from pkg5.pkg41.pkg329 import m3664
+import pkg1.m0
+from pkg2.pkg21 import m20
+
+
+def helper_4612_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,22 @@
+"""Module 5029."""
+from . import m442
+from pkg3.pkg30.pkg246 import m1496
+import pkg1.pkg10.m3345
+from . import m3361
+import pkg3.pkg30.pkg247.m2331
+from pkg2 import m1
+import pkg5.pkg42.pkg340.m4509
+
+
+def helper_5029_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5029_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
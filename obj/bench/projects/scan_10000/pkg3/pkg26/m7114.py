@@ -0,0 +1,7 @@
+"""Module 7114."""
+import pkg3.m2
+from pkg1.pkg10.pkg81 import m80
+import pkg2.pkg19.m18
+from pkg1.pkg10.pkg86 import m85
+import pkg6.pkg56.m55
+from pkg3.pkg28.pkg226 import m3561
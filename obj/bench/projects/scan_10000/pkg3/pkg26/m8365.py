@@ -0,0 +1,48 @@
+"""Module 8365."""
+import pkg1.pkg10.pkg88.m87
+from pkg6.pkg49.pkg397 import m396
+import pkg1.m0
+from pkg4.pkg40.pkg324 import m1157
+import pkg1.pkg9.pkg78.m8000
+from . import m859
+import pkg3.pkg32.pkg258.m6512
+from pkg3.pkg31.pkg251 import m3586
+import pkg8.pkg65.m2983
+from . import m5446
+import pkg5.pkg41.pkg331.m4500
+from pkg4.pkg37.pkg299 import m298
+
+
+def helper_8365_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8365_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8365_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8365_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_8365_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
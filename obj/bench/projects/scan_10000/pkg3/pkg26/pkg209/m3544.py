@@ -0,0 +1,34 @@
+"""Module 3544."""
+import pkg4.pkg34.pkg277.m2778
+from pkg3.pkg28 import m27
+import pkg3.pkg25.pkg203.m202
+from pkg1.pkg9.pkg77 import m493
+import pkg1.pkg9.pkg73.m489
+from pkg4.pkg40.pkg327 import m1994
+from . import m2293
+from . import m625
+import pkg2.pkg24.pkg198.m1448
+from . import m208
+from . import m1876
+from pkg2.pkg22.pkg177 import m593
+
+
+def helper_3544_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3544_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3544_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
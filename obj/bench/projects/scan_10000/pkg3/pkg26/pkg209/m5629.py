@@ -0,0 +1,38 @@
+"""Module 5629."""
+import pkg4.pkg38.pkg310.m3228
+from . import m1042
+import pkg3.pkg30.pkg245.m2329
+from . import m625
+from . import m3544
+from pkg5.pkg41.pkg329 import m2413
+from . import m208
+from pkg2.pkg21.pkg171 import m1004
+import pkg3.pkg32.m31
+
+
+def helper_5629_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5629_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5629_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5629_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,10 @@
+"""Module 7297."""
+import pkg5.pkg41.pkg331.m747
+from pkg1.pkg12.pkg97 import m4683
+
+
+def helper_7297_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
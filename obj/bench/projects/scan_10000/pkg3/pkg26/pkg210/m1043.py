@@ -0,0 +1,42 @@
+"""Module 1043."""
+import pkg2.pkg22.pkg181.m597
+from pkg4.pkg36 import m35
+import pkg4.pkg37.pkg299.m298
+from pkg1.pkg11.pkg89 import m505
+import pkg6.pkg51.pkg411.m410
+from pkg5.pkg44.pkg353 import m352
+
+
+def helper_1043_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1043_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1043_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1043_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_1043_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
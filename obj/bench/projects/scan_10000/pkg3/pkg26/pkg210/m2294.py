@@ -0,0 +1,32 @@
+"""Module 2294."""
+import pkg2.pkg19.pkg160.m576
+from pkg8.pkg72 import m905
+import pkg5.pkg42.pkg339.m1172
+from pkg4.pkg40 import m456
+import pkg4.pkg38.m2122
+from . import m626
+import pkg2.pkg18.pkg146.m145
+from pkg1 import m0
+import pkg1.m834
+from pkg2.pkg18.pkg146 import m1813
+
+
+def helper_2294_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2294_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2294_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,35 @@
+"""Module 2711."""
+import pkg1.pkg11.pkg93.m926
+from pkg3.pkg29.pkg235 import m651
+import pkg8.pkg69.m2570
+from pkg1.pkg14 import m13
+import pkg3.pkg25.m24
+from pkg3.pkg29.pkg234 import m233
+
+
+def helper_2711_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2711_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2711_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2711_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
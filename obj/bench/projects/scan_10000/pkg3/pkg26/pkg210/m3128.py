@@ -0,0 +1,34 @@
+"""Module 3128."""
+import pkg7.pkg58.m57
+from pkg1.pkg12.pkg104 import m937
+from . import m209
+from pkg5.pkg45.pkg368 import m1201
+import pkg1.pkg11.pkg93.m92
+
+
+def helper_3128_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3128_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3128_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3128_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,13 @@
+"""Module 4379."""
+from . import m209
+from pkg4.pkg39.pkg319 import m318
+import pkg5.pkg48.pkg389.m1222
+from pkg1.pkg10.pkg82 import m81
+import pkg7.pkg59.m58
+
+
+def helper_4379_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
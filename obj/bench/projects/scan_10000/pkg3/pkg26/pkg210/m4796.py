@@ -0,0 +1,33 @@
+"""Module 4796."""
+import pkg6.pkg51.m884
+from pkg5.pkg47.pkg380 import m1630
+import pkg4.pkg35.pkg287.m286
+from pkg1.pkg16.pkg132 import m131
+import pkg3.pkg28.pkg231.m3149
+from pkg2.pkg17.pkg141 import m140
+import pkg3.pkg25.pkg207.m623
+from pkg8.pkg70 import m69
+import pkg2.m835
+from . import m1043
+from . import m2294
+
+
+def helper_4796_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4796_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4796_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 6464."""
+import pkg8.pkg72.m3407
+from pkg5.pkg43.pkg346 import m345
+import pkg5.pkg47.pkg383.m799
+from pkg1.pkg13.pkg109 import m2610
+from . import m2711
+from pkg4.pkg37.pkg299 import m1966
+from . import m2294
+from . import m6047
+import pkg7.pkg60.m893
+from . import m4796
+import pkg4.pkg37.pkg302.m718
+from pkg3.pkg31 import m30
+
+
+def helper_6464_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,55 @@
+"""Module 1878."""
+import pkg4.pkg38.m37
+from . import m210
+import pkg1.pkg13.m12
+from pkg3.pkg31.pkg253 import m1503
+import pkg5.pkg43.pkg352.m768
+from pkg1.pkg16.pkg134 import m1384
+import pkg4.pkg34.m33
+from pkg1.pkg9.pkg79 import m78
+import pkg4.pkg36.pkg292.m1542
+from pkg3.pkg25.pkg206 import m622
+import pkg4.pkg39.pkg320.m1153
+from pkg5.pkg48.pkg387 import m1220
+
+
+def helper_1878_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1878_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1878_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1878_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_1878_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_1878_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
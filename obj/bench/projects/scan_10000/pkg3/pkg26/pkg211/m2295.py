@@ -0,0 +1,17 @@
+"""Module 2295."""
+import pkg1.pkg10.pkg87.m86
+from pkg2.pkg20.pkg163 import m162
+
+
+def helper_2295_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2295_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
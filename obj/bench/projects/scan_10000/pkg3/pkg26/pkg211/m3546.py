@@ -0,0 +1,35 @@
+"""Module 3546."""
+import pkg1.m0
+from pkg2.pkg20.pkg163 import m2664
+import pkg1.pkg15.pkg126.m1793
+from pkg3.pkg26.pkg213 import m212
+from . import m2295
+from pkg5 import m4
+
+
+def helper_3546_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3546_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3546_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3546_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
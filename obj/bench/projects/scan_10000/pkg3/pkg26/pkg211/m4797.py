@@ -0,0 +1,17 @@
+"""Module 4797."""
+import pkg1.pkg15.pkg128.m1378
+from pkg5.pkg41.pkg332 import m748
+import pkg8.m7
+from pkg6.pkg49.pkg397 import m813
+import pkg1.pkg11.pkg92.m1759
+from pkg5.pkg46 import m45
+import pkg2.pkg22.pkg179.m178
+from pkg1.pkg13.pkg109 import m1359
+from . import m1461
+
+
+def helper_4797_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,30 @@
+"""Module 627."""
+import pkg2.pkg24.pkg199.m198
+from . import m210
+import pkg5.m421
+from pkg5.pkg43 import m42
+import pkg1.pkg9.pkg77.m493
+from pkg1 import m0
+import pkg4.pkg34.pkg279.m278
+from pkg1.pkg13 import m12
+
+
+def helper_627_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_627_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_627_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
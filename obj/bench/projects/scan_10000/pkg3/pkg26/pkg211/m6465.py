@@ -0,0 +1,45 @@
+"""Module 6465."""
+from . import m210
+from pkg2 import m1
+import pkg1.pkg13.pkg107.m5527
+from pkg1.pkg15 import m14
+from . import m1044
+from pkg3.pkg31.pkg255 import m4424
+import pkg2.pkg20.pkg167.m1834
+from . import m4797
+from . import m3963
+
+
+def helper_6465_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6465_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6465_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6465_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_6465_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,35 @@
+"""Module 8967."""
+import pkg6.pkg51.pkg415.m3333
+from pkg4.pkg33.pkg270 import m1103
+import pkg2.pkg22.pkg180.m596
+from pkg6.pkg51.pkg414 import m1247
+from . import m1461
+from pkg8 import m7
+
+
+def helper_8967_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8967_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8967_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8967_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,43 @@
+"""Module 9384."""
+from . import m3546
+from pkg5.pkg42.pkg337 import m1170
+import pkg3.pkg29.pkg233.m2734
+from pkg4.pkg35.pkg282 import m5702
+import pkg1.pkg13.pkg106.m9279
+from pkg5.pkg46.pkg371 import m3289
+import pkg3.pkg31.pkg251.m667
+
+
+def helper_9384_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9384_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9384_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9384_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_9384_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,12 @@
+"""Module 1045."""
+import pkg5.pkg41.pkg331.m330
+from pkg6 import m5
+import pkg2.pkg24.pkg200.m616
+from . import m211
+
+
+def helper_1045_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,29 @@
+"""Module 1462."""
+from . import m628
+from pkg2.pkg24.pkg199 import m198
+import pkg2.m1
+from pkg3.pkg28.pkg227 import m643
+import pkg3.pkg27.pkg224.m223
+from pkg3.pkg28.pkg225 import m224
+from . import m1045
+
+
+def helper_1462_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1462_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1462_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
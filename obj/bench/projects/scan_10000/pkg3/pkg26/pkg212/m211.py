@@ -0,0 +1,16 @@
+"""Module 211."""
+import pkg1.pkg12.pkg97.m96
+from pkg1.pkg11 import m10
+import pkg4.m3
+from pkg1.pkg13.pkg105 import m104
+import pkg2.pkg17.pkg143.m142
+from pkg6.pkg53 import m52
+import pkg2.m1
+from pkg1.pkg10.pkg86 import m85
+
+
+def helper_211_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 8551."""
+from . import m1879
+from pkg1.pkg11 import m2095
+import pkg4.pkg35.pkg288.m7376
+from pkg4.pkg36.pkg293 import m6547
+import pkg2.pkg17.pkg137.m136
+from . import m2713
+import pkg1.pkg10.pkg85.m501
+from pkg3 import m2504
+from . import m1462
+from pkg1.pkg13.pkg106 import m105
+
+
+def helper_8551_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
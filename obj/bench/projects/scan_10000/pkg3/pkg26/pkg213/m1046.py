@@ -0,0 +1,27 @@
+"""Module 1046."""
+import pkg3.pkg32.m31
+from pkg2.pkg19 import m18
+from . import m629
+from pkg6.pkg54 import m470
+from . import m212
+from pkg1.pkg14.pkg120 import m953
+import pkg6.pkg50.pkg403.m819
+from pkg6.pkg51.pkg416 import m415
+import pkg6.pkg53.m52
+from pkg4.pkg34.pkg279 import m695
+import pkg1.pkg14.m13
+from pkg2.pkg20 import m19
+
+
+def helper_1046_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1046_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
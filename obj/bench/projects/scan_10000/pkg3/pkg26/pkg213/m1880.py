@@ -0,0 +1,46 @@
+"""Module 1880."""
+from . import m1046
+from pkg8.pkg68 import m67
+import pkg3.pkg26.pkg214.m213
+from pkg3.pkg30.pkg242 import m658
+import pkg5.pkg46.m1713
+from pkg4.pkg37 import m1704
+import pkg1.m0
+from pkg5.pkg47.pkg384 import m383
+import pkg5.pkg45.pkg365.m364
+from pkg3.pkg26.pkg216 import m215
+
+
+def helper_1880_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1880_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1880_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1880_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_1880_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,15 @@
+"""Module 3131."""
+from . import m629
+from pkg2.pkg18 import m1268
+import pkg1.pkg11.pkg95.m1762
+from pkg6.pkg53 import m52
+from . import m1880
+from pkg1.pkg13.pkg111 import m1778
+import pkg2.pkg19.pkg154.m987
+
+
+def helper_3131_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 8969."""
+import pkg4.pkg39.pkg315.m6152
+from pkg4.pkg35.pkg284 import m283
+import pkg5.pkg45.pkg367.m783
+from pkg2.pkg18 import m6272
+import pkg4.pkg40.pkg321.m2405
+from pkg1.pkg9.pkg75 import m908
+import pkg6.pkg51.pkg410.m6664
+from pkg1.pkg12.pkg104 import m103
+import pkg4.pkg34.pkg280.m6117
+from pkg1.pkg9.pkg75 import m5078
@@ -0,0 +1,37 @@
+"""Module 1047."""
+import pkg2.pkg17.pkg143.m142
+from pkg2 import m835
+import pkg3.pkg32.pkg262.m261
+from pkg1 import m0
+from . import m213
+from pkg3.pkg32.pkg259 import m258
+import pkg1.pkg11.pkg95.m94
+from pkg4.pkg33 import m32
+
+
+def helper_1047_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1047_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1047_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1047_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
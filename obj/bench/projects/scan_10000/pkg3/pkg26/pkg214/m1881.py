@@ -0,0 +1,21 @@
+"""Module 1881."""
+import pkg4.m3
+from pkg1 import m0
+import pkg2.pkg22.pkg177.m1844
+from pkg5.pkg48.pkg387 import m386
+from . import m1047
+from pkg1.pkg12.pkg98 import m514
+
+
+def helper_1881_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1881_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 2298."""
+import pkg1.m0
+from . import m1881
+from . import m213
+from pkg2.pkg19.pkg154 import m153
+import pkg3.pkg27.m26
+from pkg3.pkg28.pkg228 import m227
+import pkg2.pkg18.pkg145.m978
+from pkg2 import m1
+import pkg1.pkg14.pkg115.m948
+from pkg4.pkg40.pkg325 import m1575
+from . import m1047
+
+
+def helper_2298_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 3549."""
+import pkg1.pkg15.pkg126.m542
+from pkg4.pkg39.pkg317 import m733
+import pkg1.pkg16.pkg131.m2632
+from pkg1.pkg13.pkg112 import m3030
+
+
+def helper_3549_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3549_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3549_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
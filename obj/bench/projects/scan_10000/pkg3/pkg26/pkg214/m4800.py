@@ -0,0 +1,48 @@
+"""Module 4800."""
+import pkg3.pkg25.pkg204.m4373
+from pkg4.pkg34.pkg278 import m1111
+import pkg8.pkg67.m66
+from pkg1.pkg12.pkg97 import m2181
+import pkg1.pkg10.pkg82.m81
+from pkg2.pkg21.pkg175 import m1425
+import pkg6.pkg51.pkg411.m2078
+from pkg5 import m4
+import pkg2.pkg17.pkg142.m558
+from pkg6.pkg49 import m48
+import pkg3.pkg31.pkg254.m2755
+from pkg2.pkg19.pkg158 import m157
+
+
+def helper_4800_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4800_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4800_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4800_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_4800_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,44 @@
+"""Module 5634."""
+from . import m213
+from pkg3.pkg26.pkg209 import m625
+import pkg5.pkg45.pkg365.m2866
+from . import m1047
+import pkg5.pkg41.pkg332.m4918
+from pkg5.pkg48.pkg386 import m1219
+import pkg2.pkg21.pkg175.m591
+from . import m3549
+
+
+def helper_5634_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5634_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5634_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5634_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_5634_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,46 @@
+"""Module 630."""
+import pkg4.pkg40.m39
+from . import m213
+import pkg1.pkg11.m10
+from pkg1.pkg12 import m11
+import pkg1.pkg10.pkg86.m85
+from pkg1.pkg11.pkg94 import m93
+import pkg3.pkg27.m26
+from pkg1 import m0
+import pkg1.pkg14.pkg120.m119
+from pkg3.pkg32.pkg257 import m256
+
+
+def helper_630_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_630_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_630_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_630_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_630_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
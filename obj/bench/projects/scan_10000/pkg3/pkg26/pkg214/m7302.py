@@ -0,0 +1,47 @@
+"""Module 7302."""
+import pkg3.pkg31.m30
+from . import m1464
+import pkg4.m3
+from pkg2.pkg21.pkg172 import m1422
+import pkg1.pkg12.pkg102.m5939
+from pkg1.pkg12.pkg101 import m517
+import pkg3.pkg28.m27
+from pkg1.pkg16 import m15
+import pkg3.pkg30.pkg247.m246
+from . import m1881
+import pkg3.pkg26.pkg216.m6053
+
+
+def helper_7302_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7302_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7302_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7302_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_7302_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,28 @@
+"""Module 7719."""
+import pkg1.pkg15.pkg125.m3460
+from . import m1881
+import pkg3.m2
+from pkg5.pkg43.pkg347 import m346
+import pkg2.pkg18.pkg151.m3069
+from pkg2.pkg23.pkg189 import m188
+
+
+def helper_7719_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7719_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7719_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
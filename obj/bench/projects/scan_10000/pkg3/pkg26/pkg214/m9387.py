@@ -0,0 +1,52 @@
+"""Module 9387."""
+import pkg3.pkg25.pkg202.m3120
+from pkg1 import m0
+import pkg1.pkg15.pkg121.m120
+from pkg7.pkg62 import m61
+import pkg2.pkg22.pkg181.m6852
+from pkg5.pkg43.pkg346 import m4098
+import pkg1.pkg12.m11
+from pkg5.pkg46.pkg371 import m787
+import pkg5.pkg47.m46
+
+
+def helper_9387_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9387_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9387_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9387_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_9387_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_9387_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,14 @@
+"""Module 3550."""
+import pkg5.pkg43.m42
+from pkg5 import m4
+import pkg1.m1668
+from . import m3133
+import pkg5.pkg43.m2961
+from pkg6.pkg53 import m52
+
+
+def helper_3550_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,36 @@
+"""Module 4384."""
+import pkg1.pkg10.pkg82.m81
+from pkg5 import m4
+import pkg3.pkg25.pkg205.m1455
+from pkg3.pkg25.pkg206 import m1456
+import pkg7.pkg63.m62
+from pkg2.pkg23.pkg186 import m3938
+import pkg5.pkg47.pkg378.m1211
+
+
+def helper_4384_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4384_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4384_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4384_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,61 @@
+"""Module 4801."""
+import pkg5.pkg45.pkg367.m366
+from pkg1.pkg16.pkg134 import m133
+import pkg6.pkg51.m2135
+from pkg2.pkg19.pkg153 import m152
+import pkg5.pkg42.pkg342.m3677
+from pkg3.pkg30.pkg242 import m3994
+from . import m2716
+from pkg2.pkg23 import m1690
+import pkg1.m0
+from . import m1048
+import pkg2.pkg24.pkg199.m3534
+
+
+def helper_4801_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4801_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4801_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4801_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_4801_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_4801_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4801_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
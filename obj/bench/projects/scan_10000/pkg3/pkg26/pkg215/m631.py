@@ -0,0 +1,21 @@
+"""Module 631."""
+import pkg5.pkg43.pkg352.m351
+from pkg2 import m1
+from . import m214
+from pkg1 import m0
+import pkg2.pkg17.pkg143.m142
+from pkg8.pkg65 import m481
+
+
+def helper_631_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_631_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
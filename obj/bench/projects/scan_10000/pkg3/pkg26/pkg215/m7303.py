@@ -0,0 +1,19 @@
+"""Module 7303."""
+import pkg5.m5425
+from pkg5.pkg44 import m5464
+import pkg4.pkg39.m38
+from pkg3.pkg29 import m2530
+
+
+def helper_7303_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7303_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,68 @@
+"""Module 9388."""
+import pkg2.pkg19.pkg153.m152
+from pkg2.pkg19.pkg160 import m993
+import pkg3.pkg25.pkg201.m200
+from pkg5.pkg45.pkg366 import m7037
+import pkg2.pkg21.pkg169.m1419
+from pkg1.pkg10.pkg88 import m5925
+import pkg4.pkg40.pkg328.m1578
+from pkg1.pkg10.pkg85 import m4671
+import pkg4.pkg40.pkg324.m740
+from pkg4.pkg38 import m2122
+import pkg1.m0
+
+
+def helper_9388_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9388_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9388_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9388_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_9388_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_9388_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9388_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9388_42(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,9 @@
+"""Module 2717."""
+import pkg2.pkg21.pkg171.m1004
+
+
+def helper_2717_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,22 @@
+"""Module 4385."""
+from . import m3968
+from . import m1883
+import pkg2.m1
+from pkg2.pkg22.pkg183 import m1016
+import pkg6.pkg49.pkg395.m2062
+from pkg7 import m6
+import pkg4.pkg34.pkg275.m691
+
+
+def helper_4385_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4385_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,46 @@
+"""Module 6053."""
+import pkg2.pkg20.pkg167.m2668
+from pkg7.pkg62 import m478
+import pkg1.pkg16.pkg131.m964
+from pkg3 import m2504
+import pkg4.pkg39.m4625
+from pkg3 import m1670
+import pkg4.pkg33.pkg269.m268
+from pkg1.pkg11.pkg94 import m93
+import pkg6.pkg52.m468
+from pkg2.pkg22.pkg184 import m600
+
+
+def helper_6053_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6053_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6053_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6053_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_6053_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,10 @@
+"""Module 7304."""
+import pkg5.pkg46.pkg373.m1623
+from pkg4.pkg34 import m867
+
+
+def helper_7304_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
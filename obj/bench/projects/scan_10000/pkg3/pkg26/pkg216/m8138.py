@@ -0,0 +1,48 @@
+"""Module 8138."""
+import pkg1.pkg9.pkg73.m1740
+from pkg4.pkg38.pkg312 import m311
+from . import m4385
+from pkg6.pkg49.pkg398 import m397
+from . import m6470
+from pkg1.pkg10 import m1260
+import pkg4.pkg38.pkg311.m5314
+from pkg3.pkg29.pkg240 import m656
+import pkg3.pkg32.m2950
+from . import m632
+import pkg4.pkg34.m33
+from pkg1.pkg12.pkg103 import m3855
+
+
+def helper_8138_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8138_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8138_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8138_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_8138_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
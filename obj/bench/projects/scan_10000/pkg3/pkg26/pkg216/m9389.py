@@ -0,0 +1,35 @@
+"""Module 9389."""
+from . import m5636
+from pkg1.pkg9.pkg80 import m79
+import pkg5.pkg42.pkg341.m2842
+from pkg5.pkg44.pkg354 import m770
+import pkg6.pkg55.m2973
+from . import m3134
+
+
+def helper_9389_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9389_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9389_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9389_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,12 @@
+"""Module 5864."""
+from . import m443
+from pkg7.pkg61 import m60
+import pkg4.pkg40.pkg321.m1154
+from pkg4.pkg39.pkg319 import m318
+
+
+def helper_5864_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,33 @@
+"""Module 860."""
+import pkg7.pkg64.m63
+from pkg4.pkg38 import m37
+import pkg1.pkg16.pkg134.m133
+from pkg5.pkg45 import m44
+import pkg2.pkg19.m18
+from pkg3.pkg28 import m444
+import pkg5.pkg47.pkg384.m383
+from pkg4 import m3
+import pkg3.pkg30.pkg243.m242
+from pkg2 import m1
+import pkg1.m0
+
+
+def helper_860_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_860_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_860_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
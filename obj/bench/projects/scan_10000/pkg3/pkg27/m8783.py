@@ -0,0 +1,34 @@
+"""Module 8783."""
+import pkg3.pkg27.pkg219.m1469
+from pkg6.pkg49.pkg394 import m393
+import pkg1.m0
+from pkg3.pkg32 import m4201
+import pkg2.pkg24.pkg200.m5203
+
+
+def helper_8783_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8783_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8783_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8783_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,37 @@
+"""Module 9617."""
+import pkg5.pkg43.pkg346.m1596
+from pkg3.pkg25.pkg202 import m618
+import pkg1.pkg11.pkg93.m926
+from pkg1.pkg15.pkg121 import m2622
+from . import m5864
+from . import m7115
+from . import m9200
+from pkg1.pkg9.pkg79 import m4248
+
+
+def helper_9617_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9617_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9617_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9617_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
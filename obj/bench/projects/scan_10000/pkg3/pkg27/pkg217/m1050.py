@@ -0,0 +1,37 @@
+"""Module 1050."""
+import pkg2.pkg18.pkg148.m147
+from pkg2.pkg23 import m22
+import pkg2.pkg20.pkg165.m164
+from pkg1.pkg14.pkg118 import m117
+import pkg1.pkg10.m9
+from pkg4.pkg33 import m32
+from . import m633
+from pkg1.pkg10.pkg85 import m84
+
+
+def helper_1050_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1050_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1050_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1050_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
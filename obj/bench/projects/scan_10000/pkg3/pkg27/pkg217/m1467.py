@@ -0,0 +1,31 @@
+"""Module 1467."""
+import pkg1.pkg15.pkg127.m543
+from pkg4 import m3
+import pkg3.pkg32.m31
+from . import m216
+import pkg3.pkg30.pkg243.m242
+from pkg4.pkg34.pkg277 import m693
+import pkg5.pkg45.pkg367.m366
+from pkg3.pkg28.pkg230 import m1063
+import pkg3.pkg26.m25
+
+
+def helper_1467_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1467_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1467_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,48 @@
+"""Module 4386."""
+import pkg3.pkg28.pkg228.m3563
+from pkg5.pkg45.pkg361 import m2028
+import pkg1.pkg13.pkg106.m3858
+from pkg2.pkg17.pkg137 import m1387
+import pkg7.m6
+from pkg8 import m7
+from . import m3135
+from pkg4.pkg38.pkg305 import m721
+import pkg1.pkg13.pkg109.m3444
+from pkg7.pkg62 import m478
+import pkg5.pkg43.pkg351.m767
+from pkg2 import m1
+
+
+def helper_4386_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4386_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4386_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4386_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_4386_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,30 @@
+"""Module 6888."""
+import pkg3.pkg31.m30
+from pkg2.pkg20.pkg168 import m167
+from . import m3135
+from pkg2.pkg20.pkg163 import m2664
+from . import m1467
+from pkg8 import m2509
+import pkg3.pkg27.pkg221.m1888
+from pkg1.pkg14.pkg116 import m115
+
+
+def helper_6888_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6888_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6888_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
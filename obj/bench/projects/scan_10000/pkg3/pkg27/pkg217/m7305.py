@@ -0,0 +1,14 @@
+"""Module 7305."""
+from . import m2301
+from . import m3969
+import pkg5.pkg45.pkg361.m2445
+from pkg4.pkg35.pkg286 import m4872
+import pkg2.pkg23.pkg192.m1859
+from pkg1.pkg11.pkg91 import m90
+
+
+def helper_7305_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
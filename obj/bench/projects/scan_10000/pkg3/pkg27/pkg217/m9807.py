@@ -0,0 +1,18 @@
+"""Module 9807."""
+import pkg2.pkg23.pkg187.m6024
+from pkg5.pkg41.pkg336 import m6173
+import pkg2.pkg24.pkg196.m1029
+from pkg3.pkg27.pkg220 import m2304
+import pkg8.pkg69.m902
+from pkg2.pkg18.pkg149 import m2233
+import pkg1.pkg16.pkg133.m4302
+from pkg3 import m2504
+from . import m633
+from . import m2718
+
+
+def helper_9807_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 1051."""
+import pkg3.pkg29.pkg234.m650
+from pkg4.pkg34.pkg278 import m277
+
+
+def helper_1051_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1051_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,16 @@
+"""Module 2302."""
+import pkg2.pkg17.pkg137.m1387
+
+
+def helper_2302_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2302_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
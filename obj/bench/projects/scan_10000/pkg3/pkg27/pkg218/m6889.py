@@ -0,0 +1,45 @@
+"""Module 6889."""
+import pkg1.pkg11.pkg96.m95
+from pkg2.pkg21.pkg173 import m4342
+import pkg3.pkg26.m25
+from pkg6.pkg50.pkg403 import m4155
+import pkg4.pkg35.pkg284.m6538
+from pkg4.pkg40.pkg322 import m738
+import pkg7.pkg60.m476
+from . import m2302
+import pkg5.pkg48.pkg385.m2469
+
+
+def helper_6889_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6889_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6889_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6889_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_6889_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
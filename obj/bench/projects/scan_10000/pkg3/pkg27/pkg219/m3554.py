@@ -0,0 +1,27 @@
+"""Module 3554."""
+from . import m3137
+from pkg3.pkg25.pkg203 import m1036
+import pkg1.pkg11.m10
+from . import m2303
+import pkg3.pkg27.pkg218.m2719
+from pkg5.pkg43 import m3378
+from . import m2720
+from pkg2.pkg20.pkg165 import m164
+import pkg1.pkg16.m849
+from pkg1.pkg13.pkg108 import m3443
+from . import m1052
+from pkg5.pkg46.pkg371 import m370
+
+
+def helper_3554_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3554_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
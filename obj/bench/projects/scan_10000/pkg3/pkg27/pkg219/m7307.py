@@ -0,0 +1,54 @@
+"""Module 7307."""
+from . import m6056
+from pkg4.pkg39.pkg314 import m4900
+import pkg6.pkg50.pkg401.m400
+from pkg4.pkg35.pkg284 import m2368
+from . import m6473
+from pkg1 import m0
+import pkg5.pkg43.pkg349.m7020
+from pkg4.pkg35.pkg288 import m4874
+import pkg2.pkg18.m17
+from pkg4.pkg38.pkg307 import m2808
+import pkg5.pkg41.pkg335.m3670
+
+
+def helper_7307_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7307_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7307_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7307_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_7307_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_7307_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,28 @@
+"""Module 1053."""
+import pkg4.pkg33.m449
+from pkg6.pkg50.pkg408 import m407
+import pkg8.m7
+from pkg1 import m0
+import pkg8.pkg68.m484
+from pkg2.pkg18 import m17
+
+
+def helper_1053_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1053_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1053_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 2304."""
+import pkg1.pkg11.pkg92.m91
+from . import m1887
+import pkg3.pkg25.pkg204.m1871
+from . import m1053
+import pkg1.m0
+from pkg7.pkg59 import m475
+import pkg6.pkg50.m49
+from pkg1.pkg12.pkg104 import m2188
+import pkg5.pkg47.pkg378.m794
+from pkg5.pkg42.pkg341 import m1174
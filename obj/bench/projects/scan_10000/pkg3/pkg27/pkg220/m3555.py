@@ -0,0 +1,35 @@
+"""Module 3555."""
+import pkg2.pkg22.pkg184.m183
+from pkg1.pkg11.pkg89 import m2173
+import pkg5.pkg47.pkg384.m800
+from pkg2.pkg24 import m1691
+import pkg4.pkg36.pkg293.m709
+from pkg6.pkg49 import m48
+
+
+def helper_3555_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3555_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3555_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3555_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
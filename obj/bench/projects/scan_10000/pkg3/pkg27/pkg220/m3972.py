@@ -0,0 +1,27 @@
+"""Module 3972."""
+import pkg1.pkg14.pkg117.m3035
+from pkg5.pkg42.pkg344 import m1177
+import pkg3.pkg32.pkg263.m262
+from pkg1.pkg10.pkg86 import m85
+import pkg4.pkg34.pkg276.m2777
+from . import m1053
+import pkg4.pkg37.pkg298.m297
+from pkg4.pkg33.pkg269 import m268
+import pkg2.pkg23.m2107
+from pkg6.pkg50.pkg403 import m402
+import pkg1.m0
+from pkg1.pkg10.pkg83 import m82
+
+
+def helper_3972_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3972_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
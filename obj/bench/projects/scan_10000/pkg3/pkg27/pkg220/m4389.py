@@ -0,0 +1,48 @@
+"""Module 4389."""
+import pkg2.pkg21.pkg174.m1424
+from . import m2721
+from . import m2304
+from pkg3.pkg32.pkg257 import m1507
+import pkg3.pkg30.m29
+from . import m219
+import pkg8.pkg71.m904
+from pkg4.pkg39 import m38
+import pkg2.pkg21.pkg174.m1007
+from pkg1.pkg10.pkg85 import m2169
+import pkg1.pkg9.pkg75.m4244
+from pkg2.pkg23.pkg192 import m191
+
+
+def helper_4389_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4389_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4389_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4389_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_4389_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
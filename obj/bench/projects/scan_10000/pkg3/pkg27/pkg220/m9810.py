@@ -0,0 +1,40 @@
+"""Module 9810."""
+import pkg2.pkg22.pkg184.m8106
+from pkg1.pkg11.pkg95 import m1345
+import pkg2.pkg20.pkg162.m4331
+from pkg2.pkg20.pkg164 import m2665
+from . import m8559
+from pkg4.pkg36.pkg294 import m1127
+import pkg2.pkg20.pkg165.m164
+from . import m636
+import pkg2.m1
+from pkg5.pkg47.pkg383 import m2050
+import pkg2.pkg19.pkg154.m8076
+
+
+def helper_9810_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9810_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9810_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9810_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,45 @@
+"""Module 2305."""
+from . import m1888
+from pkg3.pkg29.pkg235 import m1485
+import pkg6.pkg49.m48
+from pkg7.pkg59 import m58
+import pkg4.pkg34.pkg280.m696
+from pkg5 import m4
+from . import m637
+from . import m220
+import pkg1.m0
+
+
+def helper_2305_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2305_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2305_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2305_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_2305_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,21 @@
+"""Module 3556."""
+from . import m2305
+from pkg1.pkg14.pkg113 import m946
+import pkg6.pkg49.pkg397.m2898
+from . import m637
+import pkg6.pkg56.m55
+from pkg4.pkg38.pkg309 import m3227
+
+
+def helper_3556_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3556_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 5224."""
+import pkg3.pkg32.pkg259.m1092
+from pkg3.pkg25.pkg202 import m201
+import pkg4.pkg34.pkg280.m2364
+from . import m2305
+import pkg3.pkg27.pkg219.m218
+
+
+def helper_5224_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5224_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 8143."""
+from . import m3139
+from . import m4807
+import pkg1.pkg11.m10
+from pkg5.pkg41.pkg333 import m6170
+from . import m2305
+
+
+def helper_8143_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8143_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
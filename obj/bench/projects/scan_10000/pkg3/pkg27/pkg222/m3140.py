@@ -0,0 +1,41 @@
+"""Module 3140."""
+import pkg3.pkg32.m31
+from pkg1.pkg11.pkg95 import m511
+from . import m1889
+from pkg2.pkg19.pkg159 import m1826
+import pkg4.pkg40.pkg328.m744
+from pkg2.pkg24.pkg196 import m195
+import pkg1.pkg12.pkg100.m3018
+from pkg4.pkg35.pkg281 import m697
+import pkg5.pkg48.pkg386.m1219
+from . import m638
+import pkg3.pkg26.pkg212.m1045
+from pkg6 import m2090
+
+
+def helper_3140_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3140_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3140_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3140_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
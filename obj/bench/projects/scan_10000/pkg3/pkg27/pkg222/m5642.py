@@ -0,0 +1,13 @@
+"""Module 5642."""
+import pkg2.pkg17.m4603
+from . import m221
+import pkg1.pkg16.m4185
+from pkg2.pkg23.pkg191 import m2692
+from . import m638
+
+
+def helper_5642_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
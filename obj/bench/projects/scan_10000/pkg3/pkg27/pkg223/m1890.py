@@ -0,0 +1,23 @@
+"""Module 1890."""
+from . import m1473
+from pkg5.pkg46.pkg374 import m373
+import pkg6.pkg50.pkg408.m407
+from . import m1056
+from . import m222
+from pkg3.pkg29.pkg234 import m1067
+import pkg6.pkg51.pkg412.m828
+from pkg3.pkg29.pkg237 import m236
+
+
+def helper_1890_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1890_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
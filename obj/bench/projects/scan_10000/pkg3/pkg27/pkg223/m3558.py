@@ -0,0 +1,35 @@
+"""Module 3558."""
+import pkg5.pkg46.m45
+from pkg3.pkg28.pkg231 import m647
+import pkg2.pkg17.pkg144.m143
+from pkg3.pkg25 import m24
+import pkg4.pkg39.pkg320.m319
+from pkg1.pkg11.pkg91 import m90
+
+
+def helper_3558_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3558_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3558_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3558_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
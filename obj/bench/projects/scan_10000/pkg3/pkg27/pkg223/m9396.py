@@ -0,0 +1,17 @@
+"""Module 9396."""
+import pkg4.pkg38.pkg311.m1978
+from pkg4.pkg36.pkg289 import m5709
+
+
+def helper_9396_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9396_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
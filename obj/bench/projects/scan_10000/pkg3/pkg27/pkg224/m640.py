@@ -0,0 +1,19 @@
+"""Module 640."""
+import pkg5.pkg48.pkg392.m391
+from pkg2.pkg24.pkg200 import m199
+import pkg4.pkg34.pkg278.m277
+from pkg3.pkg26.pkg209 import m625
+
+
+def helper_640_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_640_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
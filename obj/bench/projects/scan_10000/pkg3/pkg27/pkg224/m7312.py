@@ -0,0 +1,19 @@
+"""Module 7312."""
+from . import m4393
+from pkg4.pkg36.pkg296 import m1129
+import pkg5.pkg42.pkg343.m4929
+from pkg3.pkg30.pkg245 import m244
+import pkg1.m0
+from pkg6.pkg51.pkg409 import m1242
+import pkg3.pkg30.pkg248.m4417
+from . import m5644
+import pkg1.pkg14.pkg116.m5536
+from pkg1.pkg10.pkg87 import m3422
+import pkg6.pkg49.pkg400.m6654
+
+
+def helper_7312_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,55 @@
+"""Module 8980."""
+import pkg1.pkg16.pkg129.m3464
+from . import m5227
+from . import m3976
+from pkg2.pkg23.pkg185 import m184
+import pkg8.pkg72.m3407
+from pkg1.pkg10.pkg85 import m1752
+import pkg4.pkg34.m33
+from . import m6061
+from . import m1057
+from pkg4.pkg38.pkg311 import m6565
+from . import m3559
+from pkg4.pkg34.pkg278 import m694
+
+
+def helper_8980_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8980_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8980_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8980_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_8980_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_8980_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,35 @@
+"""Module 1278."""
+import pkg3.pkg25.pkg206.m205
+from pkg1.pkg15.pkg125 import m124
+import pkg2.pkg23.m22
+from pkg1.pkg15.pkg121 import m120
+import pkg6.m5
+from . import m861
+
+
+def helper_1278_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1278_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1278_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1278_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,30 @@
+"""Module 4614."""
+import pkg2.pkg19.pkg154.m153
+from pkg5.pkg46.pkg372 import m1622
+import pkg1.pkg10.pkg88.m87
+from pkg2.pkg20 import m4606
+from . import m1278
+from pkg8.pkg72 import m71
+import pkg1.m0
+from . import m3780
+
+
+def helper_4614_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4614_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4614_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
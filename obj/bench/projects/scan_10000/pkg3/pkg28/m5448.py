@@ -0,0 +1,19 @@
+"""Module 5448."""
+from . import m1278
+from pkg6.pkg50.pkg404 import m4990
+import pkg2.pkg17.pkg140.m556
+from pkg5.pkg42.pkg340 import m4926
+
+
+def helper_5448_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5448_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
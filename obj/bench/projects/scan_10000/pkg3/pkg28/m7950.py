@@ -0,0 +1,19 @@
+"""Module 7950."""
+import pkg6.pkg50.pkg406.m405
+from . import m444
+from . import m3780
+from pkg1.pkg16.pkg134 import m4720
+import pkg5.m4
+from pkg4.pkg33.pkg269 import m268
+import pkg8.m841
+from pkg1.pkg15.pkg124 import m123
+import pkg2.pkg17.m7105
+from pkg2.pkg19.pkg159 import m3911
+import pkg4.pkg38.m1705
+
+
+def helper_7950_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
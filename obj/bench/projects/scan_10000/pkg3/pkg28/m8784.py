@@ -0,0 +1,10 @@
+"""Module 8784."""
+from . import m2529
+from pkg1.pkg11 import m6265
+
+
+def helper_8784_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
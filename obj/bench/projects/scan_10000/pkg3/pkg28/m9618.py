@@ -0,0 +1,11 @@
+"""Module 9618."""
+import pkg1.pkg11.pkg93.m926
+from pkg2.pkg24.pkg199 import m1449
+import pkg2.pkg24.pkg200.m616
+
+
+def helper_9618_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,15 @@
+"""Module 1892."""
+from . import m1058
+from pkg1.pkg9.pkg76 import m75
+from . import m224
+from pkg1.pkg12 import m1262
+from . import m1475
+from pkg7.pkg58 import m1725
+import pkg6.pkg56.m1306
+
+
+def helper_1892_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,8 @@
+"""Module 3560."""
+import pkg3.pkg31.pkg254.m1087
+from pkg4.pkg35 import m34
+import pkg2.pkg23.pkg191.m1441
+from pkg5.pkg47.pkg377 import m376
+import pkg3.pkg28.pkg229.m228
+from pkg4.pkg39.pkg314 import m313
+import pkg3.pkg28.m1278
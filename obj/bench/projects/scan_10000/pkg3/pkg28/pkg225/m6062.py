@@ -0,0 +1,40 @@
+"""Module 6062."""
+import pkg1.pkg16.m15
+from . import m641
+import pkg3.pkg28.pkg229.m2730
+from pkg4.pkg34.pkg276 import m2360
+import pkg1.pkg14.pkg115.m114
+from pkg2.pkg22.pkg180 import m3932
+import pkg3.pkg27.pkg224.m1891
+from pkg1.pkg16.pkg135 import m3053
+import pkg3.pkg27.pkg219.m1886
+from pkg3.pkg30.pkg245 import m244
+import pkg1.pkg13.pkg111.m110
+
+
+def helper_6062_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6062_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6062_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6062_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
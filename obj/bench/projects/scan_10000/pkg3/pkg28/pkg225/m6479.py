@@ -0,0 +1,40 @@
+"""Module 6479."""
+import pkg1.pkg14.m430
+from pkg1.pkg9.pkg80 import m79
+import pkg3.pkg30.pkg247.m246
+from pkg2.pkg17.pkg142 import m141
+import pkg6.pkg49.pkg400.m1233
+from pkg3.pkg32 import m31
+import pkg2.m1
+from pkg3.pkg25.pkg205 import m5208
+import pkg4.pkg39.pkg314.m2398
+from pkg5.pkg46.pkg369 import m785
+import pkg3.pkg29.m28
+
+
+def helper_6479_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6479_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6479_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6479_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
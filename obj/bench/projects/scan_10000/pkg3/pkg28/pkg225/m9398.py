@@ -0,0 +1,26 @@
+"""Module 9398."""
+import pkg1.pkg14.pkg114.m3866
+from . import m6062
+import pkg4.pkg36.pkg296.m6133
+from pkg2.pkg24.pkg193 import m3528
+import pkg1.m0
+from pkg6.pkg51.pkg414 import m3749
+import pkg3.pkg31.m4617
+from pkg5.pkg42 import m458
+import pkg2.pkg22.m21
+from pkg4.pkg34.pkg275 import m1525
+import pkg6.pkg51.pkg413.m1246
+
+
+def helper_9398_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9398_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,53 @@
+"""Module 1059."""
+import pkg1.pkg10.pkg81.m80
+from pkg4.pkg38 import m37
+import pkg1.pkg15.m14
+from pkg1.pkg15.pkg121 import m120
+import pkg5.pkg42.pkg337.m336
+from pkg1.pkg10 import m9
+from . import m642
+from pkg7.pkg61 import m60
+import pkg3.pkg32.pkg260.m259
+from pkg1 import m0
+
+
+def helper_1059_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1059_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1059_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1059_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_1059_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_1059_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
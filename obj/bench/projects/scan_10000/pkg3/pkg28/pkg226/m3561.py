@@ -0,0 +1,32 @@
+"""Module 3561."""
+import pkg3.m2
+from pkg5.pkg42.pkg343 import m342
+import pkg2.pkg19.pkg160.m159
+from pkg2.pkg22 import m21
+from . import m1476
+from pkg2.pkg21.pkg172 import m171
+import pkg3.pkg28.pkg230.m229
+from pkg3.pkg27.pkg223 import m639
+import pkg4.pkg33.pkg266.m1099
+from pkg2.pkg22.pkg184 import m2268
+
+
+def helper_3561_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3561_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3561_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,13 @@
+"""Module 7314."""
+import pkg1.pkg15.m2516
+from pkg2.pkg24.pkg197 import m3949
+import pkg3.pkg25.m24
+from pkg1.pkg16.pkg129 import m128
+import pkg1.pkg11.pkg90.m89
+
+
+def helper_7314_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
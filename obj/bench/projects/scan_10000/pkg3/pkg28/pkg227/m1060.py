@@ -0,0 +1,30 @@
+"""Module 1060."""
+import pkg1.pkg9.m8
+from pkg1.pkg15.pkg123 import m122
+import pkg3.pkg25.m24
+from pkg3.pkg25.pkg208 import m207
+from . import m226
+from pkg3.pkg31.pkg255 import m254
+import pkg1.pkg10.m9
+from pkg1 import m0
+
+
+def helper_1060_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1060_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1060_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
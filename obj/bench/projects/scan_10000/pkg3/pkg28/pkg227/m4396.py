@@ -0,0 +1,61 @@
+"""Module 4396."""
+from . import m643
+from pkg2.pkg21.pkg170 import m1003
+import pkg3.pkg28.pkg226.m225
+from pkg6.pkg51.pkg412 import m2913
+import pkg1.pkg15.pkg126.m125
+from pkg2.pkg21 import m20
+import pkg4.pkg39.pkg314.m4066
+from pkg3.pkg29.pkg233 import m232
+import pkg1.pkg14.pkg118.m117
+from pkg2.pkg21.pkg176 import m3511
+import pkg2.pkg19.pkg153.m1403
+
+
+def helper_4396_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4396_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4396_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4396_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_4396_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_4396_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4396_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 3563."""
+from . import m1895
+from . import m2312
+import pkg1.pkg13.m12
+from pkg5.pkg42 import m1292
+import pkg5.pkg43.m42
+from pkg4.pkg39.pkg314 import m313
+import pkg6.m5
+from . import m2729
+import pkg6.pkg51.pkg414.m1664
+from pkg3.pkg25 import m24
+import pkg1.pkg9.pkg75.m2993
+from pkg3.pkg26.pkg209 import m1042
+
+
+def helper_3563_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3563_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,32 @@
+"""Module 8150."""
+from . import m5231
+from . import m227
+import pkg4.pkg40.m456
+from pkg2.pkg21.pkg171 import m587
+from . import m2312
+from pkg5.pkg44.pkg360 import m1193
+from . import m7316
+from pkg1.pkg10 import m9
+import pkg1.pkg15.m14
+from pkg4 import m3
+
+
+def helper_8150_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8150_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8150_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,36 @@
+"""Module 2730."""
+import pkg1.pkg12.pkg103.m102
+from pkg3.pkg25 import m24
+from . import m1479
+from pkg1.pkg11 import m10
+import pkg4.pkg40.pkg327.m743
+from pkg2.pkg22.pkg180 import m1013
+from . import m1062
+
+
+def helper_2730_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2730_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2730_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2730_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
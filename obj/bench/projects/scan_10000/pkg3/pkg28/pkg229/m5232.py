@@ -0,0 +1,20 @@
+"""Module 5232."""
+import pkg1.pkg13.pkg105.m1355
+from pkg2.pkg17 import m16
+import pkg1.m0
+from pkg1.pkg13.pkg105 import m104
+import pkg3.pkg28.pkg225.m224
+from pkg1.pkg14.pkg117 import m1784
+import pkg3.pkg31.pkg253.m252
+from pkg2.pkg19 import m852
+import pkg6.pkg49.pkg395.m394
+from . import m4815
+import pkg1.pkg15.pkg126.m3044
+from pkg5.pkg46.pkg374 import m2041
+
+
+def helper_5232_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,14 @@
+"""Module 9402."""
+import pkg1.pkg13.pkg105.m3440
+from pkg7.pkg59 import m58
+import pkg6.pkg53.m52
+from . import m6066
+import pkg1.pkg13.pkg111.m8867
+from pkg3.pkg25.pkg206 import m5626
+
+
+def helper_9402_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,13 @@
+"""Module 2731."""
+from . import m2314
+from pkg8.pkg65 import m898
+import pkg1.pkg16.pkg135.m134
+from pkg2 import m1
+from . import m1063
+
+
+def helper_2731_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
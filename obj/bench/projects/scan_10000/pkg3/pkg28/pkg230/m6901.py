@@ -0,0 +1,28 @@
+"""Module 6901."""
+import pkg8.pkg66.m65
+from pkg3.pkg29.pkg239 import m3157
+import pkg6.m5
+from pkg4.pkg40 import m39
+import pkg1.pkg12.pkg100.m99
+from . import m1063
+
+
+def helper_6901_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6901_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6901_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
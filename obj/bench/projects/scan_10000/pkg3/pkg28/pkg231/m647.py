@@ -0,0 +1,17 @@
+"""Module 647."""
+import pkg7.pkg62.m61
+from pkg2.pkg23.pkg189 import m188
+import pkg8.pkg68.m67
+from pkg8.pkg72 import m71
+import pkg4.pkg39.m38
+from pkg8.pkg65 import m64
+from . import m230
+from pkg3.pkg25 import m441
+import pkg3.pkg26.pkg215.m214
+
+
+def helper_647_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,46 @@
+"""Module 9404."""
+import pkg1.pkg11.m10
+from . import m6485
+import pkg5.pkg45.pkg368.m784
+from . import m5651
+from . import m647
+from pkg2.pkg17.pkg139 import m138
+import pkg2.pkg17.pkg140.m3475
+from pkg5.pkg44.pkg355 import m2022
+from . import m8153
+from pkg2.pkg18.pkg146 import m3064
+
+
+def helper_9404_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9404_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9404_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9404_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_9404_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,54 @@
+"""Module 1482."""
+import pkg3.pkg30.pkg247.m246
+from . import m231
+from . import m648
+from pkg2.pkg23 import m439
+import pkg6.pkg49.pkg399.m398
+from pkg3.pkg29 import m28
+import pkg3.pkg30.m29
+from pkg1 import m0
+import pkg2.pkg17.m16
+from pkg8 import m7
+import pkg1.pkg16.m15
+
+
+def helper_1482_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1482_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1482_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1482_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_1482_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_1482_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
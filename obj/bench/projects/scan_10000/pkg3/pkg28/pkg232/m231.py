@@ -0,0 +1,32 @@
+"""Module 231."""
+import pkg1.pkg12.m11
+from pkg2.pkg18.pkg145 import m144
+import pkg1.pkg10.m9
+from pkg1 import m0
+import pkg2.pkg24.pkg200.m199
+from pkg1.pkg13 import m12
+import pkg2.pkg18.m17
+from pkg2 import m1
+import pkg2.pkg24.pkg193.m192
+from pkg4.pkg35 import m34
+
+
+def helper_231_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_231_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_231_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
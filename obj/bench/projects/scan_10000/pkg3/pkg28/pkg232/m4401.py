@@ -0,0 +1,19 @@
+"""Module 4401."""
+from . import m2316
+from pkg3.pkg25 import m1275
+import pkg2.pkg19.pkg155.m3490
+from pkg2.pkg21.pkg175 import m3093
+import pkg5.pkg47.pkg377.m376
+from pkg7.pkg64 import m63
+import pkg2.pkg23.pkg188.m187
+from pkg4.pkg38.pkg309 import m308
+import pkg2.pkg24.pkg195.m1028
+from . import m1482
+import pkg5.pkg46.pkg373.m372
+
+
+def helper_4401_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,28 @@
+"""Module 6903."""
+import pkg8.pkg68.m67
+from pkg8 import m7
+from . import m2316
+from pkg3.pkg26.pkg211 import m1878
+import pkg2.pkg23.pkg191.m1441
+from . import m6486
+
+
+def helper_6903_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6903_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6903_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,40 @@
+"""Module 1279."""
+from . import m28
+from pkg4.pkg39 import m455
+from . import m862
+from pkg2.pkg17.pkg142 import m558
+import pkg2.pkg21.m20
+from pkg2.pkg18 import m1268
+import pkg2.pkg18.pkg151.m150
+from . import m445
+import pkg7.pkg59.m58
+from pkg4.pkg36 import m35
+import pkg1.pkg9.pkg80.m913
+
+
+def helper_1279_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1279_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1279_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1279_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,38 @@
+"""Module 445."""
+import pkg3.pkg27.m26
+from pkg5.pkg44 import m43
+import pkg1.m0
+from pkg5.pkg43 import m42
+import pkg5.m4
+from pkg8.pkg70 import m69
+import pkg3.pkg31.pkg250.m249
+from pkg2 import m1
+import pkg3.pkg31.pkg254.m253
+
+
+def helper_445_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_445_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_445_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_445_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
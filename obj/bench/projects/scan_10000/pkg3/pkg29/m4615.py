@@ -0,0 +1,18 @@
+"""Module 4615."""
+import pkg4.pkg33.m32
+from pkg5.pkg43 import m42
+from . import m3781
+from pkg4.pkg40.pkg322 import m321
+import pkg3.pkg32.pkg260.m1510
+from pkg5.pkg42.pkg344 import m1594
+from . import m28
+from pkg3.pkg27.pkg223 import m1056
+import pkg5.pkg42.m458
+from pkg1.pkg10.pkg87 import m86
+
+
+def helper_4615_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
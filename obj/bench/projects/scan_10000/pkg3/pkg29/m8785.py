@@ -0,0 +1,16 @@
+"""Module 8785."""
+import pkg3.pkg32.pkg259.m7347
+from pkg4.pkg38.pkg311 import m4063
+import pkg3.pkg30.pkg248.m1915
+from pkg3.pkg25.pkg203 import m4372
+import pkg4.pkg33.pkg270.m3605
+from pkg3.pkg30.pkg241 import m240
+import pkg8.pkg69.m7157
+from pkg7.pkg63 import m2981
+
+
+def helper_8785_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,47 @@
+"""Module 6487."""
+import pkg2.pkg24.m2108
+from . import m2734
+import pkg3.pkg32.m31
+from pkg2 import m1
+import pkg1.m0
+from pkg7.pkg61 import m3396
+import pkg4.pkg35.m451
+from pkg3.pkg28.pkg232 import m648
+import pkg3.pkg26.pkg214.m630
+from pkg5.pkg44 import m43
+import pkg5.pkg42.m2960
+
+
+def helper_6487_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6487_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6487_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6487_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_6487_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
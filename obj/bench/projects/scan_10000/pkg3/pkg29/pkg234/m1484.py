@@ -0,0 +1,33 @@
+"""Module 1484."""
+import pkg2.pkg23.m22
+from pkg1.pkg15.pkg122 import m121
+import pkg4.pkg37.pkg301.m300
+from pkg5.pkg42.pkg339 import m1172
+import pkg1.m0
+from pkg1.pkg9.pkg75 import m74
+import pkg5.pkg45.pkg362.m361
+from pkg4.pkg39 import m38
+import pkg4.pkg36.pkg296.m712
+from pkg5.pkg48.pkg385 import m384
+import pkg3.m2
+
+
+def helper_1484_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1484_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1484_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 2735."""
+from . import m1901
+from pkg4.pkg37.pkg297 import m2381
+
+
+def helper_2735_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2735_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,62 @@
+"""Module 6905."""
+import pkg3.pkg26.pkg211.m210
+from pkg2.pkg19.pkg158 import m991
+import pkg1.pkg16.pkg131.m130
+from pkg2.pkg23.pkg187 import m6858
+import pkg2.pkg20.pkg161.m3079
+from pkg2.pkg24.pkg194 import m3946
+import pkg1.m0
+from pkg6.pkg50.pkg402 import m1235
+import pkg4.pkg40.pkg323.m3241
+from pkg3.pkg26.pkg211 import m3129
+import pkg7.pkg62.m895
+from pkg6.pkg50 import m49
+
+
+def helper_6905_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6905_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6905_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6905_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_6905_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_6905_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6905_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,21 @@
+"""Module 8990."""
+import pkg3.pkg30.pkg246.m245
+from pkg5.pkg47.pkg377 import m376
+import pkg4.m3
+from pkg3.pkg32.pkg260 import m3178
+import pkg4.pkg33.pkg271.m4857
+from pkg1.pkg13.pkg110 import m5947
+
+
+def helper_8990_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8990_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
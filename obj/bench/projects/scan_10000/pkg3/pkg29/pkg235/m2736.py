@@ -0,0 +1,23 @@
+"""Module 2736."""
+import pkg6.pkg50.m466
+from pkg1.pkg12 import m11
+import pkg3.pkg31.m30
+from pkg2.pkg17.pkg144 import m2645
+import pkg1.pkg9.pkg78.m1328
+from . import m1902
+import pkg2.pkg22.pkg184.m600
+from pkg2.pkg20 import m19
+
+
+def helper_2736_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2736_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
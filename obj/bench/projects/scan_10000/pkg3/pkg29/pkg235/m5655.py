@@ -0,0 +1,52 @@
+"""Module 5655."""
+import pkg7.pkg57.m56
+from pkg2.pkg21.pkg171 import m1004
+import pkg3.pkg25.m1692
+from pkg2.pkg19.pkg153 import m1820
+import pkg2.pkg19.pkg159.m158
+from pkg1.pkg9.pkg77 import m3412
+import pkg3.pkg31.pkg253.m252
+from pkg8.pkg67 import m5070
+import pkg4.pkg35.pkg288.m287
+
+
+def helper_5655_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5655_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5655_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5655_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_5655_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_5655_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
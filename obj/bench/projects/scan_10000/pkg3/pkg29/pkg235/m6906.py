@@ -0,0 +1,8 @@
+"""Module 6906."""
+import pkg5.pkg41.pkg336.m335
+from pkg2.pkg22.pkg179 import m3097
+import pkg5.pkg45.pkg364.m5784
+from pkg3.pkg28.pkg231 import m2732
+import pkg1.pkg9.pkg80.m79
+from pkg6.pkg50.pkg407 import m2074
+import pkg6.pkg49.pkg397.m1647
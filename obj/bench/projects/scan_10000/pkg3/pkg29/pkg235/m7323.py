@@ -0,0 +1,39 @@
+"""Module 7323."""
+import pkg6.pkg52.pkg417.m7088
+from pkg3.pkg26.pkg216 import m215
+import pkg1.pkg9.pkg78.m77
+from pkg1.pkg9.pkg75 import m1325
+import pkg4.pkg39.m5459
+from pkg5.pkg46.pkg374 import m373
+from . import m5655
+from pkg5.pkg43 import m42
+import pkg1.pkg14.pkg115.m948
+from pkg3.pkg25.pkg208 import m1041
+
+
+def helper_7323_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7323_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7323_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7323_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
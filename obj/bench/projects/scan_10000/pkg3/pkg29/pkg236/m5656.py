@@ -0,0 +1,16 @@
+"""Module 5656."""
+import pkg4.pkg38.pkg310.m1143
+from pkg2.pkg19.pkg156 import m5576
+from . import m5239
+from pkg3.pkg31.pkg256 import m1506
+import pkg6.pkg49.pkg397.m1230
+from pkg3.pkg26.pkg209 import m208
+import pkg2.m1
+from . import m235
+
+
+def helper_5656_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
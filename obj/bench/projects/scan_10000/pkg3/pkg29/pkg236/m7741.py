@@ -0,0 +1,17 @@
+"""Module 7741."""
+import pkg4.pkg34.pkg279.m1112
+from pkg8.pkg71 import m1321
+
+
+def helper_7741_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7741_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
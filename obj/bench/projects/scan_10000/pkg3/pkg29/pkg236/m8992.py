@@ -0,0 +1,11 @@
+"""Module 8992."""
+import pkg2.pkg22.m21
+from pkg3 import m2
+import pkg1.pkg12.m1679
+
+
+def helper_8992_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
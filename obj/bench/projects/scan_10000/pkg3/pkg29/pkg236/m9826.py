@@ -0,0 +1,18 @@
+"""Module 9826."""
+import pkg4.pkg34.pkg275.m691
+from pkg1.pkg14.pkg115 import m3033
+from . import m2320
+
+
+def helper_9826_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9826_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
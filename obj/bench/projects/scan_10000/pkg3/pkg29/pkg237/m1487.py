@@ -0,0 +1,46 @@
+"""Module 1487."""
+import pkg1.pkg13.pkg111.m110
+from pkg1.pkg11.pkg89 import m505
+import pkg2.pkg21.pkg173.m589
+from pkg4.pkg39.pkg314 import m313
+from . import m1070
+from . import m653
+import pkg4.pkg35.pkg288.m287
+from pkg6.pkg49.pkg394 import m1227
+import pkg5.pkg47.pkg379.m378
+from pkg4.pkg35.pkg281 import m280
+
+
+def helper_1487_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1487_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1487_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1487_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_1487_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 236."""
+import pkg1.pkg14.pkg113.m112
+from pkg3.pkg27.pkg223 import m222
+import pkg2.m1
+from pkg3.pkg29.pkg234 import m233
+import pkg4.m3
+from pkg1 import m0
+import pkg1.pkg9.m8
+from pkg3.pkg28.pkg228 import m227
+import pkg3.pkg28.pkg225.m224
+
+
+def helper_236_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
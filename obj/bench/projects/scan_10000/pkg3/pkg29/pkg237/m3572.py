@@ -0,0 +1,17 @@
+"""Module 3572."""
+import pkg2.m1
+from pkg5.pkg41.pkg336 import m752
+import pkg5.pkg43.m42
+from pkg5.pkg42.pkg337 import m2004
+import pkg1.pkg16.m15
+from pkg2.pkg18.pkg149 import m1399
+import pkg5.pkg46.m2964
+from pkg1.pkg14.pkg116 import m2617
+import pkg5.pkg45.pkg366.m365
+
+
+def helper_3572_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
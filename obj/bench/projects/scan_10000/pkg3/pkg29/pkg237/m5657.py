@@ -0,0 +1,19 @@
+"""Module 5657."""
+from . import m1904
+from pkg4.pkg35.pkg282 import m1115
+import pkg1.m0
+from pkg1.pkg9.pkg75 import m1325
+import pkg3.pkg27.pkg223.m639
+from pkg5.pkg46.pkg370 import m786
+from . import m3155
+from pkg3.pkg26.pkg209 import m2293
+from . import m4406
+from pkg2 import m1
+import pkg1.pkg16.pkg134.m3052
+
+
+def helper_5657_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
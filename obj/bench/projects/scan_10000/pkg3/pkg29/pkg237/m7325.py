@@ -0,0 +1,20 @@
+"""Module 7325."""
+import pkg4.pkg36.pkg290.m1957
+from pkg5.pkg48.pkg390 import m3308
+from . import m6491
+from pkg1.pkg13 import m12
+import pkg2.m1
+
+
+def helper_7325_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7325_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
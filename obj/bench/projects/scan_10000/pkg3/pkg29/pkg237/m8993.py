@@ -0,0 +1,22 @@
+"""Module 8993."""
+import pkg7.pkg62.m2980
+from pkg2.pkg23.pkg190 import m7278
+import pkg4.pkg37.m1704
+from pkg5.pkg43.pkg351 import m6188
+from . import m2321
+from pkg1.pkg12.pkg101 import m934
+import pkg4.pkg40.pkg324.m1574
+
+
+def helper_8993_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8993_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
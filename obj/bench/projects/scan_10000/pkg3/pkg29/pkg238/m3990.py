@@ -0,0 +1,36 @@
+"""Module 3990."""
+from . import m1905
+from . import m3156
+from . import m2739
+from . import m1071
+import pkg4.pkg38.m37
+from pkg3.pkg31.pkg249 import m2750
+import pkg1.pkg12.m11
+
+
+def helper_3990_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3990_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3990_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3990_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,38 @@
+"""Module 654."""
+import pkg4.pkg34.m450
+from pkg2.pkg18.pkg145 import m144
+import pkg5.pkg45.m44
+from pkg2.pkg18.pkg152 import m568
+import pkg3.m2
+from pkg5 import m4
+from . import m237
+from pkg3.pkg30.pkg246 import m245
+import pkg1.pkg13.pkg112.m528
+
+
+def helper_654_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_654_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_654_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_654_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
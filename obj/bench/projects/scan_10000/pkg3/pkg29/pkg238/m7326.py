@@ -0,0 +1,13 @@
+"""Module 7326."""
+import pkg4.pkg34.pkg277.m2361
+from pkg3.pkg26.pkg214 import m1047
+import pkg1.pkg14.pkg113.m2614
+from pkg5.pkg43.pkg350 import m4936
+import pkg3.pkg32.pkg260.m6931
+
+
+def helper_7326_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,61 @@
+"""Module 7743."""
+import pkg4.pkg40.pkg326.m2827
+from pkg1.pkg11.pkg89 import m88
+from . import m2739
+from pkg3.pkg29.pkg233 import m2317
+from . import m3156
+from pkg1.pkg16.pkg130 import m5133
+import pkg1.pkg14.m847
+from . import m6492
+import pkg3.pkg27.pkg217.m2301
+from pkg4.pkg36.pkg296 import m295
+import pkg3.pkg26.pkg215.m1882
+
+
+def helper_7743_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7743_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7743_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7743_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_7743_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_7743_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7743_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 9828."""
+import pkg5.m4
+from pkg5.pkg45.pkg366 import m5786
+import pkg4.pkg40.pkg325.m324
+from pkg7 import m7929
+import pkg2.pkg20.m19
+from . import m3156
+import pkg1.pkg12.pkg97.m3849
+from pkg1.pkg15.pkg127 import m1377
+import pkg5.pkg47.pkg377.m1210
+from . import m6492
+import pkg3.pkg26.pkg215.m3133
+
+
+def helper_9828_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9828_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,28 @@
+"""Module 2740."""
+from . import m1906
+from pkg8.pkg67 import m483
+import pkg5.pkg45.pkg366.m1199
+from pkg2.pkg18.pkg150 import m566
+import pkg1.pkg9.pkg73.m72
+from pkg2.pkg18.pkg146 import m562
+
+
+def helper_2740_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2740_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2740_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
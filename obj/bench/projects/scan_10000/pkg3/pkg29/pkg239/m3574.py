@@ -0,0 +1,33 @@
+"""Module 3574."""
+import pkg2.pkg17.pkg139.m138
+from pkg1.pkg15.pkg123 import m1790
+import pkg2.m1
+from . import m1489
+import pkg7.pkg57.m56
+from . import m655
+import pkg3.pkg25.pkg202.m618
+from . import m1906
+import pkg7.m6
+from pkg4.pkg35 import m1285
+import pkg3.pkg32.pkg257.m1090
+
+
+def helper_3574_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3574_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3574_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,14 @@
+"""Module 3992."""
+from . import m1490
+from pkg3.pkg25.pkg203 import m2704
+import pkg5.pkg41.pkg336.m3671
+from pkg1.pkg13.pkg105 import m1355
+from . import m3575
+from pkg3.pkg32 import m448
+
+
+def helper_3992_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 5660."""
+from . import m239
+from pkg2 import m1252
+import pkg1.pkg11.m10
+from pkg4.pkg36.pkg293 import m292
+import pkg2.pkg22.m1272
+from pkg3.pkg31.pkg249 import m1916
+from . import m3992
+from pkg5 import m4
+import pkg1.pkg10.pkg85.m3420
+from pkg4.pkg38.pkg309 import m308
+from . import m4409
+from pkg5.pkg46.pkg369 import m368
+
+
+def helper_5660_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5660_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,10 @@
+"""Module 8162."""
+import pkg3.pkg29.pkg235.m234
+from . import m4409
+
+
+def helper_8162_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 1697."""
+import pkg1.m0
+from pkg2.pkg17 import m433
+import pkg4.pkg40.pkg321.m737
+
+
+def helper_1697_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1697_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,36 @@
+"""Module 7535."""
+import pkg4.pkg36.m3371
+from pkg6.pkg49.pkg394 import m7482
+import pkg3.pkg29.pkg238.m1071
+from pkg5.pkg41.pkg333 import m332
+import pkg5.pkg41.pkg332.m331
+from pkg4.pkg33.pkg266 import m1516
+from . import m5450
+
+
+def helper_7535_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7535_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7535_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7535_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 863."""
+import pkg2.pkg24.pkg200.m199
+from pkg5.pkg46.pkg372 import m371
+import pkg1.pkg9.pkg75.m74
+
+
+def helper_863_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_863_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 9203."""
+import pkg5.pkg43.pkg346.m2013
+from pkg4.pkg39.pkg317 import m316
+from . import m8786
+from . import m4616
+
+
+def helper_9203_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9203_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,23 @@
+"""Module 1491."""
+import pkg5.pkg43.pkg348.m347
+from pkg2.pkg20.pkg164 import m580
+import pkg2.pkg22.pkg179.m178
+from pkg5.pkg46.pkg370 import m369
+import pkg1.pkg11.pkg91.m90
+from pkg3.pkg31.pkg252 import m251
+import pkg3.pkg30.m29
+from pkg5.pkg47.pkg377 import m793
+
+
+def helper_1491_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1491_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
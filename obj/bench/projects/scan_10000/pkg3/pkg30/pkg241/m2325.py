@@ -0,0 +1,19 @@
+"""Module 2325."""
+from . import m657
+from pkg2.pkg23.pkg187 import m186
+import pkg6.pkg56.m472
+from pkg1 import m0
+
+
+def helper_2325_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2325_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
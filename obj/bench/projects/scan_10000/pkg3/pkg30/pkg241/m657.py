@@ -0,0 +1,23 @@
+"""Module 657."""
+import pkg1.m0
+from pkg3.pkg32.pkg258 import m257
+import pkg2.pkg21.pkg169.m585
+from pkg1.pkg14.pkg113 import m112
+import pkg2.m1
+from . import m240
+import pkg5.pkg47.pkg382.m381
+from pkg3.pkg25.pkg204 import m203
+
+
+def helper_657_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_657_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,14 @@
+"""Module 3994."""
+import pkg2.pkg18.pkg147.m980
+from pkg4.pkg40.pkg328 import m327
+import pkg2.pkg17.pkg140.m139
+from pkg4.pkg33.pkg271 import m1521
+import pkg2.pkg23.pkg185.m184
+from pkg1.pkg9.pkg78 import m2579
+
+
+def helper_3994_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
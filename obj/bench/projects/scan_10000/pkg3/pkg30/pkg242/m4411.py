@@ -0,0 +1,34 @@
+"""Module 4411."""
+from . import m1492
+from pkg5.pkg44.pkg358 import m4110
+import pkg1.pkg14.pkg119.m952
+from pkg6.pkg50.pkg401 import m400
+import pkg5.pkg45.pkg365.m2449
+
+
+def helper_4411_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4411_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4411_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4411_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,6 @@
+"""Module 5245."""
+import pkg5.pkg46.m879
+from . import m3577
+import pkg3.m2
+from pkg2.pkg21.pkg173 import m589
+from . import m3994
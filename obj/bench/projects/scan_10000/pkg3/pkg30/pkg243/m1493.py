@@ -0,0 +1,30 @@
+"""Module 1493."""
+import pkg3.pkg31.pkg256.m1089
+from pkg6.pkg49.pkg397 import m1230
+import pkg1.m0
+from pkg1.pkg14.pkg115 import m948
+import pkg4.m3
+from pkg2.pkg18.pkg151 import m150
+import pkg2.pkg24.pkg194.m1444
+from pkg3.pkg26.pkg214 import m213
+
+
+def helper_1493_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1493_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1493_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
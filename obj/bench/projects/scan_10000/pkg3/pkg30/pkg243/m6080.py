@@ -0,0 +1,16 @@
+"""Module 6080."""
+import pkg5.pkg45.pkg364.m780
+from pkg1.pkg11.pkg95 import m2179
+import pkg5.pkg48.pkg388.m5391
+from pkg5.pkg47.pkg378 import m377
+from . import m2744
+from . import m1076
+from . import m5246
+from pkg4.pkg38.pkg310 import m5730
+
+
+def helper_6080_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 9416."""
+import pkg2.pkg24.pkg196.m5616
+from pkg3.pkg28.pkg228 import m8567
+import pkg1.pkg14.pkg116.m115
+
+
+def helper_9416_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
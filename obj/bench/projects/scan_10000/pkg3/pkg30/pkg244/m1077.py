@@ -0,0 +1,17 @@
+"""Module 1077."""
+import pkg3.pkg28.m27
+from pkg7.pkg61 import m60
+
+
+def helper_1077_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1077_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
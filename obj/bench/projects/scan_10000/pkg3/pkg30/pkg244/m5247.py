@@ -0,0 +1,30 @@
+"""Module 5247."""
+import pkg2.pkg18.pkg152.m1402
+from pkg2.pkg22 import m21
+import pkg3.pkg30.pkg242.m2743
+from pkg3.pkg28.pkg229 import m228
+import pkg3.pkg30.m29
+from pkg4.pkg38.pkg311 import m1144
+import pkg1.pkg15.pkg125.m2209
+from pkg5.pkg43.pkg345 import m1178
+
+
+def helper_5247_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5247_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5247_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
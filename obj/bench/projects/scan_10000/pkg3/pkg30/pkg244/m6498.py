@@ -0,0 +1,18 @@
+"""Module 6498."""
+from . import m1494
+from pkg3.pkg28.pkg227 import m226
+from . import m1911
+from pkg2.pkg20.pkg162 import m5999
+import pkg1.pkg10.pkg88.m504
+from pkg4.pkg34.pkg279 import m278
+import pkg4.pkg34.pkg280.m2364
+from pkg5.pkg44.pkg355 import m354
+import pkg8.pkg69.m68
+from pkg1.pkg9.pkg75 import m1325
+
+
+def helper_6498_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
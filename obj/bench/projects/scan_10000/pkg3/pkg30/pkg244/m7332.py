@@ -0,0 +1,48 @@
+"""Module 7332."""
+import pkg6.pkg52.m51
+from pkg2.pkg21 import m2522
+from . import m243
+from . import m2328
+import pkg2.pkg17.pkg139.m555
+from pkg7.pkg63 import m62
+import pkg3.pkg28.pkg232.m1065
+from pkg5.pkg45.pkg366 import m782
+import pkg2.pkg20.pkg167.m166
+from pkg5.pkg47.pkg382 import m1215
+import pkg8.pkg65.m898
+from pkg7.pkg58 import m5895
+
+
+def helper_7332_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7332_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7332_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7332_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_7332_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 8166."""
+import pkg1.m0
+from pkg7 import m6
+import pkg1.pkg9.pkg77.m1744
+from pkg3.pkg26.pkg212 import m211
+from . import m1494
+from pkg1.pkg9.pkg77 import m7165
+import pkg4.pkg36.m35
+from . import m3162
+import pkg6.pkg51.pkg409.m408
+from pkg6.pkg50.pkg404 import m7909
+import pkg5.pkg42.pkg340.m7428
+from pkg1.pkg12.pkg98 import m97
+
+
+def helper_8166_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8166_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
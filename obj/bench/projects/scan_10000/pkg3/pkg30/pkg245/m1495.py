@@ -0,0 +1,41 @@
+"""Module 1495."""
+import pkg1.pkg9.pkg75.m74
+from pkg6.pkg49 import m48
+import pkg4.pkg35.pkg281.m697
+from pkg1.pkg14.pkg118 import m1368
+import pkg4.pkg35.pkg282.m281
+from pkg1.pkg12.pkg102 import m935
+import pkg6.pkg49.pkg395.m394
+from pkg4 import m3
+from . import m244
+from pkg2 import m1
+import pkg1.m0
+from . import m1078
+
+
+def helper_1495_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1495_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1495_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1495_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,36 @@
+"""Module 2329."""
+import pkg4.m3
+from . import m1912
+from . import m1078
+from pkg2.pkg23.pkg189 import m1022
+import pkg1.m0
+from pkg1.pkg12.pkg103 import m519
+import pkg5.pkg42.pkg337.m1170
+
+
+def helper_2329_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2329_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2329_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2329_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
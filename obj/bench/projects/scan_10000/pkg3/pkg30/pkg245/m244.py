@@ -0,0 +1,47 @@
+"""Module 244."""
+import pkg3.pkg32.m31
+from pkg8.pkg72 import m71
+import pkg1.pkg13.m12
+from pkg1.pkg9.pkg76 import m75
+import pkg1.pkg9.pkg77.m76
+from pkg2.pkg19 import m18
+import pkg1.pkg10.pkg86.m85
+from pkg5.pkg43 import m42
+import pkg3.pkg28.pkg227.m226
+from pkg7.pkg63 import m62
+import pkg3.pkg25.pkg206.m205
+
+
+def helper_244_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_244_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_244_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_244_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_244_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
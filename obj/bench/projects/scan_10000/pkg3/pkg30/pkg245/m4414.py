@@ -0,0 +1,39 @@
+"""Module 4414."""
+import pkg6.pkg50.pkg405.m4157
+from . import m244
+import pkg5.pkg46.pkg372.m3290
+from pkg2.pkg17.pkg138 import m3056
+import pkg1.pkg16.pkg136.m969
+from . import m3580
+import pkg1.pkg10.pkg88.m87
+from pkg2.pkg22.pkg184 import m183
+from . import m2746
+from pkg2.pkg22.pkg179 import m178
+
+
+def helper_4414_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4414_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4414_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4414_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
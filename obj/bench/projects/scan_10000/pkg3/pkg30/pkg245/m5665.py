@@ -0,0 +1,55 @@
+"""Module 5665."""
+import pkg4.pkg38.pkg306.m305
+from pkg6.pkg49.pkg398 import m397
+import pkg5.pkg47.pkg383.m4135
+from pkg5.pkg42.pkg337 import m336
+import pkg4.pkg33.m32
+from pkg5.pkg43.pkg347 import m346
+from . import m3997
+from pkg5.pkg48.pkg388 import m1221
+import pkg2.pkg24.m23
+from pkg1.pkg15.pkg121 import m3456
+import pkg2.pkg21.m20
+from . import m2329
+
+
+def helper_5665_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5665_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5665_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5665_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_5665_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_5665_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
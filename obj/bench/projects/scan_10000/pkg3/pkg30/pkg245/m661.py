@@ -0,0 +1,53 @@
+"""Module 661."""
+import pkg3.pkg30.pkg248.m247
+from pkg7 import m6
+from . import m244
+from pkg1.pkg9 import m8
+import pkg8.pkg72.m71
+from pkg1.pkg10.pkg81 import m497
+import pkg2.pkg23.pkg190.m606
+from pkg6.pkg49 import m48
+import pkg2.m1
+from pkg1.pkg9.pkg77 import m76
+
+
+def helper_661_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_661_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_661_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_661_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_661_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_661_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
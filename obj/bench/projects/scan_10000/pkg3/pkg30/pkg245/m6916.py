@@ -0,0 +1,55 @@
+"""Module 6916."""
+import pkg2.pkg21.pkg169.m1836
+from . import m661
+import pkg6.pkg55.m54
+from pkg2.pkg24.pkg196 import m195
+import pkg3.pkg29.m4198
+from pkg3.pkg27.pkg224 import m223
+from . import m4831
+from . import m3997
+from . import m1495
+from . import m3580
+from . import m5248
+from pkg3.pkg28.pkg228 import m5231
+
+
+def helper_6916_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6916_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6916_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6916_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_6916_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_6916_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
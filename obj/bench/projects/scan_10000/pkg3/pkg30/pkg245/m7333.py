@@ -0,0 +1,12 @@
+"""Module 7333."""
+import pkg3.pkg28.pkg227.m7315
+from pkg5.pkg47.pkg383 import m5803
+import pkg1.pkg9.pkg80.m6334
+from pkg2.pkg24.pkg199 import m615
+from . import m4831
+from pkg3.pkg29 import m28
+import pkg8.pkg71.m4240
+from . import m2746
+from . import m3580
+from pkg1.pkg11.pkg96 import m4265
+import pkg6.m5
@@ -0,0 +1,47 @@
+"""Module 7750."""
+import pkg1.pkg15.pkg123.m122
+from pkg4.pkg36.pkg289 import m5709
+from . import m244
+from pkg1.pkg10 import m426
+import pkg1.pkg12.pkg99.m98
+from pkg4.pkg37.pkg304 import m5724
+from . import m5665
+from pkg3.pkg30.pkg246 import m245
+import pkg6.pkg49.pkg397.m813
+from pkg1.pkg14.pkg120 import m536
+from . import m7333
+
+
+def helper_7750_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7750_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7750_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7750_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_7750_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
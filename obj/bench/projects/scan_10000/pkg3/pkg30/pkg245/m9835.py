@@ -0,0 +1,46 @@
+"""Module 9835."""
+from . import m2329
+from pkg5.pkg46.pkg376 import m375
+import pkg6.pkg49.pkg400.m1650
+from pkg1.pkg16.pkg136 import m1386
+import pkg4.pkg39.pkg314.m5734
+from pkg1.pkg9.pkg74 import m73
+from . import m9001
+from pkg2.pkg17 import m16
+import pkg2.pkg20.m436
+from pkg4.pkg38.pkg310 import m726
+
+
+def helper_9835_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9835_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9835_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9835_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_9835_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
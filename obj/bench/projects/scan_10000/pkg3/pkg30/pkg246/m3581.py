@@ -0,0 +1,18 @@
+"""Module 3581."""
+import pkg2.pkg19.pkg154.m153
+from pkg5.pkg45.pkg362 import m2863
+import pkg1.m0
+from . import m662
+import pkg2.pkg17.m433
+from pkg2.pkg18.pkg146 import m3064
+import pkg1.pkg16.pkg130.m2214
+from pkg5.pkg48.pkg391 import m3309
+import pkg6.pkg51.pkg414.m413
+from pkg3.pkg25.pkg207 import m3542
+
+
+def helper_3581_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,35 @@
+"""Module 6917."""
+import pkg1.pkg11.pkg89.m88
+from pkg1.pkg16 import m2100
+import pkg7.pkg60.m59
+from pkg5.pkg42.pkg344 import m1594
+from . import m3164
+from pkg3.pkg30.pkg242 import m1909
+
+
+def helper_6917_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6917_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6917_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6917_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,53 @@
+"""Module 7751."""
+import pkg3.pkg27.pkg218.m1051
+from pkg1.pkg10.pkg83 import m82
+import pkg2.pkg21.pkg171.m2672
+from . import m3998
+import pkg1.pkg15.pkg127.m960
+from pkg6.pkg51.pkg410 import m4579
+from . import m6083
+from pkg8.pkg68 import m484
+import pkg5.pkg43.pkg349.m348
+from pkg5 import m4
+
+
+def helper_7751_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7751_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7751_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7751_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_7751_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_7751_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,41 @@
+"""Module 9419."""
+import pkg3.pkg28.pkg229.m1062
+from pkg8.pkg71 import m70
+import pkg1.pkg11.m1678
+from . import m662
+import pkg2.pkg18.pkg149.m4318
+from pkg1.pkg13 import m4599
+import pkg6.pkg49.m2133
+from pkg6.pkg50 import m49
+import pkg1.pkg13.pkg109.m108
+from pkg3.pkg28 import m27
+import pkg5.pkg42.pkg344.m760
+from pkg2.pkg21.pkg169 import m168
+
+
+def helper_9419_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9419_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9419_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9419_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,12 @@
+"""Module 9836."""
+import pkg4.pkg38.pkg306.m5726
+from pkg6.pkg51.pkg410 import m2077
+import pkg4.pkg38.pkg309.m5312
+from pkg4.pkg35.pkg284 import m2368
+
+
+def helper_9836_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
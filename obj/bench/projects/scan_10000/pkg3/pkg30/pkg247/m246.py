@@ -0,0 +1,23 @@
+"""Module 246."""
+import pkg5.pkg48.m47
+from pkg8 import m7
+import pkg1.pkg16.pkg135.m134
+from pkg1.pkg16 import m15
+import pkg4.m3
+from pkg1 import m0
+import pkg6.m5
+from pkg7 import m6
+
+
+def helper_246_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_246_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 5250."""
+import pkg5.pkg48.pkg386.m2053
+from pkg3.pkg29.pkg240 import m1490
+import pkg3.pkg31.pkg254.m2755
+from pkg1.pkg12.pkg102 import m935
+import pkg3.m2
+from pkg6.pkg51.pkg413 import m829
+import pkg1.m0
+from pkg7.pkg63 import m62
+import pkg5.pkg47.pkg378.m2045
+from pkg3.pkg27.pkg220 import m1887
+from . import m1080
+from pkg4.pkg39.pkg315 import m314
+
+
+def helper_5250_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
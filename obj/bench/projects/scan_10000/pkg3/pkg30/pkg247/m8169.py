@@ -0,0 +1,14 @@
+"""Module 8169."""
+import pkg4.pkg37.pkg300.m299
+from . import m5250
+import pkg1.m0
+from pkg3.pkg28.pkg227 import m226
+import pkg2.pkg20.pkg162.m995
+from pkg2.pkg19.pkg160 import m159
+
+
+def helper_8169_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
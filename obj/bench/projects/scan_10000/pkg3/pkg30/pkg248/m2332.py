@@ -0,0 +1,18 @@
+"""Module 2332."""
+import pkg1.pkg12.pkg101.m100
+from . import m1915
+import pkg8.m7
+from pkg1.pkg9.pkg74 import m73
+import pkg6.pkg49.pkg393.m1643
+from pkg5.pkg45.pkg361 import m777
+import pkg2.pkg22.pkg179.m595
+from pkg2 import m1
+import pkg7.m6
+from pkg4.pkg34.pkg280 import m1530
+
+
+def helper_2332_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 9838."""
+import pkg5.pkg42.m41
+from pkg1.pkg11.pkg90 import m89
+from . import m7753
+
+
+def helper_9838_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
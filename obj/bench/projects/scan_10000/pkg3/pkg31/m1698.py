@@ -0,0 +1,15 @@
+"""Module 1698."""
+import pkg5.pkg44.pkg358.m774
+from . import m30
+import pkg3.pkg32.pkg260.m259
+from pkg3.pkg29.pkg234 import m233
+import pkg1.m0
+from pkg1.pkg9 import m8
+import pkg3.pkg27.pkg217.m633
+
+
+def helper_1698_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,38 @@
+"""Module 30."""
+import pkg1.pkg9.m8
+from pkg2.pkg18 import m17
+import pkg1.pkg14.m13
+from pkg1 import m0
+import pkg1.pkg16.m15
+from pkg1.pkg11 import m10
+import pkg4.m3
+from pkg1.pkg15 import m14
+import pkg2.pkg21.m20
+
+
+def helper_30_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_30_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_30_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_30_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,15 @@
+"""Module 447."""
+import pkg3.pkg26.pkg213.m212
+from pkg2.pkg24.pkg199 import m198
+import pkg2.pkg20.pkg167.m166
+from . import m30
+import pkg1.m0
+from pkg6.pkg54 import m53
+import pkg3.pkg28.m27
+
+
+def helper_447_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
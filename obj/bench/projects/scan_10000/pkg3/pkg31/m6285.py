@@ -0,0 +1,16 @@
+"""Module 6285."""
+import pkg6.pkg49.pkg395.m4564
+from . import m864
+import pkg5.pkg43.pkg345.m344
+from pkg1.pkg12.pkg103 import m102
+import pkg5.pkg46.pkg369.m2036
+from pkg5.pkg47.pkg382 import m4551
+import pkg1.pkg11.m10
+from pkg4.pkg34.pkg274 import m3609
+
+
+def helper_6285_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 6702."""
+import pkg2.pkg19.pkg155.m4741
+from pkg5.pkg46.pkg374 import m790
+import pkg3.pkg26.pkg210.m2294
+
+
+def helper_6702_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6702_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
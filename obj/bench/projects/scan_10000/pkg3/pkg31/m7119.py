@@ -0,0 +1,33 @@
+"""Module 7119."""
+import pkg5.pkg41.pkg334.m4086
+from pkg1.pkg14.pkg113 import m112
+from . import m6285
+from . import m3783
+import pkg6.pkg56.m55
+from pkg5.pkg45.pkg364 import m2865
+import pkg5.m4
+from pkg3.pkg31.pkg251 import m2752
+import pkg4.pkg36.m1286
+from pkg6.pkg52 import m4221
+import pkg4.pkg39.m2957
+
+
+def helper_7119_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7119_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7119_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,9 @@
+"""Module 7953."""
+import pkg1.pkg15.m431
+
+
+def helper_7953_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
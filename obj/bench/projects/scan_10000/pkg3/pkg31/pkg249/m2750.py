@@ -0,0 +1,40 @@
+"""Module 2750."""
+import pkg3.pkg29.pkg238.m654
+from pkg1 import m0
+import pkg6.pkg49.pkg395.m2479
+from pkg1.pkg9.pkg77 import m76
+from . import m1499
+from pkg4.pkg34.pkg276 import m275
+from . import m1082
+from pkg1.pkg16.pkg135 import m2219
+import pkg3.pkg32.pkg258.m1925
+from pkg5.pkg42 import m41
+import pkg5.pkg41.m40
+
+
+def helper_2750_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2750_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2750_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2750_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 5669."""
+from . import m4418
+from pkg1.pkg15.pkg126 import m959
+import pkg1.pkg16.pkg134.m5137
+from pkg7 import m6
+import pkg3.pkg26.pkg213.m212
+
+
+def helper_5669_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5669_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,31 @@
+"""Module 5670."""
+from . import m4836
+from pkg2.pkg23.pkg186 import m1019
+from . import m1917
+from pkg5.pkg44.pkg354 import m353
+import pkg6.m5
+from pkg3.pkg25.pkg204 import m620
+import pkg1.pkg12.pkg97.m930
+from pkg2.pkg21.pkg173 import m5176
+import pkg3.pkg30.pkg245.m1078
+
+
+def helper_5670_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5670_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5670_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,10 @@
+"""Module 7338."""
+import pkg2.pkg22.pkg179.m3097
+from pkg2.pkg21.pkg174 import m1007
+
+
+def helper_7338_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
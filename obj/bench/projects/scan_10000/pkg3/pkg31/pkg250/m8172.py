@@ -0,0 +1,53 @@
+"""Module 8172."""
+import pkg8.m7
+from pkg1 import m0
+from . import m2334
+from pkg5.pkg41.pkg333 import m6587
+from . import m5253
+from pkg4.pkg38.pkg311 import m4063
+import pkg1.pkg10.pkg86.m85
+from pkg2.pkg17.pkg138 import m1805
+import pkg3.pkg28.pkg225.m224
+from pkg5.pkg47.pkg378 import m6215
+
+
+def helper_8172_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8172_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8172_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8172_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_8172_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_8172_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
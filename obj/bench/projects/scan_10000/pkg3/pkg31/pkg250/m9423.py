@@ -0,0 +1,19 @@
+"""Module 9423."""
+from . import m7338
+from pkg3.pkg28.pkg231 import m2732
+import pkg4.pkg33.m4619
+from pkg4.pkg35 import m5038
+
+
+def helper_9423_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9423_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
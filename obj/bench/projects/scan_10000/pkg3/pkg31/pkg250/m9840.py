@@ -0,0 +1,16 @@
+"""Module 9840."""
+from . import m8172
+from pkg1.pkg16.pkg135 import m5138
+from . import m666
+from pkg2.pkg18.pkg151 import m150
+import pkg6.pkg50.pkg404.m1654
+from pkg4.pkg33.pkg272 import m3190
+import pkg4.pkg35.pkg282.m2366
+from pkg3.pkg28.pkg231 import m5651
+
+
+def helper_9840_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
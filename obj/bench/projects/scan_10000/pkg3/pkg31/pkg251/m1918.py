@@ -0,0 +1,27 @@
+"""Module 1918."""
+import pkg1.pkg10.m9
+from pkg5.pkg48 import m1715
+from . import m1084
+from pkg1.pkg12.pkg100 import m516
+import pkg4.pkg37.pkg297.m296
+
+
+def helper_1918_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1918_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1918_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
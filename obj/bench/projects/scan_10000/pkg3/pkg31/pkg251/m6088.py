@@ -0,0 +1,16 @@
+"""Module 6088."""
+import pkg7.pkg59.m892
+from . import m4003
+import pkg6.pkg51.pkg410.m409
+from . import m4420
+from . import m250
+from pkg3.pkg29.pkg239 import m1906
+from . import m2752
+from pkg7 import m6
+
+
+def helper_6088_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,54 @@
+"""Module 6505."""
+import pkg2.pkg24.pkg194.m2695
+from . import m3586
+import pkg8.pkg72.m71
+from pkg3.pkg29.pkg240 import m2324
+from . import m4003
+from pkg4.pkg40.pkg324 import m2408
+import pkg4.pkg35.pkg286.m3204
+from pkg4.pkg40.pkg326 import m325
+import pkg2.pkg24.m23
+from . import m4837
+import pkg4.pkg39.pkg320.m1570
+
+
+def helper_6505_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6505_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6505_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6505_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_6505_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_6505_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,39 @@
+"""Module 1502."""
+import pkg2.pkg22.pkg182.m181
+from pkg5.pkg45 import m461
+import pkg1.m0
+from pkg3.pkg32.pkg257 import m1090
+from . import m668
+from pkg1.pkg12.pkg104 import m103
+import pkg2.pkg23.pkg190.m606
+from pkg1.pkg9.pkg79 import m912
+import pkg3.pkg25.pkg205.m204
+from pkg2.pkg20.pkg164 import m163
+
+
+def helper_1502_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1502_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1502_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1502_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
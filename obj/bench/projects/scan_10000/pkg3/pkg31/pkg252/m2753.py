@@ -0,0 +1,39 @@
+"""Module 2753."""
+import pkg2.pkg24.pkg198.m1031
+from pkg5.pkg41.pkg332 import m1999
+from . import m1919
+from pkg2.pkg22 import m21
+import pkg3.pkg29.m2530
+from pkg5.pkg48 import m47
+from . import m668
+from pkg2.pkg22.pkg179 import m1429
+import pkg5.pkg42.pkg338.m337
+from pkg4.pkg37.pkg301 import m300
+
+
+def helper_2753_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2753_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2753_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2753_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
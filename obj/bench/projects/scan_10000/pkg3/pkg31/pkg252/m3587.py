@@ -0,0 +1,21 @@
+"""Module 3587."""
+import pkg1.pkg10.pkg82.m2166
+from pkg5.pkg46.pkg372 import m371
+import pkg3.pkg31.pkg249.m3584
+from pkg1 import m0
+from . import m3170
+from . import m1502
+
+
+def helper_3587_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3587_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,33 @@
+"""Module 668."""
+from . import m251
+from pkg2.pkg17.pkg141 import m557
+import pkg4.pkg40.pkg322.m321
+from pkg4.pkg39.pkg313 import m312
+import pkg4.pkg34.pkg274.m273
+from pkg6.pkg51.pkg412 import m411
+import pkg2.m1
+from pkg2.pkg24.pkg197 import m196
+import pkg1.pkg11.pkg93.m92
+from pkg3.pkg25.pkg207 import m623
+import pkg1.m0
+
+
+def helper_668_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_668_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_668_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
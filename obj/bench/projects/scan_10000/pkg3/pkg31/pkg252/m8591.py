@@ -0,0 +1,26 @@
+"""Module 8591."""
+import pkg5.pkg47.pkg384.m4970
+from pkg3.pkg30.pkg246 import m662
+from . import m7340
+from . import m1919
+
+
+def helper_8591_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8591_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8591_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 9008."""
+import pkg4.pkg38.pkg309.m308
+from pkg1.pkg12.pkg102 import m518
+import pkg3.pkg28.pkg232.m1482
+
+
+def helper_9008_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
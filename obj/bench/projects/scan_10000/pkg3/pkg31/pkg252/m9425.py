@@ -0,0 +1,38 @@
+"""Module 9425."""
+import pkg6.pkg50.pkg404.m4990
+from pkg3 import m2921
+import pkg3.pkg26.m25
+from pkg4.pkg35.pkg285 import m8624
+import pkg6.pkg52.m51
+from pkg1.pkg9.pkg80 import m2164
+import pkg7.m6
+from . import m7340
+import pkg3.pkg28.pkg232.m3984
+
+
+def helper_9425_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9425_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9425_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9425_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
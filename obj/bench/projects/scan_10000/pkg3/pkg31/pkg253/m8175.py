@@ -0,0 +1,10 @@
+"""Module 8175."""
+import pkg3.pkg30.pkg248.m2332
+from pkg2.pkg17 import m7105
+
+
+def helper_8175_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
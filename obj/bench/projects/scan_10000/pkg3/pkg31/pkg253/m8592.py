@@ -0,0 +1,69 @@
+"""Module 8592."""
+import pkg5.pkg47.pkg379.m1212
+from pkg1.pkg13.pkg108 import m524
+import pkg4.pkg34.pkg279.m2363
+from pkg2.pkg20.pkg165 import m3917
+import pkg3.pkg29.m7534
+from pkg1.pkg11.pkg91 import m5928
+import pkg1.pkg10.pkg81.m80
+from pkg4.pkg33.pkg266 import m265
+import pkg4.pkg33.pkg272.m2356
+from pkg5.pkg42.pkg340 import m339
+import pkg2.pkg21.pkg169.m1419
+from pkg2.pkg22 import m21
+
+
+def helper_8592_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8592_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8592_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8592_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_8592_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_8592_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8592_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8592_42(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
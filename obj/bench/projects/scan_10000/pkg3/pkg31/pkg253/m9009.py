@@ -0,0 +1,46 @@
+"""Module 9009."""
+import pkg4.pkg36.m35
+from . import m4005
+import pkg3.pkg32.pkg257.m1090
+from pkg5.pkg46.pkg375 import m6629
+import pkg4.pkg33.m32
+from pkg2.pkg17.pkg144 import m1394
+from . import m2754
+from . import m3588
+import pkg4.pkg34.pkg276.m8615
+from pkg4.pkg38.pkg308 import m5728
+
+
+def helper_9009_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9009_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9009_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9009_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_9009_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
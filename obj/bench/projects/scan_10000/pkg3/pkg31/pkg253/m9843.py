@@ -0,0 +1,33 @@
+"""Module 9843."""
+import pkg3.pkg29.pkg240.m3158
+from pkg1.pkg15.pkg126 import m1793
+import pkg8.pkg68.m5488
+from . import m8592
+from . import m2337
+from . import m3588
+import pkg3.pkg28.pkg231.m2732
+from pkg1.pkg11.pkg92 import m1342
+import pkg4.pkg38.pkg305.m9478
+from pkg2.pkg19.pkg154 import m153
+import pkg5.pkg48.m47
+
+
+def helper_9843_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9843_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9843_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
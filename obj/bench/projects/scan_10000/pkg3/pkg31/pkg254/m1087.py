@@ -0,0 +1,12 @@
+"""Module 1087."""
+from . import m670
+from pkg2.pkg17 import m16
+import pkg3.pkg28.pkg230.m229
+from pkg1 import m0
+
+
+def helper_1087_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,24 @@
+"""Module 1921."""
+import pkg2.pkg18.pkg148.m147
+from pkg2.pkg19.pkg155 import m154
+import pkg4.pkg37.pkg298.m714
+from pkg2.pkg20.pkg162 import m1829
+import pkg8.pkg69.m485
+from pkg2.pkg18.pkg146 import m145
+import pkg3.pkg31.pkg255.m671
+from . import m1087
+from . import m1504
+
+
+def helper_1921_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1921_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
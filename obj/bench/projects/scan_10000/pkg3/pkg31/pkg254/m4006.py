@@ -0,0 +1,29 @@
+"""Module 4006."""
+from . import m1087
+from . import m3172
+import pkg3.pkg26.pkg213.m1880
+from pkg1.pkg10 import m9
+from . import m670
+from pkg1.pkg13 import m12
+import pkg1.pkg15.pkg123.m122
+
+
+def helper_4006_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4006_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4006_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,28 @@
+"""Module 8176."""
+import pkg4.pkg38.m454
+from . import m253
+import pkg1.pkg16.pkg134.m3886
+from . import m1087
+import pkg3.pkg25.pkg206.m205
+from pkg2.pkg17.pkg139 import m138
+
+
+def helper_8176_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8176_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8176_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,21 @@
+"""Module 671."""
+import pkg1.pkg13.m12
+from . import m254
+import pkg1.m0
+from pkg3.pkg25.pkg204 import m203
+import pkg4.pkg33.pkg269.m268
+from pkg2.pkg19 import m18
+
+
+def helper_671_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_671_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,28 @@
+"""Module 7760."""
+import pkg2.pkg21.pkg171.m2255
+from pkg5.pkg46.pkg369 import m2870
+import pkg1.m0
+from . import m671
+import pkg1.pkg9.pkg74.m5077
+from . import m1505
+
+
+def helper_7760_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7760_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7760_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 9428."""
+import pkg7.pkg57.m3809
+from pkg1.pkg13.pkg111 import m4280
+import pkg6.pkg53.m8392
+from pkg2.pkg22 import m21
+import pkg1.m0
+from pkg3.pkg25.pkg207 import m1040
+import pkg2.pkg19.pkg153.m4739
+from pkg5.pkg44.pkg356 import m5776
+from . import m254
+from pkg2.pkg20.pkg163 import m2664
+from . import m5675
+from pkg5.pkg45 import m461
+
+
+def helper_9428_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9428_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
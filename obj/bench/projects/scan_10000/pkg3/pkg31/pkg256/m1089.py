@@ -0,0 +1,22 @@
+"""Module 1089."""
+import pkg1.pkg16.pkg131.m130
+from pkg7.pkg63 import m62
+import pkg3.pkg31.pkg249.m1082
+from pkg2.pkg17 import m16
+from . import m672
+from pkg5.pkg42.pkg341 import m340
+import pkg3.pkg27.pkg219.m218
+
+
+def helper_1089_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1089_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,30 @@
+"""Module 4008."""
+from . import m2340
+from pkg3.pkg27.pkg222 import m221
+import pkg4.pkg37.pkg297.m296
+from pkg8.pkg65 import m898
+from . import m3591
+from pkg2.pkg20.pkg161 import m160
+import pkg1.pkg11.pkg89.m1339
+from pkg4.pkg38.pkg311 import m1144
+
+
+def helper_4008_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4008_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4008_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
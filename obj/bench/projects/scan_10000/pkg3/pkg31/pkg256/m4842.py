@@ -0,0 +1,24 @@
+"""Module 4842."""
+import pkg1.m0
+from pkg3.pkg26 import m25
+import pkg6.pkg50.pkg403.m402
+from pkg3.pkg28.pkg232 import m4401
+from . import m1923
+from pkg3.pkg28.pkg226 import m642
+import pkg6.pkg51.m884
+from pkg3.pkg32.pkg257 import m4009
+import pkg5.pkg46.pkg373.m1206
+
+
+def helper_4842_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4842_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 5676."""
+from . import m3174
+from pkg5.pkg45.pkg363 import m1196
+import pkg5.pkg47.pkg377.m1627
+from pkg4.pkg39.pkg320 import m3655
+
+
+def helper_5676_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5676_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
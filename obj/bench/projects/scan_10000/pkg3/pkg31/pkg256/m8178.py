@@ -0,0 +1,3 @@
+"""Module 8178."""
+import pkg5.pkg41.pkg333.m2000
+from pkg6.pkg49.pkg399 import m4151
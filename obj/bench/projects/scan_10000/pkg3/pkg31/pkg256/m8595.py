@@ -0,0 +1,53 @@
+"""Module 8595."""
+import pkg4.pkg35.m5872
+from . import m7344
+import pkg1.m0
+from . import m255
+import pkg6.pkg51.pkg414.m3749
+from pkg2.pkg21.pkg172 import m171
+import pkg5.pkg43.pkg345.m2846
+from pkg2.pkg23.pkg191 import m3109
+from . import m5676
+from pkg1.pkg14.pkg120 import m1787
+
+
+def helper_8595_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8595_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8595_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8595_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_8595_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_8595_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,23 @@
+"""Module 1699."""
+import pkg7.m6
+from pkg4.pkg38.pkg311 import m310
+import pkg2.pkg23.pkg189.m188
+from . import m448
+import pkg4.pkg37.pkg299.m1549
+from pkg4.pkg40.pkg321 import m320
+from . import m865
+from pkg4.pkg39 import m38
+
+
+def helper_1699_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1699_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,52 @@
+"""Module 2116."""
+import pkg2.pkg23.pkg187.m186
+from . import m1282
+import pkg1.m0
+from pkg1.pkg13.pkg108 import m524
+import pkg1.pkg14.pkg118.m534
+from pkg2.pkg20.pkg161 import m160
+import pkg1.pkg13.pkg108.m107
+from pkg2.pkg19.pkg154 import m570
+import pkg1.pkg13.pkg107.m940
+
+
+def helper_2116_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2116_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2116_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2116_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_2116_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_2116_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
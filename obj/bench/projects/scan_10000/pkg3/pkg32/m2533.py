@@ -0,0 +1,18 @@
+"""Module 2533."""
+from . import m1282
+from pkg4.pkg39.pkg318 import m317
+from . import m448
+from pkg4.pkg36.pkg295 import m294
+import pkg1.pkg14.m13
+from . import m2116
+import pkg6.pkg52.m2136
+from pkg2.pkg18.pkg149 import m565
+import pkg2.pkg17.m433
+from pkg5.pkg44.pkg355 import m1605
+
+
+def helper_2533_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
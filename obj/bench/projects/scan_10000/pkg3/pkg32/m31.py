@@ -0,0 +1,22 @@
+"""Module 31."""
+import pkg2.pkg21.m20
+from pkg1 import m0
+import pkg1.pkg10.m9
+from pkg2.pkg24 import m23
+import pkg5.m4
+from pkg7 import m6
+import pkg2.m1
+
+
+def helper_31_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_31_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,40 @@
+"""Module 5452."""
+import pkg1.pkg13.m12
+from pkg1 import m0
+import pkg1.pkg12.pkg101.m100
+from pkg4.pkg39.pkg317 import m2818
+import pkg2.pkg20.pkg161.m2245
+from pkg4.pkg35.pkg282 import m698
+from . import m2533
+from pkg2 import m1
+from . import m2116
+from pkg6.pkg51.pkg412 import m828
+import pkg2.pkg17.pkg142.m1392
+
+
+def helper_5452_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5452_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5452_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5452_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 6703."""
+import pkg2.pkg23.m22
+from pkg2.pkg21.pkg174 import m5594
+
+
+def helper_6703_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6703_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,23 @@
+"""Module 1924."""
+from . import m256
+from pkg2.pkg21.pkg172 import m1005
+import pkg2.m1
+from pkg2.pkg17 import m16
+import pkg4.pkg33.pkg271.m270
+from pkg1.pkg13.pkg111 import m944
+import pkg2.pkg24.m23
+from pkg2.pkg24 import m1691
+
+
+def helper_1924_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1924_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 2758."""
+import pkg3.pkg30.pkg241.m240
+from pkg2 import m1
+import pkg1.pkg13.m12
+from pkg8 import m7
+import pkg7.pkg64.m63
+from pkg1.pkg15 import m14
+import pkg1.pkg9.pkg75.m74
+from pkg3.pkg28.pkg232 import m648
+import pkg1.pkg11.pkg92.m91
+from pkg4.pkg38 import m37
+import pkg4.pkg39.m38
+
+
+def helper_2758_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
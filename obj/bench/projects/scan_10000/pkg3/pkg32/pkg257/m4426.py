@@ -0,0 +1,36 @@
+"""Module 4426."""
+import pkg2.pkg21.pkg170.m4339
+from pkg2.pkg19.pkg158 import m991
+from . import m1507
+from pkg2.pkg18 import m17
+import pkg1.m0
+from . import m1090
+import pkg1.pkg11.pkg95.m94
+
+
+def helper_4426_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4426_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4426_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4426_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,24 @@
+"""Module 5260."""
+import pkg4.pkg40.m39
+from . import m3592
+from . import m4843
+from pkg2.pkg24 import m2108
+import pkg2.pkg23.pkg186.m4355
+from pkg6.pkg49.pkg396 import m395
+import pkg2.pkg24.pkg198.m2282
+from . import m1507
+import pkg2.pkg21.pkg173.m3925
+
+
+def helper_5260_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5260_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,39 @@
+"""Module 6094."""
+import pkg1.pkg12.m11
+from pkg5.pkg43 import m42
+import pkg4.pkg33.pkg266.m3184
+from pkg4.pkg35.pkg283 import m699
+import pkg2.pkg24.pkg200.m6037
+from pkg1.pkg11.pkg91 import m924
+import pkg7.m423
+from pkg5.pkg48.pkg390 import m389
+from . import m1090
+from pkg6.pkg50 import m49
+
+
+def helper_6094_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6094_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6094_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6094_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 6511."""
+import pkg3.pkg27.pkg220.m219
+from pkg1.pkg15.pkg124 import m123
+from . import m1090
+from pkg6.pkg54 import m53
+import pkg8.pkg68.m1735
+from pkg8.pkg69 import m4655
+import pkg5.pkg48.pkg386.m5389
+from pkg3.pkg27.pkg223 import m1890
+import pkg1.pkg12.pkg101.m4687
+from pkg5.pkg47.pkg382 import m1215
+import pkg3.m4172
+
+
+def helper_6511_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 9430."""
+import pkg1.pkg15.m6686
+from pkg5 import m5425
+import pkg5.pkg45.pkg362.m2863
+from . import m7762
+import pkg1.pkg14.pkg118.m117
+from pkg2.pkg18 import m17
+import pkg2.pkg24.m857
+from pkg5.pkg46.pkg369 import m2036
+from . import m4009
+from pkg3.pkg31 import m1281
+
+
+def helper_9430_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9430_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
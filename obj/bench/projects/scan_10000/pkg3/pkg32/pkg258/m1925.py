@@ -0,0 +1,31 @@
+"""Module 1925."""
+import pkg3.pkg31.m30
+from pkg1.pkg9.pkg73 import m72
+import pkg3.pkg26.pkg216.m215
+from pkg1 import m0
+import pkg6.pkg49.m48
+from pkg1.pkg9.pkg78 import m1745
+import pkg2.pkg18.pkg152.m568
+from . import m674
+import pkg1.pkg9.pkg76.m75
+
+
+def helper_1925_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1925_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1925_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,39 @@
+"""Module 2342."""
+import pkg8.pkg71.m487
+from pkg1.pkg13.pkg108 import m107
+import pkg2.pkg17.pkg143.m142
+from pkg1.pkg10 import m9
+from . import m1925
+from . import m674
+from . import m1508
+from pkg4.pkg36.pkg293 import m709
+import pkg3.pkg28.pkg225.m224
+from pkg2.pkg23.pkg191 import m190
+
+
+def helper_2342_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2342_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2342_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2342_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 257."""
+import pkg7.m6
+from pkg1.pkg10.pkg85 import m84
+import pkg1.m0
+from pkg2 import m1
+import pkg7.pkg63.m62
+
+
+def helper_257_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_257_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
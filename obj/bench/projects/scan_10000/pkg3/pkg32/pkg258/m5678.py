@@ -0,0 +1,39 @@
+"""Module 5678."""
+import pkg1.pkg13.m1263
+from pkg1 import m0
+from . import m4427
+from pkg5.pkg48.pkg389 import m388
+import pkg1.pkg9.pkg76.m2160
+from . import m674
+import pkg5.pkg46.m1296
+from pkg7 import m5427
+import pkg2.pkg24.pkg194.m193
+from pkg6 import m4592
+
+
+def helper_5678_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5678_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5678_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5678_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
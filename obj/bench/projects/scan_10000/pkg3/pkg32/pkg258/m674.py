@@ -0,0 +1,16 @@
+"""Module 674."""
+import pkg2.pkg23.pkg185.m184
+from pkg2.pkg21 import m20
+import pkg1.pkg15.m14
+from pkg3.pkg25.pkg201 import m200
+from . import m257
+from pkg8 import m7
+import pkg5.pkg46.pkg373.m372
+from pkg5.pkg45 import m44
+
+
+def helper_674_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
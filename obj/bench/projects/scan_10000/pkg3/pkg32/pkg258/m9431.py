@@ -0,0 +1,18 @@
+"""Module 9431."""
+import pkg3.pkg26.pkg213.m629
+from pkg2.pkg18 import m2102
+import pkg6.pkg51.pkg414.m5834
+from pkg3.pkg32.pkg263 import m679
+import pkg8.pkg67.m66
+from pkg4.pkg35.pkg281 import m697
+from . import m6095
+from pkg3 import m2
+import pkg4.pkg36.pkg290.m6544
+from pkg4.pkg39 import m38
+
+
+def helper_9431_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 1926."""
+import pkg5.pkg44.pkg353.m769
+from pkg1 import m0
+import pkg8.m7
+from . import m675
+import pkg3.pkg30.pkg242.m241
+
+
+def helper_1926_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1926_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,28 @@
+"""Module 4845."""
+from . import m2760
+from . import m1092
+import pkg4.pkg33.pkg270.m269
+from pkg4.pkg40.pkg326 import m325
+import pkg2.pkg18.pkg151.m1818
+from pkg6.pkg53 import m4222
+
+
+def helper_4845_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4845_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4845_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
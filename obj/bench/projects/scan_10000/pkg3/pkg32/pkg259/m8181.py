@@ -0,0 +1,37 @@
+"""Module 8181."""
+import pkg2.pkg19.pkg160.m576
+from . import m2343
+from . import m258
+from pkg6.pkg50.pkg408 import m4577
+import pkg2.pkg20.pkg164.m580
+from pkg4.pkg34.pkg279 import m278
+from . import m4845
+from pkg2.pkg18.pkg149 import m565
+
+
+def helper_8181_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8181_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8181_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8181_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,23 @@
+"""Module 9432."""
+import pkg5.pkg44.pkg353.m352
+from pkg1.pkg16.pkg130 import m546
+from . import m6096
+from . import m3177
+import pkg4.pkg38.pkg308.m6979
+from . import m2760
+import pkg7.pkg58.m57
+from pkg4.pkg35.pkg286 import m2787
+
+
+def helper_9432_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9432_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
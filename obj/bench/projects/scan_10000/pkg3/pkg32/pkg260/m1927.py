@@ -0,0 +1,20 @@
+"""Module 1927."""
+import pkg1.pkg12.pkg99.m1766
+from pkg3.pkg32.pkg262 import m261
+import pkg2.pkg21.pkg173.m1006
+from pkg1 import m0
+import pkg2.pkg22.m21
+
+
+def helper_1927_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1927_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
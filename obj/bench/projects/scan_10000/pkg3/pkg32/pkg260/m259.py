@@ -0,0 +1,15 @@
+"""Module 259."""
+import pkg1.pkg14.m13
+from pkg1 import m0
+import pkg2.pkg21.pkg174.m173
+from pkg1.pkg9 import m8
+import pkg2.pkg18.pkg152.m151
+from pkg4 import m3
+import pkg6.pkg52.m51
+
+
+def helper_259_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
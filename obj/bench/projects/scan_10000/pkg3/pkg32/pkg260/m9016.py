@@ -0,0 +1,32 @@
+"""Module 9016."""
+import pkg3.pkg26.m3778
+from pkg1 import m2502
+import pkg5.pkg46.pkg372.m788
+from pkg1.pkg10 import m1677
+import pkg2.pkg24.pkg200.m616
+from pkg4.pkg37.pkg297 import m1130
+from . import m4846
+from pkg5.pkg44.pkg356 import m7027
+import pkg4.pkg33.pkg267.m1934
+from pkg3.pkg32.pkg259 import m258
+
+
+def helper_9016_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9016_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9016_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 2345."""
+import pkg2.pkg22.m1272
+from . import m260
+import pkg3.pkg29.pkg236.m1069
+from pkg4.pkg37.pkg297 import m296
+import pkg1.pkg14.m13
+from pkg1.pkg13.pkg110 import m526
+import pkg6.pkg55.m54
+from . import m1094
+import pkg5.pkg45.pkg362.m1612
+from pkg5.pkg44.pkg356 import m2023
+import pkg8.pkg65.m1732
+from pkg1 import m0
+
+
+def helper_2345_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2345_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
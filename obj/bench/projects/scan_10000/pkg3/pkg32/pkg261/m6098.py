@@ -0,0 +1,19 @@
+"""Module 6098."""
+import pkg4.pkg38.pkg310.m309
+from pkg1.pkg11.pkg92 import m91
+import pkg1.pkg16.pkg132.m548
+from pkg4 import m3
+from . import m2345
+from . import m4430
+import pkg1.pkg15.pkg122.m2206
+from pkg8.pkg72 import m71
+import pkg4.pkg35.pkg283.m1950
+from pkg2.pkg20.pkg162 import m2246
+import pkg2.pkg24.pkg200.m199
+
+
+def helper_6098_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,15 @@
+"""Module 6515."""
+from . import m4013
+from pkg1.pkg9.pkg76 import m4245
+import pkg3.pkg31.pkg256.m1089
+from pkg3.pkg29 import m445
+import pkg5.pkg43.pkg352.m1185
+from pkg4.pkg33.pkg269 import m6106
+import pkg1.pkg10.m9
+
+
+def helper_6515_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,31 @@
+"""Module 8600."""
+import pkg4.pkg33.pkg272.m3190
+from pkg5.pkg43.pkg349 import m2433
+import pkg6.m5
+from pkg4.pkg36.pkg289 import m2790
+import pkg2.pkg24.pkg195.m1028
+from pkg4.pkg34.pkg277 import m276
+import pkg3.pkg30.pkg245.m1495
+from pkg3.pkg26.pkg209 import m7297
+import pkg1.pkg16.pkg135.m2219
+
+
+def helper_8600_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8600_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8600_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,16 @@
+"""Module 9434."""
+from . import m1094
+from pkg3.pkg30 import m446
+import pkg5.pkg43.m42
+from pkg4.pkg33.pkg269 import m268
+from . import m5264
+from . import m7349
+from . import m4847
+from pkg5.pkg47.pkg380 import m4132
+
+
+def helper_9434_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 1929."""
+import pkg1.pkg16.m15
+from pkg5.pkg47.pkg377 import m793
+import pkg4.pkg38.pkg306.m1139
+from pkg1.pkg11.pkg96 import m929
+import pkg5.m4
+
+
+def helper_1929_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1929_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
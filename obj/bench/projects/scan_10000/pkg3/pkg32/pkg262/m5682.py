@@ -0,0 +1,29 @@
+"""Module 5682."""
+from . import m2763
+from pkg4 import m3
+import pkg2.pkg22.pkg182.m1849
+from pkg1.pkg9.pkg75 import m491
+import pkg1.m0
+from pkg7.pkg63 import m1730
+import pkg1.pkg13.pkg109.m108
+
+
+def helper_5682_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5682_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5682_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,12 @@
+"""Module 7350."""
+import pkg5.m4
+from . import m6099
+import pkg5.pkg45.pkg361.m5781
+from pkg2.pkg18.pkg150 import m566
+
+
+def helper_7350_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
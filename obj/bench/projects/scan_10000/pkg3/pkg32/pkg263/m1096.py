@@ -0,0 +1,26 @@
+"""Module 1096."""
+import pkg3.pkg26.pkg213.m1046
+from pkg4 import m3
+import pkg1.pkg16.m15
+from pkg1.pkg9 import m8
+import pkg3.pkg27.pkg223.m222
+from pkg8.pkg67 import m66
+import pkg3.pkg28.pkg229.m228
+from pkg4.pkg36.pkg296 import m712
+import pkg2.pkg21.pkg173.m589
+from pkg3.pkg26.pkg214 import m213
+import pkg3.pkg25.pkg208.m624
+
+
+def helper_1096_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1096_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,15 @@
+"""Module 3181."""
+import pkg5.pkg43.pkg347.m1180
+from pkg4 import m3
+import pkg1.m1668
+from . import m1930
+from . import m679
+from . import m1096
+import pkg3.pkg27.pkg219.m2303
+
+
+def helper_3181_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
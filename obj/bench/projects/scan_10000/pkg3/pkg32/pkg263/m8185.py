@@ -0,0 +1,26 @@
+"""Module 8185."""
+import pkg1.pkg11.pkg95.m94
+from pkg7 import m1257
+import pkg3.pkg30.m3365
+from pkg3 import m2
+import pkg3.pkg32.m31
+from . import m1096
+import pkg2.pkg20.pkg165.m164
+from pkg7.pkg62 import m2563
+import pkg1.pkg15.pkg125.m124
+from pkg4.pkg35.pkg288 import m2789
+from . import m5266
+
+
+def helper_8185_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8185_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
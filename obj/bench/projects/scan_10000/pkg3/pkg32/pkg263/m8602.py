@@ -0,0 +1,46 @@
+"""Module 8602."""
+from . import m6100
+from pkg7.pkg63 import m2147
+import pkg2.pkg21.pkg169.m5172
+from pkg5.pkg41 import m40
+import pkg4.pkg39.m38
+from pkg3.pkg32.pkg257 import m1090
+import pkg3.pkg30.pkg247.m1914
+from pkg2.pkg21.pkg176 import m3511
+import pkg1.pkg13.pkg111.m944
+from pkg8.pkg67 import m483
+
+
+def helper_8602_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8602_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8602_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8602_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_8602_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,14 @@
+"""Module 9853."""
+import pkg5.pkg42.pkg340.m4509
+from pkg2.pkg17.pkg143 import m3061
+import pkg3.pkg31.pkg254.m253
+from pkg5.pkg42 import m458
+import pkg4.pkg37.pkg301.m7389
+from . import m1930
+
+
+def helper_9853_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,34 @@
+"""Module 1514."""
+import pkg3.pkg30.pkg241.m1074
+from pkg1 import m0
+import pkg3.pkg30.pkg247.m246
+from pkg3.pkg26 import m442
+import pkg2.pkg24.pkg198.m197
+from pkg3.pkg30 import m29
+from . import m680
+from pkg1.pkg13.pkg112 import m945
+import pkg5.pkg42.pkg342.m1175
+from pkg3.pkg30.pkg242 import m658
+import pkg6.m5
+from . import m1097
+
+
+def helper_1514_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1514_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1514_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,12 @@
+"""Module 5684."""
+import pkg1.pkg12.pkg102.m935
+from pkg2.pkg20.pkg161 import m1828
+from . import m2348
+from pkg5.pkg45 import m44
+
+
+def helper_5684_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,52 @@
+"""Module 6518."""
+import pkg6.pkg50.pkg404.m2071
+from pkg2.pkg23.pkg189 import m188
+import pkg5.m4
+from pkg5.pkg42.pkg343 import m759
+import pkg1.pkg15.pkg125.m1792
+from pkg5.pkg44 import m43
+import pkg2.pkg18.pkg151.m984
+from pkg2.pkg19.pkg160 import m3078
+import pkg6.pkg53.m52
+
+
+def helper_6518_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6518_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6518_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6518_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_6518_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_6518_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,37 @@
+"""Module 680."""
+import pkg3.pkg29.pkg239.m238
+from pkg1.pkg9.pkg75 import m74
+import pkg5.pkg48.m47
+from pkg1 import m0
+import pkg6.pkg52.m51
+from pkg3.pkg27.pkg222 import m638
+import pkg1.pkg16.m15
+from pkg5.pkg42.pkg341 import m340
+
+
+def helper_680_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_680_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_680_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_680_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
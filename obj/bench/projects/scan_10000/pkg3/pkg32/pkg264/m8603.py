@@ -0,0 +1,46 @@
+"""Module 8603."""
+import pkg2.pkg17.pkg141.m4727
+from . import m4433
+import pkg5.pkg46.pkg370.m1620
+from . import m263
+import pkg5.pkg41.pkg335.m2836
+from pkg3.pkg30.pkg245 import m3163
+import pkg6.pkg51.m50
+from pkg3.pkg25.pkg202 import m201
+import pkg6.pkg50.pkg407.m6661
+from pkg5.pkg45.pkg361 import m3279
+
+
+def helper_8603_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8603_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8603_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8603_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_8603_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,55 @@
+"""Module 9020."""
+import pkg3.pkg25.pkg207.m206
+from . import m6518
+import pkg2.pkg18.pkg148.m981
+from pkg3 import m2
+import pkg7.m6
+from pkg2.pkg22.pkg178 import m4347
+import pkg3.pkg31.pkg255.m254
+from pkg5.pkg42.pkg341 import m4510
+import pkg5.m4
+from pkg5.pkg42.pkg344 import m3262
+import pkg6.pkg50.pkg403.m3321
+from pkg2.pkg17.pkg139 import m555
+
+
+def helper_9020_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9020_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9020_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9020_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_9020_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_9020_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,12 @@
+"""Module 1671."""
+import pkg4.pkg40.pkg324.m740
+from pkg4.pkg37.pkg302 import m301
+import pkg4.pkg40.pkg325.m1158
+from pkg2.pkg22.pkg182 import m1015
+
+
+def helper_1671_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
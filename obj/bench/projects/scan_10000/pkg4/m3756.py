@@ -0,0 +1,10 @@
+"""Module 3756."""
+import pkg5.pkg45.pkg368.m367
+from . import m3339
+import pkg3.pkg27.m26
+from . import m2505
+import pkg2.pkg19.pkg157.m1824
+from pkg4.pkg33 import m1283
+from . import m2088
+from pkg4.pkg38.pkg308 import m2392
+import pkg3.pkg25.pkg201.m1034
@@ -0,0 +1,62 @@
+"""Module 4173."""
+from . import m2088
+from pkg6.pkg49.pkg399 import m3734
+import pkg1.pkg10.pkg81.m80
+from pkg2.pkg22.pkg184 import m600
+import pkg1.pkg11.pkg91.m3843
+from pkg3.pkg32 import m31
+import pkg5.pkg48.pkg392.m1642
+from pkg2.pkg21.pkg171 import m2255
+from . import m2505
+from pkg1 import m0
+from . import m3756
+from pkg3.pkg26.pkg210 import m626
+
+
+def helper_4173_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4173_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4173_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4173_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_4173_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_4173_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4173_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
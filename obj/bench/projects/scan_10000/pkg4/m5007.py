@@ -0,0 +1,28 @@
+"""Module 5007."""
+import pkg5.pkg44.pkg358.m774
+from pkg1.pkg14 import m13
+import pkg4.pkg38.pkg311.m310
+from pkg2.pkg17.pkg139 import m4725
+import pkg2.pkg24.pkg196.m4365
+from pkg2.pkg19.pkg158 import m157
+
+
+def helper_5007_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5007_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5007_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,43 @@
+"""Module 7926."""
+import pkg2.pkg23.pkg188.m187
+from pkg6.pkg49.pkg398 import m3733
+from . import m6675
+from pkg1.pkg16 import m15
+import pkg3.pkg30.pkg246.m245
+from pkg4.pkg33.pkg266 import m1933
+import pkg4.pkg40.pkg323.m1990
+
+
+def helper_7926_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7926_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7926_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7926_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_7926_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
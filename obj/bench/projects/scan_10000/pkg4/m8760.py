@@ -0,0 +1,21 @@
+"""Module 8760."""
+import pkg2.pkg20.pkg163.m996
+from pkg3.pkg32.pkg261 import m3179
+import pkg2.pkg20.pkg165.m164
+from pkg3.pkg25.pkg204 import m1454
+from . import m7509
+from pkg8 import m7
+
+
+def helper_8760_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8760_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
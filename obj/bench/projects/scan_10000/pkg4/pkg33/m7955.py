@@ -0,0 +1,26 @@
+"""Module 7955."""
+import pkg5.pkg47.pkg381.m6218
+from pkg1 import m0
+from . import m5036
+from pkg5.pkg45.pkg362 import m2446
+
+
+def helper_7955_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7955_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7955_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 8789."""
+from . import m2534
+from pkg4 import m3
+import pkg6.pkg56.m55
+from pkg3 import m2
+import pkg7.pkg59.m7564
+from pkg2.pkg20 import m19
+import pkg2.pkg21.pkg174.m590
+from pkg5.pkg41.pkg330 import m8669
+import pkg1.pkg13.pkg108.m1775
+from pkg1.pkg9 import m8
+import pkg6.pkg50.pkg403.m5823
+
+
+def helper_8789_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,47 @@
+"""Module 8604."""
+from . import m7770
+from pkg5.pkg42.pkg341 import m757
+import pkg2.pkg22.pkg184.m183
+from pkg1.pkg15.pkg121 import m6792
+import pkg1.m1251
+from pkg1.pkg16.pkg129 import m6383
+import pkg2.pkg21.pkg171.m170
+from pkg3.pkg27.pkg217 import m4803
+import pkg1.pkg9.pkg78.m2162
+from pkg3.pkg32.pkg259 import m1509
+from . import m6102
+
+
+def helper_8604_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8604_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8604_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8604_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_8604_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,21 @@
+"""Module 7354."""
+import pkg4.pkg39.pkg313.m312
+from pkg4.pkg35.pkg288 import m704
+import pkg1.pkg14.pkg117.m116
+from pkg4.pkg36 import m35
+from . import m265
+from . import m5686
+
+
+def helper_7354_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7354_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
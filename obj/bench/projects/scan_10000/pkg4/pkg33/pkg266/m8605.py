@@ -0,0 +1,27 @@
+"""Module 8605."""
+import pkg2.pkg19.pkg157.m3909
+from pkg1.pkg11.pkg90 import m6761
+import pkg5.pkg43.pkg349.m2016
+from . import m1516
+import pkg3.pkg30.m446
+from pkg6.pkg51.pkg414 import m1247
+import pkg6.pkg50.pkg406.m5826
+from pkg4.pkg35.pkg284 import m700
+import pkg5.m4
+from pkg1.pkg14.pkg116 import m2200
+import pkg5.pkg46.pkg371.m7459
+from pkg3.pkg25.pkg204 import m4790
+
+
+def helper_8605_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8605_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 9856."""
+import pkg2.pkg18.pkg148.m981
+from pkg1.pkg11.pkg93 import m5930
+import pkg1.pkg11.pkg94.m3846
+from pkg2.pkg20.pkg163 import m4749
+import pkg1.pkg11.pkg94.m1761
+from pkg1.pkg10.pkg87 import m920
+import pkg4.pkg35.pkg287.m5290
+from pkg4.pkg33.pkg272 import m6109
+from . import m8605
+from pkg5.pkg45.pkg365 import m7036
+
+
+def helper_9856_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
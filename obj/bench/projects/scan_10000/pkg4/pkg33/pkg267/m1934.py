@@ -0,0 +1,45 @@
+"""Module 1934."""
+import pkg2.pkg17.pkg140.m139
+from pkg2.pkg20.pkg168 import m167
+import pkg2.pkg19.m18
+from pkg1.pkg10 import m9
+import pkg1.pkg15.pkg122.m121
+from pkg5.pkg42.pkg338 import m754
+import pkg4.pkg35.pkg284.m1117
+from pkg3.pkg27.pkg219 import m218
+import pkg5.m4
+
+
+def helper_1934_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1934_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1934_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1934_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_1934_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,24 @@
+"""Module 2351."""
+from . import m266
+from pkg3.pkg25.pkg205 import m204
+import pkg5.pkg41.pkg330.m329
+from pkg1.pkg15.pkg128 import m127
+import pkg5.pkg45.pkg361.m2028
+from . import m1100
+import pkg3.pkg28.pkg226.m642
+from pkg1 import m0
+import pkg2.pkg19.pkg158.m574
+
+
+def helper_2351_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2351_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,12 @@
+"""Module 2768."""
+import pkg5.pkg41.pkg335.m1585
+from . import m1100
+from . import m2351
+from pkg2.pkg20.pkg165 import m164
+
+
+def helper_2768_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,29 @@
+"""Module 5270."""
+import pkg4.pkg40.m2958
+from . import m4436
+from . import m4853
+from pkg1.pkg14.pkg115 import m948
+import pkg1.m0
+from pkg1.pkg14.pkg119 import m118
+import pkg5.pkg45.pkg361.m2862
+
+
+def helper_5270_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5270_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5270_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
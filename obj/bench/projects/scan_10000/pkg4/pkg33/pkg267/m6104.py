@@ -0,0 +1,15 @@
+"""Module 6104."""
+import pkg6.m422
+from pkg8.pkg69 import m902
+import pkg4.pkg39.pkg316.m2817
+from pkg3.pkg25.pkg206 import m205
+import pkg6.pkg50.pkg403.m819
+from pkg1.pkg15.pkg127 import m1794
+import pkg1.pkg9.pkg76.m492
+
+
+def helper_6104_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
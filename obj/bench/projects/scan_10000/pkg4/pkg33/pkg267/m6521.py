@@ -0,0 +1,33 @@
+"""Module 6521."""
+import pkg5.pkg42.pkg344.m5347
+from . import m1517
+import pkg4.pkg34.pkg278.m277
+from pkg1.pkg16.pkg135 import m134
+import pkg1.m0
+from pkg6.pkg51.pkg410 import m4162
+import pkg3.pkg29.pkg238.m5241
+from pkg2.pkg18.pkg152 import m151
+import pkg2.pkg19.pkg157.m156
+from pkg4.pkg33.pkg269 import m3604
+import pkg4.pkg40.pkg325.m741
+
+
+def helper_6521_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6521_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6521_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,48 @@
+"""Module 7355."""
+import pkg2.pkg24.pkg194.m5197
+from pkg1.pkg14.pkg119 import m3871
+import pkg4.pkg38.m37
+from pkg4.pkg39.pkg314 import m3232
+import pkg3.pkg26.pkg209.m7297
+from pkg5.pkg42.pkg340 import m6594
+from . import m266
+from pkg6.pkg49.pkg400 import m399
+import pkg2.pkg23.pkg190.m3942
+from pkg3.pkg32.pkg263 import m3181
+import pkg1.pkg13.pkg106.m105
+from . import m4019
+
+
+def helper_7355_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7355_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7355_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7355_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_7355_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 8189."""
+import pkg2.pkg17.pkg141.m557
+from pkg7.pkg64 import m63
+import pkg1.pkg14.pkg116.m3451
+from pkg2.pkg20.pkg166 import m1416
+from . import m5270
+
+
+def helper_8189_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8189_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8189_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
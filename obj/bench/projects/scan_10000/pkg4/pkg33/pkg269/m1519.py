@@ -0,0 +1,34 @@
+"""Module 1519."""
+import pkg1.pkg15.pkg124.m540
+from pkg1.pkg10.pkg83 import m82
+import pkg6.pkg50.pkg404.m403
+from pkg1.pkg9 import m8
+import pkg5.pkg43.pkg345.m344
+
+
+def helper_1519_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1519_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1519_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1519_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
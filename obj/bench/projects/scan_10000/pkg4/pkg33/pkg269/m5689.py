@@ -0,0 +1,2 @@
+"""Module 5689."""
+import pkg1.pkg9.pkg77.m5080
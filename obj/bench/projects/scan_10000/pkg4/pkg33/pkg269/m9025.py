@@ -0,0 +1,41 @@
+"""Module 9025."""
+import pkg2.pkg19.m18
+from . import m1936
+import pkg4.pkg38.pkg305.m304
+from . import m4438
+import pkg8.pkg71.m70
+from pkg8 import m7
+import pkg4.pkg36.pkg295.m1545
+from pkg1.pkg10.pkg83 import m5086
+from . import m2770
+from . import m3187
+import pkg5.pkg41.pkg331.m6168
+from . import m8191
+
+
+def helper_9025_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9025_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9025_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9025_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
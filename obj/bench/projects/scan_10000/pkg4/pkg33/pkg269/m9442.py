@@ -0,0 +1,13 @@
+"""Module 9442."""
+import pkg3.pkg25.pkg205.m2289
+from pkg2.pkg20.pkg165 import m581
+import pkg7.pkg59.m58
+from pkg4.pkg34.pkg278 import m3196
+import pkg4.pkg38.pkg309.m9065
+
+
+def helper_9442_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
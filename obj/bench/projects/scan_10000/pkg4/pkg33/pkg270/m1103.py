@@ -0,0 +1,11 @@
+"""Module 1103."""
+import pkg2.pkg24.pkg193.m192
+from pkg2.pkg17.pkg144 import m143
+import pkg3.pkg32.pkg260.m259
+
+
+def helper_1103_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
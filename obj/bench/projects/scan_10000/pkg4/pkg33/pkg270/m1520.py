@@ -0,0 +1,32 @@
+"""Module 1520."""
+import pkg5.pkg47.pkg378.m794
+from pkg4.pkg35 import m34
+import pkg1.pkg11.pkg91.m90
+from pkg5.pkg48.pkg386 import m1219
+import pkg2.pkg19.pkg157.m1407
+from pkg3 import m2
+import pkg1.pkg12.pkg98.m1348
+from . import m1103
+import pkg2.pkg24.pkg194.m193
+from pkg1.pkg13 import m12
+
+
+def helper_1520_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1520_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1520_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 1937."""
+import pkg1.pkg11.pkg92.m91
+from pkg3.pkg27.pkg218 import m217
+import pkg2.pkg18.pkg148.m147
+
+
+def helper_1937_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
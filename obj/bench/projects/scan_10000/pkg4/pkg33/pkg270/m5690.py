@@ -0,0 +1,46 @@
+"""Module 5690."""
+import pkg4.pkg37.pkg301.m1551
+from pkg4.pkg36.pkg293 import m2377
+import pkg1.pkg16.pkg129.m128
+from pkg1.pkg15.pkg122 import m2623
+import pkg4.pkg40.pkg326.m2827
+from pkg2.pkg20.pkg164 import m4333
+import pkg1.pkg12.pkg101.m2602
+from pkg6.pkg52 import m51
+import pkg2.pkg17.m16
+from . import m1937
+
+
+def helper_5690_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5690_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5690_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5690_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_5690_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
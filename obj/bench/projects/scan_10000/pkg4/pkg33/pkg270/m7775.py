@@ -0,0 +1,62 @@
+"""Module 7775."""
+import pkg6.pkg51.pkg411.m3329
+from pkg4.pkg35.pkg282 import m2366
+import pkg1.pkg9.pkg76.m75
+from pkg4.pkg35.pkg286 import m5706
+import pkg3.pkg30.pkg243.m6497
+from pkg2.pkg23.pkg187 import m2271
+import pkg8.pkg70.m1320
+from pkg1.pkg10.pkg83 import m7171
+import pkg2.pkg21.pkg175.m1008
+from pkg7.pkg59 import m4228
+import pkg2.pkg19.pkg153.m2654
+from pkg3.pkg26.pkg209 import m208
+
+
+def helper_7775_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7775_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7775_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7775_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_7775_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_7775_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7775_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
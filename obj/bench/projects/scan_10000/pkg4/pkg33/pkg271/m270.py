@@ -0,0 +1,16 @@
+"""Module 270."""
+import pkg1.m0
+from pkg2.pkg22.pkg181 import m180
+import pkg3.pkg29.pkg234.m233
+from pkg3.pkg32.pkg260 import m259
+import pkg1.pkg13.m12
+from pkg1.pkg9 import m8
+import pkg8.pkg71.m70
+from pkg1.pkg10.pkg86 import m85
+
+
+def helper_270_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,40 @@
+"""Module 3606."""
+from . import m270
+from pkg1.pkg11.pkg91 import m90
+import pkg3.m2
+from . import m2772
+import pkg1.pkg16.pkg129.m1796
+from . import m687
+from . import m1521
+from pkg1.pkg13.pkg111 import m2195
+import pkg5.pkg41.pkg331.m330
+from pkg5.pkg43.pkg349 import m2850
+import pkg2.pkg24.pkg197.m613
+
+
+def helper_3606_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3606_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3606_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3606_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,40 @@
+"""Module 9444."""
+import pkg7.pkg61.m60
+from pkg1.pkg11.pkg93 import m92
+import pkg1.pkg10.m9
+from . import m7776
+import pkg2.pkg20.m7525
+from . import m1938
+import pkg5.pkg44.m8800
+from . import m4440
+import pkg4.pkg40.pkg321.m6992
+from pkg1.pkg9.pkg80 import m1747
+import pkg1.pkg14.pkg113.m112
+
+
+def helper_9444_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9444_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9444_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9444_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,45 @@
+"""Module 4441."""
+import pkg2.m1
+from . import m688
+import pkg5.pkg42.pkg343.m342
+from pkg5.pkg46.pkg375 import m791
+import pkg1.pkg12.m11
+from pkg3.pkg32 import m31
+import pkg4.pkg39.pkg320.m736
+from pkg2.pkg20.pkg162 import m161
+from . import m2773
+
+
+def helper_4441_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4441_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4441_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4441_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_4441_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,5 @@
+"""Module 4858."""
+import pkg5.pkg45.pkg365.m2866
+from . import m1522
+import pkg5.pkg45.pkg361.m777
+from pkg6.pkg55 import m1305
@@ -0,0 +1,24 @@
+"""Module 6109."""
+from . import m4024
+from pkg2.pkg24.pkg200 import m4786
+import pkg5.pkg44.pkg355.m5775
+from pkg2.pkg24 import m857
+import pkg3.pkg32.pkg262.m3180
+from pkg5.pkg41.pkg331 import m3249
+import pkg1.pkg13.pkg107.m5110
+from pkg4.pkg39.pkg319 import m4071
+import pkg4.pkg35.pkg285.m4454
+
+
+def helper_6109_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6109_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 7777."""
+import pkg5.pkg48.pkg386.m7474
+from . import m3190
+import pkg4.pkg36.pkg291.m1124
+
+
+def helper_7777_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,5 @@
+"""Module 8194."""
+import pkg2.pkg21.pkg175.m1842
+from pkg2.pkg22.pkg179 import m1429
+from . import m4024
+from pkg2.pkg21.pkg172 import m2673
@@ -0,0 +1,36 @@
+"""Module 9445."""
+import pkg5.pkg48.pkg390.m3308
+from . import m7360
+import pkg2.pkg21.pkg176.m8515
+from pkg1.pkg9.pkg74 import m907
+import pkg4.pkg40.pkg328.m327
+from . import m4024
+from . import m1522
+
+
+def helper_9445_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9445_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9445_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9445_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,16 @@
+"""Module 3786."""
+import pkg2.pkg22.m21
+from pkg1.pkg13 import m12
+from . import m2535
+from pkg2.pkg22.pkg182 import m2683
+from . import m33
+from pkg2.pkg22.pkg177 import m176
+import pkg3.pkg27.pkg218.m634
+from pkg4.pkg39.pkg315 import m1148
+
+
+def helper_3786_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
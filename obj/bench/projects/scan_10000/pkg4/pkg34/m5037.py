@@ -0,0 +1,15 @@
+"""Module 5037."""
+import pkg7.m6
+from pkg1.pkg10.pkg83 import m82
+from . import m3786
+from pkg2.pkg18.pkg150 import m149
+import pkg4.pkg40.pkg321.m3656
+from pkg2.pkg19.pkg159 import m2243
+import pkg1.m0
+
+
+def helper_5037_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
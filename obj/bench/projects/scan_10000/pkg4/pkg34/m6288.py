@@ -0,0 +1,44 @@
+"""Module 6288."""
+import pkg4.pkg37.pkg297.m4049
+from . import m3786
+import pkg2.pkg20.pkg166.m5586
+from pkg1 import m0
+import pkg1.pkg10.pkg83.m2584
+from pkg2.pkg18.pkg149 import m148
+import pkg1.pkg15.pkg124.m123
+from pkg2 import m1
+
+
+def helper_6288_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6288_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6288_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6288_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_6288_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 7956."""
+import pkg2.pkg24.pkg195.m1862
+from pkg1.pkg9.pkg74 import m4660
+import pkg5.pkg42.m4211
+from pkg1 import m0
+from . import m33
+from pkg4.pkg37.pkg297 import m4466
+import pkg1.pkg12.pkg97.m2181
+from pkg2.pkg24.pkg199 import m1032
+import pkg4.pkg40.pkg324.m740
+from pkg6.pkg50.pkg406 import m4575
+
+
+def helper_7956_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7956_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
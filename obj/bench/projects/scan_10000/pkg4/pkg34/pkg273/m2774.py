@@ -0,0 +1,27 @@
+"""Module 2774."""
+import pkg3.pkg28.m27
+from pkg6 import m5
+import pkg3.pkg26.pkg214.m2298
+from pkg1 import m0
+import pkg8.m7
+from . import m689
+from . import m1940
+from pkg2.pkg22.pkg184 import m183
+import pkg1.pkg13.pkg107.m106
+from pkg6.pkg56 import m472
+import pkg1.pkg16.pkg130.m1380
+from pkg8.pkg66 import m65
+
+
+def helper_2774_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2774_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 5276."""
+import pkg1.pkg9.pkg80.m4249
+from . import m272
+
+
+def helper_5276_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5276_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
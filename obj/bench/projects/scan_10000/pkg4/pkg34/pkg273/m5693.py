@@ -0,0 +1,53 @@
+"""Module 5693."""
+import pkg2.pkg17.m2935
+from . import m3191
+import pkg6.m5
+from pkg1.pkg14 import m2932
+import pkg1.pkg12.pkg97.m1764
+from pkg4.pkg37.pkg303 import m302
+import pkg2.pkg24.pkg199.m615
+from . import m2357
+from . import m1523
+from pkg6.pkg51.pkg411 import m5414
+
+
+def helper_5693_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5693_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5693_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5693_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_5693_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_5693_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
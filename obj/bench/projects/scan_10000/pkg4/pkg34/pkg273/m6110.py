@@ -0,0 +1,24 @@
+"""Module 6110."""
+import pkg4.pkg36.pkg293.m3628
+from pkg1.pkg12 import m11
+import pkg5.pkg44.pkg359.m4945
+from . import m1106
+from . import m4442
+from pkg2.pkg21.pkg172 import m2256
+from . import m3191
+from . import m2357
+from . import m4859
+
+
+def helper_6110_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6110_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,16 @@
+"""Module 6944."""
+import pkg1.pkg10.pkg88.m87
+from . import m4025
+from . import m689
+from pkg2.pkg24 import m23
+import pkg1.pkg15.pkg126.m125
+from pkg2.pkg23.pkg185 import m184
+import pkg1.pkg10.pkg86.m2170
+from pkg7 import m2925
+
+
+def helper_6944_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,46 @@
+"""Module 8612."""
+import pkg2.pkg23.pkg188.m6442
+from . import m5693
+import pkg1.pkg16.pkg136.m135
+from pkg1.pkg14.pkg113 import m7618
+import pkg7.pkg61.m477
+from pkg4.pkg38.pkg310 import m4062
+import pkg2.pkg18.pkg149.m565
+from . import m8195
+from . import m272
+from pkg5.pkg41.pkg331 import m1164
+
+
+def helper_8612_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8612_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8612_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8612_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_8612_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 1107."""
+import pkg1.pkg11.pkg95.m94
+from pkg3.pkg31.pkg249 import m1082
+import pkg3.pkg26.pkg212.m211
+from pkg1.pkg9.pkg79 import m78
+import pkg1.pkg13.pkg110.m526
+
+
+def helper_1107_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1107_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
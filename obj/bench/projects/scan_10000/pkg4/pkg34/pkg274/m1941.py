@@ -0,0 +1,34 @@
+"""Module 1941."""
+import pkg6.pkg51.pkg409.m1659
+from . import m273
+import pkg5.pkg47.pkg377.m793
+from pkg6.pkg51.pkg410 import m1243
+import pkg7.pkg57.m56
+from pkg4.pkg39.pkg313 import m729
+import pkg4.pkg39.m872
+from pkg4.pkg40 import m39
+import pkg3.pkg25.pkg205.m1038
+from pkg4.pkg40 import m456
+import pkg1.pkg13.m12
+from pkg4 import m3
+
+
+def helper_1941_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1941_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1941_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,53 @@
+"""Module 3192."""
+import pkg5.pkg45.pkg367.m366
+from pkg1.pkg13.pkg106 import m2607
+import pkg5.pkg47.pkg382.m1215
+from pkg2.pkg17.pkg140 import m1390
+import pkg5.pkg43.pkg352.m1602
+from pkg3.pkg26 import m25
+from . import m2775
+from pkg5.pkg44.pkg357 import m356
+import pkg1.pkg14.pkg120.m119
+from pkg2.pkg24.pkg198 import m197
+
+
+def helper_3192_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3192_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3192_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3192_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_3192_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_3192_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,22 @@
+"""Module 6111."""
+from . import m1107
+from . import m5694
+from . import m1941
+from pkg5.pkg45.pkg365 import m1615
+import pkg6.pkg50.pkg408.m2075
+from pkg1.pkg10 import m9
+import pkg3.pkg27.pkg217.m633
+
+
+def helper_6111_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6111_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,30 @@
+"""Module 6528."""
+import pkg5.pkg42.pkg344.m1594
+from pkg6.pkg50.pkg406 import m405
+import pkg1.pkg11.pkg91.m90
+from pkg3.pkg26 import m25
+import pkg6.pkg50.m49
+from pkg1.pkg14 import m13
+import pkg4.pkg39.pkg314.m2815
+from pkg3.pkg30 import m446
+
+
+def helper_6528_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6528_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6528_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 7362."""
+import pkg1.pkg16.pkg136.m135
+from pkg6.pkg50 import m5470
+
+
+def helper_7362_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7362_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,22 @@
+"""Module 8613."""
+import pkg2.pkg23.pkg189.m1856
+from pkg4.pkg36.pkg290 import m4459
+import pkg3.pkg26.pkg212.m7717
+from pkg1 import m0
+from . import m4026
+from pkg2.pkg23.pkg189 import m188
+import pkg4.pkg35.pkg288.m704
+
+
+def helper_8613_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8613_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 9030."""
+import pkg2.pkg23.pkg185.m1018
+from pkg4.pkg36.pkg292 import m4878
+import pkg3.pkg28.pkg228.m227
+from pkg5.pkg44.pkg353 import m2020
+import pkg4.pkg37.pkg297.m296
+from pkg1 import m0
+import pkg2.pkg23.pkg187.m1854
+from pkg3.pkg27.pkg218 import m217
+import pkg3.pkg30.pkg244.m1077
+from . import m690
+
+
+def helper_9030_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
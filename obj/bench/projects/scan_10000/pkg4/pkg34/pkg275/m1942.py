@@ -0,0 +1,26 @@
+"""Module 1942."""
+import pkg4.pkg37.pkg300.m299
+from pkg3.pkg26.pkg213 import m1046
+import pkg3.pkg27.pkg219.m1469
+from pkg4.pkg36.pkg290 import m289
+
+
+def helper_1942_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1942_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1942_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
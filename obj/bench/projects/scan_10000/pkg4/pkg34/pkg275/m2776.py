@@ -0,0 +1,22 @@
+"""Module 2776."""
+from . import m2359
+from pkg3.pkg32.pkg258 import m674
+import pkg7.pkg59.m58
+from pkg2.pkg23.pkg191 import m190
+from . import m1942
+from pkg2.pkg19 import m1686
+import pkg2.pkg17.pkg140.m973
+
+
+def helper_2776_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2776_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 3193."""
+import pkg8.pkg67.m1734
+from pkg5.pkg42.pkg343 import m342
+import pkg7.pkg61.m1728
+from pkg3.pkg32.pkg264 import m263
+import pkg1.m0
+
+
+def helper_3193_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3193_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3193_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 8614."""
+from . import m274
+from pkg1.pkg11.pkg89 import m505
+import pkg2.pkg18.m5855
+from . import m691
+import pkg5.pkg48.pkg387.m7058
+from pkg4.pkg36.pkg293 import m1960
+from . import m1108
+from pkg6.pkg52 import m468
+import pkg7.pkg58.m1725
+from pkg1.pkg9 import m8
+
+
+def helper_8614_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 9031."""
+import pkg1.m0
+from pkg1.pkg10 import m3345
+import pkg5.pkg41.pkg331.m1998
+
+
+def helper_9031_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9031_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
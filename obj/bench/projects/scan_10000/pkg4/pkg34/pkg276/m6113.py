@@ -0,0 +1,23 @@
+"""Module 6113."""
+import pkg2.pkg19.m18
+from . import m692
+import pkg3.pkg29.m28
+from . import m4445
+import pkg1.pkg11.pkg90.m506
+from pkg4.pkg35.pkg281 import m5284
+import pkg5.pkg45.pkg363.m1196
+from pkg2.pkg23.pkg189 import m188
+
+
+def helper_6113_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6113_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
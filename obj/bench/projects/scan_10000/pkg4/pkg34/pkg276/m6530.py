@@ -0,0 +1,10 @@
+"""Module 6530."""
+from . import m4028
+from . import m1526
+
+
+def helper_6530_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,40 @@
+"""Module 8198."""
+from . import m3194
+from pkg3.pkg26.pkg216 import m215
+import pkg1.m0
+from . import m275
+import pkg3.pkg25.pkg202.m1452
+from pkg1.pkg14.pkg115 import m531
+from . import m5696
+from pkg2.pkg24.pkg200 import m6871
+import pkg3.pkg31.pkg254.m253
+from . import m6947
+import pkg1.pkg14.pkg118.m117
+
+
+def helper_8198_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8198_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8198_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8198_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,31 @@
+"""Module 3195."""
+from . import m1110
+from . import m693
+import pkg1.pkg16.pkg131.m130
+from pkg2.pkg24.pkg196 import m195
+import pkg3.pkg26.pkg216.m632
+from . import m2361
+import pkg1.pkg13.pkg106.m105
+from pkg2.pkg17.pkg141 import m140
+import pkg4.pkg37.pkg302.m301
+
+
+def helper_3195_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3195_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3195_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,54 @@
+"""Module 7782."""
+import pkg2.pkg22.pkg180.m596
+from pkg1 import m0
+import pkg2.m1
+from . import m1110
+from . import m6114
+from pkg4.pkg40.pkg326 import m742
+import pkg6.pkg50.pkg401.m1651
+from pkg1.pkg13.pkg112 import m3447
+import pkg3.pkg29.pkg238.m2322
+from pkg7.pkg59 import m58
+import pkg3.pkg29.pkg240.m239
+
+
+def helper_7782_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7782_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7782_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7782_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_7782_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_7782_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,21 @@
+"""Module 8616."""
+from . import m2361
+from pkg1.pkg16.pkg136 import m7224
+import pkg1.pkg15.pkg128.m1378
+from pkg7.pkg61 import m3396
+import pkg3.pkg31.pkg249.m7337
+from pkg3.pkg32.pkg261 import m677
+
+
+def helper_8616_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8616_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,23 @@
+"""Module 3613."""
+import pkg3.pkg28.pkg231.m1898
+from pkg1.pkg12.pkg104 import m103
+import pkg2.m1
+from pkg4.pkg35.pkg281 import m1531
+import pkg3.pkg29.pkg239.m1072
+from pkg1.pkg11 import m10
+import pkg6.pkg50.pkg405.m2906
+from pkg6.pkg56 import m55
+
+
+def helper_3613_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3613_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,21 @@
+"""Module 4447."""
+import pkg3.pkg25.pkg204.m2288
+from . import m1111
+import pkg5.m4
+from pkg3.pkg29.pkg235 import m4404
+import pkg1.pkg10.pkg85.m501
+from pkg3.pkg31 import m2532
+
+
+def helper_4447_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4447_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
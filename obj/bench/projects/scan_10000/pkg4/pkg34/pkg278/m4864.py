@@ -0,0 +1,53 @@
+"""Module 4864."""
+from . import m4447
+from pkg1.pkg11.pkg93 import m4679
+import pkg3.pkg28.pkg229.m1062
+from pkg1 import m0
+import pkg5.pkg43.m42
+from pkg2.pkg17.pkg138 import m554
+import pkg5.pkg41.pkg333.m4502
+from pkg4.pkg34.pkg279 import m278
+import pkg2.pkg18.pkg145.m3897
+from . import m4030
+
+
+def helper_4864_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4864_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4864_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4864_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_4864_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_4864_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
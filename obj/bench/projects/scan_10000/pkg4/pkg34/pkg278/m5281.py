@@ -0,0 +1,69 @@
+"""Module 5281."""
+import pkg1.pkg12.pkg104.m937
+from pkg2.pkg21.pkg171 import m587
+import pkg3.pkg32.pkg259.m2760
+from pkg7.pkg62 import m61
+import pkg2.pkg19.pkg155.m2239
+from pkg3.pkg26.pkg213 import m4382
+import pkg5.pkg41.pkg334.m333
+from pkg1.pkg11.pkg95 import m94
+import pkg5.pkg43.pkg351.m2435
+from pkg5.pkg45.pkg364 import m780
+import pkg4.pkg36.pkg289.m705
+from pkg1.pkg14 import m2098
+
+
+def helper_5281_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5281_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5281_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5281_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_5281_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_5281_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5281_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5281_42(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
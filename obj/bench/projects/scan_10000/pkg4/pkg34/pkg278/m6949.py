@@ -0,0 +1,26 @@
+"""Module 6949."""
+import pkg2.pkg21.pkg172.m588
+from . import m3613
+from . import m4447
+from pkg3.pkg28.pkg229 import m3981
+import pkg5.pkg45.pkg368.m2035
+from pkg1.pkg12.pkg101 import m100
+from . import m6532
+from pkg1.pkg16.pkg131 import m4300
+from . import m4864
+from pkg4 import m3
+from . import m1111
+
+
+def helper_6949_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6949_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
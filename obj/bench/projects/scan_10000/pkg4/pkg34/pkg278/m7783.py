@@ -0,0 +1,14 @@
+"""Module 7783."""
+import pkg3.pkg30.m29
+from pkg5.pkg45.pkg362 import m2029
+import pkg3.pkg28.pkg225.m224
+from pkg4.pkg35.pkg287 import m1537
+import pkg5.pkg42.pkg339.m3674
+from pkg6.pkg50.pkg404 import m403
+
+
+def helper_7783_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
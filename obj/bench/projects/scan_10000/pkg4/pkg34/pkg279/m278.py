@@ -0,0 +1,26 @@
+"""Module 278."""
+import pkg1.m0
+from pkg3.pkg25.pkg206 import m205
+import pkg3.pkg29.pkg238.m237
+from pkg4 import m3
+
+
+def helper_278_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_278_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_278_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
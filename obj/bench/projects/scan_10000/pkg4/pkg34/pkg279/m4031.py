@@ -0,0 +1,33 @@
+"""Module 4031."""
+import pkg3.pkg29.pkg238.m1071
+from pkg2.pkg22.pkg180 import m179
+import pkg5.pkg47.m46
+from . import m2780
+import pkg1.m0
+from pkg3.pkg27.pkg219 import m218
+from . import m2363
+from pkg3.pkg27.pkg217 import m3135
+from . import m3614
+from pkg1.pkg15.pkg125 import m124
+import pkg1.pkg9.pkg74.m73
+
+
+def helper_4031_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4031_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4031_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,28 @@
+"""Module 6116."""
+from . import m4865
+from pkg6.pkg50.pkg401 import m400
+import pkg1.m0
+from pkg4.pkg34.pkg280 import m5283
+from . import m2363
+from pkg6.pkg49.pkg395 import m2896
+
+
+def helper_6116_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6116_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6116_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,9 @@
+"""Module 6533."""
+import pkg4.pkg34.pkg275.m274
+
+
+def helper_6533_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,16 @@
+"""Module 7784."""
+import pkg8.pkg72.m71
+from pkg5 import m4
+import pkg1.pkg15.pkg121.m4290
+from . import m7367
+import pkg3.pkg25.m24
+from pkg1.pkg9.pkg77 import m76
+import pkg4.pkg37.pkg302.m1135
+from pkg3.pkg28.pkg230 import m2314
+
+
+def helper_7784_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,5 @@
+"""Module 8618."""
+from . import m2363
+from . import m7784
+import pkg7.pkg61.m1311
+from pkg3.pkg28.pkg229 import m6483
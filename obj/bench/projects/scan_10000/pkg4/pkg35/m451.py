@@ -0,0 +1,40 @@
+"""Module 451."""
+import pkg4.m3
+from pkg2.pkg23 import m22
+from . import m34
+from pkg1.pkg16.pkg132 import m131
+import pkg2.pkg20.pkg164.m163
+from pkg3.pkg26.pkg215 import m214
+import pkg1.m0
+from pkg1.pkg13 import m12
+import pkg3.pkg32.pkg263.m262
+from pkg7 import m6
+import pkg2.pkg18.pkg152.m151
+
+
+def helper_451_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_451_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_451_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_451_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
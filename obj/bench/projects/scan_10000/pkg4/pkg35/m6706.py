@@ -0,0 +1,36 @@
+"""Module 6706."""
+import pkg3.pkg31.pkg249.m1499
+from . import m1702
+import pkg1.m0
+from . import m2536
+import pkg4.pkg37.pkg301.m300
+from pkg3.pkg30.pkg242 import m241
+import pkg1.pkg12.m11
+
+
+def helper_6706_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6706_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6706_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6706_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
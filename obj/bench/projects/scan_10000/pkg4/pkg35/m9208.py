@@ -0,0 +1,12 @@
+"""Module 9208."""
+import pkg6.pkg52.m6306
+from pkg2.pkg19.pkg155 import m5992
+import pkg2.pkg18.pkg145.m5982
+from pkg5 import m4
+import pkg2.pkg17.pkg138.m4307
+from pkg3.pkg32 import m4201
+import pkg6.pkg56.m7978
+from pkg2.pkg22.pkg180 import m596
+import pkg2.pkg18.pkg146.m562
+from pkg5.pkg41 import m5461
+import pkg4.pkg40.pkg323.m8245
@@ -0,0 +1,32 @@
+"""Module 1948."""
+import pkg2.pkg23.pkg188.m187
+from pkg6 import m5
+import pkg6.pkg49.pkg393.m392
+from pkg3.pkg32 import m31
+from . import m1114
+from pkg1.pkg12.pkg104 import m103
+import pkg7.pkg57.m56
+from pkg2.pkg24.pkg193 import m609
+import pkg2.pkg23.m22
+from pkg1.pkg9.pkg77 import m76
+
+
+def helper_1948_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1948_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1948_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,9 @@
+"""Module 2782."""
+import pkg4.pkg40.pkg324.m740
+
+
+def helper_2782_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,33 @@
+"""Module 4033."""
+import pkg1.pkg11.pkg90.m506
+from pkg2.pkg18.pkg148 import m1815
+import pkg2.pkg21.pkg170.m1420
+from . import m1948
+import pkg5.pkg46.pkg373.m1206
+from pkg2.pkg19.pkg158 import m574
+from . import m1114
+from pkg8.pkg69 import m2987
+import pkg1.pkg11.m10
+from . import m2782
+import pkg5.pkg42.pkg337.m1587
+
+
+def helper_4033_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4033_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4033_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,38 @@
+"""Module 6952."""
+import pkg2.pkg23.pkg186.m2270
+from pkg4.pkg40 import m39
+import pkg1.pkg13.pkg109.m2193
+from pkg5.pkg47.pkg382 import m381
+import pkg1.pkg14.pkg119.m5956
+from pkg3 import m2
+import pkg5.pkg43.m459
+from pkg1.pkg12.pkg101 import m517
+from . import m4867
+
+
+def helper_6952_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6952_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6952_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6952_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,21 @@
+"""Module 9871."""
+from . import m6952
+from pkg5.pkg48.pkg390 import m2057
+from . import m697
+from pkg4.pkg37.pkg297 import m7802
+import pkg1.pkg16.m5019
+from pkg4.pkg36 import m9626
+
+
+def helper_9871_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9871_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
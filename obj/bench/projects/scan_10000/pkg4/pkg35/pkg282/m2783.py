@@ -0,0 +1,26 @@
+"""Module 2783."""
+import pkg5.pkg41.pkg334.m750
+from pkg5.pkg48.pkg390 import m806
+import pkg2.pkg21.m20
+from pkg3.pkg26.pkg214 import m1464
+from . import m281
+from pkg2.pkg21.pkg173 import m172
+import pkg1.pkg10.pkg87.m86
+from pkg4.pkg39 import m455
+import pkg5.pkg42.pkg337.m336
+from pkg1 import m0
+import pkg2.pkg22.pkg184.m183
+
+
+def helper_2783_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2783_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 3200."""
+import pkg2.pkg19.pkg159.m992
+from pkg4 import m3
+from . import m1949
+from pkg4.pkg37.pkg298 import m714
+import pkg3.pkg29.pkg239.m238
+from pkg5.pkg41.pkg329 import m2413
+import pkg3.pkg31.pkg252.m668
+from pkg3.pkg25.pkg201 import m200
+import pkg2.pkg19.pkg157.m156
+from pkg3.pkg26 import m25
+import pkg7.pkg60.m59
+from pkg6 import m5
+
+
+def helper_3200_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
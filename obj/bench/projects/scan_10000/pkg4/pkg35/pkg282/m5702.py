@@ -0,0 +1,61 @@
+"""Module 5702."""
+import pkg2.m1
+from pkg3.pkg32.pkg260 import m676
+import pkg2.pkg21.m2522
+from pkg7.pkg60 import m4646
+import pkg5.pkg44.pkg357.m773
+from pkg2.pkg20.pkg164 import m163
+import pkg4.pkg37.pkg301.m1551
+from pkg2.pkg20.pkg161 import m4330
+import pkg2.pkg20.pkg162.m3497
+from pkg7.pkg57 import m56
+import pkg3.pkg27.pkg220.m219
+
+
+def helper_5702_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5702_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5702_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5702_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_5702_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_5702_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5702_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
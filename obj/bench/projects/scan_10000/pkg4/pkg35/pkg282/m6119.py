@@ -0,0 +1,21 @@
+"""Module 6119."""
+from . import m5285
+from pkg2.pkg21.pkg174 import m3092
+import pkg4.m420
+from pkg2.pkg17.pkg139 import m5976
+import pkg1.m0
+from pkg1.pkg15.pkg121 import m1788
+
+
+def helper_6119_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6119_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,23 @@
+"""Module 6953."""
+import pkg1.pkg16.pkg132.m131
+from . import m6536
+import pkg3.pkg27.pkg224.m223
+from . import m1115
+import pkg1.m0
+from pkg3.pkg27.pkg219 import m218
+import pkg3.pkg31.m30
+from pkg5.pkg41.pkg330 import m329
+
+
+def helper_6953_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6953_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
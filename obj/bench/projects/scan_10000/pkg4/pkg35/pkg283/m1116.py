@@ -0,0 +1,31 @@
+"""Module 1116."""
+import pkg2.m1
+from pkg2.pkg22.pkg183 import m182
+import pkg3.pkg32.pkg263.m262
+from pkg6.pkg52 import m51
+import pkg1.m0
+from pkg7 import m6
+from . import m282
+from pkg4.pkg39.pkg320 import m319
+import pkg1.pkg13.pkg105.m104
+
+
+def helper_1116_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1116_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1116_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,14 @@
+"""Module 5703."""
+from . import m1533
+from pkg4.pkg37.pkg297 import m296
+import pkg4.m3
+from . import m1950
+from . import m5286
+from pkg2.pkg23 import m4609
+
+
+def helper_5703_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
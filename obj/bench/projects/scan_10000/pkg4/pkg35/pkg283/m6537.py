@@ -0,0 +1,39 @@
+"""Module 6537."""
+import pkg6.pkg54.m470
+from pkg6.pkg50.pkg406 import m405
+import pkg2.pkg21.m5024
+from pkg1.pkg16.pkg132 import m2216
+import pkg3.pkg29.pkg233.m232
+from pkg3.pkg31 import m30
+import pkg4.pkg35.pkg282.m698
+from pkg2.pkg24.pkg194 import m1027
+from . import m5286
+from pkg5.pkg44 import m43
+
+
+def helper_6537_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6537_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6537_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6537_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,30 @@
+"""Module 8205."""
+from . import m4035
+from . import m1116
+from . import m5703
+from pkg3.pkg26.pkg213 import m1880
+import pkg2.pkg21.m437
+from . import m5286
+import pkg5.pkg42.pkg344.m1594
+from pkg5.pkg41 import m2125
+
+
+def helper_8205_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8205_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8205_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,29 @@
+"""Module 1117."""
+import pkg1.pkg9.pkg74.m490
+from pkg6.pkg54 import m53
+import pkg2.pkg23.pkg192.m191
+from . import m700
+import pkg2.pkg24.pkg195.m194
+from pkg5 import m4
+import pkg2.pkg24.pkg193.m609
+
+
+def helper_1117_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1117_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1117_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
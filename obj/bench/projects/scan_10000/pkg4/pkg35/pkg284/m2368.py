@@ -0,0 +1,39 @@
+"""Module 2368."""
+from . import m1117
+from pkg2.pkg19.pkg160 import m2244
+import pkg1.pkg10.pkg85.m84
+from pkg2.pkg23.pkg189 import m188
+import pkg1.pkg12.pkg99.m98
+from . import m283
+import pkg5.pkg44.m1711
+from pkg2.pkg24 import m23
+import pkg6.pkg51.pkg414.m830
+from pkg2.pkg18.pkg149 import m148
+
+
+def helper_2368_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2368_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2368_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2368_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
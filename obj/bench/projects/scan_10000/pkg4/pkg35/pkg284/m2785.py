@@ -0,0 +1,24 @@
+"""Module 2785."""
+import pkg1.pkg10.pkg82.m81
+from pkg6.pkg51 import m50
+from . import m1534
+from . import m2368
+import pkg4.pkg35.pkg282.m1115
+from pkg1.pkg11.pkg92 import m91
+import pkg3.pkg29.pkg239.m1489
+from pkg8.pkg70 import m69
+import pkg5.pkg44.m43
+
+
+def helper_2785_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2785_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
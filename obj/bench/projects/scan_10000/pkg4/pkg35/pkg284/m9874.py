@@ -0,0 +1,12 @@
+"""Module 9874."""
+import pkg4.pkg34.pkg273.m272
+from pkg3.pkg29.pkg233 import m232
+import pkg6.pkg50.pkg406.m822
+from pkg3.pkg29.pkg239 import m1489
+
+
+def helper_9874_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
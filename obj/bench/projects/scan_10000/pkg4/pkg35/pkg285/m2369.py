@@ -0,0 +1,10 @@
+"""Module 2369."""
+import pkg2.pkg24.pkg196.m612
+from pkg3.pkg28 import m444
+
+
+def helper_2369_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,10 @@
+"""Module 4037."""
+import pkg1.pkg15.pkg123.m3458
+from pkg3.pkg25.pkg204 import m620
+
+
+def helper_4037_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 6539."""
+from . import m1535
+from pkg5.pkg44.pkg355 import m4107
+import pkg2.pkg20.pkg168.m2252
+from . import m2369
+import pkg1.pkg13.pkg105.m104
+from pkg1.pkg11.pkg96 import m95
+import pkg2.pkg19.pkg154.m3072
+from pkg2.pkg24.pkg198 import m614
+from . import m3203
+from . import m4037
+from . import m4454
+
+
+def helper_6539_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6539_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,39 @@
+"""Module 8207."""
+import pkg8.pkg68.m67
+from . import m2786
+import pkg3.pkg31.pkg249.m248
+from pkg1.pkg10.pkg83 import m916
+from . import m2369
+from pkg3.pkg25.pkg206 import m1039
+import pkg6.pkg54.m4223
+from pkg2.pkg20.pkg163 import m579
+from . import m1535
+from . import m4454
+
+
+def helper_8207_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8207_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8207_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8207_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
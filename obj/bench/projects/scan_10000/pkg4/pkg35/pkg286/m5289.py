@@ -0,0 +1,14 @@
+"""Module 5289."""
+import pkg1.pkg16.pkg133.m3468
+from pkg2.pkg19 import m435
+from . import m3204
+from pkg5.pkg42.pkg344 import m3679
+import pkg3.pkg29.pkg233.m232
+from pkg2.pkg22.pkg177 import m1010
+
+
+def helper_5289_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,16 @@
+"""Module 6123."""
+import pkg1.pkg14.m13
+from pkg1 import m0
+import pkg2.pkg24.pkg196.m4365
+from . import m4455
+import pkg5.pkg44.m43
+from pkg4.pkg34.pkg278 import m3613
+from . import m5289
+from pkg1.pkg13 import m2514
+
+
+def helper_6123_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,54 @@
+"""Module 9459."""
+from . import m5289
+from pkg1.pkg9.pkg78 import m4664
+from . import m702
+from pkg3.pkg30.pkg244 import m243
+import pkg1.pkg11.m1678
+from pkg4.pkg36.pkg290 import m289
+import pkg1.pkg12.pkg103.m2187
+from pkg5.pkg48.pkg391 import m4977
+import pkg4.pkg36.pkg294.m293
+from pkg5.pkg43 import m42
+from . import m9042
+
+
+def helper_9459_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9459_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9459_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9459_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_9459_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_9459_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
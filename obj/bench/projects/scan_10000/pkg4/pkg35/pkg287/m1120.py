@@ -0,0 +1,15 @@
+"""Module 1120."""
+from . import m703
+from pkg5.pkg47 import m46
+import pkg6.pkg50.pkg408.m824
+from pkg1.pkg14.pkg115 import m114
+import pkg1.pkg13.pkg110.m526
+from pkg4.pkg35.pkg281 import m280
+import pkg3.pkg28.pkg225.m224
+
+
+def helper_1120_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
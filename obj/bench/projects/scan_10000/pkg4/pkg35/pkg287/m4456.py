@@ -0,0 +1,4 @@
+"""Module 4456."""
+import pkg1.pkg9.pkg79.m78
+from pkg1.pkg13.pkg106 import m105
+import pkg3.pkg26.pkg209.m625
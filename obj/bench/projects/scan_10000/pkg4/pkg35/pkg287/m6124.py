@@ -0,0 +1,22 @@
+"""Module 6124."""
+import pkg3.pkg28.pkg225.m641
+from pkg3.pkg32.pkg258 import m4427
+import pkg1.pkg9.m8
+from pkg3.pkg27.pkg218 import m217
+import pkg1.m0
+from pkg4.pkg35.pkg285 import m3620
+import pkg3.pkg28.pkg226.m5646
+
+
+def helper_6124_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6124_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 6541."""
+import pkg4.pkg37.pkg297.m4883
+from pkg4.pkg37.pkg297 import m713
+import pkg1.pkg15.pkg124.m957
+from pkg2.pkg17.pkg137 import m553
+import pkg1.pkg13.pkg110.m1777
+
+
+def helper_6541_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6541_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,13 @@
+"""Module 9043."""
+import pkg1.m0
+from pkg1.pkg13.pkg108 import m3443
+import pkg2.pkg21.pkg172.m3924
+from pkg5.pkg45 import m461
+import pkg1.pkg13.pkg111.m527
+
+
+def helper_9043_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
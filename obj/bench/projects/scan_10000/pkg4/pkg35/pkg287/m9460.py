@@ -0,0 +1,46 @@
+"""Module 9460."""
+import pkg4.pkg36.pkg290.m1540
+from pkg3.pkg28.pkg229 import m4398
+import pkg4.pkg37.m3372
+from . import m4873
+import pkg1.pkg15.pkg126.m125
+from pkg3.pkg29.pkg237 import m5657
+import pkg4.pkg40.pkg323.m322
+from pkg1 import m0
+import pkg2.pkg24.pkg196.m612
+from pkg5.pkg47 import m880
+
+
+def helper_9460_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9460_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9460_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9460_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_9460_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,28 @@
+"""Module 1121."""
+import pkg3.pkg25.pkg206.m1039
+from pkg8.pkg66 import m65
+import pkg1.pkg16.pkg136.m135
+from pkg1.pkg11.pkg94 import m93
+import pkg1.pkg9.pkg73.m72
+from pkg8.pkg72 import m905
+
+
+def helper_1121_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1121_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1121_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,28 @@
+"""Module 2789."""
+import pkg6.pkg51.pkg416.m832
+from pkg2.pkg24.pkg193 import m2694
+import pkg8.pkg65.m64
+from pkg1.pkg15.pkg123 import m2207
+import pkg3.pkg29.m28
+from pkg2.pkg20.pkg163 import m1830
+
+
+def helper_2789_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2789_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2789_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,52 @@
+"""Module 6542."""
+import pkg2.pkg18.pkg150.m983
+from pkg3.pkg31.pkg254 import m1921
+import pkg4.pkg35.pkg281.m1531
+from pkg3.pkg25.pkg205 import m2289
+import pkg4.pkg40.pkg325.m5328
+from . import m6125
+import pkg7.m6
+from pkg1.pkg14.pkg114 import m113
+import pkg1.pkg16.pkg132.m548
+
+
+def helper_6542_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6542_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6542_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6542_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_6542_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_6542_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,29 @@
+"""Module 704."""
+import pkg7.pkg61.m60
+from pkg2 import m1
+import pkg2.pkg22.pkg180.m179
+from . import m287
+import pkg1.m0
+from pkg7 import m6
+import pkg4.pkg40.pkg327.m326
+
+
+def helper_704_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_704_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_704_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
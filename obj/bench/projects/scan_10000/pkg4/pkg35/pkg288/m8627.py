@@ -0,0 +1,13 @@
+"""Module 8627."""
+from . import m2372
+from pkg3.pkg28.pkg227 import m4813
+from . import m4874
+from . import m4457
+import pkg1.pkg12.pkg102.m101
+
+
+def helper_8627_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,38 @@
+"""Module 9044."""
+from . import m6542
+from pkg4.pkg39.pkg318 import m317
+from . import m6125
+from pkg2 import m1
+import pkg3.pkg28.pkg228.m2729
+from pkg5.pkg41 import m3376
+import pkg2.pkg23.pkg185.m3937
+from pkg1.pkg12.pkg103 import m5523
+from . import m704
+
+
+def helper_9044_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9044_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9044_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9044_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,22 @@
+"""Module 4205."""
+import pkg2.pkg18.pkg150.m983
+from pkg1.pkg16.pkg134 import m3469
+import pkg7.pkg62.m61
+from . import m35
+import pkg4.pkg38.pkg306.m722
+from . import m3788
+import pkg6.pkg51.pkg409.m2076
+
+
+def helper_4205_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4205_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
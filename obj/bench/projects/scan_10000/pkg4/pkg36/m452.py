@@ -0,0 +1,19 @@
+"""Module 452."""
+import pkg6.m422
+from pkg4.pkg39 import m38
+import pkg3.pkg31.m30
+from . import m35
+
+
+def helper_452_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_452_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1 @@
+"""Module 5039."""
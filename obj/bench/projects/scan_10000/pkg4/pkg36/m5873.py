@@ -0,0 +1,11 @@
+"""Module 5873."""
+import pkg2.pkg20.pkg165.m581
+from pkg3.pkg30.pkg241 import m657
+import pkg3.pkg29.pkg240.m239
+
+
+def helper_5873_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
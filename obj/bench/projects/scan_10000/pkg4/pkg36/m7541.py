@@ -0,0 +1,39 @@
+"""Module 7541."""
+import pkg5.pkg44.m4213
+from pkg7.pkg63 import m62
+import pkg3.pkg25.pkg207.m2291
+from pkg6.pkg52 import m468
+import pkg6.pkg49.pkg396.m4148
+from pkg2.pkg17 import m1267
+import pkg7.pkg59.m1726
+from . import m2120
+import pkg1.pkg16.pkg136.m6390
+from . import m7124
+
+
+def helper_7541_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7541_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7541_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7541_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
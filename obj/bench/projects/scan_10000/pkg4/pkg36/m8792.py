@@ -0,0 +1,24 @@
+"""Module 8792."""
+from . import m4205
+from . import m7958
+import pkg1.m0
+from pkg4.pkg40.pkg326 import m6580
+import pkg2.pkg18.pkg147.m146
+from pkg4.pkg38 import m5041
+from . import m2954
+from pkg8.pkg71 import m487
+import pkg1.pkg11.pkg93.m92
+
+
+def helper_8792_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8792_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 6543."""
+import pkg6.pkg51.pkg416.m415
+from . import m5709
+from . import m3624
+from . import m4458
+import pkg5.pkg42.pkg343.m342
+from pkg5.pkg45.pkg363 import m779
+from . import m4041
+from pkg1 import m0
+import pkg4.pkg35.pkg287.m4456
+
+
+def helper_6543_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,61 @@
+"""Module 9462."""
+import pkg6.pkg51.pkg414.m2498
+from pkg3.pkg30.pkg246 import m6083
+import pkg4.pkg33.pkg271.m687
+from pkg6.pkg51.pkg413 import m1663
+import pkg3.pkg26.pkg215.m8971
+from pkg3.pkg28.pkg232 import m6486
+import pkg1.pkg13.pkg108.m3860
+from pkg4.pkg40.pkg326 import m1576
+import pkg1.pkg16.pkg134.m133
+from pkg1 import m0
+import pkg1.pkg9.m2510
+
+
+def helper_9462_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9462_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9462_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9462_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_9462_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_9462_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9462_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,31 @@
+"""Module 3208."""
+import pkg3.pkg29.m862
+from . import m1123
+import pkg1.m0
+from pkg3.pkg26.pkg210 import m626
+import pkg1.pkg12.pkg98.m97
+from pkg2 import m1
+import pkg6.pkg51.pkg416.m1666
+from pkg2.pkg22.pkg184 import m183
+import pkg2.pkg18.pkg145.m978
+
+
+def helper_3208_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3208_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3208_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,54 @@
+"""Module 3625."""
+from . import m2374
+from pkg4.pkg33.pkg269 import m1936
+from . import m1540
+from pkg3.pkg29 import m445
+import pkg4.pkg35.m34
+from pkg2.pkg17.pkg143 import m976
+import pkg4.pkg33.pkg270.m1520
+from pkg1.pkg10 import m9
+import pkg3.pkg31.m30
+from . import m2791
+import pkg1.pkg11.pkg96.m95
+
+
+def helper_3625_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3625_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3625_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3625_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_3625_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_3625_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
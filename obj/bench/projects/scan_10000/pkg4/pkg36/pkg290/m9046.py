@@ -0,0 +1,25 @@
+"""Module 9046."""
+import pkg4.pkg40.pkg326.m1576
+from pkg4.pkg39.pkg316 import m315
+import pkg2.pkg21.pkg170.m4339
+
+
+def helper_9046_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9046_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9046_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
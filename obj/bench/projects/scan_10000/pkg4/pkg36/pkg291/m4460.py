@@ -0,0 +1,22 @@
+"""Module 4460."""
+import pkg4.pkg34.pkg273.m1523
+from pkg1.pkg10 import m9
+import pkg4.pkg40.pkg328.m3663
+from pkg3.pkg28 import m27
+import pkg1.pkg11.pkg93.m1760
+from pkg1.pkg16.pkg135 import m1385
+from . import m4043
+
+
+def helper_4460_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4460_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
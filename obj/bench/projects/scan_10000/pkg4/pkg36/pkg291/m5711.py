@@ -0,0 +1,38 @@
+"""Module 5711."""
+import pkg1.pkg16.pkg136.m135
+from pkg3 import m2
+from . import m1124
+from pkg3.pkg26.pkg213 import m212
+import pkg4.pkg33.pkg271.m270
+from pkg3.pkg28.pkg225 import m2309
+import pkg4.m3
+from pkg4.pkg39 import m2540
+from . import m1541
+
+
+def helper_5711_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5711_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5711_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5711_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
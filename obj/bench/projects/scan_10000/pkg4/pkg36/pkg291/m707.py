@@ -0,0 +1,37 @@
+"""Module 707."""
+import pkg1.m0
+from pkg5 import m4
+import pkg5.pkg47.m46
+from . import m290
+import pkg4.pkg37.m36
+from pkg5.pkg43.pkg350 import m349
+import pkg7.m6
+from pkg1.pkg14.pkg113 import m112
+
+
+def helper_707_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_707_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_707_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_707_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,39 @@
+"""Module 9464."""
+import pkg3.pkg27.pkg223.m2724
+from pkg2.pkg20.pkg161 import m160
+import pkg4.pkg36.pkg295.m294
+from pkg5.pkg47.pkg379 import m7884
+from . import m290
+from pkg4.pkg35.pkg284 import m8623
+import pkg3.pkg30.pkg248.m1081
+from . import m1124
+import pkg2.pkg21.pkg176.m3928
+from pkg5.pkg45.pkg361 import m7032
+
+
+def helper_9464_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9464_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9464_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9464_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 1959."""
+import pkg3.pkg27.pkg219.m1469
+from pkg1.pkg12 import m428
+import pkg5.pkg48.pkg392.m391
+from pkg2.pkg22.pkg182 import m1432
+import pkg6.m5
+
+
+def helper_1959_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1959_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1959_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
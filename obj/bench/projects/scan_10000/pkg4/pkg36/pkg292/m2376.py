@@ -0,0 +1,44 @@
+"""Module 2376."""
+import pkg5.pkg45.pkg361.m1611
+from pkg4.pkg38.pkg308 import m307
+import pkg1.m0
+from pkg4.pkg36.pkg289 import m2373
+import pkg1.pkg12.pkg98.m97
+from pkg3.pkg26.pkg214 import m1047
+import pkg7.pkg60.m59
+from pkg1.pkg11 import m1678
+
+
+def helper_2376_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2376_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2376_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2376_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_2376_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,31 @@
+"""Module 3210."""
+import pkg3.pkg26.pkg214.m1047
+from . import m708
+import pkg5.pkg48.m47
+from pkg1 import m0
+from . import m291
+from pkg5.pkg44.pkg354 import m2438
+import pkg1.pkg11.pkg92.m91
+from . import m2376
+import pkg1.pkg13.pkg106.m522
+
+
+def helper_3210_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3210_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3210_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
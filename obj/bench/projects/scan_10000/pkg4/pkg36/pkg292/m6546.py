@@ -0,0 +1,40 @@
+"""Module 6546."""
+import pkg6.pkg50.m466
+from pkg8.pkg66 import m65
+import pkg6.pkg49.pkg393.m3728
+from pkg4.pkg36.pkg291 import m2375
+import pkg4.pkg34.pkg278.m1528
+from pkg7.pkg59 import m58
+import pkg2.m1
+from . import m5295
+import pkg3.pkg28.m861
+from pkg4.pkg35.pkg286 import m1953
+from . import m5712
+
+
+def helper_6546_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6546_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6546_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6546_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 708."""
+from . import m291
+from pkg6.pkg54 import m53
+import pkg4.pkg34.pkg280.m279
+from pkg6.pkg51.pkg416 import m415
+import pkg1.pkg16.pkg132.m548
+from pkg4.pkg40.pkg324 import m323
+import pkg2.m1
+from pkg1 import m0
+import pkg3.pkg31.pkg253.m252
+from pkg2.pkg24.pkg197 import m613
+
+
+def helper_708_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,48 @@
+"""Module 3211."""
+from . import m2794
+from pkg4.pkg33.pkg266 import m265
+import pkg1.pkg11.m10
+from pkg2.pkg21.pkg176 import m2677
+import pkg5.pkg46.pkg370.m369
+from pkg7 import m6
+import pkg4.pkg34.pkg277.m276
+from pkg1.pkg9.pkg79 import m1746
+import pkg4.pkg37.m36
+from pkg1.pkg14.pkg113 import m112
+from . import m1126
+from pkg2 import m1
+
+
+def helper_3211_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3211_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3211_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3211_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_3211_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
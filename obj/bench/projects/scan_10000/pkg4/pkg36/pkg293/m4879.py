@@ -0,0 +1,48 @@
+"""Module 4879."""
+import pkg4.pkg40.pkg321.m2405
+from pkg3.pkg26.pkg210 import m626
+import pkg1.pkg13.pkg110.m3862
+from pkg1 import m0
+from . import m1126
+from pkg6.pkg54 import m1721
+from . import m3211
+from pkg7.pkg57 import m56
+import pkg4.pkg36.pkg295.m4047
+from pkg1.pkg15 import m14
+import pkg5.pkg46.pkg376.m2043
+from pkg1.pkg15.pkg121 import m120
+
+
+def helper_4879_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4879_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4879_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4879_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_4879_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,33 @@
+"""Module 8215."""
+import pkg2.pkg20.pkg162.m578
+from . import m7798
+import pkg4.pkg34.pkg278.m8200
+from pkg1.pkg12.pkg102 import m5939
+from . import m3628
+from pkg6.pkg51.pkg412 import m4581
+from . import m6130
+from pkg2.pkg19.pkg154 import m153
+import pkg3.pkg28.pkg227.m226
+from pkg2.pkg17.pkg138 import m4724
+import pkg2.m1
+
+
+def helper_8215_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8215_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8215_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
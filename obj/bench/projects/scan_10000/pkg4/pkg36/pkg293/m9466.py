@@ -0,0 +1,22 @@
+"""Module 9466."""
+from . import m7381
+from pkg2.pkg17.pkg138 import m137
+import pkg5.pkg43.pkg349.m8271
+from . import m1960
+from . import m1543
+from pkg3.pkg26.pkg216 import m3551
+import pkg5.pkg45.pkg368.m7039
+
+
+def helper_9466_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9466_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,33 @@
+"""Module 5714."""
+import pkg2.pkg24.m2942
+from pkg3.pkg25.pkg208 import m624
+import pkg8.pkg65.m481
+from pkg3.pkg28.pkg225 import m224
+import pkg5.pkg45.pkg361.m777
+from pkg1.pkg10 import m9
+import pkg5.pkg46.m45
+from pkg3.pkg30.pkg243 import m242
+import pkg7.pkg59.m58
+from pkg3.pkg25.pkg202 import m1452
+from . import m710
+
+
+def helper_5714_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5714_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5714_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
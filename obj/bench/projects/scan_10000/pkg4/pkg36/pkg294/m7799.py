@@ -0,0 +1,26 @@
+"""Module 7799."""
+import pkg2.pkg21.pkg169.m2253
+from pkg7.pkg60 import m476
+from . import m2795
+from pkg3.pkg26.pkg213 import m629
+
+
+def helper_7799_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7799_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7799_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
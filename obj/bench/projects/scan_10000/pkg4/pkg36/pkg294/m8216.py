@@ -0,0 +1,9 @@
+"""Module 8216."""
+from . import m1961
+
+
+def helper_8216_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
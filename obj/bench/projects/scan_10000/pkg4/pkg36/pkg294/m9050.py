@@ -0,0 +1,61 @@
+"""Module 9050."""
+import pkg1.pkg15.pkg122.m3040
+from pkg2.pkg21.pkg172 import m171
+import pkg8.pkg65.m4234
+from pkg3.pkg29.pkg233 import m1066
+from . import m7382
+from . import m6965
+import pkg1.pkg15.m14
+from pkg2.pkg22.pkg181 import m180
+import pkg4.pkg38.pkg309.m725
+from pkg1.pkg11 import m10
+import pkg1.pkg15.pkg122.m3874
+
+
+def helper_9050_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9050_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9050_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9050_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_9050_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_9050_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9050_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
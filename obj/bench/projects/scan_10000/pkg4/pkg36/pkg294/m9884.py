@@ -0,0 +1,9 @@
+"""Module 9884."""
+import pkg8.m7
+
+
+def helper_9884_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
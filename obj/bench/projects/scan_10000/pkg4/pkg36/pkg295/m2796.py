@@ -0,0 +1,18 @@
+"""Module 2796."""
+import pkg2.pkg21.pkg171.m170
+from pkg1.pkg9.pkg78 import m1745
+import pkg6.pkg53.m52
+
+
+def helper_2796_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2796_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
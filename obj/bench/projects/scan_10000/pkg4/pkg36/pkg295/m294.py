@@ -0,0 +1,27 @@
+"""Module 294."""
+import pkg2.pkg23.pkg185.m184
+from pkg1.pkg9.pkg75 import m74
+import pkg8.pkg72.m71
+from pkg2.pkg22.pkg182 import m181
+import pkg1.m0
+
+
+def helper_294_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_294_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_294_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
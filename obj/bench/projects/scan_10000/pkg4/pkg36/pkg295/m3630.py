@@ -0,0 +1,10 @@
+"""Module 3630."""
+import pkg6.pkg52.m885
+from pkg5.pkg46 import m462
+
+
+def helper_3630_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
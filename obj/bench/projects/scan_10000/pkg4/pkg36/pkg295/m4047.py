@@ -0,0 +1,27 @@
+"""Module 4047."""
+import pkg3.pkg27.m26
+from pkg2.pkg24.pkg200 import m1450
+from . import m1545
+from . import m3213
+import pkg2.pkg17.m1267
+from pkg6.pkg51 import m1718
+import pkg6.pkg51.pkg416.m415
+from pkg8.pkg68 import m1735
+import pkg5.pkg42.pkg338.m2422
+from pkg1 import m0
+import pkg2.pkg23.pkg192.m608
+from . import m711
+
+
+def helper_4047_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4047_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
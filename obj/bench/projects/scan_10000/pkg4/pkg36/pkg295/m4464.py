@@ -0,0 +1,26 @@
+"""Module 4464."""
+import pkg1.pkg16.pkg136.m3888
+from pkg1.pkg13.pkg105 import m104
+import pkg4.pkg36.m35
+from pkg5 import m4
+import pkg5.pkg47.m2131
+from pkg3.pkg30 import m2531
+from . import m3213
+from pkg1 import m417
+import pkg8.pkg67.m66
+from pkg3.pkg29.pkg233 import m1066
+import pkg2.pkg23.pkg192.m191
+
+
+def helper_4464_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4464_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
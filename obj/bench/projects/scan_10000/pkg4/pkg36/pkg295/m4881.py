@@ -0,0 +1,46 @@
+"""Module 4881."""
+from . import m2379
+from pkg1.pkg10.pkg86 import m3421
+import pkg2.pkg18.pkg147.m3899
+from pkg2 import m1
+import pkg7.pkg59.m475
+from pkg4.pkg34.pkg273 import m2357
+import pkg4.pkg38.pkg310.m1143
+from pkg3.pkg27.pkg219 import m2720
+import pkg3.pkg31.pkg251.m4837
+from . import m4047
+
+
+def helper_4881_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4881_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4881_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4881_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_4881_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,52 @@
+"""Module 5715."""
+import pkg1.m0
+from pkg3.pkg27.pkg223 import m2724
+import pkg4.pkg40.pkg325.m324
+from pkg5.pkg44 import m43
+import pkg6.pkg50.m4219
+from pkg1.pkg12.pkg98 import m97
+import pkg2.pkg24.pkg193.m3111
+from pkg5.pkg46.pkg370 import m1203
+import pkg4.pkg39.pkg316.m2817
+
+
+def helper_5715_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5715_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5715_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5715_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_5715_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_5715_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
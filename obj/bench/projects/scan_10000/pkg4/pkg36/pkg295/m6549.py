@@ -0,0 +1,14 @@
+"""Module 6549."""
+from . import m4881
+from pkg8 import m1675
+from . import m711
+from . import m294
+import pkg3.pkg28.pkg226.m1893
+from pkg6.pkg50.pkg402 import m2486
+
+
+def helper_6549_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,28 @@
+"""Module 9051."""
+import pkg2.pkg24.pkg196.m195
+from . import m3213
+from . import m7383
+from pkg3.pkg29 import m28
+import pkg6.pkg51.m50
+from pkg5.pkg44.pkg357 import m356
+
+
+def helper_9051_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9051_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9051_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
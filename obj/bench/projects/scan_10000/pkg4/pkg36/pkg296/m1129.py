@@ -0,0 +1,47 @@
+"""Module 1129."""
+import pkg4.pkg40.pkg324.m323
+from pkg3.pkg29 import m445
+import pkg5.pkg45.pkg362.m778
+from pkg3.pkg25.pkg201 import m1034
+import pkg3.pkg31.pkg250.m666
+from pkg5.pkg45.pkg366 import m782
+import pkg1.m0
+from pkg6 import m5
+import pkg5.pkg45.pkg363.m362
+from pkg5.pkg47 import m880
+import pkg3.pkg32.pkg260.m259
+
+
+def helper_1129_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1129_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1129_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1129_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_1129_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,8 @@
+"""Module 2380."""
+import pkg2.pkg18.pkg150.m149
+from pkg1 import m0
+import pkg1.pkg15.pkg125.m124
+from pkg1.pkg14 import m1264
+import pkg2.pkg18.m17
+from . import m1546
+from . import m1963
@@ -0,0 +1,36 @@
+"""Module 4465."""
+import pkg2.pkg24.pkg198.m4367
+from pkg1.pkg12.pkg104 import m103
+import pkg4.pkg37.m870
+from . import m4048
+import pkg2.pkg24.pkg200.m199
+from pkg3.pkg29.pkg237 import m1487
+import pkg4.pkg37.m3789
+
+
+def helper_4465_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4465_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4465_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4465_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,10 @@
+"""Module 7801."""
+import pkg3.pkg32.pkg260.m2761
+from . import m3214
+
+
+def helper_7801_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
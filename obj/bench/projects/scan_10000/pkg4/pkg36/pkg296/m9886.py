@@ -0,0 +1,12 @@
+"""Module 9886."""
+import pkg1.pkg13.pkg112.m1362
+from pkg3.pkg29 import m1279
+import pkg4.pkg34.pkg276.m692
+from . import m4048
+from . import m6133
+from pkg2.pkg23.pkg186 import m2270
+import pkg4.pkg33.pkg267.m266
+from pkg1.pkg12.pkg101 import m100
+import pkg2.pkg17.pkg140.m139
+from . import m3631
+import pkg6.pkg52.m51
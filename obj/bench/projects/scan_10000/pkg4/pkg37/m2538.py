@@ -0,0 +1,15 @@
+"""Module 2538."""
+from . import m453
+from pkg1.pkg16.pkg134 import m133
+import pkg1.pkg12.pkg104.m520
+from pkg5.pkg47.pkg382 import m1632
+import pkg1.pkg9.pkg77.m493
+from pkg6 import m5
+import pkg1.pkg13.m1263
+
+
+def helper_2538_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,38 @@
+"""Module 5457."""
+import pkg3.pkg26.pkg214.m630
+from pkg3.pkg29.pkg238 import m237
+import pkg1.pkg16.pkg130.m1797
+from pkg3.pkg28.pkg231 import m3149
+import pkg2.pkg21.pkg172.m171
+from pkg2.pkg23.pkg192 import m191
+import pkg5.pkg45.pkg362.m2029
+from pkg2 import m1
+import pkg2.pkg17.pkg137.m2221
+
+
+def helper_5457_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5457_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5457_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5457_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
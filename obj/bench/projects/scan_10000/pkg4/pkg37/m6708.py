@@ -0,0 +1,30 @@
+"""Module 6708."""
+import pkg2.pkg17.m16
+from pkg4.pkg33.pkg265 import m6519
+import pkg3.pkg28.pkg225.m3560
+from pkg3.pkg30.pkg248 import m664
+import pkg4.pkg35.pkg281.m1531
+from pkg3 import m2
+import pkg5.pkg46.pkg375.m4544
+from . import m453
+
+
+def helper_6708_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6708_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6708_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,38 @@
+"""Module 7542."""
+import pkg4.pkg37.pkg303.m4472
+from pkg4.pkg38.pkg307 import m1557
+from . import m2121
+from pkg2.pkg19.pkg158 import m157
+import pkg2.pkg24.m857
+from pkg2.pkg23.pkg191 import m1024
+import pkg6.pkg49.pkg393.m1226
+from pkg1 import m0
+import pkg5.pkg45.m44
+
+
+def helper_7542_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7542_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7542_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7542_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
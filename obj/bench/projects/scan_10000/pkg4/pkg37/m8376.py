@@ -0,0 +1,23 @@
+"""Module 8376."""
+from . import m4623
+from pkg2.pkg24.pkg198 import m197
+import pkg5.pkg47.pkg383.m382
+from pkg6.pkg50.pkg408 import m407
+from . import m2955
+from pkg3.pkg31.pkg249 import m2750
+import pkg3.pkg32.pkg257.m673
+from pkg1.pkg10.pkg87 import m3422
+
+
+def helper_8376_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8376_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,44 @@
+"""Module 1964."""
+import pkg5.pkg44.pkg355.m354
+from pkg1 import m0
+import pkg4.pkg40.pkg328.m327
+from . import m1547
+import pkg5.pkg43.m42
+from pkg4.pkg35 import m34
+import pkg1.pkg11.pkg95.m928
+from pkg5.pkg48 import m47
+
+
+def helper_1964_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1964_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1964_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1964_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_1964_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 2798."""
+import pkg5.pkg46.pkg373.m1623
+from pkg2.pkg20.pkg167 import m583
+import pkg2.pkg21.pkg169.m585
+from . import m713
+import pkg2.pkg18.pkg149.m565
+from pkg3.pkg28.pkg232 import m648
+import pkg2.pkg19.m18
+from pkg5.pkg42.pkg337 import m1587
+import pkg1.pkg11.pkg92.m91
+from pkg4.pkg39.pkg316 import m732
+import pkg4.m3
+
+
+def helper_2798_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
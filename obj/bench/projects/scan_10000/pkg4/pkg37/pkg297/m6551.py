@@ -0,0 +1,27 @@
+"""Module 6551."""
+import pkg1.pkg12.pkg100.m99
+from pkg4.pkg39.pkg320 import m2821
+import pkg3.pkg28.pkg230.m3148
+from . import m1547
+from . import m1964
+
+
+def helper_6551_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6551_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6551_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
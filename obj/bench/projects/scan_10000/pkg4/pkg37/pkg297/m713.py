@@ -0,0 +1,30 @@
+"""Module 713."""
+import pkg1.pkg10.pkg87.m86
+from pkg4.pkg35 import m34
+import pkg1.pkg11.m10
+from pkg1.pkg9 import m8
+import pkg5.pkg42.pkg343.m342
+from pkg2 import m1
+import pkg3.pkg28.pkg229.m228
+from pkg1 import m0
+
+
+def helper_713_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_713_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_713_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,62 @@
+"""Module 8636."""
+import pkg1.pkg12.m1679
+from pkg1.pkg9.pkg73 import m72
+import pkg5.pkg43.pkg345.m2012
+from pkg3.pkg29.pkg240 import m1490
+import pkg2.pkg21.pkg176.m175
+from . import m1130
+import pkg2.m1
+from pkg3.pkg29.pkg235 import m234
+from . import m4466
+from . import m5717
+import pkg3.pkg25.pkg208.m1041
+from pkg1 import m0
+
+
+def helper_8636_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8636_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8636_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8636_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_8636_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_8636_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8636_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
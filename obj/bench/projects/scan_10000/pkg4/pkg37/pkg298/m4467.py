@@ -0,0 +1,47 @@
+"""Module 4467."""
+import pkg4.pkg38.pkg306.m1973
+from pkg1.pkg15.pkg122 import m3457
+import pkg1.pkg15.pkg126.m125
+from pkg3.pkg31 import m1698
+import pkg3.pkg30.pkg245.m661
+from pkg8.pkg65 import m64
+import pkg2.pkg18.pkg145.m144
+from pkg3.pkg27.pkg222 import m1055
+import pkg3.pkg27.pkg223.m222
+from pkg1.pkg16.pkg131 import m4300
+import pkg5.pkg46.pkg370.m369
+
+
+def helper_4467_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4467_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4467_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4467_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_4467_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,37 @@
+"""Module 5718."""
+import pkg2.pkg24.pkg196.m1029
+from pkg5.pkg45.pkg363 import m2864
+from . import m3633
+from pkg2.pkg24 import m23
+import pkg7.pkg58.m474
+from . import m297
+import pkg3.pkg30.pkg244.m2328
+from pkg1.pkg9.pkg73 import m489
+
+
+def helper_5718_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5718_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5718_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5718_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,13 @@
+"""Module 6135."""
+import pkg2.pkg22.pkg184.m5187
+from pkg2.pkg21 import m20
+from . import m297
+from pkg2.pkg17.pkg142 import m558
+import pkg1.pkg12.m11
+
+
+def helper_6135_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,35 @@
+"""Module 9888."""
+import pkg8.m7
+from pkg4.pkg40.pkg326 import m7831
+import pkg3.pkg31.pkg252.m1919
+from pkg4.pkg38 import m454
+import pkg3.pkg31.m447
+from pkg1.pkg13 import m12
+
+
+def helper_9888_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9888_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9888_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9888_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,38 @@
+"""Module 2383."""
+import pkg5.pkg45.pkg362.m2029
+from pkg2.pkg22 import m21
+from . import m1549
+from pkg6.pkg49 import m882
+import pkg3.pkg31.m30
+from pkg4.pkg34.pkg280 import m2364
+import pkg2.pkg23.m856
+from . import m298
+import pkg5.pkg41.pkg334.m333
+
+
+def helper_2383_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2383_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2383_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2383_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,24 @@
+"""Module 2800."""
+import pkg1.pkg13.pkg105.m938
+from pkg3.pkg29 import m1696
+import pkg4.pkg33.pkg267.m1934
+from . import m2383
+import pkg4.pkg33.pkg269.m685
+from pkg6.pkg52 import m468
+import pkg3.pkg29.pkg237.m653
+from . import m1549
+import pkg3.pkg32.pkg263.m1513
+
+
+def helper_2800_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2800_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
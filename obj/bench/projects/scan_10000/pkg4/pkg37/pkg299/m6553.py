@@ -0,0 +1,21 @@
+"""Module 6553."""
+from . import m1132
+from pkg6.pkg51.pkg413 import m3748
+import pkg1.pkg11.m2512
+from . import m2383
+import pkg1.m0
+from . import m4885
+
+
+def helper_6553_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6553_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
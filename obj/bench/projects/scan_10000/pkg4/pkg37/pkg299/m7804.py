@@ -0,0 +1,46 @@
+"""Module 7804."""
+import pkg3.pkg29.pkg239.m3157
+from pkg1.pkg9.pkg77 import m493
+import pkg2.pkg20.pkg164.m163
+from pkg6.pkg49 import m48
+import pkg1.pkg15.pkg123.m122
+from . import m1549
+import pkg3.pkg31.pkg255.m671
+from . import m3217
+from . import m1132
+from pkg5.pkg44.pkg360 import m1193
+
+
+def helper_7804_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7804_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7804_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7804_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_7804_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
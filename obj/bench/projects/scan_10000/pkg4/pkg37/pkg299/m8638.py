@@ -0,0 +1,39 @@
+"""Module 8638."""
+import pkg3.pkg30.pkg246.m5249
+from . import m1132
+import pkg2.pkg22.m21
+from pkg4.pkg39 import m38
+import pkg3.pkg25.pkg201.m617
+from pkg1 import m0
+from . import m298
+from pkg1.pkg14 import m13
+import pkg4.pkg34.m867
+from pkg1.pkg11 import m10
+
+
+def helper_8638_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8638_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8638_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8638_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
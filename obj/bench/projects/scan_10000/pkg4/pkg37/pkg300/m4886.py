@@ -0,0 +1,44 @@
+"""Module 4886."""
+import pkg7.m6
+from . import m1550
+import pkg2.pkg24.pkg198.m197
+from pkg3.pkg28.pkg225 import m3143
+import pkg2.pkg19.pkg160.m3078
+from pkg6 import m5
+from . import m716
+from pkg1.pkg11.pkg95 import m94
+
+
+def helper_4886_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4886_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4886_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4886_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_4886_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
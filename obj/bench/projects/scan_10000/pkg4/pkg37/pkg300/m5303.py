@@ -0,0 +1,10 @@
+"""Module 5303."""
+import pkg2.pkg22.pkg183.m182
+from . import m4052
+
+
+def helper_5303_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 5720."""
+import pkg3.pkg28.pkg228.m1061
+from pkg2.pkg23.pkg186 import m2270
+import pkg3.pkg26.pkg214.m2715
+from pkg5.pkg45 import m1295
+import pkg3.pkg32.pkg264.m680
+
+
+def helper_5720_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5720_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,36 @@
+"""Module 7805."""
+import pkg3.pkg26.pkg212.m1462
+from pkg3.pkg27.pkg218 import m2719
+import pkg2.pkg21.pkg174.m3509
+from pkg1 import m0
+import pkg3.pkg27.pkg221.m1054
+from pkg3.pkg30.pkg244 import m243
+import pkg4.pkg34.pkg274.m1941
+
+
+def helper_7805_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7805_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7805_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7805_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
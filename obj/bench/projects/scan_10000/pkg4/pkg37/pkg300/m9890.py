@@ -0,0 +1,29 @@
+"""Module 9890."""
+import pkg1.pkg11.m4180
+from pkg3.pkg25 import m2526
+import pkg4.pkg33.pkg271.m1104
+from pkg1.pkg14.pkg114 import m6368
+import pkg1.pkg16.pkg133.m132
+from . import m299
+import pkg3.m2
+
+
+def helper_9890_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9890_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9890_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
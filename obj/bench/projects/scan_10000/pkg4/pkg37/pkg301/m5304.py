@@ -0,0 +1,34 @@
+"""Module 5304."""
+from . import m1968
+from pkg1.pkg11.pkg96 import m512
+import pkg4.pkg36.pkg294.m710
+from pkg1.pkg12.pkg97 import m96
+import pkg6.pkg52.pkg417.m4169
+from . import m4470
+import pkg3.m2
+from pkg1.pkg15.pkg124 import m123
+import pkg2.pkg23.pkg191.m3526
+from pkg2.pkg21.pkg173 import m3508
+import pkg2.pkg22.pkg183.m1016
+from pkg2.pkg17.pkg138 import m1805
+
+
+def helper_5304_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5304_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5304_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,29 @@
+"""Module 5721."""
+import pkg3.pkg27.pkg220.m1053
+from . import m717
+import pkg1.pkg9.m8
+from pkg2.pkg18.pkg148 import m147
+import pkg3.m2
+from pkg2 import m1
+from . import m4053
+
+
+def helper_5721_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5721_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5721_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,46 @@
+"""Module 9057."""
+import pkg3.pkg25.pkg202.m618
+from pkg1 import m0
+from . import m5304
+from pkg7.pkg62 import m1729
+import pkg6.pkg54.m470
+from . import m4470
+from . import m1551
+from . import m6138
+import pkg2.pkg20.pkg167.m1417
+from pkg2.pkg17 import m2935
+
+
+def helper_9057_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9057_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9057_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9057_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_9057_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,36 @@
+"""Module 1969."""
+import pkg1.pkg14.m13
+from pkg6.pkg51 import m50
+import pkg5.pkg44.pkg356.m355
+from pkg4.pkg33.pkg265 import m1515
+from . import m1552
+from pkg6.pkg49.pkg397 import m813
+import pkg1.pkg11.pkg93.m926
+
+
+def helper_1969_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1969_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1969_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1969_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
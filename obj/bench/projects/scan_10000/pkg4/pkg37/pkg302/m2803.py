@@ -0,0 +1,27 @@
+"""Module 2803."""
+import pkg6.pkg51.pkg413.m412
+from pkg3.pkg29.pkg235 import m1902
+import pkg1.pkg15.pkg122.m121
+from pkg3.pkg32.pkg259 import m1926
+from . import m718
+
+
+def helper_2803_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2803_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2803_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
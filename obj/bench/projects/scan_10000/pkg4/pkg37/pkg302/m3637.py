@@ -0,0 +1,46 @@
+"""Module 3637."""
+from . import m718
+from pkg3.pkg30.pkg247 import m1914
+import pkg1.m0
+from pkg5.pkg47.pkg384 import m1217
+import pkg2.pkg19.m18
+from . import m3220
+import pkg3.pkg25.pkg206.m3124
+from pkg6.pkg52 import m51
+import pkg1.pkg13.m12
+from pkg2.pkg20 import m19
+
+
+def helper_3637_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3637_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3637_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3637_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_3637_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
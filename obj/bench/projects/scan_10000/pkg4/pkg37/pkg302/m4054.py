@@ -0,0 +1,13 @@
+"""Module 4054."""
+from . import m2386
+from pkg2 import m1669
+import pkg1.pkg12.pkg101.m517
+from pkg5.pkg47.pkg378 import m2045
+import pkg2.pkg18.pkg148.m2232
+
+
+def helper_4054_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
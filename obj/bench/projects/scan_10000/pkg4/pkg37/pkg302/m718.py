@@ -0,0 +1,21 @@
+"""Module 718."""
+import pkg5.pkg43.m42
+from . import m301
+import pkg3.pkg30.pkg244.m243
+from pkg1 import m0
+import pkg4.m3
+from pkg2.pkg18.pkg148 import m147
+
+
+def helper_718_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_718_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,12 @@
+"""Module 1136."""
+import pkg1.m0
+from pkg1.pkg13.pkg105 import m104
+import pkg3.pkg30.pkg247.m246
+from pkg1.pkg15.pkg122 import m121
+
+
+def helper_1136_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
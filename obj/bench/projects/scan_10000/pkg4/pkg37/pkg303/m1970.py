@@ -0,0 +1,11 @@
+"""Module 1970."""
+import pkg5.pkg43.pkg350.m349
+from . import m302
+from . import m719
+
+
+def helper_1970_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,47 @@
+"""Module 2804."""
+import pkg4.pkg38.pkg312.m1979
+from pkg1.pkg12.pkg99 import m98
+import pkg1.pkg13.m1263
+from pkg8 import m7
+import pkg1.pkg15.pkg124.m957
+from pkg4.pkg39.pkg317 import m316
+import pkg2.pkg22.m21
+from pkg5.pkg41.pkg334 import m1584
+from . import m719
+from . import m302
+import pkg3.pkg31.pkg254.m1087
+
+
+def helper_2804_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2804_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2804_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2804_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_2804_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
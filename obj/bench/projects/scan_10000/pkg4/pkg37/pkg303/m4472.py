@@ -0,0 +1,19 @@
+"""Module 4472."""
+import pkg8.pkg72.m905
+from pkg7.pkg59 import m58
+import pkg6.pkg50.pkg405.m1655
+from pkg2.pkg21.pkg170 import m169
+
+
+def helper_4472_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4472_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,28 @@
+"""Module 5306."""
+import pkg1.pkg11.pkg93.m92
+from . import m1970
+import pkg6.pkg51.pkg413.m412
+from pkg4.pkg35.pkg281 import m2782
+import pkg4.pkg34.pkg278.m277
+from pkg1.pkg13.pkg105 import m104
+
+
+def helper_5306_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5306_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5306_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,38 @@
+"""Module 6140."""
+import pkg5.pkg43.pkg345.m2012
+from pkg5 import m4
+from . import m3638
+from pkg4.pkg36.pkg291 import m3209
+import pkg3.pkg26.pkg216.m1049
+from pkg3.pkg29.pkg240 import m656
+import pkg2.pkg23.pkg187.m6024
+from pkg8.pkg65 import m64
+import pkg6.pkg49.m465
+
+
+def helper_6140_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6140_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6140_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6140_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,22 @@
+"""Module 6557."""
+from . import m4055
+from pkg4.pkg36 import m869
+import pkg6.pkg50.pkg401.m1234
+from pkg8.pkg71 import m70
+from . import m6140
+from pkg3.pkg30 import m29
+import pkg1.pkg11.m10
+
+
+def helper_6557_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6557_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
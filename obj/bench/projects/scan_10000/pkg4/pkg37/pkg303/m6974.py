@@ -0,0 +1,31 @@
+"""Module 6974."""
+import pkg5.pkg42.pkg341.m340
+from pkg1.pkg16.pkg131 import m964
+import pkg3.pkg28.m444
+from . import m6557
+import pkg2.pkg22.pkg177.m176
+from pkg2.pkg17.pkg139 import m138
+import pkg3.pkg30.pkg245.m244
+from pkg2.pkg24.pkg193 import m1443
+import pkg1.pkg14.pkg115.m1365
+
+
+def helper_6974_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6974_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6974_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,55 @@
+"""Module 3639."""
+import pkg8.pkg69.m1736
+from pkg1.pkg14.pkg113 import m1780
+from . import m3222
+from pkg5.pkg44 import m43
+import pkg4.pkg38.pkg310.m726
+from pkg2.pkg21.pkg170 import m169
+import pkg7.m6
+from pkg5.pkg46.pkg369 import m3287
+import pkg1.pkg12.pkg97.m513
+from pkg2.pkg17.pkg142 import m141
+import pkg1.pkg16.pkg136.m3471
+from pkg2.pkg19.pkg157 import m573
+
+
+def helper_3639_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3639_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3639_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3639_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_3639_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_3639_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
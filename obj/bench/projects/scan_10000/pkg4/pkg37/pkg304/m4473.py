@@ -0,0 +1,10 @@
+"""Module 4473."""
+from . import m2805
+from pkg7 import m6
+
+
+def helper_4473_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
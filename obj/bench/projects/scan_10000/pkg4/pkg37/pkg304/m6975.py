@@ -0,0 +1,15 @@
+"""Module 6975."""
+import pkg1.pkg16.pkg133.m549
+from pkg3.pkg28.pkg231 import m230
+import pkg6.pkg49.m3384
+from pkg6.pkg50.pkg407 import m5827
+import pkg6.pkg50.m49
+from pkg5.pkg45 import m44
+import pkg5.pkg44.pkg353.m352
+
+
+def helper_6975_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
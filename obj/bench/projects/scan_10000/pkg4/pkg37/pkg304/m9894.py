@@ -0,0 +1,55 @@
+"""Module 9894."""
+import pkg7.m6
+from . import m6975
+import pkg2.pkg18.m17
+from pkg5.pkg43.pkg350 import m1183
+import pkg2.pkg23.pkg189.m188
+from pkg6.pkg50.pkg401 import m3319
+from . import m9060
+from pkg1.pkg13.pkg112 import m111
+import pkg4.pkg37.pkg301.m4887
+from pkg1 import m0
+import pkg4.pkg37.pkg300.m6137
+from pkg8.pkg71 import m487
+
+
+def helper_9894_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9894_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9894_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9894_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_9894_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_9894_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 3373."""
+import pkg3.pkg27.pkg220.m2721
+from pkg2.pkg17.pkg143 import m976
+import pkg2.pkg20.pkg168.m2669
+
+
+def helper_3373_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3373_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3373_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
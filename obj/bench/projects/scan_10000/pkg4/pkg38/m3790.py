@@ -0,0 +1,15 @@
+"""Module 3790."""
+import pkg1.m0
+from pkg3.pkg26.pkg214 import m213
+import pkg4.pkg40.m2958
+from pkg3.pkg32.pkg263 import m1513
+from . import m37
+from . import m1705
+import pkg3.pkg29.m3364
+
+
+def helper_3790_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
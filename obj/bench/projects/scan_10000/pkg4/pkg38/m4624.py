@@ -0,0 +1,29 @@
+"""Module 4624."""
+import pkg4.pkg40.pkg328.m1995
+from pkg2.pkg20.pkg163 import m996
+import pkg1.m0
+from pkg5.pkg46.pkg373 import m372
+from . import m2122
+from pkg6.pkg50.pkg404 import m403
+import pkg4.pkg35.pkg285.m284
+
+
+def helper_4624_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4624_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4624_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
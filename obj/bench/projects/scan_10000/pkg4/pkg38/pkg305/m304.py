@@ -0,0 +1,36 @@
+"""Module 304."""
+import pkg8.pkg67.m66
+from pkg1.pkg12 import m11
+import pkg4.pkg38.m37
+from pkg8 import m7
+import pkg4.pkg40.m39
+from pkg1.pkg15.pkg125 import m124
+import pkg4.pkg33.m32
+
+
+def helper_304_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_304_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_304_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_304_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
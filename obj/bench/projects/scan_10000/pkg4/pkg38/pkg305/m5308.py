@@ -0,0 +1,25 @@
+"""Module 5308."""
+import pkg1.pkg9.pkg75.m74
+from pkg4.pkg40.pkg326 import m2827
+import pkg4.pkg35.m34
+
+
+def helper_5308_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5308_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5308_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
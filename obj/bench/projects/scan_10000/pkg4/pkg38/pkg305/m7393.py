@@ -0,0 +1,31 @@
+"""Module 7393."""
+import pkg5.m1255
+from pkg4.pkg40.pkg328 import m327
+import pkg4.pkg35.pkg287.m2788
+from pkg1.pkg11 import m10
+import pkg2.pkg17.pkg140.m139
+from pkg4.pkg38.pkg306 import m4058
+import pkg4.pkg36.pkg296.m1963
+from pkg3.pkg29.pkg239 import m3157
+import pkg1.pkg15.pkg127.m4296
+
+
+def helper_7393_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7393_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7393_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,28 @@
+"""Module 9478."""
+import pkg5.pkg43.m459
+from pkg1.pkg9.pkg74 import m1324
+import pkg1.pkg15.pkg124.m3042
+from pkg3.pkg28.pkg227 import m226
+import pkg6.pkg51.pkg416.m5836
+from . import m1555
+
+
+def helper_9478_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9478_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9478_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
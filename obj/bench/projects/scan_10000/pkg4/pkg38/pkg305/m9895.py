@@ -0,0 +1,17 @@
+"""Module 9895."""
+import pkg1.pkg11.pkg91.m90
+from pkg6.pkg51.pkg412 import m4164
+
+
+def helper_9895_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9895_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
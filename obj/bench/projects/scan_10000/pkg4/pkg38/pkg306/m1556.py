@@ -0,0 +1,62 @@
+"""Module 1556."""
+import pkg1.m0
+from pkg6.pkg53 import m52
+import pkg1.pkg9.pkg74.m73
+from pkg1.pkg9.pkg73 import m1323
+import pkg1.pkg12.pkg103.m102
+from pkg2.pkg22.pkg182 import m598
+import pkg4.pkg34.pkg279.m695
+from pkg5.pkg45.pkg367 import m1200
+import pkg3.pkg32.pkg258.m674
+from pkg4 import m3
+import pkg5.pkg47.m46
+from pkg5.pkg43.pkg345 import m344
+
+
+def helper_1556_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1556_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1556_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1556_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_1556_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_1556_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1556_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,44 @@
+"""Module 2390."""
+import pkg2.pkg24.pkg194.m193
+from pkg2.pkg20.pkg167 import m1834
+import pkg2.pkg17.m16
+from pkg6.pkg50.pkg404 import m2071
+import pkg4.pkg37.pkg301.m2385
+from pkg3.pkg25 import m24
+import pkg1.pkg14.pkg117.m116
+from pkg2.pkg20.pkg163 import m1830
+
+
+def helper_2390_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2390_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2390_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2390_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_2390_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,34 @@
+"""Module 3641."""
+import pkg3.pkg29.pkg238.m654
+from pkg4.pkg38.pkg309 import m308
+import pkg3.pkg32.pkg259.m675
+from . import m305
+import pkg1.pkg15.pkg126.m2210
+from pkg1.pkg14.pkg113 import m112
+from . import m2390
+from pkg1.pkg14.pkg118 import m117
+import pkg4.pkg38.m2122
+from . import m3224
+import pkg1.m0
+from pkg2.pkg17.pkg139 import m1389
+
+
+def helper_3641_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3641_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3641_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
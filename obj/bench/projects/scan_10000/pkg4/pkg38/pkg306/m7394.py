@@ -0,0 +1,46 @@
+"""Module 7394."""
+import pkg2.pkg19.pkg158.m3076
+from pkg3.pkg29 import m862
+from . import m2390
+from . import m6977
+import pkg3.pkg27.pkg219.m1469
+from . import m2807
+import pkg4.pkg39.pkg320.m319
+from pkg1.pkg9.pkg79 import m78
+from . import m1973
+from pkg5.pkg47 import m46
+
+
+def helper_7394_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7394_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7394_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7394_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_7394_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,38 @@
+"""Module 4059."""
+import pkg1.pkg11.m10
+from . import m2391
+import pkg1.pkg14.pkg117.m2201
+from . import m3642
+import pkg4.pkg39.pkg320.m736
+from pkg6.pkg50.pkg401 import m400
+import pkg3.pkg28.pkg229.m645
+from pkg5.pkg47 import m46
+import pkg6.pkg52.m51
+
+
+def helper_4059_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4059_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4059_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4059_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,62 @@
+"""Module 7395."""
+import pkg1.pkg16.pkg134.m1384
+from pkg3.pkg26.pkg213 import m4382
+import pkg4.pkg33.pkg265.m1098
+from pkg4.pkg33 import m3368
+import pkg2.pkg23.pkg187.m603
+from . import m6978
+import pkg1.pkg15.pkg124.m123
+from . import m306
+import pkg4.pkg38.m454
+from pkg3.pkg27.pkg224 import m1057
+from . import m3642
+from . import m4059
+
+
+def helper_7395_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7395_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7395_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7395_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_7395_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_7395_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7395_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
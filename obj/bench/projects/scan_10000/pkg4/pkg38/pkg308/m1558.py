@@ -0,0 +1,25 @@
+"""Module 1558."""
+import pkg4.pkg38.pkg307.m723
+from pkg3.pkg27.pkg223 import m222
+import pkg4.pkg37.pkg302.m301
+from . import m1141
+import pkg1.m0
+from pkg7 import m6
+import pkg1.pkg9.m8
+from pkg4 import m3
+from . import m307
+from pkg3.pkg27.pkg221 import m1054
+
+
+def helper_1558_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1558_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
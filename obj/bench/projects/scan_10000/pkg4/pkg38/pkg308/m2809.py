@@ -0,0 +1,44 @@
+"""Module 2809."""
+import pkg3.pkg32.pkg264.m680
+from pkg2.pkg19.pkg155 import m1405
+import pkg3.pkg32.pkg257.m1090
+from pkg2 import m1
+import pkg8.pkg65.m64
+from pkg5.pkg47.pkg383 import m382
+import pkg1.pkg9.pkg74.m73
+from pkg2.pkg17.pkg141 import m557
+
+
+def helper_2809_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2809_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2809_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2809_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_2809_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
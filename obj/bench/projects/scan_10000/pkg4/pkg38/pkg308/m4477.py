@@ -0,0 +1,25 @@
+"""Module 4477."""
+import pkg1.pkg12.m11
+from pkg2.pkg19.pkg159 import m992
+import pkg1.pkg11.pkg96.m95
+from pkg3.pkg31.pkg249 import m1499
+import pkg2.pkg22.pkg180.m179
+from pkg4.pkg35.pkg282 import m281
+import pkg2.pkg23.pkg190.m189
+from pkg2.pkg20.pkg164 import m580
+import pkg5.pkg42.pkg340.m339
+from pkg3.pkg25 import m3360
+
+
+def helper_4477_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4477_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,22 @@
+"""Module 6562."""
+import pkg1.m0
+from pkg6.pkg49.pkg396 import m2480
+import pkg6.pkg50.pkg401.m400
+from . import m4060
+import pkg2.pkg18.pkg145.m5148
+from pkg1.pkg14.pkg120 import m4706
+import pkg1.pkg13.pkg110.m109
+
+
+def helper_6562_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6562_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
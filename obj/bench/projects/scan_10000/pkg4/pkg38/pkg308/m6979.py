@@ -0,0 +1,61 @@
+"""Module 6979."""
+import pkg7.m6
+from pkg3.pkg25.pkg201 import m200
+import pkg1.pkg10.pkg84.m3836
+from pkg2.pkg20.pkg162 import m578
+import pkg4.pkg35.pkg282.m2366
+from pkg4.pkg35.pkg284 import m283
+import pkg1.pkg10.pkg84.m3002
+from pkg3.pkg28.pkg231 import m3149
+import pkg2.pkg24.pkg198.m614
+from pkg5.pkg43.pkg352 import m351
+from . import m3226
+
+
+def helper_6979_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6979_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6979_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6979_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_6979_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_6979_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6979_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
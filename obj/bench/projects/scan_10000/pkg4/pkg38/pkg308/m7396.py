@@ -0,0 +1,45 @@
+"""Module 7396."""
+import pkg4.pkg34.pkg274.m4026
+from . import m307
+import pkg3.pkg31.pkg256.m1923
+from . import m4477
+import pkg1.m0
+from pkg7.pkg64 import m63
+import pkg8.m7
+from pkg1.pkg13.pkg106 import m1356
+from . import m724
+
+
+def helper_7396_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7396_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7396_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7396_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_7396_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,36 @@
+"""Module 1142."""
+import pkg3.pkg29.pkg233.m232
+from . import m308
+import pkg4.pkg40.pkg321.m320
+from pkg5.pkg47.pkg379 import m795
+import pkg2.m1
+from pkg2.pkg19.pkg159 import m158
+import pkg2.pkg24.m23
+
+
+def helper_1142_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1142_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1142_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1142_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,54 @@
+"""Module 1559."""
+import pkg5.pkg46.m45
+from pkg8.pkg71 import m70
+import pkg3.pkg25.pkg203.m202
+from . import m308
+import pkg2.pkg22.pkg180.m596
+from pkg8.pkg65 import m64
+import pkg2.pkg17.pkg139.m555
+from . import m725
+import pkg2.pkg22.m855
+from pkg1 import m0
+import pkg2.pkg20.m436
+
+
+def helper_1559_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1559_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1559_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1559_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_1559_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_1559_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 2810."""
+import pkg3.pkg28.pkg225.m1892
+from pkg1.pkg16.pkg136 import m969
+import pkg7.pkg61.m894
+from pkg3.pkg28.pkg230 import m1063
+
+
+def helper_2810_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2810_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
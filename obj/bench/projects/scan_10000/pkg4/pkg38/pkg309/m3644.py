@@ -0,0 +1,39 @@
+"""Module 3644."""
+from . import m3227
+from pkg2.pkg19.pkg159 import m1826
+import pkg3.m2
+from pkg2.pkg21 import m20
+from . import m308
+from pkg2.pkg17 import m16
+import pkg5.pkg42.pkg341.m3259
+from pkg6.pkg51.pkg413 import m412
+import pkg2.pkg24.pkg193.m192
+from pkg2.pkg21.pkg175 import m591
+
+
+def helper_3644_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3644_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3644_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3644_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
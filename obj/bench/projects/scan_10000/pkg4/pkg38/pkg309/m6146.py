@@ -0,0 +1,61 @@
+"""Module 6146."""
+import pkg4.pkg38.pkg305.m304
+from . import m308
+import pkg4.pkg39.pkg314.m730
+from pkg1.pkg12.pkg100 import m5520
+from . import m3644
+from pkg3.pkg28.pkg231 import m5651
+import pkg7.pkg62.m61
+from . import m1142
+import pkg6.pkg50.m49
+from pkg3.pkg29.pkg235 import m234
+import pkg4.pkg36.pkg293.m1543
+
+
+def helper_6146_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6146_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6146_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6146_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_6146_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_6146_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6146_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,47 @@
+"""Module 6980."""
+from . import m1976
+from pkg3.pkg30 import m29
+import pkg3.pkg29.m862
+from pkg3.pkg29.pkg235 import m3153
+import pkg1.pkg11.pkg91.m1758
+from pkg6.pkg49.pkg393 import m392
+import pkg4.pkg37.m870
+from pkg1 import m0
+import pkg1.pkg11.pkg95.m94
+from pkg5.pkg45 import m1295
+import pkg5.pkg46.pkg371.m2038
+
+
+def helper_6980_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6980_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6980_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6980_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_6980_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
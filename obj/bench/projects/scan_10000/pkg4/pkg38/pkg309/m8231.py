@@ -0,0 +1,14 @@
+"""Module 8231."""
+import pkg4.pkg33.pkg265.m681
+from pkg5 import m7927
+from . import m2810
+from pkg3.pkg29.pkg236 import m2737
+import pkg5.pkg41.pkg335.m334
+from . import m6563
+
+
+def helper_8231_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
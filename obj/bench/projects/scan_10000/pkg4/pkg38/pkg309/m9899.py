@@ -0,0 +1,48 @@
+"""Module 9899."""
+import pkg2.pkg19.pkg157.m8079
+from pkg7.pkg64 import m3399
+import pkg3.pkg25.pkg206.m6043
+from pkg1 import m0
+from . import m8231
+from pkg1.pkg10.pkg86 import m4672
+from . import m6146
+from pkg3.pkg28.pkg228 import m6065
+import pkg7.pkg62.m7984
+from pkg2.pkg23.pkg191 import m607
+import pkg5.pkg47.pkg383.m799
+from pkg3.pkg29 import m7534
+
+
+def helper_9899_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9899_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9899_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9899_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_9899_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 3645."""
+import pkg5.pkg44.pkg355.m2022
+from pkg3.pkg28.pkg227 import m1060
+import pkg2.pkg20.pkg163.m162
+from pkg1.pkg16.pkg136 import m1386
+import pkg3.pkg26.pkg214.m213
+
+
+def helper_3645_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3645_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,6 @@
+"""Module 5730."""
+import pkg3.m2
+from pkg1.pkg9.pkg76 import m75
+from . import m1560
+from pkg6.pkg51.pkg411 import m3329
+import pkg5.pkg45.m878
@@ -0,0 +1,24 @@
+"""Module 1561."""
+import pkg3.pkg29.pkg234.m1067
+from pkg5.pkg41.pkg329 import m328
+from . import m727
+from pkg2.pkg21.pkg169 import m168
+import pkg1.pkg12.pkg104.m520
+from pkg1.pkg10.pkg83 import m82
+import pkg7.m6
+from . import m1144
+import pkg1.pkg13.pkg106.m939
+
+
+def helper_1561_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1561_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,14 @@
+"""Module 310."""
+import pkg1.pkg12.pkg98.m97
+from pkg3.pkg26.pkg211 import m210
+import pkg1.pkg10.pkg81.m80
+from pkg1 import m0
+import pkg1.pkg16.pkg136.m135
+from pkg1.pkg10.pkg85 import m84
+
+
+def helper_310_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,33 @@
+"""Module 3229."""
+from . import m1561
+from pkg4.pkg34.pkg280 import m279
+import pkg6.pkg49.m48
+from pkg3 import m2
+from . import m2812
+from pkg4.pkg39.pkg315 import m314
+from . import m310
+from pkg1.pkg13.pkg107 import m106
+import pkg3.pkg26.pkg209.m3127
+from pkg2.pkg20.pkg164 import m1414
+import pkg3.pkg30.pkg241.m2325
+
+
+def helper_3229_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3229_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3229_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
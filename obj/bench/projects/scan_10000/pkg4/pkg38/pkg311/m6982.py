@@ -0,0 +1,61 @@
+"""Module 6982."""
+import pkg1.pkg9.m8
+from pkg3.pkg25.pkg204 import m4790
+import pkg4.pkg35.m5455
+from pkg3.pkg26.pkg211 import m210
+from . import m5314
+from pkg5.pkg48.pkg389 import m1639
+import pkg2.pkg20.pkg166.m165
+from pkg5.pkg43.pkg351 import m2852
+import pkg2.pkg17.pkg143.m559
+from pkg1.pkg11.pkg96 import m1763
+from . import m1144
+
+
+def helper_6982_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6982_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6982_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6982_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_6982_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_6982_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6982_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
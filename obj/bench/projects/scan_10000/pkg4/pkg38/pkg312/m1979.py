@@ -0,0 +1,45 @@
+"""Module 1979."""
+import pkg3.pkg26.pkg211.m1878
+from pkg6 import m5
+import pkg4.pkg40.pkg326.m325
+from pkg4.pkg33.pkg271 import m270
+import pkg2.pkg19.pkg160.m159
+from pkg3.pkg31.pkg250 import m666
+import pkg6.pkg50.m49
+from pkg4.pkg38 import m1288
+from . import m311
+
+
+def helper_1979_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1979_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1979_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1979_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_1979_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
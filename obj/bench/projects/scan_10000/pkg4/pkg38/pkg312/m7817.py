@@ -0,0 +1,38 @@
+"""Module 7817."""
+import pkg2.pkg19.pkg154.m153
+from pkg5.pkg41 import m874
+import pkg1.m0
+from pkg5.pkg41.pkg329 import m745
+import pkg2.pkg20.pkg167.m166
+from pkg3.pkg25.pkg207 import m5210
+import pkg1.pkg11.m10
+from pkg2.pkg22.pkg180 import m6017
+from . import m4481
+
+
+def helper_7817_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7817_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7817_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7817_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
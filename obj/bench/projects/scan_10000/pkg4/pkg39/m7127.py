@@ -0,0 +1,19 @@
+"""Module 7127."""
+import pkg2.pkg23.pkg187.m6858
+from pkg1.pkg9.pkg77 import m6331
+import pkg3.pkg27.pkg218.m217
+from pkg4.pkg35.pkg281 import m3616
+
+
+def helper_7127_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7127_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,40 @@
+"""Module 872."""
+import pkg3.pkg32.m31
+from pkg2.pkg20.pkg165 import m164
+import pkg1.pkg15.pkg125.m541
+from pkg5.pkg41.pkg335 import m751
+import pkg2.pkg18.pkg150.m149
+from pkg1.pkg16 import m15
+from . import m455
+from pkg2.pkg23.pkg185 import m184
+import pkg4.pkg34.pkg275.m274
+from pkg6 import m5
+from . import m38
+
+
+def helper_872_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_872_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_872_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_872_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
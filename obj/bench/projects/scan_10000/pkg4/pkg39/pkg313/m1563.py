@@ -0,0 +1,52 @@
+"""Module 1563."""
+import pkg5.pkg42.pkg343.m342
+from pkg5.pkg43.pkg351 import m350
+import pkg4.pkg40.pkg328.m744
+from pkg1.pkg16.pkg133 import m132
+from . import m1146
+from pkg1.pkg16.pkg132 import m965
+from . import m312
+from pkg3.pkg25.pkg206 import m622
+import pkg2.pkg19.pkg157.m156
+
+
+def helper_1563_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1563_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1563_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1563_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_1563_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_1563_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,14 @@
+"""Module 6984."""
+import pkg2.pkg23.pkg192.m608
+from pkg5.pkg41.pkg332 import m4918
+import pkg3.pkg31.pkg255.m254
+from pkg2.pkg18.pkg149 import m2233
+import pkg1.pkg10.m3345
+from pkg5.pkg46 import m45
+
+
+def helper_6984_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 9486."""
+import pkg1.pkg16.pkg130.m129
+from pkg3 import m2
+import pkg3.pkg30.pkg246.m8585
+from . import m6567
+
+
+def helper_9486_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9486_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9486_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
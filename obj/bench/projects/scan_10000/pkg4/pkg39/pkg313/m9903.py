@@ -0,0 +1,55 @@
+"""Module 9903."""
+import pkg2.m1
+from pkg3.pkg25.pkg203 import m4372
+import pkg3.pkg26.pkg214.m5634
+from pkg6.pkg50.pkg407 import m2074
+import pkg3.pkg32.pkg260.m8182
+from pkg1.pkg10.pkg81 import m80
+import pkg4.pkg38.pkg309.m725
+from pkg2 import m3337
+import pkg3.pkg32.pkg258.m5678
+from pkg1.pkg13.pkg109 import m9699
+import pkg4.pkg38.m37
+from . import m5733
+
+
+def helper_9903_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9903_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9903_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9903_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_9903_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_9903_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
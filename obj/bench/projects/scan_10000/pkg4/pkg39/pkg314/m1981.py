@@ -0,0 +1,31 @@
+"""Module 1981."""
+import pkg3.pkg31.m30
+from pkg2.pkg19.pkg154 import m570
+import pkg2.pkg20.pkg167.m1834
+from . import m313
+import pkg2.pkg24.m23
+from pkg5.pkg41.pkg335 import m334
+import pkg3.pkg25.pkg205.m204
+from pkg3.pkg29.pkg238 import m237
+import pkg1.pkg14.pkg115.m531
+
+
+def helper_1981_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1981_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1981_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
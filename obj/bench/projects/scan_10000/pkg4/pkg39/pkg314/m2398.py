@@ -0,0 +1,39 @@
+"""Module 2398."""
+import pkg6.pkg49.pkg393.m809
+from pkg1.pkg14.pkg118 import m1368
+import pkg1.m0
+from pkg2.pkg17.pkg140 import m139
+import pkg1.pkg14.pkg114.m2198
+from . import m1147
+from . import m730
+from pkg4.pkg37 import m870
+import pkg4.pkg37.pkg298.m297
+from pkg2.pkg17.pkg140 import m556
+
+
+def helper_2398_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2398_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2398_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2398_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
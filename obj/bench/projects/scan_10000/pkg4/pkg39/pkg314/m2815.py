@@ -0,0 +1,8 @@
+"""Module 2815."""
+import pkg1.pkg15.pkg123.m1373
+from . import m2398
+from . import m1147
+from . import m1981
+import pkg2.m1
+from pkg1.pkg15.pkg126 import m959
+import pkg4.pkg40.m39
@@ -0,0 +1,28 @@
+"""Module 5317."""
+from . import m2815
+from pkg1.pkg13.pkg106 import m3024
+import pkg5.pkg41.m1708
+from pkg2.pkg22.pkg181 import m597
+import pkg1.pkg10.m426
+from pkg4 import m3
+
+
+def helper_5317_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5317_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5317_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 5734."""
+import pkg3.pkg28.pkg230.m646
+from pkg2.pkg20.pkg162 import m1829
+import pkg1.pkg15.m14
+from pkg4.pkg37.pkg300 import m2384
+import pkg2.pkg20.pkg165.m5168
+from pkg5.pkg42.pkg344 import m4096
+from . import m2398
+from pkg1 import m0
+import pkg3.pkg26.pkg214.m4383
+from pkg2.pkg21.pkg174 import m4760
+from . import m3232
+
+
+def helper_5734_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,55 @@
+"""Module 6151."""
+import pkg6.pkg51.pkg412.m828
+from . import m4900
+import pkg1.pkg13.pkg112.m111
+from . import m3232
+import pkg3.pkg28.m2112
+from . import m1981
+from . import m5317
+from pkg2.pkg23.pkg187 import m4773
+import pkg5.pkg42.pkg337.m5340
+from pkg1.pkg12.pkg98 import m97
+import pkg1.pkg11.pkg90.m4259
+from pkg4.pkg33.pkg268 import m2352
+
+
+def helper_6151_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6151_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6151_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6151_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_6151_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_6151_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
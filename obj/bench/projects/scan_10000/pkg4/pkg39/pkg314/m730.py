@@ -0,0 +1,2 @@
+"""Module 730."""
+import pkg5.m4
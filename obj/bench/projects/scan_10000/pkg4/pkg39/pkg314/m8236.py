@@ -0,0 +1,19 @@
+"""Module 8236."""
+import pkg4.pkg40.m5460
+from pkg1.pkg13.pkg108 import m107
+import pkg4.m3
+from pkg1 import m0
+
+
+def helper_8236_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8236_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,48 @@
+"""Module 9904."""
+from . import m3232
+from pkg2.pkg17.pkg139 import m7644
+from . import m730
+from . import m9487
+import pkg4.pkg36.m35
+from . import m8653
+import pkg1.pkg15.pkg126.m2627
+from . import m4066
+import pkg1.m0
+from pkg3.pkg29.pkg238 import m3990
+from . import m1981
+from pkg8.pkg66 import m65
+
+
+def helper_9904_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9904_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9904_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9904_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_9904_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 1982."""
+import pkg3.pkg31.pkg251.m1084
+from . import m314
+import pkg6.pkg49.pkg395.m394
+from pkg1.pkg12.pkg99 import m515
+from . import m1148
+from pkg2.pkg23.pkg190 import m1857
+import pkg6.m5
+from pkg5 import m4
+import pkg1.m0
+from pkg1.pkg10.pkg88 import m1338
+
+
+def helper_1982_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1982_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,23 @@
+"""Module 2816."""
+import pkg1.m0
+from pkg1.pkg13.pkg107 import m523
+from . import m314
+from pkg1.pkg12.pkg100 import m1350
+import pkg3.pkg30.pkg244.m1494
+from pkg8 import m7
+from . import m1982
+from . import m1565
+
+
+def helper_2816_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2816_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
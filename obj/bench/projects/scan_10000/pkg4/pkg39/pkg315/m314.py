@@ -0,0 +1,34 @@
+"""Module 314."""
+import pkg1.pkg16.pkg136.m135
+from pkg6 import m5
+import pkg3.m2
+from pkg4.pkg40 import m39
+import pkg2.pkg17.pkg138.m137
+from pkg7.pkg59 import m58
+import pkg5.m4
+from pkg5.pkg47 import m46
+import pkg1.pkg15.pkg128.m127
+from pkg1.pkg15 import m14
+import pkg3.pkg32.pkg258.m257
+from pkg3.pkg27 import m26
+
+
+def helper_314_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_314_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_314_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 3650."""
+import pkg6.pkg51.pkg409.m1659
+from pkg2.pkg17.pkg142 import m141
+import pkg4.pkg33.pkg266.m682
+from . import m3233
+from . import m1982
+from pkg1.pkg16.pkg135 import m134
+import pkg4.pkg37.pkg299.m1966
+from pkg3.pkg27.pkg218 import m634
+import pkg3.pkg31.m30
+
+
+def helper_3650_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 6986."""
+import pkg1.pkg12.pkg100.m3852
+from pkg1.pkg10.pkg81 import m3833
+import pkg3.pkg29.pkg239.m238
+from pkg6.pkg51.pkg412 import m3747
+import pkg2.pkg24.pkg194.m3946
+from pkg6.pkg51.pkg415 import m1248
+import pkg4.pkg34.pkg277.m276
+from . import m6152
+import pkg7.pkg63.m4649
+from pkg4.pkg34.pkg276 import m275
+import pkg2.pkg18.pkg146.m5566
+from pkg4.pkg33 import m32
+
+
+def helper_6986_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
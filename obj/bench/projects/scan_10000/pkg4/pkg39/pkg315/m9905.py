@@ -0,0 +1,46 @@
+"""Module 9905."""
+from . import m1148
+from pkg3.pkg29.pkg238 import m8160
+from . import m7403
+from pkg3.pkg31.pkg256 import m255
+from . import m7820
+from pkg4.pkg39 import m38
+import pkg3.pkg31.m864
+from . import m8237
+import pkg2.pkg22.pkg179.m178
+from . import m731
+
+
+def helper_9905_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9905_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9905_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9905_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_9905_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,14 @@
+"""Module 5319."""
+import pkg2.pkg24.pkg197.m1030
+from pkg1.pkg10 import m9
+from . import m3651
+from pkg3.pkg27 import m26
+import pkg5.pkg48.pkg392.m391
+from pkg3.pkg29.pkg239 import m4408
+
+
+def helper_5319_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,12 @@
+"""Module 6570."""
+import pkg1.pkg11.pkg92.m1759
+from pkg2.pkg22.pkg177 import m3512
+import pkg1.pkg15.pkg126.m1793
+from pkg2.pkg22 import m2106
+
+
+def helper_6570_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,2 @@
+"""Module 9072."""
+import pkg2.pkg17.pkg137.m6808
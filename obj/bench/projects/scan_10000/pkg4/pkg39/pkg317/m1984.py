@@ -0,0 +1,27 @@
+"""Module 1984."""
+from . import m733
+from pkg1.pkg12.pkg102 import m518
+import pkg3.pkg25.m24
+from pkg5.pkg44.pkg357 import m1190
+import pkg2.pkg20.pkg168.m167
+
+
+def helper_1984_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1984_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1984_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
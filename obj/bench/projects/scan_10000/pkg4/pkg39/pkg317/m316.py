@@ -0,0 +1,23 @@
+"""Module 316."""
+import pkg2.pkg23.pkg190.m189
+from pkg2 import m1
+import pkg3.pkg31.pkg252.m251
+from pkg3.pkg25 import m24
+import pkg1.m0
+from pkg2.pkg20 import m19
+import pkg8.m7
+from pkg1.pkg14.pkg120 import m119
+
+
+def helper_316_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_316_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,24 @@
+"""Module 4069."""
+import pkg5.pkg47.pkg380.m2047
+from pkg2.pkg17.pkg143 import m1393
+import pkg7.pkg57.m3392
+from pkg7.pkg63 import m62
+import pkg4.pkg35.m2953
+from pkg7.pkg64 import m480
+import pkg1.pkg15.pkg122.m1789
+from pkg2.pkg21.pkg171 import m170
+from . import m1984
+
+
+def helper_4069_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4069_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,47 @@
+"""Module 8239."""
+from . import m7405
+from . import m1984
+import pkg4.pkg38.pkg309.m725
+from . import m4486
+from . import m5737
+from . import m4069
+import pkg1.pkg11.m10
+from pkg1.pkg11.pkg91 import m507
+import pkg6.pkg49.pkg399.m1232
+from pkg2.pkg19.pkg154 import m5157
+import pkg5.pkg46.pkg374.m1624
+
+
+def helper_8239_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8239_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8239_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8239_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_8239_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,28 @@
+"""Module 9907."""
+import pkg2.pkg18.pkg148.m3066
+from pkg3.pkg32.pkg257 import m256
+import pkg1.pkg10.pkg84.m1334
+from pkg6.pkg49.pkg393 import m4562
+from . import m2401
+from pkg2.pkg24 import m440
+
+
+def helper_9907_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9907_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9907_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 3653."""
+import pkg2.pkg18.pkg151.m567
+from pkg5 import m4
+from . import m1151
+from pkg2.pkg19.pkg158 import m157
+from . import m3236
+
+
+def helper_3653_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3653_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3653_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
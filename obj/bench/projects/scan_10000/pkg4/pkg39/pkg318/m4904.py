@@ -0,0 +1,31 @@
+"""Module 4904."""
+from . import m2402
+from . import m1985
+import pkg6.pkg50.pkg406.m405
+from pkg2.pkg20.pkg165 import m581
+import pkg1.pkg12.pkg99.m932
+from pkg1 import m0
+import pkg1.pkg15.pkg127.m3462
+from pkg1.pkg12.pkg104 import m2605
+from . import m1151
+
+
+def helper_4904_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4904_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4904_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,51 @@
+"""Module 7406."""
+import pkg2.pkg22.pkg179.m1429
+from pkg2.pkg18.pkg147 import m146
+import pkg4.pkg34.pkg279.m1112
+from pkg7.pkg59 import m475
+import pkg3.pkg31.pkg253.m2754
+from pkg1.pkg14.pkg113 import m3031
+from . import m4904
+from pkg3.pkg29.pkg236 import m235
+
+
+def helper_7406_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7406_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7406_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7406_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_7406_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_7406_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,8 @@
+"""Module 1152."""
+import pkg6.pkg53.m52
+from . import m318
+from . import m735
+from pkg1.pkg10 import m9
+import pkg1.pkg15.m14
+from pkg2.pkg19.pkg159 import m158
+import pkg2.pkg18.pkg152.m151
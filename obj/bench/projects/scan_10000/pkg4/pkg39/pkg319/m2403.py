@@ -0,0 +1,17 @@
+"""Module 2403."""
+import pkg3.m2
+from pkg1.pkg11 import m427
+import pkg2.pkg24.pkg198.m1865
+from pkg2.pkg23.pkg185 import m184
+import pkg2.pkg23.pkg189.m605
+from pkg3.pkg32 import m1282
+import pkg4.pkg33.m1700
+from pkg1.pkg11.pkg89 import m88
+import pkg3.pkg28.pkg228.m227
+
+
+def helper_2403_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
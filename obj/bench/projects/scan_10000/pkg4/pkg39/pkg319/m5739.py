@@ -0,0 +1,55 @@
+"""Module 5739."""
+import pkg5.pkg41.pkg330.m3248
+from pkg2.pkg18 import m2519
+import pkg4.pkg33.pkg268.m684
+from pkg1.pkg16.pkg131 import m2215
+import pkg1.pkg11.pkg94.m93
+from . import m1986
+import pkg5.m4
+from . import m4905
+import pkg3.m2
+from pkg3.pkg31 import m447
+import pkg2.pkg23.pkg185.m1852
+from pkg6.pkg50.pkg406 import m1239
+
+
+def helper_5739_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5739_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5739_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5739_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_5739_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_5739_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,5 @@
+"""Module 735."""
+import pkg1.m0
+from pkg4.pkg38.pkg312 import m311
+import pkg5.pkg48.m47
+from pkg8.pkg72 import m71
@@ -0,0 +1,8 @@
+"""Module 8241."""
+import pkg3.pkg26.pkg209.m625
+from pkg1.pkg12 import m11
+import pkg2.pkg19.pkg157.m1407
+from pkg1 import m0
+from . import m2820
+from pkg3.pkg28.pkg226 import m225
+import pkg7.pkg57.m473
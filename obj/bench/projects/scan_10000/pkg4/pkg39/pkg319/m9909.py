@@ -0,0 +1,52 @@
+"""Module 9909."""
+import pkg2.pkg24.pkg197.m7285
+from pkg4.pkg39.pkg316 import m6153
+import pkg3.pkg26.pkg214.m1047
+from pkg5.pkg42.pkg344 import m2428
+import pkg2.pkg20.pkg162.m578
+from pkg3.pkg27.pkg217 import m3552
+import pkg5.pkg46.pkg375.m791
+from pkg1 import m0
+from . import m3654
+
+
+def helper_9909_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9909_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9909_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9909_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_9909_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_9909_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
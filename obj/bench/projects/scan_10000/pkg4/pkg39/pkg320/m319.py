@@ -0,0 +1,26 @@
+"""Module 319."""
+import pkg1.pkg14.m13
+from pkg1.pkg15.pkg122 import m121
+import pkg1.pkg13.m12
+from pkg5.pkg46 import m45
+
+
+def helper_319_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_319_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_319_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
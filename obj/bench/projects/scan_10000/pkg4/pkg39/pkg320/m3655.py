@@ -0,0 +1,36 @@
+"""Module 3655."""
+from . import m3238
+from pkg1 import m0
+import pkg5.pkg46.pkg372.m371
+from pkg3.pkg27 import m860
+import pkg4.pkg38.pkg311.m1978
+from . import m2404
+import pkg1.pkg10.pkg82.m81
+
+
+def helper_3655_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3655_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3655_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3655_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
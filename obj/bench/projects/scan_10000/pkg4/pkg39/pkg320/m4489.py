@@ -0,0 +1,23 @@
+"""Module 4489."""
+import pkg1.pkg10.pkg81.m3416
+from pkg1.pkg12.pkg97 import m2181
+import pkg2.pkg22.pkg177.m2261
+from . import m3655
+from . import m1153
+from pkg6.pkg52.pkg417 import m2501
+import pkg5.pkg45.pkg364.m3282
+from pkg4.pkg36.pkg289 import m705
+
+
+def helper_4489_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4489_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
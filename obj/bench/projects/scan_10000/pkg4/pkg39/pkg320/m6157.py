@@ -0,0 +1,32 @@
+"""Module 6157."""
+from . import m2821
+from pkg2.pkg22.pkg177 import m1844
+import pkg1.pkg11.m2929
+from pkg4.pkg34 import m3369
+import pkg1.pkg15.pkg121.m120
+from pkg5.pkg47.pkg378 import m2045
+import pkg6.pkg51.m1301
+from pkg2.pkg18.pkg152 import m3070
+import pkg5.pkg47.pkg381.m4967
+from . import m5323
+
+
+def helper_6157_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6157_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6157_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,24 @@
+"""Module 8659."""
+import pkg5.pkg44.pkg357.m1607
+from pkg6.pkg51.pkg412 import m2496
+import pkg4.pkg39.pkg313.m2397
+from pkg7.pkg60 import m59
+import pkg6.pkg50.pkg403.m1653
+from pkg4 import m3
+import pkg1.pkg15.m1265
+from pkg4.pkg37.pkg303 import m302
+import pkg3.pkg30.pkg247.m246
+
+
+def helper_8659_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8659_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 9493."""
+import pkg6.pkg51.pkg411.m8333
+from pkg2.pkg19.pkg156 import m155
+from . import m6574
+from pkg1.pkg15.pkg124 import m123
+import pkg2.pkg21.pkg170.m586
+
+
+def helper_9493_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9493_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9493_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 3375."""
+from . import m456
+from pkg6.pkg54 import m53
+import pkg3.pkg30.pkg243.m242
+from pkg1.pkg16.pkg129 import m545
+import pkg1.pkg10.pkg86.m85
+from pkg2.pkg21.pkg174 import m590
+import pkg2.pkg23.pkg187.m186
+from pkg4.pkg39.pkg316 import m1983
+import pkg5.pkg42.pkg343.m3261
+from pkg4.pkg33.pkg270 import m2771
+
+
+def helper_3375_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3375_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,8 @@
+"""Module 456."""
+import pkg1.pkg13.pkg107.m106
+from . import m39
+import pkg1.pkg10.m9
+from pkg5.pkg44 import m43
+import pkg6.pkg51.m50
+from pkg1 import m0
+import pkg1.pkg10.pkg81.m80
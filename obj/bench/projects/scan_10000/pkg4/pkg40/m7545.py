@@ -0,0 +1,26 @@
+"""Module 7545."""
+import pkg1.m0
+from pkg5.pkg48.pkg390 import m806
+import pkg2.pkg18.pkg145.m1812
+from pkg2.pkg22 import m21
+
+
+def helper_7545_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7545_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7545_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
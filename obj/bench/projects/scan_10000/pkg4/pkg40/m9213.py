@@ -0,0 +1,52 @@
+"""Module 9213."""
+from . import m5460
+from pkg8.pkg65 import m64
+import pkg3.pkg26.pkg210.m5213
+from pkg5.pkg48.pkg388 import m387
+import pkg1.m0
+from pkg2.pkg20.pkg161 import m1828
+import pkg1.pkg16.pkg133.m132
+from pkg2.pkg21.pkg174 import m3092
+import pkg2.pkg20.pkg162.m4331
+
+
+def helper_9213_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9213_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9213_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9213_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_9213_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_9213_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,16 @@
+"""Module 4073."""
+import pkg5.pkg48.pkg386.m385
+from pkg5.pkg44 import m460
+import pkg2.pkg19.pkg154.m153
+from pkg5.pkg43.pkg352 import m2853
+import pkg5.pkg47.pkg381.m2882
+from pkg2.pkg17.pkg140 import m556
+import pkg2.pkg23.pkg192.m1859
+from pkg3.pkg27.pkg217 import m216
+
+
+def helper_4073_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,41 @@
+"""Module 5741."""
+from . import m2822
+from pkg6.pkg49.pkg394 import m3729
+import pkg4.pkg40.m2541
+from pkg3.pkg29.pkg240 import m1073
+import pkg4.pkg33.pkg271.m1521
+from . import m4490
+from . import m1571
+from . import m2405
+from . import m320
+from pkg3.pkg32.pkg263 import m3598
+import pkg3.pkg30.pkg245.m244
+from pkg2.pkg22.pkg180 import m596
+
+
+def helper_5741_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5741_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5741_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5741_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
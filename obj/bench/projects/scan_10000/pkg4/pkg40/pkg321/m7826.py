@@ -0,0 +1,24 @@
+"""Module 7826."""
+import pkg6.pkg50.pkg408.m1658
+from pkg5.pkg43.pkg345 import m6182
+import pkg4.m3
+from pkg5.pkg47.pkg380 import m1213
+import pkg2.pkg19.pkg159.m1409
+from pkg4.pkg37.pkg302 import m6139
+import pkg4.pkg35.pkg285.m4454
+from pkg6.pkg50 import m466
+from . import m737
+
+
+def helper_7826_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7826_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,54 @@
+"""Module 8660."""
+import pkg1.pkg13.m12
+from . import m6575
+import pkg1.pkg13.pkg108.m107
+from pkg1 import m0
+import pkg2.pkg22.pkg179.m4348
+from pkg3.pkg27.pkg220 import m3138
+import pkg8.pkg72.m71
+from pkg7 import m6
+import pkg6.pkg50.pkg403.m1653
+from pkg3.pkg29.pkg240 import m656
+import pkg3.pkg27.pkg221.m3139
+
+
+def helper_8660_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8660_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8660_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8660_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_8660_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_8660_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
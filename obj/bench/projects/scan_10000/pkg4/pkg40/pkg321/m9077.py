@@ -0,0 +1,40 @@
+"""Module 9077."""
+import pkg7.pkg58.m1725
+from . import m4073
+import pkg4.m3
+from . import m737
+import pkg1.pkg9.m8
+from pkg1 import m0
+import pkg5.pkg43.m876
+from pkg3.pkg26.pkg213 import m1046
+import pkg5.pkg45.pkg364.m780
+from pkg5.pkg43.pkg349 import m348
+from . import m4907
+
+
+def helper_9077_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9077_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9077_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9077_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
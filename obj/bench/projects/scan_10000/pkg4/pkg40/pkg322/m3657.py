@@ -0,0 +1,18 @@
+"""Module 3657."""
+import pkg5.pkg42.m41
+from pkg4 import m3
+from . import m321
+from pkg2.pkg23.pkg190 import m189
+from . import m1989
+from pkg1.pkg9.pkg78 import m494
+import pkg1.m0
+from pkg1.pkg13 import m12
+import pkg1.pkg12.pkg99.m1349
+from pkg5.pkg41.pkg335 import m334
+
+
+def helper_3657_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,15 @@
+"""Module 6159."""
+from . import m2823
+from pkg2.pkg23.pkg185 import m2686
+import pkg3.pkg30.m29
+from pkg5.pkg47.pkg382 import m798
+import pkg5.pkg45.m44
+from pkg5 import m4
+import pkg2.pkg20.pkg167.m1834
+
+
+def helper_6159_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
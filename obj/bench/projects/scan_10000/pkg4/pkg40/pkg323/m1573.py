@@ -0,0 +1,32 @@
+"""Module 1573."""
+import pkg1.pkg11.pkg95.m94
+from . import m1156
+import pkg2.pkg20.m19
+from pkg4 import m3
+import pkg2.pkg24.pkg195.m194
+from pkg5.pkg42.pkg338 import m754
+import pkg2.pkg19.pkg157.m1407
+from pkg1.pkg12.pkg99 import m98
+import pkg2.pkg19.pkg155.m154
+from pkg1.pkg13.pkg105 import m104
+
+
+def helper_1573_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1573_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1573_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,24 @@
+"""Module 1990."""
+from . import m322
+from pkg1.pkg10 import m9
+from . import m1573
+from . import m1156
+import pkg2.m1
+from pkg3.pkg26 import m25
+import pkg4.pkg39.pkg317.m316
+from pkg8 import m7
+import pkg5.pkg42.pkg341.m757
+
+
+def helper_1990_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1990_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
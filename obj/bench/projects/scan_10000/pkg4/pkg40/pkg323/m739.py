@@ -0,0 +1,30 @@
+"""Module 739."""
+import pkg1.pkg13.pkg107.m106
+from pkg1.pkg11 import m10
+import pkg1.pkg13.pkg110.m109
+from pkg1.pkg15.pkg125 import m124
+from . import m322
+from pkg4.pkg40.pkg326 import m325
+import pkg1.pkg15.pkg124.m123
+from pkg4.pkg38 import m37
+
+
+def helper_739_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_739_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_739_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
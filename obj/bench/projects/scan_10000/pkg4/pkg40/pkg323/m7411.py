@@ -0,0 +1,35 @@
+"""Module 7411."""
+import pkg4.pkg39.m38
+from pkg2.pkg24.pkg199 import m615
+from . import m5326
+from pkg4.pkg34.pkg275 import m4027
+import pkg4.pkg37.m5457
+from pkg5.pkg45.pkg368 import m784
+
+
+def helper_7411_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7411_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7411_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7411_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,44 @@
+"""Module 2825."""
+import pkg2.pkg21.pkg173.m589
+from pkg2.pkg20.pkg164 import m163
+import pkg4.pkg33.pkg272.m271
+from pkg1.pkg15.pkg126 import m125
+import pkg2.pkg17.pkg144.m143
+from pkg5.pkg47 import m463
+import pkg1.pkg9.pkg80.m79
+from pkg5.pkg43.pkg349 import m765
+
+
+def helper_2825_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2825_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2825_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2825_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_2825_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
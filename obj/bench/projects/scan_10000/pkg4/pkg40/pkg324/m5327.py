@@ -0,0 +1,28 @@
+"""Module 5327."""
+import pkg1.m0
+from . import m740
+import pkg3.pkg29.pkg234.m1484
+from pkg2.pkg21.pkg174 import m1424
+import pkg4.pkg39.pkg317.m1984
+from pkg1.pkg15.pkg122 import m121
+
+
+def helper_5327_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5327_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5327_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
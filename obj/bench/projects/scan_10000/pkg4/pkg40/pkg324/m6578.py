@@ -0,0 +1,29 @@
+"""Module 6578."""
+import pkg2.pkg23.pkg186.m2687
+from . import m3242
+import pkg1.pkg10.pkg81.m914
+from . import m6161
+import pkg2.pkg22.pkg182.m598
+from pkg1 import m0
+import pkg8.pkg71.m904
+
+
+def helper_6578_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6578_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6578_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 7412."""
+import pkg7.pkg60.m59
+from pkg5.pkg44.pkg354 import m353
+import pkg1.pkg16.pkg133.m966
+from . import m2408
+import pkg3.pkg31.pkg254.m5674
+from pkg4.pkg39.pkg318 import m317
+import pkg8.pkg69.m6740
+from pkg6.pkg50.pkg402 import m818
+import pkg1.pkg14.pkg116.m2617
+from . import m4910
+
+
+def helper_7412_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 1575."""
+import pkg4.pkg37.m36
+from pkg3.pkg32 import m865
+import pkg3.pkg27.pkg221.m220
+from pkg6.pkg54 import m53
+import pkg2.pkg22.m21
+from . import m324
+import pkg1.pkg9.pkg79.m78
+from pkg5.pkg41.pkg330 import m746
+import pkg3.pkg27.pkg219.m635
+from pkg4.pkg35.pkg286 import m702
+
+
+def helper_1575_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
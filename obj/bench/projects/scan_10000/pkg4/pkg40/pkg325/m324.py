@@ -0,0 +1,19 @@
+"""Module 324."""
+import pkg2.pkg20.pkg162.m161
+from pkg3.pkg25.pkg204 import m203
+import pkg5.m4
+from pkg4.pkg36 import m35
+
+
+def helper_324_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_324_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
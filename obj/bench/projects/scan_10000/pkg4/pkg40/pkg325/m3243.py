@@ -0,0 +1,45 @@
+"""Module 3243."""
+import pkg4.pkg38.pkg307.m306
+from . import m2826
+from . import m324
+from pkg1.pkg9.pkg78 import m1745
+import pkg4.pkg39.m38
+from pkg5.pkg43.pkg348 import m764
+import pkg2.m1
+from pkg2.pkg20.pkg167 import m166
+import pkg6.pkg51.pkg410.m409
+
+
+def helper_3243_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3243_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3243_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3243_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_3243_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 3660."""
+import pkg3.pkg28.pkg229.m228
+from pkg1.pkg10.pkg86 import m85
+import pkg2.pkg21.pkg176.m1426
+from pkg1.pkg9.pkg79 import m78
+from . import m2826
+from pkg5.pkg44.pkg355 import m771
+import pkg5.m4
+from pkg4.pkg35 import m34
+import pkg1.pkg9.pkg79.m495
+from pkg2.pkg20 import m19
+
+
+def helper_3660_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3660_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,46 @@
+"""Module 5745."""
+import pkg5.pkg41.pkg335.m4921
+from pkg5 import m4
+from . import m5328
+from pkg2.pkg22.pkg182 import m181
+import pkg4.pkg39.m38
+from pkg5.pkg44.pkg356 import m355
+import pkg4.pkg35.m34
+from pkg4.pkg40.pkg323 import m2824
+import pkg6.pkg56.m55
+from . import m741
+
+
+def helper_5745_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5745_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5745_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5745_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_5745_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
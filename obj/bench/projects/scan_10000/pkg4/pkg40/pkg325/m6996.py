@@ -0,0 +1,23 @@
+"""Module 6996."""
+from . import m3243
+from pkg8 import m7
+import pkg1.pkg11.pkg91.m1341
+from pkg3.pkg25 import m24
+from . import m1158
+from pkg4.pkg40.pkg327 import m6581
+from . import m1575
+from . import m2826
+
+
+def helper_6996_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6996_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 7830."""
+import pkg4.pkg36.pkg293.m1543
+from pkg2.pkg23.pkg185 import m1018
+import pkg5.pkg48.pkg391.m7062
+from . import m1158
+from . import m324
+from pkg2.pkg22.pkg180 import m3098
+import pkg6.pkg49.pkg397.m1230
+from . import m6996
+import pkg1.pkg9.pkg79.m78
+from pkg2.pkg20.pkg161 import m2245
+
+
+def helper_7830_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
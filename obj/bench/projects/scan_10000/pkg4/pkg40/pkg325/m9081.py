@@ -0,0 +1,22 @@
+"""Module 9081."""
+import pkg5.pkg46.pkg371.m5374
+from pkg5.pkg46.pkg372 import m3707
+from . import m7413
+from pkg2.pkg19.pkg153 import m1403
+import pkg2.pkg21.pkg174.m173
+from pkg5.pkg47.pkg383 import m799
+import pkg3.pkg27.pkg217.m1884
+
+
+def helper_9081_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9081_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
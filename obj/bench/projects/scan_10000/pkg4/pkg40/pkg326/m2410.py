@@ -0,0 +1,32 @@
+"""Module 2410."""
+import pkg2.m1
+from pkg3.pkg29 import m28
+import pkg3.pkg29.pkg237.m653
+from pkg1.pkg9.pkg78 import m77
+from . import m1993
+from pkg1.pkg13.pkg109 import m108
+import pkg4.pkg40.pkg324.m1574
+from pkg1.pkg15.pkg122 import m1372
+import pkg1.pkg11.pkg93.m1760
+from . import m1159
+
+
+def helper_2410_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2410_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2410_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
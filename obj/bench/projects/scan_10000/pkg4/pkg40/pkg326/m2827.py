@@ -0,0 +1,18 @@
+"""Module 2827."""
+import pkg1.m0
+from pkg4.pkg33.pkg270 import m686
+from . import m325
+
+
+def helper_2827_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2827_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
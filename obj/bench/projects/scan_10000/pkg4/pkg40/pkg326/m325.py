@@ -0,0 +1,36 @@
+"""Module 325."""
+import pkg1.pkg15.pkg128.m127
+from pkg1 import m0
+import pkg5.pkg44.m43
+from pkg2.pkg21.pkg174 import m173
+import pkg4.pkg34.pkg279.m278
+from pkg2.pkg22 import m21
+import pkg2.pkg24.pkg198.m197
+
+
+def helper_325_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_325_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_325_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_325_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,48 @@
+"""Module 4078."""
+from . import m2410
+from pkg2.pkg23.pkg186 import m1436
+import pkg3.pkg25.pkg208.m1875
+from . import m1576
+import pkg6.pkg52.m468
+from . import m3661
+import pkg4.pkg35.pkg287.m1120
+from pkg6.pkg50.pkg401 import m400
+import pkg8.pkg65.m64
+from pkg1.pkg12.pkg102 import m101
+import pkg6.pkg55.m54
+from pkg1.pkg13 import m1263
+
+
+def helper_4078_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4078_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4078_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4078_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_4078_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,61 @@
+"""Module 6163."""
+import pkg3.pkg29.pkg239.m3157
+from pkg5.pkg46.pkg373 import m5376
+import pkg8.m7
+from pkg4.pkg34.pkg275 import m2359
+import pkg2.pkg18.pkg147.m146
+from pkg1 import m0
+import pkg5.pkg44.pkg355.m3273
+from pkg4.pkg33.pkg265 import m6102
+import pkg2.pkg19.pkg154.m3072
+from pkg2.pkg17.pkg141 import m974
+import pkg3.pkg32.pkg259.m3177
+
+
+def helper_6163_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6163_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6163_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6163_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_6163_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_6163_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6163_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
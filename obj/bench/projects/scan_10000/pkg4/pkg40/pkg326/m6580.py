@@ -0,0 +1,40 @@
+"""Module 6580."""
+from . import m5329
+from pkg1.pkg10 import m9
+import pkg3.pkg25.m24
+from . import m3661
+import pkg3.pkg31.pkg256.m1923
+from pkg1 import m0
+import pkg4.pkg34.pkg274.m1107
+from pkg2.pkg24.pkg197 import m1030
+import pkg1.pkg12.pkg100.m1350
+from pkg2.pkg23.pkg192 import m608
+import pkg5.pkg48.pkg385.m801
+
+
+def helper_6580_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6580_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6580_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6580_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 8248."""
+from . import m4912
+from . import m4495
+import pkg3.pkg27.pkg217.m1884
+from pkg1.pkg10.pkg81 import m80
+import pkg4.pkg33.pkg266.m2350
+from pkg1.pkg12.pkg101 import m100
+import pkg4.pkg35.pkg287.m703
+from pkg3.pkg32 import m31
+from . import m5329
+from . import m4078
+import pkg4.pkg34.pkg277.m1110
+
+
+def helper_8248_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8248_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
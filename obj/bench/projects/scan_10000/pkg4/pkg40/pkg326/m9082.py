@@ -0,0 +1,40 @@
+"""Module 9082."""
+import pkg3.pkg27.pkg224.m5227
+from pkg1.pkg11 import m7933
+import pkg2.pkg24.m23
+from pkg3.pkg32.pkg262 import m261
+import pkg8.m7
+from pkg3.pkg28.pkg232 import m8154
+import pkg6.pkg50.m49
+from pkg1 import m0
+from . import m7414
+from pkg3.pkg25 import m2526
+from . import m5746
+
+
+def helper_9082_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9082_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9082_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9082_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,12 @@
+"""Module 9499."""
+from . import m3244
+from pkg5.pkg48.pkg386 import m385
+import pkg1.pkg15.m14
+from . import m7831
+
+
+def helper_9499_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 1994."""
+import pkg5.pkg44.m43
+from pkg4.pkg40.pkg325 import m1158
+import pkg1.pkg13.pkg107.m106
+from . import m743
+import pkg3.pkg32.pkg260.m1510
+from pkg1.pkg15.pkg128 import m961
+import pkg3.pkg29.pkg235.m234
+from pkg4.pkg36 import m452
+import pkg1.pkg9.pkg75.m74
+from . import m326
+import pkg2.pkg18.pkg150.m149
+from pkg2.pkg20 import m19
+
+
+def helper_1994_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1994_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,13 @@
+"""Module 2411."""
+from . import m743
+from . import m326
+import pkg2.pkg21.pkg169.m168
+from pkg5.pkg43.pkg346 import m345
+import pkg3.pkg32.pkg264.m1514
+
+
+def helper_2411_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
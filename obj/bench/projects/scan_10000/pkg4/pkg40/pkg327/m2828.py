@@ -0,0 +1,19 @@
+"""Module 2828."""
+import pkg7.pkg57.m2558
+from pkg5.pkg48.pkg387 import m386
+import pkg1.m0
+from pkg1.pkg9 import m8
+
+
+def helper_2828_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2828_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
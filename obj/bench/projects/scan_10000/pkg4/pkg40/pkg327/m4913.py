@@ -0,0 +1,37 @@
+"""Module 4913."""
+from . import m1577
+from pkg4.pkg33.pkg268 import m267
+import pkg3.pkg28.pkg226.m642
+from pkg2.pkg24.pkg197 import m196
+import pkg6.pkg51.m2552
+from . import m2411
+import pkg1.m0
+from . import m1160
+
+
+def helper_4913_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4913_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4913_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4913_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
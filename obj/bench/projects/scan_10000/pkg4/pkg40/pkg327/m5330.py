@@ -0,0 +1,60 @@
+"""Module 5330."""
+import pkg4.pkg36.pkg290.m3208
+from pkg3.pkg29.pkg234 import m233
+import pkg1.m0
+from pkg2.pkg22.pkg181 import m3099
+import pkg2.pkg24.pkg197.m196
+from pkg1.pkg12.pkg104 import m103
+import pkg3.pkg29.pkg235.m2736
+from pkg1.pkg9.pkg80 import m79
+import pkg5.pkg42.pkg338.m1588
+from pkg3.pkg31.pkg256 import m255
+
+
+def helper_5330_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5330_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5330_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5330_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_5330_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_5330_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5330_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,36 @@
+"""Module 6164."""
+import pkg1.m0
+from pkg2.pkg19.pkg153 import m1403
+import pkg4.pkg35.pkg281.m2782
+from pkg7.pkg63 import m62
+import pkg2.pkg24.pkg198.m2282
+from pkg3.pkg31.pkg254 import m2755
+import pkg2.m1
+
+
+def helper_6164_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6164_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6164_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6164_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,37 @@
+"""Module 6998."""
+import pkg4.pkg37.pkg303.m6557
+from . import m3245
+from . import m743
+from pkg6.pkg51 import m50
+import pkg4.pkg37.pkg298.m1131
+from pkg5 import m4
+import pkg2.pkg24.pkg197.m613
+from pkg3.pkg32.pkg262 import m6516
+
+
+def helper_6998_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6998_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6998_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6998_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,9 @@
+"""Module 743."""
+import pkg3.pkg32.pkg264.m263
+
+
+def helper_743_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
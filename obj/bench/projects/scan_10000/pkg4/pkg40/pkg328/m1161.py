@@ -0,0 +1,40 @@
+"""Module 1161."""
+import pkg5.pkg45.m44
+from pkg3.pkg25.pkg208 import m1041
+import pkg8.pkg69.m68
+from pkg1.pkg14.pkg116 import m115
+import pkg3.pkg31.m30
+from pkg2.pkg21.pkg174 import m173
+import pkg1.pkg11.pkg92.m91
+from pkg4.pkg34 import m33
+from . import m744
+from . import m327
+import pkg4.pkg36.pkg289.m288
+
+
+def helper_1161_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1161_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1161_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1161_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
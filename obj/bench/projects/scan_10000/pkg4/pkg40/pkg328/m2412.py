@@ -0,0 +1,44 @@
+"""Module 2412."""
+import pkg4.pkg34.pkg279.m278
+from pkg4 import m3
+import pkg1.pkg12.pkg101.m1351
+from pkg5.pkg41.pkg333 import m332
+from . import m744
+from pkg5.pkg43.pkg346 import m1179
+import pkg1.pkg13.pkg110.m943
+from pkg7.pkg57 import m56
+
+
+def helper_2412_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2412_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2412_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2412_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_2412_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
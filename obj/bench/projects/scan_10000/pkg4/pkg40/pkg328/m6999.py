@@ -0,0 +1,48 @@
+"""Module 6999."""
+import pkg1.pkg16.pkg130.m6801
+from pkg7 import m840
+import pkg3.m2
+from pkg1.pkg16 import m15
+import pkg3.pkg27.pkg224.m5227
+from pkg5.pkg43.pkg345 import m344
+import pkg1.pkg10.pkg88.m2589
+from . import m3663
+import pkg7.pkg62.m478
+from pkg2 import m1
+import pkg2.pkg23.pkg192.m1859
+from pkg1.pkg13.pkg111 import m1778
+
+
+def helper_6999_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6999_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6999_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6999_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_6999_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,13 @@
+"""Module 9918."""
+import pkg1.pkg10.m9
+from pkg3 import m2
+import pkg5.pkg43.pkg350.m2434
+from pkg3.pkg26.pkg211 import m9384
+import pkg1.pkg11.pkg95.m3430
+
+
+def helper_9918_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,22 @@
+"""Module 1672."""
+import pkg1.pkg12.pkg104.m103
+from pkg3.pkg31 import m30
+import pkg1.m0
+from pkg4.pkg34.pkg273 import m1523
+import pkg7.pkg64.m63
+from . import m4
+import pkg4.pkg33.pkg267.m683
+
+
+def helper_1672_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1672_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
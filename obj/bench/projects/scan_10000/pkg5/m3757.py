@@ -0,0 +1,54 @@
+"""Module 3757."""
+import pkg6.pkg52.pkg417.m833
+from pkg6.pkg50.pkg401 import m817
+from . import m2089
+from pkg1.pkg14.pkg119 import m1369
+from . import m421
+from pkg1.pkg11.pkg90 import m89
+from . import m1255
+from pkg3.pkg31.pkg256 import m2340
+import pkg2.pkg23.m1273
+from pkg1.pkg9.pkg79 import m78
+import pkg1.pkg16.pkg129.m2630
+
+
+def helper_3757_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3757_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3757_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3757_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_3757_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_3757_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,12 @@
+"""Module 9595."""
+import pkg1.m0
+from pkg2.pkg23 import m22
+import pkg3.pkg30.pkg243.m242
+from pkg2.pkg22.pkg180 import m596
+
+
+def helper_9595_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 3376."""
+import pkg1.pkg16.pkg132.m2633
+from pkg1.pkg13.pkg111 import m527
+import pkg5.pkg41.pkg333.m2000
+from pkg3.pkg29 import m28
+import pkg5.pkg44.pkg354.m1604
+from pkg4.pkg37.pkg303 import m302
+import pkg6.pkg51.pkg415.m1665
+from pkg3.pkg29.pkg234 import m2318
+from . import m1291
+from pkg2.pkg19.pkg155 import m1822
+
+
+def helper_3376_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3376_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 457."""
+import pkg1.pkg15.pkg125.m124
+from pkg2.pkg20 import m19
+import pkg2.pkg19.pkg156.m155
+from pkg4 import m420
+import pkg2.m1
+from pkg1 import m0
+import pkg2.pkg17.m433
+from . import m40
+import pkg6.pkg49.pkg400.m399
+from pkg3.pkg25.pkg206 import m205
+
+
+def helper_457_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_457_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
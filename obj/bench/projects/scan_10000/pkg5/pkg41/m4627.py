@@ -0,0 +1,30 @@
+"""Module 4627."""
+import pkg1.pkg12.pkg103.m3855
+from pkg3.pkg30.pkg242 import m1492
+from . import m2959
+from pkg2.pkg19.pkg157 import m990
+import pkg4.pkg34.pkg275.m1525
+from . import m40
+import pkg1.pkg11.pkg95.m4264
+from pkg1.pkg13.pkg109 import m3444
+
+
+def helper_4627_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4627_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4627_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
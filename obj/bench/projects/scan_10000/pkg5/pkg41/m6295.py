@@ -0,0 +1,21 @@
+"""Module 6295."""
+import pkg1.pkg15.pkg122.m121
+from pkg4.pkg39.pkg313 import m3231
+import pkg5.pkg41.pkg332.m4501
+from pkg4.pkg40 import m39
+import pkg1.pkg16.m3768
+from pkg1.pkg15 import m848
+
+
+def helper_6295_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6295_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
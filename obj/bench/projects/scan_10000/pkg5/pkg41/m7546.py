@@ -0,0 +1,31 @@
+"""Module 7546."""
+import pkg2.pkg18.m17
+from pkg1 import m0
+import pkg2.pkg18.pkg151.m5988
+from pkg4.pkg40.pkg328 import m327
+import pkg1.pkg16.pkg133.m4719
+from pkg1.pkg10.pkg86 import m1336
+from . import m2125
+from pkg1.pkg13.pkg112 import m3864
+import pkg4.pkg35.pkg283.m1116
+
+
+def helper_7546_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7546_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7546_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,29 @@
+"""Module 1162."""
+import pkg6.pkg50.pkg408.m407
+from . import m328
+import pkg3.m2
+from pkg2.pkg18.pkg152 import m151
+from . import m745
+from pkg1 import m0
+import pkg3.pkg27.pkg224.m1057
+
+
+def helper_1162_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1162_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1162_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
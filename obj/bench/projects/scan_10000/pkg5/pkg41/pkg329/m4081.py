@@ -0,0 +1,17 @@
+"""Module 4081."""
+from . import m2830
+from pkg2.pkg23.pkg190 import m606
+
+
+def helper_4081_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4081_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
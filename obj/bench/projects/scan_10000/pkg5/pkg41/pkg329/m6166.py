@@ -0,0 +1,14 @@
+"""Module 6166."""
+import pkg5.pkg45.pkg365.m4117
+from pkg3.pkg31.pkg249 import m5252
+import pkg3.pkg27.m26
+from pkg3.pkg29.pkg239 import m3157
+import pkg3.pkg25.pkg207.m4376
+from pkg2.pkg18.pkg148 import m4734
+
+
+def helper_6166_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
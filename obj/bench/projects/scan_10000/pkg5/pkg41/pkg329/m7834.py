@@ -0,0 +1,53 @@
+"""Module 7834."""
+from . import m6583
+from pkg2.pkg21.pkg171 import m2255
+import pkg1.pkg10.pkg81.m80
+from pkg4 import m3
+import pkg1.pkg12.m1262
+from pkg2.pkg18.pkg148 import m564
+import pkg3.pkg25.pkg201.m1868
+from pkg3.pkg30.pkg243 import m2744
+import pkg1.pkg10.pkg86.m85
+from pkg3.pkg30 import m29
+
+
+def helper_7834_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7834_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7834_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7834_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_7834_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_7834_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 1997."""
+from . import m1580
+from pkg3.pkg30 import m29
+import pkg2.pkg22.pkg177.m176
+from . import m746
+import pkg1.pkg14.pkg113.m1363
+from pkg3.pkg27 import m26
+import pkg4.m3
+from pkg1.pkg9.pkg75 import m74
+import pkg5.pkg46.pkg369.m1202
+from pkg7.pkg58 import m57
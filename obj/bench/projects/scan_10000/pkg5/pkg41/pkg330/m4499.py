@@ -0,0 +1,20 @@
+"""Module 4499."""
+import pkg2.pkg18.m851
+from pkg1.pkg11.pkg91 import m90
+import pkg2.pkg20.pkg164.m163
+from pkg1.pkg10.pkg86 import m85
+import pkg1.pkg9.m8
+
+
+def helper_4499_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4499_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
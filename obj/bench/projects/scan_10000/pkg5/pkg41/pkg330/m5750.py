@@ -0,0 +1,9 @@
+"""Module 5750."""
+import pkg3.pkg29.pkg240.m3992
+
+
+def helper_5750_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
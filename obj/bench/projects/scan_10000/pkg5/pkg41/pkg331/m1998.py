@@ -0,0 +1,25 @@
+"""Module 1998."""
+import pkg2.pkg20.m19
+from pkg3.pkg26.pkg211 import m1461
+from . import m1581
+from pkg5 import m4
+import pkg7.pkg57.m56
+from pkg3.pkg27.pkg219 import m218
+import pkg1.m0
+from pkg1.pkg14.pkg120 import m536
+import pkg3.pkg32.m31
+from pkg6.pkg54 import m53
+
+
+def helper_1998_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1998_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
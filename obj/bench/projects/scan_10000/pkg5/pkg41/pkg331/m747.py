@@ -0,0 +1,11 @@
+"""Module 747."""
+import pkg3.pkg30.pkg242.m658
+from pkg6.pkg49 import m465
+import pkg1.pkg15.pkg121.m120
+from pkg4.pkg37.pkg303 import m302
+import pkg5.m4
+from . import m330
+import pkg2.pkg19.pkg158.m157
+from pkg2.pkg19.pkg160 import m159
+import pkg8.pkg71.m487
+from pkg1 import m0
@@ -0,0 +1,30 @@
+"""Module 8670."""
+import pkg5.pkg42.pkg337.m336
+from pkg2.pkg24 import m440
+import pkg4.pkg39.pkg314.m4900
+from pkg5.pkg44 import m4213
+import pkg3.pkg30.pkg248.m247
+from pkg3.pkg28 import m27
+import pkg3.pkg31.pkg254.m5674
+from pkg3.pkg28.pkg231 import m230
+
+
+def helper_8670_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8670_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8670_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,48 @@
+"""Module 4501."""
+import pkg2.pkg23.m22
+from . import m4084
+import pkg5.pkg41.pkg329.m1996
+from pkg6.pkg51 import m50
+import pkg4.m3
+from . import m748
+import pkg2.pkg24.pkg193.m609
+from pkg1.pkg10 import m9
+import pkg2.pkg17.m16
+from pkg3.pkg26.pkg213 import m212
+import pkg6.pkg51.m467
+from . import m2416
+
+
+def helper_4501_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4501_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4501_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4501_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_4501_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,36 @@
+"""Module 748."""
+import pkg7.m423
+from pkg1 import m0
+import pkg4.m3
+from . import m331
+import pkg1.pkg13.pkg112.m111
+from pkg1.pkg12.pkg103 import m102
+import pkg1.pkg9.m8
+
+
+def helper_748_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_748_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_748_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_748_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
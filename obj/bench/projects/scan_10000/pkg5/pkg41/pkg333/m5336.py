@@ -0,0 +1,22 @@
+"""Module 5336."""
+import pkg4.pkg40.pkg328.m1995
+from . import m1583
+from . import m2417
+from pkg1 import m0
+from . import m4502
+from pkg1.pkg12.pkg104 import m2188
+import pkg3.pkg32.pkg257.m3592
+
+
+def helper_5336_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5336_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,48 @@
+"""Module 5753."""
+import pkg6.pkg52.m885
+from pkg3.pkg25.pkg208 import m624
+import pkg1.pkg9.pkg76.m3411
+from pkg2.pkg24.pkg196 import m2280
+import pkg2.pkg17.pkg142.m4311
+from pkg8.pkg70 import m69
+from . import m2000
+from pkg5.pkg41.pkg334 import m4920
+import pkg3.m2
+from pkg3.pkg32.pkg257 import m673
+import pkg3.pkg32.pkg263.m262
+from pkg5.pkg43.pkg352 import m351
+
+
+def helper_5753_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5753_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5753_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5753_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_5753_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,46 @@
+"""Module 7421."""
+import pkg7.pkg61.m894
+from pkg3.pkg26.pkg216 import m632
+import pkg5.pkg44.pkg354.m1604
+from . import m2834
+import pkg1.pkg10.pkg81.m3833
+from pkg2.pkg17 import m16
+from . import m4919
+from . import m4502
+from . import m1166
+from pkg5.pkg43 import m42
+
+
+def helper_7421_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7421_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7421_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7421_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_7421_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,21 @@
+"""Module 8672."""
+import pkg5.pkg46.pkg371.m370
+from pkg6.pkg56 import m55
+import pkg5.pkg48.pkg389.m388
+from pkg2.pkg17.pkg139 import m7644
+import pkg1.pkg12.pkg100.m99
+from pkg3.pkg32.pkg257 import m256
+
+
+def helper_8672_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8672_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 9089."""
+import pkg6.pkg51.pkg410.m409
+from pkg3.pkg30.pkg245 import m244
+import pkg6.m5
+from pkg1 import m0
+import pkg3.pkg25.pkg208.m624
+from pkg1.pkg14.pkg118 import m6372
+import pkg4.pkg38.pkg308.m2392
+from . import m1583
+from . import m749
+from pkg4.pkg37 import m6291
+
+
+def helper_9089_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9089_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
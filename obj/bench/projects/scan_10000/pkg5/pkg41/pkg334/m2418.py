@@ -0,0 +1,46 @@
+"""Module 2418."""
+from . import m750
+from pkg1.pkg10.pkg85 import m84
+import pkg7.pkg59.m58
+from pkg5.pkg45 import m44
+import pkg1.pkg13.pkg107.m106
+from pkg1.pkg10.pkg81 import m80
+import pkg4.pkg35.pkg288.m1538
+from . import m2001
+import pkg2.pkg22.pkg178.m594
+from pkg1.pkg9.pkg77 import m76
+
+
+def helper_2418_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2418_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2418_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2418_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_2418_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 5754."""
+import pkg3.pkg32.m31
+from pkg3.pkg28.pkg228 import m2729
+import pkg2.pkg24.pkg198.m3116
+from pkg2.pkg23.pkg192 import m1025
+import pkg8.m5011
+from pkg6 import m5
+from . import m1167
+from pkg3.pkg27.pkg221 import m5641
+import pkg3.pkg27.pkg220.m2721
+from . import m4086
+import pkg5.pkg42.pkg344.m1177
+
+
+def helper_5754_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5754_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
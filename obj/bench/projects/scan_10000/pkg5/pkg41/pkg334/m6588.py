@@ -0,0 +1,29 @@
+"""Module 6588."""
+import pkg5.pkg42.pkg339.m4508
+from . import m4503
+import pkg5.pkg46.pkg375.m2459
+from pkg1.pkg9.pkg75 import m74
+import pkg1.pkg11.m10
+from . import m5337
+import pkg5.pkg43.pkg346.m345
+
+
+def helper_6588_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6588_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6588_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
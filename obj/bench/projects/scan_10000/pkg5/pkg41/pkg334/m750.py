@@ -0,0 +1,33 @@
+"""Module 750."""
+import pkg2.pkg23.pkg186.m602
+from pkg2.pkg21.pkg170 import m586
+import pkg2.pkg24.pkg194.m193
+from pkg3.pkg25.pkg207 import m623
+import pkg1.pkg12.pkg101.m100
+from pkg5.pkg44 import m43
+import pkg6.pkg51.pkg416.m415
+from . import m333
+import pkg4.pkg36.pkg295.m294
+from pkg2.pkg19 import m18
+import pkg5.pkg47.pkg384.m383
+
+
+def helper_750_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_750_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_750_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 8256."""
+import pkg5.pkg45.pkg363.m779
+from pkg1.pkg9 import m8
+import pkg1.pkg13.pkg107.m6361
+from pkg4.pkg37.pkg298 import m4467
+from . import m2001
+from . import m7839
+import pkg5.pkg45.pkg364.m363
+from pkg4.pkg36.pkg296 import m1129
+from . import m3669
+
+
+def helper_8256_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
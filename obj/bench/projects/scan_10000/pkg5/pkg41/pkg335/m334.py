@@ -0,0 +1,30 @@
+"""Module 334."""
+import pkg3.pkg31.m30
+from pkg2 import m1
+import pkg7.pkg58.m57
+from pkg1.pkg11.pkg94 import m93
+import pkg1.pkg15.pkg124.m123
+from pkg1.pkg10.pkg81 import m80
+import pkg4.pkg35.m34
+from pkg1.pkg13.pkg105 import m104
+
+
+def helper_334_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_334_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_334_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
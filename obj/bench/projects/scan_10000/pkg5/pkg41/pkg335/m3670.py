@@ -0,0 +1,40 @@
+"""Module 3670."""
+import pkg2.pkg19.pkg156.m989
+from . import m1168
+import pkg3.pkg26.m1276
+from pkg2 import m1
+import pkg4.pkg36.m35
+from pkg3.pkg32.pkg257 import m256
+from . import m2002
+from pkg6 import m5
+from . import m1585
+from pkg1.pkg11.pkg95 import m511
+import pkg1.pkg15.pkg123.m122
+
+
+def helper_3670_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3670_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3670_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3670_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,55 @@
+"""Module 4087."""
+import pkg6.pkg50.pkg402.m401
+from pkg5.pkg42 import m875
+from . import m1168
+from pkg1.pkg10.pkg82 import m2166
+from . import m2419
+from pkg4 import m3
+import pkg1.pkg16.pkg136.m135
+from pkg8 import m7
+from . import m2836
+from pkg5.pkg46.pkg373 import m3291
+import pkg1.pkg12.pkg104.m103
+from pkg6.pkg50.pkg404 import m2488
+
+
+def helper_4087_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4087_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4087_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4087_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_4087_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_4087_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
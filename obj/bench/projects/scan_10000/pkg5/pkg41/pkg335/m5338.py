@@ -0,0 +1,37 @@
+"""Module 5338."""
+import pkg3.pkg29.pkg239.m3991
+from pkg3.pkg28.pkg226 import m225
+import pkg1.pkg15.pkg123.m4292
+from pkg5.pkg41.pkg334 import m333
+import pkg4.pkg38.pkg308.m307
+from . import m334
+from . import m3670
+from pkg1.pkg16.pkg136 import m5139
+
+
+def helper_5338_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5338_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5338_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5338_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 5755."""
+import pkg3.pkg29.m28
+from pkg6.pkg50.pkg406 import m1239
+import pkg1.pkg9.pkg77.m76
+
+
+def helper_5755_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5755_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5755_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
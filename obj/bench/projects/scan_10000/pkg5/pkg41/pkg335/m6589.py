@@ -0,0 +1,13 @@
+"""Module 6589."""
+import pkg3.pkg31.pkg254.m3172
+from pkg2.pkg23.pkg186 import m185
+import pkg2.pkg24.m5861
+from . import m1168
+import pkg4.pkg37.pkg301.m1968
+
+
+def helper_6589_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
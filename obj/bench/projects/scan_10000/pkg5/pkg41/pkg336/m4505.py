@@ -0,0 +1,47 @@
+"""Module 4505."""
+import pkg1.pkg15.pkg126.m3461
+from pkg1.pkg11 import m10
+from . import m2420
+from pkg4.pkg40.pkg325 import m2826
+import pkg7.pkg62.m2563
+from pkg4.pkg35.pkg288 import m287
+import pkg3.pkg27.m26
+from pkg3.pkg30.pkg243 import m659
+import pkg1.m0
+from pkg4.pkg34 import m33
+import pkg2.pkg20.pkg161.m1411
+
+
+def helper_4505_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4505_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4505_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4505_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_4505_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 4922."""
+import pkg1.pkg13.pkg112.m111
+from . import m2837
+import pkg1.pkg15.pkg127.m1794
+from pkg2.pkg17.pkg144 import m1811
+import pkg2.pkg17.pkg139.m138
+from pkg6.pkg50.pkg402 import m3737
+import pkg4.pkg38.pkg309.m4895
+from pkg2.pkg19.pkg153 import m152
+from . import m752
+from pkg1.pkg11.pkg92 import m91
+
+
+def helper_4922_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
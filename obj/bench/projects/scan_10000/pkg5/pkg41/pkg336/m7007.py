@@ -0,0 +1,23 @@
+"""Module 7007."""
+from . import m1586
+from . import m6173
+import pkg3.pkg25.pkg203.m1453
+from pkg4 import m2088
+import pkg2.pkg22.pkg183.m182
+from pkg2.pkg23.pkg190 import m2691
+import pkg1.pkg12.m11
+from pkg2.pkg23.pkg187 import m186
+
+
+def helper_7007_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7007_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 2960."""
+import pkg3.pkg25.pkg204.m620
+from pkg7.pkg64 import m480
+from . import m1709
+from pkg3.pkg30.pkg247 import m1914
+import pkg6.pkg54.m53
+from pkg2.pkg19.pkg156 import m1406
+import pkg2.pkg18.pkg145.m561
+from pkg3.pkg27.pkg222 import m638
+import pkg4.pkg34.pkg274.m1524
+from pkg1.pkg12.pkg103 import m519
+
+
+def helper_2960_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,35 @@
+"""Module 4628."""
+import pkg7.pkg60.m59
+from pkg3.pkg28.pkg230 import m3565
+import pkg3.pkg28.pkg231.m3566
+from . import m2543
+import pkg3.pkg26.pkg212.m628
+from pkg3.pkg27.pkg217 import m2718
+
+
+def helper_4628_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4628_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4628_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4628_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
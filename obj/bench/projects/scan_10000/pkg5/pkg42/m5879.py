@@ -0,0 +1,17 @@
+"""Module 5879."""
+import pkg4.pkg34.pkg277.m1527
+from . import m3377
+
+
+def helper_5879_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5879_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 7547."""
+import pkg1.pkg13.pkg106.m1773
+from pkg5.pkg42.pkg340 import m6594
+import pkg2.pkg18.pkg149.m982
+
+
+def helper_7547_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7547_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,16 @@
+"""Module 7964."""
+from . import m4211
+from . import m5879
+import pkg1.m0
+from pkg6.pkg54 import m470
+import pkg1.pkg13.m12
+from pkg8.pkg65 import m2149
+import pkg6.pkg54.m53
+from . import m7130
+
+
+def helper_7964_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 1587."""
+from . import m753
+from pkg3.pkg29.pkg234 import m650
+import pkg3.pkg31.pkg256.m255
+from pkg2.pkg19.pkg153 import m569
+import pkg4.pkg39.pkg318.m317
+from . import m1170
+import pkg6.pkg53.m52
+from pkg1.pkg14.pkg117 import m116
+import pkg1.m0
+
+
+def helper_1587_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
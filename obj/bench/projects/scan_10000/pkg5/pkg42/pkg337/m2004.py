@@ -0,0 +1,37 @@
+"""Module 2004."""
+from . import m336
+from pkg1 import m0
+import pkg1.pkg9.m8
+from pkg3.pkg31 import m30
+import pkg2.pkg18.pkg149.m148
+from pkg1.pkg12.pkg103 import m102
+import pkg2.pkg23.pkg190.m189
+from pkg2.pkg17.pkg141 import m140
+
+
+def helper_2004_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2004_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2004_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2004_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,33 @@
+"""Module 6174."""
+from . import m3672
+from . import m5757
+import pkg2.pkg20.pkg162.m3497
+from pkg1 import m0
+import pkg2.m835
+from pkg3.pkg29.pkg239 import m655
+import pkg1.pkg15.pkg121.m1371
+from pkg2.pkg20 import m2104
+import pkg4.pkg40.pkg325.m4911
+from pkg7 import m6
+import pkg1.pkg15.m14
+
+
+def helper_6174_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6174_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6174_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
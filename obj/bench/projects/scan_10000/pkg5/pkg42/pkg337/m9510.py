@@ -0,0 +1,18 @@
+"""Module 9510."""
+from . import m1587
+from pkg2.pkg22.pkg182 import m1015
+from . import m8676
+
+
+def helper_9510_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9510_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,37 @@
+"""Module 2422."""
+import pkg1.pkg14.m13
+from pkg2 import m1
+import pkg5.pkg42.m41
+from pkg1.pkg15.pkg124 import m540
+from . import m754
+from pkg1.pkg16 import m15
+import pkg3.pkg26.pkg211.m210
+from pkg4.pkg35.pkg288 import m287
+
+
+def helper_2422_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2422_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2422_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2422_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,5 @@
+"""Module 337."""
+import pkg2.pkg23.pkg192.m191
+from pkg2 import m1
+import pkg3.pkg31.pkg251.m250
+from pkg5.pkg47 import m46
@@ -0,0 +1,21 @@
+"""Module 4090."""
+import pkg3.pkg26.pkg215.m1882
+from . import m3256
+import pkg4.pkg37.pkg303.m719
+from pkg1.pkg14.pkg119 import m1369
+import pkg3.pkg31.m30
+from pkg6.pkg51.pkg412 import m2079
+
+
+def helper_4090_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4090_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
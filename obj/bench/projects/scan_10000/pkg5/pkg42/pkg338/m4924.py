@@ -0,0 +1,39 @@
+"""Module 4924."""
+import pkg3.pkg27.pkg219.m218
+from pkg3.pkg27.pkg220 import m2304
+import pkg4.pkg39.pkg313.m312
+from pkg1.pkg15.pkg124 import m3876
+import pkg4.pkg39.pkg318.m4904
+from pkg3.pkg28.pkg230 import m1063
+import pkg1.pkg11.m10
+from pkg1 import m0
+import pkg2.pkg24.pkg196.m4782
+from pkg6.pkg49.pkg398 import m814
+
+
+def helper_4924_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4924_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4924_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4924_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,16 @@
+"""Module 7009."""
+import pkg1.pkg14.m2932
+from pkg1.pkg12.pkg100 import m99
+from . import m2422
+from pkg5.pkg44.pkg359 import m358
+import pkg3.pkg31.pkg256.m3174
+from pkg2.pkg24 import m23
+import pkg2.pkg23.pkg192.m5195
+from . import m5758
+
+
+def helper_7009_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
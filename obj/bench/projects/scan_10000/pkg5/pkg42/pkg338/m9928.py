@@ -0,0 +1,40 @@
+"""Module 9928."""
+import pkg6.pkg51.pkg416.m415
+from pkg5 import m4
+import pkg4.pkg39.pkg320.m319
+from pkg2.pkg18.pkg152 import m151
+import pkg8.pkg65.m64
+from pkg1.pkg16.pkg135 import m134
+import pkg2.m1
+from . import m5758
+import pkg3.pkg31.m30
+from . import m3256
+import pkg5.pkg43.pkg346.m1596
+
+
+def helper_9928_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9928_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9928_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9928_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 5342."""
+from . import m2006
+from pkg1.pkg11.pkg94 import m4680
+import pkg4.pkg37.pkg299.m1966
+from pkg2.pkg21.pkg174 import m173
+
+
+def helper_5342_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5342_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5342_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
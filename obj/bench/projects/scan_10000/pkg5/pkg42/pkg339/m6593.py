@@ -0,0 +1,21 @@
+"""Module 6593."""
+import pkg1.m0
+from . import m3257
+import pkg4.pkg39.pkg317.m6571
+from pkg2.pkg21 import m20
+import pkg6.pkg52.m51
+from pkg5.pkg43.pkg349 import m2433
+
+
+def helper_6593_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6593_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 7010."""
+import pkg1.pkg16.m2100
+from pkg1.pkg13 import m429
+import pkg4.m3
+from . import m5342
+import pkg1.pkg16.pkg131.m5134
+from pkg7.pkg62 import m1729
+import pkg2.pkg19.pkg155.m571
+from pkg8.pkg70 import m69
+import pkg1.pkg12.pkg98.m97
+from pkg3.pkg29.pkg236 import m235
+
+
+def helper_7010_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 8261."""
+import pkg8.pkg65.m898
+from pkg3.pkg29 import m2113
+
+
+def helper_8261_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8261_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
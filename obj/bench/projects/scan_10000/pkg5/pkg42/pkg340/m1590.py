@@ -0,0 +1,14 @@
+"""Module 1590."""
+import pkg3.m2
+from . import m1173
+import pkg3.pkg26.m25
+from . import m756
+import pkg6.pkg51.pkg411.m1244
+from pkg2.pkg17 import m16
+
+
+def helper_1590_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
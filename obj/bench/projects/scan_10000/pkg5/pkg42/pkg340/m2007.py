@@ -0,0 +1,54 @@
+"""Module 2007."""
+import pkg7.pkg58.m891
+from pkg2.pkg23.pkg190 import m189
+import pkg1.pkg11.pkg96.m95
+from pkg4.pkg40.pkg324 import m1157
+import pkg2.pkg17.pkg142.m141
+from pkg1 import m0
+import pkg2.pkg23.pkg185.m1435
+from . import m756
+import pkg3.pkg26.pkg213.m212
+from pkg2.pkg19.pkg160 import m576
+import pkg1.pkg16.m432
+
+
+def helper_2007_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2007_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2007_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2007_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_2007_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_2007_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
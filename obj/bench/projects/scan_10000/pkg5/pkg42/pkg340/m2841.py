@@ -0,0 +1,23 @@
+"""Module 2841."""
+import pkg3.pkg28.m444
+from pkg6.pkg50.pkg403 import m1236
+import pkg1.pkg16.pkg132.m131
+from pkg2.pkg18.pkg151 import m2235
+import pkg1.m0
+from pkg4.pkg39.pkg314 import m313
+import pkg2.pkg22.pkg180.m179
+from pkg1.pkg12.pkg102 import m935
+
+
+def helper_2841_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2841_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 339."""
+import pkg5.pkg44.m43
+from pkg3.pkg26.pkg212 import m211
+import pkg2.pkg17.pkg144.m143
+from pkg2.pkg20.pkg163 import m162
+
+
+def helper_339_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_339_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_339_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 4509."""
+import pkg7.pkg64.m63
+from pkg5.pkg45.pkg367 import m2034
+import pkg6.pkg50.pkg401.m1234
+from pkg1.pkg12.pkg100 import m933
+
+
+def helper_4509_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4509_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,22 @@
+"""Module 8679."""
+import pkg1.pkg11.pkg95.m3013
+from pkg6.pkg49.pkg395 import m4564
+import pkg3.pkg28.pkg232.m6069
+from pkg4.pkg36.pkg293 import m2377
+from . import m4509
+from pkg4.pkg34 import m4203
+import pkg2.pkg18.m17
+
+
+def helper_8679_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8679_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
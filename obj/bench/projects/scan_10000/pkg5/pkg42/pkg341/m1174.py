@@ -0,0 +1,16 @@
+"""Module 1174."""
+import pkg4.pkg34.pkg275.m274
+from pkg4.pkg37.pkg304 import m303
+import pkg3.pkg25.m24
+from pkg5.pkg45.pkg367 import m783
+import pkg2.m1
+from pkg1.pkg13.pkg112 import m945
+import pkg4.pkg34.m33
+from pkg1.pkg10.pkg84 import m83
+
+
+def helper_1174_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 2425."""
+import pkg5.pkg41.pkg336.m335
+from pkg2.pkg22.pkg180 import m179
+import pkg4.pkg39.pkg313.m312
+from pkg1.pkg11.pkg94 import m1344
+
+
+def helper_2425_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2425_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
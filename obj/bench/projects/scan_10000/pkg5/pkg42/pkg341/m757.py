@@ -0,0 +1,29 @@
+"""Module 757."""
+import pkg8.pkg66.m65
+from pkg6.pkg49 import m48
+import pkg7.m6
+from pkg4.pkg33.pkg266 import m265
+import pkg1.m417
+from pkg1 import m0
+from . import m340
+
+
+def helper_757_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_757_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_757_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 3260."""
+from . import m2843
+from pkg2.pkg24 import m23
+import pkg1.pkg11.m10
+from pkg5 import m4
+from . import m1592
+
+
+def helper_3260_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3260_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3260_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 4511."""
+import pkg3.pkg29.pkg238.m2322
+from pkg8 import m7
+import pkg4.pkg38.pkg308.m2809
+from pkg3.pkg28.pkg226 import m642
+import pkg3.pkg31.pkg251.m250
+
+
+def helper_4511_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4511_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,53 @@
+"""Module 5762."""
+import pkg4.pkg38.m2539
+from pkg5.pkg47.pkg382 import m381
+import pkg4.pkg37.pkg300.m4469
+from pkg8.pkg68 import m67
+import pkg1.pkg10.pkg86.m1753
+from . import m2426
+import pkg4.pkg39.pkg313.m3648
+from . import m3677
+import pkg3.pkg30.m29
+from pkg5.pkg48.pkg392 import m808
+
+
+def helper_5762_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5762_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5762_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5762_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_5762_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_5762_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,32 @@
+"""Module 6596."""
+import pkg3.m2
+from pkg4.pkg33.pkg270 import m6107
+import pkg7.pkg58.m57
+from pkg1.pkg10.pkg88 import m2172
+import pkg1.pkg14.pkg115.m2616
+from pkg4.pkg39 import m872
+import pkg4.pkg33.pkg265.m681
+from pkg1.pkg12 import m428
+import pkg1.pkg9.pkg80.m4249
+from . import m5345
+
+
+def helper_6596_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6596_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6596_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
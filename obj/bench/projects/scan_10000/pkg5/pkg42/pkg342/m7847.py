@@ -0,0 +1,44 @@
+"""Module 7847."""
+import pkg1.pkg12.pkg98.m97
+from pkg4.pkg36.pkg289 import m1122
+import pkg5.pkg41.pkg333.m2000
+from pkg4.pkg36.pkg294 import m3212
+import pkg6.pkg50.pkg404.m3739
+from . import m2843
+import pkg2.pkg24.pkg194.m1027
+from . import m6596
+
+
+def helper_7847_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7847_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7847_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7847_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_7847_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
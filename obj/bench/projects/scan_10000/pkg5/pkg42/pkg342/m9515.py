@@ -0,0 +1,48 @@
+"""Module 9515."""
+import pkg6.pkg52.m51
+from . import m1175
+import pkg5.pkg42.pkg344.m1594
+from . import m8681
+import pkg1.pkg14.pkg116.m7204
+from pkg3.pkg31.pkg249 import m248
+import pkg4.pkg35.m5455
+from pkg1 import m0
+import pkg6.pkg52.pkg417.m2084
+from pkg2.pkg18.pkg151 import m567
+from . import m4094
+from pkg2.pkg22.pkg180 import m3098
+
+
+def helper_9515_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9515_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9515_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9515_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_9515_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,61 @@
+"""Module 2844."""
+import pkg4.m3
+from pkg2.pkg23 import m22
+import pkg2.pkg20.pkg166.m165
+from pkg3.pkg26.pkg210 import m209
+import pkg2.pkg17.pkg139.m1806
+from pkg2.pkg19.pkg160 import m159
+import pkg3.pkg27.pkg217.m633
+from pkg1.pkg10.pkg81 import m2582
+from . import m1176
+from pkg5.pkg45.pkg365 import m364
+import pkg4.pkg35.pkg288.m704
+
+
+def helper_2844_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2844_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2844_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2844_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_2844_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_2844_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2844_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,14 @@
+"""Module 5763."""
+import pkg6.pkg51.m50
+from pkg2.pkg19.pkg158 import m574
+import pkg1.pkg10.pkg81.m914
+from . import m4095
+import pkg4.pkg36.pkg289.m288
+from pkg3 import m419
+
+
+def helper_5763_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,13 @@
+"""Module 7431."""
+from . import m4095
+from . import m2010
+import pkg1.pkg11.m10
+from . import m3678
+from . import m2427
+
+
+def helper_7431_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
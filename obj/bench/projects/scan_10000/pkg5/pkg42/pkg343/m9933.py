@@ -0,0 +1,18 @@
+"""Module 9933."""
+from . import m5346
+from pkg3.pkg25.pkg202 import m201
+from . import m2010
+from pkg7.pkg58 import m1308
+import pkg4.pkg40.pkg325.m3243
+from pkg6.pkg54 import m1721
+import pkg3.pkg29.pkg237.m2738
+from pkg1.pkg11.pkg89 import m1339
+import pkg2.pkg18.m17
+from pkg8.pkg71 import m1738
+
+
+def helper_9933_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 3262."""
+import pkg5.pkg44.pkg359.m2860
+from pkg2.pkg17.pkg143 import m976
+import pkg4.pkg39.pkg318.m1568
+from . import m343
+import pkg4.pkg40.pkg326.m742
+from pkg1.pkg16.pkg131 import m547
+import pkg2.pkg18.pkg151.m984
+from pkg4.pkg33.pkg272 import m271
+from . import m2428
+from pkg1.pkg9 import m425
+
+
+def helper_3262_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,21 @@
+"""Module 6181."""
+import pkg1.m0
+from pkg2.pkg17 import m2518
+import pkg2.m835
+from pkg1.pkg13.pkg109 import m2610
+import pkg4.pkg35.m451
+from pkg4.pkg37.pkg301 import m300
+
+
+def helper_6181_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6181_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
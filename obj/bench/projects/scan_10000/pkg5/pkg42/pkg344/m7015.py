@@ -0,0 +1,55 @@
+"""Module 7015."""
+import pkg1.pkg9.pkg74.m73
+from pkg1.pkg13.pkg109 import m1359
+import pkg7.pkg64.m5901
+from pkg1.pkg13.pkg108 import m4277
+import pkg2.pkg19.m18
+from pkg4.pkg33.pkg265 import m2349
+import pkg3.pkg25.pkg208.m6045
+from pkg6.pkg50.pkg407 import m2074
+from . import m3262
+from . import m1594
+import pkg3.pkg28.pkg232.m1065
+from pkg6.pkg50 import m49
+
+
+def helper_7015_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7015_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7015_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7015_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_7015_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_7015_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 2544."""
+from . import m1293
+from pkg2.pkg21.pkg175 import m174
+import pkg4.pkg39.pkg319.m1986
+from . import m42
+from . import m2127
+from pkg3.pkg27.pkg223 import m222
+import pkg3.pkg31.pkg251.m667
+from pkg5.pkg44 import m1294
+import pkg1.m0
+from . import m876
+import pkg2.pkg21.pkg173.m172
+
+
+def helper_2544_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2544_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,28 @@
+"""Module 2961."""
+import pkg2.pkg23.pkg191.m2275
+from pkg3.pkg26 import m442
+import pkg1.pkg11.pkg92.m2593
+from pkg2.pkg18.pkg145 import m1812
+import pkg3.pkg31.pkg255.m2756
+from pkg3.pkg29 import m28
+
+
+def helper_2961_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2961_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2961_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,9 @@
+"""Module 3795."""
+from . import m876
+
+
+def helper_3795_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
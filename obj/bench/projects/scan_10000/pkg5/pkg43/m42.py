@@ -0,0 +1,12 @@
+"""Module 42."""
+import pkg1.pkg11.m10
+from pkg1.pkg10 import m9
+import pkg1.m0
+from pkg3.pkg29 import m28
+
+
+def helper_42_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
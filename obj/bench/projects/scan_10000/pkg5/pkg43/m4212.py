@@ -0,0 +1,17 @@
+"""Module 4212."""
+import pkg5.pkg47.pkg381.m797
+from pkg4.pkg33 import m4202
+from . import m3795
+from pkg1.pkg14.pkg120 import m119
+import pkg2.pkg21.m1688
+from . import m2127
+import pkg3.pkg28.pkg226.m642
+from pkg4.pkg38.pkg309 import m1142
+import pkg5.pkg48.pkg386.m1219
+
+
+def helper_4212_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
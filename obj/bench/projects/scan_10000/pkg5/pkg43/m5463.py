@@ -0,0 +1,15 @@
+"""Module 5463."""
+import pkg4.m3339
+from pkg4.pkg39 import m38
+import pkg2.pkg20.pkg165.m4334
+from pkg2.pkg22.pkg178 import m594
+import pkg4.pkg37.m2538
+from pkg1.pkg14.pkg116 import m115
+import pkg1.pkg11.pkg94.m93
+
+
+def helper_5463_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
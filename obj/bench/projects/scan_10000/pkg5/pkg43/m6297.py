@@ -0,0 +1,40 @@
+"""Module 6297."""
+import pkg3.pkg28.pkg232.m3984
+from pkg2.pkg17.pkg143 import m559
+import pkg3.pkg26.pkg214.m6051
+from pkg3.pkg31.pkg250 import m1917
+import pkg1.pkg9.pkg74.m73
+from . import m42
+import pkg1.pkg12.pkg97.m3432
+from pkg1.pkg9 import m8
+import pkg4.pkg34.pkg276.m275
+from pkg1.pkg12.pkg98 import m3016
+import pkg5.pkg42.pkg342.m2009
+
+
+def helper_6297_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6297_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6297_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6297_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
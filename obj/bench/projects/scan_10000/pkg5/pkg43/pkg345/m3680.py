@@ -0,0 +1,41 @@
+"""Module 3680."""
+import pkg1.pkg9.pkg78.m77
+from pkg3.pkg25 import m441
+from . import m3263
+from pkg2.pkg17.pkg139 import m2640
+import pkg4.pkg34.pkg274.m1524
+from . import m761
+import pkg6.pkg50.pkg408.m1658
+from . import m1178
+import pkg1.m834
+from pkg1 import m0
+import pkg2.pkg21.pkg174.m173
+from pkg4.pkg38.pkg305 import m304
+
+
+def helper_3680_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3680_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3680_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3680_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
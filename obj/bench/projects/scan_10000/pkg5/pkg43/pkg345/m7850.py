@@ -0,0 +1,9 @@
+"""Module 7850."""
+import pkg1.pkg14.pkg117.m7622
+
+
+def helper_7850_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 1179."""
+import pkg1.m0
+from pkg1.pkg9 import m8
+import pkg1.pkg14.pkg118.m117
+from pkg4.pkg33.pkg268 import m1101
+from . import m345
+from . import m762
+import pkg4.pkg37.m36
+from pkg2.pkg22.pkg179 import m178
+import pkg2.pkg21.pkg173.m172
+from pkg6 import m5
+import pkg3.pkg29.pkg237.m236
+
+
+def helper_1179_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,24 @@
+"""Module 6183."""
+import pkg2.pkg23.pkg185.m601
+from pkg2.pkg19.pkg153 import m3488
+import pkg1.pkg10.m9
+from pkg4.pkg37 import m36
+import pkg4.pkg39.pkg320.m1987
+from . import m3264
+import pkg8.pkg68.m67
+from . import m2013
+from . import m5766
+
+
+def helper_6183_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6183_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
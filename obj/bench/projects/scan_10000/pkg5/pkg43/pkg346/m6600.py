@@ -0,0 +1,21 @@
+"""Module 6600."""
+import pkg1.m0
+from pkg4.pkg35.pkg286 import m1119
+import pkg3.pkg30.pkg243.m242
+from pkg3.pkg26.pkg214 import m2298
+import pkg2.pkg18.m3770
+from pkg3.pkg32.pkg263 import m4015
+
+
+def helper_6600_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6600_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
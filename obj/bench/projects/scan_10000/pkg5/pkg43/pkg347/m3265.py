@@ -0,0 +1,27 @@
+"""Module 3265."""
+import pkg3.pkg27.pkg217.m1884
+from pkg6.pkg50.pkg404 import m820
+import pkg1.pkg15.pkg121.m537
+from pkg2.pkg21.pkg174 import m590
+from . import m2014
+from pkg5.pkg43.pkg351 import m2018
+import pkg2.pkg23.m22
+from pkg1 import m0
+from . import m2848
+from pkg5.pkg41.pkg336 import m2003
+from . import m1180
+from pkg5.pkg44 import m1711
+
+
+def helper_3265_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3265_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,10 @@
+"""Module 3682."""
+import pkg2.pkg20.pkg165.m1415
+from pkg4.pkg34.pkg276 import m275
+import pkg7.m6
+from pkg3.pkg29 import m445
+import pkg1.pkg9.pkg80.m79
+from pkg1.pkg11 import m10
+from . import m1180
+from pkg3.pkg28 import m27
+import pkg2.pkg22.pkg181.m180
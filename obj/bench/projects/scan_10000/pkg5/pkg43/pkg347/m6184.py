@@ -0,0 +1,16 @@
+"""Module 6184."""
+import pkg2.pkg24.pkg194.m1444
+from pkg7 import m840
+import pkg3.pkg30.pkg244.m1494
+from pkg5.pkg46.pkg369 import m368
+import pkg3.m1670
+from pkg4.pkg33.pkg270 import m686
+from . import m4933
+from pkg3.pkg31.pkg254 import m1087
+
+
+def helper_6184_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,23 @@
+"""Module 7018."""
+import pkg5.pkg41.m3793
+from pkg5.pkg43.pkg352 import m5355
+from . import m2014
+from pkg5.pkg48.pkg385 import m384
+import pkg3.pkg32.m31
+from pkg2.pkg17 import m16
+import pkg8.m841
+from pkg1.pkg9.pkg76 import m492
+
+
+def helper_7018_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7018_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,32 @@
+"""Module 763."""
+import pkg1.pkg11.pkg90.m89
+from pkg2.pkg24.pkg197 import m196
+import pkg1.pkg11.m10
+from pkg2.pkg21.pkg176 import m175
+import pkg1.pkg10.m9
+from pkg5.pkg41.pkg333 import m332
+import pkg4.pkg37.pkg299.m298
+from . import m346
+import pkg2.pkg23.pkg185.m184
+from pkg4.pkg39.pkg314 import m730
+
+
+def helper_763_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_763_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_763_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,54 @@
+"""Module 8269."""
+import pkg1.pkg15.pkg125.m124
+from pkg2.pkg19.pkg158 import m2659
+import pkg5.pkg43.pkg351.m4520
+from pkg4.pkg37.pkg303 import m719
+import pkg6.pkg51.pkg415.m1248
+from pkg3.pkg30.pkg242 import m3994
+import pkg5.pkg44.pkg353.m3688
+from . import m346
+import pkg5.pkg47.pkg382.m1632
+from pkg5.pkg45.pkg361 import m4530
+import pkg5.pkg43.pkg350.m766
+
+
+def helper_8269_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8269_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8269_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8269_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_8269_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_8269_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,2 @@
+"""Module 9103."""
+import pkg1.pkg9.pkg75.m74
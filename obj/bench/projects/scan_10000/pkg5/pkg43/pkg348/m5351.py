@@ -0,0 +1,31 @@
+"""Module 5351."""
+import pkg5.pkg42.pkg337.m753
+from pkg2.pkg17.pkg142 import m2643
+import pkg2.pkg18.pkg150.m5153
+from pkg2.pkg24 import m23
+import pkg1.pkg9.pkg77.m2578
+from . import m1181
+from . import m347
+from pkg4.pkg34.pkg273 import m272
+import pkg1.pkg10.pkg81.m3416
+
+
+def helper_5351_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5351_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5351_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,30 @@
+"""Module 9104."""
+import pkg1.pkg9.pkg75.m8414
+from . import m7853
+import pkg4.pkg35.pkg288.m1955
+from pkg5.pkg43.pkg351 import m2018
+import pkg1.pkg15.pkg121.m537
+from pkg2.pkg21.pkg171 import m8510
+import pkg3.pkg25.m24
+from pkg3.pkg25 import m441
+
+
+def helper_9104_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9104_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9104_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,39 @@
+"""Module 1182."""
+import pkg1.pkg9.m8
+from pkg6 import m5
+import pkg3.pkg26.m25
+from . import m765
+import pkg1.m0
+from . import m348
+import pkg4.pkg36.pkg293.m292
+from pkg3.pkg27.pkg222 import m221
+import pkg4.pkg33.pkg271.m687
+from pkg3.pkg28.pkg228 import m1061
+
+
+def helper_1182_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1182_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1182_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1182_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 3267."""
+import pkg4.pkg34.m2952
+from . import m2850
+import pkg4.pkg33.pkg266.m1933
+from pkg6 import m5
+import pkg8.pkg70.m69
+from pkg2.pkg24.pkg197 import m613
+import pkg1.pkg9.pkg79.m1329
+from pkg4.pkg40.pkg325 import m324
+import pkg5.pkg42.pkg344.m2011
+from pkg3.pkg30.pkg241 import m657
+from . import m2433
+
+
+def helper_3267_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
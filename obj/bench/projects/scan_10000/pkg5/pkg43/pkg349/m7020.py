@@ -0,0 +1,19 @@
+"""Module 7020."""
+import pkg5.pkg45.pkg365.m1615
+from pkg2.pkg18.pkg150 import m5570
+import pkg4.pkg34.pkg280.m4449
+from pkg4.pkg38 import m1288
+import pkg1.m0
+from pkg2.pkg18.pkg146 import m1813
+import pkg3.pkg27.pkg217.m216
+from pkg2.pkg18.pkg146 import m979
+import pkg4.pkg40.pkg323.m6577
+from pkg3.pkg29.pkg234 import m5237
+import pkg6.pkg54.m53
+
+
+def helper_7020_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,15 @@
+"""Module 9939."""
+import pkg4.pkg34.pkg276.m9449
+from pkg7.pkg62 import m478
+from . import m765
+from pkg2.pkg18.pkg146 import m1396
+import pkg1.pkg14.m13
+from pkg1.pkg12.pkg103 import m3855
+from . import m1182
+
+
+def helper_9939_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 2017."""
+import pkg3.pkg28.pkg230.m1897
+from pkg1.pkg10 import m426
+import pkg4.pkg38.pkg308.m724
+from pkg2.pkg24 import m23
+
+
+def helper_2017_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2017_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2017_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 4519."""
+import pkg4.pkg35.pkg284.m1534
+from . import m766
+import pkg5.pkg43.pkg352.m351
+from . import m349
+import pkg2.pkg19.pkg153.m986
+from pkg4 import m3
+import pkg5.pkg45.pkg361.m360
+from . import m1183
+from . import m2434
+from pkg6.pkg50.pkg403 import m1236
+
+
+def helper_4519_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4519_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
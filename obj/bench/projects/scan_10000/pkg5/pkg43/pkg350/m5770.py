@@ -0,0 +1,26 @@
+"""Module 5770."""
+import pkg2.pkg24.pkg194.m193
+from pkg1.pkg10.pkg84 import m4670
+import pkg2.pkg24.pkg197.m196
+from pkg1.pkg9.pkg74 import m2992
+import pkg3.m2
+from pkg1 import m0
+import pkg1.pkg15.pkg123.m2624
+from pkg4.pkg37.pkg298 import m1548
+import pkg1.pkg14.pkg120.m1787
+from pkg3.pkg27.pkg223 import m3558
+from . import m2851
+
+
+def helper_5770_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5770_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 6604."""
+import pkg6.pkg52.pkg417.m6254
+from . import m5770
+import pkg6.pkg51.pkg412.m3330
+from pkg3.pkg28.pkg230 import m3148
+import pkg3.pkg32.pkg257.m6511
+from . import m766
+import pkg2.pkg17.pkg143.m1810
+from . import m4102
+import pkg5.pkg48.pkg385.m3720
+from pkg1 import m0
+import pkg3.pkg31.pkg256.m1923
+
+
+def helper_6604_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6604_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
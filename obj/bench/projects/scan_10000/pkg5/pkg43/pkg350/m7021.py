@@ -0,0 +1,44 @@
+"""Module 7021."""
+import pkg1.m0
+from pkg2.pkg19.pkg156 import m155
+import pkg1.pkg12.pkg103.m2187
+from pkg3.pkg27 import m26
+import pkg5.pkg44.m43
+from pkg1.pkg13.pkg109 import m108
+import pkg8.m424
+from pkg4.pkg33.pkg269 import m4021
+
+
+def helper_7021_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7021_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7021_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7021_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_7021_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
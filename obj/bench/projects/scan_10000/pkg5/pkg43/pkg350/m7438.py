@@ -0,0 +1,28 @@
+"""Module 7438."""
+import pkg2.pkg17.pkg143.m559
+from . import m3685
+import pkg1.m0
+from pkg2.pkg19.pkg158 import m1408
+import pkg2.pkg21.pkg176.m6847
+from . import m349
+
+
+def helper_7438_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7438_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7438_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
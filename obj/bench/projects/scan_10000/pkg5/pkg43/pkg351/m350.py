@@ -0,0 +1,35 @@
+"""Module 350."""
+import pkg1.pkg9.m8
+from pkg1 import m0
+import pkg1.pkg15.m14
+from pkg7.pkg64 import m63
+import pkg6.pkg51.m50
+from pkg2.pkg20.pkg164 import m163
+
+
+def helper_350_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_350_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_350_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_350_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
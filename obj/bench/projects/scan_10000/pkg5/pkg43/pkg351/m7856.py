@@ -0,0 +1,20 @@
+"""Module 7856."""
+import pkg4.pkg33.pkg267.m266
+from pkg7.pkg58 import m1725
+import pkg2.pkg20.pkg164.m580
+from . import m4103
+import pkg3.pkg32.pkg259.m1092
+from pkg2.pkg19.pkg160 import m159
+import pkg1.m0
+from pkg3.pkg32.pkg261 import m260
+import pkg2.pkg19.pkg159.m992
+from pkg3.pkg27.pkg222 import m221
+from . import m767
+from pkg1.pkg15 import m14
+
+
+def helper_7856_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
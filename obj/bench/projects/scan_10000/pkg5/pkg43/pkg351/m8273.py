@@ -0,0 +1,24 @@
+"""Module 8273."""
+from . import m5771
+from pkg3.pkg31.pkg249 import m8171
+import pkg4.pkg40.m39
+from pkg4.pkg35.pkg282 import m281
+import pkg1.pkg10.pkg81.m4250
+from pkg1.pkg13.pkg106 import m5943
+import pkg5.pkg46.pkg369.m2870
+from pkg3.pkg29.pkg238 import m1071
+import pkg4.pkg33.pkg270.m2354
+
+
+def helper_8273_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8273_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,32 @@
+"""Module 2436."""
+import pkg3.pkg26.pkg211.m627
+from pkg1 import m0
+import pkg3.pkg25.m858
+from pkg2.pkg19.pkg157 import m573
+import pkg2.pkg18.pkg149.m565
+from pkg4.pkg36.pkg294 import m710
+import pkg3.pkg28.pkg227.m2311
+from pkg5.pkg44 import m43
+import pkg2.pkg21.pkg175.m1425
+from . import m1602
+
+
+def helper_2436_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2436_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2436_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,37 @@
+"""Module 3270."""
+import pkg5.pkg46.pkg375.m2042
+from . import m1185
+from . import m2436
+from pkg1 import m0
+import pkg4.pkg38.pkg308.m307
+from pkg2.pkg19.pkg156 import m989
+import pkg2.pkg20.pkg161.m994
+from pkg2.pkg19.pkg156 import m1406
+
+
+def helper_3270_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3270_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3270_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3270_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,44 @@
+"""Module 6606."""
+from . import m4521
+from pkg3.pkg26.pkg215 import m1882
+import pkg3.pkg30.pkg243.m2327
+from pkg6 import m1256
+import pkg5.pkg47.m6301
+from pkg3 import m2
+import pkg5.pkg46.pkg373.m6210
+from pkg1.pkg13 import m429
+
+
+def helper_6606_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6606_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6606_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6606_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_6606_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
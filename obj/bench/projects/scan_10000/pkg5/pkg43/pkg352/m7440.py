@@ -0,0 +1,29 @@
+"""Module 7440."""
+import pkg1.m0
+from pkg7.pkg61 import m2562
+from . import m5772
+from pkg1.pkg11.pkg96 import m929
+import pkg3.m419
+from pkg3.pkg27 import m26
+import pkg5.pkg48.pkg386.m802
+
+
+def helper_7440_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7440_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7440_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 768."""
+from . import m351
+from pkg1.pkg16 import m15
+import pkg3.pkg26.pkg213.m629
+from pkg3.pkg28.pkg228 import m227
+
+
+def helper_768_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_768_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
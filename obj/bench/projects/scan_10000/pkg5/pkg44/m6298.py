@@ -0,0 +1,23 @@
+"""Module 6298."""
+import pkg1.pkg12.m11
+from pkg5.pkg42.pkg344 import m343
+from . import m5047
+from . import m877
+import pkg1.pkg15.pkg127.m3045
+from . import m3379
+import pkg4.pkg34.pkg277.m276
+from pkg3.pkg30.pkg241 import m240
+
+
+def helper_6298_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6298_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
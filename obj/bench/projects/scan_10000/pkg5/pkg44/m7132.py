@@ -0,0 +1,40 @@
+"""Module 7132."""
+import pkg4.m3
+from pkg4.pkg33 import m32
+import pkg4.pkg36.pkg291.m290
+from . import m2962
+import pkg1.pkg9.pkg79.m5499
+from . import m5881
+import pkg2.pkg20.m19
+from pkg1.pkg9.pkg73 import m489
+import pkg5.pkg46.pkg371.m1621
+from . import m4213
+from . import m2128
+
+
+def helper_7132_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7132_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7132_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7132_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,28 @@
+"""Module 7966."""
+import pkg1.pkg10.pkg84.m1334
+from . import m2128
+from . import m2962
+from pkg4 import m2088
+import pkg2.m1
+from pkg7.pkg58 import m57
+
+
+def helper_7966_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7966_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7966_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
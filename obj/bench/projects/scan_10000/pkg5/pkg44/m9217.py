@@ -0,0 +1,18 @@
+"""Module 9217."""
+import pkg4.pkg38.pkg311.m310
+from pkg3.pkg32.pkg261 import m260
+import pkg3.pkg26.pkg209.m4795
+
+
+def helper_9217_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9217_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
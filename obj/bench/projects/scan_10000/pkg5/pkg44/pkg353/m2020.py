@@ -0,0 +1,17 @@
+"""Module 2020."""
+from . import m352
+from pkg1.pkg16.pkg132 import m131
+
+
+def helper_2020_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2020_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,13 @@
+"""Module 352."""
+import pkg6.pkg52.m51
+from pkg4.pkg35.pkg281 import m280
+import pkg5.pkg41.m40
+from pkg5.pkg43.pkg351 import m350
+import pkg8.m7
+
+
+def helper_352_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 4522."""
+from . import m769
+from pkg5.pkg48.pkg392 import m391
+import pkg2.pkg22.pkg184.m3936
+from pkg5.pkg47.pkg378 import m377
+import pkg5.m4
+from . import m2437
+import pkg4.pkg39.m38
+from . import m352
+import pkg4.pkg34.pkg279.m278
+from pkg4.pkg37.pkg303 import m2804
+import pkg1.pkg16.pkg136.m552
+
+
+def helper_4522_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4522_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 7441."""
+import pkg1.pkg16.pkg134.m2218
+from pkg4.pkg37.pkg300 import m3218
+from . import m4105
+from . import m5356
+import pkg1.pkg11.pkg95.m94
+
+
+def helper_7441_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7441_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7441_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
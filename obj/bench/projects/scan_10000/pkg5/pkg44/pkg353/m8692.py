@@ -0,0 +1,38 @@
+"""Module 8692."""
+import pkg1.pkg15.pkg122.m3457
+from . import m3688
+import pkg4.pkg33.pkg265.m3183
+from pkg8.pkg70 import m3822
+import pkg1.pkg11.pkg90.m506
+from . import m4105
+import pkg2.pkg19.pkg154.m153
+from pkg6 import m3758
+import pkg6.pkg49.m48
+
+
+def helper_8692_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8692_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8692_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8692_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
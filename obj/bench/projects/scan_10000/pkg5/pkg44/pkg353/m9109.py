@@ -0,0 +1,18 @@
+"""Module 9109."""
+from . import m5356
+from . import m4939
+import pkg5.pkg41.pkg333.m2834
+
+
+def helper_9109_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9109_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
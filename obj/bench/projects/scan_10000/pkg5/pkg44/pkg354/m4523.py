@@ -0,0 +1,4 @@
+"""Module 4523."""
+import pkg1.pkg11.pkg93.m92
+from pkg2.pkg24.pkg194 import m3112
+import pkg3.pkg28.pkg229.m2730
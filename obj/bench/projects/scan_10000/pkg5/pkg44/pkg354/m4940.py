@@ -0,0 +1,18 @@
+"""Module 4940."""
+import pkg5.pkg48.pkg386.m385
+from pkg1.pkg15.pkg124 import m3042
+import pkg3.pkg31.pkg256.m2340
+from pkg2.pkg19.pkg153 import m569
+import pkg1.m0
+from pkg1.pkg15.pkg128 import m127
+import pkg3.pkg25.pkg205.m621
+from pkg4 import m3
+import pkg3.pkg30.pkg241.m657
+from pkg2.pkg22.pkg178 import m177
+
+
+def helper_4940_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,32 @@
+"""Module 6191."""
+import pkg1.pkg12.pkg104.m103
+from pkg1 import m0
+from . import m2855
+from pkg3.pkg27 import m26
+import pkg3.pkg28.pkg229.m1479
+from pkg3.pkg29.pkg237 import m236
+import pkg7.pkg60.m59
+from pkg8.pkg65 import m64
+import pkg5.pkg43.m42
+from pkg1.pkg9.pkg76 import m492
+
+
+def helper_6191_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6191_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6191_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
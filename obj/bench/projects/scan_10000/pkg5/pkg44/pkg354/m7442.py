@@ -0,0 +1,24 @@
+"""Module 7442."""
+from . import m4106
+from . import m2855
+import pkg4.pkg36.m35
+from pkg1.pkg10.pkg87 import m503
+import pkg1.pkg15.pkg124.m2625
+from . import m353
+import pkg2.pkg22.m2106
+from pkg8.pkg66 import m482
+import pkg3.pkg30.pkg248.m1498
+
+
+def helper_7442_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7442_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
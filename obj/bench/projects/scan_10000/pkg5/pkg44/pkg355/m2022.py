@@ -0,0 +1,19 @@
+"""Module 2022."""
+from . import m1188
+from pkg2.pkg19.pkg157 import m1824
+import pkg1.m0
+from pkg3.pkg29 import m28
+
+
+def helper_2022_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2022_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 354."""
+import pkg3.pkg31.pkg256.m255
+from pkg1 import m0
+import pkg6.m5
+from pkg3.pkg28.pkg227 import m226
+import pkg3.pkg29.pkg238.m237
+
+
+def helper_354_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_354_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,62 @@
+"""Module 4107."""
+import pkg3.m2
+from pkg3.pkg32.pkg264 import m4016
+import pkg2.pkg21.pkg173.m3091
+from . import m2022
+import pkg1.pkg10.pkg88.m87
+from pkg7.pkg61 import m894
+from . import m3273
+from pkg8.pkg68 import m484
+from . import m1605
+from pkg2.pkg21.pkg171 import m2255
+import pkg2.pkg23.pkg190.m1440
+from pkg5.pkg48.pkg388 import m2472
+
+
+def helper_4107_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4107_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4107_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4107_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_4107_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_4107_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4107_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,24 @@
+"""Module 7026."""
+import pkg3.pkg27.pkg220.m219
+from pkg2.pkg20 import m19
+import pkg1.m0
+from pkg1.pkg12 import m11
+import pkg4.pkg35.m34
+from pkg2.pkg24 import m23
+import pkg1.pkg15.pkg126.m125
+from pkg5.pkg42.pkg337 import m753
+import pkg4.pkg38.m871
+
+
+def helper_7026_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7026_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
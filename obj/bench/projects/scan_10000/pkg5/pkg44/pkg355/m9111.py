@@ -0,0 +1,54 @@
+"""Module 9111."""
+import pkg1.pkg10.pkg83.m82
+from pkg5 import m4
+import pkg1.pkg15.pkg122.m4291
+from pkg3.pkg25.pkg204 import m2705
+import pkg1.m4587
+from pkg4.pkg39.pkg319 import m735
+from . import m5775
+from . import m4107
+import pkg2.pkg18.pkg151.m3069
+from . import m7860
+import pkg5.pkg48.m464
+
+
+def helper_9111_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9111_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9111_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9111_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_9111_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_9111_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
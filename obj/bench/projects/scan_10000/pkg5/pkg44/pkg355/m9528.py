@@ -0,0 +1,17 @@
+"""Module 9528."""
+from . import m6609
+from pkg2.pkg19 import m18
+import pkg2.pkg17.pkg137.m3055
+from pkg4.pkg38.pkg312 import m1562
+import pkg7.pkg57.m6311
+from pkg1.pkg12 import m1679
+import pkg3.pkg26.pkg212.m628
+from . import m3690
+import pkg1.pkg13.m12
+
+
+def helper_9528_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
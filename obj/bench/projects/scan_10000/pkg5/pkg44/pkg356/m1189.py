@@ -0,0 +1,61 @@
+"""Module 1189."""
+import pkg6.pkg50.pkg405.m821
+from pkg1.pkg9.pkg75 import m74
+import pkg1.m0
+from pkg3.pkg30.pkg245 import m661
+import pkg4.m3
+from pkg3.pkg29.pkg236 import m652
+import pkg2.pkg24.pkg197.m196
+from pkg5.pkg41.pkg332 import m331
+import pkg2.pkg19.pkg160.m576
+from pkg3.pkg27 import m26
+import pkg2.pkg19.m18
+
+
+def helper_1189_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1189_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1189_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1189_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_1189_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_1189_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1189_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
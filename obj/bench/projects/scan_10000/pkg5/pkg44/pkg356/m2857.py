@@ -0,0 +1,33 @@
+"""Module 2857."""
+from . import m772
+from pkg5.pkg46.pkg372 import m788
+import pkg8.m7
+from pkg2.pkg24.pkg197 import m196
+from . import m1189
+from pkg3.pkg27.pkg218 import m217
+import pkg4.pkg38.pkg311.m727
+from pkg1.pkg11.pkg89 import m2590
+import pkg5.pkg43.m42
+from pkg4.pkg39.pkg317 import m316
+import pkg7.m6
+
+
+def helper_2857_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2857_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2857_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
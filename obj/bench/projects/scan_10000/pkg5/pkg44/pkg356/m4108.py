@@ -0,0 +1,20 @@
+"""Module 4108."""
+import pkg5.pkg45.pkg361.m1194
+from . import m3274
+import pkg4.pkg37.pkg302.m3220
+from pkg7.pkg61 import m477
+import pkg3.pkg25.pkg201.m200
+from pkg3.pkg29 import m28
+import pkg4.m3
+from pkg5.pkg43.pkg350 import m766
+import pkg8.m7
+from pkg6.pkg49.pkg393 import m392
+from . import m1606
+from . import m2440
+
+
+def helper_4108_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 4942."""
+import pkg1.pkg9.m8
+from pkg5.pkg45.pkg361 import m2445
+import pkg3.pkg25.pkg201.m2285
+from pkg4.pkg37 import m453
+from . import m3691
+
+
+def helper_4942_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4942_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4942_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,54 @@
+"""Module 772."""
+import pkg5.pkg43.pkg347.m346
+from pkg5 import m4
+import pkg4.pkg35.pkg283.m282
+from pkg2.pkg22 import m21
+from . import m355
+from pkg2.pkg19.pkg160 import m159
+import pkg5.pkg45.pkg368.m367
+from pkg1.pkg12.pkg103 import m102
+import pkg2.pkg23.pkg188.m604
+from pkg3 import m2
+import pkg5.pkg48.pkg392.m391
+
+
+def helper_772_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_772_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_772_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_772_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_772_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_772_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,13 @@
+"""Module 8695."""
+from . import m2023
+from pkg1.pkg10.pkg87 import m86
+import pkg2.m1
+from pkg1.pkg10.pkg81 import m497
+import pkg3.pkg31.pkg255.m254
+
+
+def helper_8695_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,36 @@
+"""Module 2024."""
+from . import m356
+from pkg2.pkg22.pkg179 import m1012
+import pkg1.pkg15.pkg123.m122
+from pkg4 import m3
+import pkg1.pkg10.m9
+from pkg5.pkg48.pkg389 import m1222
+import pkg3.pkg29.pkg238.m237
+
+
+def helper_2024_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2024_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2024_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2024_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,38 @@
+"""Module 7028."""
+import pkg5.pkg43.pkg350.m1183
+from pkg4.pkg34 import m33
+from . import m2858
+from pkg7.pkg62 import m895
+from . import m3275
+from pkg2.pkg21.pkg174 import m6428
+import pkg1.m0
+from . import m2024
+import pkg4.pkg34.m4203
+
+
+def helper_7028_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7028_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7028_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7028_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
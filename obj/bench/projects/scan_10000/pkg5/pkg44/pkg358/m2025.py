@@ -0,0 +1,48 @@
+"""Module 2025."""
+import pkg5.pkg47.m46
+from pkg1 import m0
+import pkg7.pkg60.m59
+from pkg2.pkg20.pkg168 import m167
+import pkg2.pkg20.pkg166.m165
+from pkg3.pkg26.pkg214 import m213
+import pkg8.m7
+from pkg5.pkg44 import m1294
+from . import m357
+from . import m1191
+from . import m1608
+from pkg6.pkg50.pkg402 import m1652
+
+
+def helper_2025_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2025_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2025_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2025_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_2025_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
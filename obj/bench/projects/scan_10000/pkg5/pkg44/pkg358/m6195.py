@@ -0,0 +1,25 @@
+"""Module 6195."""
+import pkg3.pkg26.pkg215.m2299
+from pkg1.pkg9 import m8
+import pkg1.pkg9.pkg78.m2996
+from pkg8.pkg71 import m1321
+import pkg4.m3
+from pkg5.pkg43.pkg345 import m344
+import pkg5.pkg45.pkg367.m4119
+from . import m5361
+from . import m4527
+from pkg3.pkg29.pkg235 import m2736
+
+
+def helper_6195_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6195_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
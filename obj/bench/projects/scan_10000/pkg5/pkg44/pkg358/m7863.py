@@ -0,0 +1,18 @@
+"""Module 7863."""
+from . import m2025
+from pkg4.pkg35.pkg288 import m3623
+import pkg6.pkg49.pkg395.m4147
+
+
+def helper_7863_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7863_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,38 @@
+"""Module 8697."""
+import pkg1.pkg10.pkg84.m5504
+from pkg1.pkg12.pkg97 import m2181
+import pkg6.pkg53.m2137
+from pkg6.pkg51.pkg414 import m5417
+import pkg2.pkg19.pkg154.m153
+from pkg1.pkg14 import m13
+import pkg4.pkg39.pkg316.m732
+from pkg5.pkg46.pkg369 import m2870
+import pkg5.pkg43.pkg346.m4932
+
+
+def helper_8697_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8697_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8697_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8697_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,45 @@
+"""Module 2026."""
+import pkg1.m0
+from pkg4.pkg35.pkg282 import m698
+import pkg3.pkg29.m28
+from . import m775
+import pkg4.m3
+from pkg3.pkg25.pkg203 import m202
+import pkg3.pkg32.pkg258.m257
+from pkg2.pkg21.pkg174 import m173
+from . import m1609
+
+
+def helper_2026_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2026_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2026_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2026_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_2026_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
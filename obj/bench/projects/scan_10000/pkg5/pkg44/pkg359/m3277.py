@@ -0,0 +1,24 @@
+"""Module 3277."""
+import pkg7.pkg60.m476
+from pkg2 import m1
+import pkg3.pkg25.pkg205.m204
+from pkg3.pkg30.pkg247 import m246
+from . import m358
+from pkg1 import m0
+import pkg1.pkg11.pkg91.m90
+from pkg1.pkg13.pkg109 import m108
+import pkg5.pkg45.pkg361.m777
+
+
+def helper_3277_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3277_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,55 @@
+"""Module 4111."""
+import pkg6.pkg50.m49
+from pkg1.pkg10.pkg87 import m1337
+import pkg1.pkg12.pkg98.m3850
+from pkg5.pkg47 import m46
+import pkg5.pkg47.pkg382.m1632
+from pkg6.pkg53 import m1303
+import pkg4.pkg33.pkg269.m1102
+from pkg3 import m2
+import pkg4.pkg35.m3787
+from pkg1.pkg10.pkg82 import m915
+import pkg4.pkg36.m35
+from pkg1.pkg11.pkg89 import m505
+
+
+def helper_4111_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4111_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4111_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4111_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_4111_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_4111_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,28 @@
+"""Module 4528."""
+import pkg2.pkg17.m16
+from . import m4111
+import pkg4.pkg39.pkg313.m1980
+from pkg5.pkg43.pkg345 import m761
+import pkg2.m1
+from pkg4.pkg36.pkg295 import m711
+
+
+def helper_4528_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4528_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4528_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
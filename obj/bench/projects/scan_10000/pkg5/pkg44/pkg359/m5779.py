@@ -0,0 +1,10 @@
+"""Module 5779."""
+import pkg3.pkg28.pkg229.m4398
+from pkg1.pkg14.pkg120 import m119
+
+
+def helper_5779_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
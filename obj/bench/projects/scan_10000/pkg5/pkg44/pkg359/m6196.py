@@ -0,0 +1,41 @@
+"""Module 6196."""
+from . import m358
+from pkg5.pkg41.pkg332 import m331
+import pkg3.pkg27.pkg223.m222
+from pkg2.pkg18.pkg150 import m566
+import pkg4.pkg38.pkg307.m723
+from pkg1.pkg13.pkg112 import m111
+from . import m3694
+from pkg4.pkg38.pkg310 import m2811
+import pkg6.m5
+from pkg4.pkg35 import m451
+import pkg7.m6
+from . import m4945
+
+
+def helper_6196_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6196_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6196_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6196_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,13 @@
+"""Module 8281."""
+import pkg1.pkg9.pkg73.m4659
+from pkg1.pkg10.pkg85 import m918
+import pkg2.pkg17.m16
+from pkg3.pkg27.pkg223 import m222
+from . import m3694
+
+
+def helper_8281_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,22 @@
+"""Module 9949."""
+import pkg2.pkg19.pkg154.m5991
+from pkg3.pkg26.pkg213 import m8969
+import pkg3.pkg28.pkg227.m4396
+from pkg4.pkg39.pkg313 import m1980
+import pkg2.pkg17.pkg140.m139
+from . import m7030
+import pkg3.pkg31.pkg251.m1084
+
+
+def helper_9949_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9949_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
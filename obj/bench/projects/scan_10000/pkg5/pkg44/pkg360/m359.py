@@ -0,0 +1,29 @@
+"""Module 359."""
+import pkg4.pkg35.m34
+from pkg1.pkg16.pkg129 import m128
+import pkg5.pkg42.m41
+from pkg4.pkg39.pkg320 import m319
+import pkg3.pkg26.pkg215.m214
+from pkg1.pkg10.pkg86 import m85
+import pkg1.pkg16.m15
+
+
+def helper_359_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_359_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_359_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
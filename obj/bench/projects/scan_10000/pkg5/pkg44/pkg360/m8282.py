@@ -0,0 +1,40 @@
+"""Module 8282."""
+import pkg6.pkg53.m52
+from pkg6.pkg51.pkg409 import m408
+import pkg2.pkg21.pkg174.m2258
+from pkg4.pkg36.pkg290 import m706
+import pkg5.pkg43.pkg347.m6601
+from pkg2 import m1
+from . import m359
+from pkg5.pkg44.pkg355 import m771
+import pkg1.m0
+from pkg1.pkg14 import m13
+import pkg2.pkg19.m18
+
+
+def helper_8282_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8282_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8282_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8282_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
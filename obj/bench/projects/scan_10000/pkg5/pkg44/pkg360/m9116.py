@@ -0,0 +1,19 @@
+"""Module 9116."""
+import pkg3.pkg32.m31
+from . import m7865
+import pkg1.m0
+from pkg5.pkg45.pkg366 import m4535
+from . import m2861
+from pkg1.pkg15.pkg125 import m3460
+import pkg2.pkg20.pkg165.m164
+from pkg3.pkg28.pkg230 import m3148
+import pkg4.pkg35.pkg285.m284
+from pkg5.pkg42.pkg343 import m9099
+from . import m4946
+
+
+def helper_9116_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,39 @@
+"""Module 1295."""
+import pkg1.pkg12.pkg97.m96
+from . import m461
+import pkg3.pkg28.pkg227.m643
+from pkg2.pkg20 import m19
+import pkg2.pkg17.pkg144.m143
+from pkg4.pkg33.pkg268 import m684
+import pkg1.pkg14.m13
+from pkg6.pkg50.pkg401 import m400
+from . import m878
+from pkg6.pkg52 import m468
+
+
+def helper_1295_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1295_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1295_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1295_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 3380."""
+import pkg1.pkg10.pkg83.m82
+from pkg2.pkg18.pkg152 import m985
+import pkg2.pkg23.m22
+from pkg4.pkg38.pkg309 import m1976
+import pkg8.m7
+from pkg2.pkg19 import m18
+from . import m878
+from pkg2 import m1
+import pkg2.pkg19.pkg159.m992
+
+
+def helper_3380_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
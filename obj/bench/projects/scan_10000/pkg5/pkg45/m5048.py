@@ -0,0 +1,35 @@
+"""Module 5048."""
+from . import m2546
+from pkg2.pkg22.pkg179 import m178
+import pkg1.pkg14.pkg115.m114
+from pkg3.pkg26.pkg210 import m1043
+import pkg4.pkg38.pkg306.m2807
+from . import m461
+
+
+def helper_5048_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5048_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5048_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5048_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
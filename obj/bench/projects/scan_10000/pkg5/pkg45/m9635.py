@@ -0,0 +1,17 @@
+"""Module 9635."""
+import pkg5.m4
+from pkg7.pkg59 import m892
+import pkg2.pkg17.m1684
+from . import m4214
+import pkg2.pkg21.pkg173.m6010
+from pkg2.pkg19.pkg154 import m153
+import pkg3.pkg30.pkg247.m3165
+from pkg8.pkg72 import m71
+import pkg3.pkg25.pkg205.m204
+
+
+def helper_9635_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
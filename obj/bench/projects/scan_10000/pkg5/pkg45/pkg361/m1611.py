@@ -0,0 +1,38 @@
+"""Module 1611."""
+from . import m360
+from . import m777
+import pkg1.pkg14.pkg113.m112
+from pkg3.pkg30.pkg241 import m1074
+import pkg2.pkg17.pkg138.m137
+from pkg3.pkg28.pkg231 import m230
+import pkg5.pkg41.pkg331.m330
+from pkg3.pkg27.pkg224 import m223
+import pkg4.pkg37.pkg302.m1552
+
+
+def helper_1611_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1611_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1611_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1611_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
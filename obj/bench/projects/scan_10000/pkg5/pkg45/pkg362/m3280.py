@@ -0,0 +1,26 @@
+"""Module 3280."""
+import pkg4.m3
+from pkg6.pkg49.pkg396 import m2063
+from . import m2029
+from pkg3 import m2
+from . import m361
+from pkg2.pkg23.pkg187 import m1854
+import pkg5.pkg43.pkg352.m351
+from . import m778
+import pkg5.pkg46.pkg370.m369
+from . import m2863
+import pkg1.pkg15.pkg122.m538
+
+
+def helper_3280_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3280_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,30 @@
+"""Module 5782."""
+import pkg1.pkg9.m425
+from pkg4.pkg36 import m35
+import pkg3.pkg26.pkg213.m1463
+from pkg4.pkg40.pkg322 import m321
+import pkg2.pkg22.pkg180.m4766
+from pkg3.pkg31.pkg256 import m4425
+import pkg1.pkg15.pkg125.m4294
+from pkg6.pkg49.pkg397 import m1647
+
+
+def helper_5782_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5782_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5782_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 7033."""
+import pkg4.pkg39.pkg316.m1566
+from . import m4948
+import pkg1.m0
+from pkg2.pkg23.pkg190 import m189
+import pkg1.pkg9.pkg79.m1329
+
+
+def helper_7033_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7033_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,9 @@
+"""Module 362."""
+import pkg1.m0
+
+
+def helper_362_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 3698."""
+import pkg1.pkg9.m8
+from pkg6 import m5
+import pkg1.pkg11.m10
+from pkg1.pkg12.pkg103 import m102
+from . import m1196
+from pkg8 import m7
+from . import m1613
+from pkg2.pkg19.pkg154 import m987
+import pkg1.m0
+from pkg2.pkg20.pkg161 import m160
+
+
+def helper_3698_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,40 @@
+"""Module 5783."""
+from . import m779
+from . import m4115
+import pkg1.m0
+from pkg1.pkg15.pkg127 import m1377
+from . import m2030
+from pkg3.pkg30.pkg243 import m242
+import pkg6.pkg51.pkg409.m1659
+from . import m3281
+import pkg2.pkg22.pkg179.m3097
+from pkg2.pkg21 import m2939
+import pkg3.pkg27.pkg221.m1471
+
+
+def helper_5783_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5783_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5783_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5783_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
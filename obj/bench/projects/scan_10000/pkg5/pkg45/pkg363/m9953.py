@@ -0,0 +1,25 @@
+"""Module 9953."""
+from . import m3698
+from pkg8.pkg67 import m66
+from . import m7868
+from pkg4.pkg38.pkg312 import m311
+import pkg1.pkg15.m3767
+from pkg3.pkg25.pkg203 import m202
+import pkg1.pkg15.pkg127.m6381
+from pkg2.pkg17.pkg140 import m1390
+import pkg2.pkg22.pkg180.m5183
+from pkg4.pkg40.pkg328 import m327
+
+
+def helper_9953_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9953_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,60 @@
+"""Module 2865."""
+import pkg1.pkg16.pkg131.m130
+from pkg4.pkg33.pkg267 import m266
+import pkg4.pkg36.pkg295.m711
+from pkg6.pkg54 import m53
+import pkg2.pkg19.pkg158.m2242
+from . import m2031
+import pkg1.pkg10.pkg85.m2586
+from pkg6.pkg51.pkg412 import m411
+import pkg4.pkg38.pkg312.m311
+from pkg4.pkg39.pkg315 import m314
+
+
+def helper_2865_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2865_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2865_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2865_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_2865_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_2865_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2865_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,54 @@
+"""Module 3282."""
+import pkg2.m1
+from pkg7.pkg57 import m56
+import pkg6.m5
+from . import m2448
+import pkg5.pkg47.m1714
+from pkg3.pkg27 import m443
+import pkg1.pkg16.pkg130.m129
+from pkg3.pkg29.pkg237 import m1904
+import pkg2.pkg21.pkg171.m170
+from pkg2.pkg23 import m22
+from . import m1197
+
+
+def helper_3282_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3282_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3282_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3282_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_3282_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_3282_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,33 @@
+"""Module 3699."""
+import pkg1.pkg12.m11
+from pkg5 import m4
+import pkg3.pkg29.m3364
+from pkg3.pkg27 import m2528
+import pkg1.pkg10.pkg86.m85
+from pkg4.pkg36.pkg295 import m2379
+import pkg1.pkg9.pkg77.m2161
+from pkg2.pkg20 import m19
+import pkg5.pkg43.pkg348.m2849
+from pkg5.pkg41.pkg333 import m1166
+import pkg3.pkg27.pkg217.m216
+
+
+def helper_3699_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3699_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3699_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
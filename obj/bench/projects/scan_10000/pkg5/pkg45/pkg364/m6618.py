@@ -0,0 +1,21 @@
+"""Module 6618."""
+import pkg1.pkg9.pkg73.m72
+from pkg3.pkg29 import m445
+from . import m5367
+from pkg3 import m2
+import pkg5.pkg42.pkg343.m1176
+from pkg5.pkg42.pkg342 import m5345
+
+
+def helper_6618_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6618_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 780."""
+import pkg4.m3
+from . import m363
+import pkg1.pkg14.pkg113.m112
+
+
+def helper_780_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_780_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 2449."""
+import pkg1.pkg14.pkg117.m116
+from pkg1 import m0
+import pkg5.pkg44.pkg357.m1190
+from pkg3.pkg28.pkg229 import m228
+import pkg8.pkg68.m1735
+from pkg2.pkg20.pkg166 import m1416
+from . import m781
+from pkg2.pkg23.pkg187 import m186
+from . import m1615
+from pkg1.pkg16.pkg129 import m2213
+import pkg5.pkg48.pkg390.m1223
+
+
+def helper_2449_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2449_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,53 @@
+"""Module 3283."""
+import pkg1.pkg15.pkg123.m1790
+from pkg6.pkg50.pkg408 import m1241
+import pkg4.m3
+from pkg4.pkg33.pkg265 import m264
+import pkg4.pkg33.pkg265.m681
+from . import m2032
+import pkg7.pkg57.m473
+from pkg3.pkg29.pkg233 import m232
+import pkg4.pkg40.pkg321.m737
+from pkg2.pkg22.pkg179 import m595
+
+
+def helper_3283_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3283_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3283_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3283_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_3283_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_3283_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
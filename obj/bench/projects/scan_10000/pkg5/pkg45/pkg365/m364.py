@@ -0,0 +1,28 @@
+"""Module 364."""
+import pkg5.pkg42.pkg343.m342
+from pkg6.pkg50 import m49
+import pkg2.pkg19.pkg153.m152
+from pkg3.pkg28.pkg229 import m228
+import pkg1.pkg16.m15
+from pkg1 import m0
+
+
+def helper_364_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_364_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_364_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
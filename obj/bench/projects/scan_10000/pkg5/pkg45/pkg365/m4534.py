@@ -0,0 +1,10 @@
+"""Module 4534."""
+from . import m2449
+from pkg1.pkg13 import m12
+
+
+def helper_4534_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,21 @@
+"""Module 5785."""
+import pkg2.pkg20.pkg163.m162
+from . import m2032
+import pkg1.pkg14.pkg119.m535
+from pkg6 import m5
+import pkg2.pkg24.pkg193.m192
+from . import m1198
+
+
+def helper_5785_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5785_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
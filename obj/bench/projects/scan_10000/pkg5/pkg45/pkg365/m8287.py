@@ -0,0 +1,34 @@
+"""Module 8287."""
+import pkg1.m0
+from pkg6.pkg50 import m883
+import pkg2.pkg19.pkg157.m4743
+from pkg4.pkg35.pkg287 import m7792
+import pkg1.pkg9.pkg73.m7578
+from pkg1.pkg14.pkg120 import m119
+import pkg1.pkg16.m15
+from pkg1.pkg16.pkg135 import m6389
+from . import m2449
+from pkg5.pkg48 import m2966
+from . import m2032
+from . import m2866
+
+
+def helper_8287_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8287_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8287_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
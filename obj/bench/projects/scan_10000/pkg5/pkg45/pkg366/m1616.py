@@ -0,0 +1,47 @@
+"""Module 1616."""
+import pkg3.pkg32.m31
+from pkg3.pkg28.pkg232 import m1482
+from . import m365
+from pkg5.pkg48.pkg385 import m384
+import pkg3.pkg29.m28
+from pkg8.pkg67 import m66
+import pkg2.pkg24.pkg199.m1032
+from pkg1.pkg13.pkg111 import m1361
+import pkg1.pkg9.m8
+from pkg2.pkg21.pkg171 import m587
+import pkg1.pkg11.pkg90.m923
+
+
+def helper_1616_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1616_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1616_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1616_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_1616_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,54 @@
+"""Module 2033."""
+import pkg1.pkg13.pkg107.m1357
+from pkg1.pkg11 import m10
+from . import m1199
+from pkg8 import m1675
+from . import m782
+from pkg2.pkg22.pkg181 import m597
+import pkg2.pkg22.pkg181.m180
+from pkg1 import m0
+import pkg6.pkg50.pkg402.m401
+from pkg1.pkg13 import m12
+import pkg3.pkg29.pkg236.m1903
+
+
+def helper_2033_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2033_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2033_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2033_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_2033_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_2033_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
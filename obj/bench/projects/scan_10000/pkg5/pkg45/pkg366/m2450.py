@@ -0,0 +1,19 @@
+"""Module 2450."""
+import pkg5.pkg41.m457
+from . import m782
+import pkg1.pkg11.pkg95.m511
+from . import m1199
+
+
+def helper_2450_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2450_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,23 @@
+"""Module 3284."""
+import pkg1.m0
+from pkg5.pkg42.pkg338 import m754
+import pkg5.pkg45.pkg361.m777
+from pkg1.pkg13.pkg109 import m525
+from . import m1616
+from pkg1.pkg12.pkg98 import m3016
+import pkg5.pkg45.pkg361.m3279
+from . import m2450
+
+
+def helper_3284_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3284_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
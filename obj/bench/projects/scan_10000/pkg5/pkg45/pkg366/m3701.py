@@ -0,0 +1,31 @@
+"""Module 3701."""
+import pkg2.pkg21.pkg175.m591
+from pkg1.pkg16.pkg134 import m133
+import pkg2.pkg24.m23
+from pkg7.pkg62 import m61
+import pkg6.pkg52.pkg417.m1667
+from . import m1616
+import pkg2.pkg21.pkg173.m589
+from . import m782
+import pkg1.pkg9.m8
+
+
+def helper_3701_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3701_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3701_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
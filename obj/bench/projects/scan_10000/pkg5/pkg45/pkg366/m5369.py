@@ -0,0 +1,32 @@
+"""Module 5369."""
+from . import m2033
+from . import m365
+import pkg5.pkg47.pkg383.m382
+from pkg1 import m0
+import pkg5.pkg47.pkg384.m800
+from pkg4.pkg33.pkg266 import m682
+from . import m4118
+from pkg2.pkg23.pkg190 import m3525
+import pkg1.pkg16.pkg131.m3049
+from pkg4.pkg36.pkg290 import m3208
+
+
+def helper_5369_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5369_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5369_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
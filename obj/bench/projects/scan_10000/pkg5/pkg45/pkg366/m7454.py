@@ -0,0 +1,25 @@
+"""Module 7454."""
+import pkg1.m0
+from pkg2.pkg20.pkg167 import m166
+import pkg1.pkg13.pkg108.m5111
+from pkg1.pkg10.pkg85 import m2169
+import pkg5.pkg47.pkg379.m7050
+from pkg3.pkg30 import m1280
+from . import m1616
+from pkg1.pkg13.pkg111 import m2195
+import pkg4.pkg33.pkg267.m3185
+from pkg2.pkg19.pkg156 import m1406
+
+
+def helper_7454_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7454_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
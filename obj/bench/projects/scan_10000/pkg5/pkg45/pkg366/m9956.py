@@ -0,0 +1,34 @@
+"""Module 9956."""
+import pkg1.pkg15.pkg127.m5547
+from pkg4.pkg35.pkg282 import m2783
+import pkg7.pkg57.m56
+from pkg4.pkg35.pkg281 import m697
+import pkg2.pkg23.pkg192.m1859
+
+
+def helper_9956_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9956_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9956_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9956_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
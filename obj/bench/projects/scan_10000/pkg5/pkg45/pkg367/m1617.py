@@ -0,0 +1,38 @@
+"""Module 1617."""
+import pkg4.pkg39.pkg320.m1570
+from pkg6 import m5
+import pkg4.pkg36.pkg292.m291
+from pkg7.pkg63 import m62
+import pkg1.m0
+from pkg4.pkg35.pkg284 import m283
+import pkg8.pkg67.m66
+from . import m1200
+import pkg2.pkg19.pkg159.m575
+
+
+def helper_1617_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1617_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1617_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1617_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,38 @@
+"""Module 2868."""
+import pkg8.pkg65.m64
+from pkg6 import m5
+import pkg3.pkg28.pkg229.m228
+from pkg2.pkg21.pkg169 import m2670
+import pkg4.m3
+from pkg1.pkg13.pkg108 import m107
+import pkg3.pkg31.m30
+from pkg2.pkg19.pkg157 import m573
+import pkg6.pkg51.m50
+
+
+def helper_2868_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2868_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2868_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2868_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,12 @@
+"""Module 5370."""
+import pkg2.pkg19.m3771
+from . import m3285
+import pkg3.pkg31.pkg256.m1506
+from pkg4.pkg38.pkg307 import m306
+
+
+def helper_5370_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 5787."""
+import pkg4.pkg34.pkg275.m691
+from pkg2.pkg21.pkg172 import m5592
+import pkg1.pkg13.pkg111.m944
+from pkg1.pkg15.pkg121 import m4290
+import pkg1.pkg9.pkg79.m2997
+from pkg7.pkg57 import m1724
+import pkg1.pkg15.pkg121.m120
+from . import m3285
+import pkg1.pkg10.m9
+from pkg5.pkg41.pkg334 import m1167
+import pkg3.pkg32.pkg264.m263
+from pkg4.pkg37.pkg303 import m1553
+
+
+def helper_5787_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,47 @@
+"""Module 7455."""
+import pkg2.pkg19.pkg156.m155
+from pkg1.pkg11.pkg91 import m3009
+import pkg2.pkg20.m436
+from pkg4.pkg34.pkg274 import m6111
+import pkg5.pkg47.pkg382.m7053
+from pkg2.pkg22.pkg183 import m2267
+from . import m6204
+from pkg1 import m0
+import pkg1.pkg14.m2098
+from . import m5370
+import pkg4.pkg34.pkg279.m695
+
+
+def helper_7455_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7455_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7455_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7455_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_7455_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
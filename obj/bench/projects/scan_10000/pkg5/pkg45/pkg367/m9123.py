@@ -0,0 +1,47 @@
+"""Module 9123."""
+import pkg2.pkg22.pkg179.m7684
+from pkg5.pkg41.pkg333 import m7004
+import pkg2.pkg21.m20
+from pkg5.pkg47.pkg380 import m1213
+import pkg5.pkg45.pkg368.m7039
+from pkg3.pkg27.pkg217 import m216
+import pkg2.pkg19.pkg153.m3488
+from pkg2.pkg17.pkg140 import m4309
+from . import m6204
+from pkg4.pkg33.pkg269 import m2770
+import pkg5.pkg44.pkg357.m773
+
+
+def helper_9123_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9123_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9123_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9123_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_9123_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
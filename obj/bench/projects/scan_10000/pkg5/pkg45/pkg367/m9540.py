@@ -0,0 +1,27 @@
+"""Module 9540."""
+import pkg5.pkg47.m6718
+from pkg2.pkg23.pkg186 import m602
+import pkg1.pkg10.pkg82.m915
+from . import m8706
+import pkg6.pkg50.pkg405.m1655
+from pkg4.pkg37 import m870
+import pkg3.pkg26.pkg211.m210
+from . import m5370
+from . import m2034
+from pkg1.pkg10.pkg85 import m4671
+import pkg4.pkg37.pkg301.m6138
+from pkg3.pkg28 import m27
+
+
+def helper_9540_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9540_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 9957."""
+import pkg3.pkg27.pkg222.m1889
+from pkg3.pkg32.pkg258 import m2342
+import pkg4.pkg35.pkg288.m5291
+from . import m7872
+import pkg4.pkg34.m5454
+from . import m7455
+import pkg7.pkg64.m1731
+from pkg4.pkg35.pkg288 import m1955
+import pkg3.pkg28.m27
+from pkg1.pkg12 import m845
+
+
+def helper_9957_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,46 @@
+"""Module 3703."""
+import pkg1.m0
+from pkg5.pkg46.pkg375 import m3293
+import pkg4.pkg33.pkg272.m1522
+from . import m2035
+import pkg1.pkg11.m10
+from pkg2.pkg19.pkg155 import m154
+import pkg1.pkg9.pkg80.m79
+from . import m784
+import pkg2.pkg20.pkg161.m160
+from pkg5.pkg41.pkg331 import m330
+
+
+def helper_3703_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3703_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3703_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3703_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_3703_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
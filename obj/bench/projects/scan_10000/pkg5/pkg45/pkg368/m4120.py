@@ -0,0 +1,24 @@
+"""Module 4120."""
+import pkg2.pkg21.pkg173.m3091
+from pkg7.pkg63 import m2147
+import pkg3.pkg31.pkg253.m1086
+from pkg2.pkg18.pkg147 import m563
+import pkg6.pkg51.pkg416.m415
+from pkg3.pkg32.pkg261 import m260
+import pkg2.pkg17.pkg139.m555
+from pkg3.pkg25.pkg202 import m201
+import pkg1.pkg10.pkg86.m3004
+
+
+def helper_4120_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4120_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
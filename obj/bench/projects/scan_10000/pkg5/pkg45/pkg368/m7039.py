@@ -0,0 +1,18 @@
+"""Module 7039."""
+import pkg1.pkg9.pkg77.m76
+from pkg1.pkg12.pkg104 import m937
+import pkg4.pkg39.pkg319.m3237
+
+
+def helper_7039_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7039_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
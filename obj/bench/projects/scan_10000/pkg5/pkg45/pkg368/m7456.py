@@ -0,0 +1,31 @@
+"""Module 7456."""
+from . import m2452
+from . import m5371
+from . import m4537
+from pkg1 import m0
+import pkg2.pkg24.pkg196.m195
+from . import m5788
+import pkg3.pkg28.pkg225.m2726
+from pkg5.pkg44 import m1711
+import pkg1.pkg13.pkg109.m5946
+
+
+def helper_7456_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7456_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7456_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,31 @@
+"""Module 9124."""
+import pkg1.pkg12.m2096
+from pkg3.pkg30.pkg245 import m2329
+import pkg3.pkg32.m1282
+from pkg6.pkg49.pkg397 import m396
+from . import m2452
+from . import m6622
+import pkg7.pkg63.m62
+from pkg4.pkg35.pkg281 import m280
+from . import m7456
+
+
+def helper_9124_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9124_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9124_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
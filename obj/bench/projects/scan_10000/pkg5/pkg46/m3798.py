@@ -0,0 +1,21 @@
+"""Module 3798."""
+from . import m3381
+from pkg3.pkg28.pkg225 import m2309
+import pkg1.pkg15.pkg126.m125
+from pkg6.pkg51.pkg414 import m2915
+import pkg4.pkg34.pkg277.m276
+from . import m2547
+
+
+def helper_3798_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3798_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1 @@
+"""Module 7134."""
@@ -0,0 +1,17 @@
+"""Module 9219."""
+import pkg3.pkg31.pkg250.m249
+from pkg6.pkg52 import m2553
+from . import m4215
+from pkg3.pkg32.pkg263 import m6934
+from . import m8385
+from pkg2.pkg24.pkg195 import m4781
+import pkg3.pkg30.pkg248.m3583
+from pkg3.pkg26.pkg211 import m210
+import pkg4.pkg38.pkg305.m8227
+
+
+def helper_9219_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
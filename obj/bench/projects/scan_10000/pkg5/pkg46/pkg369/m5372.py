@@ -0,0 +1,12 @@
+"""Module 5372."""
+from . import m2870
+from . import m2036
+import pkg5.pkg42.pkg342.m2426
+from pkg2.pkg19.pkg159 import m575
+
+
+def helper_5372_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
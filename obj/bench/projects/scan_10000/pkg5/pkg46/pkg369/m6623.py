@@ -0,0 +1,29 @@
+"""Module 6623."""
+import pkg7.pkg64.m480
+from pkg2.pkg24.pkg199 import m198
+import pkg6.pkg50.pkg406.m405
+from . import m4538
+from . import m4955
+from pkg6.pkg50.pkg407 import m406
+import pkg1.pkg10.pkg84.m5087
+
+
+def helper_6623_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6623_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6623_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
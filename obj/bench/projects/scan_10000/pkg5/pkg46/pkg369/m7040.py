@@ -0,0 +1,18 @@
+"""Module 7040."""
+import pkg3.pkg29.pkg233.m232
+from . import m785
+import pkg3.m2
+from pkg1.pkg13.pkg109 import m525
+from . import m3704
+from pkg6.pkg50 import m466
+from . import m4955
+from pkg5.pkg42.pkg339 import m1172
+import pkg1.m0
+from pkg4.pkg33.pkg265 import m6936
+
+
+def helper_7040_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
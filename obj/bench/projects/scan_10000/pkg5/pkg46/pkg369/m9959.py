@@ -0,0 +1,30 @@
+"""Module 9959."""
+import pkg5.m4
+from pkg4.pkg38 import m5458
+import pkg3.pkg30.pkg243.m3161
+from pkg1.pkg14.pkg119 import m118
+import pkg1.m0
+from pkg3.pkg31.pkg256 import m1923
+import pkg4.pkg38.pkg310.m3645
+from pkg2.pkg23.pkg191 import m3526
+
+
+def helper_9959_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9959_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9959_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
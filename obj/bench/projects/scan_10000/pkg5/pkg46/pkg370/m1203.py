@@ -0,0 +1,20 @@
+"""Module 1203."""
+from . import m786
+from pkg1 import m0
+from . import m369
+from pkg3.pkg25.pkg204 import m203
+import pkg2.pkg20.pkg163.m579
+
+
+def helper_1203_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1203_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
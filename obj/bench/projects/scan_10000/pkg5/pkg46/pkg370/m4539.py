@@ -0,0 +1,46 @@
+"""Module 4539."""
+import pkg3.pkg30.pkg247.m1914
+from pkg4.pkg33.pkg272 import m4441
+import pkg1.pkg9.pkg77.m76
+from pkg6.pkg49.pkg393 import m1226
+import pkg3.pkg31.m30
+from . import m2871
+import pkg4.pkg34.pkg280.m279
+from pkg1.pkg15 import m848
+import pkg4.pkg39.pkg316.m1149
+from pkg5.pkg43.pkg349 import m348
+
+
+def helper_4539_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4539_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4539_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4539_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_4539_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,52 @@
+"""Module 4956."""
+import pkg6.pkg49.pkg397.m2898
+from pkg3.pkg27.pkg224 import m223
+import pkg5.pkg45.pkg365.m1615
+from . import m4122
+import pkg1.m0
+from pkg5.pkg42.pkg342 import m758
+import pkg5.pkg47.pkg383.m3301
+from pkg4.pkg39.pkg319 import m1152
+import pkg3.pkg26.pkg211.m4380
+
+
+def helper_4956_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4956_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4956_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4956_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_4956_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_4956_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
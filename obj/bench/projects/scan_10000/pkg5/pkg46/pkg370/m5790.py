@@ -0,0 +1,18 @@
+"""Module 5790."""
+from . import m2037
+from . import m4122
+from . import m369
+from . import m5373
+import pkg1.pkg12.m11
+from pkg2 import m1
+import pkg1.pkg11.pkg96.m4682
+from pkg4.pkg33 import m32
+import pkg2.pkg23.pkg189.m1022
+from pkg3.pkg28.pkg227 import m1894
+
+
+def helper_5790_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
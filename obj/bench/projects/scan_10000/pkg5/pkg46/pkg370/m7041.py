@@ -0,0 +1,20 @@
+"""Module 7041."""
+import pkg5.pkg42.pkg339.m2423
+from pkg5.pkg42.pkg337 import m336
+import pkg4.pkg36.pkg289.m1539
+from pkg4.pkg39.pkg315 import m1148
+import pkg3.pkg32.pkg260.m5263
+
+
+def helper_7041_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7041_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 2038."""
+import pkg5.pkg48.pkg388.m804
+from pkg3.pkg31.pkg251 import m1084
+import pkg4.pkg37.pkg301.m1134
+from pkg2.pkg22.pkg178 import m594
+import pkg3.m2
+from . import m1204
+import pkg1.pkg12.pkg103.m102
+from pkg1.pkg9 import m8
+import pkg8.pkg66.m1733
+from . import m370
+import pkg1.pkg11.pkg90.m1757
+
+
+def helper_2038_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2038_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
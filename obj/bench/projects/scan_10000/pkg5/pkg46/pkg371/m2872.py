@@ -0,0 +1,19 @@
+"""Module 2872."""
+import pkg7.m6
+from . import m2455
+from . import m787
+from pkg1.pkg15.pkg126 import m125
+import pkg4.pkg36.pkg293.m709
+from . import m1621
+import pkg5.pkg43.pkg350.m1183
+from pkg5.pkg47.pkg379 import m795
+import pkg4.pkg33.pkg266.m1099
+from . import m1204
+import pkg4.m3
+
+
+def helper_2872_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
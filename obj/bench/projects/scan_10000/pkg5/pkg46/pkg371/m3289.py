@@ -0,0 +1,34 @@
+"""Module 3289."""
+import pkg4.pkg34.pkg279.m1112
+from pkg5.pkg42.pkg337 import m336
+import pkg2.pkg18.pkg147.m2648
+from pkg2.pkg20.pkg161 import m577
+import pkg1.pkg12.pkg98.m1348
+
+
+def helper_3289_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3289_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3289_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3289_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
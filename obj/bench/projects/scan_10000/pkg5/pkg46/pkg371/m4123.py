@@ -0,0 +1,12 @@
+"""Module 4123."""
+import pkg4.pkg34.pkg274.m1524
+from pkg5.pkg46.pkg372 import m1205
+import pkg2.pkg19.pkg153.m3071
+from pkg5.pkg42.pkg341 import m2008
+import pkg5.pkg43.pkg348.m347
+from pkg2.pkg24.pkg199 import m1032
+import pkg4.pkg40.pkg321.m320
+from pkg7.pkg62 import m61
+import pkg3.pkg29.m28
+from . import m3706
+import pkg3.pkg29.pkg238.m1905
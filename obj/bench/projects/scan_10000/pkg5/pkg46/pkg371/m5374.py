@@ -0,0 +1,23 @@
+"""Module 5374."""
+import pkg4.pkg36.pkg292.m708
+from pkg8.pkg70 import m1320
+import pkg6.pkg50.m883
+from pkg3.pkg28.pkg225 import m4811
+import pkg1.m0
+from pkg2 import m835
+import pkg2.pkg22.pkg179.m178
+from pkg4.pkg39.pkg315 import m314
+
+
+def helper_5374_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5374_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,21 @@
+"""Module 5791."""
+import pkg6.pkg50.pkg404.m3739
+from pkg2.pkg17.pkg144 import m143
+from . import m1204
+from pkg2.pkg18.pkg148 import m2232
+import pkg2.pkg17.pkg141.m3059
+from pkg2.pkg21.pkg170 import m169
+
+
+def helper_5791_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5791_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,41 @@
+"""Module 6208."""
+import pkg2.pkg24.m23
+from pkg2.pkg23.pkg185 import m5188
+import pkg2.pkg20.m1270
+from pkg1.pkg13.pkg107 import m106
+import pkg6.m1673
+from pkg2.pkg21 import m437
+import pkg6.pkg49.pkg393.m5396
+from pkg2.pkg18 import m17
+import pkg2.pkg24.pkg197.m196
+from pkg1.pkg11 import m10
+import pkg6.pkg49.pkg394.m810
+from . import m2455
+
+
+def helper_6208_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6208_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6208_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6208_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
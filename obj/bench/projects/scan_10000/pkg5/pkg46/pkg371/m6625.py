@@ -0,0 +1,11 @@
+"""Module 6625."""
+import pkg3.m2
+from pkg4.pkg36.pkg292 import m3210
+import pkg5.pkg43.pkg351.m350
+
+
+def helper_6625_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
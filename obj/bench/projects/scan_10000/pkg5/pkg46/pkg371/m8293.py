@@ -0,0 +1,25 @@
+"""Module 8293."""
+from . import m6208
+from . import m4957
+from . import m5791
+from . import m2872
+from . import m4123
+from pkg5.pkg44.pkg354 import m5774
+import pkg5.pkg47.pkg384.m383
+from pkg5.pkg47.pkg384 import m1217
+from . import m787
+from pkg1.pkg16.pkg135 import m134
+
+
+def helper_8293_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8293_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
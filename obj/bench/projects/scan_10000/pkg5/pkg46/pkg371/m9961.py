@@ -0,0 +1,32 @@
+"""Module 9961."""
+import pkg5.pkg48.pkg386.m2053
+from pkg3.pkg31.pkg254 import m8593
+import pkg2.pkg24.pkg195.m194
+from pkg3.pkg28.pkg227 import m1060
+from . import m5374
+from pkg5.pkg43.pkg346 import m2430
+import pkg6.pkg51.pkg414.m4166
+from pkg5.pkg45.pkg361 import m360
+import pkg3.pkg31.m447
+from pkg7.pkg57 import m1307
+
+
+def helper_9961_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9961_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9961_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
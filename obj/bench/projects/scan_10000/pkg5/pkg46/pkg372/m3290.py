@@ -0,0 +1,61 @@
+"""Module 3290."""
+import pkg1.pkg12.pkg97.m513
+from pkg1.pkg14.pkg118 import m117
+import pkg5.pkg46.pkg370.m369
+from pkg3.pkg29.pkg233 import m649
+import pkg5.pkg45.pkg361.m2862
+from pkg7.pkg62 import m61
+import pkg3.pkg31.m30
+from pkg3.pkg27.pkg219 import m2720
+import pkg1.pkg15.pkg122.m955
+from pkg2 import m1
+import pkg2.pkg19.pkg158.m1408
+
+
+def helper_3290_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3290_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3290_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3290_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_3290_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_3290_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3290_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
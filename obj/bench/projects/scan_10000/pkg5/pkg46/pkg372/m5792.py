@@ -0,0 +1,46 @@
+"""Module 5792."""
+from . import m2456
+from pkg4.pkg33.pkg266 import m2350
+import pkg1.m0
+from pkg1.pkg9 import m8
+import pkg4.pkg36.m35
+from pkg5.pkg44 import m877
+import pkg2.pkg20.pkg162.m3914
+from pkg1.pkg12.pkg101 import m100
+import pkg1.pkg11.pkg96.m512
+from pkg1.pkg11.pkg91 import m4260
+
+
+def helper_5792_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5792_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5792_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5792_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_5792_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,10 @@
+"""Module 9545."""
+from . import m7460
+from pkg3.pkg30.pkg248 import m5251
+
+
+def helper_9545_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
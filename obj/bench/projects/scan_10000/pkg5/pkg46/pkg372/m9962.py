@@ -0,0 +1,38 @@
+"""Module 9962."""
+import pkg2.pkg22.pkg181.m1014
+from pkg1 import m0
+import pkg2.pkg23.pkg192.m9365
+from pkg1.pkg16.pkg129 import m1796
+import pkg1.pkg9.pkg74.m9247
+from pkg4.pkg38.pkg310 import m2811
+from . import m2039
+from pkg5.pkg47.pkg381 import m7886
+from . import m4541
+
+
+def helper_9962_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9962_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9962_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9962_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
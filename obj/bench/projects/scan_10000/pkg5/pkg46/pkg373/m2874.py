@@ -0,0 +1,44 @@
+"""Module 2874."""
+import pkg7.pkg63.m2147
+from pkg2.pkg18.pkg152 import m1402
+import pkg2.pkg19.pkg155.m1822
+from pkg1 import m0
+import pkg1.pkg12.pkg99.m2183
+from pkg5.pkg41.pkg336 import m335
+import pkg2.m1
+from pkg5.pkg42.pkg338 import m2005
+
+
+def helper_2874_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2874_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2874_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2874_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_2874_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,21 @@
+"""Module 8295."""
+from . import m6210
+from pkg3 import m2
+import pkg4.pkg34.pkg274.m1107
+from . import m7878
+import pkg1.pkg13.pkg108.m2609
+from pkg4.pkg33.pkg271 import m1938
+
+
+def helper_8295_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8295_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
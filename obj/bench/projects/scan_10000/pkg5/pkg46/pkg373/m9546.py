@@ -0,0 +1,46 @@
+"""Module 9546."""
+import pkg1.pkg12.pkg103.m102
+from pkg7.pkg64 import m63
+import pkg1.pkg12.m11
+from . import m5376
+import pkg1.pkg15.pkg124.m8046
+from pkg4 import m3
+import pkg5.pkg43.pkg351.m1601
+from pkg3.pkg30.pkg242 import m5245
+from . import m6210
+from pkg4.pkg38.pkg310 import m3645
+
+
+def helper_9546_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9546_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9546_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9546_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_9546_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,5 @@
+"""Module 1624."""
+import pkg5.pkg41.m40
+from pkg6 import m5
+from . import m790
+from pkg4.pkg37.pkg302 import m301
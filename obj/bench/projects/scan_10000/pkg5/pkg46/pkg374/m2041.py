@@ -0,0 +1,32 @@
+"""Module 2041."""
+from . import m373
+from pkg1.pkg14.pkg115 import m114
+import pkg2.pkg19.pkg153.m152
+from pkg5.pkg48.pkg389 import m805
+import pkg3.pkg25.pkg203.m202
+from pkg1.pkg16.pkg132 import m548
+import pkg3.pkg26.pkg209.m208
+from pkg1.pkg15 import m848
+from . import m1207
+from pkg3.pkg29.pkg238 import m237
+
+
+def helper_2041_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2041_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2041_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
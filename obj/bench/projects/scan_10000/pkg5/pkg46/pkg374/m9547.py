@@ -0,0 +1,52 @@
+"""Module 9547."""
+import pkg1.pkg9.m8348
+from pkg6.pkg51.pkg413 import m7084
+import pkg3.pkg27.pkg224.m8146
+from pkg3.pkg26 import m25
+import pkg1.pkg14.m2098
+from pkg4.pkg35.pkg281 import m5284
+import pkg2.pkg19.pkg153.m5990
+from pkg4.pkg33.pkg267 import m9440
+import pkg3.pkg31.pkg255.m1922
+
+
+def helper_9547_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9547_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9547_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9547_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_9547_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_9547_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,34 @@
+"""Module 9964."""
+from . import m2458
+from . import m373
+import pkg5.pkg42.pkg342.m758
+from . import m790
+import pkg1.pkg14.pkg118.m534
+from . import m8713
+import pkg2.pkg17.pkg144.m143
+from pkg2.pkg24.pkg197 import m196
+import pkg2.pkg22.pkg177.m5180
+from pkg3.pkg27.pkg222 import m638
+import pkg4.pkg35.pkg288.m4874
+from . import m1207
+
+
+def helper_9964_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9964_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9964_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,30 @@
+"""Module 2042."""
+import pkg3.pkg27.pkg217.m1467
+from pkg2.pkg24 import m857
+import pkg3.pkg32.pkg263.m1513
+from pkg4.pkg38 import m37
+import pkg1.pkg11.pkg90.m923
+from . import m1208
+import pkg4.pkg39.m38
+from pkg4.pkg33.pkg268 import m267
+
+
+def helper_2042_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2042_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2042_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,45 @@
+"""Module 4544."""
+import pkg5.pkg41.pkg330.m2414
+from . import m791
+import pkg1.pkg12.pkg104.m3022
+from pkg1.pkg12.pkg99 import m1349
+import pkg1.m0
+from pkg1.pkg11.pkg95 import m94
+import pkg5.pkg46.pkg372.m3290
+from pkg4 import m3
+from . import m2042
+
+
+def helper_4544_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4544_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4544_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4544_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_4544_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,38 @@
+"""Module 1209."""
+import pkg4.pkg35.m34
+from pkg3.pkg26.pkg216 import m1049
+import pkg6.pkg55.m54
+from pkg5.pkg46.pkg374 import m373
+import pkg1.pkg12.pkg99.m98
+from pkg2.pkg18 import m17
+from . import m792
+from pkg5.pkg43.pkg351 import m1184
+import pkg1.pkg14.m13
+
+
+def helper_1209_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1209_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1209_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1209_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 4128."""
+import pkg3.pkg25.pkg203.m202
+from pkg3.pkg25.pkg208 import m207
+import pkg5.pkg43.pkg350.m4102
+from pkg1.pkg10.pkg82 import m81
+
+
+def helper_4128_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4128_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4128_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
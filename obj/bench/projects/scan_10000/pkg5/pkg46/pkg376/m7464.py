@@ -0,0 +1,6 @@
+"""Module 7464."""
+import pkg6.pkg55.m54
+from . import m1209
+import pkg2.pkg22.m21
+from pkg1 import m0
+import pkg1.pkg9.m8
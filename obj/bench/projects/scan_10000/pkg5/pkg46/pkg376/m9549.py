@@ -0,0 +1,25 @@
+"""Module 9549."""
+import pkg1.pkg9.pkg74.m1324
+from pkg5.pkg47.pkg384 import m800
+import pkg5.pkg42.pkg344.m1594
+from pkg2.pkg19.pkg158 import m157
+import pkg3.pkg30.m29
+from pkg5.pkg41.pkg330 import m6584
+from . import m7881
+from pkg6.pkg51.pkg412 import m3330
+import pkg1.pkg12.pkg97.m1347
+from pkg3.pkg27 import m2945
+
+
+def helper_9549_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9549_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,37 @@
+"""Module 2131."""
+import pkg5.pkg42.m41
+from pkg3 import m2
+import pkg2.pkg22.pkg179.m595
+from pkg1.pkg11.pkg89 import m922
+import pkg3.pkg27.pkg219.m1469
+from pkg1 import m0
+import pkg7.pkg57.m473
+from pkg4.pkg37.pkg297 import m296
+
+
+def helper_2131_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2131_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2131_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2131_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,37 @@
+"""Module 463."""
+from . import m46
+from pkg1 import m0
+import pkg1.pkg13.pkg105.m104
+from pkg1.pkg13 import m12
+import pkg1.pkg10.m9
+from pkg3 import m2
+import pkg1.pkg16.pkg132.m131
+from pkg2.pkg19.pkg157 import m156
+
+
+def helper_463_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_463_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_463_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_463_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 4633."""
+import pkg2.pkg24.pkg193.m192
+from pkg3.pkg28.pkg232 import m231
+import pkg3.pkg26.pkg209.m1459
+from pkg2.pkg17.pkg137 import m136
+import pkg1.pkg9.pkg78.m77
+from . import m1297
+import pkg5.pkg41.pkg329.m1162
+from pkg3.pkg28.pkg232 import m1065
+import pkg1.m0
+from pkg1.pkg9.pkg74 import m73
+
+
+def helper_4633_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4633_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
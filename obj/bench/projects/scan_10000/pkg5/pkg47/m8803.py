@@ -0,0 +1,11 @@
+"""Module 8803."""
+from . import m46
+from pkg2.pkg19.pkg158 import m574
+import pkg2.pkg18.pkg148.m564
+
+
+def helper_8803_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,35 @@
+"""Module 376."""
+import pkg4.pkg36.pkg292.m291
+from pkg4.pkg38 import m37
+import pkg4.pkg39.pkg314.m313
+from pkg3.pkg32 import m31
+import pkg1.pkg10.pkg83.m82
+from pkg4.pkg33.pkg266 import m265
+
+
+def helper_376_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_376_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_376_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_376_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
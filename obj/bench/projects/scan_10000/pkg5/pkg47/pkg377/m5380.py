@@ -0,0 +1,25 @@
+"""Module 5380."""
+from . import m4129
+from . import m376
+import pkg1.m0
+from pkg2.pkg24.pkg194 import m193
+import pkg2.pkg18.m17
+from pkg2.pkg21.pkg175 import m174
+import pkg3.pkg28.pkg226.m225
+from pkg6.pkg49.pkg394 import m3312
+import pkg5.pkg45.pkg361.m777
+from pkg2.pkg19.pkg159 import m992
+
+
+def helper_5380_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5380_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 5797."""
+import pkg8.pkg69.m68
+from pkg3.pkg27.pkg219 import m1469
+import pkg2.pkg20.pkg162.m5165
+from pkg4.pkg37.pkg297 import m2381
+import pkg1.pkg15.m14
+from . import m4963
+import pkg4.pkg37.m453
+from pkg2.pkg19.pkg154 import m2238
+import pkg4.pkg34.pkg274.m5277
+from pkg2.pkg24 import m23
+
+
+def helper_5797_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
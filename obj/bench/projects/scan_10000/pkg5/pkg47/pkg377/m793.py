@@ -0,0 +1,36 @@
+"""Module 793."""
+import pkg2.m1
+from . import m376
+import pkg1.pkg14.m13
+from pkg6.pkg50 import m49
+import pkg6.pkg49.m465
+from pkg3.pkg32 import m31
+import pkg1.pkg13.pkg110.m526
+
+
+def helper_793_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_793_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_793_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_793_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,22 @@
+"""Module 9133."""
+import pkg2.pkg19.pkg157.m7662
+from pkg2.pkg23.pkg187 import m186
+import pkg3.pkg25.pkg204.m620
+from pkg4.pkg38.pkg305 import m721
+from . import m376
+from pkg5.pkg43.pkg352 import m1185
+from . import m793
+
+
+def helper_9133_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9133_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
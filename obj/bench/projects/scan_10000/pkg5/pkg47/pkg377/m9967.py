@@ -0,0 +1,48 @@
+"""Module 9967."""
+import pkg3.pkg25.pkg206.m622
+from pkg3.pkg30.pkg244 import m8166
+from . import m8716
+from pkg1 import m0
+import pkg2.pkg21.pkg170.m169
+from pkg3.pkg32.pkg260 import m1510
+import pkg1.pkg11.pkg94.m8850
+from pkg2.pkg22.pkg180 import m1847
+import pkg7.pkg62.m1312
+from pkg6.pkg51 import m4220
+import pkg2.pkg23.pkg191.m607
+from pkg3.pkg30.pkg248 import m4417
+
+
+def helper_9967_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9967_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9967_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9967_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_9967_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
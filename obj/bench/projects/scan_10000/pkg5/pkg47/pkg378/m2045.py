@@ -0,0 +1,16 @@
+"""Module 2045."""
+from . import m1628
+from pkg7.pkg63 import m62
+import pkg1.pkg9.pkg80.m79
+from pkg4.pkg33.pkg269 import m268
+import pkg4.pkg39.pkg320.m319
+from pkg4.pkg33.pkg265 import m264
+import pkg1.m0
+from pkg1.pkg12 import m11
+
+
+def helper_2045_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
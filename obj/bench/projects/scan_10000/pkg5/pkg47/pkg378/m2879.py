@@ -0,0 +1,13 @@
+"""Module 2879."""
+from . import m1211
+from pkg4.pkg40.pkg328 import m744
+import pkg2.pkg19.m18
+from pkg1.pkg12.pkg103 import m102
+import pkg4.pkg38.m37
+from pkg1.pkg11.pkg91 import m90
+from . import m2462
+from . import m2045
+import pkg4.pkg37.pkg304.m2805
+from pkg1.pkg11 import m10
+import pkg1.m2085
+from pkg3.pkg28.pkg230 import m2731
@@ -0,0 +1,30 @@
+"""Module 3713."""
+import pkg2.pkg18.m851
+from pkg5.pkg47.pkg380 import m1213
+from . import m1211
+from pkg5.pkg42.pkg341 import m340
+import pkg5.pkg47.pkg383.m3301
+from . import m1628
+import pkg4.pkg33.pkg269.m3604
+from pkg6.pkg50.pkg408 import m824
+
+
+def helper_3713_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3713_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3713_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 5381."""
+import pkg5.pkg46.pkg373.m4125
+from pkg4.pkg37.pkg304 import m4473
+import pkg2.pkg17.pkg142.m975
+
+
+def helper_5381_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5381_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,28 @@
+"""Module 6215."""
+from . import m3296
+from pkg4.pkg33.pkg266 import m1516
+import pkg3.pkg26.pkg209.m208
+from . import m4130
+import pkg3.pkg32.pkg257.m3592
+from pkg2.pkg23.pkg188 import m187
+
+
+def helper_6215_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6215_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6215_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,29 @@
+"""Module 9134."""
+from . import m377
+from pkg4 import m3
+import pkg4.pkg36.m35
+from pkg2.pkg24.pkg197 import m196
+import pkg2.pkg19.pkg155.m8911
+from pkg4.pkg39 import m7544
+import pkg2.pkg24.pkg200.m2284
+
+
+def helper_9134_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9134_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9134_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,46 @@
+"""Module 9968."""
+import pkg5.pkg43.pkg349.m765
+from pkg1.pkg9.pkg80 import m7168
+import pkg2.pkg17.pkg142.m1392
+from pkg1.pkg9.pkg76 import m2160
+import pkg4.pkg37.pkg301.m3219
+from pkg7.pkg60 import m4646
+import pkg3.pkg26.pkg213.m4382
+from pkg5.pkg46.pkg372 import m3290
+import pkg3.pkg25.m441
+from . import m1628
+
+
+def helper_9968_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9968_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9968_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9968_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_9968_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,24 @@
+"""Module 2463."""
+import pkg5.pkg43.pkg347.m2431
+from . import m1212
+import pkg4.m3
+from pkg3 import m2
+import pkg8.pkg67.m66
+from pkg5.pkg47.pkg383 import m382
+import pkg6.pkg49.pkg399.m398
+from . import m795
+import pkg1.m0
+
+
+def helper_2463_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2463_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
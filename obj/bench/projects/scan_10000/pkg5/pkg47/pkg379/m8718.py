@@ -0,0 +1,30 @@
+"""Module 8718."""
+import pkg2.pkg18.pkg152.m3070
+from . import m1629
+import pkg6.pkg51.pkg413.m829
+from . import m378
+import pkg3.pkg26.m25
+from pkg2.pkg17.pkg144 import m143
+import pkg3.pkg28.pkg231.m230
+from pkg3 import m2
+
+
+def helper_8718_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8718_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8718_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,23 @@
+"""Module 7468."""
+import pkg2.m1
+from pkg5 import m4
+import pkg1.pkg13.pkg109.m108
+from pkg1.pkg9.pkg73 import m72
+import pkg4.pkg39.pkg318.m5321
+from pkg3.pkg26.pkg209 import m208
+import pkg4.pkg38.pkg308.m307
+from pkg1.pkg16.pkg136 import m135
+
+
+def helper_7468_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7468_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,54 @@
+"""Module 796."""
+import pkg2.pkg24.pkg199.m615
+from pkg5.pkg46.pkg370 import m786
+import pkg2.pkg19.pkg156.m155
+from pkg1.pkg10 import m9
+import pkg5.pkg47.m46
+from pkg1 import m0
+import pkg6.pkg52.m51
+from pkg2 import m1
+import pkg1.pkg16.pkg132.m548
+from pkg1.pkg10.pkg81 import m497
+import pkg2.pkg19.m18
+
+
+def helper_796_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_796_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_796_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_796_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_796_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_796_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,6 @@
+"""Module 1631."""
+import pkg1.pkg14.m430
+from pkg5.pkg44.pkg360 import m1193
+import pkg4.pkg38.pkg306.m305
+from pkg1.pkg10.pkg82 import m498
+import pkg4.pkg35.pkg286.m702
@@ -0,0 +1,46 @@
+"""Module 3299."""
+import pkg6.pkg49.m48
+from pkg1.pkg15.pkg121 import m120
+import pkg6.pkg51.pkg415.m1665
+from pkg5.pkg42.pkg343 import m759
+import pkg6.pkg51.m50
+from pkg1.pkg12.pkg104 import m937
+import pkg4.pkg34.pkg280.m279
+from pkg4.pkg36.pkg292 import m3210
+from . import m797
+from pkg2.pkg18.pkg149 import m982
+
+
+def helper_3299_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3299_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3299_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3299_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_3299_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 4967."""
+import pkg2.pkg21.pkg170.m4756
+from pkg4.pkg36.pkg291 import m290
+import pkg3.pkg28.pkg226.m642
+from . import m797
+
+
+def helper_4967_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4967_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4967_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,43 @@
+"""Module 5801."""
+import pkg5.pkg42.pkg343.m4512
+from pkg3.pkg28.pkg232 import m5235
+import pkg1.m0
+from pkg2.pkg19.pkg158 import m157
+from . import m2882
+from pkg5.pkg41.pkg333 import m2417
+import pkg5.pkg41.pkg331.m1164
+
+
+def helper_5801_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5801_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5801_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5801_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_5801_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
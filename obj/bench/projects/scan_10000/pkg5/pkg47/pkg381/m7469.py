@@ -0,0 +1,33 @@
+"""Module 7469."""
+import pkg2.m1
+from pkg4.pkg40.pkg324 import m1574
+from . import m7052
+from pkg1.pkg13.pkg111 import m6782
+import pkg1.m0
+from pkg1.pkg10.pkg86 import m6340
+import pkg2.pkg24.m23
+from pkg5.pkg41.pkg330 import m329
+import pkg4.pkg35.pkg286.m7374
+from pkg2.pkg24.pkg195 import m1445
+import pkg4.pkg33.pkg271.m3189
+
+
+def helper_7469_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7469_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7469_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,21 @@
+"""Module 9137."""
+import pkg2.pkg23.m22
+from pkg6.pkg50.pkg407 import m2491
+import pkg4.pkg39.pkg319.m1986
+from pkg3.pkg28.pkg231 import m5234
+import pkg4.pkg33.pkg266.m265
+from pkg2.pkg24.pkg197 import m1864
+
+
+def helper_9137_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9137_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
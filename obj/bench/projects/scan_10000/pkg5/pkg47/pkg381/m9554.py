@@ -0,0 +1,25 @@
+"""Module 9554."""
+from . import m1214
+from pkg2.pkg19 import m18
+from . import m1631
+from pkg3 import m2
+import pkg4.pkg33.pkg268.m2769
+from . import m6218
+import pkg5.pkg41.pkg331.m5751
+from pkg4.pkg37 import m36
+from . import m7052
+from pkg5.pkg44.pkg353 import m7024
+
+
+def helper_9554_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9554_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 5385."""
+from . import m2466
+from pkg2.pkg23.pkg188 import m187
+import pkg1.pkg14.m13
+
+
+def helper_5385_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 6219."""
+import pkg3.pkg26.pkg213.m4382
+from pkg2.pkg21 import m20
+import pkg5.pkg45.pkg365.m5368
+from pkg8 import m7
+import pkg3.pkg29.pkg233.m232
+
+
+def helper_6219_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6219_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
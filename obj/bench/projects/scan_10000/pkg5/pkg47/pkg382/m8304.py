@@ -0,0 +1,18 @@
+"""Module 8304."""
+import pkg3.pkg28.pkg227.m1477
+from pkg8.pkg69 import m3821
+import pkg6.pkg50.pkg406.m1239
+
+
+def helper_8304_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8304_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
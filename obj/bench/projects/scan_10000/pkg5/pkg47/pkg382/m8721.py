@@ -0,0 +1,30 @@
+"""Module 8721."""
+import pkg2.pkg17.pkg142.m558
+from pkg4.pkg36.pkg294 import m293
+import pkg3.pkg29.pkg240.m239
+from . import m3717
+from . import m4134
+from pkg8.pkg68 import m1735
+import pkg3.pkg25.pkg207.m206
+from pkg2.pkg19.pkg156 import m155
+
+
+def helper_8721_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8721_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8721_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,3 @@
+"""Module 2884."""
+import pkg6.pkg56.m55
+from . import m382
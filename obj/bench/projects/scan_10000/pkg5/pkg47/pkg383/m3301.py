@@ -0,0 +1,52 @@
+"""Module 3301."""
+import pkg3.pkg25.pkg201.m1451
+from pkg3.pkg31.pkg255 import m1505
+import pkg5.pkg48.pkg392.m391
+from pkg2.pkg23.pkg191 import m190
+import pkg4.pkg37.m36
+from pkg1.pkg12.pkg100 import m1350
+import pkg2.pkg19.m18
+from pkg3.pkg26.pkg214 import m213
+import pkg2.pkg20.m19
+
+
+def helper_3301_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3301_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3301_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3301_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_3301_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_3301_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
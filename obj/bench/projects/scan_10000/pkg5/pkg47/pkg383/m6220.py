@@ -0,0 +1,26 @@
+"""Module 6220."""
+import pkg3.pkg31.pkg253.m5256
+from pkg1.pkg11.pkg95 import m2179
+import pkg3.pkg27.pkg219.m218
+from pkg2.pkg17 import m16
+import pkg7.pkg58.m1308
+from . import m799
+import pkg8.pkg70.m69
+from pkg4.pkg40 import m39
+import pkg1.pkg15.pkg128.m544
+from pkg4.pkg33.pkg270 import m4439
+import pkg2.pkg18.pkg146.m562
+
+
+def helper_6220_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6220_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,15 @@
+"""Module 6637."""
+import pkg2.pkg23.pkg187.m603
+from . import m6220
+import pkg1.pkg9.pkg78.m77
+from pkg3.pkg27.pkg224 import m2308
+import pkg6.pkg49.pkg397.m396
+from pkg1.pkg15.pkg126 import m5129
+import pkg1.pkg9.pkg78.m4247
+
+
+def helper_6637_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,14 @@
+"""Module 3302."""
+import pkg3.pkg27.pkg218.m634
+from . import m2468
+import pkg1.m0
+from pkg4.pkg37 import m36
+import pkg5.pkg46.pkg375.m1625
+from pkg1.pkg14.pkg114 import m947
+
+
+def helper_3302_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
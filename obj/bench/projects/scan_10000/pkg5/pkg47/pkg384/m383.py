@@ -0,0 +1,37 @@
+"""Module 383."""
+import pkg1.pkg16.pkg129.m128
+from pkg1 import m0
+import pkg2.m1
+from pkg5 import m4
+import pkg3.pkg31.m30
+from pkg1.pkg10.pkg81 import m80
+import pkg2.pkg22.m21
+from pkg1.pkg9.pkg75 import m74
+
+
+def helper_383_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_383_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_383_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_383_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,15 @@
+"""Module 5387."""
+import pkg2.pkg22.pkg182.m1432
+from pkg5.pkg41.pkg332 import m1165
+from . import m2051
+from pkg2.pkg20 import m436
+import pkg1.pkg9.m8
+from pkg6.pkg51.pkg410 import m3328
+import pkg5.pkg43.pkg350.m1600
+
+
+def helper_5387_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
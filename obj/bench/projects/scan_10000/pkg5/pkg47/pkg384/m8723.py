@@ -0,0 +1,36 @@
+"""Module 8723."""
+import pkg3.pkg25.pkg206.m7711
+from pkg1.pkg16.pkg131 import m130
+import pkg1.pkg12.pkg98.m2182
+from pkg6.pkg49 import m48
+import pkg1.pkg15.pkg123.m122
+from pkg1.pkg16 import m15
+import pkg4.pkg38.pkg308.m3643
+
+
+def helper_8723_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8723_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8723_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8723_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,45 @@
+"""Module 9557."""
+import pkg4.pkg38.pkg309.m5312
+from . import m383
+import pkg3.pkg32.pkg257.m256
+from pkg3.pkg32 import m448
+import pkg6.pkg49.m48
+from pkg1.pkg11.pkg90 import m6761
+import pkg3.pkg32.m2950
+from pkg1.pkg16.pkg136 import m6807
+import pkg2.pkg20.pkg166.m4752
+
+
+def helper_9557_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9557_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9557_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9557_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_9557_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
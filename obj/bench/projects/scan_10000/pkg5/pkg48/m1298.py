@@ -0,0 +1,17 @@
+"""Module 1298."""
+import pkg2.pkg18.m434
+from pkg3.pkg30.pkg242 import m241
+from . import m464
+from . import m881
+import pkg6.pkg51.pkg411.m410
+from pkg7.pkg63 import m62
+import pkg2.pkg21.pkg171.m170
+from pkg8.pkg69 import m485
+import pkg2.pkg20.m19
+
+
+def helper_1298_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 3800."""
+import pkg4.pkg34.pkg275.m274
+from pkg8 import m7
+import pkg3.pkg28.pkg229.m3147
+from . import m47
+
+
+def helper_3800_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3800_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
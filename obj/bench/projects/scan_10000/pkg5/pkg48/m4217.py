@@ -0,0 +1,18 @@
+"""Module 4217."""
+import pkg6.pkg51.pkg412.m828
+from pkg1.pkg14.pkg113 import m112
+from . import m3383
+from pkg1 import m0
+import pkg1.pkg13.pkg108.m3443
+from . import m2966
+from . import m2132
+from pkg3.pkg30.pkg241 import m3159
+import pkg8.pkg68.m1318
+from pkg3.pkg30.pkg246 import m1913
+
+
+def helper_4217_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
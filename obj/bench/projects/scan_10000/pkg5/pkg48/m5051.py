@@ -0,0 +1,44 @@
+"""Module 5051."""
+from . import m1298
+from pkg4.pkg39.pkg316 import m315
+import pkg3.pkg32.pkg261.m677
+from pkg2.pkg21 import m20
+import pkg5.pkg42.pkg337.m753
+from pkg1.pkg15.pkg128 import m4714
+from . import m3800
+from pkg4.pkg34.pkg278 import m1528
+
+
+def helper_5051_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5051_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5051_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5051_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_5051_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,12 @@
+"""Module 5885."""
+import pkg6.m5
+from pkg5.pkg43.pkg345 import m344
+import pkg4.pkg34.pkg277.m5697
+from pkg6.pkg52.pkg417 import m2501
+
+
+def helper_5885_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 7553."""
+import pkg5.m4
+from pkg6.pkg49.pkg399 import m1232
+import pkg1.pkg16.pkg133.m549
+from . import m4217
+from . import m7136
+from pkg2.pkg24 import m23
+import pkg1.pkg15.m5852
+from pkg5.pkg44.pkg358 import m2442
+import pkg4.pkg35.pkg281.m697
+from pkg1.pkg9.pkg79 import m78
+
+
+def helper_7553_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
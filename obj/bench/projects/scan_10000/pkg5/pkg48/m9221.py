@@ -0,0 +1,18 @@
+"""Module 9221."""
+from . import m5885
+from . import m4634
+import pkg6.m5009
+from . import m2132
+import pkg2.pkg17.pkg142.m558
+from pkg1.pkg10 import m843
+import pkg6.pkg51.m2552
+from pkg1 import m0
+import pkg5.pkg46.m462
+from pkg3.pkg27.pkg219 import m4805
+
+
+def helper_9221_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
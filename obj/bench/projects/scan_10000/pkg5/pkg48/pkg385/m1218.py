@@ -0,0 +1,14 @@
+"""Module 1218."""
+import pkg3.m2
+from pkg1 import m0
+from . import m384
+from pkg7.pkg63 import m896
+import pkg2.pkg22.pkg181.m180
+from pkg1.pkg10 import m9
+
+
+def helper_1218_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
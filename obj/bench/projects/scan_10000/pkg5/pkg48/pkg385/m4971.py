@@ -0,0 +1,22 @@
+"""Module 4971."""
+from . import m3303
+from pkg5.pkg43.pkg349 import m4101
+import pkg5.m4
+from pkg2.pkg19.pkg155 import m571
+import pkg7.m6
+from pkg4.pkg36.pkg293 import m2794
+import pkg3.pkg26.pkg214.m213
+
+
+def helper_4971_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4971_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,44 @@
+"""Module 7056."""
+from . import m5805
+from pkg5.pkg45.pkg368 import m5788
+from . import m2052
+from pkg1.pkg12 import m11
+import pkg4.pkg36.pkg291.m290
+from pkg1.pkg11.pkg93 import m2177
+import pkg8.m7
+from pkg2.pkg18.pkg147 import m146
+
+
+def helper_7056_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7056_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7056_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7056_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_7056_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,14 @@
+"""Module 7473."""
+import pkg1.m0
+from pkg3.pkg29.pkg234 import m1067
+import pkg1.pkg11.pkg95.m3847
+from pkg4.pkg36.pkg294 import m710
+from . import m1218
+from pkg1.pkg12.pkg101 import m2185
+
+
+def helper_7473_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,45 @@
+"""Module 1219."""
+import pkg2.pkg21.pkg175.m591
+from pkg8.pkg70 import m69
+import pkg1.m0
+from pkg1.pkg11.pkg95 import m511
+from . import m385
+from pkg3.pkg27 import m26
+import pkg4.pkg38.pkg308.m724
+from pkg3.pkg30.pkg248 import m247
+import pkg1.pkg12.m11
+
+
+def helper_1219_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1219_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1219_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1219_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_1219_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
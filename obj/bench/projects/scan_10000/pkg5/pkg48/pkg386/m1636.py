@@ -0,0 +1,38 @@
+"""Module 1636."""
+import pkg2.m1
+from pkg5.pkg47 import m46
+import pkg5.pkg42.pkg341.m340
+from . import m802
+import pkg6.pkg50.pkg405.m1238
+from pkg2.pkg23.pkg192 import m191
+import pkg3.pkg26.pkg211.m1461
+from pkg1.pkg11.pkg96 import m95
+import pkg3.pkg29.pkg233.m232
+
+
+def helper_1636_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1636_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1636_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1636_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
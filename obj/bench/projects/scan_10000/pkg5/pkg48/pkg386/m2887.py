@@ -0,0 +1,20 @@
+"""Module 2887."""
+import pkg2.pkg19.m18
+from pkg6.pkg50.pkg402 import m401
+import pkg4.pkg35.pkg282.m698
+from pkg2.pkg17 import m16
+import pkg7.pkg63.m62
+from pkg7.pkg58 import m57
+from . import m2470
+from pkg8.pkg69 import m68
+import pkg3.pkg29.m2530
+from pkg2.pkg18 import m17
+import pkg1.pkg12.pkg98.m514
+from pkg3.pkg26 import m25
+
+
+def helper_2887_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,54 @@
+"""Module 3721."""
+from . import m3304
+from pkg3.pkg26 import m859
+import pkg1.pkg13.pkg106.m105
+from pkg4.pkg37.pkg299 import m715
+import pkg3.pkg32.pkg257.m256
+from pkg6 import m5
+import pkg3.pkg29.pkg234.m1067
+from pkg3 import m2
+import pkg1.pkg14.pkg116.m115
+from . import m802
+from . import m1636
+
+
+def helper_3721_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3721_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3721_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3721_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_3721_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_3721_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
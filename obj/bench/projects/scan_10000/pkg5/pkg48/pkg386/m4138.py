@@ -0,0 +1,24 @@
+"""Module 4138."""
+from . import m2887
+from pkg3.pkg27.pkg217 import m216
+import pkg5.pkg46.pkg370.m369
+from pkg3.pkg26.pkg214 import m3966
+import pkg6.m5
+from . import m3721
+import pkg1.pkg10.pkg85.m501
+from pkg1 import m0
+import pkg5.pkg42.pkg342.m341
+
+
+def helper_4138_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4138_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
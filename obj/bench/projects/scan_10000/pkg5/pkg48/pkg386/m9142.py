@@ -0,0 +1,25 @@
+"""Module 9142."""
+import pkg4.pkg39.pkg316.m732
+from pkg5.pkg43 import m42
+from . import m5806
+from pkg8.pkg69 import m7574
+import pkg3.pkg31.pkg255.m4007
+from pkg3.pkg31.pkg252 import m1085
+import pkg2.pkg18.pkg146.m145
+from pkg1.pkg11 import m10
+from . import m802
+from pkg5.pkg42.pkg344 import m2845
+
+
+def helper_9142_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9142_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,22 @@
+"""Module 1220."""
+import pkg3.pkg31.m30
+from . import m386
+import pkg2.pkg22.pkg178.m177
+from pkg2.pkg20 import m19
+import pkg7.pkg63.m62
+from pkg1 import m0
+import pkg1.pkg13.pkg106.m105
+
+
+def helper_1220_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1220_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
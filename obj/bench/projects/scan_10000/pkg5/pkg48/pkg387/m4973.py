@@ -0,0 +1,21 @@
+"""Module 4973."""
+import pkg2.pkg23.pkg185.m3937
+from pkg2.pkg24 import m23
+import pkg8.pkg72.m2573
+from pkg3.pkg31.pkg250 import m249
+import pkg5.pkg46.pkg376.m3711
+from pkg7.pkg62 import m895
+
+
+def helper_4973_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4973_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
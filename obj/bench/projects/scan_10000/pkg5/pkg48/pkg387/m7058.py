@@ -0,0 +1,9 @@
+"""Module 7058."""
+import pkg3.pkg31.pkg255.m254
+
+
+def helper_7058_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
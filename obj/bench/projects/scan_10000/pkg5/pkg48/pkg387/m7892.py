@@ -0,0 +1,20 @@
+"""Module 7892."""
+import pkg2.pkg18.pkg150.m2234
+from pkg1.pkg15.pkg128 import m2629
+from . import m1637
+from pkg1.pkg13.pkg109 import m5946
+from . import m4973
+
+
+def helper_7892_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7892_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,14 @@
+"""Module 8726."""
+import pkg1.m0
+from pkg1.pkg14.pkg120 import m2621
+import pkg4.pkg34.pkg278.m277
+from . import m7475
+import pkg2.pkg19.pkg157.m156
+from pkg3.pkg30.pkg248 import m4834
+
+
+def helper_8726_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
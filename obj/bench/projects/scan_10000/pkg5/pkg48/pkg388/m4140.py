@@ -0,0 +1,35 @@
+"""Module 4140."""
+import pkg7.pkg58.m1725
+from pkg4.pkg37.pkg303 import m719
+import pkg1.m0
+from pkg3.pkg29.pkg239 import m2323
+import pkg2.pkg20.m19
+from pkg1.pkg10.pkg85 import m3420
+
+
+def helper_4140_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4140_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4140_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4140_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
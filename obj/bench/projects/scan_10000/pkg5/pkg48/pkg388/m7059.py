@@ -0,0 +1,21 @@
+"""Module 7059."""
+import pkg3.m1670
+from pkg1.pkg13.pkg106 import m105
+from . import m6225
+from pkg1.pkg12.pkg99 import m98
+from . import m1638
+from pkg5.pkg48.pkg390 import m6227
+
+
+def helper_7059_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7059_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,37 @@
+"""Module 9561."""
+from . import m6225
+from pkg2.pkg22.pkg178 import m177
+import pkg5.pkg46.pkg375.m4127
+from . import m4140
+import pkg6.pkg50.pkg408.m407
+from pkg6.pkg51.pkg410 import m409
+import pkg7.pkg59.m892
+from pkg1.pkg10.pkg85 import m3837
+
+
+def helper_9561_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9561_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9561_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9561_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
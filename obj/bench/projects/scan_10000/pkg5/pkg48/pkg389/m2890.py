@@ -0,0 +1,54 @@
+"""Module 2890."""
+import pkg1.pkg14.m2515
+from pkg2.pkg22.pkg179 import m178
+import pkg4.pkg36.pkg292.m708
+from pkg5.pkg48.pkg387 import m386
+import pkg6.pkg50.m49
+from pkg5.pkg48 import m464
+import pkg2.pkg24.pkg194.m1861
+from pkg2.pkg24.pkg199 import m1449
+import pkg2.pkg22.m855
+from pkg7.pkg60 import m476
+from . import m2056
+
+
+def helper_2890_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2890_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2890_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2890_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_2890_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_2890_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
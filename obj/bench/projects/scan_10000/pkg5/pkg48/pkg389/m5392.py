@@ -0,0 +1,35 @@
+"""Module 5392."""
+import pkg2.pkg21.m20
+from pkg4.pkg35.pkg284 import m700
+from . import m1222
+from pkg2.pkg22.pkg179 import m1846
+import pkg2.pkg24.m3776
+from pkg6.pkg50.pkg405 import m3323
+
+
+def helper_5392_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5392_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5392_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5392_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
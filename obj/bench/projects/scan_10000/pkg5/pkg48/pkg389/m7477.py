@@ -0,0 +1,38 @@
+"""Module 7477."""
+import pkg1.pkg16.m15
+from pkg2.pkg18.pkg150 import m3068
+import pkg5.pkg43.pkg349.m348
+from pkg4.pkg33.pkg269 import m685
+import pkg1.pkg9.pkg76.m2160
+from . import m3307
+import pkg4.pkg33.pkg272.m1522
+from pkg1 import m0
+import pkg4.pkg40.m39
+
+
+def helper_7477_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7477_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7477_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7477_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,38 @@
+"""Module 805."""
+import pkg3.pkg26.pkg213.m212
+from pkg5.pkg47 import m46
+import pkg3.pkg27.pkg222.m638
+from pkg3.pkg29.pkg240 import m239
+from . import m388
+from pkg5.pkg43.pkg347 import m346
+import pkg4.m3
+from pkg4.pkg35 import m34
+import pkg1.pkg16.pkg134.m133
+
+
+def helper_805_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_805_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_805_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_805_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,31 @@
+"""Module 3308."""
+import pkg5.m4
+from . import m1640
+from . import m2057
+from pkg1.pkg12 import m428
+import pkg1.pkg12.pkg97.m3015
+from . import m2474
+import pkg5.pkg48.pkg389.m388
+from pkg5.pkg43 import m42
+import pkg4.m3
+
+
+def helper_3308_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3308_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3308_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,48 @@
+"""Module 4976."""
+import pkg4.pkg35.m868
+from pkg4.pkg34.pkg280 import m3615
+import pkg1.pkg10.pkg84.m83
+from pkg1.pkg10 import m9
+import pkg2.pkg17.pkg138.m971
+from . import m389
+import pkg1.pkg11.pkg91.m4677
+from pkg1.pkg9.pkg74 import m1324
+import pkg4.pkg33.pkg265.m2349
+from pkg4.pkg37 import m36
+import pkg2.pkg22.pkg184.m4770
+from pkg6.pkg49.pkg399 import m4151
+
+
+def helper_4976_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4976_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4976_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4976_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_4976_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
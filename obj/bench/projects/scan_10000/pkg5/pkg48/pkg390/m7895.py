@@ -0,0 +1,38 @@
+"""Module 7895."""
+import pkg5.pkg48.pkg388.m2472
+from pkg3.pkg30.pkg241 import m240
+import pkg8.m7
+from pkg6.pkg49.pkg395 import m394
+import pkg4.pkg40.pkg326.m325
+from . import m2057
+import pkg1.pkg12.pkg99.m98
+from pkg2.pkg21 import m7526
+from . import m4142
+
+
+def helper_7895_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7895_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7895_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7895_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
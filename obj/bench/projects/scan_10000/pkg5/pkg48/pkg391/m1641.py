@@ -0,0 +1,21 @@
+"""Module 1641."""
+import pkg1.pkg13.m12
+from pkg2 import m1
+import pkg4.pkg34.m867
+from pkg4.pkg37.pkg299 import m1549
+from . import m807
+from . import m1224
+
+
+def helper_1641_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1641_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
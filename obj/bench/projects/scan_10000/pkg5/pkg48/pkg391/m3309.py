@@ -0,0 +1,39 @@
+"""Module 3309."""
+import pkg5.pkg48.pkg390.m2891
+from pkg5.pkg42.pkg340 import m2424
+import pkg4.pkg37.pkg303.m1553
+from pkg1 import m417
+import pkg5.pkg42.m458
+from pkg7 import m6
+import pkg4.pkg37.pkg299.m2800
+from pkg6.pkg49.pkg398 import m814
+import pkg5.pkg43.m42
+from pkg4.pkg38.pkg306 import m722
+
+
+def helper_3309_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3309_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3309_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3309_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
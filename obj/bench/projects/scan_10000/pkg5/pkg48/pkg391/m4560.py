@@ -0,0 +1,18 @@
+"""Module 4560."""
+import pkg3.pkg27.pkg221.m220
+from pkg3.pkg28.pkg230 import m1480
+from . import m3726
+
+
+def helper_4560_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4560_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
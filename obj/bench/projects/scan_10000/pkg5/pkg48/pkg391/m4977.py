@@ -0,0 +1,41 @@
+"""Module 4977."""
+import pkg4.pkg33.pkg268.m3603
+from pkg3.pkg32.pkg262 import m2346
+import pkg5.pkg45.pkg362.m1612
+from . import m4560
+import pkg7.pkg61.m894
+from pkg5.pkg44.pkg356 import m3691
+import pkg2.m1
+from . import m1224
+import pkg6.pkg50.pkg408.m407
+from pkg5.pkg42.pkg339 import m1172
+import pkg1.m0
+from pkg1.pkg9.pkg79 import m78
+
+
+def helper_4977_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4977_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4977_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4977_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 7896."""
+import pkg1.m0
+from pkg4.pkg36.pkg289 import m2373
+import pkg2.pkg18.pkg151.m150
+from pkg2.pkg19.pkg154 import m1404
+from . import m4977
+
+
+def helper_7896_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7896_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
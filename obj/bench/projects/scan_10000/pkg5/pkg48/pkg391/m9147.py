@@ -0,0 +1,31 @@
+"""Module 9147."""
+import pkg4.pkg35.m2953
+from pkg2.pkg24.pkg196 import m2697
+import pkg3.pkg28.pkg232.m648
+from pkg1 import m0
+import pkg6.pkg50.pkg406.m2907
+from pkg2.pkg23.pkg192 import m2276
+import pkg3.pkg28.pkg227.m226
+from pkg1.pkg10.pkg88 import m87
+from . import m7479
+
+
+def helper_9147_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9147_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9147_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
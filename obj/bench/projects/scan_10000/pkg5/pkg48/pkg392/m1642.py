@@ -0,0 +1,46 @@
+"""Module 1642."""
+import pkg5.m4
+from . import m1225
+import pkg4.pkg40.pkg325.m741
+from . import m391
+import pkg2.pkg17.m850
+from pkg8.pkg69 import m485
+import pkg3.pkg26.pkg214.m1047
+from pkg6.pkg49 import m882
+import pkg1.pkg14.m13
+from pkg1.pkg15.pkg124 import m123
+
+
+def helper_1642_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1642_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1642_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1642_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_1642_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,47 @@
+"""Module 2893."""
+import pkg6.pkg49.pkg394.m393
+from . import m2059
+import pkg5.pkg42.pkg338.m1588
+from . import m391
+import pkg2.pkg22.pkg177.m2678
+from pkg5.pkg46.pkg376 import m1209
+import pkg4.pkg34.m33
+from pkg7.pkg58 import m57
+import pkg5.pkg43.m42
+from pkg5.pkg41.pkg334 import m2835
+import pkg1.pkg14.pkg119.m2203
+
+
+def helper_2893_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2893_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2893_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2893_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_2893_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
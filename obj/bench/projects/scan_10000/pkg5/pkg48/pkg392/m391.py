@@ -0,0 +1,45 @@
+"""Module 391."""
+import pkg3.pkg30.pkg246.m245
+from pkg1 import m0
+import pkg1.pkg12.pkg98.m97
+from pkg1.pkg9.pkg77 import m76
+import pkg4.pkg34.pkg275.m274
+from pkg5.pkg47 import m46
+import pkg5.pkg41.m40
+from pkg3 import m2
+import pkg6.m5
+
+
+def helper_391_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_391_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_391_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_391_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_391_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,48 @@
+"""Module 5395."""
+import pkg1.pkg13.m12
+from . import m1642
+import pkg1.pkg9.pkg73.m489
+from pkg2.pkg20.pkg164 import m997
+import pkg6.pkg55.m54
+from pkg1.pkg16.pkg129 import m1796
+from . import m808
+from pkg4.pkg38.pkg306 import m4475
+import pkg6.pkg49.pkg400.m2901
+from pkg1.pkg16.pkg136 import m3471
+from . import m2893
+from pkg1.pkg9.pkg78 import m77
+
+
+def helper_5395_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5395_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5395_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5395_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_5395_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,22 @@
+"""Module 6646."""
+import pkg6.pkg56.m2974
+from pkg1 import m0
+from . import m2476
+from pkg1.pkg9.pkg73 import m72
+import pkg5.pkg46.pkg372.m1622
+from pkg4.pkg40 import m39
+import pkg8.m7
+
+
+def helper_6646_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6646_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
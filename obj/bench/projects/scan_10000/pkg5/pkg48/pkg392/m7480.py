@@ -0,0 +1,10 @@
+"""Module 7480."""
+import pkg5.pkg47.pkg377.m793
+from pkg1.pkg16.pkg133 import m132
+
+
+def helper_7480_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 1256."""
+import pkg4.pkg37.pkg298.m297
+from pkg2 import m1
+import pkg3.pkg27.m26
+from pkg4.pkg35 import m451
+
+
+def helper_1256_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1256_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
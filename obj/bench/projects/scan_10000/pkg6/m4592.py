@@ -0,0 +1,22 @@
+"""Module 4592."""
+import pkg2.pkg24.pkg195.m2696
+from . import m4175
+import pkg5.pkg41.pkg335.m3253
+from pkg1.pkg10.pkg85 import m3837
+import pkg3.pkg30.pkg244.m3579
+from pkg1 import m0
+import pkg1.pkg10.pkg87.m503
+
+
+def helper_4592_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4592_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 5426."""
+import pkg1.pkg13.pkg107.m106
+from pkg1 import m0
+import pkg5.pkg41.pkg331.m1581
+from pkg4.pkg34 import m33
+import pkg4.pkg40.pkg323.m4492
+
+
+def helper_5426_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5426_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5426_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,33 @@
+"""Module 5843."""
+from . import m1673
+from . import m2507
+from . import m1256
+from pkg8.pkg69 import m68
+from . import m3341
+from pkg6.pkg52.pkg417 import m416
+import pkg1.pkg9.m8
+from pkg3.pkg26.pkg209 import m625
+import pkg1.pkg14.pkg116.m5119
+from pkg1.pkg10 import m426
+import pkg7.pkg62.m3397
+
+
+def helper_5843_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5843_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5843_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
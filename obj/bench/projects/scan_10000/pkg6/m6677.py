@@ -0,0 +1,14 @@
+"""Module 6677."""
+import pkg4.pkg36.m452
+from . import m2507
+import pkg3.pkg30.pkg247.m2748
+from . import m5843
+import pkg2.pkg19.pkg155.m154
+from pkg3.pkg26.pkg216 import m632
+
+
+def helper_6677_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,15 @@
+"""Module 7928."""
+import pkg3.pkg30.pkg247.m663
+from . import m6677
+import pkg4.pkg34.pkg274.m273
+from pkg1.pkg12.pkg104 import m1354
+import pkg2.pkg24.pkg196.m195
+from pkg2.pkg17 import m16
+from . import m839
+
+
+def helper_7928_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
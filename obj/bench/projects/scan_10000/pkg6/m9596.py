@@ -0,0 +1,18 @@
+"""Module 9596."""
+import pkg2.pkg22.m9195
+from pkg1.pkg16.pkg131 import m547
+import pkg6.pkg50.pkg405.m3740
+from pkg5.pkg41 import m40
+from . import m8345
+from pkg1.pkg13.pkg112 import m111
+import pkg1.pkg16.pkg134.m3469
+from . import m3758
+from . import m3341
+from pkg6.pkg51 import m50
+
+
+def helper_9596_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
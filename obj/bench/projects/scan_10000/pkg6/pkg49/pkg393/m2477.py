@@ -0,0 +1,36 @@
+"""Module 2477."""
+import pkg6.pkg50.pkg407.m823
+from . import m809
+import pkg2.pkg21.pkg172.m588
+from pkg4.pkg35.pkg287 import m286
+import pkg4.pkg40.pkg325.m1575
+from pkg2.pkg24.pkg196 import m195
+import pkg4.m3
+
+
+def helper_2477_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2477_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2477_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2477_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
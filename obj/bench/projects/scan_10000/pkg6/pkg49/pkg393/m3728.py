@@ -0,0 +1,6 @@
+"""Module 3728."""
+import pkg5.pkg47.pkg382.m1632
+from pkg5.pkg46.pkg369 import m1202
+import pkg1.m0
+from pkg5.pkg41.pkg330 import m3248
+from . import m392
@@ -0,0 +1,41 @@
+"""Module 7898."""
+import pkg1.pkg12.pkg100.m2184
+from pkg3.pkg32.pkg259 import m5679
+import pkg3.pkg25.m24
+from pkg2.pkg24.pkg199 import m6870
+import pkg1.pkg16.pkg135.m5138
+from pkg1.pkg9 import m8
+from . import m1643
+from pkg3 import m2
+import pkg6.pkg49.pkg394.m6231
+from pkg4.pkg37.pkg304 import m720
+import pkg2.pkg18.pkg152.m3904
+from . import m5396
+
+
+def helper_7898_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7898_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7898_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7898_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
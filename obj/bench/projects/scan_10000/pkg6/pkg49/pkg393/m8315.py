@@ -0,0 +1,32 @@
+"""Module 8315."""
+import pkg1.pkg12.pkg97.m96
+from . import m2060
+import pkg5.pkg46.pkg369.m2036
+from pkg2.pkg24.pkg193 import m7698
+import pkg1.pkg9.pkg77.m5497
+from . import m7898
+from . import m6647
+from . import m6230
+import pkg5.pkg48.pkg386.m385
+from . import m2894
+
+
+def helper_8315_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8315_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8315_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
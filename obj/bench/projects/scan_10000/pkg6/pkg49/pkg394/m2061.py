@@ -0,0 +1,28 @@
+"""Module 2061."""
+import pkg2.m1
+from pkg3.pkg26.pkg211 import m1044
+import pkg1.m0
+from pkg6 import m5
+import pkg8.pkg72.m71
+from pkg2.pkg20.pkg168 import m167
+
+
+def helper_2061_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2061_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2061_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
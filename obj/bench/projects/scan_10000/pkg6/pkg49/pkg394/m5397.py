@@ -0,0 +1,35 @@
+"""Module 5397."""
+import pkg1.pkg11.pkg95.m94
+from . import m4146
+import pkg1.pkg16.m1266
+from pkg3.pkg29 import m28
+import pkg1.pkg13.pkg109.m2610
+from pkg1.pkg15.pkg128 import m127
+
+
+def helper_5397_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5397_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5397_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5397_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
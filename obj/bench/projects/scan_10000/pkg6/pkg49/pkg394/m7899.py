@@ -0,0 +1,47 @@
+"""Module 7899."""
+from . import m810
+from pkg4.pkg37.pkg297 import m713
+from . import m2895
+from pkg4.pkg34 import m33
+import pkg3.pkg28.m27
+from . import m5814
+import pkg3.pkg27.pkg221.m220
+from . import m1227
+from . import m4146
+from pkg3.pkg29 import m7117
+import pkg4.pkg40.pkg321.m320
+
+
+def helper_7899_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7899_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7899_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7899_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_7899_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,46 @@
+"""Module 9985."""
+from . import m3730
+from . import m2896
+from . import m3313
+from pkg3.pkg31.pkg249 import m5669
+import pkg5.pkg47.pkg379.m9135
+from pkg2.pkg23 import m22
+import pkg5.pkg48.m1715
+from pkg2 import m1
+import pkg2.pkg17.pkg137.m136
+from . import m1645
+
+
+def helper_9985_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9985_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9985_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9985_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_9985_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,15 @@
+"""Module 2897."""
+import pkg1.pkg15.pkg124.m957
+from pkg1.pkg10 import m9
+import pkg3.m2
+from . import m1229
+import pkg6.pkg54.m470
+from pkg1 import m0
+import pkg5.pkg48.pkg389.m2890
+
+
+def helper_2897_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,13 @@
+"""Module 3314."""
+import pkg5.pkg47.pkg378.m1628
+from pkg4.pkg40.pkg322 import m2406
+import pkg4.pkg40.pkg327.m2411
+from pkg2.pkg17.pkg138 import m1805
+import pkg1.pkg13.pkg112.m945
+
+
+def helper_3314_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
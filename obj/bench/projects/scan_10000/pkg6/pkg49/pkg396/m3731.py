@@ -0,0 +1,39 @@
+"""Module 3731."""
+import pkg4.pkg39.m1289
+from pkg3.pkg26.pkg213 import m2297
+import pkg1.m0
+from pkg1.pkg16 import m15
+import pkg2.pkg19.m18
+from pkg3 import m2
+import pkg6.pkg49.pkg394.m1644
+from pkg1.pkg11 import m10
+from . import m1229
+from pkg1.pkg15.pkg127 import m960
+
+
+def helper_3731_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3731_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3731_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3731_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,36 @@
+"""Module 5399."""
+import pkg4.pkg39.m38
+from pkg4.pkg39.pkg320 import m1570
+import pkg4.pkg33.pkg268.m1101
+from . import m3314
+import pkg1.m0
+from pkg3.pkg32.pkg262 import m261
+import pkg6.pkg51.pkg410.m2077
+
+
+def helper_5399_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5399_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5399_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5399_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,31 @@
+"""Module 5816."""
+from . import m3731
+from pkg5.pkg45.pkg361 import m777
+import pkg2.pkg24.pkg194.m610
+from . import m3314
+import pkg3.pkg32.pkg262.m1512
+from . import m4565
+from . import m2063
+from pkg2.pkg24 import m1691
+import pkg4.pkg39.pkg314.m1564
+
+
+def helper_5816_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5816_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5816_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,9 @@
+"""Module 6233."""
+from . import m1229
+
+
+def helper_6233_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
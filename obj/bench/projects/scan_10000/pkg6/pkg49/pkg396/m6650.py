@@ -0,0 +1,12 @@
+"""Module 6650."""
+import pkg5.pkg47.m46
+from pkg5.pkg44.pkg359 import m2026
+import pkg1.pkg9.pkg75.m5912
+from pkg1 import m0
+
+
+def helper_6650_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 7484."""
+import pkg5.pkg41.pkg333.m4085
+from pkg1 import m0
+import pkg1.pkg9.m8
+from pkg8 import m1258
+import pkg3.pkg27.m26
+from pkg3.pkg28.pkg232 import m648
+import pkg2.pkg20.pkg164.m1831
+from pkg3.pkg30.pkg242 import m5245
+import pkg5.pkg41.pkg335.m4921
+from pkg2.pkg21.pkg169 import m585
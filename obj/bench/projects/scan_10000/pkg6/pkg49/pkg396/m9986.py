@@ -0,0 +1,37 @@
+"""Module 9986."""
+from . import m5399
+from pkg3.pkg25.pkg202 import m1452
+import pkg5.pkg44.pkg359.m7030
+from pkg2.pkg23.pkg190 import m189
+import pkg2.pkg21.m20
+from pkg2.pkg20.pkg162 import m6416
+import pkg6.pkg50.pkg407.m823
+from . import m7484
+
+
+def helper_9986_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9986_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9986_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9986_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 3315."""
+import pkg3.pkg29.pkg235.m234
+from pkg2.pkg24.pkg195 import m1028
+import pkg2.pkg18.pkg146.m145
+from pkg2.pkg17.pkg137 import m136
+import pkg1.m0
+
+
+def helper_3315_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3315_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3315_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
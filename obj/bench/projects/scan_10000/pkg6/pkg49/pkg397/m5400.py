@@ -0,0 +1,13 @@
+"""Module 5400."""
+import pkg2.pkg21.pkg170.m4756
+from . import m396
+import pkg4.pkg39.pkg318.m317
+from . import m2898
+from . import m2481
+
+
+def helper_5400_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
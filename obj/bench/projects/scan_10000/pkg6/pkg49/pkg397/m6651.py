@@ -0,0 +1,22 @@
+"""Module 6651."""
+import pkg2.pkg19.m18
+from pkg5.pkg45.pkg366 import m365
+import pkg3.pkg27.pkg219.m1052
+from . import m3315
+import pkg4.pkg36.pkg296.m2380
+from pkg4.pkg39.pkg320 import m736
+import pkg3.pkg25.pkg202.m3537
+
+
+def helper_6651_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6651_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
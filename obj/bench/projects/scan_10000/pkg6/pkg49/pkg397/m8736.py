@@ -0,0 +1,26 @@
+"""Module 8736."""
+import pkg2.pkg24.pkg195.m8534
+from pkg5.pkg41.pkg330 import m1580
+import pkg8.m7
+from . import m7902
+
+
+def helper_8736_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8736_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8736_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,12 @@
+"""Module 9987."""
+import pkg5.pkg43.pkg350.m4519
+from . import m4566
+import pkg1.pkg15.pkg128.m3880
+from pkg4.pkg39.pkg313 import m1563
+
+
+def helper_9987_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,54 @@
+"""Module 1648."""
+import pkg2.pkg22.pkg178.m177
+from pkg1.pkg11.pkg95 import m511
+import pkg4.pkg36.pkg294.m293
+from pkg2.pkg21.pkg175 import m591
+import pkg4.pkg33.pkg265.m1098
+from pkg6.pkg50.pkg407 import m406
+import pkg2.pkg20.m436
+from pkg5.pkg45.pkg362 import m1195
+import pkg3.pkg28.pkg230.m1480
+from . import m1231
+from . import m397
+
+
+def helper_1648_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1648_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1648_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1648_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_1648_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_1648_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
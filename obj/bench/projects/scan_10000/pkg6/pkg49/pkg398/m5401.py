@@ -0,0 +1,39 @@
+"""Module 5401."""
+import pkg2.pkg18.m434
+from . import m4567
+import pkg3.m2
+from pkg1 import m0
+from . import m397
+from . import m1231
+from . import m3316
+from pkg4.pkg36.pkg293 import m2794
+import pkg6.pkg50.pkg408.m407
+from . import m814
+
+
+def helper_5401_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5401_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5401_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5401_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,37 @@
+"""Module 5818."""
+import pkg1.pkg13.pkg106.m105
+from pkg5.pkg48.pkg387 import m386
+import pkg5.pkg46.pkg369.m5789
+from pkg2.pkg17 import m850
+import pkg1.pkg9.pkg79.m4248
+from . import m2482
+from . import m3316
+from pkg7.pkg63 import m479
+
+
+def helper_5818_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5818_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5818_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5818_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,47 @@
+"""Module 814."""
+from . import m397
+from pkg1.pkg9 import m8
+import pkg1.m0
+from pkg5.pkg42.pkg338 import m337
+import pkg1.pkg9.pkg79.m78
+from pkg1.pkg14.pkg117 import m116
+import pkg3.pkg25.pkg206.m622
+from pkg1.pkg14 import m13
+import pkg3.pkg29.m28
+from pkg5.pkg41.pkg332 import m331
+import pkg1.pkg13.pkg107.m106
+
+
+def helper_814_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_814_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_814_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_814_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_814_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
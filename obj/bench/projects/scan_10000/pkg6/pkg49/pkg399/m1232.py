@@ -0,0 +1,41 @@
+"""Module 1232."""
+from . import m815
+from pkg5.pkg45.pkg368 import m1201
+import pkg5.pkg48.pkg387.m803
+from pkg1.pkg12.pkg98 import m514
+import pkg5.pkg42.m41
+from pkg2.pkg24 import m857
+import pkg1.pkg15.pkg127.m126
+from pkg4.pkg36.pkg293 import m292
+import pkg2.pkg19.pkg159.m992
+from pkg1.pkg13 import m12
+import pkg3.pkg32.pkg262.m261
+from pkg2 import m1
+
+
+def helper_1232_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1232_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1232_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1232_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
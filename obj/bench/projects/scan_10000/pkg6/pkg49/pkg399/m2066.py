@@ -0,0 +1,38 @@
+"""Module 2066."""
+import pkg4.pkg37.pkg299.m298
+from pkg3.pkg30 import m1697
+import pkg5.pkg45.pkg365.m364
+from pkg6.pkg55 import m471
+from . import m815
+from pkg1 import m0
+import pkg2.pkg23.pkg189.m1022
+from pkg3.pkg28 import m27
+from . import m1232
+
+
+def helper_2066_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2066_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2066_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2066_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
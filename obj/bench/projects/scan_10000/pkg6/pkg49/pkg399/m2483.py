@@ -0,0 +1,48 @@
+"""Module 2483."""
+from . import m398
+from pkg4.pkg40.pkg326 import m325
+import pkg2.pkg24.pkg193.m1026
+from pkg3.pkg25 import m441
+import pkg6.pkg51.pkg416.m415
+from pkg1.pkg15 import m14
+import pkg1.pkg14.pkg114.m113
+from . import m815
+import pkg4.pkg37.pkg302.m718
+from pkg2 import m1
+from . import m1232
+from pkg8.pkg66 import m482
+
+
+def helper_2483_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2483_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2483_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2483_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_2483_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
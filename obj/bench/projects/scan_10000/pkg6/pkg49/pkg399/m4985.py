@@ -0,0 +1,29 @@
+"""Module 4985."""
+import pkg6.pkg50.pkg403.m1236
+from pkg2.pkg18.pkg146 import m145
+import pkg2.m1
+from pkg2.pkg21.pkg169 import m1836
+from . import m398
+from pkg2.pkg19 import m18
+import pkg6.pkg49.m48
+
+
+def helper_4985_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4985_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4985_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
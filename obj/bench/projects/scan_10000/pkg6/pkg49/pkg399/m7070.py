@@ -0,0 +1,3 @@
+"""Module 7070."""
+import pkg1.m0
+from pkg3.pkg31 import m30
@@ -0,0 +1,12 @@
+"""Module 9989."""
+import pkg1.m0
+from . import m7487
+import pkg2.pkg19.pkg153.m2654
+from pkg2.pkg20 import m1687
+
+
+def helper_9989_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,41 @@
+"""Module 3735."""
+from . import m2067
+from pkg4.pkg37.pkg302 import m718
+import pkg1.pkg9.pkg76.m75
+from pkg5.pkg41 import m874
+import pkg3.pkg27.pkg219.m1886
+from pkg6.pkg54 import m53
+import pkg2.pkg20.pkg163.m1413
+from . import m2484
+import pkg4.pkg33.m2951
+from pkg3.pkg30.pkg247 import m1914
+import pkg5.pkg46.pkg371.m787
+from pkg2 import m1
+
+
+def helper_3735_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3735_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3735_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3735_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
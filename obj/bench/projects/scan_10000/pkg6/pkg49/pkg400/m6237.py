@@ -0,0 +1,10 @@
+"""Module 6237."""
+import pkg1.pkg14.m430
+from . import m1233
+
+
+def helper_6237_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
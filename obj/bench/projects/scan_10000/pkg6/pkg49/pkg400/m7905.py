@@ -0,0 +1,19 @@
+"""Module 7905."""
+from . import m2484
+from pkg6.pkg49 import m48
+import pkg4.pkg36.pkg296.m6133
+from pkg4.pkg40.pkg323 import m739
+import pkg5.pkg41.pkg335.m3670
+from pkg3.pkg26.pkg214 import m1047
+import pkg3.pkg26.m2944
+from pkg4.pkg34 import m2118
+from . import m6237
+from pkg1.pkg14.pkg118 import m117
+import pkg8.pkg67.m483
+
+
+def helper_7905_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
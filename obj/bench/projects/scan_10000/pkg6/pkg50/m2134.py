@@ -0,0 +1,16 @@
+"""Module 2134."""
+import pkg5.pkg47.pkg378.m2045
+from pkg7.pkg57 import m56
+from . import m49
+from pkg1 import m0
+import pkg3.pkg28.pkg227.m226
+from pkg6.pkg55 import m54
+import pkg4.pkg39.pkg313.m312
+from pkg1.pkg11 import m10
+
+
+def helper_2134_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
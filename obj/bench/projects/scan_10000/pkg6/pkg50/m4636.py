@@ -0,0 +1,44 @@
+"""Module 4636."""
+import pkg4.pkg34.pkg278.m1111
+from pkg2.pkg18 import m17
+import pkg4.pkg37.pkg303.m1136
+from pkg6.pkg51 import m50
+import pkg1.pkg14.pkg113.m1363
+from pkg4.pkg36.pkg296 import m712
+import pkg3.pkg26.pkg213.m212
+from pkg3.pkg30.pkg246 import m245
+
+
+def helper_4636_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4636_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4636_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4636_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_4636_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
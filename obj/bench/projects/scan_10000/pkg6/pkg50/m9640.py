@@ -0,0 +1,9 @@
+"""Module 9640."""
+from . import m5887
+from pkg1.pkg12.pkg101 import m934
+import pkg7.m6
+from pkg6.pkg50.pkg406 import m405
+from . import m7972
+from pkg4 import m3
+import pkg2.pkg23.pkg191.m1858
+from pkg5.pkg43.pkg347 import m6184
@@ -0,0 +1,35 @@
+"""Module 1234."""
+import pkg8.pkg66.m65
+from . import m400
+import pkg2.pkg21.pkg174.m173
+from pkg1.pkg14.pkg113 import m529
+import pkg2.pkg23.pkg186.m185
+from pkg2.pkg19.pkg153 import m152
+
+
+def helper_1234_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1234_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1234_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1234_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
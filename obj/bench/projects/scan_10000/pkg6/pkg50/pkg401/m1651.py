@@ -0,0 +1,24 @@
+"""Module 1651."""
+import pkg5.pkg41.pkg329.m745
+from pkg1.pkg15 import m14
+import pkg1.m0
+from . import m400
+import pkg6.m5
+from pkg1.pkg9 import m8
+import pkg3.pkg30.pkg243.m242
+from pkg2.pkg20.pkg168 import m167
+import pkg2.pkg22.pkg178.m1428
+
+
+def helper_1651_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1651_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
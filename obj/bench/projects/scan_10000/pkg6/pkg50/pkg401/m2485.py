@@ -0,0 +1,28 @@
+"""Module 2485."""
+import pkg2.pkg22.pkg178.m2262
+from pkg4.pkg33.pkg268 import m267
+import pkg1.pkg13.pkg110.m109
+from pkg1.pkg13.pkg106 import m105
+import pkg3.pkg29.pkg240.m239
+from pkg4 import m3
+
+
+def helper_2485_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2485_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2485_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 7072."""
+import pkg3.pkg31.pkg251.m6088
+from pkg1 import m0
+from . import m4987
+from pkg5.pkg41.pkg335 import m334
+import pkg8.pkg69.m4655
+from pkg8 import m424
+from . import m817
+from pkg5.pkg46.pkg372 import m788
+import pkg5.pkg48.m2966
+from pkg1.pkg15.pkg124 import m1791
+import pkg6.pkg52.m6723
+from pkg2.pkg21.pkg176 import m175
+
+
+def helper_7072_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7072_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
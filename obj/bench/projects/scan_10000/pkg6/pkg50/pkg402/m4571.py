@@ -0,0 +1,14 @@
+"""Module 4571."""
+import pkg2.pkg22.pkg178.m177
+from . import m1235
+import pkg6.pkg52.pkg417.m416
+from pkg4.pkg40.pkg322 import m1155
+import pkg3.pkg25.pkg205.m621
+from . import m3320
+
+
+def helper_4571_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,53 @@
+"""Module 5405."""
+import pkg1.m0
+from pkg3 import m2
+import pkg1.pkg16.pkg136.m1386
+from pkg2.pkg22.pkg182 import m3934
+import pkg3.pkg32.pkg258.m4427
+from pkg4.pkg36 import m35
+from . import m4988
+from pkg4.pkg36.pkg290 import m4876
+import pkg2.pkg20.pkg162.m578
+from pkg4.pkg38.pkg312 import m1562
+
+
+def helper_5405_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5405_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5405_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5405_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_5405_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_5405_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 6656."""
+from . import m401
+from pkg1 import m0
+import pkg4.pkg35.m34
+from pkg1.pkg15.pkg121 import m5124
+import pkg1.pkg11.pkg92.m91
+from . import m818
+import pkg3.m2
+from pkg2.pkg20.pkg166 import m582
+import pkg4.pkg34.pkg278.m1528
+from pkg4.pkg36.pkg292 import m1959
+import pkg1.pkg14.pkg115.m3867
+from pkg3.pkg25.pkg203 import m1036
+
+
+def helper_6656_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6656_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,23 @@
+"""Module 8741."""
+import pkg4.pkg33.pkg268.m684
+from pkg6.pkg49.pkg399 import m2066
+import pkg1.pkg12.pkg99.m2183
+from . import m2069
+from . import m818
+from . import m3737
+import pkg5.pkg42.pkg343.m342
+from pkg3.pkg25.pkg206 import m1873
+
+
+def helper_8741_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8741_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,54 @@
+"""Module 9575."""
+import pkg5.m4
+from pkg2.pkg24.pkg199 import m2283
+from . import m7907
+from pkg3.pkg29.pkg239 import m238
+import pkg3.pkg30.m7118
+from pkg3.pkg26 import m7114
+import pkg4.pkg35.m34
+from pkg3.pkg28.pkg229 import m228
+import pkg1.pkg9.m2093
+from . import m3737
+import pkg2.pkg18.pkg146.m562
+
+
+def helper_9575_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9575_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9575_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9575_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_9575_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_9575_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,45 @@
+"""Module 2904."""
+import pkg5.pkg43.pkg346.m345
+from pkg2.pkg18.pkg146 import m145
+import pkg5.pkg46.pkg376.m792
+from . import m819
+import pkg5.pkg42.pkg339.m338
+from pkg5.pkg45.pkg363 import m362
+from . import m402
+from . import m1653
+import pkg5.pkg46.pkg375.m791
+
+
+def helper_2904_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2904_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2904_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2904_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_2904_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
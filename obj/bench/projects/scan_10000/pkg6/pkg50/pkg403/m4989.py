@@ -0,0 +1,32 @@
+"""Module 4989."""
+import pkg3.pkg30.pkg242.m658
+from . import m4155
+import pkg1.pkg12.pkg101.m100
+from pkg1.pkg14.pkg115 import m1365
+import pkg1.pkg16.pkg136.m135
+from pkg5.pkg47.pkg383 import m799
+import pkg8.pkg66.m2150
+from . import m819
+import pkg4.pkg33.m32
+from pkg4.pkg40.pkg327 import m1577
+
+
+def helper_4989_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4989_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4989_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,61 @@
+"""Module 5823."""
+import pkg2.pkg18.pkg150.m1400
+from pkg3.pkg25 import m858
+import pkg1.pkg14.pkg120.m953
+from pkg2.pkg21.pkg172 import m171
+import pkg4.pkg40.pkg325.m1575
+from pkg1.pkg9.pkg76 import m3828
+import pkg1.pkg12.pkg102.m101
+from pkg3.pkg27.pkg219 import m1052
+import pkg5.pkg44.pkg357.m4109
+from pkg3.pkg31.pkg252 import m4004
+from . import m4989
+
+
+def helper_5823_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5823_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5823_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5823_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_5823_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_5823_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5823_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 8325."""
+from . import m1653
+from pkg2.pkg20 import m19
+import pkg5.pkg48.pkg385.m8307
+from . import m6657
+import pkg2.pkg18.pkg145.m144
+from pkg2.pkg21.pkg171 import m587
+import pkg2.pkg21.pkg171.m5591
+from pkg2.pkg24.pkg198 import m614
+import pkg2.pkg17.pkg139.m1389
+from pkg2.pkg18.pkg147 import m146
+import pkg6.pkg50.pkg402.m1652
+
+
+def helper_8325_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
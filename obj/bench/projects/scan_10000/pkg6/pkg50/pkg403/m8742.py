@@ -0,0 +1,14 @@
+"""Module 8742."""
+import pkg2.pkg21.pkg174.m3926
+from pkg5.pkg42.pkg337 import m7425
+import pkg3.pkg27.pkg221.m7309
+from pkg3 import m2
+import pkg2.pkg18.pkg146.m4732
+from pkg4.pkg40.pkg326 import m1993
+
+
+def helper_8742_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
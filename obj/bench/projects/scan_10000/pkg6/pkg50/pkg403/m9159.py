@@ -0,0 +1,18 @@
+"""Module 9159."""
+import pkg2.pkg19.pkg159.m3911
+from pkg6.pkg49 import m4218
+import pkg2.pkg17.pkg137.m1387
+from pkg4.pkg35.pkg288 import m7376
+import pkg1.m0
+from pkg6.pkg51.pkg409 import m4578
+import pkg2.pkg17.pkg143.m5146
+from . import m2904
+import pkg2.pkg19.pkg155.m6826
+from pkg4.pkg33.pkg268 import m1101
+
+
+def helper_9159_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
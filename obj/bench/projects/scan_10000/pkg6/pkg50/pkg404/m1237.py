@@ -0,0 +1,22 @@
+"""Module 1237."""
+from . import m403
+from . import m820
+import pkg7.pkg58.m474
+from pkg5.pkg43.pkg351 import m350
+import pkg1.pkg15.pkg127.m543
+from pkg1.pkg12.pkg100 import m99
+import pkg1.pkg12.pkg98.m97
+
+
+def helper_1237_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1237_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,4 @@
+"""Module 1654."""
+import pkg1.m0
+from . import m403
+from . import m820
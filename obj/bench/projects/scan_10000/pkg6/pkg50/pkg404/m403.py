@@ -0,0 +1,15 @@
+"""Module 403."""
+import pkg1.m0
+from pkg2.pkg19.pkg156 import m155
+import pkg4.pkg33.pkg270.m269
+from pkg5 import m4
+import pkg2.pkg18.pkg151.m150
+from pkg2.pkg20.pkg168 import m167
+import pkg5.pkg42.m41
+
+
+def helper_403_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,36 @@
+"""Module 6658."""
+import pkg3.pkg27.m26
+from pkg2.pkg21.pkg175 import m1008
+import pkg2.pkg23.m22
+from pkg3.pkg29 import m28
+from . import m2905
+from pkg3.pkg28.pkg225 import m1058
+from . import m5824
+
+
+def helper_6658_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6658_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6658_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6658_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 9160."""
+import pkg8.pkg66.m65
+from pkg7 import m3342
+import pkg1.pkg16.pkg132.m548
+from . import m8743
+
+
+def helper_9160_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9160_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 4157."""
+import pkg1.pkg10.pkg82.m2166
+from pkg8 import m7
+import pkg2.pkg20.pkg162.m3497
+from pkg1.pkg14.pkg117 import m950
+import pkg4.pkg38.pkg306.m3641
+from pkg5.pkg47.pkg383 import m382
+from . import m2906
+from pkg1.pkg9 import m2093
+import pkg8.pkg71.m70
+from pkg4.pkg33.pkg272 import m271
+import pkg4.pkg37.m36
+
+
+def helper_4157_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4157_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
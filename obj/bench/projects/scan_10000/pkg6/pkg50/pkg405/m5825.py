@@ -0,0 +1,18 @@
+"""Module 5825."""
+import pkg6.pkg49.pkg394.m393
+from pkg2.pkg24.pkg199 import m2700
+import pkg1.pkg14.m13
+from . import m2906
+import pkg3.pkg30.pkg242.m658
+from . import m4574
+import pkg3.pkg26.pkg210.m4379
+from pkg4.pkg38.pkg312 import m311
+from . import m3323
+from pkg1 import m0
+
+
+def helper_5825_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 6242."""
+import pkg4.pkg36.pkg291.m1541
+from pkg3.pkg28.pkg227 import m226
+import pkg6.pkg49.m48
+from pkg3.pkg30.pkg243 import m4829
+import pkg5.m4
+from . import m1655
+import pkg5.pkg45.pkg367.m3702
+from pkg3.pkg29.pkg240 import m239
+import pkg5.pkg41.pkg332.m3667
+from pkg7.pkg61 import m60
+import pkg4.pkg37.m36
+from pkg1.pkg16.pkg132 import m3884
+
+
+def helper_6242_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6242_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
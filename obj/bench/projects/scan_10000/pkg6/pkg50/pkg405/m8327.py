@@ -0,0 +1,10 @@
+"""Module 8327."""
+import pkg2.pkg24.m23
+from pkg1.pkg13.pkg105 import m5108
+import pkg5.pkg46.m1296
+from . import m7493
+import pkg1.pkg12.pkg100.m99
+from pkg1.pkg11.pkg96 import m6350
+import pkg3.pkg31.pkg254.m6925
+from . import m2489
+import pkg1.pkg9.pkg78.m77
@@ -0,0 +1,31 @@
+"""Module 9578."""
+import pkg5.pkg45.pkg363.m6617
+from pkg1 import m0
+import pkg1.pkg9.pkg77.m76
+from pkg4.pkg38.pkg309 import m6563
+import pkg3.pkg29.pkg236.m5239
+from pkg5.pkg47.pkg382 import m7470
+import pkg5.pkg44.pkg359.m775
+from . import m9161
+from . import m3740
+
+
+def helper_9578_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9578_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9578_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,45 @@
+"""Module 1656."""
+import pkg4.pkg40.pkg322.m321
+from pkg3.pkg31.pkg256 import m255
+import pkg8.pkg70.m1320
+from pkg5.pkg45.pkg362 import m1195
+import pkg4.pkg36.pkg291.m707
+from pkg5.pkg45 import m44
+import pkg4.pkg37.m36
+from pkg2.pkg22.pkg177 import m176
+import pkg1.pkg12.pkg97.m930
+
+
+def helper_1656_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1656_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1656_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1656_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_1656_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
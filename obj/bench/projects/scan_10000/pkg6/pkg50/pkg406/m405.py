@@ -0,0 +1,32 @@
+"""Module 405."""
+import pkg4.pkg40.m39
+from pkg1.pkg9.pkg77 import m76
+import pkg3.pkg30.pkg245.m244
+from pkg1.pkg15.pkg121 import m120
+import pkg1.pkg12.pkg97.m96
+from pkg4.pkg33 import m32
+import pkg1.m0
+from pkg2.pkg19.pkg154 import m153
+import pkg4.pkg37.pkg302.m301
+from pkg5.pkg41 import m40
+
+
+def helper_405_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_405_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_405_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
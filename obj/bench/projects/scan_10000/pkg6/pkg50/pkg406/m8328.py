@@ -0,0 +1,10 @@
+"""Module 8328."""
+from . import m4575
+from pkg1.pkg16.pkg130 import m129
+
+
+def helper_8328_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
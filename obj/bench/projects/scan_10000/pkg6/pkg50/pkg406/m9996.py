@@ -0,0 +1,15 @@
+"""Module 9996."""
+from . import m7911
+from pkg1.pkg12.pkg98 import m7186
+import pkg1.pkg12.pkg98.m931
+from pkg5.pkg47.pkg379 import m378
+import pkg5.pkg48.pkg391.m5811
+from . import m4575
+import pkg1.pkg10.pkg86.m85
+
+
+def helper_9996_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
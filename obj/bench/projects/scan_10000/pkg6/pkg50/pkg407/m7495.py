@@ -0,0 +1,47 @@
+"""Module 7495."""
+import pkg1.m0
+from pkg2.pkg17 import m5020
+import pkg2.pkg21.m437
+from pkg2.pkg18.pkg148 import m4734
+import pkg2.pkg23.pkg190.m4776
+from . import m2491
+import pkg4.pkg33.pkg266.m1933
+from pkg1.pkg14 import m13
+import pkg1.pkg12.pkg104.m1354
+from pkg7 import m6
+from . import m823
+
+
+def helper_7495_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7495_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7495_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7495_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_7495_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,30 @@
+"""Module 823."""
+import pkg4.pkg36.m35
+from pkg5.pkg45 import m461
+from . import m406
+from pkg4.pkg38.pkg309 import m725
+import pkg3.pkg26.m25
+from pkg6.pkg54 import m53
+import pkg4.pkg40.pkg328.m327
+from pkg1 import m0
+
+
+def helper_823_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_823_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_823_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,6 @@
+"""Module 9997."""
+import pkg6.pkg50.m49
+from pkg1.pkg9.pkg80 import m2998
+import pkg3.pkg28.pkg231.m230
+from pkg4.pkg35.pkg282 import m3200
+import pkg3.pkg26.pkg213.m2297
@@ -0,0 +1,15 @@
+"""Module 1241."""
+from . import m407
+from pkg2.pkg24.pkg195 import m611
+import pkg3.pkg29.pkg239.m655
+from pkg5.pkg48.pkg391 import m1224
+import pkg5.pkg43.m42
+from pkg3 import m2
+import pkg2.m1
+
+
+def helper_1241_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,46 @@
+"""Module 4577."""
+import pkg2.pkg23.pkg187.m3105
+from . import m2075
+from . import m824
+from pkg1.pkg13.pkg109 import m3027
+import pkg2.pkg17.pkg138.m137
+from . import m2492
+import pkg3.m2
+from pkg1.pkg15.pkg127 import m126
+import pkg2.pkg18.pkg148.m2649
+from pkg5.pkg48.pkg387 import m2054
+
+
+def helper_4577_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4577_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4577_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4577_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_4577_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,10 @@
+"""Module 5411."""
+import pkg3.pkg26.pkg213.m212
+from pkg4.pkg36 import m35
+
+
+def helper_5411_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
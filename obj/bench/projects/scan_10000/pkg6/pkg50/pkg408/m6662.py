@@ -0,0 +1,40 @@
+"""Module 6662."""
+import pkg4.pkg40.m39
+from . import m4577
+from . import m407
+from pkg8.pkg72 import m71
+import pkg4.pkg36.pkg292.m5295
+from pkg5.pkg42.pkg340 import m339
+import pkg6.pkg49.pkg393.m1643
+from pkg2.pkg22 import m438
+import pkg4.pkg34.m450
+from pkg2.pkg23 import m22
+import pkg1.pkg13.pkg105.m1772
+
+
+def helper_6662_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6662_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6662_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6662_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
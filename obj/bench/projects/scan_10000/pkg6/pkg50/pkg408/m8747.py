@@ -0,0 +1,5 @@
+"""Module 8747."""
+import pkg3.m2
+from pkg1.pkg11.pkg92 import m3010
+import pkg1.pkg15.m14
+from pkg3.pkg26.pkg214 import m6468
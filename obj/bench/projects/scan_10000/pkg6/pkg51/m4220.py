@@ -0,0 +1,12 @@
+"""Module 4220."""
+import pkg1.pkg16.pkg135.m3887
+from . import m3803
+import pkg4.pkg34.pkg278.m1945
+from pkg6.pkg49.pkg393 import m3728
+
+
+def helper_4220_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 5054."""
+from . import m3803
+from . import m50
+import pkg1.pkg10.pkg88.m1755
+from pkg3.pkg27.pkg222 import m1889
+from . import m1301
+from pkg7.pkg64 import m63
+import pkg3.pkg26.pkg215.m214
+from pkg4.pkg35 import m451
+import pkg1.m0
+from pkg4.pkg39.pkg316 import m732
+import pkg5.pkg47.pkg384.m4136
+
+
+def helper_5054_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5054_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
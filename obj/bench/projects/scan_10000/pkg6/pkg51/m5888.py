@@ -0,0 +1,45 @@
+"""Module 5888."""
+import pkg3.pkg32.pkg260.m676
+from pkg8.pkg71 import m70
+import pkg1.pkg13.m1263
+from pkg1.pkg9 import m425
+import pkg4.pkg39.pkg318.m2819
+from pkg5.pkg43.pkg351 import m350
+import pkg4.pkg40.m456
+from pkg1.pkg13 import m12
+import pkg6.pkg49.pkg395.m3313
+
+
+def helper_5888_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5888_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5888_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5888_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_5888_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
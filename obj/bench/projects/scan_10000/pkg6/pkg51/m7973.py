@@ -0,0 +1,24 @@
+"""Module 7973."""
+from . import m467
+from pkg1 import m0
+import pkg6.m5
+from pkg1.pkg13.pkg106 import m4692
+import pkg2.m1
+from . import m50
+import pkg2.pkg24.pkg200.m199
+from pkg2.pkg20.pkg165 import m164
+import pkg4.pkg34.pkg276.m692
+
+
+def helper_7973_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7973_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,13 @@
+"""Module 2076."""
+import pkg1.pkg11.pkg90.m89
+from . import m408
+import pkg1.pkg14.m13
+from pkg5.pkg46 import m879
+import pkg1.pkg9.pkg76.m1326
+
+
+def helper_2076_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 2910."""
+import pkg1.pkg10.pkg86.m85
+from pkg4.pkg39.pkg317 import m2818
+import pkg3.pkg30.pkg248.m1498
+from . import m825
+import pkg2.pkg19.m1269
+from pkg4.pkg37.pkg304 import m303
+import pkg1.pkg13.pkg110.m109
+from pkg5 import m4
+import pkg4.pkg34.pkg274.m1524
+from . import m2076
+from . import m1659
+
+
+def helper_2910_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
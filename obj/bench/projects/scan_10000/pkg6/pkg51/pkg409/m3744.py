@@ -0,0 +1,31 @@
+"""Module 3744."""
+from . import m2076
+from pkg2.pkg19.pkg159 import m3077
+import pkg2.pkg20.pkg168.m1835
+from pkg4.pkg39.pkg319 import m2403
+import pkg3.pkg31.pkg253.m252
+from . import m825
+import pkg5.pkg42.pkg343.m2844
+from pkg4.pkg38 import m454
+import pkg1.pkg10.pkg82.m81
+
+
+def helper_3744_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3744_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3744_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,33 @@
+"""Module 4161."""
+import pkg2.pkg22.pkg177.m593
+from pkg1.pkg15.pkg123 import m2207
+import pkg3.pkg32.pkg259.m258
+from pkg1.pkg12.pkg99 import m515
+import pkg1.pkg13.pkg106.m2190
+from . import m408
+import pkg8.m7
+from . import m1242
+import pkg1.pkg15.pkg123.m3875
+from pkg3.pkg31.pkg256 import m4008
+import pkg5.pkg43.pkg352.m1185
+
+
+def helper_4161_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4161_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4161_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
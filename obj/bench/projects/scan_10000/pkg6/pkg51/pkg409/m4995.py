@@ -0,0 +1,31 @@
+"""Module 4995."""
+import pkg1.m0
+from pkg5 import m4
+import pkg6.pkg50.pkg407.m406
+from . import m2076
+import pkg2.pkg22.m21
+from pkg2.pkg24 import m23
+import pkg2.pkg17.pkg144.m143
+from pkg2 import m1
+import pkg4.pkg39.m38
+
+
+def helper_4995_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4995_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4995_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
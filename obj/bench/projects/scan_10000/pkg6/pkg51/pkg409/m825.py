@@ -0,0 +1,40 @@
+"""Module 825."""
+import pkg5.pkg47.pkg384.m383
+from pkg6 import m5
+import pkg4.pkg39.m38
+from pkg3 import m2
+import pkg1.m0
+from pkg2 import m1
+import pkg2.pkg17.pkg140.m139
+from pkg2.pkg24.pkg196 import m195
+from . import m408
+from pkg1.pkg10.pkg81 import m80
+import pkg5.pkg47.pkg380.m379
+
+
+def helper_825_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_825_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_825_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_825_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
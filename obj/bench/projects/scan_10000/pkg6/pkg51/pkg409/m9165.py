@@ -0,0 +1,46 @@
+"""Module 9165."""
+import pkg1.pkg16.pkg136.m135
+from pkg4.pkg38.pkg305 import m304
+import pkg4.pkg38.pkg312.m4898
+from pkg2.pkg20.pkg161 import m1828
+import pkg4.pkg33.pkg268.m2769
+from pkg8.pkg72 import m5075
+import pkg2.pkg22.pkg183.m1016
+from pkg1.pkg12.pkg97 import m96
+import pkg6.pkg50.pkg401.m400
+from . import m4161
+
+
+def helper_9165_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9165_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9165_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9165_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_9165_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
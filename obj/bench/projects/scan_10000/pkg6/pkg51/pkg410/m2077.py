@@ -0,0 +1,37 @@
+"""Module 2077."""
+import pkg3.pkg29.pkg239.m1072
+from pkg3.pkg31.pkg252 import m1085
+import pkg4.pkg38.pkg309.m1976
+from pkg1 import m0
+from . import m826
+from pkg6.pkg51 import m50
+from . import m1243
+from pkg5.pkg46 import m45
+
+
+def helper_2077_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2077_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2077_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2077_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 4996."""
+import pkg2.pkg18.m2519
+from . import m1660
+
+
+def helper_4996_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4996_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,46 @@
+"""Module 5413."""
+from . import m2077
+from pkg2.pkg24 import m23
+import pkg3.pkg31.pkg256.m4008
+from pkg2.pkg21.pkg174 import m2675
+import pkg1.pkg15.m848
+from pkg3.pkg25.pkg205 import m4791
+import pkg1.pkg13.pkg108.m524
+from pkg2.pkg18.pkg152 import m5155
+import pkg4.pkg40.pkg328.m327
+from pkg4.pkg39.pkg317 import m1567
+
+
+def helper_5413_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5413_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5413_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5413_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_5413_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
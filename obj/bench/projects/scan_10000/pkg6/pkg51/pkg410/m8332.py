@@ -0,0 +1,54 @@
+"""Module 8332."""
+import pkg8.m7
+from pkg4.pkg37.pkg304 import m6141
+import pkg3.pkg26.m25
+from pkg4.pkg35.pkg286 import m7374
+import pkg5.pkg47.m5050
+from . import m4996
+import pkg8.pkg67.m483
+from pkg1.pkg11.pkg95 import m511
+from . import m7081
+from pkg6.pkg53 import m1303
+import pkg3.pkg27.pkg223.m4809
+
+
+def helper_8332_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8332_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8332_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8332_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_8332_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_8332_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
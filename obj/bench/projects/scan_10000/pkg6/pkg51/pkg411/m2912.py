@@ -0,0 +1,41 @@
+"""Module 2912."""
+import pkg3.pkg32.pkg258.m2759
+from pkg1.pkg11.pkg90 import m1340
+import pkg1.m0
+from . import m827
+import pkg3.pkg25.m24
+from pkg4.pkg35 import m34
+import pkg3.pkg28.pkg227.m226
+from pkg4.pkg38.pkg307 import m723
+import pkg7.m6
+from pkg4.pkg38.pkg307 import m1557
+import pkg1.pkg16.pkg136.m135
+from . import m1244
+
+
+def helper_2912_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2912_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2912_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2912_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
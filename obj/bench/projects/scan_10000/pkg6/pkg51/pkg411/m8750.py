@@ -0,0 +1,34 @@
+"""Module 8750."""
+from . import m2912
+from pkg4.pkg40.pkg325 import m3243
+from . import m2495
+from pkg1 import m0
+import pkg4.pkg38.pkg305.m721
+from . import m6665
+from . import m4163
+from pkg5.pkg46 import m879
+import pkg3.pkg26.pkg211.m1461
+from pkg2.pkg17.pkg141 import m140
+import pkg2.pkg17.m16
+from pkg4 import m3
+
+
+def helper_8750_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8750_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8750_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,47 @@
+"""Module 1662."""
+from . import m828
+from pkg2.pkg19 import m852
+import pkg1.pkg16.pkg133.m1383
+from pkg4.pkg34 import m33
+import pkg5.pkg44.pkg358.m774
+from pkg5 import m4
+import pkg4.pkg36.pkg293.m292
+from pkg8.pkg71 import m70
+import pkg2.pkg18.pkg148.m147
+from pkg6.pkg51.pkg416 import m415
+import pkg5.pkg44.pkg357.m773
+
+
+def helper_1662_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1662_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1662_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1662_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_1662_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,31 @@
+"""Module 2496."""
+from . import m1662
+from . import m828
+import pkg3.pkg28.m27
+from pkg1.pkg10.pkg87 import m86
+from . import m1245
+from pkg3.pkg32.pkg264 import m263
+import pkg7.pkg61.m2145
+from pkg1 import m0
+from . import m411
+
+
+def helper_2496_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2496_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2496_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
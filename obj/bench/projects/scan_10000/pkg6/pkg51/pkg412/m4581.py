@@ -0,0 +1,25 @@
+"""Module 4581."""
+import pkg1.pkg16.pkg129.m962
+from pkg5.pkg43.pkg346 import m2430
+import pkg2.pkg18.pkg152.m3904
+
+
+def helper_4581_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4581_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4581_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
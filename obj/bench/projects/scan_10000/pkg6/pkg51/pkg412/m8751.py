@@ -0,0 +1,20 @@
+"""Module 8751."""
+import pkg8.m4594
+from pkg4.pkg40 import m5043
+from . import m6249
+from pkg1.pkg15.pkg128 import m1795
+import pkg5.pkg46.pkg372.m6209
+from pkg1.pkg10.pkg88 import m1338
+import pkg1.pkg10.pkg81.m497
+from pkg1.pkg9.pkg80 import m79
+import pkg3.pkg31.m30
+from pkg5.pkg47.pkg379 import m2046
+import pkg4.pkg40.m2541
+from pkg1.pkg11.pkg96 import m8435
+
+
+def helper_8751_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
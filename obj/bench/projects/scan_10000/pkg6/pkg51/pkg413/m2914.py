@@ -0,0 +1,52 @@
+"""Module 2914."""
+import pkg1.pkg9.pkg80.m496
+from . import m1246
+import pkg4.pkg35.pkg285.m2369
+from pkg4.pkg35.pkg284 import m1534
+import pkg1.m0
+from pkg5.pkg48.pkg390 import m2474
+import pkg2.pkg22.pkg178.m177
+from pkg3.pkg27.pkg223 import m1056
+import pkg4.pkg34.pkg273.m1523
+
+
+def helper_2914_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2914_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2914_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2914_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_2914_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_2914_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
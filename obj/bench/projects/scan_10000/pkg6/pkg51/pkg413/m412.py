@@ -0,0 +1,19 @@
+"""Module 412."""
+import pkg4.pkg33.pkg270.m269
+from pkg1 import m0
+import pkg7.pkg61.m60
+from pkg2.pkg24.pkg193 import m192
+import pkg1.pkg14.m13
+from pkg5.pkg44.pkg359 import m358
+import pkg7.m6
+from pkg7.pkg60 import m59
+import pkg6.pkg49.pkg397.m396
+from pkg2.pkg18.pkg147 import m146
+import pkg6.pkg50.pkg404.m403
+
+
+def helper_412_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
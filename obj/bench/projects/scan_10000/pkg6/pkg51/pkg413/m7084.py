@@ -0,0 +1,48 @@
+"""Module 7084."""
+from . import m5833
+from pkg1 import m5838
+import pkg3.pkg30.pkg247.m246
+from pkg2.pkg23.pkg191 import m607
+from . import m1663
+from . import m2080
+import pkg1.pkg15.pkg124.m5127
+from pkg3.pkg30 import m446
+import pkg2.pkg21.pkg174.m173
+from . import m4582
+from . import m2914
+from pkg2.pkg23.pkg189 import m3524
+
+
+def helper_7084_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7084_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7084_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7084_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_7084_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
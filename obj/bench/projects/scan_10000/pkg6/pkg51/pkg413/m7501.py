@@ -0,0 +1,18 @@
+"""Module 7501."""
+from . import m3331
+from pkg5.pkg48.pkg392 import m1225
+from . import m2914
+
+
+def helper_7501_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7501_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,24 @@
+"""Module 2081."""
+import pkg4.pkg38.pkg307.m306
+from . import m830
+import pkg5.pkg43.pkg346.m1179
+from pkg1.pkg11.pkg90 import m1340
+import pkg1.pkg16.pkg131.m1798
+from pkg4.pkg33.pkg268 import m684
+import pkg1.pkg14.pkg114.m1364
+from pkg2.pkg24.pkg198 import m197
+import pkg5.pkg45.m44
+
+
+def helper_2081_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2081_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
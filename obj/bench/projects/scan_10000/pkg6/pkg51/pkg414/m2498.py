@@ -0,0 +1,14 @@
+"""Module 2498."""
+import pkg4.pkg34.m450
+from pkg4 import m3
+import pkg5.pkg42.pkg343.m759
+from pkg6.pkg50.pkg406 import m405
+import pkg2.pkg22.m21
+from . import m1247
+
+
+def helper_2498_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
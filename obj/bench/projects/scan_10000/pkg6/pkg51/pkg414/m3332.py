@@ -0,0 +1,18 @@
+"""Module 3332."""
+import pkg5.pkg47.pkg383.m1633
+from . import m830
+import pkg3.pkg29.pkg239.m1489
+
+
+def helper_3332_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3332_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
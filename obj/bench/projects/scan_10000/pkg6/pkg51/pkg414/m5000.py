@@ -0,0 +1,24 @@
+"""Module 5000."""
+import pkg3.pkg27.m26
+from pkg2 import m1
+import pkg2.pkg22.pkg184.m1017
+from pkg4.pkg35.pkg286 import m1119
+import pkg5.pkg44.pkg359.m4945
+from pkg1.pkg16 import m432
+import pkg4.pkg36.pkg294.m1544
+from pkg3.pkg29.pkg237 import m2321
+import pkg5.pkg47.pkg378.m377
+
+
+def helper_5000_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5000_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
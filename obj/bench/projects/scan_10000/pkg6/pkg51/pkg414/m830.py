@@ -0,0 +1,20 @@
+"""Module 830."""
+from . import m413
+from pkg3.pkg29.pkg236 import m235
+import pkg1.pkg10.m9
+from pkg3.pkg31.pkg255 import m254
+import pkg2.pkg23.pkg190.m189
+
+
+def helper_830_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_830_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,54 @@
+"""Module 9587."""
+from . import m9170
+from pkg2.pkg17.pkg139 import m138
+import pkg4.pkg34.pkg280.m1113
+from pkg2.pkg21.pkg169 import m168
+import pkg2.pkg21.pkg174.m1007
+from pkg1.pkg12.pkg103 import m7608
+import pkg5.pkg44.pkg353.m4522
+from pkg6.pkg51.pkg411 import m6665
+import pkg1.pkg12.pkg99.m2600
+from . import m5834
+import pkg2.pkg23.pkg189.m1439
+
+
+def helper_9587_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9587_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9587_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9587_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_9587_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_9587_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,37 @@
+"""Module 2916."""
+import pkg2.pkg19.pkg160.m159
+from . import m831
+from . import m1248
+from pkg2.pkg21.pkg173 import m172
+import pkg1.pkg11.pkg92.m91
+from pkg1.pkg10.pkg81 import m80
+import pkg3.pkg25.pkg206.m2707
+from pkg1.pkg16.pkg132 import m131
+
+
+def helper_2916_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2916_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2916_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2916_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,30 @@
+"""Module 3750."""
+from . import m831
+from pkg5.pkg46 import m2547
+import pkg5.pkg46.pkg372.m2873
+from pkg1.pkg16.pkg132 import m131
+import pkg1.pkg9.pkg76.m75
+from . import m2082
+import pkg4.pkg36.pkg295.m294
+from pkg4.pkg38 import m37
+
+
+def helper_3750_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3750_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3750_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
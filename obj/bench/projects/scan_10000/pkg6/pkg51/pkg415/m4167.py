@@ -0,0 +1,17 @@
+"""Module 4167."""
+import pkg1.m1251
+from pkg2.pkg23.pkg188 import m604
+
+
+def helper_4167_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4167_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
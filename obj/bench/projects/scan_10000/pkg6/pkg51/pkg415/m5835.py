@@ -0,0 +1,30 @@
+"""Module 5835."""
+import pkg5.pkg42.pkg340.m1173
+from pkg5.pkg46.pkg375 import m1625
+import pkg1.pkg12.m3764
+from pkg2.pkg17.pkg138 import m137
+import pkg3.pkg25.pkg204.m1037
+from . import m4167
+import pkg1.m0
+from pkg4.pkg40.pkg325 import m5745
+
+
+def helper_5835_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5835_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5835_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
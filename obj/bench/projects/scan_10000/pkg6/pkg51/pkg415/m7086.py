@@ -0,0 +1,33 @@
+"""Module 7086."""
+import pkg6.pkg54.m53
+from . import m4167
+from . import m6669
+from pkg1.pkg9.pkg80 import m79
+import pkg2.pkg20.pkg166.m165
+from pkg8.pkg69 import m68
+import pkg3.pkg27.m26
+from pkg2.pkg17.pkg141 import m140
+import pkg2.pkg17.pkg144.m2228
+from . import m2082
+import pkg5.pkg46.m1296
+
+
+def helper_7086_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7086_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7086_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,31 @@
+"""Module 7503."""
+from . import m2499
+from pkg5 import m4
+import pkg3.pkg27.pkg224.m3976
+from . import m7086
+import pkg7.pkg64.m480
+from pkg2.pkg19.pkg159 import m992
+import pkg6.pkg50.pkg408.m1241
+from pkg1.pkg10.pkg84 import m4253
+import pkg6.m1673
+
+
+def helper_7503_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7503_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7503_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
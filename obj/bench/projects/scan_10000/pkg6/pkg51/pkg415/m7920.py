@@ -0,0 +1,21 @@
+"""Module 7920."""
+import pkg6.pkg50.pkg408.m4160
+from pkg8.pkg65 import m3817
+import pkg1.pkg15.m14
+from . import m7503
+import pkg4.pkg35.pkg281.m280
+from pkg4.pkg39.pkg316 import m732
+
+
+def helper_7920_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7920_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,45 @@
+"""Module 8337."""
+import pkg2.pkg18.m3353
+from pkg1.pkg9.pkg74 import m490
+import pkg3.pkg28.pkg232.m7737
+from . import m7086
+import pkg3.pkg32.pkg264.m680
+from pkg1 import m0
+import pkg5.pkg46.pkg374.m7462
+from pkg8 import m7
+from . import m6252
+
+
+def helper_8337_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8337_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8337_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8337_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_8337_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
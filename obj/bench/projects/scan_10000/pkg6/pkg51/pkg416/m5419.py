@@ -0,0 +1,22 @@
+"""Module 5419."""
+from . import m415
+from pkg3.pkg28.pkg232 import m648
+import pkg3.pkg32.m2533
+from pkg5.pkg45.pkg365 import m1615
+import pkg3.pkg32.pkg262.m2763
+from . import m4585
+import pkg1.pkg9.pkg73.m906
+
+
+def helper_5419_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5419_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,55 @@
+"""Module 6670."""
+import pkg3.pkg27.pkg220.m219
+from pkg4.pkg39.pkg317 import m3235
+import pkg4.pkg36.m5456
+from . import m2083
+import pkg4.pkg40.pkg323.m1573
+from pkg6.pkg49.pkg399 import m6236
+import pkg5.pkg46.pkg369.m785
+from pkg7.pkg58 import m3810
+import pkg2.pkg19.pkg158.m157
+from pkg6 import m5
+import pkg5.pkg41.pkg329.m1162
+from pkg3.pkg27.pkg222 import m3140
+
+
+def helper_6670_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6670_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6670_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6670_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_6670_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_6670_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 8338."""
+from . import m3334
+from pkg3.pkg26.pkg212 import m211
+import pkg5.m4
+
+
+def helper_8338_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8338_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
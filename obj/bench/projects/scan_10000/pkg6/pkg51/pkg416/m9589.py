@@ -0,0 +1,24 @@
+"""Module 9589."""
+import pkg6.pkg49.m48
+from pkg6.pkg50.pkg402 import m2069
+import pkg5.pkg44.pkg356.m4942
+from pkg1.pkg9.pkg75 import m4244
+import pkg2.pkg18.pkg148.m1398
+from pkg2.pkg20.pkg166 import m8505
+import pkg3.pkg26.pkg213.m1880
+from pkg7.pkg64 import m63
+from . import m6253
+
+
+def helper_9589_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9589_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
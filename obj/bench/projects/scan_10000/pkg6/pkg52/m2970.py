@@ -0,0 +1,3 @@
+"""Module 2970."""
+import pkg5.pkg41.pkg332.m2416
+from pkg5.pkg45.pkg367 import m1200
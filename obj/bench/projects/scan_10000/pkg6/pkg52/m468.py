@@ -0,0 +1,7 @@
+"""Module 468."""
+import pkg6.pkg50.m49
+from pkg4.pkg38.pkg310 import m309
+from . import m51
+from pkg2 import m1
+import pkg1.pkg10.pkg88.m87
+from pkg5.pkg43 import m42
@@ -0,0 +1,37 @@
+"""Module 1667."""
+import pkg2.pkg22.pkg181.m180
+from pkg4.pkg34 import m33
+import pkg5.pkg48.pkg389.m388
+from pkg3.pkg25 import m24
+import pkg5.pkg45.pkg366.m1616
+from pkg3.pkg28.pkg231 import m1481
+from . import m833
+from . import m416
+
+
+def helper_1667_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1667_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1667_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1667_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
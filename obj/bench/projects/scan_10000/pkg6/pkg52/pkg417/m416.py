@@ -0,0 +1,28 @@
+"""Module 416."""
+import pkg3.pkg29.pkg233.m232
+from pkg2.pkg19 import m18
+import pkg2.m1
+from pkg1.pkg9.pkg73 import m72
+import pkg1.pkg14.m13
+from pkg4.pkg34.pkg276 import m275
+
+
+def helper_416_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_416_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_416_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,38 @@
+"""Module 5003."""
+import pkg3.pkg29.m28
+from pkg4.pkg40.pkg328 import m1161
+import pkg2.pkg17.pkg140.m1807
+from pkg1.pkg13.pkg105 import m3857
+import pkg2.pkg19.pkg157.m156
+from . import m2918
+import pkg5.pkg47.m46
+from pkg2.pkg18.pkg151 import m2235
+import pkg4.pkg38.pkg309.m1559
+
+
+def helper_5003_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5003_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5003_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5003_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
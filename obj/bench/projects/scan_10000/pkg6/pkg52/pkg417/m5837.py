@@ -0,0 +1,17 @@
+"""Module 5837."""
+from . import m833
+from pkg3.pkg25.pkg203 import m202
+
+
+def helper_5837_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5837_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,16 @@
+"""Module 7505."""
+import pkg4.pkg39.m4208
+from pkg5.pkg45.pkg367 import m7455
+from . import m3335
+from . import m1250
+import pkg4.pkg38.pkg311.m1144
+from pkg5.pkg47 import m46
+import pkg1.pkg11.pkg91.m1758
+from pkg3.pkg27.pkg217 import m5637
+
+
+def helper_7505_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 833."""
+import pkg2.pkg19.pkg160.m576
+from pkg2 import m1
+import pkg1.m0
+from . import m416
+import pkg6.pkg51.m50
+
+
+def helper_833_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_833_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_833_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,9 @@
+"""Module 9173."""
+import pkg5.m4
+
+
+def helper_9173_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,46 @@
+"""Module 1303."""
+import pkg1.m0
+from pkg2.pkg17.pkg137 import m553
+import pkg4.pkg37.pkg301.m300
+from pkg2.pkg19.pkg154 import m153
+import pkg3.pkg31.m30
+from . import m886
+import pkg2.pkg24.m23
+from pkg1.pkg9.pkg75 import m491
+from . import m52
+from pkg2.pkg23 import m856
+
+
+def helper_1303_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1303_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1303_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1303_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_1303_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
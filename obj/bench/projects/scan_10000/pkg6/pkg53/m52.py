@@ -0,0 +1,32 @@
+"""Module 52."""
+import pkg4.pkg39.m38
+from pkg7 import m6
+import pkg1.pkg13.m12
+from pkg4.pkg34 import m33
+import pkg1.m0
+from pkg5.pkg44 import m43
+import pkg2.m1
+from pkg4.pkg35 import m34
+import pkg3.pkg25.m24
+from pkg1.pkg12 import m11
+
+
+def helper_52_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_52_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_52_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 7141."""
+import pkg1.pkg13.pkg112.m4281
+from pkg1.pkg10.pkg81 import m80
+from . import m4222
+from pkg1 import m0
+import pkg4.pkg36.pkg289.m288
+
+
+def helper_7141_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7141_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7141_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,10 @@
+"""Module 9226."""
+import pkg5.pkg45.m4631
+from pkg5.pkg42.pkg343 import m4512
+
+
+def helper_9226_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
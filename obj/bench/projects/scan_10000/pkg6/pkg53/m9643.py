@@ -0,0 +1,52 @@
+"""Module 9643."""
+import pkg5.pkg46.pkg372.m6209
+from pkg2.pkg18 import m17
+import pkg1.m0
+from pkg5.pkg45 import m2129
+import pkg4.pkg39.pkg315.m314
+from pkg4.pkg36.pkg291 import m707
+import pkg3.pkg25.pkg202.m618
+from pkg4.pkg35.pkg287 import m1120
+import pkg2.pkg22.pkg180.m596
+
+
+def helper_9643_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9643_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9643_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9643_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_9643_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_9643_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,12 @@
+"""Module 1304."""
+from . import m887
+from pkg5.pkg48.pkg390 import m389
+import pkg1.m0
+from pkg2.pkg17.pkg139 import m138
+
+
+def helper_1304_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,31 @@
+"""Module 53."""
+import pkg4.m3
+from pkg3.pkg29 import m28
+import pkg1.pkg16.m15
+from pkg2.pkg23 import m22
+import pkg1.m0
+from pkg4.pkg33 import m32
+import pkg2.pkg22.m21
+from pkg2.pkg21 import m20
+import pkg3.pkg31.m30
+
+
+def helper_53_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_53_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_53_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
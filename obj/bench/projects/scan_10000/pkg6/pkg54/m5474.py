@@ -0,0 +1,47 @@
+"""Module 5474."""
+import pkg2.pkg17.pkg138.m554
+from pkg2.pkg19.pkg157 import m3075
+from . import m53
+from . import m887
+import pkg4.pkg34.pkg277.m4029
+from . import m470
+import pkg3.pkg26.m25
+from pkg1.pkg14 import m2932
+import pkg4.pkg40.pkg328.m744
+from pkg2.pkg18.pkg148 import m2649
+import pkg2.pkg17.pkg141.m140
+
+
+def helper_5474_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5474_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5474_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5474_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_5474_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
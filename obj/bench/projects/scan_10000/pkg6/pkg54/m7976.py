@@ -0,0 +1,53 @@
+"""Module 7976."""
+from . import m2972
+from pkg3.pkg28.pkg229 import m5649
+import pkg3.pkg27.pkg220.m1053
+from . import m7142
+import pkg1.pkg16.pkg135.m134
+from pkg3.pkg25.pkg205 import m3957
+import pkg5.pkg47.pkg377.m1210
+from pkg5.pkg41.pkg332 import m748
+import pkg2.m1
+from pkg1 import m0
+
+
+def helper_7976_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7976_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7976_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7976_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_7976_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_7976_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,31 @@
+"""Module 888."""
+from . import m54
+from pkg3.pkg29.pkg233 import m232
+import pkg5.pkg46.m462
+from pkg1 import m0
+import pkg7.pkg57.m56
+from pkg4.pkg36.pkg290 import m289
+from . import m471
+from pkg5.pkg46.pkg371 import m370
+import pkg1.pkg11.pkg92.m91
+
+
+def helper_888_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_888_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_888_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
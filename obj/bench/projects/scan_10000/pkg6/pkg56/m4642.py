@@ -0,0 +1,30 @@
+"""Module 4642."""
+import pkg2.pkg20.pkg163.m2664
+from pkg6.pkg49.pkg395 import m394
+import pkg3.pkg31.pkg249.m665
+from pkg2.pkg23 import m22
+import pkg5.pkg47.pkg382.m381
+from pkg1.pkg15.pkg126 import m125
+import pkg1.pkg12.pkg98.m97
+from pkg6.pkg51.pkg416 import m832
+
+
+def helper_4642_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4642_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4642_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
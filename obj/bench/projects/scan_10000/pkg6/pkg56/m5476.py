@@ -0,0 +1,39 @@
+"""Module 5476."""
+import pkg7.pkg59.m4645
+from pkg5.pkg48.pkg387 import m4139
+import pkg1.pkg13.pkg108.m107
+from pkg4.pkg34 import m2118
+import pkg3.pkg32.pkg257.m3175
+from pkg4.pkg34.pkg273 import m1106
+import pkg3.pkg32.pkg263.m2347
+from pkg3.pkg29.pkg234 import m1901
+import pkg6.pkg49.m48
+from pkg2.pkg24.pkg200 import m1867
+
+
+def helper_5476_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5476_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5476_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5476_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,10 @@
+"""Module 5893."""
+import pkg2.pkg20.m19
+from pkg4.pkg38.pkg310 import m4479
+
+
+def helper_5893_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,32 @@
+"""Module 7978."""
+import pkg5.pkg47.pkg378.m794
+from pkg6.pkg49.pkg399 import m2066
+import pkg1.m0
+from pkg2.pkg20 import m19
+import pkg4.pkg35.m2119
+from pkg4.pkg35.pkg281 import m1531
+import pkg1.pkg9.pkg78.m494
+from pkg5.pkg44.pkg357 import m356
+from . import m5893
+from pkg5.pkg45.pkg367 import m6204
+
+
+def helper_7978_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7978_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7978_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
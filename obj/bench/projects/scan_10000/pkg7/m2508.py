@@ -0,0 +1,37 @@
+"""Module 2508."""
+import pkg1.pkg12.pkg97.m96
+from pkg3.pkg25.pkg202 import m618
+import pkg2.pkg18.pkg146.m979
+from . import m423
+import pkg3.pkg26.pkg214.m1047
+from pkg1 import m0
+from . import m1674
+from pkg2.pkg24.pkg198 import m197
+
+
+def helper_2508_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2508_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2508_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2508_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
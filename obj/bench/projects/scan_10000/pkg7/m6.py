@@ -0,0 +1,5 @@
+"""Module 6."""
+import pkg2.m1
+from pkg1 import m0
+import pkg6.m5
+from pkg4 import m3
@@ -0,0 +1,8 @@
+"""Module 7512."""
+
+
+def helper_7512_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,45 @@
+"""Module 1724."""
+from . import m56
+from pkg2 import m1
+import pkg5.pkg42.pkg337.m753
+from pkg3.pkg26.pkg214 import m213
+import pkg5.pkg45.pkg364.m363
+from pkg8 import m7
+import pkg1.pkg16.pkg135.m551
+from . import m890
+import pkg3.pkg30.m446
+
+
+def helper_1724_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1724_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1724_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1724_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_1724_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,21 @@
+"""Module 56."""
+import pkg1.pkg9.m8
+from pkg1 import m0
+import pkg6.m5
+from pkg5 import m4
+import pkg4.m3
+from pkg6.pkg54 import m53
+
+
+def helper_56_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_56_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,40 @@
+"""Module 7562."""
+from . import m2141
+from pkg5.pkg46.pkg376 import m1626
+from . import m4643
+from pkg2.pkg23.pkg190 import m5193
+import pkg4.pkg40.pkg322.m6576
+from . import m5477
+import pkg1.pkg9.m8
+from pkg3 import m2
+import pkg4.pkg39.pkg313.m729
+from pkg2.pkg19.pkg154 import m1404
+import pkg5.pkg42.m41
+
+
+def helper_7562_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7562_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7562_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7562_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
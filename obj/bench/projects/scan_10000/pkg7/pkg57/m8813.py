@@ -0,0 +1,13 @@
+"""Module 8813."""
+import pkg4.pkg33.pkg271.m270
+from pkg1.pkg11.pkg95 import m1762
+import pkg4.pkg33.pkg265.m681
+from pkg1.pkg10.pkg86 import m85
+import pkg2.pkg24.pkg193.m2694
+from pkg3.pkg25.pkg202 import m2703
+import pkg8.pkg69.m2987
+from pkg1.pkg16.pkg129 import m545
+import pkg2.pkg23.pkg185.m3937
+from pkg4.pkg40.pkg323 import m3658
+import pkg1.pkg12.pkg97.m1764
+from pkg2.pkg17.pkg141 import m4727
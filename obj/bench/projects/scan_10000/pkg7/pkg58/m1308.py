@@ -0,0 +1,33 @@
+"""Module 1308."""
+import pkg6.pkg52.m51
+from pkg5 import m4
+import pkg1.m0
+from . import m474
+import pkg4.pkg38.pkg305.m1138
+from pkg2.pkg21.pkg170 import m169
+from . import m891
+from pkg3.pkg27.pkg222 import m221
+import pkg1.pkg9.m8
+from pkg1.pkg11.pkg95 import m94
+import pkg4.pkg39.pkg315.m314
+
+
+def helper_1308_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1308_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1308_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,8 @@
+"""Module 474."""
+
+
+def helper_474_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 6312."""
+import pkg3.pkg25.pkg206.m3541
+from pkg1.pkg16.pkg133 import m3468
+import pkg1.pkg12.pkg104.m103
+from pkg3.pkg27.pkg218 import m634
+from . import m474
+from pkg4.pkg36.pkg294 import m1544
+import pkg1.pkg9.m8
+from . import m5478
+import pkg2.pkg20.pkg161.m160
+from pkg1.pkg15 import m14
+import pkg3.pkg30.pkg243.m6080
+from pkg2.pkg22 import m5025
+
+
+def helper_6312_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
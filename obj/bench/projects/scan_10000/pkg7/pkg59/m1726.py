@@ -0,0 +1,40 @@
+"""Module 1726."""
+import pkg1.pkg10.pkg88.m921
+from pkg5.pkg44.pkg359 import m775
+import pkg8.m7
+from pkg2.pkg17.pkg144 import m977
+import pkg2.m1
+from pkg5.pkg44 import m43
+import pkg2.pkg19.pkg153.m152
+from . import m892
+from . import m1309
+from pkg1.pkg10 import m9
+from . import m58
+
+
+def helper_1726_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1726_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1726_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1726_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,39 @@
+"""Module 2560."""
+import pkg2.pkg22.pkg178.m177
+from pkg5.pkg41.pkg331 import m1998
+import pkg5.pkg44.m460
+from pkg7.pkg61 import m60
+import pkg1.pkg12.pkg102.m101
+from pkg3.pkg26 import m2110
+from . import m1726
+from pkg1.pkg13.pkg111 import m110
+from . import m1309
+from pkg2 import m1
+
+
+def helper_2560_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2560_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2560_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2560_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
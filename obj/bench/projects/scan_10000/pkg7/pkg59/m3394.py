@@ -0,0 +1,22 @@
+"""Module 3394."""
+from . import m2143
+from pkg4.pkg33.pkg269 import m685
+import pkg1.pkg10.m1260
+from pkg2.pkg20.pkg165 import m581
+import pkg1.pkg16.pkg131.m2632
+from . import m58
+import pkg5.pkg42.m458
+
+
+def helper_3394_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3394_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,38 @@
+"""Module 475."""
+from . import m58
+from pkg2.pkg22 import m438
+import pkg4.pkg33.m449
+from pkg2.pkg24.pkg198 import m197
+import pkg3.pkg28.m27
+from pkg1 import m0
+import pkg1.pkg10.m9
+from pkg4.pkg34.pkg277 import m276
+import pkg2.m1
+
+
+def helper_475_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_475_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_475_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_475_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
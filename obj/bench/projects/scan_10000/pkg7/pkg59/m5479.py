@@ -0,0 +1,45 @@
+"""Module 5479."""
+import pkg1.pkg13.pkg107.m106
+from pkg6 import m2507
+import pkg1.m0
+from pkg1.pkg10.pkg84 import m500
+import pkg1.pkg16.m15
+from pkg1.pkg10.pkg82 import m2583
+import pkg2.pkg17.m16
+from pkg4.pkg39 import m455
+import pkg1.pkg10.m9
+
+
+def helper_5479_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5479_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5479_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5479_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_5479_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
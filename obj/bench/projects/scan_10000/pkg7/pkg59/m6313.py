@@ -0,0 +1,14 @@
+"""Module 6313."""
+import pkg1.pkg13.pkg106.m1356
+from pkg1 import m0
+import pkg3.pkg27.pkg217.m3552
+from pkg4.pkg39.pkg313 import m3231
+from . import m1726
+from . import m475
+
+
+def helper_6313_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
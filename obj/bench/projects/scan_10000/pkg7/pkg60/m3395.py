@@ -0,0 +1,23 @@
+"""Module 3395."""
+import pkg1.pkg14.pkg113.m112
+from pkg1.pkg14.pkg118 import m117
+from . import m1310
+from pkg4.pkg35 import m2536
+import pkg3.pkg25.pkg206.m1456
+from pkg6.pkg55 import m54
+import pkg7.m423
+from pkg3.pkg31 import m1281
+
+
+def helper_3395_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3395_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
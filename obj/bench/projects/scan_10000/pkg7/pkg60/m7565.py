@@ -0,0 +1,55 @@
+"""Module 7565."""
+import pkg1.pkg16.m7104
+from pkg3.pkg29.pkg238 import m237
+import pkg5.m4
+from . import m893
+import pkg2.pkg18.pkg147.m3899
+from pkg1.pkg15.pkg121 import m120
+import pkg6.pkg50.m5053
+from pkg1.pkg9.pkg77 import m493
+import pkg1.pkg12.m11
+from pkg1.pkg15.pkg125 import m124
+import pkg5.pkg44.pkg356.m4942
+from . import m59
+
+
+def helper_7565_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7565_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7565_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7565_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_7565_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_7565_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
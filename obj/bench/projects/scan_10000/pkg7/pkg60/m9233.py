@@ -0,0 +1,17 @@
+"""Module 9233."""
+import pkg5.pkg45.pkg364.m2031
+from . import m8399
+
+
+def helper_9233_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9233_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 1311."""
+import pkg2.pkg23.pkg192.m191
+from pkg2.pkg20.pkg167 import m583
+from . import m894
+from pkg3.pkg27.pkg221 import m1054
+
+
+def helper_1311_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1311_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1311_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,38 @@
+"""Module 3813."""
+import pkg5.pkg41.pkg335.m334
+from pkg7.pkg57 import m56
+from . import m477
+from pkg2.pkg24.pkg195 import m1028
+import pkg1.pkg16.pkg131.m130
+from pkg1.pkg14.pkg115 import m1782
+import pkg3.pkg28.pkg225.m3560
+from . import m1311
+import pkg7.m6
+
+
+def helper_3813_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3813_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3813_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3813_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
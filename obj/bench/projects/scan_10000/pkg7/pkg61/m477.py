@@ -0,0 +1,20 @@
+"""Module 477."""
+import pkg1.m0
+from pkg2.pkg23.pkg185 import m184
+from . import m60
+from pkg4 import m3
+import pkg1.pkg10.m9
+
+
+def helper_477_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_477_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,13 @@
+"""Module 894."""
+import pkg3.pkg31.m864
+from pkg5.pkg48 import m47
+import pkg6.pkg56.m55
+from pkg2 import m1
+import pkg3.pkg25.pkg204.m203
+
+
+def helper_894_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
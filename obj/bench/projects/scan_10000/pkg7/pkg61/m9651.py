@@ -0,0 +1,17 @@
+"""Module 9651."""
+import pkg2.pkg20.pkg166.m999
+from pkg4.pkg38 import m37
+
+
+def helper_9651_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9651_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,38 @@
+"""Module 5899."""
+import pkg1.pkg11.pkg94.m93
+from pkg7 import m6
+import pkg1.pkg11.m10
+from pkg2.pkg21.pkg175 import m174
+import pkg7.pkg59.m58
+from pkg1.pkg11.pkg96 import m929
+import pkg5.pkg43.pkg350.m2434
+from pkg2.pkg18.pkg147 import m146
+from . import m3397
+
+
+def helper_5899_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5899_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5899_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5899_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
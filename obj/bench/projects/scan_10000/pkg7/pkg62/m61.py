@@ -0,0 +1,30 @@
+"""Module 61."""
+import pkg5.m4
+from pkg2.pkg19 import m18
+import pkg2.m1
+from pkg1 import m0
+import pkg3.pkg31.m30
+from pkg4.pkg38 import m37
+import pkg5.pkg46.m45
+from pkg3.pkg28 import m27
+
+
+def helper_61_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_61_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_61_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,33 @@
+"""Module 6316."""
+import pkg6.pkg51.pkg412.m1245
+from pkg5.pkg41.pkg333 import m332
+import pkg3.pkg27.m26
+from pkg2.pkg19.pkg155 import m571
+import pkg2.m1
+from . import m478
+import pkg2.pkg23.pkg188.m187
+from . import m3397
+import pkg5.pkg41.pkg330.m746
+from . import m61
+import pkg2.pkg23.m3775
+
+
+def helper_6316_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6316_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6316_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
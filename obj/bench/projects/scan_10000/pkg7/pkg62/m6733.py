@@ -0,0 +1,36 @@
+"""Module 6733."""
+import pkg7.pkg60.m59
+from . import m4231
+import pkg3.pkg25.pkg207.m1040
+from pkg3.pkg29.pkg233 import m3568
+import pkg7.pkg63.m2564
+from pkg2.pkg18.pkg149 import m2233
+import pkg4.m2505
+
+
+def helper_6733_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6733_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6733_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6733_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,15 @@
+"""Module 1313."""
+import pkg3.pkg31.pkg250.m1083
+from pkg4.pkg37 import m36
+import pkg4.m420
+from pkg1.pkg14 import m13
+import pkg1.m0
+from pkg3.pkg32 import m448
+import pkg6.pkg49.m48
+
+
+def helper_1313_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
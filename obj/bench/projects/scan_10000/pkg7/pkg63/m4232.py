@@ -0,0 +1,28 @@
+"""Module 4232."""
+import pkg1.m0
+from pkg2 import m1
+import pkg1.pkg13.pkg111.m110
+from pkg3.pkg30 import m29
+import pkg4.pkg38.pkg306.m722
+from pkg4.pkg34 import m33
+
+
+def helper_4232_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4232_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4232_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
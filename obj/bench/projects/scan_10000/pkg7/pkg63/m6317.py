@@ -0,0 +1,31 @@
+"""Module 6317."""
+import pkg5.pkg42.pkg344.m343
+from pkg6.pkg51 import m2135
+from . import m5066
+from pkg5.pkg47.pkg382 import m2049
+import pkg4.pkg38.pkg312.m1145
+from . import m3815
+from . import m896
+from pkg3.pkg27.pkg219 import m1052
+from . import m4232
+
+
+def helper_6317_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6317_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6317_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 7151."""
+import pkg2.pkg20.pkg166.m6837
+from . import m3815
+
+
+def helper_7151_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7151_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
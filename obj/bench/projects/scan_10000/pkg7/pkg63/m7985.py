@@ -0,0 +1,35 @@
+"""Module 7985."""
+import pkg2.pkg23.pkg188.m604
+from pkg1.pkg15.pkg123 import m5960
+import pkg6.pkg49.pkg400.m816
+from pkg3.pkg31.pkg255 import m3590
+import pkg5.pkg45.pkg361.m4113
+from pkg4.pkg40.pkg325 import m1158
+
+
+def helper_7985_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7985_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7985_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7985_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
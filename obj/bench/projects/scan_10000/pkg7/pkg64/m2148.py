@@ -0,0 +1,19 @@
+"""Module 2148."""
+import pkg5.pkg47.m1714
+from pkg8.pkg67 import m483
+import pkg1.pkg9.pkg75.m74
+from pkg1.pkg16 import m15
+import pkg7.pkg62.m61
+from pkg5.pkg41.pkg331 import m1164
+import pkg1.m0
+from pkg1.pkg13.pkg108 import m1358
+import pkg2.m835
+from . import m897
+from . import m63
+
+
+def helper_2148_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
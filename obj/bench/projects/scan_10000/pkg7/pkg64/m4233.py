@@ -0,0 +1,54 @@
+"""Module 4233."""
+import pkg1.m0
+from pkg5.pkg44 import m460
+from . import m3816
+from pkg7.pkg63 import m62
+import pkg2.pkg23.pkg192.m191
+from pkg4.pkg33.pkg271 import m1938
+import pkg6.pkg50.m49
+from pkg1.pkg11.pkg92 import m91
+import pkg3.pkg32.pkg264.m1514
+from . import m2982
+import pkg4.pkg38.pkg311.m1144
+
+
+def helper_4233_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4233_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4233_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4233_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_4233_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_4233_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,47 @@
+"""Module 5067."""
+from . import m2148
+from pkg4.pkg40.pkg328 import m327
+import pkg1.pkg13.m12
+from . import m2565
+import pkg1.pkg14.pkg117.m1367
+from pkg3.pkg29.pkg236 import m3154
+import pkg2.pkg21.pkg174.m3509
+from pkg3.pkg32.pkg259 import m1092
+import pkg5.pkg42.pkg339.m4091
+from pkg5.pkg48.pkg389 import m388
+import pkg7.m6
+
+
+def helper_5067_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5067_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5067_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5067_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_5067_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
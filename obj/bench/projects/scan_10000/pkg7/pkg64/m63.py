@@ -0,0 +1,31 @@
+"""Module 63."""
+import pkg1.m0
+from pkg6.pkg50 import m49
+import pkg5.m4
+from pkg3 import m2
+import pkg1.pkg10.m9
+from pkg5.pkg44 import m43
+import pkg6.m5
+from pkg4.pkg36 import m35
+import pkg5.pkg47.m46
+
+
+def helper_63_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_63_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_63_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,33 @@
+"""Module 6735."""
+import pkg2.pkg17.m16
+from pkg4.pkg37 import m36
+import pkg7.m6
+from . import m480
+from . import m2982
+from pkg6 import m5
+import pkg4.pkg40.pkg323.m2407
+from pkg2.pkg21.pkg172 import m2673
+from . import m4650
+from pkg4.pkg35.pkg284 import m1117
+import pkg3.pkg25.m3777
+
+
+def helper_6735_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6735_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6735_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 1258."""
+import pkg1.pkg10.m9
+from pkg1 import m0
+import pkg7.pkg60.m59
+
+
+def helper_1258_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
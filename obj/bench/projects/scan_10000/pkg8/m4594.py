@@ -0,0 +1,13 @@
+"""Module 4594."""
+import pkg3.pkg30.pkg248.m3166
+from . import m424
+import pkg1.pkg13.pkg112.m111
+from pkg6.pkg51.pkg415 import m2082
+import pkg1.pkg15.pkg122.m538
+from pkg3.pkg27.pkg219 import m218
+import pkg7.pkg64.m897
+from pkg4.pkg38.pkg307 import m2808
+import pkg6.pkg50.pkg402.m2069
+from . import m7
+from . import m4177
+from . import m2926
@@ -0,0 +1,40 @@
+"""Module 841."""
+import pkg2.m1
+from . import m424
+import pkg4.pkg39.pkg316.m732
+from pkg3.pkg29.pkg240 import m656
+import pkg1.m0
+from pkg1.pkg15 import m14
+import pkg2.pkg18.m17
+from pkg5.pkg44.pkg359 import m358
+import pkg2.pkg23.pkg186.m185
+from pkg5.pkg43 import m42
+import pkg2.pkg23.pkg192.m191
+
+
+def helper_841_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_841_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_841_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_841_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
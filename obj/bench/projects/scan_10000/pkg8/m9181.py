@@ -0,0 +1,48 @@
+"""Module 9181."""
+import pkg5.pkg47.pkg381.m5801
+from . import m4594
+import pkg1.pkg11.pkg96.m95
+from . import m2509
+import pkg1.pkg10.pkg81.m1748
+from . import m7930
+from . import m8347
+from pkg4.pkg38 import m37
+import pkg1.pkg16.pkg130.m8469
+from pkg1.pkg13.pkg105 import m104
+import pkg3.pkg32.pkg257.m6511
+from pkg5.pkg44.pkg353 import m352
+
+
+def helper_9181_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9181_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9181_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9181_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_9181_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 9598."""
+from . import m4594
+from . import m5428
+import pkg5.pkg48.pkg392.m808
+from . import m7
+import pkg1.pkg10.pkg83.m4252
+from pkg3 import m2
+from . import m1258
+from pkg5.pkg48 import m1298
+from . import m9181
+from pkg3.pkg29.pkg237 import m3572
+
+
+def helper_9598_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,31 @@
+"""Module 1315."""
+from . import m64
+from pkg6.pkg50.pkg402 import m818
+import pkg1.pkg14.m13
+from pkg5.pkg43.pkg346 import m1179
+from . import m481
+from pkg4.pkg35.pkg281 import m280
+import pkg5.m4
+from pkg1.pkg14.pkg114 import m530
+import pkg3.pkg29.pkg239.m655
+
+
+def helper_1315_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1315_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1315_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
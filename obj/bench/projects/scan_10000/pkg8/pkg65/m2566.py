@@ -0,0 +1,13 @@
+"""Module 2566."""
+from . import m2149
+from pkg1.pkg11.pkg92 import m91
+from . import m1315
+from pkg8 import m7
+import pkg7.pkg62.m61
+
+
+def helper_2566_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
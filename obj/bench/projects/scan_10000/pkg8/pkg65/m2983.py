@@ -0,0 +1,13 @@
+"""Module 2983."""
+import pkg4.pkg37.pkg299.m715
+from pkg2 import m1
+import pkg5.pkg48.pkg386.m385
+from pkg1.pkg12 import m11
+import pkg1.m0
+
+
+def helper_2983_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
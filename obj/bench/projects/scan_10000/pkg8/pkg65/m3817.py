@@ -0,0 +1,61 @@
+"""Module 3817."""
+import pkg1.pkg10.pkg86.m85
+from pkg4.pkg33.pkg267 import m266
+import pkg1.pkg12.pkg104.m1771
+from pkg5.pkg45.pkg363 import m3281
+import pkg1.m0
+from pkg2.pkg18 import m17
+from . import m1732
+from pkg3.pkg28.pkg229 import m228
+import pkg2.pkg17.pkg141.m2225
+from pkg6 import m5
+import pkg2.pkg18.pkg152.m568
+
+
+def helper_3817_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3817_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3817_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3817_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_3817_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_3817_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3817_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
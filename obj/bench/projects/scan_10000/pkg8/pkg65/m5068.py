@@ -0,0 +1,62 @@
+"""Module 5068."""
+import pkg1.pkg15.pkg123.m956
+from . import m1732
+import pkg2.pkg22.pkg181.m180
+from . import m3400
+import pkg6.pkg51.pkg415.m2916
+from pkg4.pkg39.pkg320 import m319
+from . import m3817
+from pkg6.pkg51.pkg416 import m415
+import pkg4.pkg34.pkg276.m692
+from pkg1.pkg9.pkg75 import m74
+import pkg2.pkg17.pkg143.m559
+from pkg1.pkg11.pkg89 import m922
+
+
+def helper_5068_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5068_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5068_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5068_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_5068_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_5068_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5068_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 5902."""
+import pkg5.pkg45.pkg361.m2028
+from . import m3400
+import pkg3.pkg27.pkg223.m4392
+from pkg8.pkg69 import m68
+import pkg5.pkg43.pkg352.m351
+
+
+def helper_5902_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5902_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,23 @@
+"""Module 3401."""
+import pkg4.m3
+from pkg3.pkg27.pkg224 import m1057
+import pkg2.pkg23.m22
+from pkg5.pkg45 import m878
+from . import m899
+from pkg1.pkg9.pkg73 import m72
+import pkg2.pkg20.pkg167.m583
+from pkg1 import m0
+
+
+def helper_3401_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3401_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
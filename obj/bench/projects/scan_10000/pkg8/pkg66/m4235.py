@@ -0,0 +1,20 @@
+"""Module 4235."""
+import pkg2.m1
+from pkg5.pkg48.pkg390 import m389
+import pkg2.pkg20.pkg163.m996
+from pkg5.pkg42.pkg338 import m1588
+import pkg1.pkg11.pkg92.m1759
+from . import m482
+from . import m2150
+from pkg2.pkg22.pkg178 import m177
+import pkg5.m4
+from pkg7.pkg61 import m477
+import pkg3.pkg29.pkg237.m3572
+from pkg2.pkg21.pkg175 import m1425
+
+
+def helper_4235_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,6 @@
+"""Module 899."""
+import pkg5.pkg46.pkg369.m368
+from . import m482
+import pkg4.m3
+from pkg1 import m0
+import pkg4.pkg33.pkg268.m267
@@ -0,0 +1,52 @@
+"""Module 6738."""
+import pkg1.pkg14.pkg119.m1369
+from pkg4.pkg39.pkg316 import m4485
+import pkg2.pkg24.pkg196.m4365
+from pkg2.pkg17.pkg137 import m553
+import pkg3.pkg28.pkg232.m648
+from pkg6.pkg54 import m470
+import pkg6.pkg50.pkg401.m4153
+from pkg3.pkg30.pkg248 import m5668
+import pkg5.pkg45.pkg367.m6204
+
+
+def helper_6738_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6738_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6738_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6738_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_6738_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_6738_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
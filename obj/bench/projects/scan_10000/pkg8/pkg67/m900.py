@@ -0,0 +1,11 @@
+"""Module 900."""
+import pkg5.m421
+from pkg1 import m0
+import pkg2.pkg18.pkg145.m144
+
+
+def helper_900_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,62 @@
+"""Module 2152."""
+import pkg4.pkg39.m872
+from pkg1.pkg15.pkg127 import m960
+import pkg1.pkg10.pkg81.m914
+from pkg3.pkg31.pkg255 import m671
+import pkg6.pkg52.m51
+from pkg4.pkg40.pkg323 import m739
+import pkg5.pkg48.m47
+from . import m1318
+import pkg2.pkg23.pkg189.m1856
+from pkg8.pkg70 import m903
+import pkg1.pkg15.pkg122.m1372
+from pkg4.pkg40.pkg321 import m1154
+
+
+def helper_2152_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2152_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2152_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2152_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_2152_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_2152_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2152_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
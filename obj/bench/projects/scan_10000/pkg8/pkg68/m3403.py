@@ -0,0 +1,14 @@
+"""Module 3403."""
+from . import m484
+from pkg3.pkg29.pkg240 import m239
+import pkg1.m0
+from pkg2.pkg21.pkg175 import m591
+import pkg6.pkg51.pkg411.m410
+from . import m1318
+
+
+def helper_3403_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
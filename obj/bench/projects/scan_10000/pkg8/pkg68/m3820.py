@@ -0,0 +1,46 @@
+"""Module 3820."""
+import pkg1.pkg9.pkg74.m73
+from pkg2.pkg22.pkg178 import m2679
+import pkg3.pkg31.pkg256.m1923
+from pkg3.pkg26.pkg214 import m630
+import pkg5.pkg41.m1708
+from pkg4.pkg36.pkg296 import m295
+import pkg5.pkg48.m3800
+from pkg4.pkg35.pkg285 import m284
+from . import m67
+from pkg4.pkg40.pkg325 import m1158
+
+
+def helper_3820_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3820_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3820_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3820_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_3820_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
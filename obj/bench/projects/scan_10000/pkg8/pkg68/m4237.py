@@ -0,0 +1,39 @@
+"""Module 4237."""
+from . import m3403
+from pkg2.pkg21.pkg173 import m2674
+import pkg2.m1
+from pkg4.pkg39.pkg317 import m316
+import pkg5.pkg46.pkg372.m3290
+from pkg6.pkg50 import m49
+from . import m2986
+from pkg1.pkg12.pkg104 import m1354
+import pkg4.pkg35.m2953
+from . import m2569
+
+
+def helper_4237_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4237_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4237_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4237_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,8 @@
+"""Module 8407."""
+
+
+def helper_8407_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
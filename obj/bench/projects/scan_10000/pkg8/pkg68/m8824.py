@@ -0,0 +1,60 @@
+"""Module 8824."""
+import pkg2.pkg20.m19
+from pkg1.pkg10.pkg81 import m80
+import pkg4.pkg34.pkg276.m692
+from pkg3.pkg28.pkg227 import m2311
+import pkg1.pkg11.pkg92.m91
+from pkg4.pkg33.pkg265 import m1098
+import pkg4.pkg34.pkg280.m2781
+from pkg1.pkg15.pkg123 import m956
+import pkg2.pkg18.pkg145.m144
+from pkg4.pkg37.pkg303 import m302
+
+
+def helper_8824_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8824_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8824_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8824_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_8824_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_8824_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8824_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 901."""
+import pkg1.pkg11.pkg93.m509
+from . import m484
+import pkg1.pkg11.m10
+from pkg4 import m3
+import pkg2.pkg18.pkg147.m146
+from pkg6 import m5
+import pkg4.pkg33.pkg265.m681
+from pkg5.pkg46.pkg374 import m373
+import pkg2.pkg24.pkg199.m198
+from . import m67
+import pkg2.pkg23.m22
+
+
+def helper_901_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_901_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
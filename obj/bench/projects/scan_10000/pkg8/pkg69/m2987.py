@@ -0,0 +1,15 @@
+"""Module 2987."""
+import pkg1.m0
+from pkg2.pkg18.pkg146 import m145
+import pkg4.pkg35.pkg286.m702
+from pkg3.pkg25.pkg207 import m206
+import pkg6.pkg50.m1300
+from pkg2.pkg23 import m439
+import pkg3.pkg27.pkg222.m1055
+
+
+def helper_2987_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
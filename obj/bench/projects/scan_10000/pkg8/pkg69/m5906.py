@@ -0,0 +1,23 @@
+"""Module 5906."""
+import pkg1.pkg14.pkg118.m117
+from pkg1.pkg10.pkg88 import m87
+import pkg2.pkg20.pkg165.m164
+from pkg4.pkg37 import m36
+import pkg8.pkg71.m4657
+from . import m4238
+import pkg3.pkg27.pkg221.m1471
+from pkg3.pkg27.pkg224 import m223
+
+
+def helper_5906_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5906_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
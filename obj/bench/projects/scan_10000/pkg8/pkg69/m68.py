@@ -0,0 +1,37 @@
+"""Module 68."""
+import pkg5.pkg45.m44
+from pkg7.pkg64 import m63
+import pkg2.pkg20.m19
+from pkg5 import m4
+import pkg1.m0
+from pkg1.pkg14 import m13
+import pkg3.pkg31.m30
+from pkg3.pkg27 import m26
+
+
+def helper_68_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_68_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_68_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_68_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
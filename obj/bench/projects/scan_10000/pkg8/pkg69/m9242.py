@@ -0,0 +1,39 @@
+"""Module 9242."""
+from . import m485
+from . import m3821
+import pkg1.pkg11.pkg91.m3009
+from pkg5.pkg42.pkg340 import m2841
+import pkg1.pkg10.pkg86.m85
+from pkg2.pkg19.pkg153 import m152
+import pkg5.pkg44.m2545
+from pkg3.pkg26.pkg214 import m4383
+import pkg7.pkg62.m7567
+from pkg1 import m0
+
+
+def helper_9242_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9242_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9242_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_9242_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
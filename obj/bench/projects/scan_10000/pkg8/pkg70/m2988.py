@@ -0,0 +1,9 @@
+"""Module 2988."""
+import pkg5.pkg41.pkg329.m1579
+
+
+def helper_2988_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
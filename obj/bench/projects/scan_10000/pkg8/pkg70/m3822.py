@@ -0,0 +1,43 @@
+"""Module 3822."""
+import pkg3.pkg29.pkg234.m1067
+from pkg5.pkg41.pkg336 import m2420
+import pkg5.pkg47.m46
+from pkg8.pkg69 import m68
+import pkg3.pkg32.m1699
+from pkg4.pkg37.pkg297 import m713
+import pkg4.pkg36.pkg289.m1122
+
+
+def helper_3822_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3822_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3822_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3822_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_3822_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
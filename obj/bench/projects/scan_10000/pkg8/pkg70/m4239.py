@@ -0,0 +1,25 @@
+"""Module 4239."""
+import pkg1.pkg13.pkg106.m522
+from pkg1.pkg15.pkg125 import m124
+import pkg5.pkg41.pkg334.m333
+
+
+def helper_4239_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4239_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4239_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
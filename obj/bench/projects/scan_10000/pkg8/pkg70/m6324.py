@@ -0,0 +1,10 @@
+"""Module 6324."""
+import pkg6.pkg50.pkg405.m4574
+from pkg4.pkg38 import m5875
+
+
+def helper_6324_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
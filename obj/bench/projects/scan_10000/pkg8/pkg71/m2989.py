@@ -0,0 +1,9 @@
+"""Module 2989."""
+import pkg1.pkg14.pkg117.m1784
+
+
+def helper_2989_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,7 @@
+"""Module 7576."""
+import pkg3.pkg25.pkg202.m201
+from pkg5.pkg47.pkg377 import m1210
+from . import m2572
+from . import m70
+import pkg6.pkg50.pkg402.m401
+from pkg1.pkg9.pkg80 import m79
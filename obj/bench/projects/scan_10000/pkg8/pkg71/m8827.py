@@ -0,0 +1,36 @@
+"""Module 8827."""
+import pkg3.pkg31.m8787
+from pkg4.pkg40.pkg321 import m5741
+import pkg2.pkg24.pkg193.m4362
+from pkg5.pkg43.pkg350 import m2017
+import pkg1.m417
+from pkg5.pkg44.pkg355 import m771
+import pkg6.pkg49.pkg400.m5403
+
+
+def helper_8827_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8827_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8827_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8827_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,28 @@
+"""Module 9661."""
+import pkg5.pkg42.pkg341.m340
+from pkg5.pkg43.pkg348 import m1598
+import pkg7.pkg60.m7565
+from pkg3.pkg26.pkg212 import m6049
+from . import m4657
+from pkg2.pkg22.pkg183 import m6437
+
+
+def helper_9661_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_9661_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_9661_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,33 @@
+"""Module 1739."""
+import pkg6.pkg51.pkg412.m1245
+from . import m71
+import pkg3.pkg30.m1280
+from pkg3.pkg30.pkg242 import m658
+from . import m1322
+from pkg3.pkg25 import m24
+import pkg2.pkg21.pkg175.m174
+from pkg6 import m5
+import pkg5.pkg45.m44
+from pkg5.pkg44.pkg356 import m355
+import pkg1.pkg9.pkg79.m78
+
+
+def helper_1739_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1739_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1739_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 3824."""
+import pkg4.pkg34.pkg280.m1530
+from pkg4.pkg33 import m2951
+import pkg1.pkg16.pkg131.m547
+from pkg1.pkg10 import m9
+import pkg5.pkg41.pkg329.m328
+
+
+def helper_3824_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3824_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,40 @@
+"""Module 7577."""
+import pkg1.m0
+from . import m3824
+import pkg5.pkg46.pkg369.m368
+from pkg2.pkg24.pkg195 import m194
+import pkg3.pkg26.pkg210.m1460
+from . import m5909
+import pkg1.pkg12.pkg99.m2600
+from pkg4.pkg36.pkg289 import m705
+import pkg5.pkg41.pkg333.m2834
+from pkg4.pkg39.pkg319 import m4071
+import pkg5.pkg47.pkg377.m793
+
+
+def helper_7577_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7577_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7577_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7577_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,7 @@
+"""Module 9662."""
+from . import m7160
+from pkg1.pkg13.pkg107 import m106
+import pkg1.pkg14.pkg119.m118
+from pkg1 import m0
+from . import m2990
+from pkg8.pkg68 import m901
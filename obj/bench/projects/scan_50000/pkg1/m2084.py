@@ -0,0 +1,6 @@
+"""Module 2084."""
+from . import m0
+from pkg2 import m1
+import pkg5.pkg76.m75
+from pkg5.pkg77 import m76
+import pkg3.pkg44.pkg579.m578
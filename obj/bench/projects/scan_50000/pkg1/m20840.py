@@ -0,0 +1,53 @@
+"""Module 20840."""
+from . import m12504
+from pkg2.pkg38.pkg504 import m13007
+from . import m0
+from pkg7.pkg94.pkg1231 import m7482
+import pkg10.pkg142.pkg1856.m1855
+from pkg1.pkg16.pkg211 import m210
+from . import m8336
+from pkg1.pkg21.pkg276 import m8611
+import pkg7.pkg97.pkg1273.m3356
+from pkg10.pkg136.pkg1774 import m10109
+
+
+def helper_20840_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_20840_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_20840_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_20840_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_20840_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_20840_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
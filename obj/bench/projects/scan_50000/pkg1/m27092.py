@@ -0,0 +1,43 @@
+"""Module 27092."""
+import pkg1.pkg25.pkg338.m2421
+from pkg10.pkg134.pkg1745 import m7996
+from . import m0
+from pkg10.pkg141 import m140
+import pkg2.pkg28.pkg376.m375
+from pkg3.pkg44.pkg576 import m6827
+import pkg11.pkg153.pkg2002.m4085
+
+
+def helper_27092_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_27092_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_27092_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_27092_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_27092_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,35 @@
+"""Module 33344."""
+from . import m18756
+from pkg5.pkg71.pkg931 import m25938
+import pkg5.pkg72.pkg940.m5107
+from . import m0
+import pkg4.pkg54.pkg706.m705
+from pkg7.pkg98.pkg1285 import m5452
+
+
+def helper_33344_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_33344_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_33344_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_33344_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
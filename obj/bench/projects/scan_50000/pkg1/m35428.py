@@ -0,0 +1,44 @@
+"""Module 35428."""
+import pkg11.pkg149.m148
+from . import m31260
+import pkg3.pkg44.pkg579.m15166
+from . import m4168
+from . import m6252
+from pkg3.pkg44.pkg573 import m19328
+import pkg8.pkg110.pkg1432.m30607
+from pkg1.pkg21 import m20
+
+
+def helper_35428_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35428_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_35428_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_35428_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_35428_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
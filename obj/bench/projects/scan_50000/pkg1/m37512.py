@@ -0,0 +1,54 @@
+"""Module 37512."""
+import pkg3.m2
+from pkg1.pkg25.pkg337 import m25344
+import pkg9.pkg126.pkg1651.m32910
+from pkg2.pkg39 import m22962
+import pkg3.pkg46.pkg603.m602
+from . import m2084
+import pkg5.pkg74.pkg964.m19719
+from pkg6.pkg83.pkg1081 import m1080
+import pkg2.pkg37.pkg483.m12986
+from pkg12.pkg163 import m33506
+import pkg7.m6
+
+
+def helper_37512_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37512_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_37512_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_37512_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_37512_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_37512_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
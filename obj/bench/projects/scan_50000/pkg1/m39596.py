@@ -0,0 +1,25 @@
+"""Module 39596."""
+import pkg4.pkg56.pkg730.m38241
+from pkg11.pkg146.pkg1901 import m22740
+import pkg4.pkg61.m60
+from . import m29176
+from . import m0
+from pkg1.pkg21.pkg279 import m278
+import pkg5.pkg75.pkg980.m9315
+from pkg7.pkg102 import m101
+import pkg9.pkg118.pkg1539.m14042
+from . import m2084
+
+
+def helper_39596_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39596_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,52 @@
+"""Module 41680."""
+import pkg8.pkg108.pkg1417.m7668
+from pkg2.pkg30.pkg391 import m390
+import pkg4.pkg64.pkg835.m13338
+from pkg5.pkg71.pkg926 import m7177
+import pkg8.pkg115.pkg1501.m36928
+from . import m0
+from . import m8336
+from . import m16672
+import pkg7.pkg94.pkg1227.m11646
+
+
+def helper_41680_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_41680_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_41680_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_41680_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_41680_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_41680_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,14 @@
+"""Module 47932."""
+import pkg8.pkg109.m4276
+from . import m18756
+import pkg3.pkg50.pkg656.m2739
+from pkg2.pkg27.pkg352 import m2435
+import pkg12.pkg157.pkg2043.m2042
+from pkg8.pkg108.pkg1412 import m1411
+
+
+def helper_47932_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,8 @@
+"""Module 6252."""
+import pkg10.pkg140.m139
+from pkg10.pkg141.pkg1835 import m1834
+from . import m4168
+from pkg10 import m9
+import pkg8.pkg110.pkg1434.m3517
+from . import m0
+import pkg11.pkg145.pkg1896.m1895
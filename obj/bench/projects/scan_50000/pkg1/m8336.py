@@ -0,0 +1,38 @@
+"""Module 8336."""
+from . import m6252
+from pkg12.pkg157.pkg2054 import m6221
+import pkg13.pkg179.m178
+from . import m0
+import pkg1.pkg15.m14
+from pkg9.pkg120.pkg1568 import m3651
+import pkg2.pkg35.m6286
+from pkg3.pkg42.pkg558 import m6809
+import pkg4.pkg55.m54
+
+
+def helper_8336_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8336_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8336_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8336_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
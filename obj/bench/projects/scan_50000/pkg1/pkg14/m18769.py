@@ -0,0 +1,46 @@
+"""Module 18769."""
+from . import m2097
+from pkg8.pkg106.pkg1380 import m5547
+import pkg1.pkg23.pkg300.m299
+from pkg1.pkg24.pkg322 import m4489
+from . import m6265
+from pkg7 import m6
+from . import m10433
+from pkg8.pkg110.pkg1443 import m1442
+import pkg2.m1
+from . import m12517
+
+
+def helper_18769_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_18769_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_18769_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_18769_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_18769_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
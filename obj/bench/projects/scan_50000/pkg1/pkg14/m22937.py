@@ -0,0 +1,46 @@
+"""Module 22937."""
+import pkg4.pkg64.pkg834.m2917
+from . import m20853
+from . import m16685
+from pkg6.pkg81.pkg1064 import m3147
+import pkg8.pkg116.pkg1520.m1519
+from pkg4.pkg53.pkg691 import m15278
+import pkg7.pkg100.pkg1308.m1307
+from pkg8.pkg113.pkg1479 import m13982
+import pkg10.pkg141.pkg1844.m1843
+from pkg1.pkg20 import m19
+
+
+def helper_22937_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_22937_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_22937_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_22937_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_22937_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
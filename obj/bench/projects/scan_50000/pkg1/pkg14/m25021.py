@@ -0,0 +1,9 @@
+"""Module 25021."""
+import pkg6.pkg85.pkg1107.m11526
+
+
+def helper_25021_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
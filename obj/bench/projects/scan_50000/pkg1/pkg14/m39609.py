@@ -0,0 +1,43 @@
+"""Module 39609."""
+import pkg7.m6
+from pkg2.pkg39 import m18794
+import pkg1.pkg24.m23
+from pkg1.pkg18.pkg246 import m29421
+import pkg1.pkg19.m18
+from pkg7.pkg99.pkg1298 import m38809
+import pkg9.pkg127.pkg1658.m28749
+
+
+def helper_39609_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39609_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_39609_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_39609_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_39609_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
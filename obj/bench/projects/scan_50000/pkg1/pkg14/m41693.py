@@ -0,0 +1,34 @@
+"""Module 41693."""
+import pkg3.pkg41.pkg544.m23467
+from pkg9.pkg126.pkg1640 import m9975
+import pkg11.pkg151.pkg1967.m4050
+from pkg6.pkg88.pkg1156 import m19911
+import pkg6.m5
+
+
+def helper_41693_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_41693_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_41693_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_41693_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 25190."""
+import pkg4.pkg58.pkg763.m762
+from . import m16854
+import pkg6.pkg82.pkg1073.m1072
+from pkg1 import m0
+import pkg2.m1
+from pkg8.pkg114.pkg1495 import m1494
+import pkg9.pkg129.pkg1686.m10021
+from pkg3.pkg44.pkg581 import m23504
+import pkg8.pkg106.pkg1388.m1387
+from pkg5.pkg71 import m70
+
+
+def helper_25190_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_25190_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
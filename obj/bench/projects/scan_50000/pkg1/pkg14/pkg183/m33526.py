@@ -0,0 +1,51 @@
+"""Module 33526."""
+import pkg3.pkg48.pkg635.m15222
+from pkg5.pkg69.pkg910 import m7161
+import pkg5.pkg77.m76
+from pkg5.pkg78.pkg1018 import m3101
+import pkg7.pkg94.pkg1223.m17894
+from pkg6.pkg87.pkg1134 import m3217
+import pkg4.pkg64.pkg833.m32092
+from pkg3.pkg42.pkg555 import m554
+
+
+def helper_33526_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_33526_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_33526_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_33526_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_33526_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_33526_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
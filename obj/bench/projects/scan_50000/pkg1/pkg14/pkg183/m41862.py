@@ -0,0 +1,47 @@
+"""Module 41862."""
+import pkg4.pkg53.pkg698.m4865
+from pkg8.pkg107.pkg1398 import m7649
+import pkg9.pkg119.m2202
+from pkg3 import m2
+import pkg6.pkg82.pkg1068.m23991
+from pkg1 import m0
+import pkg4.pkg61.pkg805.m804
+from pkg2.pkg39.pkg511 import m510
+import pkg7.pkg104.pkg1356.m3439
+from pkg9.pkg126 import m14713
+import pkg1.pkg26.pkg341.m21180
+
+
+def helper_41862_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_41862_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_41862_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_41862_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_41862_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
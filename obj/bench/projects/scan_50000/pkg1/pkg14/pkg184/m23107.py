@@ -0,0 +1,27 @@
+"""Module 23107."""
+import pkg7.pkg98.m97
+from pkg6 import m5
+import pkg7.pkg93.pkg1221.m17892
+from pkg4.pkg59.pkg778 import m777
+from . import m16855
+
+
+def helper_23107_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_23107_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_23107_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,13 @@
+"""Module 25191."""
+import pkg12.pkg157.pkg2042.m2041
+from . import m183
+import pkg10.pkg141.pkg1844.m16431
+from pkg9 import m8
+import pkg4.pkg59.pkg779.m778
+
+
+def helper_25191_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
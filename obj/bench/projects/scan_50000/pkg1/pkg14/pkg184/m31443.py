@@ -0,0 +1,38 @@
+"""Module 31443."""
+import pkg4.pkg58.pkg766.m11185
+from pkg11.pkg150.pkg1960 import m8211
+import pkg10.pkg138.pkg1798.m28889
+from pkg9.pkg118.pkg1538 import m16125
+import pkg3.pkg42.pkg555.m29730
+from pkg1.pkg23.pkg308 import m6559
+import pkg6.pkg85.pkg1108.m17779
+from pkg11.pkg151.pkg1973 import m6140
+import pkg6.pkg90.pkg1172.m15759
+
+
+def helper_31443_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_31443_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_31443_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_31443_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
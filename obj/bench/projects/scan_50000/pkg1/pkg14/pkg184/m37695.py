@@ -0,0 +1,24 @@
+"""Module 37695."""
+import pkg12.pkg157.pkg2049.m20804
+from pkg7.pkg104.pkg1356 import m3439
+import pkg9.pkg127.pkg1652.m16239
+from pkg9.pkg119.pkg1549 import m1548
+import pkg9.pkg128.pkg1676.m28767
+from pkg1.pkg25 import m4192
+import pkg8.m7
+from pkg5.pkg76.pkg994 import m9329
+import pkg6.pkg84.m83
+
+
+def helper_37695_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37695_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
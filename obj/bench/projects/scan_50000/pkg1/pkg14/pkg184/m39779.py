@@ -0,0 +1,21 @@
+"""Module 39779."""
+import pkg1.pkg22.pkg297.m296
+from pkg9 import m8
+from . import m29359
+from pkg11.pkg155.pkg2020 import m6187
+from . import m33527
+from . import m25191
+
+
+def helper_39779_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39779_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
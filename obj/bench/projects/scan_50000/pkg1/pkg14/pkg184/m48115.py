@@ -0,0 +1,32 @@
+"""Module 48115."""
+from . import m25191
+from pkg6.pkg88.pkg1147 import m1146
+import pkg3.pkg42.pkg559.m2642
+from pkg2.pkg36 import m35
+import pkg1.m0
+from pkg2.pkg28.pkg365 import m364
+import pkg8.pkg108.pkg1416.m34759
+from pkg11.pkg155.pkg2022 import m4105
+from . import m183
+from pkg1.pkg23.pkg307 import m44070
+
+
+def helper_48115_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_48115_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_48115_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
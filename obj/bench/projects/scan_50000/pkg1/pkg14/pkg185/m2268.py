@@ -0,0 +1,24 @@
+"""Module 2268."""
+import pkg11.m10
+from pkg13.pkg170 import m169
+import pkg1.m0
+from pkg7.pkg100.pkg1304 import m1303
+from . import m184
+from pkg10.pkg142.pkg1854 import m1853
+import pkg4.m3
+from pkg2.pkg31.pkg407 import m406
+import pkg10.pkg139.pkg1813.m1812
+
+
+def helper_2268_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2268_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,52 @@
+"""Module 31444."""
+import pkg2.pkg27.pkg364.m8699
+from pkg2.pkg28 import m10447
+import pkg1.pkg16.pkg220.m4387
+from pkg2.pkg28 import m27
+import pkg1.pkg17.pkg227.m226
+from pkg5.pkg78 import m2161
+from . import m16856
+from pkg9.pkg124.pkg1618 import m16205
+import pkg5.pkg78.pkg1017.m3100
+
+
+def helper_31444_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_31444_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_31444_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_31444_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_31444_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_31444_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
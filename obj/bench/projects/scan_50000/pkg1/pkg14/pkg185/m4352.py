@@ -0,0 +1,36 @@
+"""Module 4352."""
+import pkg3.pkg49.m48
+from pkg11.pkg156 import m155
+import pkg13.m12
+from pkg11.pkg145.pkg1893 import m1892
+import pkg1.m0
+from . import m184
+import pkg2.pkg31.pkg407.m406
+
+
+def helper_4352_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4352_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4352_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4352_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
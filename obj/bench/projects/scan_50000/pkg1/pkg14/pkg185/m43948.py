@@ -0,0 +1,34 @@
+"""Module 43948."""
+import pkg3.pkg44.pkg585.m2668
+from pkg3.pkg45.pkg597 import m6848
+import pkg5.pkg73.pkg962.m3045
+from pkg2.pkg27 import m26
+import pkg13.pkg174.m2257
+from pkg7 import m2090
+import pkg10.pkg143.m12646
+from . import m10604
+import pkg1.m0
+from . import m39780
+import pkg3.pkg48.pkg635.m634
+from . import m21024
+
+
+def helper_43948_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_43948_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_43948_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
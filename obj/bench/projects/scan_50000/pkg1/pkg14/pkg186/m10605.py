@@ -0,0 +1,18 @@
+"""Module 10605."""
+import pkg1.pkg18.pkg238.m237
+from pkg6.pkg82 import m81
+import pkg9.pkg121.m120
+from pkg1.pkg22 import m21
+from . import m8521
+from pkg6.pkg80.pkg1048 import m9383
+import pkg1.pkg25.pkg327.m8662
+from pkg8.pkg109.pkg1428 import m5595
+import pkg3.pkg51.pkg667.m666
+from pkg1.pkg19.pkg251 import m4418
+
+
+def helper_10605_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
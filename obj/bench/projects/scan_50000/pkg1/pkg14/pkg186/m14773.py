@@ -0,0 +1,25 @@
+"""Module 14773."""
+import pkg12.pkg160.pkg2082.m12501
+from pkg10 import m9
+import pkg5.pkg68.pkg896.m7147
+from . import m4353
+import pkg11.pkg152.m151
+from . import m12689
+import pkg1.m0
+from . import m8521
+import pkg1.pkg18.pkg236.m235
+from pkg13.pkg181 import m180
+
+
+def helper_14773_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14773_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 185."""
+import pkg10.pkg138.m137
+from pkg3.pkg43 import m42
+import pkg6.pkg83.m82
+
+
+def helper_185_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_185_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,45 @@
+"""Module 18941."""
+import pkg8.pkg109.pkg1422.m18093
+from pkg6.pkg87.pkg1144 import m17815
+import pkg3.pkg47.pkg612.m2695
+from pkg7.pkg102.pkg1334 import m7585
+import pkg6.pkg81.m2164
+from pkg2.pkg31.pkg408 import m17079
+import pkg6.pkg91.pkg1185.m1184
+from pkg10.pkg137.pkg1784 import m1783
+import pkg10.pkg139.pkg1810.m10145
+
+
+def helper_18941_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_18941_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_18941_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_18941_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_18941_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
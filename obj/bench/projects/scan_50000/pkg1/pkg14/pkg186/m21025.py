@@ -0,0 +1,33 @@
+"""Module 21025."""
+from . import m10605
+from pkg9.pkg121.pkg1576 import m18247
+import pkg1.pkg20.m19
+from . import m14773
+from . import m4353
+from . import m18941
+import pkg6.pkg81.pkg1058.m3141
+from pkg4.pkg56 import m55
+import pkg10.pkg142.m141
+from pkg6.pkg89.pkg1168 import m11587
+import pkg2.pkg35.m34
+
+
+def helper_21025_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_21025_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_21025_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,39 @@
+"""Module 25193."""
+import pkg7.pkg100.pkg1311.m7562
+from pkg7 import m6
+from . import m12689
+from pkg1.pkg25.pkg326 import m325
+import pkg8.pkg106.pkg1389.m1388
+from pkg2.pkg29.pkg379 import m378
+import pkg2.pkg36.m2119
+from pkg1.pkg26.pkg346 import m345
+import pkg10.pkg141.m140
+from pkg1.pkg26.pkg345 import m344
+
+
+def helper_25193_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_25193_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_25193_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_25193_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
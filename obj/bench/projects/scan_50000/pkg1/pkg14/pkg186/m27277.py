@@ -0,0 +1,47 @@
+"""Module 27277."""
+import pkg2.pkg35.pkg461.m10880
+from pkg5.pkg67.pkg874 import m2957
+import pkg1.pkg26.pkg340.m339
+from pkg4.pkg64.pkg844 import m7095
+import pkg1.pkg17.pkg228.m16899
+from . import m2269
+from . import m4353
+from pkg11.pkg154.pkg2009 import m12428
+import pkg7.pkg97.pkg1272.m11691
+from pkg8.pkg109.pkg1425 import m18096
+import pkg2.pkg35.pkg456.m455
+
+
+def helper_27277_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_27277_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_27277_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_27277_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_27277_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
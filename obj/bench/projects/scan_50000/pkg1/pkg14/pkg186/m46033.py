@@ -0,0 +1,14 @@
+"""Module 46033."""
+import pkg10.pkg141.pkg1844.m26851
+from pkg4.pkg61.pkg796 import m795
+import pkg12.pkg158.pkg2062.m16649
+from . import m6437
+from . import m4353
+from pkg9.pkg120.pkg1563 import m28654
+
+
+def helper_46033_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 10606."""
+import pkg4.pkg57.m56
+from pkg1.pkg25.pkg330 import m6581
+from . import m6438
+from pkg1.pkg16.pkg212 import m211
+import pkg5.pkg74.pkg973.m972
+
+
+def helper_10606_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10606_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
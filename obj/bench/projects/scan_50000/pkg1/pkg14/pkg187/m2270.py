@@ -0,0 +1,33 @@
+"""Module 2270."""
+from . import m186
+from pkg10.pkg140.pkg1830 import m1829
+import pkg1.pkg24.m23
+from pkg1 import m0
+import pkg7.pkg99.pkg1291.m1290
+from pkg7.pkg101.pkg1321 import m1320
+import pkg3.pkg43.pkg561.m560
+from pkg3.pkg49 import m48
+import pkg3.m2
+from pkg1.pkg14.pkg185 import m184
+import pkg6.pkg89.pkg1158.m1157
+
+
+def helper_2270_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2270_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2270_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 41866."""
+import pkg9.pkg119.pkg1558.m1557
+from pkg8.pkg110.pkg1435 import m26442
+import pkg3.pkg40.pkg523.m31782
+from pkg8.pkg107.pkg1395 import m22234
+from . import m29362
+from pkg2.pkg38.pkg501 import m27592
+from . import m27278
+from pkg4.pkg53.pkg697 import m6948
+import pkg2.pkg39.pkg518.m2601
+from . import m35614
+from . import m21026
+
+
+def helper_41866_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
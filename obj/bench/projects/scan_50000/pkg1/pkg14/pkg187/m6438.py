@@ -0,0 +1,44 @@
+"""Module 6438."""
+import pkg11.pkg151.m2234
+from . import m2270
+from . import m186
+from pkg8.pkg114.pkg1492 import m1491
+import pkg3.pkg40.pkg529.m528
+from pkg11.pkg148 import m147
+import pkg10.pkg138.pkg1801.m3884
+from pkg3.pkg48.pkg636 import m635
+
+
+def helper_6438_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6438_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6438_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6438_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_6438_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
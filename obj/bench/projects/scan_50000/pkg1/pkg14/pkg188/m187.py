@@ -0,0 +1,21 @@
+"""Module 187."""
+import pkg4.pkg57.m56
+from pkg1 import m0
+import pkg1.pkg15.m14
+from pkg6.pkg87 import m86
+import pkg4.m3
+from pkg2.pkg38 import m37
+
+
+def helper_187_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_187_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
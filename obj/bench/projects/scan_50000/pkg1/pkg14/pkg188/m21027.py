@@ -0,0 +1,18 @@
+"""Module 21027."""
+import pkg11.m10
+from . import m187
+from . import m10607
+
+
+def helper_21027_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_21027_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,32 @@
+"""Module 41867."""
+from . import m37699
+from pkg13.pkg176 import m23099
+import pkg2.pkg34.pkg449.m25456
+from . import m29363
+import pkg1.m0
+from pkg3.pkg40.pkg527 import m526
+import pkg9.pkg129.m128
+from pkg4.pkg65.pkg853 import m2936
+import pkg4.pkg62.pkg815.m814
+from . import m187
+
+
+def helper_41867_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_41867_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_41867_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
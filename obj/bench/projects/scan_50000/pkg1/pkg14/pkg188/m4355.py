@@ -0,0 +1 @@
+"""Module 4355."""
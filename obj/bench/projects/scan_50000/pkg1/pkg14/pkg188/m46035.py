@@ -0,0 +1,32 @@
+"""Module 46035."""
+import pkg5.pkg73.m72
+from pkg11.pkg146.pkg1910 import m26917
+import pkg1.pkg26.pkg340.m29515
+from . import m12691
+from . import m35615
+from pkg7.pkg97.pkg1272 import m3355
+import pkg6.pkg85.pkg1107.m19862
+from pkg8.pkg110.pkg1437 import m34780
+import pkg7.pkg104.pkg1355.m20110
+from . import m33531
+
+
+def helper_46035_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_46035_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_46035_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 48119."""
+import pkg12.pkg159.pkg2073.m4156
+from pkg9.pkg119.pkg1558 import m1557
+import pkg13.pkg174.m14761
+
+
+def helper_48119_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_48119_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,24 @@
+"""Module 10608."""
+from . import m6440
+from pkg2 import m1
+from . import m4356
+from pkg9.pkg118.pkg1542 import m7793
+from . import m8524
+from pkg4.pkg64 import m4231
+import pkg3.pkg46.pkg608.m4775
+from pkg1.pkg20.pkg263 import m262
+import pkg4.pkg62.pkg813.m4980
+
+
+def helper_10608_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10608_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
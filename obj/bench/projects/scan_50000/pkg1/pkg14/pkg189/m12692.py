@@ -0,0 +1,46 @@
+"""Module 12692."""
+import pkg1.pkg14.pkg191.m4358
+from . import m2272
+import pkg11.pkg145.pkg1896.m10231
+from pkg7.pkg98.pkg1283 import m1282
+import pkg5.pkg78.pkg1023.m5190
+from pkg5.pkg70.pkg912 import m9247
+import pkg1.pkg20.pkg267.m4434
+from pkg8 import m7
+import pkg1.pkg26.pkg348.m347
+from pkg11.pkg155.pkg2023 import m6190
+
+
+def helper_12692_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12692_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_12692_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_12692_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_12692_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,23 @@
+"""Module 35616."""
+import pkg6.pkg85.pkg1118.m26125
+from pkg6.pkg84 import m83
+from . import m8524
+from . import m31448
+import pkg8.pkg113.pkg1481.m1480
+from pkg5.pkg73.pkg950 import m9285
+from . import m4356
+from pkg5.pkg72.pkg943 import m942
+
+
+def helper_35616_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35616_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 37700."""
+from . import m25196
+from pkg8.pkg108.pkg1411 import m9746
+import pkg9.pkg122.pkg1593.m14096
+from pkg5.pkg77.pkg1006 import m28097
+import pkg7.pkg101.pkg1315.m5482
+from pkg11.pkg153.pkg1993 import m14496
+import pkg9.pkg125.pkg1631.m5798
+from pkg12.pkg157.pkg2048 import m24971
+import pkg11.pkg151.pkg1965.m1964
+from . import m33532
+
+
+def helper_37700_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37700_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 43952."""
+import pkg1.pkg22.pkg289.m6540
+from pkg5.pkg68.pkg885 import m19640
+import pkg6.pkg85.pkg1117.m5284
+from pkg1.pkg19.pkg249 import m248
+from . import m10608
+from pkg1.pkg17 import m16
+import pkg8.pkg106.pkg1380.m32639
+from pkg11.pkg154.pkg2010 import m6177
+import pkg11.pkg145.pkg1893.m12312
+from pkg11.pkg145.pkg1892 import m20647
+import pkg8.pkg111.pkg1446.m5613
+from pkg6.pkg86.pkg1119 import m1118
+
+
+def helper_43952_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_43952_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
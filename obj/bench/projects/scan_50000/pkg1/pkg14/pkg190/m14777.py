@@ -0,0 +1,12 @@
+"""Module 14777."""
+import pkg13.pkg180.m179
+from . import m2273
+import pkg5.pkg72.m71
+from pkg4.pkg55.pkg723 import m6974
+
+
+def helper_14777_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
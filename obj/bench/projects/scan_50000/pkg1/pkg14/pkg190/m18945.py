@@ -0,0 +1,14 @@
+"""Module 18945."""
+from . import m4357
+from pkg2.pkg27.pkg356 import m10775
+import pkg5.pkg68.m12571
+from pkg4.pkg55.pkg720 import m6971
+import pkg9.pkg120.pkg1564.m1563
+from pkg5.pkg76.pkg1000 import m3083
+
+
+def helper_18945_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
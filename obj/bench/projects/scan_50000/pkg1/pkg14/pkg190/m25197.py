@@ -0,0 +1,54 @@
+"""Module 25197."""
+import pkg2.pkg32.pkg419.m12922
+from pkg9.pkg124.pkg1618 import m12037
+import pkg9.m8
+from pkg7.pkg103.pkg1345 import m9680
+import pkg1.pkg22.pkg287.m4454
+from . import m10609
+from . import m21029
+from pkg6.pkg86.pkg1123 import m24046
+import pkg1.m0
+from pkg7.pkg100.pkg1309 import m13812
+from . import m6441
+
+
+def helper_25197_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_25197_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_25197_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_25197_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_25197_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_25197_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,52 @@
+"""Module 27281."""
+from . import m18945
+from pkg1.pkg15 import m14
+import pkg2.pkg38.pkg504.m4671
+from pkg7.pkg101.pkg1314 import m1313
+import pkg11.pkg152.pkg1984.m18655
+from pkg3.pkg48.pkg631 import m2714
+from . import m10609
+from pkg10.pkg138.pkg1805 import m1804
+import pkg7.pkg101.pkg1326.m3409
+
+
+def helper_27281_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_27281_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_27281_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_27281_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_27281_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_27281_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,38 @@
+"""Module 6442."""
+import pkg6.pkg90.pkg1177.m1176
+from pkg3.pkg40.pkg523 import m522
+import pkg2.pkg35.pkg465.m464
+from pkg11.pkg146 import m145
+import pkg2.pkg32.pkg423.m422
+from pkg6 import m5
+import pkg10.pkg134.m133
+from pkg1.pkg14.pkg184 import m183
+import pkg7.pkg94.pkg1233.m1232
+
+
+def helper_6442_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6442_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6442_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6442_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
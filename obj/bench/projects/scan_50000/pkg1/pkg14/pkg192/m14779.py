@@ -0,0 +1,30 @@
+"""Module 14779."""
+import pkg2.pkg39.pkg509.m8844
+from pkg1.pkg23.pkg312 import m4479
+from . import m191
+from pkg8.pkg117 import m2200
+import pkg2.pkg39.pkg511.m510
+from pkg10.pkg138.pkg1800 import m5967
+import pkg5.pkg74.pkg971.m970
+from . import m12695
+
+
+def helper_14779_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14779_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_14779_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
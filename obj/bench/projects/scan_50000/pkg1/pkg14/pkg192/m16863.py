@@ -0,0 +1,54 @@
+"""Module 16863."""
+import pkg5.pkg68.pkg886.m885
+from pkg7.pkg92.pkg1197 import m3280
+import pkg7.pkg100.pkg1301.m1300
+from pkg1.pkg22.pkg291 import m290
+import pkg4.pkg56.pkg740.m6991
+from pkg7.pkg93 import m92
+from . import m191
+from . import m6443
+from . import m4359
+from pkg4 import m3
+from . import m14779
+
+
+def helper_16863_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16863_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_16863_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_16863_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_16863_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_16863_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
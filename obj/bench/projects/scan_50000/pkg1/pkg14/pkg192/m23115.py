@@ -0,0 +1,13 @@
+"""Module 23115."""
+import pkg11.pkg144.pkg1875.m8126
+from . import m6443
+import pkg1.m0
+from pkg4.pkg53.pkg696 import m6947
+import pkg8.pkg115.pkg1499.m5666
+
+
+def helper_23115_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,30 @@
+"""Module 29367."""
+import pkg11.pkg151.pkg1971.m20726
+from pkg9.pkg125.pkg1631 import m3714
+import pkg3.pkg49.pkg648.m27739
+from pkg11.pkg144.pkg1878 import m3961
+import pkg2.pkg38.m6289
+from pkg9.pkg122.pkg1592 import m1591
+import pkg5.pkg71.pkg929.m21768
+from pkg6.pkg83.pkg1092 import m7343
+
+
+def helper_29367_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_29367_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_29367_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
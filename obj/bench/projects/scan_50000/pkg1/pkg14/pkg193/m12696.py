@@ -0,0 +1,54 @@
+"""Module 12696."""
+import pkg4.m3
+from . import m6444
+import pkg4.pkg53.pkg690.m11109
+from pkg8.pkg115.pkg1499 import m1498
+import pkg9.pkg127.pkg1663.m5830
+from . import m192
+import pkg3.pkg51.m50
+from pkg10.pkg138.pkg1807 import m5974
+import pkg1.pkg16.pkg217.m216
+from pkg2.pkg35 import m34
+import pkg11.m8346
+
+
+def helper_12696_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12696_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_12696_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_12696_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_12696_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_12696_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,41 @@
+"""Module 16864."""
+import pkg4.pkg58.pkg761.m11180
+from pkg8.pkg113.pkg1472 import m16059
+import pkg10.pkg134.pkg1747.m7998
+from pkg7.pkg100.pkg1306 import m1305
+import pkg7.pkg95.pkg1246.m7497
+from . import m10612
+import pkg8.pkg117.pkg1533.m1532
+from pkg3.pkg50 import m49
+import pkg5.pkg72.m71
+from pkg7.pkg97.pkg1271 import m3354
+import pkg2.pkg32.pkg426.m425
+from pkg1.pkg22.pkg287 import m2370
+
+
+def helper_16864_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16864_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_16864_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_16864_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,32 @@
+"""Module 2276."""
+import pkg8.pkg105.pkg1372.m1371
+from pkg1.pkg22 import m21
+import pkg8.pkg105.pkg1373.m1372
+from . import m192
+import pkg11.pkg155.pkg2021.m2020
+from pkg10.pkg136.pkg1781 import m1780
+import pkg1.pkg18.pkg244.m243
+from pkg3 import m2
+import pkg7.pkg104.pkg1361.m1360
+from pkg1 import m0
+
+
+def helper_2276_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2276_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2276_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
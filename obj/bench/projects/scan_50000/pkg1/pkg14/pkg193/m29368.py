@@ -0,0 +1,27 @@
+"""Module 29368."""
+from . import m23116
+from pkg10.pkg138.pkg1800 import m5967
+import pkg9.pkg121.m120
+from . import m25200
+import pkg12.pkg157.pkg2046.m8297
+from pkg6.pkg81.pkg1058 import m5225
+import pkg7.pkg99.pkg1296.m3379
+from pkg6.pkg79.pkg1040 import m1039
+import pkg10.pkg133.pkg1740.m24663
+from pkg3.pkg51.pkg674 import m23597
+import pkg2.pkg33.pkg432.m431
+from . import m18948
+
+
+def helper_29368_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_29368_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
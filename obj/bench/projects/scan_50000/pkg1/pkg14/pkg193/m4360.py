@@ -0,0 +1,28 @@
+"""Module 4360."""
+from . import m2276
+from pkg1.pkg21.pkg281 import m280
+import pkg5.pkg78.pkg1020.m3103
+from pkg10.pkg137.pkg1786 import m1785
+import pkg3.pkg45.pkg587.m586
+from pkg8.pkg107.pkg1397 import m1396
+
+
+def helper_4360_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4360_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4360_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
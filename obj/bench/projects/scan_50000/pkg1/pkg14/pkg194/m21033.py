@@ -0,0 +1,39 @@
+"""Module 21033."""
+import pkg12.pkg159.pkg2075.m6242
+from pkg9.pkg122.pkg1594 import m3677
+from . import m193
+from pkg6.pkg80.pkg1047 import m11466
+import pkg5.pkg76.pkg998.m3081
+from . import m2277
+import pkg9.pkg119.pkg1559.m1558
+from . import m14781
+import pkg3.pkg49.m6300
+from pkg5.pkg67.pkg883 import m2966
+
+
+def helper_21033_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_21033_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_21033_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_21033_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
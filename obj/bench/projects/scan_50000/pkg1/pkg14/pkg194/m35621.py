@@ -0,0 +1,36 @@
+"""Module 35621."""
+import pkg1.pkg18.pkg242.m4409
+from pkg2.pkg32 import m31
+import pkg4.pkg57.pkg749.m7000
+from . import m31453
+import pkg1.pkg25.pkg326.m4493
+from . import m21033
+from . import m33537
+
+
+def helper_35621_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35621_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_35621_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_35621_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
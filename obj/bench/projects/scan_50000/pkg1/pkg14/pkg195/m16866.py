@@ -0,0 +1,26 @@
+"""Module 16866."""
+from . import m8530
+from pkg5 import m4
+import pkg9.pkg120.pkg1564.m16151
+from pkg2.pkg32.pkg425 import m424
+
+
+def helper_16866_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16866_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_16866_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
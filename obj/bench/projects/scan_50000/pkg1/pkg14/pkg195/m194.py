@@ -0,0 +1,21 @@
+"""Module 194."""
+import pkg4.m3
+from pkg5.pkg72 import m71
+import pkg2.m1
+from pkg5.pkg70 import m69
+import pkg6.m5
+from pkg13.pkg172 import m171
+
+
+def helper_194_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_194_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,52 @@
+"""Module 33538."""
+import pkg5.pkg71.pkg935.m9270
+from pkg6.pkg82.pkg1068 import m28159
+import pkg3.pkg44.m43
+from pkg10.pkg139.pkg1808 import m12227
+import pkg6.pkg82.pkg1069.m1068
+from pkg2.pkg27.pkg352 import m351
+import pkg6.pkg89.pkg1165.m26172
+from pkg10.pkg137 import m23060
+import pkg11.pkg153.pkg1997.m1996
+
+
+def helper_33538_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_33538_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_33538_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_33538_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_33538_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_33538_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
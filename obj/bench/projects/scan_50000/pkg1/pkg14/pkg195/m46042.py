@@ -0,0 +1,23 @@
+"""Module 46042."""
+import pkg7.pkg98.pkg1275.m13778
+from pkg7.pkg93 import m92
+import pkg8.pkg110.pkg1436.m1435
+from . import m33538
+import pkg9.pkg124.pkg1620.m1619
+from pkg7.pkg100.pkg1309 import m5476
+import pkg1.pkg23.pkg309.m27400
+from . import m29370
+
+
+def helper_46042_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_46042_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
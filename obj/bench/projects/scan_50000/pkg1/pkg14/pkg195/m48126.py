@@ -0,0 +1,54 @@
+"""Module 48126."""
+from . import m18950
+from pkg6.pkg80.pkg1042 import m3125
+import pkg9.pkg130.pkg1702.m3785
+from pkg6 import m5
+import pkg4.pkg55.pkg726.m44489
+from . import m35622
+from . import m2278
+from pkg5.pkg73.pkg956 import m13459
+import pkg8.pkg109.pkg1419.m18090
+from pkg7.pkg100.pkg1303 import m11722
+from . import m14782
+
+
+def helper_48126_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_48126_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_48126_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_48126_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_48126_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_48126_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
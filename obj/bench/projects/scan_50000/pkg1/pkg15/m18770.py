@@ -0,0 +1,29 @@
+"""Module 18770."""
+from . import m16686
+from pkg7.pkg94.pkg1227 import m17898
+import pkg5.pkg66.pkg861.m860
+from . import m14
+import pkg2.pkg37.pkg493.m17164
+from pkg1.pkg19 import m18
+import pkg1.m0
+
+
+def helper_18770_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_18770_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_18770_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,15 @@
+"""Module 22938."""
+import pkg5.pkg68.pkg893.m11312
+from . import m18770
+import pkg11.pkg145.pkg1892.m16479
+from pkg7 import m6
+import pkg9.pkg125.pkg1631.m5798
+from pkg1 import m0
+import pkg6.pkg86.m85
+
+
+def helper_22938_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
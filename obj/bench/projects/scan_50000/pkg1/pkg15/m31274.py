@@ -0,0 +1,19 @@
+"""Module 31274."""
+import pkg2.pkg39.pkg510.m509
+from . import m8350
+import pkg8.pkg108.m107
+from pkg3.pkg42.pkg552 import m551
+
+
+def helper_31274_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_31274_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
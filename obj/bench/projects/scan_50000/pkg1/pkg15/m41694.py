@@ -0,0 +1,17 @@
+"""Module 41694."""
+import pkg1.pkg24.pkg314.m33657
+from . import m29190
+import pkg9.pkg123.pkg1609.m22448
+from pkg1.pkg25.pkg328 import m2411
+import pkg11.pkg155.pkg2018.m29109
+from pkg5.pkg70.pkg916 import m34259
+from . import m14
+from . import m8350
+import pkg1.m0
+
+
+def helper_41694_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
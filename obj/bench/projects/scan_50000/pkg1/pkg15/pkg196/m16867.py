@@ -0,0 +1,11 @@
+"""Module 16867."""
+import pkg3.pkg42.pkg558.m6809
+from . import m6447
+import pkg7.pkg102.pkg1335.m1334
+from pkg10.pkg138.pkg1799 import m5966
+import pkg6.pkg81.pkg1057.m7308
+from pkg6.pkg80.pkg1042 import m5209
+import pkg8.pkg109.pkg1425.m1424
+from pkg9.pkg124.pkg1624 import m5791
+import pkg4.pkg65.pkg857.m2940
+from pkg10.pkg131.pkg1705 import m16292
@@ -0,0 +1,17 @@
+"""Module 41875."""
+from . import m4363
+from pkg3.pkg42.pkg554 import m33897
+import pkg6.pkg81.m80
+from pkg1 import m0
+from . import m21035
+from pkg1.pkg26.pkg345 import m344
+import pkg2.pkg36.pkg478.m23401
+from pkg4.pkg53.pkg697 import m2780
+from . import m23119
+
+
+def helper_41875_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,21 @@
+"""Module 4363."""
+import pkg11.pkg151.m2234
+from pkg6.pkg81.pkg1060 import m1059
+import pkg5.m4
+from pkg3.pkg48.pkg628 import m627
+import pkg4.pkg58.pkg755.m754
+from pkg6 import m5
+
+
+def helper_4363_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4363_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,48 @@
+"""Module 6447."""
+import pkg4.pkg57.m4224
+from pkg4 import m3
+import pkg5.m4
+from pkg1.pkg22.pkg291 import m4458
+import pkg1.pkg14.pkg189.m188
+from pkg6.pkg80.pkg1052 import m1051
+from . import m4363
+from pkg10.pkg137.pkg1794 import m5961
+import pkg9.pkg119.pkg1555.m5722
+from pkg1 import m0
+import pkg2.pkg33.pkg440.m2523
+from pkg1.pkg18.pkg236 import m235
+
+
+def helper_6447_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6447_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6447_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6447_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_6447_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,10 @@
+"""Module 2280."""
+import pkg5.pkg66.pkg865.m864
+from pkg3.pkg49.pkg638 import m637
+
+
+def helper_2280_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,12 @@
+"""Module 41876."""
+import pkg6.pkg91.pkg1191.m11610
+from pkg1.pkg18.pkg243 import m12746
+import pkg8.pkg108.pkg1407.m34750
+from pkg9 import m20848
+
+
+def helper_41876_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
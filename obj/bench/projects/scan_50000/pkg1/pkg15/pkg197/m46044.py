@@ -0,0 +1,43 @@
+"""Module 46044."""
+import pkg7.pkg101.pkg1320.m5487
+from . import m8532
+import pkg6.pkg90.pkg1172.m1171
+from . import m35624
+import pkg7.pkg96.pkg1254.m1253
+from pkg1.pkg22.pkg299 import m298
+import pkg10.pkg142.pkg1857.m6024
+
+
+def helper_46044_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_46044_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_46044_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_46044_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_46044_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 48128."""
+import pkg2.pkg31.pkg409.m408
+from pkg4.pkg60.pkg792 import m791
+import pkg10.pkg139.pkg1812.m1811
+from pkg1.pkg24.pkg314 import m313
+
+
+def helper_48128_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_48128_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_48128_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
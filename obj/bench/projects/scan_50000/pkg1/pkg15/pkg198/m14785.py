@@ -0,0 +1,38 @@
+"""Module 14785."""
+from . import m2281
+from pkg2.pkg35.pkg466 import m465
+import pkg7.pkg94.pkg1232.m9567
+from pkg2.pkg38.pkg506 import m505
+from . import m4365
+from pkg5.pkg67 import m66
+import pkg2.pkg30.m29
+from pkg5.pkg77.pkg1012 import m1011
+import pkg4.pkg62.pkg808.m2891
+
+
+def helper_14785_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14785_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_14785_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_14785_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
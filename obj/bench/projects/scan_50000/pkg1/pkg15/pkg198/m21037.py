@@ -0,0 +1,25 @@
+"""Module 21037."""
+import pkg10.pkg139.pkg1813.m3896
+from pkg5.pkg77.pkg1011 import m1010
+import pkg7.pkg98.pkg1284.m1283
+from pkg5.pkg76.pkg993 import m5160
+import pkg2.m1
+from . import m12701
+import pkg6.pkg82.pkg1077.m1076
+from pkg12.pkg159.pkg2073 import m18744
+import pkg6.pkg91.pkg1190.m9525
+from pkg10.pkg137.pkg1787 import m18458
+
+
+def helper_21037_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_21037_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,32 @@
+"""Module 27289."""
+import pkg1.pkg16.pkg213.m12716
+from pkg1.pkg25.pkg335 import m2418
+import pkg7.pkg102.pkg1328.m24251
+from . import m6449
+import pkg1.pkg25.m24
+from . import m25205
+import pkg11.pkg149.pkg1949.m1948
+from pkg12.pkg159 import m158
+from . import m23121
+from . import m21037
+
+
+def helper_27289_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_27289_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_27289_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 31457."""
+from . import m29373
+from pkg2.pkg32.pkg426 import m425
+
+
+def helper_31457_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_31457_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
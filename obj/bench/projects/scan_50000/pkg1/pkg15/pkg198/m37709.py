@@ -0,0 +1,41 @@
+"""Module 37709."""
+import pkg9.m8
+from pkg5.pkg75.pkg984 import m5151
+from . import m10617
+from pkg2.pkg31.pkg407 import m406
+import pkg8.pkg114.pkg1492.m7743
+from pkg4.pkg53.pkg692 import m691
+import pkg2.pkg39.m38
+from pkg6.pkg80.pkg1048 import m7299
+from . import m27289
+from pkg6.pkg80.pkg1041 import m23964
+import pkg2.pkg34.pkg452.m35879
+from pkg1.pkg23 import m22
+
+
+def helper_37709_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37709_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_37709_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_37709_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
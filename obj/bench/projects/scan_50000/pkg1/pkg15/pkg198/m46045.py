@@ -0,0 +1,38 @@
+"""Module 46045."""
+from . import m23121
+from pkg1.pkg17 import m35444
+from . import m33541
+from pkg11.pkg151.pkg1972 import m12391
+from . import m18953
+from pkg7.pkg96.pkg1257 import m26264
+import pkg8.pkg113.pkg1478.m32737
+from pkg4.pkg64.pkg840 import m17511
+from . import m6449
+
+
+def helper_46045_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_46045_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_46045_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_46045_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,12 @@
+"""Module 8533."""
+import pkg11.pkg149.pkg1942.m4025
+from pkg1.pkg20.pkg265 import m264
+import pkg8.pkg114.m113
+from pkg4.pkg54.pkg706 import m2789
+
+
+def helper_8533_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
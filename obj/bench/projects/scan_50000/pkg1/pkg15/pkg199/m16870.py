@@ -0,0 +1,52 @@
+"""Module 16870."""
+import pkg3.pkg42.m41
+from pkg1.pkg18 import m17
+import pkg1.pkg25.pkg329.m8664
+from pkg8.pkg114.pkg1484 import m7735
+import pkg9.pkg127.pkg1653.m16240
+from pkg3.pkg41.pkg536 import m535
+import pkg7.pkg99.pkg1290.m9625
+from pkg1 import m0
+import pkg6.pkg83.pkg1090.m7341
+
+
+def helper_16870_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16870_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_16870_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_16870_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_16870_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_16870_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
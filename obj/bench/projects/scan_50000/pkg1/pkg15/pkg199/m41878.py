@@ -0,0 +1,2 @@
+"""Module 41878."""
+import pkg5.pkg67.pkg876.m2959
@@ -0,0 +1,19 @@
+"""Module 4366."""
+import pkg8.pkg107.pkg1396.m1395
+from pkg3.pkg45.pkg589 import m588
+import pkg2.pkg34.pkg452.m451
+from pkg6.pkg81.pkg1059 import m3142
+
+
+def helper_4366_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4366_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,14 @@
+"""Module 46046."""
+import pkg5.pkg73.pkg957.m11376
+from pkg7.pkg92.pkg1202 import m7453
+from . import m23122
+from . import m31458
+import pkg8.pkg108.pkg1416.m1415
+from pkg4.pkg57.pkg751 import m7002
+
+
+def helper_46046_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,34 @@
+"""Module 48130."""
+import pkg1.pkg26.pkg339.m8674
+from pkg11.pkg147.pkg1912 import m1911
+import pkg6.pkg86.pkg1124.m19879
+from . import m39794
+import pkg6.pkg84.pkg1100.m1099
+from pkg12.pkg165 import m37676
+import pkg11.pkg146.pkg1909.m22748
+from pkg5.pkg76.pkg997 import m996
+import pkg9.pkg129.pkg1682.m1681
+from pkg8.pkg113.pkg1475 import m11894
+from . import m14786
+from pkg1.pkg23.pkg303 import m2386
+
+
+def helper_48130_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_48130_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_48130_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
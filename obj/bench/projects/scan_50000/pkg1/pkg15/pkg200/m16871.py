@@ -0,0 +1,18 @@
+"""Module 16871."""
+import pkg7.pkg101.pkg1325.m1324
+from pkg7.pkg92.pkg1207 import m1206
+import pkg1.m0
+
+
+def helper_16871_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16871_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
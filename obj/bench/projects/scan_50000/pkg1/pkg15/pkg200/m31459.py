@@ -0,0 +1,41 @@
+"""Module 31459."""
+import pkg10.pkg137.pkg1782.m30957
+from pkg10.pkg136.pkg1780 import m3863
+import pkg4.pkg57.m25064
+from pkg8.pkg110.pkg1432 import m5599
+import pkg4.pkg59.pkg778.m15365
+from . import m2283
+import pkg3.pkg41.m2124
+from pkg8.pkg117.pkg1534 import m11953
+import pkg4.pkg61.pkg802.m2885
+from pkg4.pkg63.pkg825 import m824
+import pkg10.pkg136.pkg1774.m24697
+from pkg4.pkg60.pkg784 import m4951
+
+
+def helper_31459_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_31459_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_31459_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_31459_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
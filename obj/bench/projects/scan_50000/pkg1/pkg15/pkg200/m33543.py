@@ -0,0 +1,37 @@
+"""Module 33543."""
+import pkg7.pkg93.pkg1220.m11639
+from . import m21039
+from . import m10619
+from pkg8.pkg109.pkg1422 import m5589
+import pkg4.pkg55.pkg722.m27813
+from pkg9.pkg130.pkg1691 import m22530
+import pkg2.pkg27.m26
+from pkg1 import m0
+
+
+def helper_33543_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_33543_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_33543_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_33543_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
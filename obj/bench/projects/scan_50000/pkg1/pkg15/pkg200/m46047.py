@@ -0,0 +1,52 @@
+"""Module 46047."""
+import pkg7.pkg100.pkg1301.m13804
+from pkg9.pkg118.pkg1547 import m7798
+import pkg12.pkg159.pkg2076.m2075
+from pkg3.pkg51.pkg676 import m6927
+import pkg3.pkg45.pkg593.m592
+from pkg6.pkg89.pkg1162 import m11581
+import pkg5.pkg78.pkg1023.m17694
+from . import m31459
+import pkg3.pkg47.pkg623.m13126
+
+
+def helper_46047_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_46047_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_46047_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_46047_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_46047_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_46047_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 48131."""
+import pkg1.pkg26.m37537
+from pkg1.pkg25.pkg335 import m12838
+
+
+def helper_48131_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_48131_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
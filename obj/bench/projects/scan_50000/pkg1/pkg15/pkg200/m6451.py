@@ -0,0 +1,25 @@
+"""Module 6451."""
+import pkg6.pkg90.pkg1179.m1178
+from pkg1 import m0
+import pkg5.pkg69.pkg899.m898
+from pkg6.pkg81 import m80
+import pkg3.m2
+from pkg5.pkg70.pkg915 import m5082
+import pkg4.pkg54.pkg703.m702
+from pkg12.pkg167 import m166
+from . import m199
+from pkg5.pkg75.pkg981 import m980
+
+
+def helper_6451_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6451_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
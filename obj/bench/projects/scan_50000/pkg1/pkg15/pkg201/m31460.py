@@ -0,0 +1,39 @@
+"""Module 31460."""
+import pkg2.pkg29.pkg382.m6633
+from pkg6.pkg87.pkg1132 import m13635
+import pkg2.pkg30.pkg401.m400
+from pkg9.pkg127.pkg1654 import m7905
+import pkg7.pkg99.pkg1293.m26300
+from pkg10.pkg133 import m10552
+import pkg10.pkg141.m23064
+from pkg4.pkg63.pkg830 import m7081
+import pkg5.pkg70.pkg917.m7168
+from pkg1.pkg15.pkg203 import m202
+
+
+def helper_31460_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_31460_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_31460_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_31460_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
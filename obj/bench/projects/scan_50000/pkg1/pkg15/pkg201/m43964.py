@@ -0,0 +1,17 @@
+"""Module 43964."""
+import pkg4.pkg53.pkg701.m27792
+from pkg2.pkg34.pkg453 import m15040
+import pkg4.pkg62.pkg809.m11228
+from pkg3.pkg51.pkg668 import m667
+import pkg7.pkg102.m101
+from . import m16872
+from . import m41880
+from pkg4.pkg60.pkg788 import m787
+import pkg8.pkg107.pkg1393.m38904
+
+
+def helper_43964_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,45 @@
+"""Module 12705."""
+import pkg11.pkg155.pkg2027.m6194
+from . import m6453
+from . import m201
+from pkg13.pkg182 import m181
+import pkg1.pkg17.m16
+from pkg3 import m2
+import pkg4.pkg55.m54
+from pkg7.pkg104.pkg1357 import m1356
+import pkg12.pkg159.pkg2071.m12490
+
+
+def helper_12705_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12705_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_12705_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_12705_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_12705_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,15 @@
+"""Module 16873."""
+import pkg4.pkg65.pkg854.m5021
+from pkg5.pkg73.pkg959 import m958
+from . import m10621
+from pkg1 import m0
+import pkg12.pkg164.m163
+from pkg2.pkg39.pkg516 import m515
+from . import m4369
+
+
+def helper_16873_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
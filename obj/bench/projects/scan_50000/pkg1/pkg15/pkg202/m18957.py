@@ -0,0 +1,34 @@
+"""Module 18957."""
+import pkg1.pkg25.m24
+from pkg5.pkg68.pkg886 import m885
+import pkg4.pkg65.pkg852.m5019
+from pkg3.pkg40.pkg530 import m529
+import pkg6.pkg81.pkg1056.m9391
+from pkg9.pkg123.pkg1604 import m3687
+import pkg10.pkg139.pkg1809.m14312
+from pkg7.pkg92.pkg1204 import m11623
+import pkg6.pkg85.pkg1108.m9443
+from pkg8.pkg117.pkg1522 import m9857
+import pkg2.pkg36.pkg480.m8815
+from pkg11.pkg156.pkg2035 import m2034
+
+
+def helper_18957_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_18957_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_18957_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 23125."""
+import pkg2.pkg29.pkg385.m8720
+from . import m4369
+import pkg4.pkg63.pkg830.m19585
+from pkg8.pkg107.pkg1401 import m7652
+import pkg8.pkg108.pkg1416.m11835
+from pkg6.pkg86.pkg1126 import m21965
+import pkg5.m4
+from pkg5.pkg72.pkg947 import m946
+import pkg12.m11
+from pkg13.pkg182 import m181
+import pkg9.pkg122.m121
+
+
+def helper_23125_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_23125_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,39 @@
+"""Module 25209."""
+import pkg3.pkg43.pkg571.m10990
+from pkg9.pkg120.pkg1571 import m1570
+from . import m14789
+from pkg7.pkg95 import m12598
+import pkg8.pkg116.pkg1516.m3599
+from pkg2.pkg31 import m30
+import pkg12.pkg160.m159
+from pkg1.pkg26.pkg342 import m23265
+from . import m10621
+from pkg9.pkg124 import m123
+
+
+def helper_25209_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_25209_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_25209_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_25209_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,32 @@
+"""Module 27293."""
+import pkg8.pkg114.pkg1491.m11910
+from pkg11.pkg150.pkg1959 import m14462
+import pkg8.pkg115.pkg1497.m24420
+from pkg8.pkg108.pkg1413 import m1412
+from . import m18957
+from pkg8.pkg114.pkg1487 import m3570
+import pkg10.pkg133.pkg1737.m1736
+from pkg11.pkg149.pkg1942 import m1941
+from . import m25209
+from pkg5.pkg69.pkg909 import m908
+
+
+def helper_27293_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_27293_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_27293_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
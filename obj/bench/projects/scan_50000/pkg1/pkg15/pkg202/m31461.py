@@ -0,0 +1,15 @@
+"""Module 31461."""
+import pkg4.pkg54.pkg715.m2798
+from pkg9.pkg126.pkg1644 import m18315
+import pkg2.pkg35.pkg461.m460
+from . import m6453
+from . import m2285
+from pkg11.pkg148.pkg1931 import m26938
+import pkg12.pkg157.pkg2051.m4134
+
+
+def helper_31461_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,35 @@
+"""Module 46049."""
+import pkg9.pkg119.pkg1548.m1547
+from pkg11.pkg155.pkg2018 import m14521
+from . import m25209
+from . import m2285
+import pkg5.pkg70.pkg912.m40507
+from pkg6.pkg85.pkg1117 import m13620
+
+
+def helper_46049_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_46049_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_46049_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_46049_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
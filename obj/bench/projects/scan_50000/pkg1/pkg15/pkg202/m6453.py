@@ -0,0 +1,45 @@
+"""Module 6453."""
+import pkg5.pkg75.pkg987.m3070
+from pkg1 import m0
+import pkg9.pkg128.pkg1670.m5837
+from pkg7 import m6
+import pkg1.pkg25.pkg331.m4498
+from pkg5.pkg70.pkg914 import m2997
+import pkg1.pkg25.pkg337.m336
+from pkg5.pkg77.pkg1005 import m1004
+import pkg2.pkg32.m31
+
+
+def helper_6453_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6453_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6453_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6453_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_6453_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,9 @@
+"""Module 14790."""
+import pkg4.pkg58.pkg761.m760
+
+
+def helper_14790_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
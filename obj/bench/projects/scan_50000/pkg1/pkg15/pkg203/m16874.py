@@ -0,0 +1,22 @@
+"""Module 16874."""
+import pkg8.pkg105.pkg1378.m9713
+from . import m202
+import pkg2.pkg37.pkg482.m8817
+from pkg1.pkg20.pkg271 import m270
+import pkg9.pkg124.pkg1613.m14116
+from pkg3.pkg52.pkg689 import m688
+from . import m6454
+
+
+def helper_16874_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16874_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
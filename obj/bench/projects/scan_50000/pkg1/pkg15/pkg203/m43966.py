@@ -0,0 +1,18 @@
+"""Module 43966."""
+import pkg7.m6
+from pkg3.pkg42.pkg558 import m557
+import pkg11.pkg145.pkg1897.m8148
+from pkg3.pkg44 import m43
+from . import m16874
+from pkg5.pkg70.pkg913 import m17584
+import pkg5.pkg69.pkg909.m34252
+from pkg8.pkg115.pkg1507 import m5674
+import pkg6.pkg91.pkg1194.m1193
+from . import m41882
+
+
+def helper_43966_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
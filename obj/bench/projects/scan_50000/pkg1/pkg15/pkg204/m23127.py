@@ -0,0 +1,15 @@
+"""Module 23127."""
+import pkg5.pkg66.m65
+from . import m18959
+import pkg7.pkg104.pkg1365.m9700
+from . import m8539
+import pkg3.pkg45.pkg596.m2679
+from pkg9.pkg121.pkg1581 import m1580
+from . import m10623
+
+
+def helper_23127_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
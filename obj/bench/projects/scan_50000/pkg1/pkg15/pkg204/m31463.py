@@ -0,0 +1,37 @@
+"""Module 31463."""
+import pkg1.pkg24.pkg325.m324
+from pkg2.pkg28.pkg365 import m6616
+import pkg3.pkg42.pkg559.m6810
+from pkg11.pkg147.pkg1913 import m24836
+import pkg9.pkg125.m2208
+from . import m18959
+import pkg7.pkg100.pkg1313.m3396
+from pkg10.pkg140.pkg1828 import m5995
+
+
+def helper_31463_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_31463_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_31463_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_31463_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,30 @@
+"""Module 33547."""
+from . import m12707
+from . import m31463
+import pkg2.pkg27.pkg364.m363
+from pkg8.pkg116.pkg1516 import m5683
+import pkg9.pkg130.m16801
+from pkg1.pkg16.pkg210 import m10629
+from . import m203
+from pkg9.pkg128.pkg1676 import m5843
+
+
+def helper_33547_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_33547_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_33547_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,13 @@
+"""Module 37715."""
+import pkg11.pkg149.pkg1949.m12368
+from pkg3.pkg50 import m49
+import pkg5.pkg78.pkg1025.m1024
+from pkg4.pkg65.pkg854 import m853
+import pkg7.pkg94.pkg1228.m7479
+
+
+def helper_37715_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
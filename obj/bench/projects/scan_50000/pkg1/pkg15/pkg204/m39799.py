@@ -0,0 +1,11 @@
+"""Module 39799."""
+import pkg10.pkg132.pkg1717.m37144
+from pkg2.pkg27 import m8362
+import pkg1.pkg18.m33361
+
+
+def helper_39799_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
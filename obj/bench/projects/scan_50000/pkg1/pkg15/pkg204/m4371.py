@@ -0,0 +1,21 @@
+"""Module 4371."""
+import pkg2.pkg31.pkg410.m409
+from . import m203
+import pkg10.m9
+from pkg6.pkg90.pkg1183 import m1182
+import pkg2.pkg35.pkg463.m462
+from pkg6.pkg84.pkg1105 import m1104
+
+
+def helper_4371_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4371_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,46 @@
+"""Module 43967."""
+import pkg9.pkg125.pkg1634.m3717
+from pkg4.pkg56.pkg739 import m13242
+import pkg2.m1
+from pkg2.pkg31.pkg408 import m407
+import pkg4.pkg53.pkg695.m694
+from pkg6.pkg87.pkg1139 import m40734
+import pkg1.pkg17.pkg223.m25230
+from pkg4.pkg61.pkg795 import m794
+import pkg13.pkg175.m21014
+from pkg3.pkg44.pkg580 import m4747
+
+
+def helper_43967_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_43967_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_43967_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_43967_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_43967_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
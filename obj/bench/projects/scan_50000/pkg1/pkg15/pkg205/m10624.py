@@ -0,0 +1,20 @@
+"""Module 10624."""
+import pkg7.pkg94.pkg1229.m1228
+from . import m2288
+import pkg6.pkg87.m86
+from pkg3.pkg52 import m51
+import pkg11.pkg155.pkg2026.m4109
+from . import m6456
+import pkg11.m10
+from pkg4 import m4171
+import pkg7.pkg98.m97
+from pkg1.pkg17.pkg233 import m232
+import pkg1.pkg26.pkg340.m339
+from pkg1.pkg16.pkg210 import m209
+
+
+def helper_10624_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
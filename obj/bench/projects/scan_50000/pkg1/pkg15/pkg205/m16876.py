@@ -0,0 +1,41 @@
+"""Module 16876."""
+import pkg1.pkg21.pkg281.m8616
+from pkg5 import m4
+import pkg2.pkg39.pkg517.m15104
+from . import m4372
+import pkg4.pkg65.pkg853.m5020
+from . import m6456
+import pkg12.pkg158.pkg2067.m2066
+from pkg11.pkg149.pkg1946 import m10281
+import pkg2.pkg32.pkg422.m15009
+from pkg6.pkg88 import m87
+import pkg1.m0
+from . import m2288
+
+
+def helper_16876_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16876_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_16876_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_16876_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 23128."""
+import pkg6.pkg80.pkg1051.m15638
+from . import m6456
+
+
+def helper_23128_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_23128_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
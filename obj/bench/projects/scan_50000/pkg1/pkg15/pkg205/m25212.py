@@ -0,0 +1,9 @@
+"""Module 25212."""
+import pkg8.pkg111.pkg1449.m9784
+
+
+def helper_25212_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,46 @@
+"""Module 33548."""
+import pkg2.pkg39.m38
+from pkg3 import m2
+import pkg4.pkg57.pkg753.m752
+from . import m204
+import pkg4.pkg53.pkg692.m2775
+from pkg9.pkg125.pkg1630 import m1629
+import pkg1.pkg16.pkg220.m219
+from pkg3.pkg42.pkg557 import m556
+import pkg1.pkg24.pkg320.m319
+from pkg7.pkg99 import m31358
+
+
+def helper_33548_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_33548_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_33548_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_33548_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_33548_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
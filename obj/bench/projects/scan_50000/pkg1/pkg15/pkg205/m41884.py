@@ -0,0 +1,11 @@
+"""Module 41884."""
+from . import m18960
+from pkg6.pkg84.pkg1095 import m7346
+import pkg1.pkg24.pkg313.m312
+
+
+def helper_41884_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,40 @@
+"""Module 43968."""
+import pkg6.pkg87.pkg1141.m36568
+from pkg1.pkg21.pkg275 import m35702
+import pkg5.pkg66.pkg867.m17538
+from pkg1.pkg25.pkg328 import m2411
+from . import m4372
+from . import m10624
+import pkg13.pkg181.m180
+from pkg11.pkg144 import m143
+import pkg11.pkg155.pkg2027.m14530
+from . import m12708
+import pkg7.pkg101.pkg1317.m1316
+
+
+def helper_43968_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_43968_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_43968_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_43968_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 8540."""
+import pkg4.pkg57.pkg750.m7001
+from pkg3.pkg49.pkg643 import m642
+from . import m6456
+from pkg1 import m0
+import pkg1.pkg23.pkg312.m4479
+
+
+def helper_8540_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8540_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8540_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,16 @@
+"""Module 205."""
+import pkg1.pkg25.m24
+from pkg2 import m1
+import pkg4.m3
+from pkg7 import m6
+import pkg10.pkg143.m142
+from pkg1 import m0
+import pkg8.pkg105.m104
+from pkg1.pkg24 import m23
+
+
+def helper_205_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
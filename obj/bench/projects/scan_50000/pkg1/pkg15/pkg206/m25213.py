@@ -0,0 +1,19 @@
+"""Module 25213."""
+import pkg11.pkg156.pkg2029.m10364
+from pkg1.pkg15.pkg208 import m207
+import pkg2.pkg36.pkg481.m480
+from pkg2.pkg27 import m25034
+import pkg4.pkg54.pkg706.m4873
+from pkg8.pkg108.pkg1408 import m1407
+import pkg10.pkg138.pkg1806.m5973
+from pkg1.pkg18.pkg247 import m246
+import pkg7.pkg104.pkg1360.m1359
+from pkg8.pkg111.pkg1450 import m11869
+import pkg1.pkg26.pkg344.m343
+
+
+def helper_25213_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,48 @@
+"""Module 29381."""
+import pkg3.m2
+from pkg3.pkg51.pkg669 import m668
+import pkg4.pkg62.pkg811.m21650
+from . import m16877
+import pkg1.pkg18.pkg238.m16909
+from pkg2.pkg35.pkg459 import m27550
+import pkg1.pkg17.pkg233.m232
+from pkg6.pkg80.pkg1049 import m1048
+import pkg1.pkg23.pkg308.m307
+from pkg6.pkg82.pkg1076 import m15663
+import pkg7.pkg101.pkg1321.m11740
+from pkg8.pkg107.pkg1398 import m13901
+
+
+def helper_29381_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_29381_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_29381_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_29381_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_29381_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
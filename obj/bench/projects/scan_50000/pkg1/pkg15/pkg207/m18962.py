@@ -0,0 +1,31 @@
+"""Module 18962."""
+import pkg3.pkg52.pkg680.m6931
+from pkg10.pkg138.pkg1805 import m12224
+import pkg10.pkg131.pkg1716.m1715
+from pkg1.pkg24.pkg314 import m313
+import pkg10.pkg135.pkg1758.m5925
+from pkg10.pkg132.pkg1726 import m16313
+import pkg8.pkg110.pkg1438.m11857
+from . import m2290
+import pkg2.pkg29.pkg385.m6636
+
+
+def helper_18962_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_18962_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_18962_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 21046."""
+import pkg12.pkg162.m14749
+from pkg11.pkg146.pkg1906 import m6073
+import pkg6.pkg84.pkg1097.m13600
+from pkg9 import m8
+
+
+def helper_21046_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_21046_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_21046_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,24 @@
+"""Module 41886."""
+import pkg1.pkg24.pkg323.m322
+from . import m23130
+import pkg2.pkg33.pkg441.m440
+from pkg1.pkg23.pkg305 import m12808
+import pkg10.pkg140.pkg1830.m1829
+from pkg2.pkg27.pkg359 import m14946
+import pkg3.pkg40.pkg522.m521
+from pkg6 import m5
+from . import m37718
+
+
+def helper_41886_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_41886_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,61 @@
+"""Module 46054."""
+from . import m29382
+from pkg6.pkg86.pkg1125 import m21964
+import pkg6.pkg87.pkg1132.m40727
+from pkg6.pkg80.pkg1046 import m38557
+from . import m6458
+from pkg8.pkg108 import m31367
+import pkg6.pkg87.pkg1142.m21981
+from pkg2.pkg35.pkg464 import m463
+import pkg1.pkg15.pkg202.m25209
+from pkg7.pkg100.pkg1306 import m28397
+from . import m37718
+
+
+def helper_46054_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_46054_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_46054_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_46054_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_46054_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_46054_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_46054_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
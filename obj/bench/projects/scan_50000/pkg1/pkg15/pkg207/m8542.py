@@ -0,0 +1,20 @@
+"""Module 8542."""
+import pkg7.pkg96.pkg1255.m1254
+from pkg3.pkg49.pkg642 import m641
+import pkg8.pkg110.pkg1436.m3519
+from pkg4.pkg54 import m53
+import pkg4.pkg64.m63
+from pkg1.pkg22.pkg299 import m2382
+import pkg3.pkg46.pkg611.m610
+from pkg9.pkg130.pkg1703 import m3786
+from . import m6458
+from pkg9.pkg130.pkg1693 import m5860
+import pkg8.pkg110.pkg1438.m1437
+from pkg8.pkg106.pkg1387 import m1386
+
+
+def helper_8542_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 10627."""
+import pkg11.pkg151.m8486
+from pkg1 import m0
+import pkg4.pkg53.pkg698.m9033
+
+
+def helper_10627_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10627_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
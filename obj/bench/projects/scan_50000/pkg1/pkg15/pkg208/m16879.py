@@ -0,0 +1,18 @@
+"""Module 16879."""
+import pkg4.pkg63.pkg832.m4999
+from pkg6.pkg91.pkg1190 import m1189
+import pkg5.pkg76.pkg997.m3080
+
+
+def helper_16879_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16879_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
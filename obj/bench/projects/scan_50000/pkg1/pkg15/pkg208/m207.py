@@ -0,0 +1,38 @@
+"""Module 207."""
+import pkg3.pkg50.m49
+from pkg3.pkg52 import m51
+import pkg1.m0
+from pkg8.pkg106 import m105
+import pkg3.pkg47.m46
+from pkg8.pkg117 import m116
+import pkg12.m11
+from pkg11.pkg149 import m148
+import pkg1.pkg15.m14
+
+
+def helper_207_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_207_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_207_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_207_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,9 @@
+"""Module 21047."""
+import pkg10.pkg136.pkg1776.m1775
+
+
+def helper_21047_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,43 @@
+"""Module 27299."""
+import pkg3.pkg43.pkg567.m566
+from pkg7.pkg96.pkg1255 import m17926
+import pkg2.pkg35.pkg457.m15044
+from pkg7.pkg98.pkg1283 import m22122
+import pkg1.pkg15.pkg204.m2287
+from . import m16879
+import pkg3.pkg50.m49
+
+
+def helper_27299_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_27299_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_27299_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_27299_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_27299_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,30 @@
+"""Module 20855."""
+from . import m16687
+from pkg1.pkg16.pkg211 import m4378
+from . import m14603
+from . import m12519
+import pkg7.pkg93.pkg1211.m3294
+from pkg4.pkg60.pkg789 import m7040
+import pkg7.pkg102.pkg1331.m1330
+from pkg2.pkg39.pkg510 import m509
+
+
+def helper_20855_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_20855_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_20855_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,16 @@
+"""Module 33359."""
+import pkg9.pkg130.m14717
+from pkg4.pkg62.pkg815 import m814
+import pkg8.pkg115.pkg1498.m14001
+from . import m8351
+from . import m22939
+from pkg10.pkg141.pkg1837 import m6004
+import pkg3.pkg48.pkg625.m15212
+from pkg1.pkg15.pkg208 import m29383
+
+
+def helper_33359_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
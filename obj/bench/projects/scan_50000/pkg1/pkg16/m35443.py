@@ -0,0 +1,20 @@
+"""Module 35443."""
+import pkg8.pkg112.pkg1463.m34806
+from pkg1.pkg17.pkg227 import m2310
+import pkg5.pkg70.pkg918.m3001
+from pkg13.pkg173 import m172
+import pkg7.pkg99.m23022
+
+
+def helper_35443_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35443_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,33 @@
+"""Module 39611."""
+import pkg5.m4
+from pkg6.pkg83.pkg1086 import m1085
+import pkg5.pkg68.pkg891.m9226
+from pkg3.pkg52.pkg679 import m678
+import pkg1.pkg19.pkg256.m14843
+from pkg9.pkg123 import m122
+from . import m6267
+from pkg1 import m0
+import pkg9.pkg126.pkg1639.m26646
+from pkg7.pkg100.pkg1311 import m22150
+import pkg7.pkg102.pkg1332.m20087
+
+
+def helper_39611_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39611_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_39611_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
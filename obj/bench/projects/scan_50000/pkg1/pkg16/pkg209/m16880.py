@@ -0,0 +1,18 @@
+"""Module 16880."""
+import pkg7.pkg92.pkg1197.m15784
+from pkg1.pkg19.pkg259 import m258
+import pkg10.pkg132.m2215
+from pkg6.pkg87 import m86
+from . import m208
+from pkg10.pkg136.pkg1773 import m16360
+import pkg6.pkg87.pkg1142.m5309
+from pkg9.pkg120.pkg1566 import m1565
+import pkg8.pkg112.pkg1458.m11877
+from . import m14796
+
+
+def helper_16880_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,44 @@
+"""Module 18964."""
+from . import m16880
+from pkg11.pkg151.pkg1971 import m1970
+import pkg2.pkg37.pkg490.m6741
+from . import m6460
+import pkg1.m0
+from pkg9.pkg129.pkg1680 import m5847
+import pkg8.pkg109.pkg1420.m1419
+from pkg4.pkg64.pkg843 import m2926
+
+
+def helper_18964_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_18964_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_18964_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_18964_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_18964_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,40 @@
+"""Module 46056."""
+from . import m12712
+from pkg11.pkg153.pkg1999 import m8250
+import pkg4.pkg65.pkg848.m27939
+from pkg2.pkg34.pkg451 import m450
+import pkg3.m2
+from pkg2.pkg38.pkg497 import m496
+import pkg12.pkg164.m14751
+from pkg1.pkg22.pkg288 import m4455
+import pkg5.pkg69.pkg903.m7154
+from pkg11.pkg147.pkg1914 import m8165
+import pkg11.pkg144.pkg1881.m18552
+
+
+def helper_46056_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_46056_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_46056_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_46056_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,41 @@
+"""Module 48140."""
+import pkg2.pkg32.m31
+from pkg2.pkg29.pkg382 import m44145
+import pkg3.pkg48.pkg632.m6883
+from pkg11.pkg152.pkg1979 import m1978
+import pkg6.pkg81.pkg1064.m23987
+from pkg2.pkg39.pkg519 import m518
+import pkg8.pkg105.pkg1366.m9701
+from pkg11.pkg150.pkg1961 import m4044
+import pkg6.m5
+from pkg11.pkg152.pkg1989 import m12408
+import pkg8.pkg105.pkg1367.m1366
+from pkg9.pkg118 import m117
+
+
+def helper_48140_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_48140_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_48140_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_48140_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
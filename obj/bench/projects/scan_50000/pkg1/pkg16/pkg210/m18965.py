@@ -0,0 +1,19 @@
+"""Module 18965."""
+import pkg2.pkg29.m28
+from pkg3.pkg45.pkg596 import m17267
+import pkg10.pkg133.pkg1737.m1736
+from pkg1.pkg26.pkg347 import m8682
+import pkg2.m1
+from pkg13.pkg170 import m2253
+import pkg4.pkg59.m58
+from . import m12713
+import pkg4.pkg65.pkg856.m5023
+from pkg3.pkg51.pkg666 import m2749
+import pkg1.pkg23.pkg305.m4472
+
+
+def helper_18965_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
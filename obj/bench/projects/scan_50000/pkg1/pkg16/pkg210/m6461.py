@@ -0,0 +1,34 @@
+"""Module 6461."""
+import pkg6.pkg79.pkg1037.m1036
+from pkg10.pkg138 import m137
+import pkg3.pkg49.m6300
+from pkg3.pkg45.pkg595 import m4762
+import pkg1.m0
+from . import m4377
+import pkg1.pkg15.pkg197.m196
+from . import m2293
+import pkg8.pkg109.pkg1418.m3501
+from pkg13.pkg181 import m180
+from . import m209
+from pkg1.pkg18 import m17
+
+
+def helper_6461_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6461_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6461_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,10 @@
+"""Module 8545."""
+import pkg10.pkg141.m140
+from pkg1.pkg18.pkg237 import m236
+
+
+def helper_8545_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
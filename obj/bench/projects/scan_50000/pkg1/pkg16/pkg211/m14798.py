@@ -0,0 +1,52 @@
+"""Module 14798."""
+import pkg2.pkg29.m28
+from pkg4.pkg57.pkg743 import m742
+import pkg6.pkg89.pkg1169.m7420
+from . import m8546
+import pkg4.pkg62.pkg808.m807
+from pkg1 import m0
+import pkg2.pkg32.pkg428.m4595
+from pkg1.pkg26.pkg341 import m8676
+import pkg6.pkg89.pkg1159.m3242
+
+
+def helper_14798_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14798_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_14798_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_14798_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_14798_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_14798_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
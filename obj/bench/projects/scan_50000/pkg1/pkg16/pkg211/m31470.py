@@ -0,0 +1,9 @@
+"""Module 31470."""
+import pkg4.pkg53.pkg699.m13202
+
+
+def helper_31470_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
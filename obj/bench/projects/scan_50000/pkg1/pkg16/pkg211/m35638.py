@@ -0,0 +1,40 @@
+"""Module 35638."""
+import pkg10.pkg142.pkg1848.m1847
+from pkg13.pkg170 import m169
+import pkg6.pkg89.m88
+from pkg2.pkg33.pkg440 import m439
+import pkg2.pkg31.m30
+from pkg9.pkg127.pkg1652 import m9987
+import pkg1.pkg17.m16
+from pkg9.pkg128.pkg1668 import m1667
+from . import m2294
+from pkg10.pkg142 import m6393
+import pkg12.pkg157.pkg2049.m4132
+
+
+def helper_35638_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35638_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_35638_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_35638_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
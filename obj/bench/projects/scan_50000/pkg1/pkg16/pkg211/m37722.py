@@ -0,0 +1,23 @@
+"""Module 37722."""
+import pkg9.pkg126.pkg1643.m1642
+from pkg5.pkg71 import m70
+import pkg2.pkg32.m31
+from pkg2.pkg35.pkg464 import m10883
+import pkg2.pkg33.pkg440.m439
+from pkg1.pkg20.pkg267 import m6518
+import pkg2.pkg37.pkg488.m2571
+from pkg10.pkg138.pkg1807 import m1806
+
+
+def helper_37722_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37722_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
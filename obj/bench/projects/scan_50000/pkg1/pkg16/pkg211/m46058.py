@@ -0,0 +1,31 @@
+"""Module 46058."""
+import pkg1.pkg16.pkg210.m209
+from pkg3.pkg42.pkg548 import m15135
+import pkg1.pkg23.pkg300.m299
+from pkg2.pkg29.pkg380 import m379
+import pkg2.pkg35.pkg459.m458
+from pkg10.pkg139.pkg1817 import m1816
+import pkg9.m2092
+from pkg1 import m0
+import pkg7.pkg100.pkg1313.m5480
+
+
+def helper_46058_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_46058_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_46058_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
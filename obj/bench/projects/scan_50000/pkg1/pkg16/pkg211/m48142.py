@@ -0,0 +1,28 @@
+"""Module 48142."""
+from . import m8546
+from pkg9.pkg118.pkg1545 import m32804
+import pkg11.pkg145.pkg1898.m3981
+from . import m23134
+import pkg10.pkg141.pkg1835.m1834
+from pkg4.pkg59.pkg777 import m9112
+
+
+def helper_48142_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_48142_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_48142_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,45 @@
+"""Module 10631."""
+from . import m4379
+from pkg2.pkg30.pkg393 import m4560
+import pkg10.pkg142.m141
+from pkg2.pkg37.pkg482 import m8817
+import pkg1.pkg23.pkg305.m304
+from pkg1 import m0
+from . import m8547
+from . import m2295
+import pkg3.pkg42.pkg553.m6804
+
+
+def helper_10631_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10631_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_10631_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_10631_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_10631_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
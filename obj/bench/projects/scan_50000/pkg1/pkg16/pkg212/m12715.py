@@ -0,0 +1,10 @@
+"""Module 12715."""
+import pkg6.pkg81.pkg1063.m1062
+from pkg5 import m4
+from . import m4379
+from . import m8547
+import pkg1.pkg21.m20
+from pkg5.pkg74.pkg966 import m965
+import pkg1.pkg22.pkg296.m295
+from pkg3.pkg52.pkg684 import m683
+import pkg4.pkg59.m58
@@ -0,0 +1,60 @@
+"""Module 18967."""
+from . import m12715
+from pkg6.pkg90.pkg1173 import m3256
+import pkg9.pkg125.m8460
+from pkg3.pkg50.pkg660 import m11079
+import pkg1.pkg21.pkg274.m4441
+from pkg10.pkg140.pkg1832 import m1831
+import pkg3.pkg43.pkg563.m562
+from pkg6.pkg85.pkg1115 import m1114
+import pkg1.pkg18.m17
+from pkg5.pkg75.pkg985 import m11404
+
+
+def helper_18967_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_18967_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_18967_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_18967_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_18967_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_18967_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_18967_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,28 @@
+"""Module 27303."""
+import pkg11.pkg148.pkg1926.m20681
+from pkg5.pkg72.pkg941 import m9276
+from . import m12715
+from pkg1.pkg25.pkg331 import m14918
+from . import m18967
+from pkg8.pkg115.pkg1501 import m16088
+
+
+def helper_27303_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_27303_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_27303_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
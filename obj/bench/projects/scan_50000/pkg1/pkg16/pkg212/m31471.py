@@ -0,0 +1,37 @@
+"""Module 31471."""
+from . import m12715
+from pkg2.pkg28 import m27
+import pkg11.pkg145.pkg1895.m18566
+from pkg11.pkg148.pkg1927 import m14430
+import pkg6.pkg81.pkg1055.m3138
+from . import m4379
+from . import m6463
+from pkg2.pkg33 import m12536
+
+
+def helper_31471_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_31471_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_31471_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_31471_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
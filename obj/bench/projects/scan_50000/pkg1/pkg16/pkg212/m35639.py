@@ -0,0 +1,37 @@
+"""Module 35639."""
+from . import m6463
+from pkg10.pkg132.pkg1721 import m5888
+import pkg5.pkg78.pkg1016.m1015
+from pkg3.pkg47 import m46
+import pkg2.pkg28.pkg376.m375
+from pkg6.pkg80.pkg1050 import m3133
+import pkg2.pkg32.m8367
+from pkg4.pkg62.pkg817 import m23740
+
+
+def helper_35639_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35639_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_35639_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_35639_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 4379."""
+from . import m211
+from pkg1.pkg24.pkg319 import m318
+import pkg7.pkg94.pkg1223.m1222
+from pkg6.pkg82 import m81
+import pkg4.pkg59.m58
+
+
+def helper_4379_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4379_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4379_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
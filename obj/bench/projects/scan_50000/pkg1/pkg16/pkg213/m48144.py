@@ -0,0 +1,10 @@
+"""Module 48144."""
+import pkg4.pkg56.pkg740.m739
+from pkg2.pkg36.pkg476 import m475
+
+
+def helper_48144_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 8548."""
+from . import m6464
+from pkg1.pkg22.pkg293 import m2376
+from . import m4380
+from pkg1 import m0
+
+
+def helper_8548_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8548_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,40 @@
+"""Module 10633."""
+import pkg2.pkg37.pkg494.m2577
+from . import m8549
+from . import m213
+from pkg11.pkg150.pkg1953 import m1952
+from . import m2297
+from pkg5.pkg72.pkg942 import m941
+import pkg4.pkg64.pkg838.m2921
+from pkg1.pkg15.pkg206 import m205
+import pkg7.pkg96.pkg1254.m1253
+from pkg7 import m6
+import pkg1.pkg15.pkg201.m200
+
+
+def helper_10633_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10633_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_10633_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_10633_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
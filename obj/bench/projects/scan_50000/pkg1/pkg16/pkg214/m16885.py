@@ -0,0 +1,24 @@
+"""Module 16885."""
+import pkg5.m4
+from pkg11.pkg145.pkg1892 import m10227
+import pkg7.pkg94.pkg1229.m1228
+from pkg9.pkg122.pkg1591 import m9926
+import pkg6.pkg86.pkg1124.m3207
+from pkg9.pkg130.pkg1695 import m3778
+import pkg10.pkg133.pkg1742.m1741
+from . import m6465
+import pkg3.pkg51.pkg671.m6922
+
+
+def helper_16885_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16885_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,55 @@
+"""Module 46061."""
+import pkg7.pkg92.pkg1198.m3281
+from . import m39809
+import pkg7.pkg97.pkg1271.m22110
+from . import m29389
+import pkg3.pkg43.m18798
+from pkg2.pkg34.pkg449 import m8784
+import pkg2.pkg32.pkg424.m423
+from . import m213
+import pkg9.pkg123.pkg1602.m26609
+from . import m2297
+from . import m23137
+from . import m43977
+
+
+def helper_46061_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_46061_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_46061_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_46061_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_46061_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_46061_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,33 @@
+"""Module 16886."""
+from . import m10634
+from pkg8.pkg105.pkg1373 import m9708
+import pkg5.pkg66.pkg866.m2949
+from pkg2.pkg36.pkg470 import m4637
+import pkg1.pkg25.pkg333.m332
+from pkg9.pkg123.pkg1611 import m7862
+import pkg1.pkg26.m25
+from . import m214
+import pkg7.pkg100.pkg1313.m1312
+from pkg5.pkg69.pkg904 import m903
+import pkg9.pkg120.pkg1568.m1567
+
+
+def helper_16886_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16886_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_16886_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
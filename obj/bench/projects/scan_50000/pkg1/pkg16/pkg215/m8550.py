@@ -0,0 +1,34 @@
+"""Module 8550."""
+import pkg9.pkg121.pkg1582.m1581
+from pkg11.pkg148.pkg1927 import m1926
+import pkg5.pkg72.pkg946.m945
+from pkg1.pkg16 import m15
+import pkg4.pkg59.pkg774.m2857
+
+
+def helper_8550_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8550_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8550_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8550_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 39811."""
+import pkg11.pkg150.pkg1951.m4034
+from pkg10.pkg143.pkg1869 import m37296
+from . import m23139
+from pkg10.pkg135.pkg1758 import m1757
+from . import m12719
+from pkg11.pkg150.pkg1954 import m6121
+import pkg4.pkg57.pkg745.m36172
+from pkg13.pkg176 import m175
+import pkg4.pkg59.pkg776.m2859
+from pkg9.pkg129.pkg1681 import m7932
+import pkg3.pkg45.m6296
+from pkg3.pkg48.pkg634 import m21473
+
+
+def helper_39811_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
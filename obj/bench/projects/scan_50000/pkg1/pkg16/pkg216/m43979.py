@@ -0,0 +1,20 @@
+"""Module 43979."""
+from . import m215
+from . import m10635
+from . import m16887
+from pkg8.pkg115.pkg1503 import m1502
+import pkg4.pkg56.pkg729.m36156
+
+
+def helper_43979_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_43979_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,13 @@
+"""Module 46063."""
+from . import m33559
+from pkg3.pkg50.pkg659 import m40254
+import pkg9.pkg125.pkg1638.m16225
+from pkg6.pkg79.pkg1028 import m13531
+import pkg8.pkg111.pkg1445.m1444
+
+
+def helper_46063_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 35644."""
+import pkg2.pkg31.pkg416.m415
+from pkg6.pkg83 import m82
+import pkg1.m0
+from pkg1.pkg22.pkg293 import m292
+import pkg1.pkg22.m22945
+from pkg8.pkg115.pkg1502 import m9837
+import pkg10.pkg136.pkg1776.m26783
+from pkg1.pkg22.pkg290 import m10709
+import pkg2.m1
+from . import m31476
+
+
+def helper_35644_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,32 @@
+"""Module 12721."""
+import pkg7.pkg95.m94
+from pkg10.pkg138.pkg1804 import m5971
+from . import m217
+from pkg12.pkg163 import m4330
+import pkg11.pkg150.pkg1955.m1954
+from pkg4.pkg64.pkg840 import m9175
+from . import m6469
+from pkg11.pkg146 import m8481
+import pkg11.m10
+from pkg10.pkg137.pkg1786 import m3869
+
+
+def helper_12721_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12721_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_12721_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,12 @@
+"""Module 21057."""
+import pkg9.pkg126.pkg1639.m1638
+from pkg13.pkg179 import m178
+import pkg9.pkg126.pkg1639.m7890
+from pkg8.pkg106.pkg1386 import m3469
+
+
+def helper_21057_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 27309."""
+import pkg11.pkg152.pkg1980.m4063
+from . import m217
+from . import m2301
+
+
+def helper_27309_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_27309_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,9 @@
+"""Module 31477."""
+import pkg8.pkg111.pkg1456.m13959
+
+
+def helper_31477_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,9 @@
+"""Module 21058."""
+import pkg4.pkg58.pkg766.m765
+
+
+def helper_21058_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,36 @@
+"""Module 31478."""
+import pkg10.pkg138.pkg1798.m16385
+from pkg3.pkg52 import m16723
+from . import m2302
+from . import m23142
+import pkg9.pkg120.pkg1562.m1561
+from . import m18974
+from . import m14806
+
+
+def helper_31478_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_31478_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_31478_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_31478_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 33562."""
+import pkg5.pkg73.pkg960.m3043
+from pkg3.pkg48.pkg637 import m31896
+import pkg6.pkg89.pkg1163.m19918
+from pkg11 import m10
+import pkg4.pkg61.pkg797.m796
+
+
+def helper_33562_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_33562_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_33562_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,62 @@
+"""Module 4386."""
+import pkg8.pkg113.pkg1480.m3563
+from pkg11.pkg156.pkg2029 import m2028
+import pkg10.pkg136.pkg1775.m3858
+from pkg8.pkg106.pkg1388 import m1387
+import pkg7.m6
+from pkg8 import m7
+from . import m2302
+from pkg4.pkg55.pkg722 import m721
+import pkg7.pkg104.pkg1361.m3444
+from pkg2.pkg36.pkg479 import m478
+import pkg4.pkg59.pkg768.m767
+from pkg2 import m1
+
+
+def helper_4386_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4386_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4386_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4386_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_4386_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_4386_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4386_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
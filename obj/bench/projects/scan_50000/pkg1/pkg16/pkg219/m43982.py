@@ -0,0 +1,39 @@
+"""Module 43982."""
+import pkg1.pkg21.pkg282.m29457
+from pkg2.pkg30 import m29
+from . import m33562
+from pkg11.pkg152.pkg1984 import m1983
+import pkg1.pkg16.m15
+from pkg3.pkg42.pkg557 import m27648
+import pkg2.pkg35.pkg468.m10887
+from pkg11.pkg146.pkg1907 import m35250
+import pkg1.pkg17.m16
+from . import m29394
+
+
+def helper_43982_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_43982_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_43982_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_43982_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
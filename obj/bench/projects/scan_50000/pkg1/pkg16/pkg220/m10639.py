@@ -0,0 +1,7 @@
+"""Module 10639."""
+import pkg7.pkg103.pkg1345.m9680
+from . import m219
+from . import m6471
+from pkg4.pkg53.pkg695 import m694
+import pkg1.pkg14.pkg193.m10612
+from pkg10.pkg132.pkg1718 import m5885
@@ -0,0 +1,19 @@
+"""Module 16891."""
+import pkg1.pkg15.m14
+from pkg1.pkg23.pkg300 import m299
+import pkg11.pkg154.pkg2011.m6178
+from pkg5.pkg77.pkg1011 import m5178
+import pkg1.pkg25.pkg329.m4496
+from pkg1 import m0
+import pkg10.pkg131.pkg1716.m3799
+from . import m12723
+from . import m14807
+from pkg4.pkg57.pkg746 import m745
+import pkg9.pkg125.pkg1632.m9967
+
+
+def helper_16891_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 2303."""
+from . import m219
+from pkg1.pkg19.pkg256 import m255
+import pkg1.pkg14.pkg190.m189
+from pkg4.pkg57.pkg753 import m752
+import pkg7.pkg98.pkg1276.m1275
+from pkg2.pkg34.pkg447 import m446
+import pkg2.pkg37.pkg489.m488
+from pkg7.pkg99.pkg1290 import m1289
+import pkg2.pkg33.m32
+from pkg3 import m2
+
+
+def helper_2303_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2303_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
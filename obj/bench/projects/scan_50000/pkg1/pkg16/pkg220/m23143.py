@@ -0,0 +1,25 @@
+"""Module 23143."""
+import pkg8.pkg110.pkg1440.m1439
+from pkg3.pkg44.pkg584 import m13087
+import pkg1.pkg14.m13
+from pkg2 import m1
+import pkg7.pkg97.pkg1271.m1270
+from . import m21059
+import pkg1.m0
+from . import m4387
+import pkg1.pkg15.pkg204.m4371
+from pkg2.pkg37.pkg491 import m490
+
+
+def helper_23143_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_23143_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,46 @@
+"""Module 29395."""
+import pkg6.pkg82.pkg1076.m1075
+from pkg1.pkg16.pkg219 import m218
+import pkg5.pkg78.pkg1015.m1014
+from pkg5.pkg77.pkg1009 import m13512
+import pkg2.pkg33.pkg432.m431
+from pkg6.pkg86.pkg1123 import m1122
+import pkg2.pkg29.m28
+from . import m8555
+import pkg2.pkg31.pkg413.m4580
+from pkg4.pkg55 import m54
+
+
+def helper_29395_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_29395_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_29395_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_29395_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_29395_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 16892."""
+import pkg7.pkg102.m16773
+from . import m220
+import pkg10.pkg134.pkg1750.m8001
+from pkg2.pkg39.pkg519 import m2602
+import pkg10.pkg131.pkg1711.m1710
+from pkg9.pkg123.pkg1607 import m9942
+from . import m6472
+from pkg1.pkg25 import m24
+from . import m8556
+from pkg9 import m8
+import pkg4.pkg56.pkg734.m733
+from pkg1.pkg24.pkg319 import m6570
+
+
+def helper_16892_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16892_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
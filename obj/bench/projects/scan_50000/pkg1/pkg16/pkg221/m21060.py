@@ -0,0 +1,24 @@
+"""Module 21060."""
+import pkg1.pkg17.pkg224.m2307
+from . import m6472
+import pkg1.m0
+from pkg12.pkg167 import m166
+import pkg3.pkg45.pkg586.m4753
+from pkg1.pkg23.pkg300 import m6551
+import pkg7.pkg97.pkg1268.m5435
+from pkg1.pkg16 import m12519
+import pkg11.pkg150.m2233
+
+
+def helper_21060_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_21060_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,39 @@
+"""Module 25228."""
+import pkg5.m4
+from pkg10.pkg132.pkg1725 import m1724
+import pkg1.pkg19.pkg255.m4422
+from pkg6.pkg85.pkg1114 import m9449
+import pkg11.pkg145.pkg1892.m6059
+from pkg4.pkg58.pkg764 import m4931
+from . import m14808
+from pkg2.pkg27.pkg360 import m4527
+import pkg10.pkg141.pkg1843.m1842
+from pkg8.pkg115 import m114
+
+
+def helper_25228_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_25228_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_25228_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_25228_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,54 @@
+"""Module 37732."""
+import pkg10.pkg131.pkg1708.m12127
+from pkg6.pkg86.pkg1120 import m7371
+import pkg8.pkg114.pkg1494.m1493
+from pkg2.pkg36.pkg479 import m478
+import pkg1.pkg23.pkg307.m14894
+from pkg1 import m0
+import pkg10.pkg131.m23054
+from pkg6.pkg81.pkg1055 import m34398
+import pkg10.pkg141.pkg1836.m6003
+from pkg5.pkg70.pkg915 import m34258
+from . import m4388
+
+
+def helper_37732_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37732_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_37732_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_37732_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_37732_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_37732_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
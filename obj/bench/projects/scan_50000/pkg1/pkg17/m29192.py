@@ -0,0 +1,45 @@
+"""Module 29192."""
+from . import m22940
+from pkg4.pkg56.pkg740 import m27831
+from . import m18772
+from pkg1.pkg17.pkg226 import m225
+import pkg2.pkg29.pkg387.m386
+from pkg4.pkg65.pkg856 import m7107
+import pkg3.pkg42.pkg549.m548
+from . import m16
+import pkg2.pkg28.pkg366.m25373
+
+
+def helper_29192_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_29192_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_29192_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_29192_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_29192_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
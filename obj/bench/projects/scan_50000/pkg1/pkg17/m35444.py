@@ -0,0 +1,41 @@
+"""Module 35444."""
+import pkg3.pkg42.m10461
+from pkg2.pkg39.pkg515 import m15102
+import pkg8.pkg109.pkg1427.m11846
+from pkg7 import m6
+import pkg10.pkg139.pkg1814.m3897
+from pkg8.pkg111.pkg1456 import m1455
+import pkg6.pkg91.m90
+from pkg5.pkg68.pkg890 import m889
+import pkg7.pkg97.pkg1271.m24194
+from pkg12.pkg160.pkg2084 import m25007
+import pkg9.pkg127.pkg1652.m32911
+from pkg1.pkg22.pkg295 import m2378
+
+
+def helper_35444_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35444_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_35444_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_35444_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
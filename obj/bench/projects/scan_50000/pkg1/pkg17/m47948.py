@@ -0,0 +1,34 @@
+"""Module 47948."""
+import pkg5.pkg78.m12581
+from pkg10.pkg141.pkg1844 import m43523
+from . import m45864
+from pkg4.pkg61.pkg803 import m29978
+import pkg9.pkg122.pkg1596.m9931
+from . import m2100
+import pkg4.pkg65.pkg856.m11275
+from pkg11.pkg155.pkg2019 import m6186
+import pkg9.pkg127.pkg1661.m5828
+from pkg3.pkg51.pkg671 import m2754
+import pkg9.pkg123.pkg1609.m28700
+from . import m43780
+
+
+def helper_47948_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_47948_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_47948_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 8352."""
+from . import m6268
+from pkg4.pkg53.pkg696 import m695
+from . import m4184
+from pkg1 import m0
+import pkg3.pkg42.pkg550.m549
+from pkg9.pkg125.pkg1635 import m1634
+import pkg3.pkg43.pkg563.m2646
+from pkg10.pkg139.pkg1816 import m3899
+import pkg9.pkg128.pkg1672.m7923
+from pkg12.pkg166 import m2249
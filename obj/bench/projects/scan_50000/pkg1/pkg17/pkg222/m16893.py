@@ -0,0 +1,37 @@
+"""Module 16893."""
+import pkg11.pkg153.pkg1991.m1990
+from . import m10641
+import pkg8.pkg116.pkg1511.m1510
+from . import m4389
+import pkg7.pkg101.m100
+from pkg10.pkg133.pkg1741 import m3824
+from . import m221
+from pkg5.pkg66.pkg863 import m9198
+
+
+def helper_16893_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16893_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_16893_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_16893_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,53 @@
+"""Module 25229."""
+import pkg11.m10
+from pkg5.pkg69.pkg903 import m902
+import pkg5.pkg78.pkg1022.m17693
+from pkg11.pkg152.pkg1986 import m6153
+from . import m8557
+from pkg10.pkg142.pkg1859 import m8110
+import pkg8.pkg112.m8447
+from pkg6.pkg88.pkg1149 import m5316
+import pkg11.pkg148.pkg1937.m8188
+from . import m10641
+
+
+def helper_25229_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_25229_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_25229_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_25229_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_25229_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_25229_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,54 @@
+"""Module 4389."""
+import pkg8.pkg109.pkg1425.m1424
+from . import m221
+from . import m2305
+from pkg8.pkg115.pkg1508 import m1507
+import pkg2.pkg30.m29
+from pkg5.pkg69.pkg905 import m904
+import pkg2.pkg39.m38
+from pkg5.pkg77.pkg1008 import m1007
+import pkg6.pkg86.m2169
+from pkg5.pkg77 import m4244
+import pkg1.pkg14.pkg192.m191
+
+
+def helper_4389_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4389_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4389_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4389_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_4389_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_4389_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
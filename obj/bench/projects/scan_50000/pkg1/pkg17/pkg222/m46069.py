@@ -0,0 +1,48 @@
+"""Module 46069."""
+import pkg4.pkg56.pkg734.m2817
+from pkg8.pkg111 import m31370
+from . import m41901
+from . import m14809
+import pkg9.pkg127.pkg1652.m45415
+from pkg3.pkg48.pkg628 import m11047
+import pkg4.pkg57.pkg744.m2827
+from pkg6 import m5
+import pkg1.m0
+from pkg5.pkg68.pkg892 import m19647
+import pkg9.pkg125.pkg1633.m14136
+from pkg3.pkg42.pkg549 import m6800
+
+
+def helper_46069_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_46069_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_46069_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_46069_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_46069_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 21062."""
+import pkg6.pkg79.pkg1030.m15617
+from pkg11.pkg144.pkg1885 import m20640
+import pkg1.m0
+from pkg4.pkg59 import m58
+import pkg9.pkg129.pkg1690.m3773
+from . import m16894
+from . import m18978
+from . import m14810
+import pkg6.pkg89.pkg1158.m15745
+
+
+def helper_21062_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 31482."""
+import pkg6.pkg84.pkg1100.m1099
+from pkg9.pkg121.pkg1585 import m1584
+import pkg4.pkg60.pkg788.m787
+
+
+def helper_31482_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_31482_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_31482_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
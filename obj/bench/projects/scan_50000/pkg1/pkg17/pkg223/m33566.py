@@ -0,0 +1,33 @@
+"""Module 33566."""
+from . import m31482
+from pkg2.pkg33.pkg437 import m8772
+import pkg6.pkg86.pkg1120.m11539
+from pkg8.pkg116.pkg1518 import m32777
+import pkg5.pkg72.m22995
+from pkg6.pkg89.pkg1159 import m3242
+import pkg3.pkg42.pkg555.m554
+from pkg10.pkg135.pkg1760 import m12179
+import pkg9.pkg128.pkg1672.m5839
+from . import m8558
+import pkg7.pkg103.pkg1348.m1347
+
+
+def helper_33566_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_33566_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_33566_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
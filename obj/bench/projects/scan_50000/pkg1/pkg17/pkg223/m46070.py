@@ -0,0 +1,53 @@
+"""Module 46070."""
+import pkg6.pkg86.pkg1129.m36556
+from pkg8.pkg115.pkg1507 import m1506
+import pkg1.pkg24.pkg313.m12816
+from . import m25230
+import pkg4.pkg65.pkg857.m856
+from pkg5.pkg69.pkg900 import m5067
+import pkg1.pkg17.m16
+from pkg9.pkg125.pkg1633 import m12052
+import pkg1.pkg26.m25
+from pkg4.pkg53.pkg696 import m29871
+
+
+def helper_46070_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_46070_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_46070_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_46070_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_46070_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_46070_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
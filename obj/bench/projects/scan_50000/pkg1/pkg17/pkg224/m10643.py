@@ -0,0 +1,4 @@
+"""Module 10643."""
+import pkg8.pkg114.pkg1493.m7744
+from pkg5.pkg72.pkg948 import m7199
+import pkg1.pkg25.pkg338.m337
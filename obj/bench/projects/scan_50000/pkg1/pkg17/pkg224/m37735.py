@@ -0,0 +1,16 @@
+"""Module 37735."""
+import pkg7.pkg94.pkg1229.m11648
+from pkg10.pkg135.pkg1760 import m35103
+import pkg4.m3
+from pkg1.pkg26.pkg339 import m12842
+import pkg5.pkg66.pkg864.m2947
+from pkg5.pkg66.pkg871 import m7122
+from . import m35651
+from pkg1.pkg24.pkg320 import m16991
+
+
+def helper_37735_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
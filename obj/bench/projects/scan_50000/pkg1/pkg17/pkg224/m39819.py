@@ -0,0 +1,34 @@
+"""Module 39819."""
+from . import m27315
+from pkg5.pkg67 import m6318
+import pkg3.pkg45.pkg586.m585
+from pkg7.pkg99.pkg1288 import m24211
+import pkg2.pkg27.pkg361.m360
+from pkg12.pkg159.pkg2071 import m33330
+import pkg1.pkg17.m16
+from pkg12.pkg164 import m4331
+import pkg1.pkg21.m20
+from . import m223
+import pkg4.pkg61.pkg804.m38315
+from pkg5.pkg76 import m75
+
+
+def helper_39819_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39819_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_39819_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
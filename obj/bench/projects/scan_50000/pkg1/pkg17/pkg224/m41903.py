@@ -0,0 +1,26 @@
+"""Module 41903."""
+import pkg5.pkg75.pkg987.m7238
+from pkg2.pkg33.pkg430 import m2513
+import pkg1.pkg15.pkg202.m4369
+from . import m6475
+
+
+def helper_41903_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_41903_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_41903_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
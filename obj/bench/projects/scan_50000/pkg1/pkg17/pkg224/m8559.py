@@ -0,0 +1,16 @@
+"""Module 8559."""
+import pkg2.pkg27.m4194
+from pkg7.pkg98 import m97
+import pkg1.pkg20.pkg267.m266
+from pkg3.pkg43.pkg571 import m4738
+import pkg1.m0
+from pkg7.pkg101.pkg1323 import m3406
+import pkg2.pkg38.pkg497.m6748
+from pkg10.pkg141.pkg1838 import m3921
+
+
+def helper_8559_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,15 @@
+"""Module 10644."""
+from . import m8560
+from . import m4392
+from . import m2308
+from pkg4.pkg58.pkg761 import m4928
+import pkg5.pkg66.pkg868.m9203
+from pkg3.pkg49 import m8384
+import pkg7.pkg98.pkg1281.m1280
+
+
+def helper_10644_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
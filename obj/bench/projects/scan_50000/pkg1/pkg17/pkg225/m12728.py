@@ -0,0 +1,37 @@
+"""Module 12728."""
+import pkg2.pkg31.m12534
+from pkg12.pkg159 import m4326
+import pkg10.pkg137.pkg1787.m1786
+from pkg2 import m1
+import pkg8.pkg108.pkg1407.m1406
+from pkg12.pkg167 import m166
+from . import m2308
+from . import m10644
+
+
+def helper_12728_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12728_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_12728_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_12728_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,47 @@
+"""Module 18980."""
+import pkg6.pkg89.pkg1164.m3247
+from pkg7.pkg96.pkg1255 import m1254
+import pkg8.pkg117.pkg1522.m3605
+from pkg5.pkg73.pkg959 import m5126
+import pkg4.pkg57.pkg753.m752
+from pkg7.pkg99.pkg1294 import m5461
+from . import m10644
+from pkg11 import m10
+import pkg4.pkg59.m58
+from pkg8.pkg112.pkg1459 import m1458
+from . import m16896
+
+
+def helper_18980_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_18980_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_18980_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_18980_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_18980_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,29 @@
+"""Module 224."""
+import pkg1.m0
+from pkg9.pkg119 import m118
+import pkg1.pkg16.pkg220.m219
+from pkg11.pkg155 import m154
+import pkg3.pkg46.m45
+from pkg13 import m12
+import pkg3.pkg49.m48
+
+
+def helper_224_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_224_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_224_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,33 @@
+"""Module 35652."""
+from . import m12728
+from pkg2 import m1
+import pkg2.pkg32.m31
+from pkg7.pkg99 import m20938
+import pkg10.pkg139.pkg1817.m3900
+from pkg3.pkg42.pkg553 import m2636
+from . import m6476
+from pkg6.pkg82.pkg1079 import m5246
+from . import m27316
+from pkg5.pkg70.pkg911 import m34254
+import pkg1.pkg18.pkg240.m16911
+
+
+def helper_35652_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35652_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_35652_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
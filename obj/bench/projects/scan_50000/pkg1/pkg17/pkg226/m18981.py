@@ -0,0 +1,27 @@
+"""Module 18981."""
+import pkg7.pkg95.pkg1242.m7493
+from pkg8.pkg106.pkg1384 import m7635
+import pkg2.pkg33.pkg437.m436
+from pkg3.pkg46.pkg611 import m13114
+import pkg4.pkg58.pkg764.m15351
+from pkg6.pkg84.pkg1095 import m3178
+import pkg8.pkg112.pkg1469.m1468
+from pkg3.pkg47.pkg612 import m11031
+from . import m8561
+from pkg5.pkg68.pkg890 import m889
+import pkg2.pkg37.pkg482.m481
+from . import m4393
+
+
+def helper_18981_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_18981_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 21065."""
+import pkg9.pkg123.m122
+from pkg5.pkg70.pkg921 import m19676
+import pkg1.pkg23.pkg303.m6554
+from . import m8561
+import pkg5.pkg75.pkg978.m17649
+from pkg9.pkg126 import m4293
+import pkg4.pkg62.pkg815.m2898
+from pkg7.pkg104.pkg1359 import m5526
+import pkg1.pkg17.pkg224.m12727
+from pkg2.pkg34.pkg455 import m454
+import pkg4.pkg65.m64
+
+
+def helper_21065_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_21065_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,69 @@
+"""Module 16898."""
+import pkg1.pkg19.pkg250.m2333
+from pkg1.pkg18.pkg240 import m239
+import pkg6.pkg81.pkg1065.m5232
+from pkg2.pkg38.pkg499 import m498
+import pkg2.pkg29.pkg384.m383
+from pkg9.pkg121.pkg1578 import m1577
+import pkg3.pkg51.m50
+from pkg1.pkg18 import m17
+from . import m6478
+from pkg5.pkg74.pkg963 import m3046
+import pkg8.pkg113.pkg1482.m5649
+from pkg3.pkg44.pkg585 import m15172
+
+
+def helper_16898_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16898_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_16898_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_16898_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_16898_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_16898_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16898_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_16898_42(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
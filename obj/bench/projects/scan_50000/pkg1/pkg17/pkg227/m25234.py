@@ -0,0 +1,34 @@
+"""Module 25234."""
+import pkg9.pkg129.pkg1681.m1680
+from . import m21066
+import pkg2.pkg34.m33
+from pkg5.pkg75.pkg983 import m3066
+import pkg11.pkg149.pkg1946.m1945
+from pkg3.pkg51.pkg675 import m6926
+import pkg1.pkg21.pkg276.m275
+from pkg12.pkg160 import m159
+import pkg1.pkg22.pkg293.m292
+from pkg4.pkg54.pkg706 import m705
+import pkg1.pkg25.pkg326.m12829
+from pkg6.pkg83.pkg1088 import m11507
+
+
+def helper_25234_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_25234_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_25234_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 31486."""
+import pkg8.pkg105.pkg1372.m9707
+from pkg11.pkg153.pkg1994 import m1993
+
+
+def helper_31486_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_31486_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
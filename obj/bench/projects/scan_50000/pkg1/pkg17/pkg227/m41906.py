@@ -0,0 +1,23 @@
+"""Module 41906."""
+import pkg12.pkg159.pkg2073.m4156
+from . import m25234
+import pkg6.pkg79.m78
+from pkg2.pkg29 import m28
+import pkg2.pkg33.m32
+from pkg6.pkg81.pkg1062 import m32321
+import pkg11.pkg150.pkg1956.m20711
+from pkg5 import m4
+
+
+def helper_41906_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_41906_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 12731."""
+from . import m227
+from pkg11.pkg151.pkg1976 import m4059
+
+
+def helper_12731_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12731_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
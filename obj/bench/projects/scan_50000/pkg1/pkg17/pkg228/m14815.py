@@ -0,0 +1,15 @@
+"""Module 14815."""
+import pkg1.pkg19.pkg260.m259
+from . import m2311
+import pkg5.pkg78.pkg1019.m5186
+from pkg4.pkg65.pkg849 import m848
+import pkg1.m0
+from pkg2.pkg27.pkg356 import m6607
+import pkg8.pkg117.pkg1530.m1529
+
+
+def helper_14815_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
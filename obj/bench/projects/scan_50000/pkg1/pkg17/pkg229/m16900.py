@@ -0,0 +1,35 @@
+"""Module 16900."""
+import pkg2.m1
+from pkg6.pkg87.pkg1137 import m3220
+import pkg1.m0
+from pkg4.pkg64.pkg843 import m2926
+import pkg7.pkg100.m2183
+from pkg12.pkg159.pkg2071 import m4154
+
+
+def helper_16900_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16900_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_16900_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_16900_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,30 @@
+"""Module 18984."""
+import pkg11.pkg151.pkg1966.m10301
+from pkg2.pkg34.pkg447 import m15034
+import pkg1.pkg25.pkg336.m6587
+from pkg5.pkg70.pkg917 import m916
+from . import m14816
+from pkg1 import m0
+import pkg2.pkg29.pkg380.m2463
+from . import m12732
+
+
+def helper_18984_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_18984_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_18984_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,37 @@
+"""Module 2312."""
+import pkg1.m0
+from pkg9.pkg124.pkg1624 import m1623
+from . import m228
+from pkg4.pkg59.pkg779 import m778
+import pkg5.pkg71.pkg933.m932
+from pkg4 import m3
+import pkg4.pkg54.pkg714.m713
+from pkg9.pkg120.pkg1571 import m1570
+
+
+def helper_2312_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2312_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2312_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2312_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
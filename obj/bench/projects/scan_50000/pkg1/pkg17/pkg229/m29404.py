@@ -0,0 +1,18 @@
+"""Module 29404."""
+import pkg2.pkg28.m27
+from . import m23152
+import pkg4.pkg60.pkg785.m784
+
+
+def helper_29404_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_29404_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,46 @@
+"""Module 31488."""
+import pkg11.pkg151.pkg1965.m12384
+from pkg4.pkg55 import m18810
+import pkg6.pkg79.pkg1028.m1027
+from pkg4.pkg53.pkg696 import m2779
+import pkg5.pkg74.pkg964.m17635
+from pkg3.pkg43.pkg567 import m4734
+import pkg1.pkg23.pkg300.m16971
+from pkg2.pkg28.pkg376 import m17047
+import pkg9.pkg122.pkg1591.m1590
+from . import m2312
+
+
+def helper_31488_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_31488_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_31488_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_31488_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_31488_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
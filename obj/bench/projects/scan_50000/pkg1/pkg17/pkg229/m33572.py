@@ -0,0 +1,42 @@
+"""Module 33572."""
+import pkg1.pkg16.pkg212.m211
+from pkg10.pkg135 import m10554
+import pkg3.pkg52.pkg686.m685
+from pkg7.pkg93.pkg1220 import m28311
+import pkg2.pkg36.pkg476.m15063
+from pkg10.pkg135.pkg1758 import m16345
+
+
+def helper_33572_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_33572_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_33572_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_33572_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_33572_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
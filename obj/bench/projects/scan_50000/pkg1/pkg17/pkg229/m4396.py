@@ -0,0 +1,54 @@
+"""Module 4396."""
+from . import m2312
+from pkg5.pkg77.pkg1004 import m1003
+import pkg1.pkg17.pkg226.m225
+from pkg4.pkg63.pkg830 import m2913
+import pkg9.pkg126.m125
+from pkg1.pkg21 import m20
+import pkg11.pkg152.pkg1983.m4066
+from pkg1.pkg17.pkg233 import m232
+import pkg9.pkg118.m117
+from pkg8.pkg109.pkg1428 import m3511
+import pkg8.pkg107.pkg1404.m1403
+
+
+def helper_4396_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4396_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4396_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4396_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_4396_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_4396_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,38 @@
+"""Module 43992."""
+import pkg9.pkg125.pkg1638.m5805
+from pkg3.pkg51.pkg666 import m11085
+import pkg1.pkg19.pkg254.m253
+from pkg6.pkg82 import m81
+import pkg2.pkg33.pkg435.m434
+from . import m35656
+import pkg1.pkg15.pkg205.m8540
+from pkg1.pkg25.pkg329 import m328
+from . import m27320
+
+
+def helper_43992_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_43992_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_43992_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_43992_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,46 @@
+"""Module 48160."""
+import pkg4.pkg65.pkg856.m7107
+from pkg6.pkg90.pkg1175 import m22014
+import pkg6.pkg85.pkg1112.m1111
+from pkg8.pkg112.pkg1457 import m1456
+import pkg5.pkg67.pkg878.m9213
+from pkg5.pkg68.pkg890 import m21729
+import pkg3.pkg44.pkg585.m46432
+from pkg6.pkg86.pkg1124 import m5291
+import pkg5.pkg69.pkg904.m903
+from . import m37740
+
+
+def helper_48160_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_48160_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_48160_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_48160_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_48160_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,37 @@
+"""Module 6480."""
+import pkg10.pkg141.pkg1841.m1840
+from pkg5.pkg69 import m2152
+import pkg2.pkg33.pkg435.m434
+from pkg2.pkg34.pkg449 import m448
+import pkg1.m0
+from pkg4.pkg65 import m64
+import pkg6.pkg82.pkg1072.m3155
+from pkg2.pkg36.pkg476 import m4643
+
+
+def helper_6480_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6480_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6480_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6480_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,30 @@
+"""Module 12733."""
+import pkg9.pkg121.m120
+from pkg4.pkg62.pkg816 import m9151
+import pkg2.pkg27.pkg354.m353
+from . import m6481
+import pkg3.pkg41.pkg539.m538
+from pkg11.pkg146.pkg1904 import m6071
+import pkg3.pkg52.pkg685.m684
+from pkg10.pkg136.pkg1781 import m10116
+
+
+def helper_12733_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12733_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_12733_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
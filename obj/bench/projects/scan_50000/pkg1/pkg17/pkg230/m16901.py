@@ -0,0 +1,9 @@
+"""Module 16901."""
+import pkg6.pkg91.pkg1189.m9524
+
+
+def helper_16901_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
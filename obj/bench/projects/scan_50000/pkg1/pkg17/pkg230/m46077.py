@@ -0,0 +1,17 @@
+"""Module 46077."""
+import pkg11.pkg145.pkg1889.m28980
+from pkg6.pkg79 import m78
+
+
+def helper_46077_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_46077_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,52 @@
+"""Module 10650."""
+import pkg3.pkg47.pkg621.m8956
+from pkg3.pkg51.pkg672 import m671
+import pkg3.pkg50.pkg653.m6904
+from pkg8.pkg112.pkg1464 import m3547
+import pkg5.pkg77.m76
+from pkg4 import m3
+import pkg4.pkg62.pkg812.m2895
+from pkg5.pkg77.pkg1005 import m1004
+import pkg5.pkg67.pkg883.m882
+
+
+def helper_10650_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10650_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_10650_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_10650_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_10650_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_10650_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
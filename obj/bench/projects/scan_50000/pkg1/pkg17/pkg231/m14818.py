@@ -0,0 +1,17 @@
+"""Module 14818."""
+import pkg4.pkg61.pkg802.m4969
+from pkg1 import m0
+import pkg9.pkg122.m4289
+from pkg10.pkg140.pkg1825 import m10160
+import pkg3.pkg48.pkg632.m2715
+from pkg8.pkg116.pkg1514 import m1513
+import pkg6.pkg81.pkg1060.m1059
+from . import m10650
+import pkg4.pkg56.pkg740.m2823
+
+
+def helper_14818_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,32 @@
+"""Module 21070."""
+import pkg1.pkg24.pkg315.m314
+from pkg11.pkg153.pkg1996 import m14499
+from . import m4398
+from pkg2.pkg28.pkg366 import m365
+import pkg8.pkg106.m105
+from pkg13.pkg170 import m169
+from . import m6482
+from pkg7.pkg93 import m18848
+import pkg4.pkg57.pkg747.m2830
+from . import m2314
+
+
+def helper_21070_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_21070_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_21070_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,32 @@
+"""Module 27322."""
+import pkg1.m0
+from pkg2.pkg29.pkg378 import m377
+import pkg6.pkg90.pkg1176.m3259
+from . import m6482
+import pkg3.pkg43.pkg570.m8905
+from pkg6.pkg87.pkg1142 import m3225
+import pkg7.pkg99.pkg1291.m22130
+from pkg10.pkg142 import m141
+import pkg5.pkg67.pkg878.m5045
+from pkg8.pkg110.pkg1443 import m20198
+
+
+def helper_27322_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_27322_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_27322_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
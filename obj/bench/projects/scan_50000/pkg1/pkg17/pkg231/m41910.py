@@ -0,0 +1,21 @@
+"""Module 41910."""
+import pkg7.pkg103.pkg1342.m5509
+from pkg2.pkg29.pkg382 import m14969
+import pkg1.pkg14.pkg193.m21032
+from pkg5.pkg75.pkg978 import m9313
+from . import m21070
+from . import m33574
+
+
+def helper_41910_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_41910_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
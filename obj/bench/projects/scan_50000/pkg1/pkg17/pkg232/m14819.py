@@ -0,0 +1,27 @@
+"""Module 14819."""
+import pkg1.pkg16.m15
+from pkg3.pkg42.pkg559 import m8894
+import pkg4.pkg53.pkg695.m694
+from . import m2315
+import pkg1.pkg16.pkg213.m212
+from pkg2.pkg32 import m31
+import pkg11.pkg146.pkg1908.m10243
+from pkg10.pkg139.pkg1810 import m1809
+import pkg11.pkg150.pkg1959.m10294
+from pkg11.pkg156.pkg2039 import m12458
+import pkg3.pkg47.m46
+from pkg3.pkg52 import m51
+
+
+def helper_14819_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14819_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 21071."""
+from . import m231
+from pkg7 import m6
+import pkg5.pkg70.pkg921.m920
+
+
+def helper_21071_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 231."""
+import pkg12.m11
+from pkg11.pkg145 import m144
+import pkg10.m9
+from pkg1 import m0
+import pkg1.pkg15.pkg200.m199
+from pkg13 import m12
+import pkg1.pkg18.m17
+from pkg2 import m1
+import pkg1.pkg14.pkg193.m192
+from pkg2.pkg35 import m34
+
+
+def helper_231_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_231_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,16 @@
+"""Module 35659."""
+import pkg5.pkg69.m2152
+from pkg1.pkg25.pkg329 import m328
+import pkg9.pkg130.pkg1701.m3784
+from pkg2.pkg28.pkg374 import m4541
+from . import m27323
+from pkg8.pkg116.pkg1520 import m1519
+import pkg9.pkg124.pkg1624.m3707
+from pkg2.pkg38 import m37
+
+
+def helper_35659_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
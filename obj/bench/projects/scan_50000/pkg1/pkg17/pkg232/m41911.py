@@ -0,0 +1,26 @@
+"""Module 41911."""
+import pkg6.pkg81.pkg1056.m26063
+from pkg8.pkg107.pkg1397 import m28488
+import pkg1.pkg18.pkg243.m4410
+from pkg11.pkg146.pkg1902 import m1901
+import pkg9.pkg118.pkg1545.m1544
+from pkg10.pkg138.pkg1796 import m14299
+import pkg2.pkg27.pkg359.m39954
+from pkg11.pkg148.pkg1932 import m1931
+import pkg7.pkg103.pkg1349.m1348
+from pkg10.pkg138.pkg1797 import m3880
+import pkg11.pkg153.pkg1999.m33258
+
+
+def helper_41911_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_41911_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,41 @@
+"""Module 43995."""
+import pkg6.pkg91.pkg1191.m19946
+from pkg5.pkg78 import m2161
+import pkg10.pkg137.pkg1792.m1791
+from pkg3.pkg50.pkg663 import m21502
+import pkg7.pkg101.pkg1314.m1313
+from pkg1.pkg23.pkg311 import m29486
+import pkg2.pkg35.pkg463.m462
+from pkg3.pkg40 import m39
+import pkg4.pkg62.pkg807.m7058
+from . import m35659
+import pkg7.pkg99.m98
+from pkg11.pkg153.pkg1994 import m24917
+
+
+def helper_43995_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_43995_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_43995_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_43995_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 18988."""
+import pkg3.pkg40.pkg522.m4689
+from pkg3.pkg43.pkg563 import m562
+import pkg1.pkg20.pkg272.m271
+from . import m16904
+import pkg7.pkg103.pkg1345.m9680
+
+
+def helper_18988_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_18988_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,15 @@
+"""Module 2316."""
+from . import m232
+from pkg11.pkg153 import m152
+import pkg5.pkg75.m74
+from pkg5.pkg73 import m72
+import pkg10.pkg142.m141
+from pkg2.pkg33.pkg440 import m439
+import pkg3.pkg41.pkg536.m535
+
+
+def helper_2316_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 31492."""
+import pkg1.pkg24.pkg315.m314
+from pkg7.pkg99.pkg1291 import m13794
+from . import m2316
+from pkg4.pkg61.pkg795 import m794
+import pkg2.pkg27.pkg352.m25359
+from pkg5.pkg69.pkg905 import m25912
+from . import m232
+from pkg1.pkg17.pkg224 import m8559
+import pkg4.pkg58.m57
+from pkg10.pkg141.pkg1834 import m6001
+
+
+def helper_31492_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
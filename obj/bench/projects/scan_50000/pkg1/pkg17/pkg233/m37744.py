@@ -0,0 +1,38 @@
+"""Module 37744."""
+import pkg4.pkg63.pkg828.m2911
+from . import m21072
+import pkg1.pkg14.pkg192.m10611
+from . import m35660
+from . import m8568
+from . import m25240
+import pkg13.pkg172.m6423
+from pkg1 import m0
+import pkg9.pkg121.pkg1577.m11996
+
+
+def helper_37744_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37744_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_37744_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_37744_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,37 @@
+"""Module 233."""
+import pkg2.m1
+from pkg3.pkg49 import m48
+import pkg8.m7
+from pkg2.pkg34 import m33
+import pkg1.m0
+from pkg1.pkg22 import m21
+import pkg1.pkg15.m14
+from pkg1.pkg17 import m16
+
+
+def helper_233_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_233_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_233_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_233_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,13 @@
+"""Module 27325."""
+import pkg7.pkg101.pkg1325.m3408
+from pkg9 import m2092
+import pkg8.pkg106.pkg1383.m1382
+from pkg9.pkg122 import m2205
+import pkg3.pkg50.m49
+
+
+def helper_27325_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
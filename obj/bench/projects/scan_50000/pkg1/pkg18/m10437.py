@@ -0,0 +1,19 @@
+"""Module 10437."""
+import pkg1.pkg18.pkg235.m4402
+from pkg1.pkg15.pkg204 import m203
+import pkg3.pkg40.pkg526.m525
+from pkg2.pkg32.pkg429 import m2512
+import pkg8.pkg112.pkg1468.m1467
+from pkg9.pkg121.pkg1576 import m9911
+from . import m4185
+from pkg7.pkg94 import m93
+import pkg1.pkg17.m16
+from . import m2101
+import pkg10.pkg136.pkg1781.m8032
+
+
+def helper_10437_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,22 @@
+"""Module 12521."""
+import pkg5.pkg68.pkg897.m896
+from pkg6.pkg82.pkg1077 import m5244
+import pkg1.pkg20.pkg265.m264
+from pkg4.pkg61.pkg795 import m794
+import pkg1.pkg17.pkg222.m221
+from . import m17
+import pkg2.pkg29.pkg381.m380
+
+
+def helper_12521_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12521_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
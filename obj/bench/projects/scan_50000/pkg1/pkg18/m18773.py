@@ -0,0 +1,22 @@
+"""Module 18773."""
+import pkg1.m0
+from pkg2.pkg28 import m27
+import pkg11.m10
+from pkg2.pkg30 import m29
+from . import m4185
+from pkg3.pkg50.pkg653 import m2736
+import pkg1.pkg23.pkg308.m307
+
+
+def helper_18773_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_18773_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,22 @@
+"""Module 22941."""
+import pkg8.pkg106.pkg1382.m1381
+from pkg12.pkg158.pkg2066 import m22905
+import pkg4.pkg64.pkg840.m17511
+from . import m16689
+import pkg6.pkg79.pkg1033.m3116
+from pkg2 import m1
+from . import m12521
+
+
+def helper_22941_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_22941_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
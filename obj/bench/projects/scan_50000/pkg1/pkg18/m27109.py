@@ -0,0 +1,22 @@
+"""Module 27109."""
+import pkg10.pkg131.pkg1707.m1706
+from pkg8.pkg114.pkg1487 import m7738
+import pkg6.m5
+from pkg5.pkg77.pkg1003 import m5170
+from . import m17
+from . import m12521
+import pkg3.pkg44.m43
+
+
+def helper_27109_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_27109_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
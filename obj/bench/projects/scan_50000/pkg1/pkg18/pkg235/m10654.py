@@ -0,0 +1,53 @@
+"""Module 10654."""
+import pkg1.pkg23.m22
+from . import m8570
+import pkg10.pkg134.pkg1751.m3834
+from pkg5.pkg66.pkg863 import m862
+import pkg11.pkg149.pkg1947.m8198
+from pkg8.pkg107 import m106
+import pkg5.pkg70.pkg912.m2995
+from pkg2.pkg39.pkg518 import m517
+import pkg2.pkg36.pkg479.m2562
+from pkg3.pkg47.pkg624 import m2707
+
+
+def helper_10654_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10654_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_10654_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_10654_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_10654_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_10654_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
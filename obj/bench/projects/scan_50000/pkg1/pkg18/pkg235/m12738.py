@@ -0,0 +1,53 @@
+"""Module 12738."""
+import pkg11.pkg152.pkg1980.m12399
+from pkg3.pkg45.pkg586 import m8921
+import pkg8.pkg108.pkg1410.m1409
+from . import m10654
+import pkg11.pkg147.pkg1915.m12334
+from pkg2.pkg30.pkg391 import m2474
+import pkg1.pkg16.pkg215.m214
+from pkg1.pkg23.pkg310 import m309
+import pkg11.pkg150.pkg1951.m1950
+from pkg3.pkg52.pkg681 import m9016
+
+
+def helper_12738_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12738_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_12738_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_12738_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_12738_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_12738_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
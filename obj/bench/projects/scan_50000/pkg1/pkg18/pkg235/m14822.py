@@ -0,0 +1,33 @@
+"""Module 14822."""
+import pkg6.pkg84.m4251
+from pkg2.pkg27 import m26
+import pkg9.pkg127.pkg1655.m1654
+from pkg3.pkg45 import m44
+import pkg8.pkg112.pkg1457.m5624
+from pkg6.pkg90.pkg1180 import m3263
+import pkg6.pkg79.pkg1029.m7280
+from pkg4.pkg56.pkg735 import m6986
+import pkg8.pkg114.pkg1486.m5653
+from pkg2 import m1
+import pkg6.m5
+
+
+def helper_14822_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14822_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_14822_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,46 @@
+"""Module 39830."""
+from . import m10654
+from pkg9.pkg121.pkg1580 import m7831
+import pkg7.pkg103.pkg1345.m3428
+from pkg11.pkg144 import m143
+import pkg5.pkg77.pkg1012.m1011
+from pkg11.pkg150.pkg1961 import m4044
+import pkg4.pkg60.pkg791.m11210
+from pkg3.pkg43 import m42
+import pkg10.pkg135.pkg1761.m5928
+from . import m35662
+
+
+def helper_39830_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39830_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_39830_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_39830_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_39830_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
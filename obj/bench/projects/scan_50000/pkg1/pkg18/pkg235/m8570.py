@@ -0,0 +1,39 @@
+"""Module 8570."""
+import pkg1.m0
+from . import m2318
+import pkg7.pkg92.pkg1207.m5374
+from pkg1.pkg14.pkg183 import m8518
+import pkg7.pkg104.pkg1364.m1363
+from pkg5.pkg73.pkg951 import m3034
+from . import m4402
+from . import m234
+import pkg9.pkg121.pkg1578.m1577
+from pkg4.pkg58.pkg760 import m7011
+
+
+def helper_8570_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8570_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8570_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8570_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,62 @@
+"""Module 25243."""
+import pkg11.pkg150.pkg1954.m18625
+from pkg8.pkg117.pkg1526 import m1525
+from . import m23159
+from pkg2.pkg39.pkg518 import m517
+from . import m14823
+from pkg1.pkg19 import m18
+import pkg3.pkg45.pkg587.m586
+from pkg11.pkg147.pkg1922 import m24845
+import pkg11.pkg154.pkg2005.m12424
+from pkg8.pkg113.pkg1475 import m7726
+from . import m21075
+from pkg1 import m0
+
+
+def helper_25243_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_25243_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_25243_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_25243_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_25243_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_25243_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_25243_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,30 @@
+"""Module 33579."""
+import pkg11.pkg154.pkg2015.m10350
+from . import m14823
+from . import m235
+from pkg9 import m8
+import pkg1.pkg21.pkg286.m285
+from pkg1 import m0
+import pkg3.pkg43.pkg568.m13071
+from pkg5.pkg66.pkg861 import m2944
+
+
+def helper_33579_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_33579_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_33579_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
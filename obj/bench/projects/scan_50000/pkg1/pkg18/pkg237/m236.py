@@ -0,0 +1,31 @@
+"""Module 236."""
+import pkg8.pkg113.m112
+from pkg1.pkg17.pkg223 import m222
+import pkg2.m1
+from pkg1.pkg17.pkg234 import m233
+import pkg4.m3
+from pkg1 import m0
+import pkg9.m8
+from pkg1.pkg17.pkg228 import m227
+import pkg1.pkg17.pkg225.m224
+
+
+def helper_236_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_236_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_236_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 27328."""
+import pkg4.pkg54.pkg714.m17385
+from pkg9.pkg121.pkg1575 import m7826
+import pkg12.pkg160.m159
+
+
+def helper_27328_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 37748."""
+import pkg9.pkg119.pkg1552.m9887
+from pkg11.pkg148.pkg1927 import m1926
+import pkg8.pkg109.pkg1428.m36855
+
+
+def helper_37748_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 12741."""
+from . import m6489
+from . import m237
+import pkg3.pkg40.m39
+from pkg1.pkg25.pkg328 import m2411
+import pkg1.pkg14.pkg189.m4356
+from pkg4.pkg61.pkg805 import m804
+from . import m2321
+from pkg10.pkg142.pkg1852 import m8103
+import pkg9.pkg125.pkg1626.m1625
+from pkg6.pkg87.pkg1142 import m5309
+import pkg2.pkg32.pkg420.m419
+
+
+def helper_12741_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12741_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
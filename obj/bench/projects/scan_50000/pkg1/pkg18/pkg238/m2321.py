@@ -0,0 +1,5 @@
+"""Module 2321."""
+import pkg2.pkg30.m29
+from . import m237
+import pkg3.pkg49.m48
+from pkg2.pkg39 import m38
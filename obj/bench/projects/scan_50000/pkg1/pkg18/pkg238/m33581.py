@@ -0,0 +1,62 @@
+"""Module 33581."""
+import pkg1.pkg25.pkg334.m333
+from pkg1.pkg22.pkg296 import m21135
+import pkg2.pkg39.pkg512.m17183
+from pkg1.pkg16 import m15
+import pkg2.pkg28.pkg368.m367
+from pkg1.pkg16.pkg211 import m33554
+import pkg2.pkg34.pkg446.m2529
+from . import m2321
+import pkg2.pkg32.pkg419.m418
+from pkg6.pkg79.pkg1039 import m23962
+import pkg6.pkg81.pkg1055.m23978
+from pkg8.pkg116.pkg1519 import m1518
+
+
+def helper_33581_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_33581_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_33581_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_33581_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_33581_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_33581_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_33581_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,36 @@
+"""Module 37749."""
+import pkg3.pkg51.pkg673.m2756
+from pkg6.pkg80.pkg1047 import m1046
+from . import m18993
+from pkg8.pkg105.pkg1370 import m1369
+import pkg5.pkg69.pkg907.m906
+from . import m10657
+from . import m14825
+
+
+def helper_37749_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37749_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_37749_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_37749_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,32 @@
+"""Module 4405."""
+from . import m237
+from pkg4.pkg63.pkg820 import m819
+from . import m2321
+from pkg3.pkg52.pkg683 import m682
+import pkg1.m0
+from pkg3.pkg43.pkg564 import m563
+import pkg4.pkg59.pkg775.m774
+from pkg2.pkg37.pkg486 import m485
+import pkg3.pkg44.pkg582.m581
+from pkg8.pkg106.pkg1379 import m1378
+
+
+def helper_4405_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4405_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4405_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
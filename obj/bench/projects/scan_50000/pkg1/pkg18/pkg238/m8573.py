@@ -0,0 +1,20 @@
+"""Module 8573."""
+import pkg2.pkg33.pkg436.m435
+from pkg1.pkg17.pkg223 import m6474
+import pkg5.pkg74.pkg974.m5141
+from pkg2 import m1
+from . import m4405
+from pkg4.pkg62.pkg809 import m808
+import pkg5.pkg72.pkg947.m946
+from pkg9.pkg125.pkg1628 import m5795
+import pkg1.pkg19.pkg258.m257
+from pkg3.pkg45.pkg591 import m4758
+import pkg7.pkg98.pkg1276.m1275
+from pkg10.pkg141 import m140
+
+
+def helper_8573_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
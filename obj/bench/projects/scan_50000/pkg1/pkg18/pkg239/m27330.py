@@ -0,0 +1,36 @@
+"""Module 27330."""
+import pkg8.pkg108.pkg1408.m5575
+from pkg3.pkg51.pkg676 import m675
+import pkg11.pkg146.pkg1910.m1909
+from pkg9.pkg129.pkg1683 import m1682
+import pkg3.m2
+from pkg2.pkg29.pkg384 import m2467
+import pkg4.pkg65.pkg857.m856
+
+
+def helper_27330_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_27330_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_27330_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_27330_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
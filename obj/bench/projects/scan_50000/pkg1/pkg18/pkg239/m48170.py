@@ -0,0 +1,46 @@
+"""Module 48170."""
+import pkg11.pkg147.pkg1924.m8175
+from . import m6490
+import pkg7.pkg101.pkg1325.m5492
+from pkg4.pkg55.pkg719 import m13222
+import pkg6.pkg84.pkg1104.m3187
+from pkg1.pkg20 import m19
+import pkg1.pkg18.pkg243.m242
+from . import m238
+import pkg7.pkg102.pkg1334.m28425
+from pkg2.pkg28.pkg375 import m374
+
+
+def helper_48170_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_48170_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_48170_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_48170_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_48170_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,10 @@
+"""Module 14827."""
+import pkg8.pkg108.pkg1410.m5577
+from . import m2323
+
+
+def helper_14827_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
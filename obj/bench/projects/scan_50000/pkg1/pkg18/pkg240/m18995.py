@@ -0,0 +1,45 @@
+"""Module 18995."""
+import pkg9.pkg118.m117
+from . import m10659
+import pkg5.pkg66.pkg867.m5034
+from pkg1.pkg21.pkg278 import m14865
+import pkg11.pkg153.pkg2000.m12419
+from pkg10.pkg137 import m10556
+import pkg8.m7
+from pkg11.pkg150.pkg1958 import m4041
+import pkg9.pkg128.pkg1672.m12091
+
+
+def helper_18995_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_18995_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_18995_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_18995_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_18995_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
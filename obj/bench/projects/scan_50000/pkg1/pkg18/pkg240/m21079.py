@@ -0,0 +1,53 @@
+"""Module 21079."""
+from . import m6491
+from pkg3.pkg48.pkg630 import m4797
+import pkg1.pkg21.pkg285.m284
+from pkg2.pkg32.pkg420 import m4587
+import pkg1.pkg16.pkg218.m2301
+from . import m239
+import pkg2.m1
+from pkg8 import m7
+import pkg12.pkg166.m4333
+from pkg8.pkg113.pkg1479 import m3562
+
+
+def helper_21079_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_21079_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_21079_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_21079_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_21079_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_21079_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1 @@
+"""Module 39835."""
@@ -0,0 +1,55 @@
+"""Module 48171."""
+import pkg4.pkg58.pkg758.m757
+from pkg7.pkg102 import m6353
+import pkg8.pkg106.m105
+from pkg8.pkg110.pkg1439 import m45202
+import pkg11.pkg150.pkg1961.m24884
+from . import m39835
+import pkg1.pkg23.pkg303.m4470
+from pkg3.pkg47.pkg614 import m613
+from . import m16911
+from . import m46087
+import pkg11.pkg144.pkg1884.m1883
+from pkg3.pkg46.pkg604 import m25611
+
+
+def helper_48171_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_48171_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_48171_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_48171_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_48171_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_48171_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,13 @@
+"""Module 25248."""
+import pkg9.pkg120.pkg1567.m14070
+from pkg2.pkg29.pkg382 import m381
+import pkg5.pkg76.pkg990.m9325
+from pkg2 import m1
+import pkg2.pkg27.pkg363.m4530
+from pkg5.pkg68.pkg885 import m19640
+import pkg10.pkg137.pkg1782.m24705
+from . import m18996
+import pkg4.pkg64.m63
+from pkg10.pkg141.pkg1842 import m18513
+import pkg1.pkg25.m24
+from pkg8.pkg108.pkg1412 import m3495
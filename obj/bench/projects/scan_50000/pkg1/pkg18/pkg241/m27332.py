@@ -0,0 +1,54 @@
+"""Module 27332."""
+import pkg4.pkg63.m62
+from pkg1.pkg14.pkg193 import m6444
+import pkg3.pkg40.pkg528.m17199
+from pkg6.pkg83 import m10502
+import pkg5.pkg78.pkg1026.m3109
+from pkg1.pkg17.pkg229 import m228
+from . import m16912
+from pkg2.pkg39.pkg509 import m508
+import pkg7.pkg94.pkg1228.m24151
+from pkg2 import m1
+import pkg8.pkg113.pkg1478.m5645
+
+
+def helper_27332_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_27332_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_27332_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_27332_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_27332_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_27332_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,61 @@
+"""Module 44004."""
+import pkg2.pkg34.pkg450.m449
+from . import m41920
+import pkg2.pkg32.pkg429.m428
+from pkg2.pkg36.pkg473 import m8808
+import pkg2.pkg31.pkg408.m12911
+from pkg5.pkg70.pkg923 import m42602
+import pkg1.pkg15.pkg205.m6456
+from pkg2.pkg39.pkg519 import m42198
+import pkg6.pkg81.pkg1058.m3141
+from pkg4.pkg61.pkg798 import m11217
+import pkg8.pkg116.pkg1513.m9848
+
+
+def helper_44004_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_44004_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_44004_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_44004_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_44004_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_44004_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_44004_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
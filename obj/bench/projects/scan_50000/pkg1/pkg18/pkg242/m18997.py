@@ -0,0 +1,45 @@
+"""Module 18997."""
+from . import m4409
+from . import m8577
+import pkg6.pkg80.pkg1044.m1043
+from pkg6.pkg90.pkg1171 import m1170
+import pkg9.pkg119.pkg1551.m1550
+from pkg1 import m0
+import pkg8.pkg110.pkg1438.m5605
+from . import m241
+import pkg7.pkg101.pkg1315.m9650
+
+
+def helper_18997_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_18997_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_18997_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_18997_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_18997_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
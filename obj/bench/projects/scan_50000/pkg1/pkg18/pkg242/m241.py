@@ -0,0 +1,13 @@
+"""Module 241."""
+import pkg5.pkg77.m76
+from pkg2 import m1
+import pkg4.m3
+from pkg12 import m11
+import pkg5.pkg69.m68
+
+
+def helper_241_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
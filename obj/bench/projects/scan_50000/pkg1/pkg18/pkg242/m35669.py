@@ -0,0 +1,18 @@
+"""Module 35669."""
+import pkg2.pkg34.pkg453.m8788
+from . import m23165
+import pkg1.pkg23.pkg307.m306
+
+
+def helper_35669_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35669_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
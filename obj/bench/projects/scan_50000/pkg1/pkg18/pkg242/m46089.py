@@ -0,0 +1,31 @@
+"""Module 46089."""
+import pkg4.pkg56.pkg738.m31997
+from pkg2.pkg36.pkg476 import m17147
+import pkg9.pkg125.pkg1633.m1632
+from pkg1.pkg24 import m2107
+import pkg9.pkg126.pkg1649.m1648
+from pkg1.pkg22.pkg297 import m296
+import pkg2.pkg33.m32
+from pkg7.pkg104 import m103
+from . import m21081
+
+
+def helper_46089_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_46089_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_46089_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,36 @@
+"""Module 48173."""
+import pkg7.pkg96.pkg1261.m7512
+from pkg11.pkg156.pkg2030 import m2029
+import pkg2.pkg31.pkg413.m35840
+from pkg5.pkg77.pkg1002 import m1001
+import pkg2.pkg28.pkg369.m6620
+from pkg7.pkg93.pkg1213 import m11632
+import pkg9.pkg123.pkg1600.m9935
+
+
+def helper_48173_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_48173_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_48173_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_48173_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,33 @@
+"""Module 18998."""
+import pkg5.pkg67.pkg876.m5043
+from . import m8578
+from . import m242
+from pkg3.pkg52.pkg680 import m13183
+import pkg10.pkg136.pkg1774.m3857
+from pkg5.pkg71.pkg933 import m7184
+from . import m10662
+from . import m4410
+import pkg5.pkg72.m71
+from pkg7.pkg99.pkg1300 import m3383
+import pkg6.pkg81.pkg1060.m1059
+
+
+def helper_18998_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_18998_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_18998_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 39838."""
+from . import m2326
+from . import m33586
+from . import m23166
+
+
+def helper_39838_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39838_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
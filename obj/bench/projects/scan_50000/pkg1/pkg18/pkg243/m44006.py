@@ -0,0 +1,14 @@
+"""Module 44006."""
+import pkg8.pkg113.m8448
+from . import m27334
+import pkg8.pkg108.pkg1407.m1406
+from pkg6.pkg80.pkg1043 import m32302
+import pkg9.pkg124.pkg1619.m1618
+from . import m35670
+
+
+def helper_44006_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
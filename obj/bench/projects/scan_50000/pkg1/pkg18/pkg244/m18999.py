@@ -0,0 +1,21 @@
+"""Module 18999."""
+from . import m8579
+from . import m2327
+import pkg7.pkg95.pkg1237.m5404
+from pkg9.pkg130.pkg1694 import m10029
+import pkg1.pkg25.pkg332.m14919
+from pkg4.pkg64 import m63
+
+
+def helper_18999_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_18999_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
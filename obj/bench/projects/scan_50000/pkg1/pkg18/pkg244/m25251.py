@@ -0,0 +1,11 @@
+"""Module 25251."""
+import pkg6.pkg90.pkg1183.m7434
+from . import m243
+import pkg13.m12
+
+
+def helper_25251_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
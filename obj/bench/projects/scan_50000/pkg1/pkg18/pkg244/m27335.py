@@ -0,0 +1,28 @@
+"""Module 27335."""
+from . import m4411
+from pkg3.pkg51.pkg669 import m2752
+import pkg1.pkg21.pkg284.m8619
+from pkg8 import m7
+import pkg5.pkg69.m68
+from pkg1.pkg17.pkg229 import m228
+
+
+def helper_27335_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_27335_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_27335_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 29419."""
+from . import m23167
+from pkg4.pkg61.pkg796 import m7047
+from . import m8579
+from pkg4.pkg57.pkg743 import m742
+
+
+def helper_29419_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_29419_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_29419_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 31503."""
+import pkg4.pkg60.pkg789.m788
+from pkg2.pkg34.pkg453 import m452
+from . import m23167
+from . import m29419
+import pkg8.pkg108.pkg1412.m5579
+from pkg3.pkg51.pkg669 import m29844
+import pkg4.pkg55.pkg717.m716
+from pkg9.pkg123.pkg1601 import m12020
+import pkg1.pkg22.pkg292.m291
+from . import m2327
+import pkg9.pkg120.pkg1571.m9906
+from pkg3.pkg51.pkg674 import m673
+
+
+def helper_31503_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 10664."""
+import pkg1.m0
+from pkg8.pkg113.pkg1474 import m3557
+import pkg8.pkg114.pkg1483.m3566
+from pkg9.pkg119.pkg1557 import m3640
+from . import m244
+from pkg8.pkg114.pkg1487 import m9822
+import pkg6.pkg90.m89
+from pkg10.pkg131 import m130
+import pkg11.pkg151.pkg1972.m6139
+
+
+def helper_10664_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
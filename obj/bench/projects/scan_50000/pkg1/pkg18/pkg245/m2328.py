@@ -0,0 +1,27 @@
+"""Module 2328."""
+import pkg8.pkg112.pkg1461.m1460
+from . import m244
+import pkg10.m9
+from pkg1.pkg19.pkg249 import m248
+import pkg11.pkg148.m2231
+
+
+def helper_2328_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2328_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2328_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 25252."""
+import pkg11.pkg153.pkg1990.m1989
+from pkg2.pkg38.pkg501 import m500
+import pkg2.pkg29.pkg387.m4554
+from pkg6.pkg84.pkg1103 import m1102
+import pkg7.pkg93.pkg1216.m1215
+from pkg2.pkg37.pkg491 import m10910
+import pkg3.m2
+from pkg11.pkg146.pkg1906 import m6073
+import pkg11.pkg148.pkg1930.m1929
+from . import m8580
+import pkg1.m0
+from . import m19000
+
+
+def helper_25252_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
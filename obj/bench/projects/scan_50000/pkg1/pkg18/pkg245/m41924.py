@@ -0,0 +1,19 @@
+"""Module 41924."""
+import pkg4.pkg59.pkg780.m19535
+from pkg6.pkg79 import m78
+import pkg2.pkg37.m36
+from pkg1 import m0
+import pkg3.m2
+from pkg9.pkg123.pkg1609 import m12028
+import pkg9.pkg127.pkg1664.m1663
+from pkg1.pkg20.pkg265 import m264
+import pkg1.pkg18.pkg239.m23162
+from pkg10.pkg135.pkg1768 import m39279
+import pkg2.pkg28.pkg365.m2448
+
+
+def helper_41924_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
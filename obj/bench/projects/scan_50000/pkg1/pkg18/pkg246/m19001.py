@@ -0,0 +1,18 @@
+"""Module 19001."""
+import pkg2.pkg34.pkg443.m4610
+from pkg2.pkg35.pkg465 import m17136
+import pkg9.pkg126.pkg1644.m16231
+from . import m4413
+import pkg9.pkg118.pkg1545.m7796
+from pkg8.pkg114.pkg1494 import m5661
+import pkg10.pkg137.pkg1793.m8044
+from pkg8.pkg109.pkg1426 import m5593
+import pkg1.m0
+from pkg4.pkg64.pkg834 import m2917
+
+
+def helper_19001_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,31 @@
+"""Module 21085."""
+from . import m10665
+from pkg6.pkg86 import m2169
+import pkg6.pkg88.pkg1155.m5322
+from pkg5.pkg71 import m70
+from . import m14833
+from . import m2329
+import pkg4.pkg65.pkg848.m847
+from pkg9.pkg130.pkg1692 import m3775
+import pkg2.pkg29.pkg381.m380
+
+
+def helper_21085_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_21085_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_21085_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,21 @@
+"""Module 2329."""
+import pkg4.m3
+from . import m245
+import pkg5.pkg78.pkg1023.m1022
+from pkg1 import m0
+import pkg2.pkg39.pkg520.m519
+from pkg6.pkg90.pkg1171 import m1170
+
+
+def helper_2329_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2329_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 25253."""
+import pkg12.pkg157.pkg2047.m2046
+from pkg2.pkg36.pkg479 import m8814
+import pkg6.pkg82.m23005
+from pkg9.pkg119.pkg1555 import m3638
+import pkg4.pkg61.pkg799.m7050
+from . import m6497
+import pkg5.pkg77.pkg1014.m3097
+from pkg4.pkg58.pkg758 import m23681
+import pkg8.pkg107.pkg1398.m7649
+from pkg7.pkg102.pkg1331 import m24254
+from . import m19001
+from . import m14833
+
+
+def helper_25253_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_25253_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 29421."""
+import pkg1.pkg22.pkg295.m294
+from pkg9.pkg126.pkg1643 import m5810
+import pkg1.pkg21.pkg277.m4444
+from pkg7.pkg101.pkg1324 import m17995
+import pkg11.pkg151.pkg1973.m22812
+from pkg1.pkg18 import m17
+import pkg6.pkg85.pkg1114.m9449
+from pkg10.pkg137.pkg1790 import m26797
+import pkg6.pkg80.pkg1044.m7295
+from . import m6497
+import pkg1.m0
+from pkg7.pkg102.pkg1339 import m1338
+
+
+def helper_29421_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_29421_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
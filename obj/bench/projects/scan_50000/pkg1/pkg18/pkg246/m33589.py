@@ -0,0 +1,45 @@
+"""Module 33589."""
+import pkg5.pkg69.pkg898.m5065
+from . import m29421
+import pkg4.pkg55.pkg726.m19481
+from pkg3.pkg45.pkg598 import m11017
+import pkg11.pkg147.pkg1917.m26924
+from pkg1.pkg26.pkg339 import m338
+import pkg1.pkg17.pkg232.m231
+from pkg3.pkg40.pkg527 import m2610
+import pkg5.pkg67.m25074
+
+
+def helper_33589_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_33589_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_33589_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_33589_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_33589_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,55 @@
+"""Module 14834."""
+import pkg7.pkg93.pkg1212.m13715
+from pkg1.pkg21.pkg284 import m283
+import pkg9.pkg118.m12621
+from pkg1.pkg19.pkg256 import m255
+import pkg11.pkg146.pkg1907.m10242
+from pkg1.pkg20.pkg263 import m262
+import pkg12.pkg159.pkg2070.m4153
+from . import m10666
+import pkg8.pkg112.pkg1463.m3546
+from pkg2.pkg38.pkg506 import m505
+import pkg2.pkg28.pkg372.m2455
+from pkg8.pkg114.pkg1492 import m7743
+
+
+def helper_14834_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14834_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_14834_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_14834_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_14834_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_14834_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,46 @@
+"""Module 6498."""
+from . import m246
+from pkg1.pkg17.pkg227 import m226
+from . import m2330
+from pkg10.pkg140.pkg1832 import m5999
+import pkg2.pkg38.pkg505.m504
+from pkg1.pkg21.pkg279 import m278
+import pkg1.pkg21.pkg281.m2364
+from pkg2.pkg27.pkg355 import m354
+import pkg5.pkg69.m68
+from pkg7.pkg101.pkg1326 import m1325
+
+
+def helper_6498_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6498_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6498_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6498_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_6498_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
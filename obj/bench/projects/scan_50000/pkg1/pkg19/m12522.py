@@ -0,0 +1,22 @@
+"""Module 12522."""
+from . import m4186
+from pkg8.pkg111.pkg1445 import m11864
+import pkg4.pkg60.pkg781.m780
+from . import m18
+import pkg7.pkg96.pkg1251.m3334
+from pkg5.pkg75.pkg980 import m979
+import pkg5.m4
+
+
+def helper_12522_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12522_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,28 @@
+"""Module 18774."""
+import pkg4.m3
+from . import m18
+import pkg7.pkg99.pkg1298.m3381
+from pkg13 import m12
+import pkg2.pkg38.pkg495.m2578
+from pkg11.pkg155 import m154
+
+
+def helper_18774_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_18774_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_18774_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 2102."""
+import pkg1.pkg24.m23
+from pkg2 import m1
+import pkg2.pkg38.pkg500.m499
+from pkg10.pkg140 import m139
+
+
+def helper_2102_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2102_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,54 @@
+"""Module 25026."""
+import pkg3.pkg44.pkg581.m580
+from pkg11.pkg146.pkg1904 import m3987
+import pkg4.pkg54.pkg710.m13213
+from pkg6 import m2089
+import pkg5.pkg73.m2156
+from pkg10.pkg138.pkg1796 import m12215
+from . import m4186
+from pkg7.pkg104 import m2187
+from . import m6270
+from pkg9.pkg127.pkg1655 import m5822
+import pkg2.pkg32.pkg419.m4586
+
+
+def helper_25026_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_25026_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_25026_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_25026_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_25026_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_25026_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,43 @@
+"""Module 41698."""
+import pkg5.pkg69.pkg899.m32158
+from pkg4.pkg65.pkg853 import m11272
+import pkg2.pkg28.pkg368.m4535
+from pkg2.pkg35.pkg458 import m15045
+import pkg11.pkg148.pkg1933.m1932
+from pkg11.pkg150.pkg1954 import m35297
+import pkg7.pkg104.pkg1356.m1355
+
+
+def helper_41698_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_41698_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_41698_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_41698_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_41698_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
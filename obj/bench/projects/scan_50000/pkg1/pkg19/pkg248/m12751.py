@@ -0,0 +1,62 @@
+"""Module 12751."""
+import pkg1.pkg20.pkg267.m266
+from . import m10667
+import pkg4.pkg61.m60
+from pkg8.pkg108.pkg1417 import m7668
+import pkg2.pkg30.pkg392.m391
+from pkg10.pkg142.pkg1853 import m10188
+import pkg10.pkg136.pkg1774.m8025
+from pkg4.pkg64.pkg838 import m9173
+import pkg2.pkg38.pkg503.m502
+from pkg1.pkg19.pkg258 import m257
+from . import m2331
+from pkg2.pkg30 import m29
+
+
+def helper_12751_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12751_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_12751_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_12751_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_12751_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_12751_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12751_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
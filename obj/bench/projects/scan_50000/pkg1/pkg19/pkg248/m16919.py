@@ -0,0 +1,21 @@
+"""Module 16919."""
+import pkg4.pkg58.m57
+from pkg10.pkg139.pkg1816 import m8067
+import pkg4.pkg62.pkg813.m812
+from pkg5.pkg78 import m77
+import pkg2.pkg37.pkg489.m10908
+from . import m247
+
+
+def helper_16919_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16919_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 21087."""
+import pkg8.pkg116.pkg1511.m11930
+from pkg4.pkg56.pkg729 import m13232
+from . import m12751
+from pkg9.pkg129.pkg1680 import m3763
+
+
+def helper_21087_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_21087_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_21087_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,31 @@
+"""Module 247."""
+import pkg12.pkg165.m164
+from pkg1 import m0
+import pkg1.pkg14.pkg183.m182
+from pkg3.pkg48 import m47
+import pkg13.pkg172.m171
+from pkg6.pkg87 import m86
+import pkg11.m10
+from pkg1.pkg17.pkg231 import m230
+import pkg6.pkg86.m85
+
+
+def helper_247_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_247_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_247_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 27339."""
+import pkg6.m5
+from pkg2.pkg37.pkg485 import m484
+import pkg10.pkg135.pkg1761.m14264
+from pkg2.pkg37 import m2120
+import pkg4.pkg58.pkg766.m2849
+from pkg7.pkg102.pkg1331 import m3414
+import pkg10.pkg137.pkg1786.m14289
+from . import m19003
+import pkg1.pkg19.m18
+from pkg4.pkg54.pkg708 import m6959
+import pkg3.pkg43.pkg561.m560
+
+
+def helper_27339_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,35 @@
+"""Module 48179."""
+import pkg10.pkg141.m4308
+from pkg6.pkg82.pkg1070 import m21909
+import pkg1.pkg16.pkg209.m4376
+from . import m12751
+import pkg1.pkg21.pkg284.m37795
+from . import m16919
+
+
+def helper_48179_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_48179_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_48179_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_48179_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
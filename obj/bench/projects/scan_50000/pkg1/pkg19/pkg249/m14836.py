@@ -0,0 +1,11 @@
+"""Module 14836."""
+import pkg4.m3
+from pkg8.pkg106 import m8441
+import pkg7.pkg92.pkg1202.m1201
+
+
+def helper_14836_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
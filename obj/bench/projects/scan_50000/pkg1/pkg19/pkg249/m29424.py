@@ -0,0 +1,34 @@
+"""Module 29424."""
+import pkg10.pkg143.pkg1872.m12291
+from pkg1.pkg18 import m17
+from . import m4416
+from pkg9.pkg119.pkg1549 import m24472
+import pkg5.pkg69.pkg910.m9245
+from pkg1.pkg20.pkg271 import m6522
+import pkg6.pkg89.pkg1170.m9505
+from . import m10668
+import pkg10.m9
+from pkg7.pkg98 import m97
+from . import m14836
+from . import m248
+
+
+def helper_29424_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_29424_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_29424_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
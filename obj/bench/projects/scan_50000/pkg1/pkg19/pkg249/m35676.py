@@ -0,0 +1,55 @@
+"""Module 35676."""
+import pkg7.pkg103.pkg1340.m3423
+from pkg3.pkg47.pkg618 import m21457
+from . import m6500
+from pkg10.pkg140.pkg1828 import m3911
+import pkg8.pkg108.pkg1416.m9751
+from pkg2.pkg35.pkg468 import m467
+import pkg8.pkg114.pkg1492.m5659
+from . import m21088
+import pkg10.pkg142.pkg1849.m8100
+from pkg8.pkg105 import m104
+from . import m27340
+from pkg6.pkg80 import m79
+
+
+def helper_35676_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35676_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_35676_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_35676_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_35676_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_35676_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
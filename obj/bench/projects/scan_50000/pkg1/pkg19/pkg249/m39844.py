@@ -0,0 +1,11 @@
+"""Module 39844."""
+from . import m19004
+from pkg1.pkg22.pkg298 import m2381
+import pkg1.pkg26.m25
+from pkg9.pkg118.pkg1535 import m32794
+import pkg12.pkg159.pkg2078.m4161
+from . import m4416
+from . import m33592
+from pkg9.pkg128.pkg1668 import m1667
+import pkg5.pkg68.m67
+from pkg8.pkg105.pkg1373 import m1372
@@ -0,0 +1,62 @@
+"""Module 14837."""
+import pkg1.pkg20.pkg261.m6512
+from pkg2.pkg29.pkg378 import m10797
+import pkg8.pkg106.pkg1383.m13886
+from pkg3.pkg42.pkg557 import m4724
+from . import m4417
+from pkg9.pkg126 import m12629
+import pkg2.pkg35.pkg462.m2545
+from pkg6.pkg87 import m86
+import pkg9.pkg128.pkg1674.m1673
+from pkg4.pkg55 import m54
+import pkg4.pkg56.pkg730.m9065
+from pkg9.pkg128.pkg1674 import m3757
+
+
+def helper_14837_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14837_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_14837_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_14837_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_14837_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_14837_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14837_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
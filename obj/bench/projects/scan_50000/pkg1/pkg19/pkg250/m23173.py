@@ -0,0 +1,22 @@
+"""Module 23173."""
+import pkg3.m2
+from pkg1 import m0
+from . import m14837
+from pkg9.pkg121.pkg1576 import m1575
+import pkg4.pkg62.pkg816.m4983
+from pkg9.pkg127 import m126
+import pkg6.pkg85.pkg1118.m11537
+
+
+def helper_23173_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_23173_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
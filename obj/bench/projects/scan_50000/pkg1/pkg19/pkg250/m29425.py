@@ -0,0 +1,30 @@
+"""Module 29425."""
+from . import m6501
+from pkg6.pkg80.pkg1041 import m28132
+import pkg2.pkg39.pkg514.m4681
+from pkg2.pkg27.pkg362 import m2445
+import pkg3.pkg50.pkg653.m652
+from pkg1.pkg22.pkg298 import m4465
+import pkg12.pkg158.pkg2062.m24985
+from . import m14837
+
+
+def helper_29425_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_29425_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_29425_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
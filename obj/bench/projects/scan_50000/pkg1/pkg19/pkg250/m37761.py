@@ -0,0 +1,13 @@
+"""Module 37761."""
+import pkg9.pkg126.pkg1648.m28739
+from . import m249
+import pkg10.pkg132.pkg1725.m1724
+from pkg9.pkg128.pkg1665 import m7916
+import pkg7.pkg104.pkg1357.m3440
+
+
+def helper_37761_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 10670."""
+import pkg11.pkg156.pkg2041.m4124
+from pkg7 import m6
+import pkg9.pkg124.pkg1625.m9960
+from pkg2.pkg27.pkg363 import m362
+import pkg4.pkg65.pkg847.m846
+from pkg6.pkg87.pkg1135 import m1134
+import pkg10.pkg142.pkg1858.m1857
+from pkg1.pkg16.pkg218 import m6469
+import pkg10.pkg137.pkg1791.m10126
+from pkg1.pkg17.pkg230 import m2313
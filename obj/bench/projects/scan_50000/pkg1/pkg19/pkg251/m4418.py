@@ -0,0 +1,20 @@
+"""Module 4418."""
+from . import m2334
+from pkg7.pkg102.pkg1334 import m3417
+import pkg1.pkg21.pkg274.m273
+from pkg10.pkg138.pkg1796 import m1795
+import pkg9.pkg130.pkg1695.m1694
+
+
+def helper_4418_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4418_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,29 @@
+"""Module 8586."""
+import pkg9.m8
+from . import m6502
+import pkg2.pkg28.m27
+from pkg11.pkg156.pkg2030 import m4113
+import pkg11.pkg145.pkg1894.m6061
+from pkg1.pkg18 import m17
+import pkg7.pkg99.pkg1294.m7545
+
+
+def helper_8586_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8586_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8586_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 251."""
+import pkg1.m0
+from pkg5 import m4
+import pkg7.pkg94.m93
+from pkg6.pkg89 import m88
+import pkg2.pkg29.m28
+
+
+def helper_251_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_251_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_251_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,15 @@
+"""Module 41931."""
+import pkg1.pkg15.m2098
+from pkg6.pkg88.pkg1151 import m1150
+import pkg2.pkg29.m28
+from pkg1.pkg14.pkg192 import m12695
+import pkg1.pkg22.m14609
+from pkg4.pkg56.pkg734 import m733
+import pkg2.pkg35.pkg460.m459
+
+
+def helper_41931_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 252."""
+import pkg1.pkg15.m14
+from pkg3.pkg44 import m43
+import pkg9.pkg128.m127
+from pkg2.pkg33 import m32
+import pkg1.m0
+
+
+def helper_252_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_252_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
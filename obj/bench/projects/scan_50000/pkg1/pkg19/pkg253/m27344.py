@@ -0,0 +1 @@
+"""Module 27344."""
@@ -0,0 +1,23 @@
+"""Module 33596."""
+import pkg6.pkg80.pkg1047.m19802
+from . import m19008
+import pkg7.pkg92.pkg1207.m11626
+from pkg1.pkg23.pkg307 import m6558
+import pkg7.pkg102.pkg1337.m7588
+from pkg9.pkg129.pkg1680 import m10015
+import pkg13.m12
+from pkg2.pkg31.pkg408 import m407
+
+
+def helper_33596_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_33596_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
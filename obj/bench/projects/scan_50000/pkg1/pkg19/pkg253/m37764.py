@@ -0,0 +1,10 @@
+"""Module 37764."""
+import pkg7.m6
+from . import m252
+
+
+def helper_37764_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
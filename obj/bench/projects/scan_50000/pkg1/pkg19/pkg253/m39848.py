@@ -0,0 +1,47 @@
+"""Module 39848."""
+import pkg8.pkg113.pkg1470.m22309
+from pkg4.pkg60.pkg792 import m2875
+from . import m8588
+from pkg11.pkg144.pkg1881 import m1880
+from . import m19008
+from pkg3.pkg46.pkg602 import m21441
+from . import m27344
+from pkg11.pkg154 import m153
+import pkg9.m8
+from pkg3.pkg45.pkg588 import m587
+import pkg2.pkg30.pkg402.m8737
+
+
+def helper_39848_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39848_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_39848_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_39848_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_39848_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
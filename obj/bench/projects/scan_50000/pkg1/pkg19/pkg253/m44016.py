@@ -0,0 +1,13 @@
+"""Module 44016."""
+from . import m2336
+from pkg1.pkg25.pkg335 import m21174
+import pkg10.pkg136.pkg1772.m3855
+from pkg1.pkg19.pkg256 import m255
+import pkg2.pkg37.pkg489.m21328
+
+
+def helper_44016_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
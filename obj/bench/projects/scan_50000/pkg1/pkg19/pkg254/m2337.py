@@ -0,0 +1,14 @@
+"""Module 2337."""
+from . import m253
+from pkg2.pkg32 import m31
+import pkg1.m0
+from pkg2.pkg38.pkg506 import m505
+import pkg8.pkg109.m108
+from pkg9.pkg124.pkg1620 import m1619
+
+
+def helper_2337_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,12 @@
+"""Module 27345."""
+import pkg4.pkg57.pkg753.m4920
+from . import m2337
+import pkg11.pkg156.pkg2040.m20795
+from . import m8589
+
+
+def helper_27345_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,37 @@
+"""Module 31513."""
+import pkg6.pkg80.pkg1042.m21881
+from . import m253
+import pkg4.pkg58.pkg766.m11185
+from pkg8 import m7
+import pkg2.pkg30.pkg395.m23318
+from pkg4.pkg56.pkg738 import m4905
+import pkg4.pkg57.pkg749.m15336
+from pkg3.pkg41 import m40
+
+
+def helper_31513_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_31513_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_31513_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_31513_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
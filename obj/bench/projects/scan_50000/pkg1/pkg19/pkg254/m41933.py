@@ -0,0 +1,18 @@
+"""Module 41933."""
+import pkg3.pkg51.pkg666.m36093
+from . import m8589
+import pkg7.pkg100.pkg1305.m17976
+
+
+def helper_41933_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_41933_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 44017."""
+import pkg7.pkg94.pkg1229.m42908
+from . import m21093
+import pkg1.pkg15.pkg204.m21043
+
+
+def helper_44017_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 46101."""
+import pkg4.pkg58.pkg761.m760
+from pkg1.pkg14.pkg187 import m2270
+from . import m35681
+from pkg4.pkg56.pkg740 import m2823
+import pkg11.pkg148.pkg1932.m8183
+
+
+def helper_46101_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_46101_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_46101_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,47 @@
+"""Module 10674."""
+from . import m2338
+from pkg2.pkg30 import m29
+import pkg9.pkg122.pkg1593.m5760
+from pkg2.pkg29.pkg390 import m2473
+import pkg11.pkg151.pkg1973.m1972
+from pkg1.pkg19 import m18
+import pkg4.pkg57.pkg754.m753
+from pkg13 import m12
+import pkg1.pkg16.pkg212.m2295
+from pkg13.pkg177 import m176
+import pkg8.pkg114.pkg1495.m5662
+
+
+def helper_10674_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10674_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_10674_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_10674_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_10674_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
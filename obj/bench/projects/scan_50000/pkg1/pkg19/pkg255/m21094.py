@@ -0,0 +1,19 @@
+"""Module 21094."""
+import pkg5.pkg76.pkg999.m3082
+from pkg6.pkg88.pkg1154 import m3237
+from . import m16926
+from pkg9.pkg119.pkg1559 import m14062
+
+
+def helper_21094_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_21094_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
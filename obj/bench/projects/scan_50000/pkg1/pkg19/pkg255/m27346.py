@@ -0,0 +1,24 @@
+"""Module 27346."""
+import pkg1.pkg16.pkg219.m16890
+from pkg10.pkg133.pkg1737 import m22576
+import pkg5.pkg67.pkg878.m877
+from pkg8.pkg110.pkg1433 import m26440
+import pkg4.pkg53.pkg695.m694
+from . import m21094
+import pkg2.pkg37.pkg482.m2565
+from pkg2.pkg29 import m28
+import pkg2.pkg28.pkg365.m364
+
+
+def helper_27346_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_27346_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
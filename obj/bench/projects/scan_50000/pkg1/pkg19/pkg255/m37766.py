@@ -0,0 +1,15 @@
+"""Module 37766."""
+from . import m16926
+from pkg10.pkg135.pkg1761 import m28852
+import pkg4.pkg64.pkg834.m2917
+from pkg1.pkg22.pkg290 import m33633
+import pkg2.pkg35.pkg459.m4626
+from . import m25262
+import pkg1.pkg19.pkg249.m35676
+
+
+def helper_37766_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,22 @@
+"""Module 19011."""
+import pkg9.pkg121.pkg1579.m16166
+from pkg7.pkg98.pkg1283 import m3366
+import pkg2.pkg31.pkg408.m2491
+from pkg9.pkg130.pkg1691 import m1690
+import pkg8.pkg115.pkg1499.m3582
+from pkg11.pkg148.pkg1937 import m6104
+import pkg4.pkg56.pkg736.m2819
+
+
+def helper_19011_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_19011_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
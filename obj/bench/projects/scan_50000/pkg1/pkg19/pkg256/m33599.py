@@ -0,0 +1,30 @@
+"""Module 33599."""
+from . import m4423
+from pkg9.pkg128.pkg1677 import m1676
+import pkg10.pkg133.pkg1742.m7993
+from pkg2.pkg32.pkg420 import m419
+import pkg2.pkg29.pkg390.m389
+from pkg1.pkg15.pkg199 import m198
+import pkg9.pkg121.m120
+from pkg2 import m1
+
+
+def helper_33599_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_33599_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_33599_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
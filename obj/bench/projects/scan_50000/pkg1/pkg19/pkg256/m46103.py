@@ -0,0 +1,33 @@
+"""Module 46103."""
+import pkg12.pkg160.m2243
+from pkg4.pkg58.pkg765 import m29940
+import pkg2.pkg38.m37
+from pkg1 import m0
+import pkg1.pkg25.pkg327.m326
+from pkg2.pkg35.pkg459 import m29634
+import pkg13.pkg180.m4347
+from pkg10.pkg141.pkg1835 import m26842
+import pkg3.pkg49.pkg645.m4812
+from pkg4.pkg57 import m6308
+import pkg9.pkg127.pkg1653.m16240
+
+
+def helper_46103_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_46103_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_46103_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
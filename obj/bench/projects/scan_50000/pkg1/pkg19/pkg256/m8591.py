@@ -0,0 +1,19 @@
+"""Module 8591."""
+import pkg4.pkg61.pkg803.m4970
+from pkg3.pkg50.pkg663 import m662
+from . import m2339
+from . import m255
+
+
+def helper_8591_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8591_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,16 @@
+"""Module 21096."""
+import pkg7.pkg99.m98
+from pkg11.pkg156.pkg2033 import m6200
+import pkg6.pkg90.pkg1182.m3265
+from pkg4.pkg65.pkg857 import m5024
+import pkg11.pkg147.pkg1913.m10248
+from . import m8592
+import pkg2.pkg30.pkg400.m399
+from . import m6508
+
+
+def helper_21096_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
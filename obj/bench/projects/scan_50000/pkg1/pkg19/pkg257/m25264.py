@@ -0,0 +1,27 @@
+"""Module 25264."""
+import pkg7.pkg93.pkg1217.m1216
+from pkg2.pkg31 import m30
+import pkg10.pkg134.pkg1753.m12172
+from pkg11.pkg155.pkg2017 import m4100
+import pkg4.pkg61.m4228
+from pkg1.pkg22 import m21
+import pkg2.pkg28.pkg368.m2451
+from pkg7.pkg103 import m102
+import pkg6.m5
+from pkg9.pkg123.pkg1607 import m3690
+import pkg8.pkg117.pkg1524.m11943
+from pkg12.pkg159.pkg2069 import m8320
+
+
+def helper_25264_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_25264_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,13 @@
+"""Module 29432."""
+import pkg3.pkg52.pkg686.m685
+from pkg11 import m2094
+import pkg11.pkg153.pkg2000.m4083
+from . import m6508
+import pkg11.pkg149.pkg1938.m12357
+
+
+def helper_29432_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
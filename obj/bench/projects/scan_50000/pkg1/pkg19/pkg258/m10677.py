@@ -0,0 +1,52 @@
+"""Module 10677."""
+from . import m4425
+from pkg2.pkg32.pkg417 import m416
+import pkg7.pkg99.pkg1296.m1295
+from pkg11.pkg145 import m8480
+import pkg4.pkg54.m53
+from pkg12.pkg158.pkg2058 import m2057
+import pkg2.pkg34.m2117
+from pkg2.pkg36.pkg478 import m477
+import pkg2.pkg27.pkg362.m361
+
+
+def helper_10677_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10677_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_10677_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_10677_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_10677_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_10677_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
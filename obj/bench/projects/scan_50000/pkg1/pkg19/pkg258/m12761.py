@@ -0,0 +1,47 @@
+"""Module 12761."""
+import pkg4.pkg60.pkg791.m11210
+from pkg6.pkg83.pkg1086 import m1085
+import pkg3.pkg51.m50
+from . import m8593
+import pkg2.pkg39.pkg517.m2600
+from pkg3.pkg46 import m2129
+from . import m257
+from pkg7 import m6
+import pkg7.pkg100.pkg1312.m3395
+from pkg10.pkg135.pkg1759 import m3842
+import pkg11.pkg155.pkg2025.m2024
+
+
+def helper_12761_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12761_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_12761_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_12761_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_12761_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,41 @@
+"""Module 27349."""
+import pkg10.pkg134.pkg1752.m1751
+from pkg1.pkg25.pkg329 import m4496
+import pkg4.pkg63.pkg823.m822
+from . import m16929
+import pkg9.pkg122.pkg1595.m14098
+from pkg7.pkg96.pkg1260 import m15847
+from . import m19013
+from pkg5.pkg72.pkg944 import m5111
+from . import m10677
+from pkg6.pkg89.pkg1163 import m1162
+import pkg7.pkg99.pkg1288.m13791
+from pkg2.pkg39 import m38
+
+
+def helper_27349_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_27349_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_27349_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_27349_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,69 @@
+"""Module 39853."""
+import pkg6.pkg86.pkg1127.m28218
+from pkg4.pkg58.pkg755 import m9090
+import pkg2.pkg36.m12539
+from pkg6.pkg86.pkg1129 import m15716
+import pkg4.pkg53.pkg696.m695
+from pkg2.pkg39.pkg518 import m31777
+from . import m4425
+from pkg4.pkg65.pkg852 import m5019
+import pkg2.m1
+from pkg4.pkg53.pkg698 import m4865
+import pkg12.pkg158.pkg2067.m24990
+from pkg3.pkg42.pkg553 import m35980
+
+
+def helper_39853_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39853_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_39853_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_39853_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_39853_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_39853_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39853_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_39853_42(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,13 @@
+"""Module 8593."""
+import pkg12.pkg157.pkg2044.m2043
+from pkg2.pkg39.pkg518 import m6769
+import pkg2.pkg38.pkg505.m504
+from pkg1.pkg22.pkg298 import m297
+from . import m2341
+
+
+def helper_8593_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,48 @@
+"""Module 21098."""
+import pkg2.pkg39.pkg510.m509
+from . import m10678
+from . import m2342
+from pkg6.pkg87.pkg1143 import m15730
+import pkg12.pkg159.pkg2070.m2069
+from pkg7.pkg98.pkg1282 import m1281
+import pkg5.pkg77.pkg1002.m1001
+from pkg3.pkg52.pkg684 import m683
+import pkg8.pkg108.pkg1417.m1416
+from pkg5.pkg67.pkg883 import m882
+import pkg2.pkg36.pkg471.m8806
+from pkg1 import m0
+
+
+def helper_21098_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_21098_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_21098_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_21098_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_21098_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,37 @@
+"""Module 2342."""
+import pkg2.pkg37.pkg488.m487
+from pkg8.pkg108 import m107
+import pkg10.pkg143.m142
+from pkg10 import m9
+from . import m258
+from pkg4.pkg54.pkg710 import m709
+import pkg1.pkg17.pkg225.m224
+from pkg1.pkg14.pkg191 import m190
+
+
+def helper_2342_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2342_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2342_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2342_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,30 @@
+"""Module 39854."""
+import pkg7.pkg100.pkg1312.m1311
+from pkg7.pkg101.pkg1319 import m36746
+import pkg1.pkg21.pkg284.m283
+from pkg3 import m2
+import pkg2.pkg32.pkg419.m2502
+from . import m35686
+import pkg1.pkg17.pkg226.m225
+from pkg8.pkg111.pkg1452 import m3535
+
+
+def helper_39854_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39854_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_39854_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
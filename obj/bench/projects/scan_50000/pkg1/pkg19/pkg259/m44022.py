@@ -0,0 +1,44 @@
+"""Module 44022."""
+import pkg7.pkg98.pkg1282.m1281
+from pkg9.pkg125.pkg1628 import m1627
+import pkg4.pkg57.pkg748.m747
+from pkg4.pkg61.pkg794 import m793
+import pkg8.pkg112.pkg1467.m18138
+from pkg2 import m1
+from . import m8594
+from pkg9.pkg124.pkg1613 import m18284
+
+
+def helper_44022_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_44022_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_44022_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_44022_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_44022_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,15 @@
+"""Module 4426."""
+import pkg13.pkg172.m4339
+from pkg5.pkg76.pkg992 import m991
+from . import m2342
+from pkg1.pkg18 import m17
+import pkg1.m0
+from . import m258
+import pkg7.pkg95.m94
+
+
+def helper_4426_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
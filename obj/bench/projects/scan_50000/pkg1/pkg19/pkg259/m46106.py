@@ -0,0 +1,45 @@
+"""Module 46106."""
+import pkg1.m0
+from . import m31518
+import pkg1.pkg17.pkg226.m225
+from pkg6.pkg90 import m89
+from . import m35686
+from pkg8.pkg116.pkg1518 import m24441
+import pkg10.pkg137.pkg1790.m8041
+from pkg2.pkg30.pkg392 import m391
+import pkg10.pkg142.pkg1849.m3932
+
+
+def helper_46106_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_46106_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_46106_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_46106_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_46106_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,7 @@
+"""Module 10679."""
+import pkg11.pkg148.pkg1937.m1936
+from pkg9.pkg120.pkg1562 import m1561
+import pkg1.m0
+from pkg1.pkg18.pkg236 import m6487
+from . import m8595
+from pkg1.pkg17.pkg227 import m226
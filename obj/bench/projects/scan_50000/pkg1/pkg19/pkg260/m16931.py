@@ -0,0 +1,26 @@
+"""Module 16931."""
+import pkg8.pkg112.pkg1457.m1456
+from pkg4.pkg56.pkg732 import m731
+from . import m2343
+from pkg10.pkg135.pkg1761 import m3844
+import pkg11.pkg154.pkg2012.m6179
+from pkg10.pkg131.pkg1706 import m1705
+import pkg5.pkg77.pkg1013.m13516
+from pkg10.pkg135.pkg1766 import m5933
+import pkg4.pkg56.pkg738.m737
+from pkg2.pkg28 import m2111
+import pkg1.pkg14.m2097
+
+
+def helper_16931_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16931_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
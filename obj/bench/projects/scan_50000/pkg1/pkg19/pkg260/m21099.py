@@ -0,0 +1,48 @@
+"""Module 21099."""
+import pkg9.pkg119.pkg1557.m7808
+from pkg11.pkg148.pkg1931 import m8182
+import pkg2.pkg32.pkg421.m6672
+from pkg8.pkg115.pkg1498 import m11917
+import pkg3.pkg42.pkg549.m6800
+from pkg3.pkg47.pkg620 import m19375
+import pkg3.pkg49.pkg641.m6892
+from pkg1.pkg15.pkg197 import m196
+import pkg2.pkg33.pkg430.m8765
+from pkg1 import m0
+import pkg7.pkg99.pkg1291.m5458
+from pkg10.pkg139.pkg1816 import m1815
+
+
+def helper_21099_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_21099_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_21099_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_21099_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_21099_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
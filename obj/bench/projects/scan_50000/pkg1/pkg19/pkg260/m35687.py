@@ -0,0 +1,5 @@
+"""Module 35687."""
+import pkg1.pkg20.m19
+from pkg3.pkg51.pkg666 import m23589
+import pkg1.pkg15.pkg199.m8534
+from pkg7.pkg93 import m2176
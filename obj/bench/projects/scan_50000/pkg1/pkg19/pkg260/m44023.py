@@ -0,0 +1,18 @@
+"""Module 44023."""
+import pkg7.pkg94.pkg1235.m3318
+from pkg1.pkg14.pkg184 import m25191
+import pkg1.pkg18.pkg244.m4411
+
+
+def helper_44023_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_44023_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,54 @@
+"""Module 6511."""
+import pkg1.pkg16.pkg220.m219
+from pkg9.pkg124 import m123
+from . import m4427
+from pkg4.pkg54 import m53
+import pkg10.pkg133.pkg1736.m1735
+from pkg2.pkg37.pkg488 import m4655
+import pkg7.pkg93.pkg1222.m5389
+from pkg11.pkg145.pkg1891 import m1890
+import pkg2.pkg39.pkg520.m4687
+from pkg7.pkg93.pkg1216 import m1215
+import pkg5.m4172
+
+
+def helper_6511_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6511_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6511_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6511_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_6511_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_6511_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
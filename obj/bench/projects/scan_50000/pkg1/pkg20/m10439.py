@@ -0,0 +1,46 @@
+"""Module 10439."""
+import pkg2.pkg39.pkg515.m514
+from . import m2103
+import pkg8.pkg111.m110
+from . import m19
+import pkg1.pkg16.pkg215.m4382
+from pkg9.pkg129.pkg1688 import m3771
+import pkg1.m0
+from pkg4.pkg53 import m52
+import pkg10.pkg131.m130
+from . import m8355
+
+
+def helper_10439_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10439_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_10439_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_10439_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_10439_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
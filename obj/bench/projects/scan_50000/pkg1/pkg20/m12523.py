@@ -0,0 +1,34 @@
+"""Module 12523."""
+import pkg1.pkg16.pkg218.m217
+from pkg13 import m12
+import pkg5.pkg74.pkg965.m5132
+from pkg2.pkg39.pkg512 import m2595
+import pkg10.pkg143.pkg1866.m8117
+from pkg5.pkg66.pkg871 import m2954
+import pkg2.pkg35.pkg465.m4632
+from pkg10.pkg131.pkg1713 import m1712
+import pkg2.pkg29.m2112
+from pkg11.pkg148.pkg1936 import m6103
+import pkg2.pkg39.pkg510.m509
+from pkg11.pkg149.pkg1949 import m12368
+
+
+def helper_12523_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12523_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_12523_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
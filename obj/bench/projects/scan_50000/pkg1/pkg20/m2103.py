@@ -0,0 +1,32 @@
+"""Module 2103."""
+import pkg2.pkg29.pkg386.m385
+from pkg5.pkg67 import m66
+import pkg6.pkg89.pkg1168.m1167
+from pkg6.pkg85 import m84
+import pkg6.pkg79.pkg1031.m1030
+from pkg2.pkg31.pkg415 import m414
+import pkg7.pkg94.m93
+from pkg6 import m5
+import pkg3.pkg51.pkg671.m670
+from pkg1 import m0
+
+
+def helper_2103_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2103_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2103_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,46 @@
+"""Module 29195."""
+import pkg6.pkg90.m89
+from pkg4.pkg55.pkg718 import m9053
+import pkg1.pkg18.pkg238.m237
+from pkg4 import m3
+import pkg7.m6
+from . import m6271
+import pkg3.pkg46.pkg604.m17275
+from . import m14607
+import pkg3.pkg42.pkg556.m10975
+from pkg7.pkg100 import m10519
+
+
+def helper_29195_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_29195_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_29195_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_29195_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_29195_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
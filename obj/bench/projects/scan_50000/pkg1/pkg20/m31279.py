@@ -0,0 +1,29 @@
+"""Module 31279."""
+from . import m10439
+from pkg8.pkg113.pkg1481 import m7732
+from . import m29195
+from . import m4187
+import pkg11.pkg147.pkg1914.m18585
+from . import m14607
+import pkg7.pkg93.m92
+
+
+def helper_31279_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_31279_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_31279_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,43 @@
+"""Module 33363."""
+import pkg1.pkg14.pkg190.m189
+from . import m2103
+import pkg8.pkg107.pkg1400.m32659
+from pkg3.pkg40 import m39
+import pkg2.pkg32.pkg423.m8758
+from pkg6.pkg81.pkg1056 import m1055
+import pkg1.pkg17.pkg222.m221
+
+
+def helper_33363_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_33363_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_33363_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_33363_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_33363_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
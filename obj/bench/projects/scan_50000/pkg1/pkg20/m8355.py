@@ -0,0 +1,29 @@
+"""Module 8355."""
+import pkg10.pkg134.pkg1743.m7994
+from pkg8.pkg110.pkg1432 import m5599
+import pkg11.pkg147.pkg1917.m8168
+from pkg1.pkg26.pkg346 import m345
+import pkg1.pkg15.pkg201.m200
+from pkg6.pkg82 import m2165
+from . import m4187
+
+
+def helper_8355_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8355_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8355_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,55 @@
+"""Module 14848."""
+import pkg3.pkg40.pkg528.m13031
+from pkg4.pkg56.pkg741 import m740
+import pkg1.pkg15.pkg203.m8538
+from pkg5.pkg66.pkg861 import m11280
+from . import m6512
+from pkg2.pkg34.pkg445 import m6696
+import pkg2.m1
+from pkg6.pkg85.pkg1106 import m1105
+import pkg1.pkg15.pkg205.m2288
+from pkg11.pkg147.pkg1919 import m4002
+import pkg6.pkg89.pkg1158.m3241
+from pkg12 import m11
+
+
+def helper_14848_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14848_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_14848_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_14848_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_14848_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_14848_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 2344."""
+import pkg4.pkg62.pkg814.m813
+from pkg11.pkg144 import m143
+from . import m260
+from pkg2.pkg37 import m36
+
+
+def helper_2344_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2344_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2344_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,31 @@
+"""Module 31520."""
+import pkg4.pkg55.pkg716.m2799
+from pkg10.pkg136.pkg1777 import m8028
+from . import m21100
+from . import m14848
+from . import m6512
+from pkg1 import m0
+from . import m2344
+from pkg3.pkg42.pkg548 import m547
+import pkg6.pkg84.pkg1104.m17775
+
+
+def helper_31520_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_31520_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_31520_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,34 @@
+"""Module 41940."""
+import pkg9.pkg119.pkg1557.m7808
+from . import m25268
+from . import m10680
+from pkg10.pkg140 import m39735
+import pkg7.pkg104.pkg1354.m3437
+from pkg12.pkg158.pkg2062 import m4145
+import pkg7.pkg103.pkg1341.m13844
+from . import m6512
+import pkg5.pkg74.pkg971.m5138
+from pkg4.pkg60.pkg783 import m782
+import pkg5.pkg67.pkg875.m7126
+from pkg6.pkg88.pkg1147 import m1146
+
+
+def helper_41940_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_41940_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_41940_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,16 @@
+"""Module 4428."""
+import pkg7.pkg102.pkg1328.m1327
+from pkg1 import m0
+import pkg11.pkg154.pkg2008.m2007
+from pkg8.pkg108.pkg1412 import m1411
+from . import m2344
+from pkg3.pkg42.pkg558 import m2641
+import pkg4.pkg55.pkg718.m717
+from pkg1.pkg24.pkg317 import m316
+
+
+def helper_4428_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
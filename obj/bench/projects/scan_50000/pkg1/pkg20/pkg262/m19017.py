@@ -0,0 +1,10 @@
+"""Module 19017."""
+import pkg2.pkg28.pkg375.m6626
+from pkg9.pkg122.pkg1587 import m1586
+
+
+def helper_19017_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
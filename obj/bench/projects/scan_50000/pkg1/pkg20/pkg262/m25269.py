@@ -0,0 +1,37 @@
+"""Module 25269."""
+from . import m10681
+from pkg2.pkg38.pkg501 import m15088
+from . import m2345
+from . import m6513
+import pkg5.pkg71.pkg927.m926
+from pkg6.pkg79.pkg1038 import m1037
+from . import m21101
+from . import m4429
+
+
+def helper_25269_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_25269_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_25269_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_25269_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
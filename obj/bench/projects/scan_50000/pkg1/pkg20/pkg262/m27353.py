@@ -0,0 +1,45 @@
+"""Module 27353."""
+import pkg7.pkg100.pkg1309.m26316
+from pkg11.pkg146 import m145
+import pkg11.pkg148.pkg1933.m6100
+from . import m2345
+from . import m25269
+from . import m8597
+import pkg2.pkg27.pkg357.m2440
+from pkg6.pkg90.pkg1173 import m7424
+from . import m16933
+
+
+def helper_27353_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_27353_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_27353_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_27353_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_27353_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
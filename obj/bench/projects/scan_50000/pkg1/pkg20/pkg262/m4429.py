@@ -0,0 +1,25 @@
+"""Module 4429."""
+import pkg3.pkg48.pkg632.m631
+from pkg10.pkg143 import m142
+import pkg9.pkg129.pkg1690.m1689
+from pkg4.pkg63.pkg832 import m2915
+from . import m261
+from . import m2345
+import pkg7.pkg92.m91
+from pkg6.pkg90 import m89
+import pkg1.m0
+from pkg1.pkg26.pkg348 import m2431
+
+
+def helper_4429_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4429_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
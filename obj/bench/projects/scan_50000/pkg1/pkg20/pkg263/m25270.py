@@ -0,0 +1,9 @@
+"""Module 25270."""
+from . import m12766
+
+
+def helper_25270_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
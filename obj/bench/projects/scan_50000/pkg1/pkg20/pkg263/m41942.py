@@ -0,0 +1,16 @@
+"""Module 41942."""
+from . import m262
+from pkg1 import m0
+import pkg9.pkg129.pkg1690.m12109
+from pkg11.pkg156.pkg2041 import m37468
+import pkg1.pkg17.pkg222.m21061
+from . import m39858
+import pkg10.pkg135.m4302
+from pkg2.pkg33.pkg438 import m4605
+
+
+def helper_41942_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
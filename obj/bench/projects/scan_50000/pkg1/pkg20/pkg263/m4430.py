@@ -0,0 +1,10 @@
+"""Module 4430."""
+import pkg2.pkg39.pkg513.m512
+from pkg2.pkg34.pkg454 import m453
+import pkg11.pkg153.m152
+from pkg12 import m11
+import pkg7.pkg97.pkg1274.m3357
+from . import m262
+import pkg4.pkg60.pkg788.m787
+from . import m2346
+import pkg4.pkg57.pkg754.m753
@@ -0,0 +1,46 @@
+"""Module 6514."""
+from . import m262
+from pkg11.pkg151.pkg1975 import m6142
+import pkg8.pkg111.pkg1453.m5620
+from pkg4.pkg65.pkg851 import m850
+import pkg2.pkg35.pkg459.m458
+from pkg5.pkg78.pkg1024 import m3107
+import pkg5.pkg67.m66
+from . import m4430
+import pkg1.pkg20.pkg261.m6512
+from pkg3.pkg50.pkg652 import m651
+
+
+def helper_6514_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6514_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6514_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6514_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_6514_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
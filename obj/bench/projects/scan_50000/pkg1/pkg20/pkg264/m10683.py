@@ -0,0 +1,45 @@
+"""Module 10683."""
+from . import m4431
+from . import m2347
+import pkg12.pkg157.m10576
+from pkg7.pkg103 import m102
+import pkg3.pkg47.m46
+from pkg3.pkg47.pkg615 import m2698
+import pkg6.pkg79.m78
+from pkg1.pkg26 import m25
+from . import m6515
+
+
+def helper_10683_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10683_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_10683_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_10683_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_10683_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,24 @@
+"""Module 2347."""
+import pkg8.pkg112.pkg1467.m1466
+from pkg6.pkg85.pkg1113 import m1112
+import pkg7.pkg96.pkg1254.m1253
+from pkg2.pkg36.pkg472 import m471
+import pkg9.pkg121.pkg1579.m1578
+from pkg2.pkg34 import m33
+import pkg3.m2
+from pkg11.pkg152.pkg1980 import m1979
+from . import m263
+
+
+def helper_2347_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2347_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,33 @@
+"""Module 31523."""
+import pkg5.pkg73.pkg951.m28042
+from pkg3.pkg41.pkg534 import m533
+import pkg4.pkg60.pkg789.m19544
+from . import m23187
+from . import m10683
+from pkg6.pkg80.pkg1042 import m1041
+import pkg3.pkg49.pkg641.m29816
+from pkg12.pkg160 import m159
+import pkg2.pkg33.m32
+from pkg6.pkg80 import m79
+import pkg8.pkg110.pkg1437.m26444
+
+
+def helper_31523_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_31523_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_31523_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
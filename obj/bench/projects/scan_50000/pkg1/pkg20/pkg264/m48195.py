@@ -0,0 +1,60 @@
+"""Module 48195."""
+import pkg8.pkg116.pkg1520.m30695
+from pkg3.pkg48.pkg637 import m2720
+import pkg6.pkg79.pkg1040.m9375
+from pkg3 import m2
+import pkg11.pkg146.pkg1908.m28999
+from pkg10.pkg132.pkg1721 import m3804
+import pkg3.pkg48.pkg626.m625
+from . import m27355
+import pkg9.pkg127.pkg1664.m47511
+from pkg3.pkg52.pkg685 import m27776
+
+
+def helper_48195_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_48195_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_48195_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_48195_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_48195_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_48195_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_48195_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
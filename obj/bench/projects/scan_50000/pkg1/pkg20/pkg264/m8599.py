@@ -0,0 +1,53 @@
+"""Module 8599."""
+from . import m6515
+from pkg7.pkg98 import m97
+import pkg9.m8
+from pkg6.pkg89.pkg1163 import m1162
+import pkg8.pkg105.pkg1369.m3452
+from pkg10.pkg137.pkg1794 import m1793
+import pkg7.pkg102.m2185
+from . import m4431
+import pkg5.pkg70.m6321
+from pkg5.pkg69.pkg901 import m2984
+
+
+def helper_8599_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8599_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8599_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8599_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_8599_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_8599_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 12768."""
+import pkg2.pkg39.pkg510.m4677
+from pkg4.pkg58.pkg757 import m756
+import pkg3.pkg43.pkg566.m4733
+
+
+def helper_12768_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
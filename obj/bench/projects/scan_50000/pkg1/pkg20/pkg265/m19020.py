@@ -0,0 +1,9 @@
+"""Module 19020."""
+import pkg4.pkg65.pkg850.m5017
+
+
+def helper_19020_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
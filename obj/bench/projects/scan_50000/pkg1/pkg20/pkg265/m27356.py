@@ -0,0 +1,9 @@
+"""Module 27356."""
+from . import m10684
+
+
+def helper_27356_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,36 @@
+"""Module 44028."""
+import pkg9.pkg118.pkg1546.m3629
+from pkg4.pkg61.pkg802 import m11221
+from . import m4432
+from . import m19020
+import pkg4.pkg61.pkg795.m15382
+from pkg7.pkg104 import m103
+import pkg13.pkg179.m178
+
+
+def helper_44028_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_44028_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_44028_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_44028_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
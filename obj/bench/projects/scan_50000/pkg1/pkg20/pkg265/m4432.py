@@ -0,0 +1,14 @@
+"""Module 4432."""
+from . import m264
+from pkg7.pkg92.pkg1198 import m1197
+import pkg2.m1
+from pkg1 import m0
+import pkg12.pkg158.pkg2065.m2064
+from pkg2.pkg33.pkg442 import m441
+
+
+def helper_4432_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
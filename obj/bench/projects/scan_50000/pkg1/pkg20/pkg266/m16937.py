@@ -0,0 +1,19 @@
+"""Module 16937."""
+import pkg8.pkg108.pkg1405.m3488
+from pkg5.pkg75 import m14662
+import pkg10.pkg132.pkg1725.m1724
+from . import m14853
+
+
+def helper_16937_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16937_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
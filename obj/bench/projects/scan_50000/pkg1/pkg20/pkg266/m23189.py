@@ -0,0 +1,26 @@
+"""Module 23189."""
+from . import m12769
+from pkg11.pkg144.pkg1874 import m10209
+import pkg5.pkg66.pkg864.m7115
+from pkg11.pkg152.pkg1978 import m16565
+
+
+def helper_23189_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_23189_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_23189_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 265."""
+import pkg13.m12
+from pkg9.pkg119 import m118
+import pkg5.m4
+from pkg7.pkg95 import m94
+import pkg5.pkg68.m67
+from pkg12 import m11
+import pkg2.m1
+from pkg1.pkg14 import m13
+import pkg8.m7
+
+
+def helper_265_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
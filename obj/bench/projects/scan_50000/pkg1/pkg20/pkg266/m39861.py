@@ -0,0 +1,11 @@
+"""Module 39861."""
+from . import m19021
+from pkg12.pkg159 import m158
+import pkg5.pkg68.pkg885.m9220
+
+
+def helper_39861_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
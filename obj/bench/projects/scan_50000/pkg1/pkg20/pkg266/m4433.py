@@ -0,0 +1,9 @@
+"""Module 4433."""
+import pkg12.pkg160.m2243
+from pkg13 import m12
+import pkg3.pkg44.pkg574.m2657
+from pkg2.pkg33.pkg431 import m430
+from . import m2349
+from pkg7.pkg101.pkg1325 import m1324
+import pkg1.m0
+from pkg4.pkg61.pkg800 import m799
@@ -0,0 +1,31 @@
+"""Module 27358."""
+import pkg4.pkg58.pkg761.m13264
+from pkg9.pkg125.pkg1627 import m18298
+from . import m16938
+from pkg2.pkg39.pkg519 import m10938
+from . import m21106
+from pkg10.pkg139.pkg1808 import m1807
+from . import m4434
+from . import m8602
+import pkg8.pkg114.pkg1486.m1485
+
+
+def helper_27358_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_27358_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_27358_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,5 @@
+"""Module 31526."""
+import pkg3.pkg51.m50
+from . import m29442
+import pkg11.pkg152.pkg1988.m4071
+from pkg1 import m0
@@ -0,0 +1,38 @@
+"""Module 6518."""
+import pkg12.pkg159.pkg2072.m2071
+from pkg1.pkg14.pkg189 import m188
+import pkg5.m4
+from pkg4.pkg58.pkg760 import m759
+import pkg10.pkg137.pkg1793.m1792
+from pkg3.pkg44 import m43
+import pkg5.pkg75.pkg985.m984
+from pkg5.pkg76.pkg995 import m3078
+import pkg4.pkg53.m52
+
+
+def helper_6518_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6518_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6518_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6518_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
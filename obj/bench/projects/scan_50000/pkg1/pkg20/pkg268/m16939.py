@@ -0,0 +1,20 @@
+"""Module 16939."""
+import pkg4.pkg63.pkg831.m2914
+from . import m14855
+from . import m2351
+from pkg6 import m5
+import pkg7.pkg95.m94
+from pkg12.pkg166 import m165
+import pkg8.pkg113.m112
+from . import m12771
+import pkg4.pkg64.pkg833.m5000
+from . import m4435
+import pkg3.pkg49.pkg642.m15229
+from pkg3.pkg51 import m10470
+
+
+def helper_16939_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,40 @@
+"""Module 19023."""
+import pkg8.pkg107.pkg1397.m18068
+from . import m12771
+import pkg2.pkg28.pkg372.m371
+from . import m2351
+import pkg3.pkg41.pkg535.m534
+from pkg1.pkg19.pkg254 import m253
+import pkg8.pkg105.pkg1375.m1374
+from pkg1 import m0
+import pkg5.pkg69.m68
+from pkg5.pkg78.pkg1026 import m3109
+from . import m16939
+
+
+def helper_19023_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_19023_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_19023_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_19023_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
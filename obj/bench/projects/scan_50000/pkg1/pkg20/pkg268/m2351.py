@@ -0,0 +1,16 @@
+"""Module 2351."""
+from . import m267
+from pkg1.pkg15.pkg205 import m204
+import pkg1.pkg25.pkg330.m329
+from pkg9.pkg128 import m127
+import pkg11.pkg156.pkg2029.m2028
+from pkg3.pkg49.pkg643 import m642
+import pkg1.m0
+from pkg3.pkg44.pkg575 import m574
+
+
+def helper_2351_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
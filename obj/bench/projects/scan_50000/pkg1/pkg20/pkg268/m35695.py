@@ -0,0 +1,32 @@
+"""Module 35695."""
+import pkg5.m4
+from pkg9.pkg123.pkg1610 import m28701
+import pkg8.pkg112.pkg1459.m13962
+from pkg1.pkg21.pkg280 import m279
+import pkg1.pkg26.pkg350.m14937
+from pkg11.pkg145.pkg1888 import m35231
+import pkg13.pkg176.m175
+from pkg4.pkg65.pkg853 import m5020
+import pkg2.pkg29.pkg390.m389
+from pkg11.pkg150.pkg1954 import m12373
+
+
+def helper_35695_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35695_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_35695_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,32 @@
+"""Module 12772."""
+import pkg5.pkg68.pkg893.m9228
+from pkg2.pkg28.pkg372 import m8707
+import pkg3.pkg49.m48
+from . import m8604
+import pkg4.pkg61.pkg806.m11225
+from pkg1.pkg26.pkg345 import m344
+import pkg1.pkg26.pkg348.m347
+from pkg2.pkg29.pkg385 import m6636
+import pkg3.pkg46.pkg599.m8934
+from . import m10688
+
+
+def helper_12772_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12772_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_12772_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,33 @@
+"""Module 16940."""
+from . import m4436
+from . import m6520
+import pkg10.pkg137.pkg1788.m1787
+from pkg9.pkg122.pkg1594 import m5761
+import pkg9.pkg118.m117
+from pkg2 import m1
+import pkg7.pkg100.pkg1309.m5476
+from pkg9.pkg119.pkg1553 import m3636
+import pkg6.pkg83.pkg1084.m5251
+from pkg11.pkg152.pkg1978 import m10313
+import pkg2.pkg29.pkg389.m14976
+
+
+def helper_16940_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16940_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_16940_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
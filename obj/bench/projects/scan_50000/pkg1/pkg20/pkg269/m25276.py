@@ -0,0 +1,19 @@
+"""Module 25276."""
+import pkg1.pkg18.m17
+from pkg4.pkg54.pkg714 import m9049
+import pkg9.pkg124.pkg1624.m1623
+from pkg5.pkg76.pkg990 import m989
+import pkg5.pkg68.pkg886.m885
+from pkg1 import m0
+import pkg9.pkg129.pkg1689.m1688
+from pkg9.pkg130.pkg1697 import m5864
+import pkg1.pkg20.pkg273.m4440
+from pkg3.pkg42 import m41
+import pkg5.pkg75.pkg985.m984
+
+
+def helper_25276_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,21 @@
+"""Module 29444."""
+from . import m23192
+from pkg8.pkg117.pkg1530 import m16117
+import pkg1.pkg15.pkg207.m8542
+from pkg3.pkg43.pkg566 import m565
+import pkg9.pkg128.pkg1674.m14177
+from pkg1.pkg21.pkg286 import m285
+
+
+def helper_29444_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_29444_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,43 @@
+"""Module 41948."""
+import pkg4.pkg61.pkg794.m793
+from . import m31528
+import pkg3.pkg46.m35473
+from pkg11.pkg154.pkg2014 import m18685
+import pkg6.pkg88.pkg1157.m15744
+from pkg8.pkg105.pkg1371 import m13874
+import pkg6.pkg91.m6342
+
+
+def helper_41948_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_41948_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_41948_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_41948_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_41948_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,32 @@
+"""Module 21109."""
+from . import m6521
+from pkg13.pkg177 import m176
+from . import m8605
+from pkg7.pkg93.pkg1213 import m19968
+from . import m4437
+from pkg5.pkg68.pkg888 import m5055
+import pkg3.pkg46.pkg601.m2684
+from pkg12.pkg157 import m10576
+from . import m2353
+from pkg1.pkg21.pkg286 import m19041
+
+
+def helper_21109_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_21109_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_21109_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
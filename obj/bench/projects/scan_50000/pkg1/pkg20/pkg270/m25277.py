@@ -0,0 +1,18 @@
+"""Module 25277."""
+from . import m14857
+from pkg2.pkg33.pkg432 import m4599
+import pkg7.pkg102.pkg1327.m7578
+
+
+def helper_25277_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_25277_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
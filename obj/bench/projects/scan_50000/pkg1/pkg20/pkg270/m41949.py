@@ -0,0 +1,26 @@
+"""Module 41949."""
+import pkg1.m0
+from . import m31529
+import pkg7.pkg97.pkg1269.m1268
+from . import m27361
+import pkg1.pkg21.pkg275.m274
+from pkg2.pkg38.pkg506 import m10925
+from . import m6521
+from pkg2.pkg36.pkg474 import m19229
+from . import m269
+from pkg7.pkg103.pkg1341 import m13844
+import pkg2.pkg39.pkg515.m35942
+
+
+def helper_41949_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_41949_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 6521."""
+import pkg6.pkg90.pkg1180.m5347
+from . import m269
+import pkg1.pkg21.pkg278.m277
+from pkg10.pkg135 import m134
+import pkg1.m0
+from pkg12.pkg159.pkg2079 import m4162
+import pkg6.pkg82.pkg1074.m5241
+from pkg11.pkg152 import m151
+import pkg12.pkg157.m156
+from pkg8.pkg116.pkg1521 import m3604
+import pkg4.pkg57.pkg742.m741
+
+
+def helper_6521_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6521_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
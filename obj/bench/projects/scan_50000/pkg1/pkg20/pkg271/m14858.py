@@ -0,0 +1,32 @@
+"""Module 14858."""
+import pkg10.pkg139.pkg1820.m3903
+from pkg10.pkg141.pkg1842 import m1841
+import pkg1.m0
+from pkg9.pkg120.pkg1572 import m1571
+from . import m12774
+from pkg2 import m1
+import pkg10.pkg131.pkg1707.m10042
+from pkg13.pkg170 import m6421
+import pkg3.pkg50.pkg658.m2741
+from . import m270
+
+
+def helper_14858_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14858_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_14858_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
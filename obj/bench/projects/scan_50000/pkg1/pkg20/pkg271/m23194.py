@@ -0,0 +1,39 @@
+"""Module 23194."""
+import pkg5.pkg70.m69
+from pkg12.pkg158.pkg2066 import m12485
+import pkg1.m0
+from pkg6.pkg91 import m23014
+import pkg11.pkg149.m14736
+from pkg6.pkg90.pkg1177 import m7428
+import pkg9.pkg120.pkg1572.m9907
+from pkg9.pkg127.pkg1657 import m22496
+from . import m8606
+from pkg8.pkg106.pkg1391 import m13894
+
+
+def helper_23194_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_23194_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_23194_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_23194_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,10 @@
+"""Module 2354."""
+import pkg1.m0
+from pkg4.pkg53.pkg697 import m696
+
+
+def helper_2354_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
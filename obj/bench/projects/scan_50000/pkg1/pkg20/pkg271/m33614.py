@@ -0,0 +1,26 @@
+"""Module 33614."""
+import pkg8.pkg111.pkg1454.m7705
+from pkg6.pkg79.pkg1033 import m11452
+import pkg2.m1
+from pkg3.pkg50.pkg657 import m8992
+
+
+def helper_33614_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_33614_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_33614_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
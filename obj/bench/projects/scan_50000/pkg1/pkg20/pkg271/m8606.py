@@ -0,0 +1,12 @@
+"""Module 8606."""
+import pkg5.pkg78.m2161
+from pkg8.pkg113.pkg1470 import m3553
+import pkg1.pkg24.pkg324.m323
+from pkg13.pkg180 import m179
+
+
+def helper_8606_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,52 @@
+"""Module 10691."""
+import pkg8.pkg107.pkg1395.m1394
+from . import m4439
+import pkg7.pkg97.pkg1266.m7517
+from pkg5.pkg69.pkg902 import m7153
+import pkg1.pkg26.pkg343.m4510
+from pkg10.pkg143.pkg1870 import m10205
+import pkg4.pkg54.pkg711.m710
+from pkg7.pkg101.pkg1320 import m1319
+import pkg1.pkg17.pkg223.m222
+
+
+def helper_10691_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10691_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_10691_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_10691_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_10691_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_10691_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
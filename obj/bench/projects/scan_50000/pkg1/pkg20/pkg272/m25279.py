@@ -0,0 +1,30 @@
+"""Module 25279."""
+import pkg1.m0
+from pkg7.pkg104.pkg1354 import m11773
+import pkg4.pkg65.pkg855.m854
+from pkg9.pkg125.pkg1634 import m5801
+import pkg3.pkg51.pkg673.m6924
+from pkg1.pkg15.pkg208 import m8543
+import pkg3.pkg51.pkg676.m13179
+from pkg12.pkg157.pkg2047 import m16634
+
+
+def helper_25279_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_25279_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_25279_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
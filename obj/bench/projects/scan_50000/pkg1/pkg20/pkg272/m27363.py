@@ -0,0 +1,55 @@
+"""Module 27363."""
+import pkg11.pkg148.pkg1936.m22775
+from . import m10691
+import pkg10.pkg141.pkg1842.m6009
+from pkg5.pkg78.pkg1023 import m1022
+import pkg2.pkg38.m37
+from pkg11.pkg145.pkg1887 import m24810
+import pkg8.pkg105.m104
+from pkg1.pkg22.pkg292 import m291
+import pkg11.pkg151.m150
+from pkg2.pkg27.pkg353 import m12856
+import pkg1.pkg14.m13
+from pkg9.pkg126.pkg1650 import m1649
+
+
+def helper_27363_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_27363_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_27363_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_27363_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_27363_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_27363_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
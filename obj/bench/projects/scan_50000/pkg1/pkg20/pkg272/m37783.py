@@ -0,0 +1,25 @@
+"""Module 37783."""
+import pkg9.pkg127.m2210
+from pkg8.pkg115.pkg1505 import m22344
+from . import m31531
+from pkg11.pkg147.pkg1917 import m20672
+from . import m8607
+from pkg2.pkg27.pkg363 import m362
+import pkg5.pkg77.pkg1008.m13511
+from . import m6523
+import pkg1.pkg26.pkg348.m347
+from . import m2355
+
+
+def helper_37783_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37783_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
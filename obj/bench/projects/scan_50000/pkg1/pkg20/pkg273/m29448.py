@@ -0,0 +1,2 @@
+"""Module 29448."""
+import pkg5.pkg73.pkg954.m953
@@ -0,0 +1,28 @@
+"""Module 37784."""
+from . import m10692
+from . import m2356
+from . import m21112
+from . import m14860
+import pkg4.pkg55.m54
+from pkg7.pkg100 import m99
+
+
+def helper_37784_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37784_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_37784_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,9 @@
+"""Module 41952."""
+from . import m4440
+
+
+def helper_41952_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
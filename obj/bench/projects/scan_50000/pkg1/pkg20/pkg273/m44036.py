@@ -0,0 +1,60 @@
+"""Module 44036."""
+import pkg4.pkg59.pkg770.m769
+from pkg5.pkg70.pkg922 import m23845
+from . import m39868
+from pkg6.pkg86.pkg1127 import m19882
+import pkg12.pkg160.pkg2082.m16669
+from pkg3.pkg45.pkg586 import m4753
+import pkg1.pkg21.pkg278.m277
+from pkg8.pkg110.pkg1433 import m3516
+import pkg8.pkg110.pkg1436.m32695
+from pkg7.pkg99.pkg1297 import m3380
+
+
+def helper_44036_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_44036_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_44036_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_44036_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_44036_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_44036_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_44036_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 48204."""
+from . import m37784
+from pkg5.pkg66.pkg870 import m869
+import pkg5.pkg66.pkg859.m44622
+from pkg9.pkg118.pkg1540 import m1539
+import pkg8.pkg113.pkg1474.m11893
+from pkg8.pkg112.pkg1460 import m38971
+import pkg8.pkg108.m8443
+from pkg1.pkg25.pkg329 import m10748
+import pkg1.pkg14.pkg195.m194
+
+
+def helper_48204_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
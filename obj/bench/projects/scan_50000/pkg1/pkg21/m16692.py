@@ -0,0 +1,32 @@
+"""Module 16692."""
+import pkg4.pkg63.pkg826.m825
+from pkg4.pkg54.pkg710 import m2793
+import pkg8.pkg117.m2200
+from pkg10.pkg142.pkg1848 import m1847
+import pkg4.pkg57.pkg742.m2825
+from . import m10440
+import pkg1.m0
+from pkg2.pkg28.pkg377 import m376
+import pkg6.pkg79.pkg1032.m11451
+from . import m6272
+
+
+def helper_16692_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16692_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_16692_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,21 @@
+"""Module 20."""
+import pkg2.m1
+from pkg1.pkg14 import m13
+import pkg1.m0
+from pkg1.pkg18 import m17
+import pkg6.m5
+from pkg5 import m4
+
+
+def helper_20_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_20_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,24 @@
+"""Module 20860."""
+import pkg2.pkg38.pkg503.m13006
+from pkg1.pkg25.pkg326 import m10745
+from . import m2104
+from pkg5.pkg75.pkg979 import m978
+from . import m20
+from pkg11.pkg153.pkg1992 import m1991
+import pkg5.pkg77.pkg1003.m1002
+from pkg2.pkg27.pkg364 import m363
+import pkg1.pkg19.pkg248.m247
+
+
+def helper_20860_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_20860_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
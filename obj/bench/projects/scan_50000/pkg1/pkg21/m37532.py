@@ -0,0 +1,25 @@
+"""Module 37532."""
+import pkg2.pkg28.pkg377.m2460
+from pkg6.pkg79.pkg1033 import m1032
+import pkg3.pkg43.m42
+
+
+def helper_37532_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37532_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_37532_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,46 @@
+"""Module 12777."""
+import pkg3.pkg48.pkg636.m2719
+from pkg4.pkg65.pkg847 import m2930
+import pkg2.pkg37.pkg493.m492
+from pkg1.pkg19.pkg254 import m253
+import pkg1.pkg14.pkg187.m186
+from pkg2.pkg39.pkg510 import m8845
+import pkg6.pkg82.m81
+from . import m4441
+import pkg7.pkg94.m4261
+from pkg9.pkg128.pkg1670 import m3753
+
+
+def helper_12777_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12777_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_12777_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_12777_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_12777_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,30 @@
+"""Module 14861."""
+import pkg9.pkg125.m6376
+from pkg8.pkg107.pkg1392 import m9727
+import pkg8.pkg106.pkg1386.m1385
+from pkg3.pkg44.pkg584 import m2667
+import pkg1.pkg19.pkg253.m252
+from pkg10.pkg136.pkg1770 import m8021
+from . import m2357
+from pkg11.pkg144.pkg1873 import m1872
+
+
+def helper_14861_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14861_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_14861_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
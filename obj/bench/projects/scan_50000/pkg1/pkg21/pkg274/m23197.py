@@ -0,0 +1,10 @@
+"""Module 23197."""
+import pkg6.pkg91.pkg1186.m13689
+from pkg2.pkg31.pkg410 import m14997
+
+
+def helper_23197_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
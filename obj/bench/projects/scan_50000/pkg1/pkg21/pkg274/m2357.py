@@ -0,0 +1,40 @@
+"""Module 2357."""
+import pkg3.pkg41.pkg536.m535
+from pkg1.pkg21 import m20
+import pkg3.pkg42.pkg548.m547
+from pkg10.pkg134 import m133
+import pkg5.pkg75.m2158
+from pkg3.pkg44.pkg579 import m578
+import pkg1.pkg24.pkg325.m324
+from pkg4.pkg60.pkg789 import m788
+import pkg5.pkg78.pkg1021.m1020
+from pkg1.pkg24 import m23
+import pkg9.pkg125.pkg1632.m1631
+
+
+def helper_2357_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2357_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2357_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2357_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
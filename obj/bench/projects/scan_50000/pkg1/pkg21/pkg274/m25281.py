@@ -0,0 +1,11 @@
+"""Module 25281."""
+import pkg2.pkg31.pkg406.m8741
+from pkg1.pkg15.pkg203 import m10622
+import pkg2.pkg29.pkg387.m14974
+
+
+def helper_25281_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
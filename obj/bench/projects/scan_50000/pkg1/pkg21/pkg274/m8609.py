@@ -0,0 +1,20 @@
+"""Module 8609."""
+import pkg6.pkg85.pkg1112.m5279
+from . import m2357
+import pkg6.pkg86.m85
+from pkg1 import m0
+import pkg10.pkg142.m141
+
+
+def helper_8609_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8609_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
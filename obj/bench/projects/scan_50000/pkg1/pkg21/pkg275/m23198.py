@@ -0,0 +1,19 @@
+"""Module 23198."""
+import pkg8.pkg105.pkg1376.m22215
+from pkg6.pkg89 import m18844
+import pkg11.pkg156.pkg2038.m10373
+from pkg1.pkg14.pkg195 import m12698
+import pkg5.pkg73.m72
+from pkg2.pkg31.pkg406 import m6657
+import pkg3.pkg50.pkg651.m11070
+from . import m16946
+import pkg10.pkg140.m8475
+from pkg2.pkg31.pkg408 import m6659
+import pkg4.pkg57.pkg744.m743
+
+
+def helper_23198_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,29 @@
+"""Module 2358."""
+import pkg13.m12
+from pkg5 import m4
+import pkg6.pkg80.pkg1046.m1045
+from . import m274
+import pkg4.pkg62.pkg809.m808
+from pkg6.pkg89.pkg1168 import m1167
+import pkg1.m0
+
+
+def helper_2358_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2358_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2358_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,33 @@
+"""Module 25282."""
+from . import m10694
+from pkg1.pkg15.pkg204 import m203
+import pkg3.pkg42.pkg554.m553
+from pkg1.pkg17.pkg232 import m231
+import pkg1.pkg20.pkg268.m19023
+from pkg3.pkg49.pkg648 import m647
+import pkg4.pkg55.pkg726.m15313
+from pkg7.pkg102 import m12605
+from . import m2358
+from pkg5.pkg71.pkg927 import m5094
+import pkg1.pkg19.pkg255.m254
+
+
+def helper_25282_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_25282_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_25282_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 39870."""
+import pkg2.m1
+from pkg2.pkg35.pkg458 import m457
+import pkg9.pkg129.pkg1690.m1689
+from pkg6.pkg79.pkg1033 import m9368
+import pkg7.pkg92.m91
+
+
+def helper_39870_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39870_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_39870_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
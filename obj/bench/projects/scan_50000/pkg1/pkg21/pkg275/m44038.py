@@ -0,0 +1,36 @@
+"""Module 44038."""
+import pkg11.pkg144.m2227
+from pkg8.pkg111 import m14698
+from . import m37786
+from pkg1.pkg24 import m23
+import pkg10.pkg141.pkg1840.m16427
+from pkg10.pkg137 import m136
+import pkg6.pkg84.pkg1094.m7345
+
+
+def helper_44038_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_44038_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_44038_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_44038_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
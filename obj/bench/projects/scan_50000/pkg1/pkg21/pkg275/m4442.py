@@ -0,0 +1,20 @@
+"""Module 4442."""
+import pkg3.pkg50.pkg651.m2734
+from pkg1 import m0
+import pkg11.pkg150.pkg1960.m1959
+from pkg1.pkg17.pkg233 import m2316
+import pkg1.pkg26.pkg339.m2422
+
+
+def helper_4442_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4442_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
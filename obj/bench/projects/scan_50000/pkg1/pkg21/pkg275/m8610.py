@@ -0,0 +1,26 @@
+"""Module 8610."""
+from . import m6526
+from . import m274
+import pkg3.pkg46.m45
+from pkg2.pkg30.pkg395 import m394
+import pkg2.pkg37.pkg484.m2567
+from pkg8.pkg110 import m2193
+from . import m2358
+from pkg10.pkg140.pkg1833 import m3916
+import pkg1.m0
+from . import m4442
+import pkg6.pkg84.pkg1098.m1097
+
+
+def helper_8610_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8610_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
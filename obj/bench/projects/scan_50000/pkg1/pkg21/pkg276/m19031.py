@@ -0,0 +1,61 @@
+"""Module 19031."""
+import pkg9.pkg126.pkg1639.m16226
+from . import m2359
+import pkg2.pkg29.m28
+from pkg7.pkg92.pkg1204 import m1203
+import pkg5.pkg66.pkg869.m868
+from pkg10.pkg132.pkg1727 import m5894
+import pkg7.pkg92.m8427
+from pkg6.pkg88.pkg1146 import m1145
+import pkg11.pkg144.m4311
+from pkg10.pkg138.pkg1796 import m1795
+import pkg6.pkg84.pkg1105.m5272
+
+
+def helper_19031_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_19031_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_19031_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_19031_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_19031_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_19031_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_19031_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,38 @@
+"""Module 25283."""
+import pkg1.pkg25.pkg327.m12830
+from pkg4.pkg57.pkg751 import m2834
+import pkg1.pkg14.m13
+from pkg7 import m6
+import pkg1.pkg19.pkg255.m254
+from pkg2.pkg30.pkg395 import m394
+import pkg10.pkg142.m141
+from . import m21115
+import pkg6.pkg85.pkg1115.m1114
+
+
+def helper_25283_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_25283_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_25283_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_25283_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
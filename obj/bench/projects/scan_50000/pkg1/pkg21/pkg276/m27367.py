@@ -0,0 +1,10 @@
+"""Module 27367."""
+import pkg8.pkg113.m8448
+from . import m10695
+
+
+def helper_27367_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
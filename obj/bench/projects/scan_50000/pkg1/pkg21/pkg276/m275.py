@@ -0,0 +1,11 @@
+"""Module 275."""
+import pkg2.pkg33.m32
+from pkg9.pkg129 import m128
+import pkg1.pkg16.pkg213.m212
+
+
+def helper_275_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,40 @@
+"""Module 29451."""
+from . import m10695
+from pkg11.pkg154.pkg2003 import m6170
+from . import m6527
+from . import m25283
+import pkg9.pkg128.m20967
+from pkg6.pkg80.pkg1046 import m11465
+import pkg9.pkg119.pkg1560.m5727
+from . import m12779
+import pkg4.pkg53.m52
+from pkg3.pkg45.pkg591 import m6842
+import pkg7.pkg98.pkg1275.m5442
+
+
+def helper_29451_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_29451_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_29451_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_29451_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
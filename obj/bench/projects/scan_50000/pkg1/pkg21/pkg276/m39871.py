@@ -0,0 +1,12 @@
+"""Module 39871."""
+import pkg12.pkg158.pkg2055.m4138
+from . import m29451
+import pkg4.m3
+from pkg7.pkg101.pkg1319 import m26326
+
+
+def helper_39871_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
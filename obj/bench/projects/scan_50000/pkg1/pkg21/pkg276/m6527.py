@@ -0,0 +1,45 @@
+"""Module 6527."""
+import pkg8.pkg110.pkg1433.m3516
+from pkg4.pkg55 import m54
+from . import m4443
+from pkg2.pkg34 import m33
+import pkg8.pkg105.pkg1378.m1377
+from pkg4.pkg63.pkg832 import m831
+import pkg8.pkg105.pkg1369.m5536
+from pkg8.pkg115.pkg1501 import m3584
+import pkg2.pkg27.m26
+
+
+def helper_6527_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6527_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6527_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6527_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_6527_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,9 @@
+"""Module 16948."""
+from . import m8612
+
+
+def helper_16948_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
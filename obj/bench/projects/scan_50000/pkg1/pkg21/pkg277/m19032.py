@@ -0,0 +1,8 @@
+"""Module 19032."""
+
+
+def helper_19032_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
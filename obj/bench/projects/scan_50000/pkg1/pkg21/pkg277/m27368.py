@@ -0,0 +1,45 @@
+"""Module 27368."""
+import pkg3.pkg42.pkg554.m13057
+from pkg4.pkg55 import m54
+import pkg3.pkg51.pkg669.m668
+from pkg9.pkg119.pkg1559 import m16146
+import pkg9.pkg124.pkg1616.m14119
+from pkg11.pkg156.pkg2037 import m14540
+import pkg11.pkg149.pkg1940.m16527
+from pkg3.pkg49.pkg639 import m17310
+import pkg12.pkg157.pkg2050.m2049
+
+
+def helper_27368_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_27368_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_27368_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_27368_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_27368_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,40 @@
+"""Module 276."""
+import pkg2.pkg35.m34
+from pkg1.pkg16.pkg213 import m212
+import pkg2.pkg32.m31
+from pkg1.pkg20 import m19
+import pkg1.m0
+from pkg1.pkg17 import m16
+import pkg6.pkg84.m83
+from pkg2.pkg39 import m38
+import pkg4.m3
+from pkg2.pkg28 import m27
+import pkg13.pkg170.m169
+
+
+def helper_276_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_276_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_276_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_276_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
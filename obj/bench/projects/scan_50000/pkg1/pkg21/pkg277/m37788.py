@@ -0,0 +1,19 @@
+"""Module 37788."""
+import pkg6.pkg83.pkg1087.m1086
+from pkg1 import m0
+import pkg12.pkg159.pkg2076.m2075
+from pkg9.pkg120.pkg1573 import m1572
+import pkg4.pkg53.pkg691.m27782
+from pkg10.pkg143.pkg1869 import m31044
+from . import m19032
+from pkg5.pkg70.pkg916 import m19671
+import pkg13.pkg175.m174
+from pkg1.pkg15.pkg197 import m18952
+import pkg9.pkg122.pkg1589.m16176
+
+
+def helper_37788_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
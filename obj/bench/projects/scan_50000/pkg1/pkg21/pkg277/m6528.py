@@ -0,0 +1,16 @@
+"""Module 6528."""
+import pkg9.pkg122.pkg1595.m1594
+from pkg2.pkg31.pkg406 import m405
+import pkg6.pkg91.m90
+from pkg1.pkg26 import m25
+import pkg3.pkg50.m49
+from pkg1.pkg14 import m13
+import pkg4.pkg56.pkg732.m2815
+from pkg2.pkg34.pkg447 import m446
+
+
+def helper_6528_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
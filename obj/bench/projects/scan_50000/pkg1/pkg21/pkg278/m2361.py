@@ -0,0 +1,19 @@
+"""Module 2361."""
+import pkg7.m6
+from pkg1 import m0
+import pkg4.pkg63.pkg822.m821
+from pkg9.pkg126.pkg1641 import m1640
+
+
+def helper_2361_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2361_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
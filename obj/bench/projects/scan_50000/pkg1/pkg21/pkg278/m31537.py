@@ -0,0 +1,11 @@
+"""Module 31537."""
+import pkg10.pkg138.pkg1802.m30977
+from . import m2361
+import pkg1.pkg23.pkg301.m300
+
+
+def helper_31537_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
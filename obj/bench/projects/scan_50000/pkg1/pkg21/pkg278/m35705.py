@@ -0,0 +1,17 @@
+"""Module 35705."""
+import pkg2.pkg28.pkg370.m6621
+from pkg2.pkg35.pkg461 import m25468
+import pkg5.pkg70.pkg922.m5089
+from pkg7.pkg93.pkg1214 import m34557
+import pkg6.pkg84.pkg1102.m7353
+from . import m4445
+from . import m21117
+from pkg5.pkg71.pkg933 import m932
+import pkg3.pkg48.pkg627.m6878
+
+
+def helper_35705_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 46125."""
+from . import m23201
+from pkg3.pkg42.pkg559 import m558
+import pkg2.pkg37.pkg484.m19239
+from pkg1 import m0
+import pkg4.pkg62.pkg807.m806
+from pkg6 import m5
+from . import m6529
+from pkg3.pkg48.pkg634 import m633
+from . import m2361
+from pkg12.pkg159.pkg2073 import m39584
+
+
+def helper_46125_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_46125_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
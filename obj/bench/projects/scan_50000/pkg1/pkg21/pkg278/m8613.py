@@ -0,0 +1,43 @@
+"""Module 8613."""
+import pkg10.pkg142.pkg1857.m1856
+from pkg1.pkg22.pkg292 import m4459
+import pkg8.pkg112.pkg1466.m7717
+from pkg1 import m0
+from . import m2361
+from pkg1.pkg14.pkg189 import m188
+import pkg4.pkg54.pkg705.m704
+
+
+def helper_8613_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8613_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8613_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8613_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_8613_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
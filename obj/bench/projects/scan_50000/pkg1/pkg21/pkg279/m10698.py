@@ -0,0 +1,19 @@
+"""Module 10698."""
+import pkg10.pkg131.pkg1706.m10041
+from pkg9.pkg121.pkg1586 import m9921
+import pkg3.pkg51.pkg665.m6916
+from pkg6.pkg83.pkg1087 import m7338
+import pkg4.pkg58.pkg756.m9091
+from pkg6.pkg80.pkg1051 import m1050
+import pkg5.pkg77.pkg1007.m5174
+from pkg10.pkg141.pkg1844 import m1843
+import pkg10.pkg138.pkg1801.m3884
+from pkg5.pkg67.pkg876 import m9211
+import pkg7.pkg104.m103
+
+
+def helper_10698_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
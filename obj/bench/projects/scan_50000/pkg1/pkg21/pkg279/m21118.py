@@ -0,0 +1,9 @@
+"""Module 21118."""
+import pkg10.pkg137.pkg1789.m5956
+
+
+def helper_21118_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,39 @@
+"""Module 2362."""
+import pkg11.pkg154.m153
+from pkg3.pkg52.pkg687 import m686
+import pkg10.pkg142.pkg1847.m1846
+from . import m278
+import pkg3.pkg43.m42
+from pkg3.pkg44.pkg578 import m577
+import pkg4.pkg55.pkg728.m727
+from pkg8.pkg116 import m115
+import pkg1.m0
+from pkg5.pkg72 import m71
+
+
+def helper_2362_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2362_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2362_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2362_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
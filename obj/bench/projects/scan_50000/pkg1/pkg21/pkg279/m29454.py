@@ -0,0 +1,69 @@
+"""Module 29454."""
+from . import m21118
+from pkg3.pkg47.pkg621 import m2704
+import pkg10.pkg135.pkg1756.m22595
+from pkg10.pkg138.pkg1796 import m10131
+import pkg8.pkg111.pkg1452.m5619
+from pkg8.pkg117.pkg1529 import m7780
+import pkg8.pkg106.pkg1380.m5547
+from . import m4446
+import pkg2.pkg37.pkg489.m8824
+from pkg1.pkg17 import m16
+import pkg5.pkg70.m69
+from pkg3.pkg51.pkg676 import m19431
+
+
+def helper_29454_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_29454_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_29454_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_29454_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_29454_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_29454_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_29454_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_29454_42(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
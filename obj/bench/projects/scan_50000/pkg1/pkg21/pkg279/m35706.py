@@ -0,0 +1,46 @@
+"""Module 35706."""
+import pkg7.pkg97.pkg1264.m7515
+from . import m10698
+from . import m4446
+from . import m16950
+from . import m12782
+from . import m6530
+import pkg4.pkg64.pkg845.m844
+from . import m19034
+import pkg2.pkg28.pkg369.m368
+from pkg10.pkg137.pkg1792 import m24715
+
+
+def helper_35706_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35706_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_35706_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_35706_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_35706_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
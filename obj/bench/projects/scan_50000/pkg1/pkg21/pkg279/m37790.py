@@ -0,0 +1,55 @@
+"""Module 37790."""
+from . import m19034
+from pkg10.pkg142.pkg1851 import m37278
+from . import m278
+from pkg11.pkg153.pkg1996 import m10331
+import pkg3.pkg44.pkg573.m4740
+from pkg1.pkg23 import m22
+import pkg1.pkg16.pkg214.m14801
+from . import m2362
+import pkg6.pkg82.pkg1077.m32336
+from pkg10.pkg143.pkg1869 import m16456
+import pkg5.pkg74.pkg970.m3053
+from . import m23202
+
+
+def helper_37790_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37790_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_37790_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_37790_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_37790_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_37790_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 14867."""
+import pkg1.pkg24.pkg323.m8658
+from pkg2.pkg33.pkg430 import m429
+import pkg6.pkg84.m83
+from pkg11.pkg145.pkg1891 import m14394
+from . import m2363
+from pkg2.pkg36.pkg474 import m4641
+import pkg4.pkg53.pkg691.m2774
+from pkg7.pkg92.pkg1205 import m1204
+import pkg5.pkg74.pkg975.m974
+from pkg8.pkg111.pkg1449 import m1448
+from . import m4447
+
+
+def helper_14867_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
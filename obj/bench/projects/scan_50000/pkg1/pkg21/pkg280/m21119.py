@@ -0,0 +1,46 @@
+"""Module 21119."""
+from . import m4447
+from pkg2.pkg29.pkg390 import m389
+from . import m19035
+from . import m10699
+import pkg10.pkg134.pkg1751.m14254
+from pkg3.pkg41.pkg541 import m15128
+import pkg5.pkg69.m2152
+from pkg1.pkg23.pkg309 import m308
+import pkg9.pkg126.pkg1648.m1647
+from pkg2.pkg30.pkg392 import m4559
+
+
+def helper_21119_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_21119_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_21119_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_21119_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_21119_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
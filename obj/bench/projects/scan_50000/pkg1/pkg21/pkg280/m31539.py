@@ -0,0 +1,55 @@
+"""Module 31539."""
+import pkg3.pkg42.pkg552.m8887
+from pkg1.pkg19.pkg256 import m255
+import pkg11.m10
+from pkg2.pkg35.pkg461 import m8796
+import pkg7.pkg102.pkg1327.m15914
+from . import m279
+import pkg3.pkg49.pkg645.m6896
+from pkg9 import m8
+import pkg1.m0
+from pkg7.pkg93 import m92
+from . import m6531
+from pkg10.pkg140.pkg1833 import m12252
+
+
+def helper_31539_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_31539_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_31539_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_31539_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_31539_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_31539_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,14 @@
+"""Module 4447."""
+import pkg1.pkg15.pkg205.m2288
+from . import m279
+import pkg5.m4
+from pkg1.pkg18.pkg237 import m4404
+import pkg2.pkg38.pkg502.m501
+from pkg2.pkg34.pkg449 import m2532
+
+
+def helper_4447_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 2364."""
+import pkg1.pkg17.m16
+from pkg2 import m1
+import pkg1.pkg23.pkg311.m310
+from . import m280
+import pkg7.m6
+from pkg3.pkg42.pkg557 import m556
+import pkg2.pkg34.m33
+from pkg9.pkg130.pkg1700 import m1699
+import pkg2.pkg31.pkg415.m414
+
+
+def helper_2364_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
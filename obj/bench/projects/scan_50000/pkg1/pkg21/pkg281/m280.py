@@ -0,0 +1,17 @@
+"""Module 280."""
+import pkg1.m0
+from pkg2 import m1
+import pkg3.pkg49.m48
+from pkg8.pkg113 import m112
+import pkg1.pkg23.m22
+from pkg7 import m6
+import pkg1.pkg15.pkg205.m204
+from pkg1.pkg17.pkg228 import m227
+import pkg3.m2
+
+
+def helper_280_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
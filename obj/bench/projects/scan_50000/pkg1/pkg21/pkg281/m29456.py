@@ -0,0 +1,13 @@
+"""Module 29456."""
+import pkg3.pkg43.pkg561.m560
+from pkg6.pkg87.pkg1134 import m13637
+import pkg4.pkg60.pkg788.m9123
+from pkg5.pkg77.pkg1005 import m7256
+import pkg4.pkg61.pkg802.m801
+
+
+def helper_29456_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 48212."""
+import pkg6.pkg81.pkg1054.m19809
+from pkg11.pkg145 import m2228
+import pkg11.pkg155.pkg2018.m4101
+
+
+def helper_48212_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_48212_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_48212_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,35 @@
+"""Module 6532."""
+import pkg1.pkg17.pkg222.m221
+from pkg1.pkg22 import m21
+from . import m2364
+from pkg1 import m0
+import pkg1.pkg20.pkg273.m272
+from pkg5.pkg75.pkg982 import m3065
+
+
+def helper_6532_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6532_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6532_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6532_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,28 @@
+"""Module 8616."""
+from . import m2364
+from pkg5.pkg74.pkg973 import m7224
+import pkg8.pkg106.pkg1379.m1378
+from pkg7.pkg100.pkg1313 import m3396
+import pkg6.pkg83.pkg1086.m7337
+from pkg3.pkg52.pkg678 import m677
+
+
+def helper_8616_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8616_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8616_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,48 @@
+"""Module 12785."""
+import pkg1.pkg21.pkg274.m273
+from pkg13 import m12
+import pkg2.pkg34.pkg454.m6705
+from pkg1 import m0
+import pkg9.pkg129.pkg1682.m10017
+from pkg10.pkg133.pkg1732 import m1731
+import pkg9.pkg130.pkg1698.m1697
+from . import m10701
+import pkg2.pkg38.pkg505.m4672
+from pkg2.pkg39.pkg519 import m2602
+import pkg9.pkg124.pkg1621.m5788
+from pkg8.pkg109.pkg1427 import m5594
+
+
+def helper_12785_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12785_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_12785_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_12785_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_12785_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
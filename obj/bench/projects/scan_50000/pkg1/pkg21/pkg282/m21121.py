@@ -0,0 +1,43 @@
+"""Module 21121."""
+import pkg1.pkg24.pkg320.m2403
+from pkg1 import m0
+from . import m8617
+from pkg1.pkg15.pkg197 import m196
+import pkg8.pkg108.pkg1405.m3488
+from pkg6.pkg87.pkg1142 import m15729
+import pkg3.pkg49.pkg643.m15230
+
+
+def helper_21121_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_21121_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_21121_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_21121_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_21121_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 281."""
+import pkg12.m11
+from pkg1.pkg20.pkg263 import m262
+import pkg9.pkg124.m123
+from pkg1.pkg21.pkg278 import m277
+import pkg1.pkg15.pkg200.m199
+from pkg2 import m1
+import pkg10.pkg137.m136
+from pkg1.pkg22 import m21
+import pkg6.m5
+from pkg6.pkg84 import m83
+import pkg11.pkg155.m154
+
+
+def helper_281_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_281_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
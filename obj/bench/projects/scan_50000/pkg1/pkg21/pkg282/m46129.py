@@ -0,0 +1,30 @@
+"""Module 46129."""
+import pkg1.pkg19.m18
+from . import m4449
+import pkg10.pkg136.pkg1778.m14281
+from pkg7.pkg96.pkg1251 import m1250
+from . import m2365
+from pkg3.pkg49.pkg647 import m646
+import pkg9.pkg130.pkg1691.m20446
+from pkg3.pkg48.pkg628 import m2711
+
+
+def helper_46129_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_46129_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_46129_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,38 @@
+"""Module 12786."""
+import pkg2.pkg36.pkg476.m475
+from pkg3.pkg46.pkg599 import m598
+import pkg1.pkg23.pkg305.m10724
+from pkg6.pkg91.pkg1186 import m11605
+import pkg5.pkg75.pkg986.m11405
+from . import m282
+import pkg1.pkg14.m13
+from pkg5 import m4
+import pkg8.pkg107.pkg1395.m1394
+
+
+def helper_12786_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12786_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_12786_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_12786_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 21122."""
+import pkg5.m4
+from pkg11.pkg153 import m152
+import pkg1.pkg23.pkg302.m19057
+from . import m10702
+import pkg3.pkg42.pkg553.m17224
+from pkg8.pkg109.pkg1418 import m20173
+import pkg2.pkg29.pkg382.m381
+from pkg2 import m1
+import pkg2.pkg30.pkg391.m390
+from pkg1.pkg16.pkg212 import m18967
+import pkg2.pkg35.pkg456.m8791
+from pkg10.pkg135.pkg1767 import m14270
+
+
+def helper_21122_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_21122_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,33 @@
+"""Module 25290."""
+import pkg1.m0
+from pkg10.pkg131.pkg1705 import m5872
+import pkg2.pkg31.pkg412.m411
+from . import m12786
+import pkg11.pkg148.pkg1927.m22766
+from pkg8.pkg110.pkg1434 import m1433
+from . import m8618
+from pkg2.pkg34.pkg449 import m12952
+import pkg5.pkg72.pkg938.m3021
+from pkg10.pkg133.pkg1738 import m7989
+import pkg7.pkg103.pkg1340.m5507
+
+
+def helper_25290_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_25290_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_25290_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,44 @@
+"""Module 29458."""
+import pkg1.pkg22.pkg291.m19046
+from pkg7.pkg94.pkg1223 import m26230
+import pkg4.pkg59.pkg780.m779
+from pkg2.pkg27.pkg360 import m359
+import pkg1.pkg22.pkg294.m293
+from pkg1 import m0
+import pkg5.pkg75.pkg978.m7229
+from pkg8.pkg109.pkg1421 import m18092
+
+
+def helper_29458_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_29458_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_29458_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_29458_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_29458_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 31542."""
+import pkg8.pkg114.pkg1494.m1493
+from . import m19038
+
+
+def helper_31542_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_31542_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,30 @@
+"""Module 12787."""
+from . import m10703
+from pkg4.pkg55 import m54
+import pkg1.pkg14.pkg191.m190
+from pkg1.pkg26 import m25
+import pkg13.pkg179.m178
+from . import m4451
+from . import m8619
+from pkg1.pkg18.pkg238 import m237
+
+
+def helper_12787_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12787_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_12787_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
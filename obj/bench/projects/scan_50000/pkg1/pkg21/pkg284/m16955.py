@@ -0,0 +1,32 @@
+"""Module 16955."""
+import pkg1.pkg14.pkg188.m187
+from pkg7.pkg98 import m4265
+from . import m283
+from . import m2367
+import pkg2.m1
+from pkg4 import m3
+from . import m4451
+from pkg2.pkg33.pkg432 import m431
+import pkg4.pkg53.m4220
+from pkg2.pkg32.pkg423 import m10842
+
+
+def helper_16955_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16955_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_16955_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
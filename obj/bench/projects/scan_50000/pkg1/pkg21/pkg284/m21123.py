@@ -0,0 +1,31 @@
+"""Module 21123."""
+import pkg10.pkg138.pkg1803.m5970
+from pkg5.pkg67.pkg878 import m2961
+from . import m6535
+from pkg1.pkg20.pkg271 import m6522
+import pkg5.pkg73.pkg958.m957
+from pkg11.pkg150.pkg1951 import m12370
+from . import m16955
+from pkg2.pkg33.pkg442 import m2525
+import pkg10.pkg131.pkg1707.m3790
+
+
+def helper_21123_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_21123_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_21123_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
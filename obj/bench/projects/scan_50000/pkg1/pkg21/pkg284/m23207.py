@@ -0,0 +1,19 @@
+"""Module 23207."""
+from . import m14871
+from pkg3.pkg48 import m47
+import pkg5.pkg66.pkg863.m862
+from pkg10.pkg133.pkg1732 import m16319
+from . import m4451
+from pkg2 import m1
+import pkg6.pkg90.pkg1172.m13675
+from pkg1.pkg15 import m14
+import pkg6.m5
+from pkg6.pkg85.pkg1114 import m19869
+import pkg13.pkg171.m170
+
+
+def helper_23207_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,53 @@
+"""Module 25291."""
+import pkg1.pkg16.pkg215.m214
+from pkg4.pkg55.pkg716 import m9051
+import pkg9.pkg128.pkg1671.m1670
+from pkg9.pkg128.pkg1677 import m20432
+import pkg4.pkg55.pkg717.m6968
+from . import m23207
+import pkg12.m11
+from pkg8.pkg109 import m108
+import pkg7.pkg93.m92
+from pkg6.pkg83.pkg1082 import m3165
+
+
+def helper_25291_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_25291_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_25291_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_25291_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_25291_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_25291_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
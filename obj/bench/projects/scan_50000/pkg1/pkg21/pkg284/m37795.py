@@ -0,0 +1,45 @@
+"""Module 37795."""
+from . import m19039
+from pkg2.pkg28.pkg375 import m374
+import pkg10.pkg135.pkg1762.m30937
+from pkg13.pkg173 import m4340
+import pkg2.pkg29.pkg380.m2463
+from pkg2.pkg37.pkg487 import m4654
+from . import m14871
+from pkg4.pkg55.pkg725 import m17396
+import pkg11.pkg144.pkg1884.m18555
+
+
+def helper_37795_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37795_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_37795_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_37795_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_37795_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
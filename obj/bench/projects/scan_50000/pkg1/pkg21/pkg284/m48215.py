@@ -0,0 +1,13 @@
+"""Module 48215."""
+import pkg2.pkg37.pkg489.m6740
+from . import m14871
+import pkg9.pkg124.pkg1623.m7874
+from pkg10.pkg134.pkg1752 import m28843
+from . import m19039
+
+
+def helper_48215_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 10704."""
+from . import m6536
+from pkg1.pkg19.pkg258 import m257
+import pkg12.pkg167.m166
+from pkg1.pkg18.pkg245 import m6496
+import pkg11.pkg155.pkg2020.m8271
+from pkg2.pkg33.pkg438 import m437
+import pkg8.pkg114.m113
+from pkg5.pkg75 import m74
+import pkg11.pkg150.pkg1958.m8209
+from pkg2.pkg33.pkg436 import m435
+
+
+def helper_10704_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10704_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,46 @@
+"""Module 35712."""
+import pkg7.m6
+from . import m10704
+import pkg1.pkg16.pkg214.m213
+from pkg12.pkg159.pkg2068 import m6235
+import pkg6.pkg88.pkg1155.m3238
+from pkg1.pkg26.pkg347 import m346
+import pkg1.pkg26.pkg345.m6596
+from pkg1.pkg23.pkg310 import m4477
+import pkg6.pkg87.m31346
+from pkg11.pkg144.pkg1879 import m1878
+
+
+def helper_35712_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35712_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_35712_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_35712_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_35712_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,45 @@
+"""Module 41964."""
+import pkg2.pkg34.pkg454.m453
+from pkg2.pkg31.pkg410 import m409
+from . import m4452
+from pkg5.pkg72.pkg938 import m3021
+import pkg1.pkg19.pkg255.m6506
+from pkg7.pkg101.pkg1326 import m24249
+import pkg9.pkg127.pkg1656.m7907
+from . import m284
+import pkg10.pkg136.m135
+
+
+def helper_41964_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_41964_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_41964_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_41964_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_41964_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,16 @@
+"""Module 4452."""
+import pkg2.pkg27.m26
+from pkg9.pkg120.pkg1562 import m3645
+import pkg4.pkg63.pkg829.m828
+from . import m284
+import pkg5.pkg70.pkg911.m2994
+from pkg1.pkg19 import m2102
+import pkg5.pkg70.pkg918.m917
+from pkg3.pkg41.pkg537 import m2620
+
+
+def helper_4452_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
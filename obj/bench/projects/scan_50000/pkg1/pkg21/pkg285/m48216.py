@@ -0,0 +1,21 @@
+"""Module 48216."""
+import pkg13.pkg175.m16846
+from pkg4.pkg57.pkg752 import m751
+import pkg9.pkg126.pkg1651.m16238
+from pkg6.pkg84.pkg1099 import m3182
+import pkg8.pkg114.pkg1495.m13998
+from pkg3.pkg45.pkg591 import m44354
+
+
+def helper_48216_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_48216_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,10 @@
+"""Module 2369."""
+import pkg3.pkg47.pkg613.m612
+from pkg2.pkg34.pkg445 import m444
+
+
+def helper_2369_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,28 @@
+"""Module 31545."""
+import pkg7.pkg96.pkg1260.m11679
+from pkg8.pkg115.pkg1500 import m24423
+import pkg1.pkg26.pkg351.m350
+from pkg3.pkg40 import m39
+import pkg2.pkg32.pkg429.m2512
+from pkg12.pkg157.pkg2042 import m27049
+
+
+def helper_31545_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_31545_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_31545_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 44049."""
+import pkg1.pkg17.pkg233.m8568
+from pkg7.pkg94.pkg1229 import m1228
+import pkg1.m0
+
+
+def helper_44049_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,12 @@
+"""Module 4453."""
+from . import m285
+from pkg8.pkg107 import m106
+import pkg2.pkg30.pkg402.m2485
+from pkg9.pkg118.pkg1540 import m1539
+
+
+def helper_4453_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,16 @@
+"""Module 8621."""
+from . import m2369
+from pkg3 import m2
+import pkg2.pkg39.pkg515.m514
+from pkg2.pkg35.pkg468 import m467
+import pkg11.pkg146.pkg1904.m1903
+from pkg1.pkg18.pkg247 import m246
+import pkg5.pkg78.pkg1021.m1020
+from pkg1 import m0
+
+
+def helper_8621_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 22945."""
+import pkg9.pkg121.pkg1586.m16173
+from pkg10.pkg134 import m133
+import pkg3.pkg41.pkg539.m19294
+from . import m21
+import pkg9.pkg120.pkg1562.m3645
+from pkg1.pkg25.pkg333 import m10752
+import pkg3.pkg48.m47
+from pkg2.pkg36.pkg469 import m468
+import pkg6.pkg90.m89
+from pkg8.pkg107.pkg1404 import m3487
+
+
+def helper_22945_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_22945_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,35 @@
+"""Module 29197."""
+import pkg4.pkg53.pkg697.m9032
+from pkg4.pkg59.pkg777 import m9112
+import pkg8.pkg107.pkg1404.m26411
+from pkg6.pkg81.pkg1058 import m21897
+from . import m21
+from pkg3.pkg49.pkg646 import m6897
+
+
+def helper_29197_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_29197_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_29197_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_29197_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
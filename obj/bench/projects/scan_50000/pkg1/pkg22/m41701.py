@@ -0,0 +1,33 @@
+"""Module 41701."""
+import pkg2.pkg39.pkg520.m6771
+from . import m21
+import pkg1.pkg17.pkg225.m224
+from pkg9.pkg119.pkg1555 import m1554
+import pkg3.pkg42.pkg555.m21394
+from pkg7.pkg93.pkg1220 import m24143
+import pkg2.pkg30.pkg402.m12905
+from pkg2.pkg34 import m2117
+import pkg1.pkg22.pkg295.m294
+from pkg7.pkg92.pkg1200 import m34543
+import pkg8.pkg111.pkg1448.m22287
+
+
+def helper_41701_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_41701_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_41701_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
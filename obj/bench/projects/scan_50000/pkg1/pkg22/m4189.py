@@ -0,0 +1,25 @@
+"""Module 4189."""
+from . import m21
+from pkg7.pkg99.pkg1290 import m1289
+import pkg10.pkg133.m132
+from . import m2105
+import pkg10.pkg141.pkg1842.m3925
+from pkg8.pkg112.pkg1467 import m1466
+import pkg1.m0
+from pkg5.pkg77.pkg1014 import m3097
+import pkg6.pkg85.pkg1107.m3190
+from pkg3 import m2
+
+
+def helper_4189_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4189_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
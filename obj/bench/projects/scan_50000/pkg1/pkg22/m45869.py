@@ -0,0 +1,2 @@
+"""Module 45869."""
+import pkg4.m3
@@ -0,0 +1,5 @@
+"""Module 14874."""
+import pkg3.pkg52.pkg685.m9020
+from . import m286
+import pkg2.pkg31.pkg415.m10834
+from . import m2370
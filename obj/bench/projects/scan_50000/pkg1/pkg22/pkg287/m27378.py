@@ -0,0 +1,7 @@
+"""Module 27378."""
+import pkg3.pkg49.m8384
+from pkg9.pkg124 import m123
+from . import m16958
+from pkg1.pkg14.pkg194 import m193
+import pkg6.pkg91.pkg1188.m26195
+from pkg4.pkg57.pkg742 import m13245
@@ -0,0 +1,30 @@
+"""Module 286."""
+import pkg1.pkg19.m18
+from pkg13.pkg172 import m171
+import pkg1.m0
+from pkg9.pkg127 import m126
+import pkg2.pkg28.m27
+from pkg1.pkg15.pkg208 import m207
+import pkg7.pkg95.m94
+from pkg9.pkg126 import m125
+
+
+def helper_286_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_286_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_286_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
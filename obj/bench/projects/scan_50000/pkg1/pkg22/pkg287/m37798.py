@@ -0,0 +1,41 @@
+"""Module 37798."""
+import pkg1.m0
+from pkg10.pkg139.pkg1820 import m8071
+import pkg7.pkg104.pkg1353.m9688
+from pkg6.pkg83.pkg1085 import m3168
+import pkg5.pkg66.pkg861.m23784
+from pkg9.pkg121.pkg1582 import m12001
+import pkg3.pkg52.pkg689.m11108
+from pkg8.pkg107.pkg1402 import m28493
+import pkg10.pkg135.pkg1768.m26775
+from pkg7.pkg97 import m96
+import pkg7.pkg93.pkg1210.m9545
+from pkg8.pkg117.pkg1529 import m9864
+
+
+def helper_37798_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37798_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_37798_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_37798_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,24 @@
+"""Module 4454."""
+import pkg9.pkg122.pkg1596.m3679
+from pkg9.pkg124.pkg1617 import m3700
+import pkg8.pkg107.m106
+from pkg2.pkg36.pkg478 import m477
+from . import m2370
+from pkg1 import m0
+import pkg5.pkg69.pkg899.m898
+from pkg8.pkg110.pkg1432 import m1431
+import pkg3.pkg42.m41
+
+
+def helper_4454_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4454_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,39 @@
+"""Module 12791."""
+import pkg10.pkg141.m2224
+from . import m287
+from . import m6539
+from pkg10.pkg136.pkg1781 import m1780
+import pkg1.m0
+from . import m2371
+import pkg9.pkg130.pkg1696.m5863
+from pkg4.pkg61.pkg796 import m795
+import pkg8.pkg108.pkg1416.m11835
+from . import m8623
+
+
+def helper_12791_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12791_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_12791_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_12791_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,13 @@
+"""Module 19043."""
+import pkg11.pkg144.pkg1880.m14383
+from pkg1 import m0
+import pkg4.pkg65.pkg847.m846
+from pkg1.pkg17.pkg233 import m2316
+import pkg6.pkg85.pkg1118.m1117
+from . import m16959
+import pkg9.pkg130.pkg1702.m18373
+from . import m12791
+import pkg9.pkg130.pkg1696.m16283
+from pkg9.pkg118 import m8453
+import pkg1.pkg14.m13
+from pkg12 import m11
@@ -0,0 +1,52 @@
+"""Module 21127."""
+import pkg6.pkg79.pkg1028.m1027
+from pkg5.pkg78.pkg1024 import m17695
+import pkg1.pkg20.pkg268.m267
+from . import m2371
+import pkg1.pkg23.pkg309.m308
+from pkg10.pkg135 import m134
+import pkg2.pkg29.m14616
+from pkg2.pkg36.pkg469 import m19224
+import pkg7.pkg104.pkg1362.m20117
+
+
+def helper_21127_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_21127_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_21127_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_21127_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_21127_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_21127_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,34 @@
+"""Module 25295."""
+import pkg10.pkg138.pkg1803.m10138
+from pkg7.pkg95.pkg1242 import m1241
+import pkg9.pkg121.pkg1576.m3659
+from pkg11.pkg148.pkg1934 import m22773
+import pkg1.pkg14.pkg192.m191
+
+
+def helper_25295_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_25295_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_25295_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_25295_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
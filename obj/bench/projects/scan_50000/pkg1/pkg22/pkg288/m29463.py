@@ -0,0 +1,25 @@
+"""Module 29463."""
+import pkg7.pkg97.pkg1263.m9598
+from . import m16959
+import pkg10.pkg135.pkg1756.m3839
+from . import m25295
+from . import m2371
+from pkg5.pkg76.pkg989 import m9324
+import pkg2.pkg33.pkg432.m431
+from pkg1 import m0
+import pkg11.pkg152.pkg1979.m12398
+from pkg4.pkg60.pkg789 import m9124
+
+
+def helper_29463_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_29463_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
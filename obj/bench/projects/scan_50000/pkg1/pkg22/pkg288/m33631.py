@@ -0,0 +1,55 @@
+"""Module 33631."""
+from . import m287
+from pkg1.pkg14.pkg187 import m186
+import pkg10.pkg137.pkg1784.m1783
+from pkg5.pkg73.pkg955 import m954
+from . import m25295
+from . import m21127
+import pkg2.pkg31.m30
+from pkg5.pkg71.pkg929 import m13432
+import pkg1.m0
+from pkg6 import m5
+from . import m23211
+from pkg2.pkg32.pkg428 import m427
+
+
+def helper_33631_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_33631_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_33631_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_33631_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_33631_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_33631_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
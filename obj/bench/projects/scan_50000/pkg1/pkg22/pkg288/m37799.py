@@ -0,0 +1,12 @@
+"""Module 37799."""
+import pkg4.pkg59.pkg770.m2853
+from pkg10.pkg132.pkg1717 import m28808
+import pkg3.pkg49.pkg650.m19405
+from pkg5.pkg74.pkg963 import m9298
+
+
+def helper_37799_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
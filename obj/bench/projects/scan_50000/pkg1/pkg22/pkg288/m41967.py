@@ -0,0 +1,47 @@
+"""Module 41967."""
+import pkg5.pkg70.pkg914.m913
+from pkg9.pkg126.pkg1639 import m7890
+import pkg11.m10
+from . import m2371
+import pkg5.pkg77.pkg1009.m1008
+from pkg10.pkg138.pkg1801 import m10136
+from . import m33631
+from pkg8.pkg105 import m16776
+import pkg11.pkg150.pkg1963.m1962
+from . import m12791
+import pkg1.pkg20.pkg268.m16939
+
+
+def helper_41967_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_41967_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_41967_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_41967_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_41967_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,22 @@
+"""Module 46135."""
+import pkg11.pkg149.m39744
+from pkg11.pkg156.pkg2036 import m6203
+import pkg7.pkg101.pkg1315.m42994
+from pkg5.pkg68.pkg891 import m2974
+import pkg7.pkg99.m41778
+from . import m2371
+import pkg9.pkg123.m122
+
+
+def helper_46135_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_46135_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,38 @@
+"""Module 8623."""
+import pkg8.pkg108.m107
+from . import m2371
+import pkg1.pkg26.m25
+from pkg6.pkg80.pkg1042 import m1041
+import pkg3.pkg47.pkg618.m617
+from pkg1 import m0
+import pkg7.pkg98.pkg1277.m7528
+from pkg2.pkg32.pkg424 import m6675
+import pkg10.pkg131.pkg1711.m5878
+
+
+def helper_8623_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8623_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8623_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8623_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
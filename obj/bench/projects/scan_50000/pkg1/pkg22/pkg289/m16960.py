@@ -0,0 +1,47 @@
+"""Module 16960."""
+import pkg1.pkg22.pkg287.m2370
+from pkg4.pkg57.pkg746 import m9081
+import pkg6.pkg90.pkg1180.m3263
+from . import m12792
+import pkg11.pkg155.pkg2021.m12440
+from pkg5.pkg75.pkg984 import m3067
+import pkg8.pkg116.pkg1510.m16097
+from pkg11.pkg153.pkg1990 import m6157
+import pkg3.pkg49.pkg642.m2725
+from pkg1.pkg20 import m19
+import pkg8.pkg105.m12608
+
+
+def helper_16960_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16960_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_16960_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_16960_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_16960_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
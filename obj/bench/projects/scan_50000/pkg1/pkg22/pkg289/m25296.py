@@ -0,0 +1,23 @@
+"""Module 25296."""
+import pkg6.m5
+from . import m2372
+import pkg2.pkg28.pkg365.m8700
+from pkg7.pkg100.pkg1313 import m3396
+import pkg11.pkg148.pkg1930.m4013
+from pkg1.pkg14 import m13
+import pkg1.pkg25.m24
+from pkg3.pkg50.pkg654 import m2737
+
+
+def helper_25296_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_25296_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,21 @@
+"""Module 27380."""
+import pkg2.pkg27.pkg356.m355
+from pkg1.pkg21.pkg281 import m280
+from . import m12792
+from pkg2.pkg38.pkg500 import m499
+import pkg4.pkg54.pkg706.m2789
+from . import m288
+
+
+def helper_27380_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_27380_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
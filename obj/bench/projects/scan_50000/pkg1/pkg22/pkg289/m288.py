@@ -0,0 +1,13 @@
+"""Module 288."""
+import pkg1.m0
+from pkg1.pkg18 import m17
+import pkg6.pkg84.m83
+from pkg11 import m10
+import pkg7.m6
+
+
+def helper_288_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
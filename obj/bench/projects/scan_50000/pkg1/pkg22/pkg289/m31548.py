@@ -0,0 +1,11 @@
+"""Module 31548."""
+import pkg1.m0
+from pkg2.pkg30.pkg402 import m401
+import pkg10.pkg137.pkg1785.m1784
+
+
+def helper_31548_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
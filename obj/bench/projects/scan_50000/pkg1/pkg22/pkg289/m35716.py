@@ -0,0 +1,34 @@
+"""Module 35716."""
+import pkg7.pkg99.pkg1296.m17967
+from pkg7.pkg104.pkg1356 import m15943
+import pkg1.pkg23.pkg308.m2391
+from pkg7.pkg95.pkg1244 import m17915
+import pkg2.pkg27.pkg362.m2445
+
+
+def helper_35716_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35716_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_35716_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_35716_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,24 @@
+"""Module 46136."""
+from . import m288
+from pkg6.pkg85.pkg1118 import m7369
+import pkg5.pkg71.pkg931.m930
+from pkg6.pkg88.pkg1157 import m1156
+import pkg5.pkg78.pkg1022.m28113
+from . import m41968
+import pkg2.pkg32.pkg426.m6677
+from pkg3.pkg47.pkg623 import m27714
+import pkg12.pkg157.pkg2048.m4131
+
+
+def helper_46136_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_46136_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
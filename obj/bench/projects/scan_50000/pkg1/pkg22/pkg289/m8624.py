@@ -0,0 +1,39 @@
+"""Module 8624."""
+import pkg5.pkg66.pkg867.m866
+from pkg11.pkg150.pkg1955 import m4038
+import pkg2.pkg31.m30
+from pkg1 import m0
+import pkg7.pkg104.pkg1360.m5527
+from pkg6.pkg85.pkg1116 import m1115
+import pkg5.pkg70.m69
+from pkg4.pkg64.pkg834 import m5001
+import pkg2.pkg30.pkg401.m400
+from pkg2.pkg34.pkg452 import m6703
+
+
+def helper_8624_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8624_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8624_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8624_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
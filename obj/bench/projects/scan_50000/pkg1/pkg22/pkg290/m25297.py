@@ -0,0 +1,26 @@
+"""Module 25297."""
+import pkg13.pkg173.m2256
+from pkg9.pkg120 import m119
+import pkg4.pkg54.pkg707.m6958
+from pkg4.pkg64.pkg833 import m832
+
+
+def helper_25297_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_25297_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_25297_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,35 @@
+"""Module 37801."""
+from . import m19045
+from pkg10.pkg140.pkg1821 import m3904
+import pkg3.m2
+from pkg2.pkg28.pkg372 import m2455
+import pkg3.pkg49.pkg641.m640
+from pkg6.pkg88.pkg1154 import m1153
+
+
+def helper_37801_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37801_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_37801_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_37801_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,30 @@
+"""Module 44053."""
+import pkg4.pkg53.pkg697.m9032
+from pkg7.pkg95.pkg1241 import m1240
+import pkg3.pkg50.pkg657.m19412
+from pkg10 import m9
+import pkg4.pkg64.pkg836.m2919
+from . import m4457
+import pkg10.pkg132.pkg1726.m37153
+from pkg4.pkg58 import m16729
+
+
+def helper_44053_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_44053_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_44053_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,22 @@
+"""Module 21130."""
+import pkg9.pkg118.pkg1542.m1541
+from pkg3.pkg40.pkg522 import m521
+import pkg9.pkg126.pkg1641.m7892
+from pkg8.pkg113.pkg1480 import m3563
+import pkg8.pkg108.pkg1405.m1404
+from pkg3.pkg42.pkg552 import m2635
+import pkg1.pkg24.pkg322.m12825
+
+
+def helper_21130_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_21130_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
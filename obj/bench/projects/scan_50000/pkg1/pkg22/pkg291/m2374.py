@@ -0,0 +1,24 @@
+"""Module 2374."""
+import pkg5.pkg69.pkg903.m902
+from . import m290
+import pkg4.m3
+from pkg1.pkg19.pkg254 import m253
+import pkg10.pkg141.pkg1840.m1839
+from pkg10.pkg133.pkg1733 import m1732
+import pkg3.m2
+from pkg7.pkg92.pkg1206 import m1205
+import pkg4.pkg63.pkg826.m825
+
+
+def helper_2374_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2374_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
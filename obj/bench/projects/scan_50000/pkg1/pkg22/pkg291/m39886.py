@@ -0,0 +1,9 @@
+"""Module 39886."""
+from . import m23214
+from pkg7.pkg99.pkg1294 import m15881
+import pkg1.pkg19.pkg250.m12753
+from pkg7.pkg101.pkg1324 import m1323
+from . import m35718
+from . import m37802
+from . import m4458
+from pkg7.pkg98.pkg1278 import m11697
@@ -0,0 +1,29 @@
+"""Module 21131."""
+from . import m4459
+from pkg5.pkg76.pkg995 import m3078
+from . import m12795
+from . import m19047
+import pkg3.pkg43.pkg565.m13068
+from pkg7.pkg101.pkg1321 import m15908
+import pkg2.pkg33.pkg431.m4598
+
+
+def helper_21131_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_21131_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_21131_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
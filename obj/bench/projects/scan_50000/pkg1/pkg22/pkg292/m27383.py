@@ -0,0 +1,22 @@
+"""Module 27383."""
+import pkg11.pkg150.pkg1958.m4041
+from pkg8 import m7
+import pkg3.pkg45.pkg589.m15176
+from . import m16963
+import pkg4.pkg56.pkg734.m733
+from pkg8.pkg105.pkg1369 import m15956
+import pkg2.pkg35.pkg466.m465
+
+
+def helper_27383_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_27383_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
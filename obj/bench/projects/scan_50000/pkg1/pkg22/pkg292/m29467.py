@@ -0,0 +1,44 @@
+"""Module 29467."""
+import pkg1.m0
+from pkg4.pkg63.pkg830 import m15417
+import pkg4.pkg60.pkg791.m17462
+from pkg1.pkg16.pkg211 import m29386
+import pkg1.pkg19.pkg253.m10672
+from pkg5 import m4
+import pkg10.pkg138.m137
+from . import m16963
+
+
+def helper_29467_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_29467_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_29467_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_29467_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_29467_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
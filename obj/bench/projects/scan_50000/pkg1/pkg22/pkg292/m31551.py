@@ -0,0 +1,10 @@
+"""Module 31551."""
+import pkg3.pkg51.pkg668.m667
+from pkg1.pkg23.pkg301 import m4468
+
+
+def helper_31551_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,45 @@
+"""Module 44055."""
+import pkg1.pkg23.pkg307.m306
+from pkg4.pkg59.pkg774 import m7025
+import pkg11.pkg148.pkg1932.m6099
+from pkg2.pkg38.pkg501 import m500
+from . import m29467
+from pkg7.pkg100.pkg1302 import m1301
+import pkg2.m1
+from pkg6.pkg89.pkg1162 import m1161
+from . import m8627
+
+
+def helper_44055_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_44055_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_44055_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_44055_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_44055_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
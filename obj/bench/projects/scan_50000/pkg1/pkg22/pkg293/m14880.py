@@ -0,0 +1,27 @@
+"""Module 14880."""
+from . import m292
+from pkg4.pkg63.pkg827 import m4994
+import pkg1.pkg17.m16
+from pkg6.pkg86.pkg1123 import m1122
+import pkg8.pkg108.pkg1406.m1405
+
+
+def helper_14880_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14880_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_14880_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
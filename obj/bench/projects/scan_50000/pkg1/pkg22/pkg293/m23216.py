@@ -0,0 +1,11 @@
+"""Module 23216."""
+import pkg3.m12506
+from pkg10.pkg139.pkg1812 import m16399
+from . import m6544
+from . import m21132
+import pkg10.pkg135.pkg1758.m1757
+from pkg7.pkg96 import m95
+import pkg7.pkg100.pkg1303.m13806
+from pkg1.pkg15.pkg196 import m2279
+import pkg1.pkg17.pkg224.m223
+from . import m19048
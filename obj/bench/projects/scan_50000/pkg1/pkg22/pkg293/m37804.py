@@ -0,0 +1,31 @@
+"""Module 37804."""
+import pkg3.pkg48.pkg629.m19384
+from pkg4.pkg58 import m57
+import pkg5.pkg75.pkg976.m7227
+from pkg12.pkg157.pkg2053 import m20808
+from . import m25300
+from pkg9 import m8
+from . import m14880
+from pkg12.pkg163 import m162
+import pkg9.pkg121.pkg1585.m1584
+
+
+def helper_37804_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37804_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_37804_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
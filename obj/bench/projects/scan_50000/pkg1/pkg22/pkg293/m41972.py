@@ -0,0 +1,19 @@
+"""Module 41972."""
+import pkg1.pkg23.pkg308.m25315
+from pkg4.pkg62.pkg810 import m4977
+import pkg4.pkg63.pkg826.m27917
+from . import m6544
+
+
+def helper_41972_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_41972_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
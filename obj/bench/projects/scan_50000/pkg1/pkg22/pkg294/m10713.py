@@ -0,0 +1,20 @@
+"""Module 10713."""
+import pkg1.pkg25.pkg333.m332
+from pkg6 import m5
+import pkg13.pkg173.m172
+from pkg3 import m2
+from . import m2377
+
+
+def helper_10713_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10713_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
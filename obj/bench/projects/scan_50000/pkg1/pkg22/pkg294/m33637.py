@@ -0,0 +1,33 @@
+"""Module 33637."""
+from . import m6545
+from pkg10.pkg136.pkg1770 import m3853
+import pkg8.pkg113.m112
+from pkg1.pkg15 import m14
+import pkg4.pkg62.m61
+from pkg8.pkg106.pkg1385 import m1384
+import pkg10.pkg139.pkg1811.m16398
+from pkg5.pkg76.pkg997 import m9332
+import pkg2.pkg37.pkg488.m6739
+from pkg7.pkg95.pkg1243 import m13746
+import pkg2.pkg37.pkg493.m15080
+
+
+def helper_33637_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_33637_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_33637_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
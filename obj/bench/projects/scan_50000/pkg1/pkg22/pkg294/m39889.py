@@ -0,0 +1,12 @@
+"""Module 39889."""
+import pkg1.pkg14.pkg185.m35612
+from . import m12797
+from . import m31553
+from . import m35721
+
+
+def helper_39889_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
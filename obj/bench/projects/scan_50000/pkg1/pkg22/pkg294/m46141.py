@@ -0,0 +1,54 @@
+"""Module 46141."""
+import pkg2.pkg34.pkg454.m453
+from pkg12.pkg157.pkg2054 import m16641
+import pkg2.pkg33.pkg442.m441
+from pkg2.pkg34.pkg449 import m8784
+import pkg5.pkg72.pkg938.m9273
+from . import m27385
+import pkg2.pkg31.pkg408.m25415
+from pkg10.pkg135.pkg1766 import m14269
+import pkg8.pkg116.pkg1517.m43196
+from pkg12.pkg159.pkg2068 import m14571
+import pkg7.pkg100.pkg1308.m11727
+
+
+def helper_46141_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_46141_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_46141_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_46141_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_46141_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_46141_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
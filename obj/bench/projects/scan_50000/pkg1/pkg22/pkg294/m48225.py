@@ -0,0 +1,22 @@
+"""Module 48225."""
+import pkg1.m0
+from pkg1.pkg17.pkg223 import m222
+from . import m33637
+from pkg6.pkg86.pkg1127 import m5294
+import pkg11.pkg155.pkg2021.m6188
+from pkg10.pkg142.pkg1853 import m6020
+import pkg12.pkg160.m6411
+
+
+def helper_48225_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_48225_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
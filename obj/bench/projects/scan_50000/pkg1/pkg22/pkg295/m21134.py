@@ -0,0 +1,18 @@
+"""Module 21134."""
+import pkg3.pkg41.pkg538.m2621
+from pkg3.pkg50 import m49
+import pkg3.pkg51.pkg667.m666
+
+
+def helper_21134_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_21134_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,53 @@
+"""Module 2378."""
+import pkg1.pkg19.pkg260.m259
+from pkg7.pkg95.pkg1240 import m1239
+from . import m294
+from pkg1.pkg22 import m21
+import pkg1.pkg17.pkg231.m230
+from pkg6.pkg79.pkg1037 import m1036
+import pkg6.pkg81.m80
+from pkg12.pkg157 import m2240
+import pkg8.pkg116.pkg1521.m1520
+from pkg4.pkg56.pkg729 import m728
+
+
+def helper_2378_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2378_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2378_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2378_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_2378_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_2378_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 27386."""
+import pkg1.pkg19.pkg254.m253
+from pkg10.pkg135.pkg1758 import m18429
+import pkg7.pkg93.pkg1222.m7473
+from pkg9.pkg120.pkg1572 import m22411
+import pkg11.pkg150.pkg1953.m1952
+from . import m21134
+import pkg2.pkg28.pkg375.m14962
+from pkg12.pkg159.pkg2069 import m14572
+import pkg3.pkg51.m50
+
+
+def helper_27386_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
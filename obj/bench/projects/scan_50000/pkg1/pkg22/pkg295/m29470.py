@@ -0,0 +1,44 @@
+"""Module 29470."""
+import pkg11.pkg153.m152
+from . import m10714
+import pkg10.pkg136.pkg1781.m5948
+from pkg1.pkg19.pkg251 import m21090
+import pkg11.pkg150.pkg1953.m1952
+from . import m294
+import pkg3.pkg41.m40
+from pkg1.pkg15.pkg201 import m200
+
+
+def helper_29470_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_29470_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_29470_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_29470_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_29470_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,28 @@
+"""Module 44058."""
+import pkg1.pkg23.pkg306.m305
+from pkg4.pkg58.pkg756 import m42435
+import pkg1.m0
+from . import m21134
+from . import m23218
+from pkg11.pkg146 import m145
+
+
+def helper_44058_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_44058_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_44058_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,54 @@
+"""Module 10715."""
+import pkg1.pkg16.pkg214.m2297
+from pkg2.pkg35.pkg466 import m6717
+import pkg7.pkg96.pkg1258.m5425
+from pkg7.pkg98.pkg1275 import m1274
+import pkg9.pkg127.pkg1652.m1651
+from pkg7.pkg97.pkg1269 import m3352
+import pkg9.pkg130.pkg1701.m5868
+from pkg11.pkg144.pkg1880 import m10215
+import pkg1.pkg18.m17
+from pkg1.pkg25.pkg327 import m2410
+from . import m8631
+
+
+def helper_10715_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10715_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_10715_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_10715_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_10715_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_10715_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,14 @@
+"""Module 12799."""
+import pkg5.pkg69.pkg899.m7150
+from . import m2379
+import pkg1.pkg18.pkg245.m2328
+from pkg2.pkg34.pkg451 import m450
+from . import m10715
+from pkg4.pkg59.pkg768 import m4935
+
+
+def helper_12799_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,30 @@
+"""Module 31555."""
+import pkg1.pkg25.pkg337.m6588
+from pkg8.pkg109 import m108
+from . import m12799
+from pkg1.pkg14.pkg183 import m182
+import pkg2.pkg27.pkg359.m358
+from pkg5 import m4
+import pkg11.pkg148.pkg1925.m31100
+from pkg1.pkg23.pkg300 import m299
+
+
+def helper_31555_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_31555_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_31555_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 4463."""
+from . import m2379
+from pkg2.pkg34 import m33
+import pkg2.pkg29.pkg378.m377
+from pkg7.pkg102 import m101
+import pkg2.pkg34.pkg455.m2538
+from pkg5.pkg71.pkg927 import m926
+import pkg3.pkg51.pkg670.m2753
+from pkg1 import m0
+import pkg1.pkg15.pkg208.m207
+from pkg6.pkg90.pkg1181 import m3264
+import pkg11.pkg154.pkg2014.m2013
+
+
+def helper_4463_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4463_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
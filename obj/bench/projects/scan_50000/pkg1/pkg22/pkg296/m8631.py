@@ -0,0 +1,48 @@
+"""Module 8631."""
+import pkg3.pkg45.pkg598.m2681
+from pkg1.pkg20.pkg264 import m263
+from . import m6547
+from pkg4.pkg58.pkg762 import m2845
+import pkg8.pkg105.m104
+from pkg6.pkg88.pkg1148 import m1147
+import pkg8.m7
+from pkg5.pkg69.pkg908 import m907
+import pkg2.pkg30.m4197
+from pkg5.pkg71 import m70
+import pkg4.pkg65.m64
+from pkg5.pkg74.pkg974 import m973
+
+
+def helper_8631_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8631_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8631_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8631_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_8631_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,14 @@
+"""Module 27388."""
+import pkg2.pkg39.pkg517.m516
+from pkg11.pkg155.pkg2024 import m4107
+from . import m10716
+from pkg1.pkg18.pkg246 import m245
+import pkg1.m0
+from pkg2.pkg35 import m34
+
+
+def helper_27388_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,12 @@
+"""Module 21137."""
+from . import m8633
+from pkg11.pkg147.pkg1915 import m14418
+import pkg10.pkg135.pkg1766.m3849
+from . import m14885
+
+
+def helper_21137_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
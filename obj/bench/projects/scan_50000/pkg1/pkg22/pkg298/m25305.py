@@ -0,0 +1,20 @@
+"""Module 25305."""
+import pkg10.pkg136.pkg1774.m16361
+from pkg11.pkg147.pkg1915 import m10250
+import pkg11.pkg155.pkg2024.m2023
+from pkg1 import m0
+import pkg1.pkg18.m17
+from pkg7.pkg102.pkg1327 import m1326
+from . import m14885
+from pkg10.pkg135 import m134
+import pkg6.pkg90.m6341
+from pkg5.pkg76.pkg993 import m7244
+import pkg6.pkg81.pkg1062.m7313
+from pkg6.pkg82.pkg1071 import m3154
+
+
+def helper_25305_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
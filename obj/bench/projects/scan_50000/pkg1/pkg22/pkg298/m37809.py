@@ -0,0 +1,38 @@
+"""Module 37809."""
+import pkg7.pkg93.pkg1213.m1212
+from pkg10.pkg142.pkg1849 import m10184
+import pkg6.pkg82.m81
+from . import m25305
+import pkg1.pkg21.pkg276.m275
+from pkg2.pkg28.pkg365 import m4532
+import pkg10.pkg133.pkg1737.m7988
+from pkg5.pkg70.pkg922 import m3005
+import pkg2.pkg36.m35
+
+
+def helper_37809_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37809_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_37809_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_37809_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
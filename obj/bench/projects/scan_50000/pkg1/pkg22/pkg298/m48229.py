@@ -0,0 +1,24 @@
+"""Module 48229."""
+from . import m23221
+from pkg10.pkg140.pkg1822 import m1821
+import pkg9.pkg129.pkg1684.m3767
+from pkg3.pkg41.pkg543 import m35970
+from . import m8633
+from pkg5.pkg71 import m70
+import pkg4.pkg56.pkg732.m2815
+from pkg1 import m0
+import pkg8.pkg109.pkg1426.m9761
+
+
+def helper_48229_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_48229_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,30 @@
+"""Module 12802."""
+import pkg6.pkg83.m82
+from pkg8.pkg107.pkg1403 import m1402
+import pkg5.pkg70.pkg921.m11340
+from pkg1.pkg25 import m24
+import pkg6.pkg82.pkg1076.m1075
+from pkg9 import m8
+import pkg10.pkg131.pkg1711.m10046
+from pkg1 import m0
+
+
+def helper_12802_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12802_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_12802_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 2382."""
+from . import m298
+from pkg2 import m1
+import pkg4.pkg57.m56
+from pkg5.pkg70 import m69
+import pkg4.pkg64.m63
+
+
+def helper_2382_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2382_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2382_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,34 @@
+"""Module 25306."""
+import pkg1.pkg18.pkg242.m23165
+from pkg6.pkg88 import m87
+from . import m19054
+from pkg4.pkg57.pkg743 import m6994
+import pkg6.pkg88.pkg1153.m9488
+from pkg2.pkg37.pkg488 import m2571
+import pkg1.m0
+from pkg2.pkg31.pkg408 import m407
+import pkg9.pkg119.pkg1552.m5719
+from pkg2.pkg28.pkg366 import m4533
+from . import m21138
+from pkg10.pkg143 import m4310
+
+
+def helper_25306_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_25306_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_25306_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
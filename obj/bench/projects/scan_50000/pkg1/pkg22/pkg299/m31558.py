@@ -0,0 +1,14 @@
+"""Module 31558."""
+from . import m16970
+from pkg1.pkg25.pkg328 import m4495
+from . import m25306
+from pkg11.pkg156 import m155
+import pkg4.pkg56.pkg731.m730
+from pkg12.pkg159.pkg2069 import m2068
+
+
+def helper_31558_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
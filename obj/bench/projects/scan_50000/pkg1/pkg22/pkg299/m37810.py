@@ -0,0 +1,29 @@
+"""Module 37810."""
+import pkg7.pkg101.pkg1324.m5491
+from pkg10.pkg134 import m133
+from . import m2382
+from pkg5.pkg74.pkg975 import m3058
+import pkg3.pkg46.pkg601.m33944
+from pkg1.pkg17.pkg225 import m10644
+import pkg11.pkg150.m149
+
+
+def helper_37810_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37810_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_37810_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
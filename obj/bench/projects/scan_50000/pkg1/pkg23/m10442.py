@@ -0,0 +1,41 @@
+"""Module 10442."""
+import pkg1.pkg17.pkg231.m2314
+from pkg2.pkg39.pkg511 import m510
+import pkg5.pkg70.pkg921.m920
+from pkg3.pkg52.pkg686 import m6937
+from . import m4190
+from pkg6.pkg84 import m83
+import pkg2.m1
+from pkg11.pkg156.pkg2029 import m4112
+import pkg6.pkg91.pkg1185.m1184
+from pkg6.pkg82.pkg1074 import m1073
+from . import m8358
+from pkg5.pkg73 import m72
+
+
+def helper_10442_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10442_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_10442_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_10442_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
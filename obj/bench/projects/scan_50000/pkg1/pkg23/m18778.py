@@ -0,0 +1,17 @@
+"""Module 18778."""
+import pkg6.pkg90.pkg1174.m1173
+from pkg10 import m9
+import pkg6.pkg86.pkg1122.m11541
+from pkg6.pkg84.pkg1098 import m5265
+import pkg3.pkg41.pkg543.m17214
+from pkg4.pkg62.pkg816 import m9151
+import pkg6.pkg79.pkg1036.m3119
+from . import m16694
+import pkg4.pkg54.pkg708.m707
+
+
+def helper_18778_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,10 @@
+"""Module 20862."""
+from . import m4190
+from pkg9.pkg124.pkg1616 import m20371
+
+
+def helper_20862_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,55 @@
+"""Module 39618."""
+import pkg8.pkg116.pkg1520.m24443
+from pkg3.pkg47.pkg617 import m19372
+import pkg2.pkg36.m35
+from pkg9.pkg121.pkg1577 import m5744
+from . import m18778
+from pkg1.pkg16.pkg213 import m212
+import pkg1.pkg25.pkg326.m2409
+from pkg5.pkg72.pkg947 import m946
+from . import m25030
+from pkg11.pkg148.pkg1929 import m14432
+import pkg4.pkg56.pkg733.m2816
+from pkg4.pkg62.pkg811 import m810
+
+
+def helper_39618_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39618_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_39618_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_39618_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_39618_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_39618_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
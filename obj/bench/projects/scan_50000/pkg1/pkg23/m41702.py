@@ -0,0 +1,53 @@
+"""Module 41702."""
+import pkg3.pkg50.pkg659.m658
+from pkg8.pkg107.pkg1393 import m9728
+import pkg7.pkg99.pkg1297.m5464
+from pkg7.pkg97.pkg1262 import m20017
+from . import m14610
+from pkg2.pkg28.pkg365 import m2448
+import pkg5.pkg69.pkg900.m5067
+from pkg3.pkg41.pkg544 import m543
+import pkg10.pkg135.pkg1758.m3841
+from pkg5.pkg69.pkg902 import m11321
+
+
+def helper_41702_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_41702_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_41702_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_41702_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_41702_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_41702_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 6274."""
+import pkg7.pkg97.m96
+from pkg12.pkg163 import m162
+from . import m4190
+from pkg3 import m2
+
+
+def helper_6274_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6274_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,61 @@
+"""Module 8358."""
+import pkg3.pkg42.pkg548.m6799
+from . import m22
+import pkg2.pkg33.pkg442.m441
+from . import m2106
+import pkg1.pkg20.pkg267.m266
+from pkg1.pkg15 import m14
+import pkg9.pkg122.pkg1587.m1586
+from pkg4.pkg58.pkg765 import m2848
+import pkg1.m0
+from pkg7.pkg100.pkg1305 import m5472
+import pkg3.pkg41.pkg535.m4702
+
+
+def helper_8358_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8358_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8358_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8358_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_8358_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_8358_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8358_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
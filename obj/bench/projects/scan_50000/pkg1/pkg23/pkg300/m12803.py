@@ -0,0 +1,15 @@
+"""Module 12803."""
+import pkg8.pkg110.pkg1434.m9769
+from pkg13.pkg180 import m179
+import pkg4.pkg57.pkg747.m4914
+from pkg9.pkg120 import m119
+import pkg9.pkg129.pkg1686.m5853
+from pkg12.pkg159.pkg2072 import m2071
+import pkg13.pkg175.m2258
+
+
+def helper_12803_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,62 @@
+"""Module 23223."""
+import pkg6.pkg80.pkg1042.m9377
+from pkg8.pkg109.pkg1430 import m1429
+import pkg9.pkg123.m23046
+from pkg7.pkg95 import m94
+import pkg6.pkg85.pkg1108.m13611
+from pkg6.pkg81.pkg1059 import m1058
+import pkg5.pkg74.pkg967.m13470
+from pkg11.pkg153.pkg1992 import m10327
+from . import m10719
+from pkg4.pkg59.pkg771 import m4938
+import pkg7.pkg98.m97
+from pkg4 import m3
+
+
+def helper_23223_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_23223_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_23223_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_23223_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_23223_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_23223_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_23223_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
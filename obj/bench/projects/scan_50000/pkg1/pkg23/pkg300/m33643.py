@@ -0,0 +1,19 @@
+"""Module 33643."""
+from . import m19055
+from pkg11.pkg151.pkg1966 import m4049
+import pkg8.pkg106.pkg1379.m1378
+from pkg8.pkg115.pkg1501 import m18172
+
+
+def helper_33643_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_33643_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
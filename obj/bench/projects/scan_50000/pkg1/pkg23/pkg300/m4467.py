@@ -0,0 +1,19 @@
+"""Module 4467."""
+import pkg11.pkg151.pkg1974.m1973
+from pkg8.pkg105.pkg1374 import m3457
+import pkg9.pkg126.m125
+from pkg9.pkg130.pkg1699 import m1698
+import pkg3.pkg50.pkg662.m661
+from pkg4.pkg65 import m64
+import pkg11.pkg145.m144
+from pkg6.pkg81.pkg1056 import m1055
+import pkg1.pkg17.pkg223.m222
+from pkg10.pkg133 import m4300
+import pkg2.pkg28.pkg370.m369
+
+
+def helper_4467_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 6551."""
+import pkg7.pkg100.m99
+from pkg4.pkg56.pkg738 import m2821
+import pkg6.pkg81.pkg1065.m3148
+from . import m299
+from . import m2383
+
+
+def helper_6551_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6551_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6551_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
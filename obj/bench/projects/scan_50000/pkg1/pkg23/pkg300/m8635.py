@@ -0,0 +1,47 @@
+"""Module 8635."""
+import pkg1.pkg16.m15
+from pkg4.pkg53.pkg697 import m696
+import pkg1.m0
+from . import m299
+import pkg3.pkg44.pkg578.m577
+from pkg3.pkg40 import m39
+import pkg7.pkg93.m4260
+from pkg3.pkg47.pkg616 import m615
+import pkg8.m7
+from . import m6551
+import pkg7.pkg100.pkg1306.m1305
+
+
+def helper_8635_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8635_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8635_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8635_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_8635_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
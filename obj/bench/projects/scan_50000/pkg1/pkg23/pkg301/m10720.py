@@ -0,0 +1,52 @@
+"""Module 10720."""
+import pkg1.pkg26.pkg339.m338
+from pkg2.pkg36 import m35
+import pkg4.pkg53.pkg696.m2779
+from pkg10.pkg142 import m141
+import pkg10.pkg131.pkg1712.m3795
+from pkg4.pkg59.pkg773 import m4940
+import pkg3.pkg48.pkg629.m628
+from pkg11.pkg155.pkg2027 import m10362
+import pkg2.pkg34.m33
+
+
+def helper_10720_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10720_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_10720_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_10720_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_10720_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_10720_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,55 @@
+"""Module 23224."""
+import pkg5.pkg66.m65
+from pkg7.pkg92.pkg1203 import m3286
+import pkg7.pkg102.pkg1327.m20082
+from pkg7.pkg98.pkg1287 import m1286
+from . import m12804
+from pkg12.pkg159.pkg2068 import m20823
+import pkg2.pkg34.pkg444.m12947
+from . import m2384
+import pkg12.pkg159.pkg2075.m8326
+from . import m6552
+import pkg11.pkg155.pkg2023.m4106
+from pkg1 import m0
+
+
+def helper_23224_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_23224_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_23224_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_23224_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_23224_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_23224_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
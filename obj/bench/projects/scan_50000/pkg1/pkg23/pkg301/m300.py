@@ -0,0 +1,45 @@
+"""Module 300."""
+import pkg8.pkg111.m110
+from pkg3.pkg50 import m49
+import pkg1.m0
+from pkg1.pkg21 import m20
+import pkg1.pkg16.pkg214.m213
+from pkg1.pkg15.pkg207 import m206
+import pkg3.pkg48.m47
+from pkg10 import m9
+import pkg7.m6
+
+
+def helper_300_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_300_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_300_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_300_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_300_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,46 @@
+"""Module 6552."""
+import pkg1.m0
+from pkg11.pkg145.pkg1898 import m6065
+import pkg1.pkg24.m23
+from pkg11.pkg144 import m143
+from . import m4468
+from pkg10.pkg132.pkg1727 import m1726
+from . import m2384
+from pkg1.pkg17 import m16
+import pkg4.pkg53.pkg691.m2774
+from pkg12.pkg167 import m166
+
+
+def helper_6552_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6552_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6552_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6552_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_6552_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 8636."""
+import pkg9.pkg129.pkg1680.m1679
+from pkg5.pkg73 import m72
+import pkg11.pkg154.pkg2013.m2012
+from pkg8.pkg114.pkg1491 import m1490
+import pkg13.pkg176.m175
+from . import m4468
+import pkg2.m1
+from pkg1.pkg18.pkg235 import m234
+from . import m2384
+from pkg6.pkg80.pkg1042 import m1041
+import pkg1.m0
+
+
+def helper_8636_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 12805."""
+import pkg4.pkg58.m57
+from pkg9.pkg118.pkg1538 import m9873
+import pkg7.pkg99.pkg1291.m5458
+
+
+def helper_12805_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
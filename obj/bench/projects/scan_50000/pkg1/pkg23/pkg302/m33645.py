@@ -0,0 +1,28 @@
+"""Module 33645."""
+import pkg6.pkg84.pkg1101.m15688
+from pkg11.pkg155.pkg2027 import m31202
+import pkg1.pkg15.pkg207.m4374
+from pkg1.pkg20.pkg272 import m2355
+import pkg1.m0
+from . import m301
+
+
+def helper_33645_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_33645_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_33645_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
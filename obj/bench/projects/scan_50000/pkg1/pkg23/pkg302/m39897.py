@@ -0,0 +1,40 @@
+"""Module 39897."""
+from . import m12805
+from pkg2.pkg29.pkg389 import m35816
+from . import m37813
+from pkg9.pkg127.pkg1660 import m3743
+import pkg1.m0
+from pkg4.pkg58.pkg756 import m34099
+import pkg10.pkg132.pkg1728.m7979
+from . import m2385
+import pkg1.pkg25.pkg334.m10753
+from pkg11.pkg150 import m149
+import pkg4.pkg54.pkg704.m29879
+
+
+def helper_39897_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39897_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_39897_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_39897_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
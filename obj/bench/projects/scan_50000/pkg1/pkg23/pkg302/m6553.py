@@ -0,0 +1,26 @@
+"""Module 6553."""
+from . import m4469
+from pkg9.pkg128.pkg1665 import m3748
+import pkg2.pkg32.pkg429.m2512
+from pkg1 import m0
+
+
+def helper_6553_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6553_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6553_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 2386."""
+from . import m302
+from pkg11.pkg155 import m154
+import pkg4.pkg53.pkg697.m696
+
+
+def helper_2386_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,45 @@
+"""Module 302."""
+import pkg2.pkg34.m33
+from pkg3.pkg43 import m42
+import pkg4.m3
+from pkg1.pkg24 import m23
+import pkg2.pkg31.m30
+from pkg7.pkg96 import m95
+import pkg7.pkg95.m94
+from pkg8.pkg117 import m116
+import pkg3.pkg51.m50
+
+
+def helper_302_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_302_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_302_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_302_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_302_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
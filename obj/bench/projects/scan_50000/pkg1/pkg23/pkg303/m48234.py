@@ -0,0 +1,18 @@
+"""Module 48234."""
+from . import m14890
+from . import m12806
+import pkg4.m3
+from pkg8.pkg107.pkg1402 import m3485
+from . import m31562
+from . import m33646
+import pkg9.pkg125.pkg1637.m12056
+from pkg4.pkg54.pkg707 import m706
+import pkg9.pkg124.pkg1618.m9953
+from pkg10.pkg141.pkg1835 import m26842
+
+
+def helper_48234_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 8638."""
+import pkg6.pkg83.pkg1082.m5249
+from . import m4470
+import pkg1.pkg22.m21
+from pkg2.pkg39 import m38
+import pkg3.pkg47.pkg618.m617
+from pkg1 import m0
+from . import m302
+from pkg1.pkg14 import m13
+import pkg5.pkg66.pkg868.m867
+from pkg11 import m10
@@ -0,0 +1,54 @@
+"""Module 16975."""
+from . import m2387
+from pkg3.pkg45 import m16716
+from . import m10723
+from pkg11.pkg151.pkg1970 import m8221
+import pkg6.pkg88.pkg1146.m11565
+from pkg5.pkg76.pkg989 import m988
+import pkg3.pkg42.m6293
+from pkg2.pkg36.pkg475 import m4642
+from . import m303
+from pkg5.pkg76 import m75
+from . import m14891
+
+
+def helper_16975_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16975_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_16975_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_16975_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_16975_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_16975_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
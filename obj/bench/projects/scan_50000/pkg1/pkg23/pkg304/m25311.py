@@ -0,0 +1,31 @@
+"""Module 25311."""
+import pkg2.pkg37.m36
+from pkg10.pkg132.pkg1719 import m1718
+import pkg2.pkg28.pkg366.m365
+from pkg7.pkg100.pkg1307 import m3390
+import pkg1.pkg14.pkg195.m194
+from pkg1.pkg14.pkg186 import m185
+import pkg3.pkg40.m39
+from pkg5.pkg69 import m68
+import pkg5.pkg78.pkg1015.m7266
+
+
+def helper_25311_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_25311_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_25311_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 37815."""
+import pkg2.pkg33.pkg436.m435
+from . import m2387
+import pkg1.pkg18.pkg243.m6494
+from pkg9.pkg123.pkg1608 import m22447
+import pkg9.pkg125.pkg1630.m37057
+from . import m29479
+import pkg7.pkg100.pkg1301.m34644
+from pkg1 import m0
+import pkg2.pkg36.pkg479.m12982
+from pkg2.pkg35.pkg462 import m12965
+
+
+def helper_37815_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
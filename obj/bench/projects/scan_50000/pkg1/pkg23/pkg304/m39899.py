@@ -0,0 +1,31 @@
+"""Module 39899."""
+import pkg4.pkg62.pkg818.m32077
+from pkg5.pkg70.pkg913 import m912
+import pkg3.pkg51.pkg674.m29849
+from pkg5.pkg72.pkg939 import m36366
+import pkg1.pkg20.pkg269.m35696
+from pkg11.pkg148.pkg1926 import m16513
+import pkg8.m7
+from pkg2.pkg27.pkg359 import m6610
+import pkg6.pkg83.pkg1089.m24012
+
+
+def helper_39899_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39899_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_39899_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,38 @@
+"""Module 41983."""
+import pkg7.pkg99.pkg1298.m24221
+from pkg8.pkg107.pkg1395 import m1394
+import pkg9.pkg123.pkg1610.m41205
+from pkg5.pkg73.pkg951 import m32210
+from . import m303
+from pkg1 import m0
+from . import m25311
+from pkg6.pkg89.pkg1164 import m24087
+import pkg4.pkg57.pkg747.m32006
+
+
+def helper_41983_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_41983_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_41983_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_41983_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
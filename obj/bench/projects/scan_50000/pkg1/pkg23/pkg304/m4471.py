@@ -0,0 +1,45 @@
+"""Module 4471."""
+import pkg1.m0
+from pkg8.pkg117.pkg1527 import m1526
+import pkg3.pkg43.m2126
+from pkg9.pkg120.pkg1571 import m1570
+from . import m303
+from pkg7.pkg103.pkg1351 import m3434
+import pkg2.pkg39.pkg508.m2591
+from pkg2.pkg39.pkg515 import m514
+import pkg9.pkg128.pkg1670.m3753
+
+
+def helper_4471_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4471_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4471_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4471_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_4471_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
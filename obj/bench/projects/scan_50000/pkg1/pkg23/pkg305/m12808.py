@@ -0,0 +1,28 @@
+"""Module 12808."""
+import pkg2.pkg30.pkg392.m391
+from pkg9.pkg125.pkg1634 import m3717
+import pkg6.pkg80.pkg1043.m1042
+from pkg3 import m2
+import pkg11.pkg149.pkg1947.m6114
+from pkg1.pkg18.pkg241 import m2324
+
+
+def helper_12808_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12808_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_12808_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
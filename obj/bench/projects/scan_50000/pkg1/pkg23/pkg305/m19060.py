@@ -0,0 +1,55 @@
+"""Module 19060."""
+import pkg11.pkg148.pkg1926.m4009
+from pkg5.pkg73 import m18828
+import pkg2.pkg31.m30
+from . import m4472
+import pkg5.pkg76.pkg999.m9334
+from . import m6556
+from . import m10724
+from pkg6.pkg87 import m86
+import pkg9.pkg130.pkg1694.m7945
+from pkg1.pkg22.pkg287 import m16958
+import pkg2.pkg27.pkg359.m358
+from pkg2.pkg30 import m29
+
+
+def helper_19060_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_19060_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_19060_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_19060_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_19060_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_19060_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,37 @@
+"""Module 21144."""
+import pkg7.pkg94.pkg1231.m5398
+from . import m19060
+from . import m2388
+from pkg10.pkg139.pkg1809 import m12228
+import pkg12.m11
+from pkg10.pkg138.pkg1799 import m5966
+import pkg11.pkg153.pkg1996.m18667
+from . import m10724
+
+
+def helper_21144_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_21144_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_21144_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_21144_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
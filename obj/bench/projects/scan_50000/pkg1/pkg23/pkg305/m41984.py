@@ -0,0 +1,20 @@
+"""Module 41984."""
+import pkg8.pkg108.pkg1413.m11832
+from pkg4.pkg64 import m29239
+from . import m6556
+from pkg1.pkg25.pkg327 import m326
+import pkg4.pkg55.pkg716.m715
+
+
+def helper_41984_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_41984_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,41 @@
+"""Module 14893."""
+import pkg5.pkg73.m10492
+from pkg2 import m1
+import pkg3.pkg50.m49
+from pkg3.pkg46.pkg607 import m2690
+import pkg1.pkg22.pkg299.m298
+from pkg1.pkg22 import m21
+import pkg4.pkg65.pkg846.m845
+from pkg6.pkg88.pkg1151 import m3234
+import pkg5.pkg78.m77
+from pkg10.pkg131.pkg1712 import m3795
+import pkg2.pkg30.pkg395.m4562
+from pkg3.pkg51.pkg665 import m9000
+
+
+def helper_14893_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14893_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_14893_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_14893_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
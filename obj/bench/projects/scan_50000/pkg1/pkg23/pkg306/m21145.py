@@ -0,0 +1,28 @@
+"""Module 21145."""
+from . import m16977
+from . import m305
+import pkg5.pkg71.pkg924.m923
+from . import m10725
+import pkg11.pkg152.m151
+from pkg3.pkg43.pkg564 import m8899
+
+
+def helper_21145_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_21145_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_21145_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,45 @@
+"""Module 23229."""
+import pkg3.m2
+from pkg7.pkg97.pkg1264 import m1263
+import pkg9.pkg121.m120
+from pkg2.pkg39.pkg512 import m511
+import pkg2.pkg36.pkg473.m472
+from pkg10.pkg136.pkg1776 import m1775
+import pkg1.pkg19.pkg253.m252
+from pkg7.pkg103.pkg1345 import m5512
+import pkg8.pkg109.m6360
+
+
+def helper_23229_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_23229_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_23229_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_23229_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_23229_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 27397."""
+import pkg1.pkg19.pkg256.m255
+from pkg1.pkg26 import m25
+import pkg1.pkg14.pkg193.m2276
+from . import m4473
+from . import m305
+from pkg10.pkg136.pkg1781 import m1780
+from . import m2389
+from pkg4.pkg55.pkg726 import m725
+import pkg5.m6256
+from pkg6.pkg91.pkg1190 import m1189
+
+
+def helper_27397_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,30 @@
+"""Module 10726."""
+from . import m6558
+from pkg7.pkg104.pkg1359 import m5526
+from . import m4474
+from pkg9.pkg124.pkg1615 import m1614
+import pkg9.pkg121.pkg1575.m1574
+from pkg3.pkg42.pkg550 import m549
+import pkg8.pkg114.pkg1485.m1484
+from pkg8.pkg106 import m8441
+
+
+def helper_10726_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10726_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_10726_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,8 @@
+"""Module 31566."""
+from . import m16978
+from . import m25314
+from . import m21146
+from pkg7.pkg97.pkg1268 import m20023
+from . import m8642
+from pkg3.pkg41.pkg536 import m17207
+import pkg4.pkg65.pkg856.m19611
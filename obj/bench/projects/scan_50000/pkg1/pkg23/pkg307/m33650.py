@@ -0,0 +1,27 @@
+"""Module 33650."""
+import pkg6.pkg79.pkg1030.m17701
+from pkg7.pkg101.pkg1316 import m3399
+from . import m14894
+from pkg12.pkg158.pkg2067 import m6234
+import pkg4.pkg63.pkg822.m11241
+
+
+def helper_33650_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_33650_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_33650_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
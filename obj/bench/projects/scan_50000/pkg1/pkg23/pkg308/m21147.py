@@ -0,0 +1,39 @@
+"""Module 21147."""
+from . import m12811
+from pkg7.pkg94.pkg1225 import m9560
+import pkg3.pkg41.pkg539.m538
+from . import m4475
+import pkg10.pkg142.pkg1857.m16444
+from pkg7.pkg96.pkg1255 import m1254
+import pkg10.pkg136.m4303
+from pkg5.pkg68.pkg897 import m896
+import pkg6.pkg89.pkg1167.m5334
+from pkg3.pkg49.pkg646 import m2729
+
+
+def helper_21147_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_21147_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_21147_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_21147_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 27399."""
+import pkg5.pkg66.pkg869.m5036
+from pkg6 import m5
+import pkg4.pkg56.pkg730.m23653
+from pkg1.pkg15 import m10434
+
+
+def helper_27399_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_27399_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_27399_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
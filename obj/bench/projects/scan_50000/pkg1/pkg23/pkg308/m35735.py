@@ -0,0 +1,17 @@
+"""Module 35735."""
+import pkg9.pkg125.pkg1637.m28728
+from pkg2.pkg27.pkg360 import m359
+
+
+def helper_35735_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35735_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,37 @@
+"""Module 39903."""
+import pkg9.pkg124.pkg1623.m1622
+from pkg1.pkg25.pkg337 import m2420
+import pkg2.pkg31.pkg407.m21246
+from pkg3.pkg45.pkg589 import m17260
+from . import m27399
+from pkg5.pkg68.pkg888 import m2971
+import pkg2.pkg31.pkg409.m19164
+from pkg1 import m0
+
+
+def helper_39903_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39903_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_39903_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_39903_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,30 @@
+"""Module 6559."""
+import pkg7.pkg98.pkg1279.m3362
+from pkg1.pkg25.pkg331 import m4498
+import pkg9.pkg127.pkg1654.m1653
+from pkg1.pkg25.pkg338 import m2421
+import pkg7.pkg96.pkg1252.m1251
+from pkg1.pkg20 import m19
+import pkg4.pkg65.pkg849.m5016
+from . import m2391
+
+
+def helper_6559_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6559_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6559_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 10728."""
+import pkg9.pkg126.pkg1649.m1648
+from pkg8.pkg116.pkg1513 import m1512
+from . import m308
+from pkg11.pkg148.pkg1930 import m6097
+import pkg2.pkg30.pkg403.m8738
+from pkg1.pkg22.pkg287 import m4454
+import pkg4.pkg64.pkg839.m2922
+from pkg5.pkg71.pkg926 import m925
+import pkg4.pkg60.pkg782.m781
+from pkg7.pkg93.pkg1215 import m9550
+
+
+def helper_10728_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
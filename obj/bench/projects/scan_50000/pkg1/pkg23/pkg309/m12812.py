@@ -0,0 +1,24 @@
+"""Module 12812."""
+from . import m4476
+from pkg6.pkg79.pkg1037 import m1036
+import pkg8.pkg114.m2197
+from pkg9.pkg127.pkg1664 import m3747
+import pkg5.pkg70.pkg911.m9246
+from pkg2.pkg37.pkg485 import m2568
+import pkg5.pkg78.pkg1021.m1020
+from pkg7.pkg97.pkg1273 import m1272
+from . import m10728
+
+
+def helper_12812_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12812_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
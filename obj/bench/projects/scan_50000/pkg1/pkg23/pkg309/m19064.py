@@ -0,0 +1,16 @@
+"""Module 19064."""
+import pkg2.pkg33.pkg439.m438
+from pkg1.pkg15.pkg197 import m196
+import pkg1.pkg22.pkg290.m14877
+from pkg1.pkg21.pkg286 import m285
+import pkg10.pkg136.pkg1780.m3863
+from pkg4.pkg64.pkg840 import m7091
+import pkg3.pkg41.pkg538.m2621
+from pkg10.pkg141.pkg1836 import m16423
+
+
+def helper_19064_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
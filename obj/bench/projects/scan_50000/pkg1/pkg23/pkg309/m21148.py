@@ -0,0 +1,47 @@
+"""Module 21148."""
+import pkg9.pkg125.pkg1635.m1634
+from pkg8.pkg107.pkg1396 import m5563
+import pkg1.pkg14.m13
+from pkg9.pkg128.pkg1675 import m1674
+import pkg4.pkg53.pkg697.m6948
+from pkg7.pkg94.pkg1233 import m17904
+import pkg5.pkg67.pkg873.m872
+from . import m10728
+from . import m12812
+from pkg9.pkg125.pkg1626 import m1625
+import pkg11.pkg154.pkg2003.m4086
+
+
+def helper_21148_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_21148_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_21148_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_21148_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_21148_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
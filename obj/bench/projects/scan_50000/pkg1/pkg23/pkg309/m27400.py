@@ -0,0 +1,53 @@
+"""Module 27400."""
+import pkg7.pkg94.pkg1229.m9564
+from . import m10728
+import pkg4.pkg65.pkg857.m7108
+from . import m8644
+import pkg10.pkg136.pkg1776.m10111
+from pkg2.pkg30.pkg396 import m395
+from . import m14896
+from pkg8.pkg112.pkg1468 import m1467
+import pkg1.pkg21.pkg281.m19036
+from pkg4.pkg62 import m61
+
+
+def helper_27400_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_27400_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_27400_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_27400_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_27400_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_27400_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
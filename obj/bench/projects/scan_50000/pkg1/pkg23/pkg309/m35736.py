@@ -0,0 +1,37 @@
+"""Module 35736."""
+from . import m8644
+from pkg6.pkg89.pkg1161 import m9496
+from . import m10728
+from pkg9.pkg125.pkg1633 import m28724
+import pkg1.pkg17.m16
+from pkg5.pkg78.pkg1017 import m32276
+import pkg4.pkg54.m12557
+from . import m14896
+
+
+def helper_35736_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35736_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_35736_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_35736_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,13 @@
+"""Module 37820."""
+from . import m33652
+from pkg5.pkg70.pkg915 import m2998
+import pkg1.pkg19.pkg249.m2332
+from . import m4476
+import pkg9.pkg123.pkg1604.m20359
+
+
+def helper_37820_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
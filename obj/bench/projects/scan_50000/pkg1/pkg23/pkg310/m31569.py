@@ -0,0 +1,40 @@
+"""Module 31569."""
+import pkg4.pkg64.pkg835.m19590
+from pkg6.pkg85.pkg1117 import m7368
+import pkg5.pkg73.m72
+from pkg11.pkg149.pkg1944 import m12363
+import pkg2.pkg30.pkg401.m4568
+from pkg10.pkg141.pkg1837 import m16424
+import pkg1.pkg17.m16
+from . import m21149
+from . import m29485
+from pkg7.pkg101.pkg1325 import m7576
+import pkg2.pkg35.pkg466.m6717
+
+
+def helper_31569_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_31569_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_31569_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_31569_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
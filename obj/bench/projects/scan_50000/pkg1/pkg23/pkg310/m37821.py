@@ -0,0 +1,38 @@
+"""Module 37821."""
+import pkg7.pkg92.pkg1205.m3288
+from pkg6.pkg82.pkg1075 import m3158
+import pkg2.pkg38.m37
+from pkg6.pkg80.pkg1043 import m17714
+import pkg3.pkg45.m8380
+from pkg3.pkg45 import m44
+import pkg5.pkg67.pkg877.m5044
+from pkg7.pkg100.pkg1309 import m34652
+from . import m27401
+
+
+def helper_37821_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37821_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_37821_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_37821_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,41 @@
+"""Module 41989."""
+import pkg2.pkg27.pkg356.m6607
+from pkg9.pkg128.pkg1669 import m1668
+import pkg4.pkg63.pkg827.m826
+from . import m19065
+import pkg1.pkg16.pkg212.m211
+from pkg10.pkg141 import m2224
+import pkg7.pkg98.pkg1279.m7530
+from pkg8.pkg114 import m113
+import pkg9.pkg125.m124
+from . import m37821
+from . import m14897
+from pkg3.pkg51.pkg672 import m27763
+
+
+def helper_41989_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_41989_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_41989_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_41989_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
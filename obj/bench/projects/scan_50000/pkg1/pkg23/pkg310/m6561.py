@@ -0,0 +1,37 @@
+"""Module 6561."""
+import pkg1.pkg14.pkg184.m2267
+from pkg8.pkg108 import m107
+import pkg6.m5
+from pkg1.pkg14 import m2097
+from . import m309
+from pkg10.pkg134.pkg1750 import m1749
+import pkg2.pkg29.pkg389.m388
+from . import m2393
+
+
+def helper_6561_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6561_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6561_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6561_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
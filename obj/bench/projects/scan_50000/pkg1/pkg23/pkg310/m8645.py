@@ -0,0 +1,47 @@
+"""Module 8645."""
+import pkg3.pkg40.pkg523.m522
+from pkg1.pkg16 import m15
+from . import m4477
+from pkg2.pkg34.pkg449 import m2532
+import pkg1.pkg14.pkg185.m184
+from . import m309
+import pkg5.pkg72.m71
+from pkg8.pkg109.pkg1426 import m3509
+import pkg3.pkg42.pkg554.m553
+from pkg6 import m5
+import pkg3.pkg49.pkg641.m2724
+
+
+def helper_8645_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8645_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8645_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8645_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_8645_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
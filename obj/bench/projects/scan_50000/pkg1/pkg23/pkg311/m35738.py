@@ -0,0 +1,61 @@
+"""Module 35738."""
+from . import m310
+from pkg2.pkg34.pkg450 import m17121
+import pkg4.pkg60.pkg787.m786
+from pkg6.pkg84 import m83
+import pkg1.pkg14.pkg195.m21034
+from pkg10.pkg131.pkg1709 import m32968
+import pkg6.pkg82.pkg1074.m3157
+from pkg8.pkg109.pkg1425 import m3508
+from . import m27402
+from pkg7.pkg101 import m100
+import pkg3.pkg41.pkg545.m8880
+
+
+def helper_35738_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35738_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_35738_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_35738_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_35738_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_35738_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35738_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
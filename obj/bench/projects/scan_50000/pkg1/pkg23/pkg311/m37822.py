@@ -0,0 +1,22 @@
+"""Module 37822."""
+import pkg12.m11
+from . import m14898
+from . import m310
+from pkg1.pkg16.pkg216 import m12719
+import pkg2.pkg31.pkg408.m29583
+from pkg7.pkg98.pkg1281 import m26288
+import pkg9.pkg128.m4295
+
+
+def helper_37822_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37822_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
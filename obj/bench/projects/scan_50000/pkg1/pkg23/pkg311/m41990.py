@@ -0,0 +1,38 @@
+"""Module 41990."""
+import pkg6.pkg85.pkg1111.m32370
+from pkg6.pkg89 import m88
+from . import m310
+from pkg10.pkg134.pkg1753 import m30928
+import pkg6.pkg88.pkg1152.m21991
+from pkg4.pkg55 import m2138
+from . import m10730
+from pkg7.pkg93.pkg1219 import m9554
+import pkg11.pkg154.pkg2015.m33274
+
+
+def helper_41990_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_41990_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_41990_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_41990_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,39 @@
+"""Module 12815."""
+import pkg1.pkg17.pkg233.m2316
+from pkg9.pkg121.pkg1577 import m3660
+import pkg2.pkg27.pkg352.m351
+from pkg10.pkg135.pkg1765 import m10100
+import pkg5.pkg71.pkg934.m3017
+from pkg4.pkg54.pkg706 import m2789
+import pkg3.pkg52.pkg685.m11104
+from pkg2.pkg32.pkg429 import m428
+from . import m8647
+from pkg4.pkg62.pkg819 import m818
+
+
+def helper_12815_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12815_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_12815_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_12815_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,47 @@
+"""Module 16983."""
+import pkg7.pkg95.m94
+from . import m311
+import pkg8.pkg112.pkg1468.m5635
+from pkg1.pkg14.pkg185 import m184
+import pkg1.m0
+from pkg1.pkg17.pkg234 import m233
+import pkg9.pkg120.m119
+from pkg2.pkg39.pkg516 import m515
+import pkg11.pkg150.pkg1962.m1961
+from pkg3.pkg48.pkg625 import m624
+from . import m14899
+
+
+def helper_16983_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16983_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_16983_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_16983_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_16983_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
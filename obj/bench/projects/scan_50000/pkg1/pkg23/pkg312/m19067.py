@@ -0,0 +1,44 @@
+"""Module 19067."""
+import pkg2.pkg32.pkg429.m10848
+from . import m12815
+import pkg4.pkg56.pkg730.m4897
+from pkg2.pkg31 import m30
+from . import m4479
+from pkg4.pkg65.pkg850 import m5017
+import pkg3.pkg40.pkg532.m17203
+from pkg1 import m0
+
+
+def helper_19067_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_19067_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_19067_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_19067_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_19067_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,9 @@
+"""Module 29487."""
+import pkg3.pkg44.pkg580.m15167
+
+
+def helper_29487_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 35739."""
+import pkg10.pkg138.pkg1807.m18478
+from pkg8.pkg116.pkg1510 import m5677
+import pkg1.pkg15.pkg203.m27294
+
+
+def helper_35739_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35739_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 41991."""
+import pkg1.m0
+from pkg2 import m1
+import pkg5.pkg74.pkg964.m30139
+from pkg4.pkg56.pkg733 import m31992
+from . import m25319
+from pkg3.pkg44.pkg575 import m29750
+import pkg8.pkg110.pkg1441.m24364
+from pkg6.pkg91.pkg1189 import m3272
+import pkg1.pkg14.pkg193.m4360
+from pkg11.pkg153 import m20992
+import pkg3.pkg47.pkg613.m33956
+
+
+def helper_41991_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 14611."""
+import pkg1.m0
+from pkg10.pkg137.pkg1790 import m1789
+import pkg4.pkg63.pkg831.m2914
+
+
+def helper_14611_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
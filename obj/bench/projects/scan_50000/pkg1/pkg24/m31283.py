@@ -0,0 +1,36 @@
+"""Module 31283."""
+import pkg5.pkg74.m6325
+from pkg7.pkg98.pkg1275 import m13778
+import pkg11.pkg145.m144
+from pkg11.pkg153.pkg2001 import m6168
+from . import m8359
+from pkg11.pkg145.pkg1896 import m10231
+import pkg11.pkg147.pkg1914.m1913
+
+
+def helper_31283_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_31283_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_31283_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_31283_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
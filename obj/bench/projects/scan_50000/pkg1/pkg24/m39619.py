@@ -0,0 +1,45 @@
+"""Module 39619."""
+from . import m10443
+from pkg10.pkg133.pkg1737 import m7988
+import pkg7.pkg101.pkg1322.m11741
+from pkg1 import m0
+import pkg9.pkg128.pkg1672.m7923
+from pkg8.pkg116.pkg1517 import m1516
+import pkg7.pkg99.pkg1298.m11717
+from pkg10.pkg141.pkg1844 import m1843
+import pkg9.pkg123.pkg1605.m9940
+
+
+def helper_39619_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39619_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_39619_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_39619_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_39619_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,45 @@
+"""Module 45871."""
+from . import m14611
+from pkg3 import m2
+import pkg3.pkg44.pkg578.m577
+from pkg1.pkg23.pkg306 import m10725
+import pkg5.pkg68.pkg897.m5064
+from pkg6.pkg91.pkg1195 import m7446
+import pkg6.pkg81.pkg1066.m40661
+from pkg8.pkg116 import m115
+import pkg8.pkg108.m2191
+
+
+def helper_45871_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_45871_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_45871_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_45871_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_45871_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,34 @@
+"""Module 19068."""
+from . import m2396
+from pkg9.pkg118.pkg1544 import m18215
+import pkg3.pkg47.pkg623.m2706
+from pkg5.pkg76.pkg992 import m3075
+import pkg11.pkg153.pkg1994.m1993
+from pkg11.pkg146.pkg1908 import m3991
+import pkg2.pkg36.m35
+from pkg4.pkg61.pkg805 import m7056
+from . import m6564
+from pkg9.pkg119.pkg1548 import m5715
+import pkg9.pkg122.pkg1596.m1595
+from pkg12.pkg159 import m14746
+
+
+def helper_19068_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_19068_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_19068_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
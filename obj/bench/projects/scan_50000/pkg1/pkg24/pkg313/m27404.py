@@ -0,0 +1,19 @@
+"""Module 27404."""
+import pkg2.pkg27.pkg361.m2444
+from pkg4.pkg62.pkg808 import m7059
+import pkg3.pkg43.pkg571.m570
+from pkg4.pkg55.pkg726 import m15313
+
+
+def helper_27404_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_27404_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
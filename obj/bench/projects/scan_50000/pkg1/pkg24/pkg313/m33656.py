@@ -0,0 +1,40 @@
+"""Module 33656."""
+from . import m2396
+from pkg1.pkg19.pkg251 import m6502
+import pkg1.pkg26.pkg339.m6590
+from pkg3.pkg51 import m50
+import pkg4.pkg64.pkg839.m838
+from pkg8.pkg110.pkg1432 import m3515
+import pkg5.pkg71.pkg925.m5092
+from pkg4.pkg63.pkg820 import m15407
+import pkg6.pkg90.pkg1176.m1175
+from . import m6564
+import pkg2.pkg29.pkg381.m12884
+
+
+def helper_33656_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_33656_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_33656_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_33656_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,33 @@
+"""Module 8648."""
+import pkg9.pkg122.pkg1599.m1598
+from pkg1.pkg17.pkg225 import m224
+import pkg10.pkg138.pkg1798.m5965
+from pkg1.pkg18.pkg243 import m242
+import pkg3.pkg47.m46
+from pkg8.pkg106.pkg1391 import m7642
+from . import m2396
+from pkg3.pkg45.pkg587 import m586
+import pkg8.pkg113.pkg1480.m3563
+from . import m4480
+import pkg11.pkg154.pkg2003.m4086
+
+
+def helper_8648_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8648_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8648_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 23237."""
+import pkg4.pkg62.pkg808.m2891
+from pkg7.pkg103.pkg1342 import m11761
+import pkg6.pkg80.pkg1046.m1045
+from . import m4481
+import pkg6.pkg85.pkg1112.m3195
+from pkg10.pkg136.pkg1780 import m1779
+import pkg6.pkg87.pkg1137.m3220
+from . import m21153
+import pkg1.pkg23.m14610
+from pkg4.pkg64 import m63
+import pkg5.pkg70.pkg915.m17586
+
+
+def helper_23237_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_23237_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,24 @@
+"""Module 31573."""
+import pkg4.pkg64.pkg843.m842
+from pkg4.pkg64.pkg843 import m9178
+import pkg6.pkg89.pkg1167.m5334
+from pkg4.pkg61.pkg796 import m7047
+import pkg1.pkg20.pkg267.m4434
+from pkg11.pkg147.pkg1918 import m4001
+import pkg6.pkg84.pkg1105.m9440
+from pkg2.pkg31.pkg412 import m411
+import pkg7.pkg100.pkg1309.m1308
+
+
+def helper_31573_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_31573_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,33 @@
+"""Module 37825."""
+import pkg1.pkg15.pkg203.m12706
+from pkg5.pkg68.pkg889 import m21728
+import pkg7.pkg94.pkg1234.m1233
+from pkg4.pkg53.pkg700 import m15287
+import pkg1.m0
+from pkg10.pkg139.pkg1815 import m1814
+import pkg4.pkg65.m2148
+from pkg6.pkg87.pkg1143 import m9478
+import pkg2.pkg33.m2116
+from pkg1.pkg19.pkg251 import m250
+import pkg5.pkg67.pkg884.m23807
+
+
+def helper_37825_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37825_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_37825_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,55 @@
+"""Module 39909."""
+import pkg1.pkg25.m39620
+from pkg4.pkg65.pkg858 import m7109
+import pkg4.pkg61.pkg800.m799
+from pkg1.pkg19.pkg259 import m258
+import pkg1.pkg15.pkg196.m195
+from pkg9.pkg123.pkg1603 import m1602
+import pkg11.pkg149.pkg1940.m12359
+from pkg10.pkg135.pkg1758 import m8009
+import pkg5.pkg77.pkg1011.m9346
+from pkg9.pkg123.pkg1608 import m3691
+from . import m37825
+from . import m27405
+
+
+def helper_39909_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39909_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_39909_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_39909_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_39909_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_39909_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
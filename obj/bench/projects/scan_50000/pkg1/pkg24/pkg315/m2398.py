@@ -0,0 +1,38 @@
+"""Module 2398."""
+import pkg4.pkg62.pkg810.m809
+from pkg8.pkg105.pkg1369 import m1368
+import pkg1.m0
+from pkg10.pkg140 import m139
+import pkg8.pkg115.m2198
+from . import m314
+import pkg5.pkg66.pkg871.m870
+from pkg1.pkg22.pkg298 import m297
+import pkg3.pkg42.pkg557.m556
+
+
+def helper_2398_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2398_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2398_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2398_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,12 @@
+"""Module 37826."""
+import pkg8.pkg110.pkg1438.m11857
+from pkg8.pkg108.pkg1406 import m22245
+import pkg12.pkg157.pkg2048.m18719
+from pkg7.pkg94.pkg1231 import m11650
+
+
+def helper_37826_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,29 @@
+"""Module 8650."""
+import pkg8.pkg105.m104
+from pkg7.pkg100 import m4267
+import pkg4.pkg55.m54
+from pkg11.pkg150.pkg1951 import m8202
+import pkg7.pkg103.m2186
+from pkg1.pkg24.pkg325 import m324
+from . import m2398
+
+
+def helper_8650_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8650_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8650_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,54 @@
+"""Module 10735."""
+import pkg6.pkg81.pkg1059.m1058
+from pkg9.pkg123.pkg1608 import m1607
+import pkg1.pkg19.pkg256.m2339
+from pkg5.pkg74.pkg969 import m9304
+import pkg6.pkg84.pkg1094.m3177
+from pkg4.pkg60.pkg791 import m4958
+import pkg2.pkg38.pkg496.m495
+from pkg2.pkg32 import m31
+import pkg6.m5
+from . import m8651
+from . import m6567
+
+
+def helper_10735_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10735_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_10735_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_10735_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_10735_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_10735_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,60 @@
+"""Module 14903."""
+import pkg11.pkg145.pkg1896.m14399
+from pkg2.pkg29 import m28
+import pkg6.pkg91.pkg1188.m7439
+from pkg4.pkg64.pkg845 import m5012
+import pkg4.pkg60.m59
+from pkg8.pkg111.pkg1444 import m13947
+import pkg4.pkg57.pkg751.m11170
+from pkg11.pkg149.pkg1945 import m4028
+import pkg5.pkg77.pkg1006.m5173
+from . import m315
+
+
+def helper_14903_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14903_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_14903_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_14903_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_14903_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_14903_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14903_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 315."""
+import pkg5.pkg75.m74
+from pkg1 import m0
+import pkg1.pkg14.pkg186.m185
+from pkg6 import m5
+
+
+def helper_315_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_315_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,42 @@
+"""Module 44079."""
+import pkg7.pkg94.pkg1226.m38737
+from pkg4.pkg55.pkg720 import m4887
+import pkg11.pkg153.pkg1995.m1994
+from pkg11.pkg147 import m146
+import pkg10.pkg133.pkg1738.m1737
+from pkg8.pkg110.pkg1437 import m7688
+
+
+def helper_44079_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_44079_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_44079_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_44079_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_44079_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,41 @@
+"""Module 8651."""
+import pkg5.pkg72.pkg939.m938
+from pkg1.pkg24.pkg314 import m313
+import pkg7.pkg98.pkg1287.m1286
+from pkg2.pkg28 import m27
+import pkg1.pkg20.pkg261.m260
+from pkg9 import m8
+import pkg3.pkg41.pkg540.m539
+from pkg1 import m0
+import pkg2.pkg31.pkg410.m409
+from pkg10.pkg131.pkg1714 import m3797
+import pkg9.pkg130.pkg1697.m1696
+from pkg2 import m1
+
+
+def helper_8651_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8651_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8651_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8651_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,45 @@
+"""Module 19072."""
+import pkg5.pkg74.pkg970.m7221
+from pkg6.pkg88.pkg1151 import m1150
+import pkg3.pkg46.pkg605.m2688
+from pkg7.pkg96 import m95
+import pkg12.pkg164.m163
+from pkg3.pkg52.pkg685 import m684
+import pkg1.m0
+from pkg11.pkg144.pkg1877 import m8128
+import pkg6.m5
+
+
+def helper_19072_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_19072_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_19072_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_19072_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_19072_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 35744."""
+import pkg9.pkg130.pkg1699.m28790
+from pkg1.pkg21.pkg274 import m10693
+import pkg3.pkg47.pkg619.m4786
+from pkg1.pkg17.pkg226 import m8561
+import pkg10.pkg141.pkg1844.m3927
+from pkg5.pkg78 import m12581
+from . import m27408
+from pkg3.pkg45.pkg596 import m595
+from . import m29492
+
+
+def helper_35744_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
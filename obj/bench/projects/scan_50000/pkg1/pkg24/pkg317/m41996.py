@@ -0,0 +1,27 @@
+"""Module 41996."""
+from . import m316
+from pkg8.pkg107.pkg1392 import m24315
+import pkg11.pkg149.pkg1948.m24871
+from . import m25324
+import pkg9.pkg125.pkg1629.m16216
+
+
+def helper_41996_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_41996_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_41996_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
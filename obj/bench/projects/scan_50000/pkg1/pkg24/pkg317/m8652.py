@@ -0,0 +1,29 @@
+"""Module 8652."""
+import pkg3.pkg41.pkg539.m538
+from pkg2.pkg35.pkg460 import m6711
+from . import m2400
+from pkg4.pkg53.pkg692 import m691
+import pkg9.pkg124.pkg1617.m5784
+from pkg7.pkg93.pkg1221 import m1220
+import pkg2.pkg39.pkg518.m4685
+
+
+def helper_8652_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8652_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8652_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
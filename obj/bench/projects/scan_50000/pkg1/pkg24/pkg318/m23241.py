@@ -0,0 +1,39 @@
+"""Module 23241."""
+import pkg1.pkg16.pkg216.m215
+from . import m6569
+from . import m317
+from pkg1.pkg19 import m18
+import pkg6.pkg89.pkg1169.m1168
+from pkg7.pkg102.pkg1339 import m1338
+import pkg12.m11
+from pkg4.pkg59.pkg779 import m4946
+import pkg2.pkg28.pkg369.m21208
+from . import m8653
+
+
+def helper_23241_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_23241_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_23241_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_23241_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 27409."""
+import pkg3.pkg48.pkg632.m19387
+from pkg6.pkg90 import m89
+from . import m4485
+
+
+def helper_27409_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_27409_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
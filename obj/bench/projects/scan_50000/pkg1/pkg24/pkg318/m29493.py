@@ -0,0 +1,55 @@
+"""Module 29493."""
+import pkg6.pkg83.pkg1082.m5249
+from . import m19073
+import pkg5.pkg67.pkg884.m27975
+from . import m6569
+import pkg3.m2
+from pkg10.pkg135.pkg1765 import m12184
+from . import m25325
+from pkg8 import m7
+import pkg1.pkg21.m20
+from pkg1.pkg22.pkg298 import m4465
+import pkg4.pkg53.pkg694.m693
+from pkg7.pkg93.pkg1212 import m1211
+
+
+def helper_29493_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_29493_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_29493_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_29493_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_29493_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_29493_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
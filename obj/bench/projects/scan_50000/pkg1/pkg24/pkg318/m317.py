@@ -0,0 +1,11 @@
+"""Module 317."""
+import pkg3.m2
+from pkg9.pkg119 import m118
+import pkg1.pkg24.m23
+
+
+def helper_317_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 41997."""
+import pkg8.pkg112.pkg1457.m18128
+from pkg6.pkg79.pkg1037 import m1036
+from . import m29493
+from pkg6.pkg79.pkg1040 import m19795
+import pkg1.pkg16.pkg215.m214
+from pkg6.pkg89.pkg1170 import m13673
+import pkg1.m0
+from pkg3.pkg44.pkg574 import m17245
+from . import m8653
+from . import m6569
+import pkg5.pkg67.pkg882.m38393
+
+
+def helper_41997_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_41997_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,39 @@
+"""Module 6569."""
+import pkg3.pkg42.m41
+from pkg2.pkg27 import m26
+import pkg6.pkg91.pkg1194.m5361
+from pkg8.pkg105.pkg1369 import m3452
+import pkg1.m0
+from pkg5.pkg75.pkg982 import m3065
+import pkg2.pkg30.pkg395.m394
+from pkg1.pkg24.pkg314 import m4481
+import pkg2.pkg39.m38
+from pkg2.pkg37.pkg490 import m2573
+
+
+def helper_6569_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6569_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6569_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6569_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,15 @@
+"""Module 2402."""
+from . import m318
+from pkg7.pkg98.pkg1278 import m1277
+import pkg5.pkg72.m71
+from pkg3 import m2
+import pkg10.pkg136.pkg1781.m1780
+from pkg10 import m9
+import pkg10.pkg137.pkg1785.m1784
+
+
+def helper_2402_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 33662."""
+import pkg1.pkg14.pkg192.m191
+from pkg4 import m3
+import pkg10.pkg142.pkg1858.m1857
+from pkg4.pkg60 import m2143
+import pkg11.pkg145.pkg1898.m28989
+
+
+def helper_33662_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_33662_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_33662_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
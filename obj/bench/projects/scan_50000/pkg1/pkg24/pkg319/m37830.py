@@ -0,0 +1,5 @@
+"""Module 37830."""
+import pkg3.pkg52.pkg684.m29859
+from pkg10.pkg136 import m135
+import pkg8.pkg112.pkg1467.m5634
+from . import m8654
@@ -0,0 +1,26 @@
+"""Module 4486."""
+import pkg4.pkg60.pkg792.m2875
+from pkg1.pkg14 import m13
+import pkg6.pkg89.pkg1163.m1162
+from pkg4.pkg58.pkg764 import m2847
+import pkg4.pkg57.pkg748.m747
+from . import m2402
+import pkg4.pkg57.pkg750.m749
+from pkg10.pkg132.pkg1727 import m3810
+from . import m318
+from pkg3.pkg45.pkg588 import m587
+import pkg1.pkg15.pkg197.m196
+
+
+def helper_4486_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4486_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
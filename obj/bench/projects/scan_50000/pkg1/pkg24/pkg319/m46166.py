@@ -0,0 +1,23 @@
+"""Module 46166."""
+import pkg2.pkg37.pkg489.m44252
+from pkg9.pkg126.pkg1643 import m22482
+from . import m27410
+from pkg6.pkg81.pkg1054 import m9389
+import pkg8.pkg112.m111
+from pkg2.pkg28.pkg371 import m370
+import pkg7.pkg96.pkg1254.m34597
+from pkg1.pkg15.pkg198 import m197
+
+
+def helper_46166_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_46166_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,10 @@
+"""Module 19075."""
+import pkg3.pkg45.pkg594.m2677
+from . import m14907
+
+
+def helper_19075_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,30 @@
+"""Module 33663."""
+import pkg1.pkg19.pkg257.m256
+from pkg9.pkg128.pkg1666 import m28757
+from . import m23243
+from . import m10739
+import pkg3.pkg52.pkg684.m27775
+from pkg9.pkg122.pkg1595 import m12014
+import pkg6.pkg91.pkg1192.m26199
+from pkg6.pkg79.pkg1028 import m3111
+
+
+def helper_33663_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_33663_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_33663_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
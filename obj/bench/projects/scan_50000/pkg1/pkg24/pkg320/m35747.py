@@ -0,0 +1,17 @@
+"""Module 35747."""
+import pkg12.pkg157.pkg2046.m4129
+from pkg6.pkg85.pkg1109 import m13612
+
+
+def helper_35747_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35747_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
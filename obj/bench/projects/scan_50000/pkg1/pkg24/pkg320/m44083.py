@@ -0,0 +1,29 @@
+"""Module 44083."""
+import pkg4.pkg54.pkg703.m702
+from pkg2.pkg35.pkg468 import m467
+import pkg11.pkg152.pkg1979.m10314
+from pkg10.pkg131.pkg1715 import m1714
+import pkg8.pkg108.pkg1413.m24336
+from pkg12.pkg158.pkg2059 import m39570
+import pkg7.pkg104.pkg1365.m1364
+
+
+def helper_44083_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_44083_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_44083_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
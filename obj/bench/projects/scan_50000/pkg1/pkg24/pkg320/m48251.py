@@ -0,0 +1,39 @@
+"""Module 48251."""
+from . import m4487
+from . import m39915
+import pkg2.pkg28.m27
+from . import m31579
+import pkg1.pkg14.m13
+from pkg6 import m5
+import pkg1.m0
+from pkg1.pkg25.pkg335 import m46182
+import pkg10.pkg135.pkg1763.m10098
+from pkg4.pkg64.pkg844 import m5011
+
+
+def helper_48251_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_48251_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_48251_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_48251_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
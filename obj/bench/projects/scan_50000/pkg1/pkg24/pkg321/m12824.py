@@ -0,0 +1,32 @@
+"""Module 12824."""
+import pkg9.pkg128.m127
+from . import m4488
+import pkg6.pkg79.pkg1029.m1028
+from pkg3.pkg45 import m44
+import pkg1.pkg16.pkg217.m216
+from pkg8.pkg107.pkg1401 import m1400
+import pkg7.pkg104.pkg1357.m11776
+from pkg8.pkg112.pkg1459 import m1458
+import pkg3.pkg51.pkg670.m4837
+from pkg1 import m0
+
+
+def helper_12824_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12824_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_12824_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,37 @@
+"""Module 16992."""
+import pkg4.pkg60.pkg784.m2867
+from pkg2.pkg29.pkg380 import m379
+from . import m14908
+from pkg8 import m7
+import pkg2.pkg28.pkg365.m8700
+from pkg3.pkg43 import m42
+import pkg3.pkg47.pkg614.m613
+from pkg11.pkg151.pkg1972 import m10307
+
+
+def helper_16992_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16992_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_16992_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_16992_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
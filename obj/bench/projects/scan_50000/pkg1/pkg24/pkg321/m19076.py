@@ -0,0 +1,40 @@
+"""Module 19076."""
+import pkg11.pkg145.pkg1887.m16474
+from pkg1 import m0
+import pkg11.pkg148.m147
+from pkg3.pkg45.pkg586 import m13089
+import pkg4.pkg65.m64
+from . import m16992
+import pkg5.pkg74.pkg973.m3056
+from . import m14908
+import pkg8.pkg111.pkg1452.m7703
+from pkg8 import m7
+import pkg5.pkg67.pkg876.m7127
+
+
+def helper_19076_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_19076_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_19076_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_19076_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
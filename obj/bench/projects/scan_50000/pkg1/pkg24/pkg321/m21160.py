@@ -0,0 +1,33 @@
+"""Module 21160."""
+import pkg1.pkg14.pkg192.m4359
+from . import m10740
+import pkg11.pkg154.pkg2008.m20763
+from pkg10.pkg143.pkg1869 import m10204
+import pkg8.pkg116.m115
+from pkg5.pkg73.pkg959 import m19714
+import pkg3.pkg44.pkg585.m584
+from pkg13.pkg170 import m169
+import pkg1.pkg24.pkg320.m319
+from pkg2.pkg34.pkg446 import m445
+import pkg6.pkg86.pkg1131.m3214
+
+
+def helper_21160_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_21160_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_21160_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 27412."""
+import pkg9.pkg125.pkg1634.m7885
+from pkg8.pkg110.pkg1443 import m3526
+import pkg6.pkg86.pkg1126.m24049
+from pkg1.pkg23.pkg311 import m10730
+from . import m14908
+from . import m10740
+import pkg3.pkg40.pkg533.m532
+from pkg10.pkg135.pkg1757 import m10092
+from . import m320
+from pkg11.pkg150.pkg1961 import m26968
+
+
+def helper_27412_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 320."""
+import pkg3.pkg41.m40
+from pkg2.pkg28 import m27
+import pkg10.m9
+from pkg1.pkg18.pkg244 import m243
+import pkg1.m0
+from pkg9.pkg129 import m128
+import pkg2.m1
+from pkg13 import m12
+import pkg2.pkg37.m36
+from pkg1.pkg22.pkg291 import m290
+
+
+def helper_320_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,21 @@
+"""Module 10741."""
+import pkg3.pkg48.pkg632.m6883
+from . import m4489
+import pkg3.pkg52.pkg684.m6935
+from . import m6573
+import pkg3.pkg42.pkg550.m2633
+from pkg3 import m2
+
+
+def helper_10741_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10741_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1 @@
+"""Module 19077."""
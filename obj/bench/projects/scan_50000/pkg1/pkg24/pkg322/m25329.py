@@ -0,0 +1,9 @@
+"""Module 25329."""
+import pkg5.pkg72.pkg941.m940
+
+
+def helper_25329_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,32 @@
+"""Module 14910."""
+import pkg7.pkg103.pkg1348.m1347
+from . import m4490
+import pkg2.pkg39.pkg518.m8853
+from pkg2.pkg37.pkg488 import m4655
+import pkg9.pkg130.m129
+from pkg1.pkg19.pkg251 import m250
+from . import m2406
+from . import m322
+import pkg9.pkg123.pkg1611.m1610
+from pkg5.pkg75.pkg984 import m983
+
+
+def helper_14910_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14910_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_14910_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,46 @@
+"""Module 37834."""
+import pkg11.pkg144.pkg1876.m18547
+from pkg2.pkg36 import m35
+from . import m19078
+from pkg5.pkg68.pkg893 import m892
+from . import m33666
+from pkg8.pkg105.pkg1374 import m20129
+import pkg6.pkg83.pkg1087.m36514
+from pkg11.pkg148.pkg1933 import m4016
+import pkg2.pkg37.pkg492.m10911
+from pkg11.pkg147.pkg1921 import m1920
+
+
+def helper_37834_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37834_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_37834_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_37834_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_37834_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,55 @@
+"""Module 44086."""
+import pkg7.pkg102.pkg1336.m9671
+from pkg3.pkg42.pkg552 import m4719
+import pkg7.pkg100.pkg1308.m5475
+from pkg3.pkg45.pkg592 import m4759
+import pkg11.pkg152.pkg1989.m1988
+from . import m4490
+import pkg8.pkg112.pkg1469.m5636
+from pkg1.pkg14.pkg195 import m14782
+import pkg3.pkg45.pkg589.m38100
+from pkg1 import m0
+import pkg10.pkg141.pkg1834.m16421
+from . import m19078
+
+
+def helper_44086_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_44086_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_44086_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_44086_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_44086_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_44086_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 16995."""
+import pkg9.pkg129.pkg1682.m5849
+from pkg4.pkg56.pkg741 import m740
+from . import m2407
+
+
+def helper_16995_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16995_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
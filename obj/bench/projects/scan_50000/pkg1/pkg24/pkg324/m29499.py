@@ -0,0 +1,46 @@
+"""Module 29499."""
+import pkg7.pkg100.pkg1302.m7553
+from pkg8.pkg110.pkg1434 import m11853
+import pkg1.pkg18.pkg244.m6495
+from pkg4.pkg60.pkg791 import m27882
+import pkg3.pkg42.pkg550.m2633
+from . import m16995
+import pkg2.pkg38.pkg506.m4673
+from pkg2.pkg27.pkg363 import m10782
+import pkg8.pkg117.pkg1528.m14031
+from pkg8.pkg112.pkg1457 import m1456
+
+
+def helper_29499_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_29499_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_29499_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_29499_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_29499_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
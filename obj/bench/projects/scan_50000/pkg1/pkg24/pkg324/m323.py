@@ -0,0 +1,48 @@
+"""Module 323."""
+import pkg1.pkg19.pkg259.m258
+from pkg1.pkg22 import m21
+import pkg1.pkg17.pkg227.m226
+from pkg1.pkg19 import m18
+import pkg3.pkg49.m48
+from pkg2.pkg27 import m26
+import pkg2.m1
+from pkg4 import m3
+import pkg4.pkg56.m55
+from pkg1.pkg17.pkg232 import m231
+import pkg1.pkg20.pkg263.m262
+from pkg11.pkg147 import m146
+
+
+def helper_323_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_323_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_323_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_323_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_323_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 46171."""
+import pkg8.pkg109.m27200
+from . import m16995
+import pkg2.pkg33.m32
+
+
+def helper_46171_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
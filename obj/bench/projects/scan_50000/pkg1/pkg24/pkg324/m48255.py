@@ -0,0 +1,20 @@
+"""Module 48255."""
+import pkg4.pkg61.pkg794.m793
+from pkg10.pkg140.pkg1832 import m26839
+import pkg11.pkg155.pkg2018.m10353
+from . import m29499
+import pkg2.pkg27.pkg354.m19109
+from pkg6.pkg87.pkg1132 import m26139
+import pkg5.pkg68.pkg888.m21727
+from pkg8.pkg111 import m110
+import pkg3.pkg43.pkg564.m46411
+from pkg6.pkg90.pkg1174 import m28265
+import pkg11.pkg148.pkg1925.m8176
+from pkg11.pkg148.pkg1928 import m1927
+
+
+def helper_48255_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
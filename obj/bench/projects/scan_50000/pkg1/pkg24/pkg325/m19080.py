@@ -0,0 +1,32 @@
+"""Module 19080."""
+from . import m6576
+from pkg1.pkg18.pkg239 import m238
+import pkg3.m2
+from pkg5.pkg75.pkg976 import m13479
+import pkg9.pkg122.pkg1596.m5763
+from pkg8.pkg108.pkg1414 import m1413
+import pkg10.pkg134.pkg1747.m1746
+from pkg1.pkg18 import m2101
+import pkg7.pkg100.pkg1308.m5475
+from pkg1.pkg23.pkg305 import m2388
+
+
+def helper_19080_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_19080_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_19080_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,28 @@
+"""Module 23248."""
+import pkg8.pkg112.pkg1462.m7713
+from pkg3.pkg47.pkg620 import m2703
+import pkg10.pkg132.pkg1721.m1720
+from pkg6.pkg81.pkg1058 import m1057
+import pkg1.pkg22.m21
+from pkg1.pkg26.pkg348 import m8683
+
+
+def helper_23248_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_23248_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_23248_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
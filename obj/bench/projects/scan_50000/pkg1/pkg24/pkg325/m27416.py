@@ -0,0 +1,6 @@
+"""Module 27416."""
+import pkg6.pkg89.pkg1170.m7421
+from pkg1.pkg16.pkg219 import m218
+import pkg13.pkg179.m178
+from pkg3.pkg47.pkg618 import m617
+import pkg3.pkg40.pkg528.m2611
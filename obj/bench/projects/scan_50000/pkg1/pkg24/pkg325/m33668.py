@@ -0,0 +1,47 @@
+"""Module 33668."""
+from . import m27416
+from . import m19080
+import pkg8.pkg109.pkg1421.m9756
+from pkg10.pkg135.pkg1768 import m24691
+import pkg6.pkg86.m85
+from pkg2.pkg38.pkg495 import m4662
+import pkg7.pkg97.pkg1273.m32532
+from pkg6.pkg90 import m89
+import pkg11.pkg148.pkg1933.m4016
+from pkg1.pkg18.pkg237 import m10656
+import pkg1.pkg19.pkg251.m250
+
+
+def helper_33668_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_33668_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_33668_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_33668_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_33668_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
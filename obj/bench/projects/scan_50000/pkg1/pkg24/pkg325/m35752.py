@@ -0,0 +1,40 @@
+"""Module 35752."""
+import pkg6.pkg91.m90
+from pkg11 import m10
+import pkg6.pkg89.pkg1161.m1160
+from pkg3.pkg52.pkg681 import m680
+import pkg3.pkg41.pkg536.m8871
+from pkg12.pkg158 import m157
+import pkg1.pkg22.pkg289.m288
+from pkg12.pkg158.pkg2057 import m2056
+import pkg9.pkg130.pkg1692.m1691
+from pkg3.pkg48.pkg636 import m17307
+import pkg1.pkg18.pkg239.m238
+
+
+def helper_35752_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35752_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_35752_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_35752_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
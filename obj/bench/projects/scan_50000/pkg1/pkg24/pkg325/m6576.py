@@ -0,0 +1,32 @@
+"""Module 6576."""
+import pkg2.pkg37.pkg489.m4656
+from pkg2.pkg30 import m29
+from . import m4492
+from pkg6.pkg87.pkg1141 import m5308
+import pkg3.pkg44.pkg575.m574
+from . import m324
+import pkg9.pkg130.m6381
+from pkg3.pkg52.pkg680 import m2763
+import pkg12.pkg157.pkg2050.m6217
+from pkg4 import m3
+
+
+def helper_6576_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6576_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6576_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,15 @@
+"""Module 22948."""
+import pkg10.pkg131.pkg1716.m18387
+from pkg11.pkg149.pkg1940 import m22779
+import pkg2.pkg33.pkg442.m4609
+from . import m14612
+import pkg4.pkg53.m52
+from pkg12.pkg157 import m156
+import pkg4.pkg64.pkg841.m9176
+
+
+def helper_22948_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
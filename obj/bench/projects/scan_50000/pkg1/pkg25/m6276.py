@@ -0,0 +1,69 @@
+"""Module 6276."""
+import pkg1.pkg24.pkg314.m313
+from pkg11.pkg153.pkg1994 import m4077
+import pkg3.pkg44.pkg584.m583
+from pkg2.pkg37.pkg489 import m4656
+import pkg8.pkg113.m112
+from pkg11.pkg149.pkg1947 import m1946
+import pkg1.pkg24.pkg316.m315
+from pkg4.pkg53.pkg701 import m2784
+import pkg1.m0
+from pkg7.pkg100.pkg1311 import m5478
+import pkg4.pkg65.pkg852.m851
+from pkg10.pkg136.pkg1773 import m5940
+
+
+def helper_6276_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6276_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6276_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6276_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_6276_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_6276_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6276_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6276_42(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 21165."""
+import pkg10.pkg139.pkg1810.m3893
+from pkg10.pkg138.pkg1798 import m1797
+import pkg9.pkg124.pkg1615.m18286
+from pkg3.pkg47.pkg621 import m620
+import pkg2.pkg30.m29
+from pkg8.pkg116.pkg1511 import m1510
+import pkg9.pkg127.pkg1658.m1657
+from pkg10.pkg138 import m16809
+import pkg1.pkg21.pkg278.m277
+from pkg9 import m8
+import pkg4.pkg64.pkg844.m843
+from pkg7.pkg99.pkg1291 import m1290
+
+
+def helper_21165_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_21165_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
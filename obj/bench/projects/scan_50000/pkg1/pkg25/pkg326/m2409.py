@@ -0,0 +1,20 @@
+"""Module 2409."""
+from . import m325
+from pkg10.pkg135.pkg1766 import m1765
+import pkg4.m3
+from pkg3 import m2
+import pkg11.pkg155.m154
+
+
+def helper_2409_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2409_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
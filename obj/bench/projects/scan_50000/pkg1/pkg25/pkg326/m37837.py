@@ -0,0 +1,34 @@
+"""Module 37837."""
+import pkg7.pkg97.m35524
+from pkg1.pkg20.pkg267 import m6518
+import pkg1.pkg15.pkg208.m207
+from pkg4.pkg57.pkg747 import m15334
+import pkg1.pkg20.pkg268.m16939
+from pkg11.pkg147.pkg1922 import m18593
+from . import m14913
+from pkg3 import m2
+import pkg5.pkg66.pkg865.m11284
+from pkg3.pkg45.pkg588 import m11007
+import pkg10.pkg133.pkg1730.m28821
+from pkg4.pkg57.pkg753 import m25760
+
+
+def helper_37837_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37837_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_37837_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
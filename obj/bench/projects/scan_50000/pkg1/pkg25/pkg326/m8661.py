@@ -0,0 +1,20 @@
+"""Module 8661."""
+import pkg13.pkg174.m6425
+from pkg10.pkg134 import m133
+import pkg7.pkg100.pkg1313.m3396
+from pkg6 import m5
+import pkg5.pkg69.pkg904.m903
+
+
+def helper_8661_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8661_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 19082."""
+import pkg1.pkg23.pkg312.m12815
+from pkg1.pkg17.pkg230 import m229
+
+
+def helper_19082_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_19082_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,34 @@
+"""Module 35754."""
+import pkg2.pkg27.m26
+from pkg7.pkg104.pkg1362 import m9697
+import pkg3.pkg45.pkg589.m27680
+from pkg8 import m7
+import pkg7.pkg97.pkg1273.m3356
+from pkg4.pkg59.pkg771 import m7022
+import pkg1.pkg16.pkg217.m216
+from pkg11.pkg147.pkg1924 import m4007
+import pkg9.pkg118.pkg1541.m22380
+from pkg1.pkg23.pkg309 import m12812
+import pkg12.pkg163.m35590
+from pkg7.pkg101 import m100
+
+
+def helper_35754_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35754_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_35754_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
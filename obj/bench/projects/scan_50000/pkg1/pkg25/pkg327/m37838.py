@@ -0,0 +1,38 @@
+"""Module 37838."""
+import pkg4.pkg61.pkg796.m25803
+from . import m14914
+import pkg6.pkg88.m87
+from pkg10.pkg135.pkg1768 import m26775
+import pkg4.pkg64.pkg835.m834
+from pkg10.pkg139.pkg1812 import m3895
+import pkg2.pkg33.pkg441.m440
+from pkg1.pkg21.pkg283 import m2366
+import pkg2.pkg28.m27
+
+
+def helper_37838_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37838_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_37838_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_37838_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,3 @@
+"""Module 25335."""
+import pkg10.pkg136.m135
+from pkg3 import m2
@@ -0,0 +1,32 @@
+"""Module 27419."""
+import pkg6.pkg84.m2167
+from . import m327
+import pkg3.pkg40.m39
+from . import m6579
+import pkg7.pkg102.pkg1328.m17999
+from pkg3.pkg49.pkg644 import m6895
+import pkg5.pkg74.pkg966.m21805
+from pkg1.pkg25 import m24
+import pkg10.pkg138.pkg1807.m1806
+from pkg2 import m1
+
+
+def helper_27419_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_27419_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_27419_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,55 @@
+"""Module 29503."""
+import pkg3.pkg42.pkg557.m27648
+from pkg2.pkg35.pkg467 import m466
+import pkg1.pkg17.pkg230.m229
+from pkg5.pkg68.pkg888 import m7139
+from . import m327
+from . import m27419
+import pkg1.pkg21.pkg281.m4448
+from pkg5.pkg75.pkg987 import m986
+import pkg7.pkg104.pkg1360.m5527
+from . import m2411
+import pkg1.m0
+from pkg2 import m1
+
+
+def helper_29503_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_29503_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_29503_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_29503_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_29503_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_29503_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 17000."""
+import pkg7.pkg92.pkg1209.m3292
+from pkg11.pkg151.pkg1965 import m14468
+import pkg3.pkg48.pkg634.m633
+from pkg8.pkg110.pkg1431 import m13934
+import pkg2.pkg37.pkg488.m10907
+from pkg4.pkg57.pkg751 import m2834
+import pkg11.pkg145.pkg1895.m3978
+from pkg5.pkg66.pkg862 import m11281
+import pkg11.pkg152.pkg1979.m10314
+from pkg12.pkg159.pkg2072 import m14575
+
+
+def helper_17000_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_17000_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
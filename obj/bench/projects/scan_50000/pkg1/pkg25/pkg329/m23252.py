@@ -0,0 +1,18 @@
+"""Module 23252."""
+import pkg10.pkg136.pkg1775.m5942
+from . import m4496
+import pkg11.pkg154.pkg2003.m14506
+
+
+def helper_23252_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_23252_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
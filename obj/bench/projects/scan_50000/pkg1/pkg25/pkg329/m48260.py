@@ -0,0 +1,53 @@
+"""Module 48260."""
+import pkg8.pkg110.pkg1439.m16026
+from pkg5.pkg76 import m75
+import pkg4.pkg55.pkg719.m6970
+from pkg8.pkg115.pkg1504 import m16091
+import pkg6.pkg84.pkg1097.m19852
+from pkg5.pkg74.pkg963 import m11382
+from . import m17000
+from pkg10.pkg142.pkg1848 import m6015
+import pkg11.pkg151.pkg1976.m4059
+from pkg4.pkg63.pkg822 import m821
+
+
+def helper_48260_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_48260_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_48260_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_48260_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_48260_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_48260_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,54 @@
+"""Module 6580."""
+from . import m328
+from pkg10 import m9
+import pkg1.pkg25.m24
+from . import m4496
+import pkg11.pkg147.pkg1924.m1923
+from pkg1 import m0
+import pkg6.pkg85.pkg1108.m1107
+from pkg6.pkg79.pkg1031 import m1030
+import pkg7.pkg103.pkg1351.m1350
+from pkg3.pkg46.pkg609 import m608
+import pkg4.pkg61.pkg802.m801
+
+
+def helper_6580_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6580_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6580_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6580_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_6580_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_6580_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
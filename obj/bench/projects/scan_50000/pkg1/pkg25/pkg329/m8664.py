@@ -0,0 +1,9 @@
+"""Module 8664."""
+import pkg6.pkg90.m89
+
+
+def helper_8664_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,53 @@
+"""Module 31589."""
+import pkg8.pkg112.pkg1469.m9804
+from pkg2 import m1
+from . import m17001
+from . import m10749
+import pkg3.pkg48.pkg627.m626
+from pkg5.pkg77.pkg1014 import m19769
+import pkg8.pkg112.pkg1467.m13970
+from pkg1.pkg24.pkg315 import m314
+import pkg3.pkg51.pkg675.m674
+from . import m23253
+
+
+def helper_31589_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_31589_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_31589_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_31589_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_31589_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_31589_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,29 @@
+"""Module 329."""
+import pkg1.pkg18.pkg240.m239
+from pkg1 import m0
+import pkg3.pkg43.m42
+from pkg1.pkg15.pkg206 import m205
+import pkg1.pkg20.m19
+from pkg4.pkg56 import m55
+import pkg6.pkg83.m82
+
+
+def helper_329_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_329_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_329_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
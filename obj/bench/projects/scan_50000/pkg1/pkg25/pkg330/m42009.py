@@ -0,0 +1,18 @@
+"""Module 42009."""
+import pkg6.pkg83.pkg1092.m5259
+from pkg11.pkg149.pkg1938 import m26945
+import pkg4.pkg62.pkg811.m34154
+
+
+def helper_42009_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_42009_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
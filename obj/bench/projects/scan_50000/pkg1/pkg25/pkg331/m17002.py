@@ -0,0 +1,44 @@
+"""Module 17002."""
+import pkg7.pkg100.pkg1305.m1304
+from pkg1 import m0
+import pkg4.pkg56.pkg730.m729
+from . import m2414
+import pkg7.pkg92.pkg1201.m3284
+from pkg9.pkg125.pkg1638 import m5805
+from . import m10750
+from pkg2.pkg30.pkg396 import m2479
+
+
+def helper_17002_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_17002_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_17002_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_17002_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_17002_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,47 @@
+"""Module 23254."""
+from . import m12834
+from pkg4.pkg56 import m55
+from . import m4498
+from pkg8.pkg115 import m20954
+import pkg9.pkg128.pkg1668.m5835
+from pkg6.pkg84.pkg1105 import m5272
+import pkg1.pkg23.pkg306.m305
+from pkg1.pkg21.pkg280 import m2363
+import pkg3.pkg49.pkg640.m17311
+from pkg11.pkg149.pkg1950 import m4033
+import pkg3.pkg46.pkg610.m609
+
+
+def helper_23254_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_23254_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_23254_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_23254_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_23254_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,46 @@
+"""Module 2414."""
+import pkg4.pkg57.pkg745.m744
+from pkg3.pkg46.pkg602 import m601
+import pkg2.pkg34.pkg453.m452
+from pkg11.pkg147.pkg1918 import m1917
+import pkg9.pkg120.pkg1571.m1570
+from pkg11.pkg147 import m146
+import pkg1.pkg16.pkg218.m217
+from . import m330
+import pkg1.pkg23.m22
+from pkg2.pkg35.pkg459 import m458
+
+
+def helper_2414_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2414_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2414_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2414_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_2414_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,22 @@
+"""Module 10751."""
+import pkg3.pkg47.pkg619.m6870
+from . import m331
+import pkg2.pkg35.m34
+from pkg11.pkg155.pkg2028 import m2027
+import pkg2.pkg37.pkg494.m493
+from pkg10.pkg142.pkg1856 import m1855
+import pkg1.pkg18.m17
+
+
+def helper_10751_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10751_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
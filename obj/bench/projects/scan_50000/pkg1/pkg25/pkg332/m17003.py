@@ -0,0 +1,47 @@
+"""Module 17003."""
+from . import m6583
+from pkg5.pkg67.pkg883 import m882
+import pkg4.pkg59.pkg769.m4936
+from pkg1 import m0
+import pkg5.pkg76.pkg999.m15586
+from pkg6.pkg84.pkg1097 import m5264
+import pkg2.pkg39.pkg516.m515
+from pkg9.pkg123.pkg1607 import m1606
+import pkg11.pkg156.pkg2037.m2036
+from . import m331
+import pkg8.pkg112.m4279
+
+
+def helper_17003_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_17003_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_17003_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_17003_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_17003_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
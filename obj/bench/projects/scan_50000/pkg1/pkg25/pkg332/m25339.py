@@ -0,0 +1,40 @@
+"""Module 25339."""
+import pkg13.pkg180.m4347
+from pkg1.pkg23 import m22
+import pkg8.pkg108.m20947
+from pkg10.pkg132.pkg1726 import m1725
+import pkg9.m8
+from pkg12.pkg162 import m8497
+from . import m4499
+from . import m23255
+import pkg1.pkg16.pkg212.m211
+from pkg7.pkg93.pkg1212 import m1211
+import pkg11.pkg145.pkg1893.m20648
+
+
+def helper_25339_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_25339_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_25339_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_25339_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,44 @@
+"""Module 31591."""
+import pkg10.pkg135.pkg1765.m24688
+from pkg1.pkg17.pkg227 import m226
+import pkg1.pkg16.m15
+from pkg5.pkg78.pkg1015 import m7266
+from . import m8667
+from . import m17003
+import pkg3.pkg40.pkg533.m532
+from . import m10751
+
+
+def helper_31591_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_31591_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_31591_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_31591_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_31591_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,46 @@
+"""Module 39927."""
+import pkg4.pkg57.pkg744.m743
+from pkg11.pkg148.pkg1925 import m10260
+import pkg6.pkg88.pkg1155.m11574
+from . import m33675
+import pkg3.pkg45.pkg589.m2672
+from pkg11.pkg156.pkg2035 import m35378
+import pkg3.pkg41.m40
+from pkg12.pkg167 import m166
+import pkg7.pkg92.pkg1209.m30384
+from pkg6.pkg81.pkg1063 import m11482
+
+
+def helper_39927_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39927_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_39927_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_39927_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_39927_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,4 @@
+"""Module 42011."""
+import pkg1.pkg18.pkg245.m4412
+from pkg4.pkg64.pkg839 import m2922
+import pkg4.pkg57.pkg747.m21586
@@ -0,0 +1,40 @@
+"""Module 44095."""
+import pkg12.pkg160.m159
+from pkg5.pkg69.pkg910 import m9245
+from . import m27423
+from pkg9.pkg124.pkg1618 import m39129
+import pkg7.pkg92.m12595
+from pkg11.pkg156.pkg2038 import m18709
+import pkg1.m0
+from pkg1.pkg22.pkg297 import m14884
+import pkg8.pkg110.pkg1440.m34783
+from . import m4499
+from . import m17003
+
+
+def helper_44095_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_44095_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_44095_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_44095_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
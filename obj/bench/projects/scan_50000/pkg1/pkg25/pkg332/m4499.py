@@ -0,0 +1,20 @@
+"""Module 4499."""
+import pkg4.pkg65.pkg852.m851
+from pkg6.pkg91 import m90
+import pkg12.pkg164.m163
+from pkg6.pkg86 import m85
+import pkg9.m8
+
+
+def helper_4499_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4499_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
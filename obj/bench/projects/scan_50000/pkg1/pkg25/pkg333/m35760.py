@@ -0,0 +1,37 @@
+"""Module 35760."""
+import pkg4.pkg55.pkg718.m4885
+from pkg8.pkg117.pkg1531 import m3614
+import pkg4.pkg53.pkg691.m690
+from pkg2.pkg30 import m29
+import pkg4.pkg57.pkg754.m753
+from pkg3.pkg52.pkg686 import m13189
+from . import m8668
+from pkg10.pkg132.pkg1722 import m7973
+
+
+def helper_35760_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35760_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_35760_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_35760_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 44096."""
+import pkg1.pkg17.pkg231.m31490
+from pkg2.pkg28.pkg374 import m19129
+from . import m25340
+from pkg1.pkg17.pkg230 import m229
+
+
+def helper_44096_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_44096_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
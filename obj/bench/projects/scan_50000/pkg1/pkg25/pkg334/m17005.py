@@ -0,0 +1,41 @@
+"""Module 17005."""
+import pkg11.pkg149.m148
+from pkg6.pkg89.pkg1168 import m7419
+import pkg7.pkg102.pkg1328.m1327
+from pkg4.pkg53.pkg697 import m9032
+import pkg4.pkg57.pkg754.m753
+from pkg3.pkg41.pkg541 import m4708
+import pkg1.m0
+from pkg3.pkg51.pkg669 import m668
+import pkg5.pkg78.pkg1020.m1019
+from pkg3.pkg47.pkg619 import m618
+import pkg9.pkg128.pkg1672.m1671
+from pkg7.pkg97.pkg1274 import m15861
+
+
+def helper_17005_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_17005_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_17005_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_17005_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,37 @@
+"""Module 19089."""
+import pkg4.pkg54.pkg708.m6959
+from pkg8.pkg113.pkg1480 import m5647
+import pkg11.pkg149.m148
+from pkg1.pkg20 import m19
+import pkg9.pkg127.pkg1653.m9988
+from pkg1 import m0
+import pkg6.pkg90.m8425
+from pkg9.pkg124.pkg1625 import m1624
+
+
+def helper_19089_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_19089_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_19089_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_19089_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
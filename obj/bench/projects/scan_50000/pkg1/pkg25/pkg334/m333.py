@@ -0,0 +1,12 @@
+"""Module 333."""
+import pkg7.pkg99.m98
+from pkg2.pkg35 import m34
+import pkg1.pkg22.pkg298.m297
+from pkg9.pkg118 import m117
+
+
+def helper_333_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,46 @@
+"""Module 37845."""
+import pkg6.pkg89.pkg1164.m1163
+from . import m8669
+from . import m35761
+from . import m27425
+import pkg4.pkg64.pkg843.m23766
+from pkg10.pkg139.pkg1820 import m3903
+import pkg3.pkg42.pkg555.m6806
+from . import m21173
+import pkg4.pkg56.pkg729.m6980
+from pkg11.pkg144.pkg1885 import m6052
+
+
+def helper_37845_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37845_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_37845_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_37845_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_37845_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 42013."""
+import pkg9.pkg123.pkg1604.m28695
+from pkg1.pkg26.pkg341 import m19096
+import pkg3.pkg50.pkg662.m15249
+
+
+def helper_42013_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_42013_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_42013_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
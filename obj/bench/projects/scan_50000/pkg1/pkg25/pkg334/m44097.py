@@ -0,0 +1,30 @@
+"""Module 44097."""
+import pkg3.pkg49.pkg649.m4816
+from pkg10.pkg133.pkg1739 import m1738
+import pkg7.pkg94.pkg1234.m42913
+from pkg1 import m0
+import pkg2.pkg37.pkg494.m10913
+from pkg4.pkg57.pkg745 import m13248
+import pkg9.pkg123.pkg1605.m34948
+from . import m333
+
+
+def helper_44097_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_44097_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_44097_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
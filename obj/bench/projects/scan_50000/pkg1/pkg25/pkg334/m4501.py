@@ -0,0 +1,46 @@
+"""Module 4501."""
+import pkg1.pkg23.m22
+from . import m2417
+import pkg11.pkg153.pkg1997.m1996
+from pkg3.pkg51 import m50
+import pkg4.m3
+from pkg3.pkg46.pkg610 import m609
+import pkg10.m9
+from pkg1.pkg17 import m16
+import pkg1.pkg16.pkg213.m212
+from pkg2.pkg35.pkg468 import m467
+
+
+def helper_4501_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4501_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4501_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_4501_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_4501_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,38 @@
+"""Module 48265."""
+import pkg12.pkg159.m8494
+from pkg6.pkg88 import m37599
+import pkg10.pkg133.pkg1737.m1736
+from pkg8.pkg117.pkg1526 import m1525
+from . import m10753
+from . import m19089
+import pkg5.pkg75.pkg988.m11407
+from pkg10.pkg139.pkg1816 import m1815
+import pkg1.pkg19.m6270
+
+
+def helper_48265_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_48265_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_48265_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_48265_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,21 @@
+"""Module 17006."""
+from . import m6586
+from pkg9.pkg128 import m127
+from . import m10754
+from pkg2.pkg35.pkg461 import m460
+import pkg8.pkg111.pkg1456.m7707
+from pkg1.pkg16 import m15
+
+
+def helper_17006_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_17006_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,31 @@
+"""Module 2418."""
+from . import m334
+from pkg6.pkg85 import m84
+import pkg4.pkg59.m58
+from pkg3.pkg45 import m44
+import pkg8.pkg107.m106
+from pkg6.pkg81 import m80
+import pkg9.pkg118.pkg1539.m1538
+from pkg3.pkg45.pkg595 import m594
+import pkg5.pkg77.m76
+
+
+def helper_2418_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2418_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2418_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,34 @@
+"""Module 29510."""
+import pkg12.pkg159.pkg2076.m16663
+from pkg10.pkg140.pkg1822 import m1821
+import pkg2.pkg28.m27
+from pkg10.pkg138.pkg1807 import m1806
+import pkg3.pkg43.pkg569.m8904
+
+
+def helper_29510_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_29510_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_29510_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_29510_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 31594."""
+import pkg10.pkg140.pkg1831.m26838
+from pkg9.pkg118.pkg1539 import m3622
+import pkg6.pkg89.pkg1165.m1164
+from . import m10754
+from . import m14922
+from pkg7.pkg99.pkg1292 import m13795
+import pkg3.pkg44.pkg582.m2665
+from pkg7.pkg92.pkg1197 import m5364
+import pkg10.pkg136.pkg1776.m10111
+from pkg6.pkg84.pkg1103 import m1102
+
+
+def helper_31594_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
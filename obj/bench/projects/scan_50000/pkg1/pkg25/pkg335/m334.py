@@ -0,0 +1,37 @@
+"""Module 334."""
+import pkg2.pkg31.m30
+from pkg2 import m1
+import pkg4.pkg58.m57
+from pkg7.pkg94 import m93
+import pkg9.pkg124.m123
+from pkg6.pkg81 import m80
+import pkg2.pkg35.m34
+from pkg8.pkg105 import m104
+
+
+def helper_334_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_334_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_334_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_334_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,69 @@
+"""Module 37846."""
+import pkg8.pkg116.pkg1518.m1517
+from pkg11.pkg146 import m145
+import pkg2.pkg39.pkg515.m23438
+from pkg11.pkg151.pkg1969 import m10304
+import pkg5.pkg75.pkg986.m985
+from pkg7.pkg102.pkg1337 import m22176
+import pkg4.pkg64.pkg834.m17505
+from pkg4.pkg59.pkg779 import m29954
+import pkg11.pkg145.pkg1893.m1892
+from . import m334
+import pkg5.pkg69.pkg899.m898
+from pkg2.pkg28.pkg368 import m367
+
+
+def helper_37846_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37846_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_37846_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_37846_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_37846_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_37846_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37846_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_37846_42(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
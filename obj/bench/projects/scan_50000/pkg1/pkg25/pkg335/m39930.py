@@ -0,0 +1,62 @@
+"""Module 39930."""
+import pkg2.pkg30.pkg403.m8738
+from pkg2.pkg38 import m12541
+import pkg10.pkg141.pkg1835.m1834
+from pkg1.pkg26 import m14613
+import pkg1.pkg26.pkg350.m8685
+from pkg1 import m0
+import pkg5.pkg75.pkg986.m17657
+from pkg6.pkg89.pkg1159 import m1158
+import pkg5.pkg67.pkg880.m2963
+from pkg6.pkg85.pkg1113 import m5280
+import pkg7.pkg93.pkg1215.m13718
+from pkg10.pkg132.pkg1726 import m5893
+
+
+def helper_39930_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39930_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_39930_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_39930_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_39930_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_39930_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39930_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
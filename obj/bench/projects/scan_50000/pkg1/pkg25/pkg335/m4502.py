@@ -0,0 +1,34 @@
+"""Module 4502."""
+import pkg3.pkg42.pkg552.m2635
+from pkg1.pkg22 import m21
+from . import m334
+from pkg1.pkg17.pkg234 import m233
+import pkg4.pkg57.pkg747.m746
+from pkg2 import m1
+from . import m2418
+from pkg11.pkg152 import m2235
+import pkg2.pkg28.m27
+from pkg8.pkg107 import m106
+import pkg2.pkg35.pkg456.m455
+from pkg2.pkg36.pkg474 import m473
+
+
+def helper_4502_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4502_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_4502_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
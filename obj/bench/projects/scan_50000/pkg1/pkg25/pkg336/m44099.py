@@ -0,0 +1,15 @@
+"""Module 44099."""
+import pkg4.pkg54.pkg715.m4882
+from pkg5.pkg69.pkg909 import m908
+import pkg9.pkg118.pkg1539.m30714
+from . import m2419
+from . import m4503
+from pkg1.pkg24.pkg317 import m21156
+import pkg7.pkg96.pkg1256.m1255
+
+
+def helper_44099_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,12 @@
+"""Module 46183."""
+import pkg4.pkg54.pkg706.m17377
+from pkg9.pkg128.pkg1674 import m1673
+from . import m33679
+from pkg5.pkg69.pkg905 import m7156
+
+
+def helper_46183_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
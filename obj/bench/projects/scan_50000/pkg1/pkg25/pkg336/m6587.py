@@ -0,0 +1,40 @@
+"""Module 6587."""
+from . import m335
+from . import m2419
+import pkg1.pkg19.pkg251.m2334
+from pkg7.pkg99 import m98
+import pkg7.pkg101.pkg1320.m3403
+from pkg4.pkg61.pkg794 import m793
+import pkg11.pkg145.pkg1893.m3976
+from pkg12.pkg161 import m160
+import pkg1.pkg21.pkg279.m278
+from . import m4503
+import pkg1.pkg24.pkg316.m315
+
+
+def helper_6587_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6587_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6587_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6587_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
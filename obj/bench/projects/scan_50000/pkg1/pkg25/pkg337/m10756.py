@@ -0,0 +1,62 @@
+"""Module 10756."""
+import pkg4.pkg64.pkg844.m5011
+from pkg6.pkg84.pkg1098 import m7349
+import pkg1.pkg25.pkg334.m8669
+from pkg10.pkg140.pkg1824 import m3907
+import pkg2.pkg34.pkg454.m4621
+from pkg6.pkg79 import m78
+import pkg5.pkg76.pkg990.m989
+from pkg2.pkg35 import m34
+import pkg11.pkg151.pkg1972.m6139
+from pkg4.pkg65.pkg853 import m2936
+from . import m2420
+from pkg7.pkg96.pkg1256 import m1255
+
+
+def helper_10756_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10756_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_10756_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_10756_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_10756_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_10756_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10756_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,15 @@
+"""Module 19092."""
+import pkg4.pkg56.pkg734.m4901
+from pkg3.pkg42.pkg557 import m6808
+import pkg10.pkg134.pkg1743.m3826
+from . import m10756
+import pkg1.pkg25.pkg331.m330
+from pkg5.pkg68.pkg897 import m13400
+from . import m336
+
+
+def helper_19092_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
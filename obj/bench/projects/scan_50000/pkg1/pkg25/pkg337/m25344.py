@@ -0,0 +1,40 @@
+"""Module 25344."""
+from . import m19092
+from . import m8672
+import pkg1.pkg19.pkg249.m2332
+from . import m17008
+import pkg9.pkg122.pkg1589.m18260
+from pkg9.pkg126 import m125
+import pkg12.pkg162.m2245
+from pkg4.pkg55.pkg720 import m19475
+import pkg11.pkg146.pkg1906.m6073
+from pkg1.pkg22.pkg298 import m21137
+import pkg4.pkg62.m12565
+
+
+def helper_25344_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_25344_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_25344_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_25344_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,47 @@
+"""Module 29512."""
+import pkg11.pkg149.pkg1950.m16537
+from pkg7.pkg98 import m97
+import pkg3.pkg45.pkg595.m11014
+from . import m12840
+import pkg1.pkg20.pkg264.m6515
+from pkg2 import m1
+import pkg7.pkg100.pkg1311.m1310
+from pkg3.pkg51.pkg669 import m4836
+import pkg8.pkg114.m113
+from . import m21176
+import pkg1.pkg22.pkg287.m286
+
+
+def helper_29512_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_29512_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_29512_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_29512_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_29512_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
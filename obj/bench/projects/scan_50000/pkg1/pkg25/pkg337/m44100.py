@@ -0,0 +1,36 @@
+"""Module 44100."""
+import pkg1.pkg17.pkg228.m2311
+from pkg1 import m0
+import pkg2.pkg36.m2119
+from pkg5.pkg67 import m4234
+import pkg6.pkg84.m2167
+from . import m21176
+from . import m10756
+
+
+def helper_44100_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_44100_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_44100_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_44100_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
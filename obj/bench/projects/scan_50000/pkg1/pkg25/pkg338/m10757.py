@@ -0,0 +1,33 @@
+"""Module 10757."""
+import pkg1.pkg25.pkg336.m335
+from . import m2421
+import pkg2.pkg34.m33
+from pkg7.pkg98.pkg1280 import m1279
+import pkg6.pkg87.pkg1136.m1135
+from pkg5.pkg72.pkg944 import m943
+import pkg7.pkg94.pkg1223.m1222
+from . import m8673
+import pkg6.m5
+from pkg2.pkg32.pkg420 import m419
+import pkg12.pkg165.m10584
+
+
+def helper_10757_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10757_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_10757_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 33681."""
+from . import m4505
+from pkg6.pkg88.pkg1154 import m9489
+import pkg6.pkg85.pkg1113.m7364
+from pkg4.pkg61.pkg798 import m797
+from . import m31597
+from pkg1.pkg16.pkg210 import m16881
+from . import m29513
+from pkg8.pkg115.pkg1508 import m7759
+import pkg6.pkg86.pkg1120.m1119
+from pkg1 import m0
@@ -0,0 +1,19 @@
+"""Module 12529."""
+import pkg2.pkg32.pkg417.m416
+from pkg9.pkg125 import m124
+import pkg5.pkg70.pkg919.m9254
+from pkg5 import m4
+from . import m10445
+from pkg2.pkg34.pkg452 import m4619
+import pkg9.pkg121.pkg1585.m7836
+from pkg5.pkg71 import m4238
+import pkg4.pkg61.m60
+from pkg9.pkg130 import m129
+import pkg7.pkg96.pkg1249.m1248
+
+
+def helper_12529_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
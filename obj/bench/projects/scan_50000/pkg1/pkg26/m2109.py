@@ -0,0 +1,21 @@
+"""Module 2109."""
+import pkg1.pkg14.pkg192.m191
+from pkg2.pkg38.pkg507 import m506
+import pkg10.pkg134.pkg1748.m1747
+from pkg1 import m0
+import pkg6.pkg85.m84
+from pkg10.pkg134.pkg1743 import m1742
+
+
+def helper_2109_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2109_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,22 @@
+"""Module 25033."""
+import pkg1.m25008
+from . import m4193
+import pkg3.m2
+from pkg1.pkg15 import m10434
+import pkg10.pkg132.pkg1727.m10062
+from . import m14613
+import pkg8.pkg107.pkg1392.m1391
+
+
+def helper_25033_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_25033_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 29201."""
+import pkg2.pkg31.pkg416.m415
+from pkg2.pkg38.pkg501 import m2584
+import pkg9.pkg125.pkg1635.m14138
+from . import m10445
+
+
+def helper_29201_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_29201_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_29201_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
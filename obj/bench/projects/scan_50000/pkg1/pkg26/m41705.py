@@ -0,0 +1,11 @@
+"""Module 41705."""
+from . import m4193
+from pkg7.pkg103.pkg1348 import m11767
+from . import m10445
+
+
+def helper_41705_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
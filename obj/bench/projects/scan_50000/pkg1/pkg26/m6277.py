@@ -0,0 +1,45 @@
+"""Module 6277."""
+import pkg7.pkg104.pkg1353.m5520
+from pkg10.pkg134.pkg1747 import m5914
+import pkg4.pkg56.pkg739.m738
+from pkg1 import m0
+import pkg8.pkg113.pkg1481.m1480
+from pkg1.pkg15 import m14
+import pkg7.pkg97.pkg1266.m3349
+from pkg10.pkg134.pkg1752 import m5919
+import pkg8.pkg117.pkg1528.m1527
+
+
+def helper_6277_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6277_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6277_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6277_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_6277_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,54 @@
+"""Module 19094."""
+import pkg2.pkg37.pkg490.m8825
+from pkg3.pkg51.pkg670 import m669
+import pkg12.pkg165.m164
+from pkg4.pkg62.pkg818 import m4985
+import pkg3.pkg46.m45
+from pkg7.pkg96.pkg1251 import m9586
+import pkg6.pkg79.pkg1029.m7280
+from pkg5.pkg75.pkg977 import m11396
+import pkg7.pkg95.pkg1247.m1246
+from pkg2 import m1
+import pkg1.pkg14.pkg184.m183
+
+
+def helper_19094_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_19094_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_19094_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_19094_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_19094_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_19094_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,61 @@
+"""Module 25346."""
+import pkg11.pkg146.pkg1901.m14404
+from pkg1.pkg25.pkg330 import m329
+import pkg5.pkg66.pkg867.m21706
+from pkg2.pkg38.pkg501 import m8836
+import pkg1.pkg21.pkg281.m280
+from pkg4.pkg61.pkg805 import m17476
+from . import m338
+from pkg10.pkg141.pkg1842 import m1841
+import pkg1.pkg14.pkg185.m8520
+from . import m4506
+from . import m14926
+
+
+def helper_25346_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_25346_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_25346_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_25346_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_25346_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_25346_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_25346_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
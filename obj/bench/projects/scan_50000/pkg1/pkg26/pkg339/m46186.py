@@ -0,0 +1,21 @@
+"""Module 46186."""
+import pkg9.pkg124.pkg1623.m1622
+from pkg11.pkg146.pkg1902 import m12321
+import pkg9.pkg128.pkg1665.m22504
+from pkg9.pkg126 import m29301
+from . import m33682
+from pkg2.pkg29.pkg387 import m21226
+
+
+def helper_46186_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_46186_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,48 @@
+"""Module 48270."""
+from . import m35766
+from pkg6.pkg90.pkg1175 import m1174
+import pkg4.pkg63.pkg821.m19576
+from pkg2.pkg37 import m36
+import pkg1.pkg22.pkg297.m6548
+from pkg5.pkg69.pkg908 import m17579
+from . import m10758
+from pkg12.pkg160.pkg2081 import m45844
+import pkg2.pkg27.pkg353.m6604
+from pkg10.pkg132.pkg1725 import m7976
+from . import m4506
+from pkg11.pkg151 import m4318
+
+
+def helper_48270_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_48270_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_48270_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_48270_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_48270_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
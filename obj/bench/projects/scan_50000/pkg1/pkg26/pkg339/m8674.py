@@ -0,0 +1,16 @@
+"""Module 8674."""
+import pkg2.pkg33.m32
+from . import m6590
+import pkg1.m0
+from pkg2.pkg36.pkg470 import m4637
+import pkg5.pkg71.pkg928.m3011
+from pkg4.pkg55.pkg719 import m4886
+import pkg7.pkg92.pkg1209.m7460
+from . import m338
+
+
+def helper_8674_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
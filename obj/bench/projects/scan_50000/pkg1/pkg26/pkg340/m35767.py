@@ -0,0 +1,61 @@
+"""Module 35767."""
+import pkg7.pkg104.pkg1357.m18028
+from pkg8.pkg110.pkg1434 import m7685
+import pkg5.pkg69.pkg905.m904
+from . import m6591
+import pkg2.pkg27.pkg359.m358
+from pkg11.pkg144 import m31403
+from . import m4507
+from pkg11.pkg149.pkg1938 import m1937
+from . import m27431
+from pkg5.pkg75.pkg976 import m975
+import pkg8.pkg106.pkg1390.m26397
+
+
+def helper_35767_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35767_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_35767_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_35767_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_35767_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_35767_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35767_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
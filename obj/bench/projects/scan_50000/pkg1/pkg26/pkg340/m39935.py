@@ -0,0 +1,21 @@
+"""Module 39935."""
+import pkg10.pkg141.pkg1837.m16424
+from pkg5.pkg73 import m72
+import pkg1.pkg17.pkg222.m221
+from pkg6.pkg79.pkg1039 import m19794
+import pkg10.pkg134.pkg1752.m1751
+from pkg3 import m2
+
+
+def helper_39935_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39935_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
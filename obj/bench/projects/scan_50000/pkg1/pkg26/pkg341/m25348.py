@@ -0,0 +1,14 @@
+"""Module 25348."""
+import pkg6.pkg85.pkg1106.m7357
+from pkg11.pkg154.pkg2004 import m2003
+import pkg8.pkg112.m111
+from . import m4508
+import pkg8.pkg105.pkg1369.m1368
+from pkg4.pkg56 import m55
+
+
+def helper_25348_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
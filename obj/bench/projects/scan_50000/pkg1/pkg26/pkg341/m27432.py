@@ -0,0 +1,16 @@
+"""Module 27432."""
+import pkg11.pkg154.m153
+from pkg3.pkg47.pkg617 import m616
+import pkg7.pkg98.pkg1285.m1284
+from pkg5.pkg72 import m71
+import pkg5.pkg77.m76
+from . import m25348
+import pkg1.m0
+from . import m17012
+
+
+def helper_27432_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,28 @@
+"""Module 31600."""
+import pkg5.pkg73.pkg954.m5121
+from pkg6.pkg79.pkg1035 import m1034
+from . import m4508
+from pkg9.pkg118.pkg1538 import m11957
+import pkg7.pkg102.pkg1333.m5500
+from pkg9 import m8
+
+
+def helper_31600_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_31600_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_31600_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 4508."""
+import pkg1.pkg21.pkg278.m277
+from pkg5.pkg73 import m2156
+import pkg1.m0
+from pkg3.pkg52.pkg677 import m676
+import pkg3.pkg42.pkg550.m549
+
+
+def helper_4508_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4508_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
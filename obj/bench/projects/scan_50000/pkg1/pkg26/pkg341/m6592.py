@@ -0,0 +1,45 @@
+"""Module 6592."""
+import pkg2.pkg27.pkg358.m357
+from pkg5.pkg73.pkg954 import m953
+import pkg9.pkg125.pkg1629.m1628
+from pkg3.pkg46.pkg604 import m603
+import pkg8.pkg116.pkg1520.m1519
+from pkg2.pkg28.pkg365 import m364
+import pkg4.pkg56.pkg739.m738
+from . import m340
+from . import m4508
+
+
+def helper_6592_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6592_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6592_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6592_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_6592_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,38 @@
+"""Module 14929."""
+import pkg1.pkg22.m21
+from pkg1.pkg14.pkg195 import m10614
+import pkg3.m2
+from pkg4.pkg63.pkg825 import m7076
+from . import m8677
+from pkg7.pkg104.pkg1360 import m3443
+import pkg1.m0
+from pkg2.pkg37.pkg489 import m488
+import pkg2.pkg39.pkg510.m509
+
+
+def helper_14929_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14929_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_14929_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_14929_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
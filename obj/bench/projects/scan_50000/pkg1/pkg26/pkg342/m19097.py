@@ -0,0 +1,27 @@
+"""Module 19097."""
+import pkg1.m0
+from pkg11.pkg151 import m150
+import pkg4.pkg63.pkg822.m11241
+from pkg10.pkg143.pkg1871 import m3954
+import pkg5.pkg66.m65
+
+
+def helper_19097_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_19097_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_19097_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,12 @@
+"""Module 29517."""
+import pkg1.pkg24.pkg314.m25321
+from . import m23265
+import pkg9.pkg126.pkg1641.m1640
+from pkg11.pkg155.pkg2018 import m2017
+
+
+def helper_29517_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
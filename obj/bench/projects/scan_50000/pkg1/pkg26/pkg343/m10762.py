@@ -0,0 +1,12 @@
+"""Module 10762."""
+from . import m4510
+from pkg1.pkg14.pkg192 import m191
+import pkg11.pkg153.pkg1993.m8244
+from pkg2.pkg30 import m29
+
+
+def helper_10762_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
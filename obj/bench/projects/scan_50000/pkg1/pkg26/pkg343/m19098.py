@@ -0,0 +1,18 @@
+"""Module 19098."""
+import pkg6.pkg91.pkg1186.m7437
+from pkg1.pkg14.pkg189 import m14776
+import pkg10.pkg143.pkg1860.m6027
+
+
+def helper_19098_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_19098_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
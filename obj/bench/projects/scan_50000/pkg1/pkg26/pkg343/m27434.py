@@ -0,0 +1,26 @@
+"""Module 27434."""
+import pkg10.pkg132.pkg1717.m26724
+from pkg1.pkg26.pkg341 import m10760
+import pkg1.pkg17.pkg232.m2315
+from pkg1.pkg22 import m21
+import pkg1.pkg16.pkg221.m10640
+from pkg7.pkg94 import m93
+import pkg7.pkg99.pkg1298.m15885
+from pkg10.pkg143.pkg1871 import m1870
+import pkg6.pkg91.pkg1193.m1192
+from . import m19098
+import pkg5.pkg71.pkg929.m7180
+
+
+def helper_27434_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_27434_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 33686."""
+from . import m25350
+from . import m14930
+import pkg4.pkg53.pkg696.m695
+from pkg11.pkg150.pkg1958 import m24881
+import pkg10.pkg132.pkg1728.m14231
+from pkg10.pkg138 import m6389
+import pkg6.pkg86.pkg1130.m13633
+from . import m8678
+import pkg10.pkg138.pkg1799.m8050
+from pkg3.pkg52.pkg686 import m13189
+
+
+def helper_33686_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
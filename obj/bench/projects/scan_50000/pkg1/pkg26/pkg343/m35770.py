@@ -0,0 +1,25 @@
+"""Module 35770."""
+from . import m27434
+from pkg11.pkg154.pkg2015 import m22854
+import pkg7.pkg101.m100
+from pkg1.pkg17 import m16
+import pkg3.pkg50.pkg653.m27744
+from pkg9.pkg124.pkg1613 import m26620
+import pkg4.pkg53.pkg700.m27791
+from pkg4 import m3
+import pkg3.pkg44.pkg578.m577
+from pkg8.pkg110.pkg1441 import m1440
+
+
+def helper_35770_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35770_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
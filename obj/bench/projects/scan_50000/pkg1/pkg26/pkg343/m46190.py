@@ -0,0 +1,24 @@
+"""Module 46190."""
+import pkg8.pkg111.pkg1454.m38965
+from . import m19098
+import pkg5.pkg75.pkg987.m19742
+from pkg10.pkg138.pkg1797 import m8048
+from . import m39938
+from . import m342
+from . import m4510
+from pkg2.pkg29.pkg380 import m379
+import pkg6.pkg89.pkg1164.m32423
+
+
+def helper_46190_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_46190_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
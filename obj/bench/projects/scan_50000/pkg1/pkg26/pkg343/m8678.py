@@ -0,0 +1,17 @@
+"""Module 8678."""
+import pkg1.m0
+from pkg6.pkg89 import m88
+import pkg6.pkg81.m80
+from pkg3.pkg46.pkg611 import m610
+import pkg3.pkg49.m48
+from pkg2.pkg32.pkg426 import m425
+import pkg5.pkg71.pkg926.m3009
+from pkg6.pkg90.pkg1181 import m7432
+from . import m6594
+
+
+def helper_8678_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
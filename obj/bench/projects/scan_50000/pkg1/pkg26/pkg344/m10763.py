@@ -0,0 +1,38 @@
+"""Module 10763."""
+from . import m2427
+from pkg3.pkg52.pkg678 import m4845
+from . import m4511
+from . import m8679
+import pkg7.pkg102.pkg1329.m7580
+from pkg11.pkg146 import m145
+import pkg5.pkg68.pkg894.m2977
+from pkg7.pkg94 import m93
+import pkg12.m11
+
+
+def helper_10763_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10763_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_10763_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_10763_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,28 @@
+"""Module 12847."""
+from . import m10763
+from pkg2.pkg36.pkg472 import m2555
+from . import m343
+from pkg5.pkg69 import m2152
+from . import m4511
+from pkg1 import m0
+
+
+def helper_12847_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12847_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_12847_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
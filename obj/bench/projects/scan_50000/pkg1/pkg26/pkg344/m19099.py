@@ -0,0 +1,35 @@
+"""Module 19099."""
+import pkg7.pkg94.m93
+from pkg4 import m3
+from . import m4511
+from pkg6.pkg80.pkg1043 import m13546
+import pkg6.pkg86.m85
+from pkg8.pkg107.pkg1392 import m9727
+
+
+def helper_19099_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_19099_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_19099_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_19099_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,41 @@
+"""Module 27435."""
+import pkg12.pkg159.pkg2068.m2067
+from pkg4.pkg62.pkg813 import m19568
+import pkg3.pkg50.pkg653.m4820
+from pkg1.pkg14.pkg190 import m14777
+import pkg2.pkg38.pkg504.m13007
+from pkg10.pkg133.pkg1733 import m18404
+import pkg6.pkg82.m14669
+from pkg4.pkg55.pkg719 import m13222
+from . import m4511
+from pkg8.pkg109.pkg1418 import m5585
+import pkg9.pkg129.m128
+from pkg10.pkg138.pkg1797 import m1796
+
+
+def helper_27435_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_27435_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_27435_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_27435_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,31 @@
+"""Module 29519."""
+import pkg9.pkg124.pkg1614.m3697
+from pkg8.pkg116.pkg1513 import m3596
+import pkg2.pkg33.m32
+from . import m17015
+import pkg12.pkg163.m162
+from pkg7.pkg93.pkg1220 import m15807
+import pkg6.pkg86.pkg1125.m1124
+from pkg8.pkg105.pkg1367 import m13870
+import pkg7.pkg104.pkg1359.m1358
+
+
+def helper_29519_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_29519_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_29519_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,44 @@
+"""Module 31603."""
+import pkg3.pkg48.pkg625.m624
+from pkg2.pkg29.pkg383 import m8718
+import pkg2.pkg34.m33
+from pkg3.pkg42.pkg558 import m557
+import pkg2.pkg36.pkg471.m10890
+from . import m2427
+import pkg9.pkg126.pkg1646.m9981
+from pkg1.pkg15.pkg202 import m201
+
+
+def helper_31603_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_31603_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_31603_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_31603_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_31603_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
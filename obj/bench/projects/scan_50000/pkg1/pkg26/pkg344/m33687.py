@@ -0,0 +1,26 @@
+"""Module 33687."""
+import pkg5.pkg69.pkg909.m5076
+from pkg9.pkg123.pkg1600 import m3683
+from . import m25351
+from pkg5.pkg78.pkg1017 import m13520
+import pkg10.pkg138.pkg1800.m14303
+from pkg5 import m4
+import pkg10.pkg132.pkg1721.m24644
+from pkg3.pkg49.pkg650 import m2733
+import pkg4.pkg53.pkg694.m2777
+from pkg2.pkg29.pkg380 import m31639
+import pkg3.pkg41.m22964
+
+
+def helper_33687_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_33687_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
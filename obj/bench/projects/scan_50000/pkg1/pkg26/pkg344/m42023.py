@@ -0,0 +1,37 @@
+"""Module 42023."""
+import pkg2.pkg27.m26
+from pkg5.pkg77.pkg1003 import m11422
+from . import m25351
+from . import m12847
+import pkg6.pkg84.pkg1093.m5260
+from pkg10.pkg132.pkg1725 import m30900
+from . import m343
+from pkg1 import m0
+
+
+def helper_42023_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_42023_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_42023_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_42023_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
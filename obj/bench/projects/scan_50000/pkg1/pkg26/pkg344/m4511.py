@@ -0,0 +1,13 @@
+"""Module 4511."""
+import pkg1.pkg18.pkg239.m2322
+from pkg8 import m7
+import pkg4.pkg55.pkg726.m2809
+from pkg3.pkg49.pkg643 import m642
+import pkg1.pkg19.pkg251.m250
+
+
+def helper_4511_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,24 @@
+"""Module 6595."""
+import pkg6.pkg81.m80
+from . import m343
+from . import m2427
+from . import m4511
+import pkg4.pkg56.pkg738.m737
+from pkg7.pkg94.pkg1232 import m1231
+import pkg1.m0
+from pkg5.pkg71 import m70
+import pkg7.pkg102.pkg1331.m3414
+
+
+def helper_6595_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6595_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,43 @@
+"""Module 8679."""
+import pkg5.pkg71.pkg930.m3013
+from pkg2.pkg30.pkg397 import m4564
+import pkg11.pkg146.pkg1902.m6069
+from pkg1.pkg22.pkg294 import m2377
+from . import m4511
+from pkg2.pkg36 import m4203
+import pkg1.pkg18.m17
+
+
+def helper_8679_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8679_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8679_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8679_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_8679_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 31604."""
+import pkg2.pkg35.pkg465.m2548
+from pkg11.pkg156.pkg2039 import m2038
+import pkg1.pkg23.m22
+from pkg12.pkg162 import m161
+from . import m25352
+from . import m4512
+import pkg4.pkg63.pkg825.m23748
+from . import m6596
+import pkg7.pkg95.pkg1248.m1247
+from pkg1 import m0
+import pkg4.pkg65.pkg858.m30033
+from . import m8680
+
+
+def helper_31604_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_31604_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
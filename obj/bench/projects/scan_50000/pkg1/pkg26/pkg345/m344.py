@@ -0,0 +1,16 @@
+"""Module 344."""
+import pkg1.m0
+from pkg9.pkg130 import m129
+import pkg6.pkg80.m79
+from pkg1.pkg20.pkg267 import m266
+import pkg1.pkg15.m14
+from pkg4.pkg61 import m60
+import pkg10.pkg138.m137
+from pkg11 import m10
+
+
+def helper_344_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,45 @@
+"""Module 35772."""
+import pkg9.pkg124.pkg1614.m7865
+from pkg11.pkg148.pkg1931 import m18602
+import pkg1.pkg25.pkg328.m10747
+from pkg6.pkg89 import m88
+import pkg11.pkg144.pkg1876.m16463
+from . import m29520
+import pkg2.pkg30.pkg402.m8737
+from . import m27436
+import pkg10.pkg137.m136
+
+
+def helper_35772_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35772_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_35772_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_35772_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_35772_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
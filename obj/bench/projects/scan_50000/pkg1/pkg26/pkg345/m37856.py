@@ -0,0 +1,47 @@
+"""Module 37856."""
+import pkg1.pkg26.m22949
+from pkg11.pkg146.pkg1905 import m26912
+import pkg2.pkg34.pkg449.m448
+from pkg8.pkg108.pkg1413 import m1412
+import pkg6.pkg80.pkg1048.m7299
+from . import m27436
+import pkg7.pkg96.m95
+from pkg4.pkg54.pkg715 import m2798
+import pkg6.pkg86.pkg1123.m1122
+from . import m21184
+import pkg6.pkg79.m6330
+
+
+def helper_37856_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37856_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_37856_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_37856_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_37856_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,13 @@
+"""Module 44108."""
+import pkg2.pkg27.pkg364.m10783
+from pkg1.pkg15.pkg202 import m2285
+import pkg1.pkg24.m4191
+from pkg1.pkg17.pkg230 import m229
+import pkg1.pkg17.pkg224.m2307
+
+
+def helper_44108_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 23269."""
+import pkg8.pkg107.pkg1399.m3482
+from pkg5.pkg66.pkg863 import m862
+import pkg6.m5
+from . import m8681
+import pkg1.pkg15.pkg199.m14786
+from pkg2.pkg36.pkg479 import m10898
+import pkg13.pkg182.m181
+from pkg8.pkg111.pkg1450 import m22289
+import pkg10.pkg132.pkg1723.m22562
+from pkg2.pkg29 import m28
+import pkg12.pkg157.pkg2044.m22883
+
+
+def helper_23269_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 2429."""
+from . import m345
+from pkg5.pkg73.pkg959 import m958
+import pkg5.pkg75.pkg986.m985
+
+
+def helper_2429_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
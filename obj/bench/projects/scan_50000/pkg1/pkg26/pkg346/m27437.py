@@ -0,0 +1,36 @@
+"""Module 27437."""
+import pkg4.pkg54.pkg707.m706
+from . import m12849
+import pkg3.pkg46.m4213
+from pkg3.pkg49.pkg647 import m4814
+from . import m19101
+from pkg2.pkg35.pkg465 import m8800
+import pkg1.pkg25.pkg333.m332
+
+
+def helper_27437_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_27437_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_27437_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_27437_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,37 @@
+"""Module 29521."""
+import pkg8.pkg105.pkg1378.m3461
+from pkg7.pkg92.pkg1202 import m1201
+import pkg11.pkg149.pkg1946.m16533
+from pkg8.pkg113 import m23036
+import pkg1.m0
+from pkg5.pkg74.pkg971 import m970
+from . import m25353
+from pkg8.pkg113.pkg1478 import m3561
+
+
+def helper_29521_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_29521_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_29521_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_29521_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,62 @@
+"""Module 33689."""
+import pkg1.pkg19.pkg253.m19008
+from pkg3.pkg46.pkg608 import m19363
+import pkg1.pkg17.pkg231.m230
+from pkg12.pkg159.pkg2069 import m33328
+import pkg1.pkg19.pkg256.m255
+from pkg1.pkg24 import m8359
+import pkg11.pkg147.pkg1915.m8166
+from pkg10.pkg135.pkg1756 import m1755
+import pkg12.pkg158.pkg2055.m10390
+from . import m21185
+from . import m345
+from . import m31605
+
+
+def helper_33689_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_33689_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_33689_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_33689_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_33689_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_33689_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_33689_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 37857."""
+import pkg2.pkg39.pkg508.m507
+from pkg1.pkg17.pkg234 import m16905
+import pkg7.pkg96.pkg1252.m32511
+from pkg2.pkg27.pkg353 import m352
+import pkg5.pkg78.pkg1016.m1015
+
+
+def helper_37857_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37857_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_37857_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
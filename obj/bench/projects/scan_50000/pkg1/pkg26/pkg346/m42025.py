@@ -0,0 +1,36 @@
+"""Module 42025."""
+import pkg6.pkg89.pkg1168.m1167
+from pkg7.pkg97.pkg1272 import m28363
+import pkg3.pkg43.pkg569.m2652
+from pkg10.pkg138.pkg1798 import m33057
+import pkg8.pkg115.pkg1503.m32762
+from pkg1.pkg18.pkg243 import m6494
+import pkg3.pkg40.m39
+
+
+def helper_42025_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_42025_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_42025_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_42025_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
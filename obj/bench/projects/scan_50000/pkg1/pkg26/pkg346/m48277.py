@@ -0,0 +1,44 @@
+"""Module 48277."""
+import pkg1.m0
+from pkg3.pkg51.pkg664 import m663
+import pkg2.pkg27.pkg360.m2443
+from pkg9.pkg125.pkg1637 import m41232
+import pkg4.pkg56.pkg736.m6987
+from pkg2.pkg39 import m38
+import pkg2.pkg34.pkg453.m452
+from pkg11.pkg145.pkg1889 import m1888
+
+
+def helper_48277_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_48277_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_48277_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_48277_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_48277_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,28 @@
+"""Module 17018."""
+import pkg10.pkg132.pkg1721.m3804
+from pkg6.pkg80.pkg1051 import m1050
+import pkg4.pkg60.pkg789.m788
+from pkg4.pkg54.pkg705 import m6956
+import pkg4.pkg61.pkg800.m799
+from pkg2.pkg35.pkg465 import m4632
+
+
+def helper_17018_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_17018_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_17018_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
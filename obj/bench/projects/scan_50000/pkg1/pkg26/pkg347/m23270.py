@@ -0,0 +1,48 @@
+"""Module 23270."""
+from . import m19102
+from . import m14934
+import pkg2.m1
+from . import m12850
+from . import m21186
+from pkg3.pkg43 import m42
+import pkg2.pkg32.pkg429.m12932
+from pkg1.pkg22.pkg291 import m4458
+import pkg5.pkg67.pkg884.m883
+from pkg1.pkg21.pkg274 import m6525
+import pkg3.pkg42.pkg550.m549
+from pkg13 import m12
+
+
+def helper_23270_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_23270_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_23270_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_23270_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_23270_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
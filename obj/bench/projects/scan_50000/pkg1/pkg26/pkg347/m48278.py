@@ -0,0 +1,61 @@
+"""Module 48278."""
+import pkg1.pkg18.pkg247.m246
+from . import m44110
+import pkg2.pkg29.pkg380.m379
+from pkg5.pkg67.pkg881 import m2964
+from . import m17018
+from pkg3.pkg44.pkg580 import m2663
+import pkg13.pkg177.m10596
+from pkg3.pkg51.pkg668 import m9003
+import pkg2.pkg35.pkg465.m25472
+from pkg1.pkg18.pkg236 import m235
+import pkg6.pkg87.pkg1141.m28232
+
+
+def helper_48278_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_48278_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_48278_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_48278_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_48278_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_48278_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_48278_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,37 @@
+"""Module 8682."""
+import pkg12.pkg157.m156
+from . import m4514
+import pkg1.pkg14.m13
+from pkg4.pkg53.pkg690 import m4857
+import pkg8.pkg108.pkg1408.m7659
+from . import m2430
+import pkg3.pkg42.pkg549.m6800
+from pkg5.pkg75.pkg976 import m5143
+
+
+def helper_8682_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8682_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8682_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8682_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
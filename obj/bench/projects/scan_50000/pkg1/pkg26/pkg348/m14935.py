@@ -0,0 +1,31 @@
+"""Module 14935."""
+import pkg11.pkg146.pkg1909.m3992
+from . import m2431
+from . import m4515
+from pkg11.pkg155.pkg2019 import m6186
+import pkg1.pkg21.pkg283.m4450
+from pkg5.pkg77.pkg1002 import m11421
+import pkg8.pkg111.pkg1455.m1454
+from pkg10.pkg132 import m131
+import pkg1.pkg20.m19
+
+
+def helper_14935_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14935_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_14935_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
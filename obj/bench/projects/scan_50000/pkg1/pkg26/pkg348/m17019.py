@@ -0,0 +1,34 @@
+"""Module 17019."""
+from . import m10767
+from pkg1.pkg17.pkg223 import m14810
+import pkg9.pkg126.pkg1643.m16230
+from pkg11.pkg150.pkg1957 import m1956
+import pkg8.pkg117.pkg1527.m7778
+from pkg10.pkg140.pkg1827 import m8078
+import pkg10.pkg137.pkg1787.m12206
+from pkg2.pkg29 import m4196
+import pkg8.pkg105.pkg1368.m1367
+from pkg2.pkg29.pkg386 import m10805
+import pkg1.m0
+from pkg8.pkg115.pkg1497 import m16084
+
+
+def helper_17019_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_17019_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_17019_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,35 @@
+"""Module 19103."""
+import pkg3.pkg51.m50
+from pkg4.pkg58 import m57
+import pkg1.m0
+from pkg2.pkg35.pkg461 import m2544
+import pkg8.pkg109.pkg1424.m7675
+from . import m10767
+
+
+def helper_19103_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_19103_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_19103_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_19103_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
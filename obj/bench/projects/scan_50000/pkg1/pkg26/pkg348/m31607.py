@@ -0,0 +1,18 @@
+"""Module 31607."""
+import pkg5.pkg69.pkg904.m903
+from . import m8683
+from . import m19103
+from pkg10.pkg135 import m134
+import pkg8.pkg111.pkg1446.m1445
+from pkg4.pkg57.pkg754 import m753
+import pkg2.m1
+from pkg7.pkg103.pkg1347 import m28438
+import pkg3.pkg50.pkg661.m2744
+from . import m12851
+
+
+def helper_31607_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
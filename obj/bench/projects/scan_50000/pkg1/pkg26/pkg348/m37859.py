@@ -0,0 +1,53 @@
+"""Module 37859."""
+import pkg9.pkg121.m120
+from pkg5.pkg77.pkg1013 import m5180
+import pkg1.pkg19.pkg260.m259
+from pkg1.pkg21.pkg286 import m16957
+import pkg7.pkg93.pkg1212.m11631
+from pkg1 import m0
+import pkg1.pkg21.pkg286.m6537
+from pkg2.pkg30.pkg401 import m31660
+import pkg2.pkg35.pkg458.m4625
+from pkg5.pkg70.pkg920 import m5087
+
+
+def helper_37859_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37859_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_37859_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_37859_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_37859_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_37859_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
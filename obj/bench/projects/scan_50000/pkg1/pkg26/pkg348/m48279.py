@@ -0,0 +1,2 @@
+"""Module 48279."""
+import pkg3.pkg45.pkg596.m27687
@@ -0,0 +1,16 @@
+"""Module 10768."""
+import pkg1.pkg19.pkg250.m2333
+from pkg1.pkg23.pkg312 import m311
+import pkg1.pkg22.pkg296.m10715
+from pkg8.pkg116.pkg1518 import m5685
+import pkg5.pkg78.pkg1017.m9352
+from pkg2.pkg31.pkg414 import m2497
+from . import m8684
+from pkg3.pkg40.pkg524 import m6775
+
+
+def helper_10768_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,46 @@
+"""Module 12852."""
+import pkg6.pkg80.pkg1045.m1044
+from pkg7.pkg97.pkg1267 import m1266
+import pkg1.pkg22.m12525
+from pkg11.pkg152.pkg1984 import m6151
+import pkg6.pkg83.pkg1084.m3167
+from pkg6.pkg83.pkg1088 import m3171
+import pkg6.pkg83.pkg1081.m1080
+from pkg11.pkg152.pkg1977 import m12396
+import pkg3.pkg45.pkg598.m597
+from pkg1.pkg18.pkg237 import m236
+
+
+def helper_12852_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12852_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_12852_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_12852_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_12852_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
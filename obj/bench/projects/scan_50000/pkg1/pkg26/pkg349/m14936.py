@@ -0,0 +1,22 @@
+"""Module 14936."""
+import pkg7.pkg97.pkg1273.m7524
+from pkg2.pkg31.pkg412 import m8747
+import pkg3.pkg52.pkg680.m679
+from . import m4516
+import pkg2.pkg38.pkg496.m8831
+from pkg8.pkg112.pkg1461 import m7712
+import pkg7.pkg100.pkg1307.m7558
+
+
+def helper_14936_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14936_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
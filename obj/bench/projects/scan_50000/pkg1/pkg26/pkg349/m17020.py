@@ -0,0 +1,26 @@
+"""Module 17020."""
+import pkg10.pkg137.pkg1782.m3865
+from pkg5.pkg73.pkg962 import m3045
+import pkg6.pkg91.pkg1189.m3272
+from pkg8.pkg115.pkg1503 import m1502
+
+
+def helper_17020_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_17020_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_17020_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,41 @@
+"""Module 23272."""
+import pkg9.pkg118.pkg1541.m9876
+from pkg1.pkg23.pkg303 import m19058
+import pkg11.pkg153.pkg1990.m4073
+from pkg8.pkg106.pkg1379 import m7630
+import pkg5.pkg67.pkg876.m15463
+from . import m14936
+from . import m21188
+from pkg4.pkg53 import m52
+import pkg1.pkg17.pkg229.m2312
+from pkg2.pkg35.pkg464 import m463
+import pkg3.pkg51.pkg673.m672
+from pkg7.pkg101.pkg1314 import m7565
+
+
+def helper_23272_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_23272_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_23272_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_23272_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
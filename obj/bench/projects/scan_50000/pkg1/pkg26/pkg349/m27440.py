@@ -0,0 +1,35 @@
+"""Module 27440."""
+import pkg12.pkg166.m165
+from . import m25356
+import pkg6.pkg79.pkg1037.m9372
+from pkg5.pkg69.pkg899 import m7150
+import pkg11.pkg145.pkg1895.m10230
+from pkg4.pkg54.pkg709 import m2792
+
+
+def helper_27440_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_27440_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_27440_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_27440_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
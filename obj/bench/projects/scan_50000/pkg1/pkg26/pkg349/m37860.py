@@ -0,0 +1,12 @@
+"""Module 37860."""
+import pkg4.pkg63.pkg826.m825
+from pkg8.pkg115.pkg1506 import m18177
+from . import m17020
+from pkg3.pkg44.pkg573 import m8908
+
+
+def helper_37860_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,53 @@
+"""Module 42028."""
+import pkg4.pkg62.pkg814.m2897
+from pkg2.pkg34.pkg455 import m454
+import pkg8.pkg115.pkg1506.m30681
+from pkg11.pkg155.pkg2019 import m6186
+import pkg4.pkg53.m31312
+from pkg2.pkg36 import m35
+from . import m348
+from . import m17020
+import pkg2.pkg39.pkg513.m512
+from pkg11.pkg149.pkg1948 import m14451
+
+
+def helper_42028_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_42028_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_42028_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_42028_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_42028_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_42028_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
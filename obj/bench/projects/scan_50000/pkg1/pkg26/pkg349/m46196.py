@@ -0,0 +1,17 @@
+"""Module 46196."""
+import pkg6.m5
+from pkg3.pkg41.pkg535 import m23458
+
+
+def helper_46196_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_46196_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,35 @@
+"""Module 6600."""
+import pkg1.m0
+from pkg6.pkg86.pkg1120 import m1119
+import pkg1.pkg18.pkg243.m242
+from pkg1.pkg16.pkg215 import m2298
+import pkg9.pkg129.pkg1687.m3770
+from pkg11.pkg148.pkg1932 import m4015
+
+
+def helper_6600_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6600_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6600_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6600_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,45 @@
+"""Module 14937."""
+import pkg1.pkg23.pkg303.m10722
+from pkg11.pkg151 import m150
+from . import m349
+from pkg6.pkg81.pkg1061 import m3144
+import pkg10.pkg136.m4303
+from . import m4517
+import pkg4.pkg65.pkg849.m11268
+from pkg7.pkg100.pkg1303 import m7554
+import pkg3.pkg47.pkg619.m618
+
+
+def helper_14937_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14937_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_14937_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_14937_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_14937_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 21189."""
+import pkg12.pkg157.pkg2042.m2041
+from pkg2.pkg29.pkg385 import m384
+import pkg7.pkg102.pkg1329.m1328
+from pkg6.pkg86.pkg1124 import m3207
+import pkg5.pkg71.pkg930.m5097
+from . import m17021
+import pkg5.pkg66.pkg862.m861
+from . import m19105
+from . import m349
+from pkg3 import m2
+import pkg7.pkg92.m6343
+from pkg3.pkg45.pkg588 import m2671
+
+
+def helper_21189_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_21189_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,12 @@
+"""Module 2433."""
+import pkg8.pkg106.pkg1382.m1381
+from pkg11.pkg149 import m148
+import pkg1.m0
+from pkg5.pkg71 import m2154
+
+
+def helper_2433_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 14938."""
+import pkg5.pkg70.m69
+from pkg1.pkg18 import m17
+from . import m8686
+
+
+def helper_14938_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14938_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
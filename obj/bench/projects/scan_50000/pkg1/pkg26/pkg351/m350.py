@@ -0,0 +1,28 @@
+"""Module 350."""
+import pkg9.m8
+from pkg1 import m0
+import pkg1.pkg15.m14
+from pkg4.pkg64 import m63
+import pkg3.pkg51.m50
+from pkg12.pkg164 import m163
+
+
+def helper_350_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_350_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_350_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 35778."""
+import pkg4.pkg58.pkg756.m23679
+from . import m2434
+import pkg3.pkg49.pkg645.m11064
+from pkg11.pkg150.pkg1956 import m1955
+
+
+def helper_35778_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35778_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_35778_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
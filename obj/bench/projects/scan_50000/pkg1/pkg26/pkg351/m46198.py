@@ -0,0 +1,12 @@
+"""Module 46198."""
+import pkg2.pkg39.pkg511.m6762
+from pkg1.pkg20.pkg273 import m272
+import pkg3.pkg48.pkg634.m633
+from pkg13.pkg178 import m18933
+
+
+def helper_46198_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,21 @@
+"""Module 8686."""
+import pkg7.pkg92.pkg1206.m5373
+from pkg6.pkg81.pkg1064 import m3147
+import pkg1.pkg25.m24
+from . import m6602
+from . import m2434
+from pkg10.pkg141.pkg1841 import m8092
+
+
+def helper_8686_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8686_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 12513."""
+import pkg1.pkg25.pkg330.m2413
+from pkg2.pkg34 import m33
+import pkg1.pkg16.pkg211.m210
+
+
+def helper_12513_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 2093."""
+from . import m9
+from pkg1.pkg15.pkg199 import m198
+
+
+def helper_2093_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2093_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
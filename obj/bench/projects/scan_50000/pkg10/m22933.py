@@ -0,0 +1,45 @@
+"""Module 22933."""
+import pkg5.pkg68.pkg894.m7145
+from pkg5.pkg76.pkg998 import m3081
+import pkg1.pkg15.pkg208.m4375
+from pkg4.pkg54.pkg710 import m709
+import pkg8.pkg111.pkg1454.m9789
+from . import m16681
+from . import m12513
+from pkg10.pkg137.pkg1789 import m16376
+import pkg2.m1
+
+
+def helper_22933_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_22933_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_22933_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_22933_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_22933_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
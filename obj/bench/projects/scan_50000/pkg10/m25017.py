@@ -0,0 +1,20 @@
+"""Module 25017."""
+import pkg1.pkg21.pkg279.m2362
+from . import m2093
+import pkg4.pkg63.pkg822.m821
+from pkg8.pkg117.pkg1531 import m1530
+from . import m4177
+
+
+def helper_25017_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_25017_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
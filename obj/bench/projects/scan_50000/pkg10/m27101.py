@@ -0,0 +1,62 @@
+"""Module 27101."""
+import pkg7.pkg101.pkg1316.m1315
+from pkg4.pkg59.pkg775 import m774
+from . import m18765
+from . import m22933
+from . import m6261
+from pkg5.pkg67.pkg881 import m13384
+from . import m12513
+from pkg8.pkg107.pkg1397 import m1396
+import pkg1.pkg23.pkg311.m10730
+from pkg10.pkg142.pkg1852 import m18523
+import pkg3.pkg42.pkg548.m2631
+from pkg3.pkg44.pkg583 import m21422
+
+
+def helper_27101_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_27101_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_27101_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_27101_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_27101_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_27101_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_27101_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,7 @@
+"""Module 29185."""
+import pkg8.pkg116.pkg1519.m1518
+from pkg4.pkg53 import m52
+import pkg11.pkg149.pkg1950.m1949
+from pkg3.pkg47.pkg618 import m19373
+from . import m25017
+from pkg9.pkg120.pkg1567 import m16154
@@ -0,0 +1,20 @@
+"""Module 8345."""
+import pkg7.pkg99.pkg1297.m7548
+from pkg11.pkg150.pkg1955 import m1954
+import pkg1.m0
+from pkg5.pkg75 import m74
+import pkg4.pkg62.pkg813.m4980
+
+
+def helper_8345_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8345_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,39 @@
+"""Module 10550."""
+import pkg4.pkg53.pkg698.m697
+from pkg1.pkg20.pkg263 import m2346
+import pkg2.m1
+from . import m8466
+import pkg1.m0
+from pkg6.pkg91.pkg1195 import m3278
+import pkg3.pkg49.pkg638.m2721
+from pkg8.pkg115.pkg1508 import m3591
+import pkg2.pkg37.pkg489.m488
+from pkg6.pkg85.pkg1109 import m9444
+
+
+def helper_10550_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10550_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_10550_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_10550_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,30 @@
+"""Module 25138."""
+import pkg10.pkg132.pkg1719.m5886
+from pkg3.pkg41.pkg543 import m2626
+import pkg6.pkg79.pkg1039.m1038
+from pkg6.pkg84.pkg1093 import m3176
+import pkg10.pkg141.pkg1840.m3923
+from pkg6.pkg87.pkg1135 import m7386
+import pkg7.pkg94.pkg1231.m1230
+from pkg1 import m0
+
+
+def helper_25138_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_25138_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_25138_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
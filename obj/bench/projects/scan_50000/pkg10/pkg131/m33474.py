@@ -0,0 +1,40 @@
+"""Module 33474."""
+import pkg2.pkg38.m37
+from pkg11.pkg154.pkg2011 import m6178
+import pkg2.pkg39.pkg508.m2591
+from pkg11.pkg156.pkg2029 import m8280
+import pkg6.pkg83.pkg1084.m3167
+from pkg2.pkg32 import m20871
+import pkg3.pkg42.pkg558.m19313
+from pkg9.pkg125.pkg1637 import m28728
+from . import m23054
+from pkg1.pkg19.pkg259 import m2342
+import pkg10.pkg136.pkg1772.m1771
+
+
+def helper_33474_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_33474_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_33474_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_33474_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
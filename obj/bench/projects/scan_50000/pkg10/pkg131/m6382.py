@@ -0,0 +1,10 @@
+"""Module 6382."""
+import pkg3.pkg51.m50
+from pkg6.pkg80.pkg1050 import m1049
+import pkg1.pkg14.pkg185.m184
+from pkg10.pkg131.pkg1715 import m1714
+import pkg4.pkg55.pkg725.m2808
+from pkg1.pkg18 import m17
+import pkg5.pkg73.m72
+from pkg7 import m6
+import pkg1.m0
@@ -0,0 +1,17 @@
+"""Module 12123."""
+import pkg6.pkg81.pkg1060.m5227
+from pkg9.pkg121.pkg1579 import m5746
+import pkg2.pkg32.pkg419.m6670
+from pkg9.pkg129 import m128
+import pkg11.pkg152.m151
+from pkg9.pkg128.pkg1676 import m7927
+import pkg3.pkg45.m44
+from pkg3 import m2
+import pkg11.pkg152.pkg1980.m1979
+
+
+def helper_12123_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,40 @@
+"""Module 20459."""
+import pkg11.pkg153.pkg1999.m8250
+from pkg4.pkg63.pkg822 import m821
+import pkg11.pkg147.pkg1923.m4006
+from pkg2.pkg31.pkg411 import m410
+import pkg5.pkg75.pkg978.m17649
+from pkg4.pkg56 import m55
+import pkg5.pkg74.pkg964.m3047
+from pkg6.pkg90.pkg1177 import m3260
+from . import m12123
+from pkg10.pkg140.pkg1829 import m3912
+import pkg7.pkg98.pkg1278.m11697
+
+
+def helper_20459_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_20459_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_20459_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_20459_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,44 @@
+"""Module 22543."""
+import pkg3.pkg50.pkg659.m13162
+from . import m18375
+import pkg5.pkg73.pkg957.m21796
+from . import m10039
+import pkg9.pkg121.pkg1582.m5749
+from pkg8.pkg115.pkg1503 import m3586
+import pkg5.pkg72.pkg942.m5109
+from pkg7.pkg99.pkg1292 import m7543
+
+
+def helper_22543_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_22543_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_22543_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_22543_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_22543_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,13 @@
+"""Module 41299."""
+import pkg4.pkg56.m55
+from pkg4.pkg61.pkg806 import m805
+import pkg8.pkg114.pkg1483.m5650
+from pkg6.pkg89.pkg1164 import m13667
+import pkg9.pkg124.pkg1621.m32880
+
+
+def helper_41299_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
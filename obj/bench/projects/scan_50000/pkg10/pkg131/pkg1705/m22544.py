@@ -0,0 +1,20 @@
+"""Module 22544."""
+import pkg3.pkg50.pkg660.m6911
+from pkg10.pkg139.pkg1816 import m5983
+from . import m12124
+from pkg4 import m3
+import pkg10.pkg143.pkg1865.m10200
+
+
+def helper_22544_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_22544_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
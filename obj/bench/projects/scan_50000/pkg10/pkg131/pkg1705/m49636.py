@@ -0,0 +1,41 @@
+"""Module 49636."""
+import pkg5.pkg72.pkg945.m15532
+from pkg1.pkg20.pkg272 import m6523
+from . import m47552
+from . import m18376
+import pkg6.pkg79.pkg1039.m9374
+from pkg11.pkg156.pkg2033 import m12452
+import pkg8.pkg105.pkg1378.m9713
+from pkg3.pkg45.pkg598 import m597
+import pkg2.pkg37.pkg490.m4657
+from pkg9.pkg125.pkg1637 import m1636
+import pkg1.pkg25.m24
+from pkg7.pkg92.pkg1208 import m3291
+
+
+def helper_49636_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_49636_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_49636_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_49636_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,3 @@
+"""Module 10041."""
+import pkg2.pkg37.pkg494.m2577
+from pkg11.pkg145.pkg1891 import m6058
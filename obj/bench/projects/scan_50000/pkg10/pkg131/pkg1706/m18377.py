@@ -0,0 +1,19 @@
+"""Module 18377."""
+import pkg1.pkg14.pkg192.m10611
+from pkg2.pkg27.pkg363 import m2446
+import pkg6.pkg85.pkg1117.m15704
+from pkg12.pkg157.pkg2049 import m4132
+
+
+def helper_18377_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_18377_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 22545."""
+from . import m5873
+from pkg11.pkg147.pkg1921 import m14424
+import pkg2.pkg35.pkg461.m2544
+from pkg3.pkg43.pkg565 import m2648
+from . import m14209
+from pkg1.pkg19.pkg249 import m4416
+import pkg7.pkg96.pkg1255.m11674
+from pkg1.pkg23.pkg306 import m19061
+import pkg8.pkg113.pkg1472.m3555
+from pkg12.pkg168 import m12671
+
+
+def helper_22545_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_22545_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,28 @@
+"""Module 26713."""
+import pkg11.pkg152.m151
+from pkg11.pkg154.pkg2011 import m8262
+import pkg8.pkg115.pkg1497.m1496
+from pkg3.pkg44 import m43
+import pkg6.pkg83.pkg1082.m1081
+from pkg5.pkg77 import m8412
+
+
+def helper_26713_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_26713_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_26713_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,37 @@
+"""Module 24630."""
+import pkg10.pkg143.pkg1866.m8117
+from . import m18378
+import pkg8.pkg115.pkg1505.m22344
+from . import m12126
+from . import m14210
+from pkg1.pkg26.pkg339 import m338
+import pkg11.pkg150.pkg1953.m1952
+from pkg4.pkg60.pkg789 import m788
+
+
+def helper_24630_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_24630_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_24630_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_24630_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 26714."""
+import pkg12.pkg158.pkg2057.m4140
+from pkg4.pkg62.pkg816 import m4983
+import pkg13.pkg174.m8509
+
+
+def helper_26714_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_26714_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_26714_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
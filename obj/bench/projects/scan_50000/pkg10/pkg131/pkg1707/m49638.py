@@ -0,0 +1,16 @@
+"""Module 49638."""
+import pkg5.pkg78.pkg1019.m42698
+from pkg6.pkg88.pkg1155 import m13658
+import pkg11.pkg145.pkg1889.m35232
+from pkg11.pkg156.pkg2039 import m29130
+import pkg1.pkg17.pkg232.m231
+from pkg8.pkg109.pkg1422 import m1421
+import pkg2.pkg28.pkg366.m365
+from pkg7.pkg104.pkg1354 import m36781
+
+
+def helper_49638_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
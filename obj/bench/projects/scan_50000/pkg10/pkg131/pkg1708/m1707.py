@@ -0,0 +1,20 @@
+"""Module 1707."""
+import pkg8.pkg110.pkg1431.m1430
+from pkg1 import m0
+import pkg13.m12
+from pkg1.pkg19.pkg249 import m248
+import pkg3.pkg49.m48
+
+
+def helper_1707_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1707_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,34 @@
+"""Module 26715."""
+import pkg10.m9
+from pkg8.pkg113.pkg1473 import m7724
+import pkg7.pkg102.pkg1335.m1334
+from . import m18379
+import pkg8.pkg107.pkg1403.m5570
+from pkg1.pkg24.pkg319 import m2402
+from . import m12127
+from pkg7.pkg98.pkg1287 import m7538
+import pkg11.pkg151.pkg1973.m4056
+from pkg5.pkg77.pkg1011 import m1010
+import pkg8.pkg117.pkg1533.m5700
+from pkg3.pkg43.pkg569 import m17240
+
+
+def helper_26715_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_26715_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_26715_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,3 @@
+"""Module 32967."""
+import pkg7.pkg101.pkg1317.m3400
+from pkg4.pkg58.pkg758 import m757
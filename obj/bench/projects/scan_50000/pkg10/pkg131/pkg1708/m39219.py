@@ -0,0 +1,62 @@
+"""Module 39219."""
+import pkg11.pkg144.pkg1883.m31058
+from pkg1.pkg21.pkg284 import m23207
+import pkg8.pkg117.pkg1526.m3609
+from pkg2.pkg30.pkg392 import m4559
+import pkg10.pkg134.pkg1755.m35098
+from pkg7.pkg99.pkg1292 import m15879
+import pkg4.pkg65.m64
+from pkg3.pkg43 import m42
+import pkg8.pkg105.pkg1376.m9711
+from pkg4.pkg62.pkg819 import m818
+import pkg3.pkg52.pkg685.m15272
+from pkg1.pkg21.pkg278 import m277
+
+
+def helper_39219_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39219_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_39219_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_39219_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_39219_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_39219_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39219_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
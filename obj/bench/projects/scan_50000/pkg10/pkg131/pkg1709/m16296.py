@@ -0,0 +1,44 @@
+"""Module 16296."""
+import pkg4.pkg60.pkg786.m7037
+from pkg1.pkg18.pkg243 import m242
+import pkg7.pkg104.pkg1359.m1358
+from pkg9.pkg120 import m119
+import pkg1.pkg26.pkg345.m6596
+from pkg4.pkg59.pkg777 import m13280
+import pkg1.m0
+from pkg2.pkg27 import m8362
+
+
+def helper_16296_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16296_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_16296_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_16296_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_16296_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,33 @@
+"""Module 26716."""
+import pkg10.pkg136.pkg1780.m1779
+from pkg11.pkg152.pkg1981 import m1980
+import pkg10.pkg138.pkg1800.m1799
+from pkg10.pkg136.pkg1778 import m1777
+
+
+def helper_26716_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_26716_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_26716_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_26716_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 32968."""
+import pkg12.pkg159.m8494
+from pkg8.pkg112.pkg1457 import m32716
+import pkg7.pkg102.pkg1336.m1335
+from pkg1.pkg18 import m17
+
+
+def helper_32968_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_32968_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_32968_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
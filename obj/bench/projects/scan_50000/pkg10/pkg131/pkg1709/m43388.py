@@ -0,0 +1,19 @@
+"""Module 43388."""
+import pkg2.pkg34.pkg444.m19199
+from pkg6.pkg86.pkg1121 import m3204
+from . import m7960
+from pkg3.pkg51.pkg676 import m4843
+
+
+def helper_43388_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_43388_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 14213."""
+import pkg8.pkg107.pkg1396.m9731
+from pkg5.pkg68.pkg891 import m7142
+import pkg13.pkg175.m4342
+from . import m12129
+import pkg11.pkg150.m149
+from pkg10.pkg137.pkg1785 import m3868
+import pkg2.pkg31.pkg405.m2488
+from pkg1.pkg20.pkg263 import m262
+import pkg10.pkg141.pkg1841.m3924
+from pkg6.pkg80.pkg1049 import m7300
+from . import m3793
+
+
+def helper_14213_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14213_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 1709."""
+import pkg1.pkg19.pkg252.m251
+from pkg3.pkg40 import m39
+import pkg8.pkg106.m105
+from pkg5.pkg71.pkg926 import m925
+import pkg1.pkg21.pkg285.m284
+from pkg1 import m0
+import pkg1.pkg19.pkg259.m258
+from pkg3.pkg51.pkg667 import m666
+import pkg4.pkg61.pkg806.m805
+from pkg8.pkg111.pkg1452 import m1451
+import pkg4.pkg57.m56
+
+
+def helper_1709_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1709_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 20465."""
+import pkg1.pkg20.pkg272.m271
+from pkg8.pkg112.pkg1457 import m7708
+import pkg3.pkg52.pkg679.m6930
+from pkg3.pkg52.pkg679 import m2762
+import pkg6.pkg90.pkg1172.m19927
+from pkg11.pkg150.pkg1963 import m4046
+import pkg2.m1
+from pkg3.pkg42.pkg559 import m19314
+import pkg3.pkg50.m49
+from pkg1.pkg15.pkg202 import m201
+import pkg1.pkg26.m25
+
+
+def helper_20465_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_20465_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
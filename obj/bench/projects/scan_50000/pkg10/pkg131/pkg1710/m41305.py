@@ -0,0 +1,45 @@
+"""Module 41305."""
+import pkg8.pkg105.pkg1374.m11793
+from pkg4.pkg60.pkg791 import m4958
+import pkg8.pkg108.pkg1415.m7666
+from pkg4.pkg55.pkg720 import m21559
+from . import m7961
+from pkg5.pkg72 import m29247
+import pkg11.pkg155.pkg2016.m2015
+from pkg6.pkg79 import m78
+import pkg10.pkg137.pkg1782.m5949
+
+
+def helper_41305_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_41305_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_41305_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_41305_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_41305_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
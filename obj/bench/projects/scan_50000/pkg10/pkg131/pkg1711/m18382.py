@@ -0,0 +1,33 @@
+"""Module 18382."""
+import pkg5.pkg69.pkg907.m2990
+from pkg4.pkg64.pkg833 import m5000
+import pkg4.pkg59.pkg772.m771
+from pkg10.pkg143.pkg1860 import m16447
+import pkg3.pkg48.pkg627.m626
+from pkg5.pkg68.pkg890 import m889
+from . import m14214
+from pkg1 import m0
+import pkg3.pkg50.pkg659.m658
+from . import m12130
+import pkg1.pkg24.pkg319.m318
+
+
+def helper_18382_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_18382_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_18382_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,23 @@
+"""Module 24634."""
+import pkg2.pkg27.pkg360.m359
+from pkg8.pkg108.pkg1417 import m7668
+import pkg10.pkg140.pkg1830.m18501
+from pkg10.pkg133.pkg1730 import m1729
+import pkg3.pkg49.pkg641.m23564
+from pkg10.pkg133.pkg1733 import m12152
+import pkg1.pkg20.pkg266.m10685
+from . import m20466
+
+
+def helper_24634_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_24634_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
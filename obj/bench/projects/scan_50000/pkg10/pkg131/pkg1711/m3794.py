@@ -0,0 +1,21 @@
+"""Module 3794."""
+import pkg1.pkg21.pkg282.m281
+from . import m1710
+import pkg1.m0
+from pkg7.pkg97.pkg1267 import m1266
+import pkg1.pkg18.pkg236.m235
+from pkg1.pkg25.pkg332 import m331
+
+
+def helper_3794_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3794_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,34 @@
+"""Module 41306."""
+import pkg2.pkg36.pkg472.m10891
+from pkg11.pkg152.pkg1981 import m1980
+import pkg6.pkg87.pkg1141.m5308
+from pkg1.pkg21 import m20
+import pkg7.pkg103.pkg1349.m32608
+from . import m1710
+import pkg5.pkg70.pkg918.m19673
+from pkg2.pkg32.pkg422 import m2505
+import pkg9.pkg121.pkg1586.m5753
+from . import m18382
+import pkg3.pkg50.pkg652.m651
+from pkg1.pkg22.pkg289 import m288
+
+
+def helper_41306_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_41306_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_41306_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,29 @@
+"""Module 7962."""
+from . import m3794
+from pkg3.pkg52 import m51
+import pkg6.pkg83.pkg1083.m7334
+from pkg6.pkg84 import m83
+import pkg2.pkg29.m28
+from pkg9.pkg124 import m2207
+import pkg3.pkg48.pkg625.m624
+
+
+def helper_7962_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7962_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7962_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
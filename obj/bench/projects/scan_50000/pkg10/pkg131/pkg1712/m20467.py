@@ -0,0 +1,13 @@
+"""Module 20467."""
+import pkg10.pkg134.pkg1752.m1751
+from . import m12131
+from . import m16299
+from pkg9.pkg120.pkg1566 import m7817
+import pkg3.m2
+from pkg2 import m1
+from . import m18383
+from . import m7963
+import pkg2.pkg38.pkg499.m13002
+from pkg7.pkg101.pkg1322 import m1321
+import pkg4.pkg54.pkg713.m9048
+from pkg6.pkg86.pkg1129 import m7380
@@ -0,0 +1,20 @@
+"""Module 26719."""
+import pkg9.pkg120.pkg1571.m3654
+from pkg8.pkg114.pkg1495 import m9830
+import pkg6.pkg85.pkg1107.m5274
+from pkg1.pkg19.pkg256 import m14843
+import pkg5.pkg78.pkg1024.m1023
+
+
+def helper_26719_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_26719_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,13 @@
+"""Module 35055."""
+import pkg2.pkg36.pkg472.m10891
+from pkg8.pkg114.pkg1483 import m20238
+from . import m5879
+from pkg3.pkg48 import m47
+from . import m10047
+
+
+def helper_35055_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
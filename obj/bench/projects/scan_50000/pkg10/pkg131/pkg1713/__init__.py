@@ -0,0 +1 @@
+"""Package 1713."""
@@ -0,0 +1,20 @@
+"""Module 28804."""
+import pkg9.m8
+from pkg6.pkg80.pkg1046 import m7297
+import pkg3.pkg46.pkg599.m598
+from pkg7.pkg98.pkg1277 import m9612
+import pkg9.pkg130.m129
+
+
+def helper_28804_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_28804_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 37140."""
+import pkg6.pkg88.pkg1149.m1148
+from . import m7964
+from . import m22552
+from . import m20468
+import pkg12.pkg159.pkg2078.m33337
+from pkg9.pkg119.pkg1551 import m5718
+import pkg3.pkg48.pkg629.m628
+from pkg1.pkg16.pkg220 import m6471
+import pkg10.pkg139.m31398
+from pkg9.pkg125.pkg1633 import m32892
+from . import m35056
+
+
+def helper_37140_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,32 @@
+"""Module 39224."""
+import pkg1.pkg17.pkg226.m2309
+from pkg6.pkg90.pkg1182 import m9517
+import pkg1.pkg23.pkg300.m6551
+from . import m20468
+import pkg6.pkg84.pkg1102.m7353
+from pkg3.pkg45.pkg596 import m4763
+import pkg1.m0
+from pkg9.pkg124.pkg1616 import m16203
+import pkg11.pkg148.m147
+from . import m12132
+
+
+def helper_39224_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39224_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_39224_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,54 @@
+"""Module 49644."""
+import pkg11.pkg144.pkg1881.m39392
+from . import m7964
+import pkg2.pkg33.pkg434.m17105
+from pkg5.pkg68.pkg893 import m892
+import pkg5.pkg77.m6328
+from pkg1.pkg18.pkg246 import m2329
+import pkg9.pkg124.pkg1614.m3697
+from pkg3 import m2
+import pkg4.pkg62.pkg808.m9143
+from pkg4.pkg54.pkg709 import m6960
+import pkg12.pkg157.pkg2049.m2048
+
+
+def helper_49644_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_49644_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_49644_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_49644_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_49644_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_49644_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,23 @@
+"""Module 7964."""
+from . import m1712
+from . import m3796
+import pkg1.m0
+from pkg2.pkg36.pkg471 import m470
+import pkg13.m12
+from pkg5.pkg66 import m2149
+import pkg4.pkg54.m53
+from . import m5880
+
+
+def helper_7964_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7964_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
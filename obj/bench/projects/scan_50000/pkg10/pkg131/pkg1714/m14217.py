@@ -0,0 +1,44 @@
+"""Module 14217."""
+import pkg9.pkg118.pkg1546.m1545
+from pkg5.pkg75.pkg980 import m5147
+import pkg12.pkg158.m157
+from pkg1.pkg25.pkg329 import m328
+import pkg8.pkg105.m2188
+from pkg2.pkg38.pkg497 import m496
+import pkg6.pkg80.m79
+from pkg1.pkg23.pkg303 import m302
+
+
+def helper_14217_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14217_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_14217_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_14217_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_14217_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,36 @@
+"""Module 16301."""
+import pkg11.pkg152.pkg1987.m6154
+from pkg5.pkg75.pkg987 import m7238
+import pkg8.pkg115.pkg1503.m1502
+from pkg9.pkg121.pkg1574 import m16161
+from . import m14217
+from pkg8.pkg108 import m6359
+import pkg10.pkg137.pkg1789.m3872
+
+
+def helper_16301_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16301_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_16301_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_16301_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,40 @@
+"""Module 37141."""
+import pkg6.pkg85.m84
+from pkg7.pkg94.pkg1229 import m22068
+import pkg2.pkg37.pkg485.m484
+from pkg7 import m6
+from . import m18385
+from . import m26721
+from . import m20469
+from pkg4 import m3
+import pkg4.pkg54.pkg703.m4870
+from pkg5.pkg69.pkg898 import m5065
+import pkg8.pkg111.pkg1455.m1454
+
+
+def helper_37141_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37141_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_37141_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_37141_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
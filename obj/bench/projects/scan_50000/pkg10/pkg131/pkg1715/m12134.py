@@ -0,0 +1,25 @@
+"""Module 12134."""
+import pkg10.pkg134.pkg1745.m5912
+from pkg9.pkg128.pkg1675 import m1674
+import pkg2.pkg29.pkg388.m387
+
+
+def helper_12134_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12134_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_12134_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
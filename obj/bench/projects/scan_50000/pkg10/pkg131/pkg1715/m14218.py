@@ -0,0 +1,4 @@
+"""Module 14218."""
+import pkg11.pkg149.pkg1939.m1938
+from pkg10 import m9
+import pkg11.pkg145.pkg1895.m8146
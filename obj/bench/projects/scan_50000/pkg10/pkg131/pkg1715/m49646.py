@@ -0,0 +1,32 @@
+"""Module 49646."""
+from . import m45478
+from pkg7.pkg98 import m48029
+from . import m12134
+from pkg6.pkg89.pkg1160 import m7411
+from . import m22554
+from pkg7.pkg101.pkg1315 import m11734
+import pkg7.pkg93.pkg1218.m19973
+from . import m30890
+import pkg1.pkg25.pkg338.m337
+from pkg8.pkg109 import m108
+
+
+def helper_49646_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_49646_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_49646_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
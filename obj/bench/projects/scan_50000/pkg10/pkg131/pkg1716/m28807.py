@@ -0,0 +1,46 @@
+"""Module 28807."""
+import pkg5.pkg67.pkg877.m876
+from pkg10.pkg137.pkg1786 import m5953
+import pkg1.m0
+from pkg2 import m1
+import pkg8.pkg112.pkg1459.m9794
+from pkg3 import m2
+from . import m7967
+from pkg1.pkg15.pkg199 import m2282
+import pkg1.pkg23.pkg309.m308
+from pkg9.pkg120.pkg1561 import m3644
+
+
+def helper_28807_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_28807_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_28807_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_28807_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_28807_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,35 @@
+"""Module 30891."""
+import pkg4.pkg61.m60
+from pkg5.pkg67.pkg880 import m27971
+import pkg1.pkg18.pkg247.m246
+from pkg9.pkg122.pkg1590 import m3673
+import pkg8.pkg109.pkg1428.m5595
+from pkg12.pkg163 import m14750
+
+
+def helper_30891_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_30891_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_30891_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_30891_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,16 @@
+"""Module 32975."""
+from . import m5883
+from pkg1.pkg15 import m14
+import pkg5.pkg74.pkg963.m25970
+from pkg4.pkg60.pkg788 import m2871
+import pkg11.pkg146.pkg1902.m12321
+from pkg11.pkg153.pkg1996 import m4079
+import pkg7.pkg93.pkg1219.m19974
+from . import m14219
+
+
+def helper_32975_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
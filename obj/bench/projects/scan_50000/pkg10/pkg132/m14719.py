@@ -0,0 +1,48 @@
+"""Module 14719."""
+import pkg13.pkg176.m4343
+from . import m6383
+import pkg8.pkg108.pkg1415.m5582
+from pkg10.pkg135.pkg1764 import m1763
+import pkg11.pkg146.pkg1911.m1910
+from pkg8.pkg116.pkg1511 import m1510
+from . import m12635
+from pkg6.pkg82.pkg1073 import m3156
+import pkg4.pkg63.pkg822.m7073
+from pkg3.pkg45.pkg597 import m596
+import pkg2.m1
+from . import m8467
+
+
+def helper_14719_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14719_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_14719_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_14719_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_14719_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
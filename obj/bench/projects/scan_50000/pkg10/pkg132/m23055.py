@@ -0,0 +1,19 @@
+"""Module 23055."""
+import pkg11.pkg145.pkg1891.m14394
+from pkg11.pkg144.pkg1873 import m1872
+import pkg3.pkg44.pkg579.m6830
+from pkg8.pkg108.pkg1405 import m1404
+
+
+def helper_23055_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_23055_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
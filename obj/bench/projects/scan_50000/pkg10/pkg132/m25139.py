@@ -0,0 +1,13 @@
+"""Module 25139."""
+import pkg4.pkg56.m55
+from pkg9.pkg118.pkg1544 import m11963
+from . import m12635
+from pkg1 import m0
+import pkg4.pkg61.pkg797.m796
+
+
+def helper_25139_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
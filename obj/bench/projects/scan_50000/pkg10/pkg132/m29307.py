@@ -0,0 +1,25 @@
+"""Module 29307."""
+import pkg12.pkg160.pkg2083.m2082
+from pkg4.pkg60.pkg784 import m783
+import pkg8.pkg110.pkg1438.m1437
+
+
+def helper_29307_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_29307_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_29307_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 37643."""
+import pkg12.pkg160.pkg2084.m4167
+from pkg7.pkg98.pkg1287 import m1286
+import pkg2.pkg34.pkg454.m2537
+from pkg2 import m1
+import pkg3.pkg50.pkg655.m8990
+from pkg6.pkg87.pkg1138 import m15725
+import pkg11.m10
+from pkg2.pkg37 import m36
+import pkg8.pkg106.pkg1380.m34723
+from pkg6.pkg86 import m85
+
+
+def helper_37643_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37643_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 4299."""
+from . import m131
+from pkg10.pkg132.pkg1719 import m3802
+from . import m2215
+from pkg6.pkg83.pkg1086 import m1085
+import pkg3.pkg49.pkg647.m2730
+
+
+def helper_4299_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_4299_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,39 @@
+"""Module 45979."""
+from . import m25139
+from pkg5.pkg67.pkg884 import m883
+import pkg9.pkg119.pkg1557.m1556
+from pkg4.pkg57.pkg748 import m15335
+import pkg6.pkg91.pkg1193.m1192
+from pkg2.pkg34.pkg447 import m25454
+import pkg4.pkg58.pkg759.m4926
+from pkg5 import m4
+from . import m4299
+from pkg7.pkg101.pkg1325 import m36752
+
+
+def helper_45979_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_45979_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_45979_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_45979_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
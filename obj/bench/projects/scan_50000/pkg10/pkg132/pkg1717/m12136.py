@@ -0,0 +1,53 @@
+"""Module 12136."""
+import pkg2.pkg39.pkg517.m516
+from pkg5.pkg78.pkg1024 import m1023
+from . import m1716
+from pkg1 import m0
+from . import m5884
+from pkg2.pkg34.pkg444 import m443
+import pkg6.pkg83.pkg1081.m3164
+from pkg3.pkg47.pkg622 import m4789
+import pkg3.m2
+from pkg1.pkg16.pkg216 import m215
+
+
+def helper_12136_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12136_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_12136_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_12136_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_12136_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_12136_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
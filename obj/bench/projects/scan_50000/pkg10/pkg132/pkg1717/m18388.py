@@ -0,0 +1,12 @@
+"""Module 18388."""
+import pkg3.pkg41.pkg545.m544
+from . import m3800
+import pkg12.m11
+from pkg2.pkg35.pkg460 import m17131
+
+
+def helper_18388_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,5 @@
+"""Module 3800."""
+import pkg1.pkg21.pkg275.m274
+from pkg8 import m7
+import pkg6.pkg81.pkg1064.m3147
+from . import m1716
@@ -0,0 +1,54 @@
+"""Module 18389."""
+from . import m12137
+from pkg3.pkg50.pkg652 import m651
+import pkg7.pkg95.pkg1246.m1245
+from pkg12.pkg157 import m156
+import pkg2.pkg28.m27
+from pkg5.pkg72 import m71
+import pkg4.pkg61.pkg794.m793
+from pkg3.pkg46.pkg605 import m604
+from . import m1717
+from pkg1.pkg21.pkg276 import m10695
+import pkg8.pkg108.m10527
+
+
+def helper_18389_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_18389_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_18389_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_18389_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_18389_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_18389_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,39 @@
+"""Module 37145."""
+import pkg1.pkg20.pkg266.m265
+from pkg6.pkg91.pkg1189 import m5356
+import pkg1.m0
+from pkg10.pkg134.pkg1748 import m3831
+import pkg3.pkg45.pkg587.m6838
+from . import m30893
+from . import m28809
+from . import m22557
+import pkg7.pkg95.pkg1236.m3319
+from pkg1.pkg18.pkg238 import m2321
+
+
+def helper_37145_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37145_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_37145_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_37145_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 39229."""
+from . import m10053
+from pkg1.pkg26 import m25
+import pkg8.pkg112.pkg1459.m3542
+from pkg5.pkg68.pkg893 import m25900
+import pkg5.pkg73.pkg951.m7202
+from pkg5.pkg72.pkg945 import m13448
+import pkg9.pkg124.pkg1621.m26628
+from pkg5.pkg73.pkg950 import m5117
+from . import m12137
+from pkg1.pkg16.pkg210 import m209
+import pkg9.pkg130.pkg1696.m22535
+
+
+def helper_39229_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39229_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
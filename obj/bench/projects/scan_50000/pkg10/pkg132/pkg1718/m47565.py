@@ -0,0 +1,19 @@
+"""Module 47565."""
+import pkg5.pkg76.pkg991.m44754
+from pkg11.pkg145.pkg1897 import m10232
+from . import m45481
+from pkg6.pkg91.pkg1194 import m1193
+
+
+def helper_47565_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_47565_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
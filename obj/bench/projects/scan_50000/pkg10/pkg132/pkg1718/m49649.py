@@ -0,0 +1,24 @@
+"""Module 49649."""
+import pkg4.pkg64.pkg835.m13338
+from pkg7.pkg92.pkg1205 import m1204
+import pkg6.pkg84.pkg1096.m1095
+from pkg5.pkg68.pkg896 import m2979
+import pkg2.pkg36.pkg474.m33817
+from pkg1.pkg25.pkg338 import m2421
+from . import m22557
+from pkg10.pkg131 import m130
+import pkg4.pkg57.pkg754.m2837
+
+
+def helper_49649_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_49649_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,43 @@
+"""Module 7969."""
+import pkg1.pkg23.pkg311.m310
+from pkg5.pkg70.pkg914 import m913
+import pkg7.pkg96.pkg1255.m3338
+from pkg1.pkg18 import m17
+from . import m3801
+from pkg3.pkg47 import m46
+import pkg1.pkg26.pkg351.m4518
+
+
+def helper_7969_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7969_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7969_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7969_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_7969_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
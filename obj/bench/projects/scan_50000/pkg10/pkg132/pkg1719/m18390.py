@@ -0,0 +1,27 @@
+"""Module 18390."""
+from . import m12138
+from pkg6 import m5
+import pkg3.pkg43.pkg570.m569
+from pkg3.pkg49.pkg644 import m643
+import pkg1.pkg17.m16
+
+
+def helper_18390_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_18390_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_18390_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
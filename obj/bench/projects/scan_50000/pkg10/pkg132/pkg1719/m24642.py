@@ -0,0 +1,40 @@
+"""Module 24642."""
+import pkg9.pkg122.pkg1587.m1586
+from pkg6.pkg80.pkg1047 import m21886
+from . import m14222
+from pkg5.pkg74.pkg975 import m13478
+from . import m18390
+from pkg4 import m3
+from . import m3802
+from pkg1.pkg24 import m23
+import pkg5.pkg70.pkg921.m920
+from . import m1718
+import pkg11.pkg150.pkg1953.m6120
+
+
+def helper_24642_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_24642_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_24642_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_24642_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
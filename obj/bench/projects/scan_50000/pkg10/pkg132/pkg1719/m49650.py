@@ -0,0 +1,35 @@
+"""Module 49650."""
+from . import m24642
+from pkg1.pkg19.pkg248 import m6499
+import pkg1.m0
+from pkg3.pkg45.pkg593 import m11012
+import pkg10.pkg143.pkg1862.m6029
+from pkg8.pkg109.pkg1427 import m3510
+
+
+def helper_49650_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_49650_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_49650_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_49650_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,37 @@
+"""Module 16307."""
+from . import m7971
+from pkg5.pkg67 import m66
+from . import m5887
+from pkg7.pkg97.pkg1274 import m15861
+import pkg4.pkg61.pkg805.m9140
+from pkg1 import m0
+import pkg12.m11
+from pkg10.pkg135.pkg1763 import m5930
+
+
+def helper_16307_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16307_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_16307_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_16307_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,33 @@
+"""Module 22559."""
+import pkg1.pkg15.pkg201.m200
+from pkg12.pkg159.pkg2077 import m2076
+import pkg3.pkg42.pkg549.m2632
+from pkg4.pkg60.pkg789 import m21628
+import pkg4.m3
+from pkg2.pkg32.pkg429 import m428
+import pkg1.m0
+from . import m14223
+import pkg3.pkg50.pkg655.m11074
+from pkg11.pkg151.pkg1968 import m1967
+import pkg1.pkg24.pkg313.m312
+
+
+def helper_22559_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_22559_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_22559_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 24643."""
+import pkg4.pkg63.m62
+from . import m7971
+from . import m10055
+
+
+def helper_24643_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_24643_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
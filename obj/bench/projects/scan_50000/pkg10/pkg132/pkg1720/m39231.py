@@ -0,0 +1,38 @@
+"""Module 39231."""
+import pkg6.pkg79.pkg1034.m30209
+from pkg1.pkg25.pkg337 import m336
+import pkg1.m0
+from . import m24643
+import pkg10.pkg132.pkg1723.m20478
+from . import m22559
+import pkg9.pkg118.pkg1544.m5711
+from pkg12.pkg157.pkg2047 import m22886
+from . import m5887
+
+
+def helper_39231_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39231_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_39231_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_39231_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,45 @@
+"""Module 41315."""
+import pkg13.pkg175.m8510
+from pkg3.pkg47 import m46
+import pkg11.pkg151.pkg1975.m31150
+from . import m22559
+import pkg3.pkg49.pkg639.m25646
+from pkg6.pkg85.pkg1111 import m3194
+import pkg10.pkg142.pkg1855.m1854
+from pkg2.pkg36.pkg476 import m475
+import pkg11.m10
+
+
+def helper_41315_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_41315_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_41315_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_41315_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_41315_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,30 @@
+"""Module 45483."""
+import pkg8.pkg107.m14694
+from pkg9.pkg124.pkg1625 import m1624
+from . import m10055
+from pkg4.pkg55.pkg724 import m4891
+import pkg1.pkg25.pkg328.m19083
+from pkg3.pkg41.pkg540 import m23463
+import pkg11.m10
+from pkg2.pkg27.pkg352 import m8687
+
+
+def helper_45483_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_45483_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_45483_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,34 @@
+"""Module 47567."""
+import pkg3.pkg47.pkg618.m33961
+from pkg6.pkg85.pkg1109 import m46956
+from . import m14223
+from pkg8.pkg112.pkg1467 import m43146
+import pkg4.pkg56.pkg729.m4896
+from pkg2.pkg32.pkg424 import m6675
+import pkg9.pkg124.pkg1621.m5788
+from . import m41315
+import pkg6.pkg86.pkg1122.m44885
+from pkg4.pkg64.pkg845 import m2928
+import pkg4.pkg56.pkg729.m2812
+from pkg7.pkg93.pkg1216 import m3299
+
+
+def helper_47567_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_47567_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_47567_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
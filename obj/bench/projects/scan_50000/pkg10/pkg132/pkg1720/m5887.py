@@ -0,0 +1,24 @@
+"""Module 5887."""
+from . import m1719
+from pkg5.pkg70.pkg919 import m5086
+import pkg9.pkg124.pkg1615.m3698
+from pkg6.pkg86 import m85
+import pkg1.m0
+from pkg1.pkg25.pkg335 import m334
+import pkg1.pkg15.m2098
+from pkg5.pkg75.pkg988 import m987
+import pkg3.pkg52.pkg686.m685
+
+
+def helper_5887_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5887_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 22560."""
+import pkg6.pkg87.pkg1140.m21979
+from pkg1.pkg20.pkg262 import m6513
+import pkg9.pkg125.pkg1629.m3712
+
+
+def helper_22560_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_22560_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
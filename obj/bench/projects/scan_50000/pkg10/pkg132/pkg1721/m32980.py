@@ -0,0 +1,22 @@
+"""Module 32980."""
+from . import m22560
+from pkg11.pkg146.pkg1900 import m12319
+import pkg1.pkg18.m17
+from pkg10.pkg137 import m136
+from . import m5888
+from pkg9.pkg121.pkg1575 import m1574
+from . import m30896
+
+
+def helper_32980_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_32980_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 3804."""
+import pkg1.pkg17.pkg228.m227
+from pkg11.pkg153 import m2236
+import pkg4.pkg63.m2146
+
+
+def helper_3804_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
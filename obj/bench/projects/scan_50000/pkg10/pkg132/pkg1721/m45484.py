@@ -0,0 +1,39 @@
+"""Module 45484."""
+import pkg10.pkg139.pkg1811.m1810
+from pkg3.pkg45.pkg591 import m33934
+import pkg10.pkg131.pkg1715.m24638
+from . import m5888
+import pkg9.pkg119.m118
+from pkg10.pkg141.pkg1844 import m6011
+from . import m1720
+from pkg13.pkg173 import m172
+import pkg9.pkg129.pkg1679.m24602
+from pkg11 import m10
+
+
+def helper_45484_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_45484_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_45484_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_45484_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 5888."""
+import pkg3.pkg52.pkg677.m676
+from pkg5.pkg71 import m70
+import pkg7.pkg97.pkg1264.m1263
+from pkg2.pkg32.pkg426 import m425
+import pkg4.pkg56.pkg736.m2819
+from pkg1.pkg26.pkg351 import m350
+import pkg2.pkg35.pkg457.m456
+from pkg13 import m12
+import pkg7.pkg94.pkg1230.m3313
+
+
+def helper_5888_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,13 @@
+"""Module 22561."""
+import pkg7.pkg98.pkg1285.m3368
+from pkg1.pkg26.pkg345 import m10764
+from . import m12141
+from pkg3 import m2
+import pkg1.pkg25.pkg335.m10754
+
+
+def helper_22561_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,36 @@
+"""Module 30897."""
+import pkg5.pkg73.pkg955.m19710
+from pkg10.pkg136.pkg1772 import m8023
+from . import m26729
+from pkg10.pkg140.pkg1828 import m3911
+import pkg9.pkg121.pkg1576.m1575
+from pkg3.pkg44.pkg584 import m4751
+import pkg1.pkg19.pkg258.m257
+
+
+def helper_30897_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_30897_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_30897_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_30897_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
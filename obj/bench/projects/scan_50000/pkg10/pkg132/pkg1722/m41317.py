@@ -0,0 +1,38 @@
+"""Module 41317."""
+from . import m39233
+from pkg7.pkg98.pkg1276 import m1275
+import pkg2.pkg28.pkg371.m370
+from . import m5889
+from . import m26729
+from . import m37149
+import pkg3.pkg49.pkg649.m6900
+from pkg3.pkg51.pkg666 import m27757
+from . import m20477
+
+
+def helper_41317_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_41317_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_41317_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_41317_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 5889."""
+from . import m3805
+from pkg1 import m0
+import pkg9.pkg127.pkg1658.m3741
+from pkg1.pkg23.pkg306 import m305
+import pkg6.pkg85.pkg1112.m5279
+
+
+def helper_5889_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5889_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5889_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
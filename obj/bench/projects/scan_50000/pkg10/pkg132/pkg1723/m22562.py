@@ -0,0 +1,34 @@
+"""Module 22562."""
+from . import m18394
+from . import m14226
+import pkg10.pkg138.m137
+from pkg9.pkg121.pkg1575 import m18246
+import pkg6.pkg89.pkg1168.m1167
+from pkg2.pkg34 import m33
+import pkg1.pkg14.pkg193.m192
+from . import m5890
+import pkg3.pkg49.pkg650.m6901
+from . import m10058
+import pkg9.pkg124.pkg1614.m3697
+from pkg4.pkg62.pkg819 import m818
+
+
+def helper_22562_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_22562_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_22562_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
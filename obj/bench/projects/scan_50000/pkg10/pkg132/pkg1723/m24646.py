@@ -0,0 +1,41 @@
+"""Module 24646."""
+import pkg10.pkg136.m8471
+from . import m20478
+import pkg8.pkg111.pkg1446.m11865
+from pkg9.pkg125.pkg1627 import m16214
+import pkg4.pkg57.pkg747.m746
+from . import m16310
+import pkg8.pkg113.pkg1470.m3553
+from pkg7.pkg95.pkg1236 import m22075
+import pkg5.pkg74.pkg972.m17643
+from pkg5.pkg73.pkg955 import m7206
+from . import m7974
+from pkg8.pkg108.pkg1405 import m3488
+
+
+def helper_24646_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_24646_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_24646_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_24646_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 26730."""
+import pkg8.pkg109.pkg1428.m5595
+from pkg1.pkg22 import m21
+
+
+def helper_26730_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_26730_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,38 @@
+"""Module 28814."""
+import pkg11.pkg155.pkg2019.m24942
+from pkg6.pkg80.pkg1048 import m3131
+import pkg1.m0
+from pkg10.pkg136 import m135
+import pkg3.pkg49.pkg650.m4817
+from pkg10.pkg141.pkg1844 import m14347
+from . import m10058
+from pkg7.pkg102.pkg1332 import m1331
+import pkg8.pkg112.pkg1462.m16049
+
+
+def helper_28814_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_28814_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_28814_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_28814_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
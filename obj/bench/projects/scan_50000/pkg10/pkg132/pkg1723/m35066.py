@@ -0,0 +1,17 @@
+"""Module 35066."""
+import pkg2.pkg32.pkg417.m17088
+from pkg13.pkg171 import m170
+import pkg11.pkg148.pkg1931.m1930
+from pkg5.pkg71.pkg936 import m935
+import pkg12.pkg161.m160
+from pkg2 import m1
+import pkg2.pkg37.pkg492.m2575
+from pkg2.pkg30.pkg395 import m394
+from . import m3806
+
+
+def helper_35066_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,21 @@
+"""Module 3806."""
+from . import m1722
+from pkg6.pkg88.pkg1157 import m3240
+import pkg6.pkg81.pkg1054.m3137
+from pkg2 import m1
+import pkg1.pkg17.pkg233.m232
+from pkg2.pkg38 import m37
+
+
+def helper_3806_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3806_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 41318."""
+import pkg12.pkg157.pkg2044.m2043
+from . import m3806
+from . import m37150
+from pkg8.pkg117 import m35544
+import pkg1.pkg25.pkg336.m335
+
+
+def helper_41318_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_41318_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_41318_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,10 @@
+"""Module 49654."""
+import pkg2.pkg35.pkg461.m21300
+from pkg4.pkg53.pkg690 import m689
+
+
+def helper_49654_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
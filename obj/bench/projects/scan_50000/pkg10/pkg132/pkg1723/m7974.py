@@ -0,0 +1,47 @@
+"""Module 7974."""
+import pkg3.pkg42.pkg552.m4719
+from pkg7.pkg92.pkg1201 import m1200
+import pkg8.pkg107.pkg1401.m5568
+from . import m1722
+import pkg4.pkg57.pkg745.m6996
+from pkg1.pkg15 import m14
+import pkg1.pkg22.pkg298.m2381
+from pkg1.pkg24 import m23
+import pkg4.pkg61.pkg801.m2884
+from pkg1.pkg23.pkg307 import m306
+from . import m5890
+
+
+def helper_7974_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7974_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7974_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7974_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_7974_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
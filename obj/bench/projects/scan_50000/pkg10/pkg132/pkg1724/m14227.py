@@ -0,0 +1,14 @@
+"""Module 14227."""
+import pkg6.m5
+from pkg6.pkg81.pkg1057 import m1056
+import pkg7.pkg99.m98
+from pkg5.pkg71.pkg929 import m928
+import pkg4.pkg55.pkg728.m2811
+from pkg3.pkg46 import m45
+
+
+def helper_14227_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,14 @@
+"""Module 24647."""
+import pkg12.pkg158.pkg2059.m6226
+from pkg6.pkg83.pkg1080 import m3163
+import pkg9.pkg130.pkg1698.m12117
+from pkg8.pkg112.pkg1458 import m1457
+import pkg6.pkg82.pkg1068.m23991
+from . import m12143
+
+
+def helper_24647_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
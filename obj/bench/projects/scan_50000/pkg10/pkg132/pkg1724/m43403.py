@@ -0,0 +1,13 @@
+"""Module 43403."""
+import pkg6.pkg84.pkg1093.m30268
+from . import m7975
+import pkg4.pkg53.pkg699.m698
+from pkg7.pkg99.pkg1291 import m20046
+import pkg3.pkg50.pkg652.m651
+
+
+def helper_43403_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
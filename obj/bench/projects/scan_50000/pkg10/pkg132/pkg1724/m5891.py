@@ -0,0 +1,21 @@
+"""Module 5891."""
+from . import m1723
+from pkg1.pkg24.pkg323 import m322
+import pkg4.pkg58.pkg764.m4931
+from pkg2.pkg30.pkg393 import m392
+import pkg2.pkg28.m27
+from pkg2.pkg33.pkg434 import m433
+
+
+def helper_5891_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5891_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 22564."""
+import pkg8.pkg110.pkg1439.m16026
+from . import m5892
+from . import m7976
+from pkg3.pkg43.pkg560 import m8895
+import pkg4.pkg53.pkg698.m2781
+from pkg5.pkg78.pkg1023 import m15610
+import pkg3.pkg52.pkg688.m2771
+from pkg11.pkg156.pkg2041 import m2040
+import pkg13.pkg170.m169
+from . import m10060
+
+
+def helper_22564_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,55 @@
+"""Module 26732."""
+import pkg1.m0
+from . import m18396
+import pkg9.pkg130.pkg1691.m7942
+from pkg8.pkg115.pkg1502 import m3585
+import pkg12.pkg157.pkg2048.m12467
+from pkg9.pkg123.pkg1607 import m3690
+import pkg9.pkg125.pkg1638.m24561
+from pkg2.pkg28.pkg367 import m366
+import pkg11.pkg149.pkg1946.m6113
+from . import m1724
+import pkg4.pkg57.pkg751.m17422
+from pkg5 import m4
+
+
+def helper_26732_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_26732_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_26732_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_26732_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_26732_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_26732_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,69 @@
+"""Module 35068."""
+import pkg1.pkg14.pkg191.m2274
+from pkg5.pkg76.pkg990 import m3073
+import pkg5.pkg67.pkg874.m2957
+from pkg7.pkg96.pkg1255 import m3338
+import pkg10.pkg143.pkg1861.m20616
+from pkg5 import m4
+import pkg3.pkg45.pkg586.m585
+from pkg7.pkg92.pkg1200 import m15787
+import pkg6.pkg81.m80
+from pkg7.pkg97.pkg1273 import m7524
+import pkg8.pkg108.pkg1415.m26422
+from pkg9.pkg120.pkg1561 import m24484
+
+
+def helper_35068_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35068_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_35068_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_35068_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_35068_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_35068_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35068_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_35068_42(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 28817."""
+from . import m14229
+from pkg1.pkg16.pkg216 import m2299
+from . import m7977
+from pkg1.pkg23.pkg308 import m307
+import pkg1.m0
+from pkg10.pkg134.pkg1755 import m18426
+import pkg5.pkg78.m2161
+from . import m3809
+from . import m20481
+from pkg11.pkg149.pkg1950 import m24873
+
+
+def helper_28817_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_28817_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
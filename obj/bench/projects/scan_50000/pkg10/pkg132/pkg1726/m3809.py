@@ -0,0 +1,44 @@
+"""Module 3809."""
+import pkg4.pkg55.pkg718.m717
+from pkg2.pkg28.pkg371 import m370
+import pkg6.pkg88.pkg1156.m1155
+from pkg7.pkg94.pkg1227 import m3310
+import pkg11.pkg146.pkg1911.m1910
+from pkg1.pkg14.pkg192 import m191
+import pkg1.pkg20.pkg269.m268
+from pkg6.pkg90 import m89
+
+
+def helper_3809_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3809_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3809_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3809_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_3809_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,23 @@
+"""Module 41321."""
+import pkg11.pkg147.pkg1918.m8169
+from pkg2.pkg31.pkg412 import m4579
+from . import m10061
+from pkg5.pkg71.pkg925 import m7176
+import pkg1.pkg24.pkg318.m317
+from . import m5893
+import pkg1.pkg14.pkg191.m190
+from pkg3.pkg49.pkg648 import m15235
+
+
+def helper_41321_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_41321_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,52 @@
+"""Module 43405."""
+from . import m5893
+from pkg7.pkg97.pkg1270 import m34613
+import pkg7.pkg97.m2180
+from pkg5.pkg71.pkg934 import m34277
+from . import m37153
+from pkg6.pkg91.pkg1189 import m32448
+import pkg3.pkg52.pkg680.m2763
+from pkg5.pkg72.pkg938 import m40533
+import pkg3.pkg47.pkg615.m614
+
+
+def helper_43405_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_43405_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_43405_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_43405_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_43405_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_43405_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 45489."""
+import pkg6.pkg84.m83
+from . import m22565
+import pkg1.pkg23.pkg309.m4476
+
+
+def helper_45489_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
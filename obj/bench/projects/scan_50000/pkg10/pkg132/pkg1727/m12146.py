@@ -0,0 +1,17 @@
+"""Module 12146."""
+import pkg1.pkg25.m24
+from pkg1 import m0
+import pkg11.pkg145.pkg1896.m6063
+from . import m5894
+import pkg10.pkg137.pkg1782.m3865
+from . import m3810
+import pkg10.pkg132.pkg1718.m5885
+from pkg7.pkg92 import m6343
+import pkg9.pkg128.m127
+
+
+def helper_12146_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,37 @@
+"""Module 14230."""
+from . import m3810
+from pkg8.pkg105.pkg1376 import m1375
+import pkg8.pkg110.pkg1442.m5609
+from pkg11.pkg151.pkg1968 import m1967
+import pkg5.pkg67.pkg876.m2959
+from . import m7978
+import pkg6.pkg84.pkg1105.m1104
+from pkg6.pkg81 import m80
+
+
+def helper_14230_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14230_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_14230_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_14230_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,33 @@
+"""Module 16314."""
+import pkg5.pkg69.pkg898.m2981
+from . import m10062
+from . import m5894
+from . import m12146
+from . import m1726
+from pkg2.pkg30.pkg399 import m398
+import pkg5.pkg69.pkg902.m11321
+from pkg1.pkg24 import m23
+import pkg3.pkg48.m47
+from pkg10.pkg139.pkg1812 import m3895
+import pkg2.pkg34.pkg448.m447
+
+
+def helper_16314_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16314_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_16314_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 18398."""
+import pkg1.pkg25.m24
+from pkg11.pkg153 import m2236
+import pkg1.m0
+from pkg6.pkg86.pkg1124 import m3207
+
+
+def helper_18398_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_18398_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_18398_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
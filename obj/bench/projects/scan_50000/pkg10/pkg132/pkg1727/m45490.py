@@ -0,0 +1,69 @@
+"""Module 45490."""
+import pkg3.m2
+from pkg2.pkg28.pkg372 import m27463
+import pkg7.pkg104.pkg1355.m3438
+from pkg9.pkg124.pkg1616 import m1615
+import pkg10.pkg140.pkg1825.m14328
+from pkg9.pkg127.pkg1656 import m24579
+import pkg4.pkg54.pkg713.m17384
+from pkg7.pkg98.pkg1281 import m36708
+import pkg7.pkg104.pkg1365.m1364
+from . import m3810
+from . import m43406
+from pkg1.pkg24.pkg319 import m318
+
+
+def helper_45490_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_45490_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_45490_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_45490_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_45490_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_45490_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_45490_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_45490_42(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,39 @@
+"""Module 10063."""
+import pkg1.pkg20.pkg271.m270
+from . import m5895
+import pkg3.pkg52.pkg682.m2765
+from . import m3811
+from . import m1727
+from pkg5.pkg78.pkg1016 import m3099
+import pkg3.pkg49.pkg645.m644
+from pkg4.pkg59.pkg776 import m4943
+import pkg1.pkg26.pkg344.m2427
+from pkg9.pkg129 import m128
+
+
+def helper_10063_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10063_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_10063_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_10063_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,10 @@
+"""Module 16315."""
+import pkg10.pkg142.pkg1847.m8098
+from pkg5.pkg69.pkg903 import m9238
+
+
+def helper_16315_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
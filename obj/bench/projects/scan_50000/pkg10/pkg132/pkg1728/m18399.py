@@ -0,0 +1,16 @@
+"""Module 18399."""
+import pkg10.pkg140.pkg1832.m1831
+from pkg4.pkg54.pkg715 import m2798
+import pkg1.m0
+from pkg2.pkg36.pkg479 import m4646
+import pkg9.pkg118.pkg1543.m7794
+from pkg2.pkg37.pkg492 import m491
+import pkg3.m2
+from pkg2.pkg28.pkg370 import m4537
+
+
+def helper_18399_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,5 @@
+"""Module 30903."""
+import pkg12.pkg160.pkg2084.m12503
+from pkg1.pkg25.pkg327 import m326
+import pkg1.pkg16.pkg215.m4382
+from pkg3.pkg48.pkg632 import m631
@@ -0,0 +1,53 @@
+"""Module 32987."""
+import pkg5.pkg71.m70
+from pkg2.pkg32.pkg421 import m6672
+import pkg12.pkg157.pkg2054.m8305
+from pkg6.pkg88.pkg1157 import m21996
+import pkg8.pkg116.pkg1514.m1513
+from . import m12147
+import pkg10.m9
+from . import m1727
+import pkg9.pkg118.pkg1538.m3621
+from pkg4.pkg53.pkg696 import m695
+
+
+def helper_32987_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_32987_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_32987_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_32987_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_32987_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_32987_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,46 @@
+"""Module 49659."""
+import pkg4.pkg53.pkg691.m21530
+from . import m16315
+import pkg5.m4
+from . import m41323
+import pkg10.pkg137.pkg1792.m16379
+from pkg8.pkg109.pkg1426 import m1425
+import pkg6.pkg86.pkg1130.m5297
+from pkg4.pkg63 import m14650
+import pkg9.pkg129.m128
+from pkg4.pkg65.pkg846 import m845
+
+
+def helper_49659_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_49659_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_49659_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_49659_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_49659_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
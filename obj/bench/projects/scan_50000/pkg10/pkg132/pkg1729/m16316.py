@@ -0,0 +1,35 @@
+"""Module 16316."""
+import pkg7.pkg93.pkg1222.m9557
+from pkg3.pkg50.pkg661 import m4828
+import pkg3.pkg46.pkg608.m4775
+from pkg1.pkg14.pkg193 import m2276
+from . import m1728
+from pkg1 import m0
+
+
+def helper_16316_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16316_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_16316_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_16316_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
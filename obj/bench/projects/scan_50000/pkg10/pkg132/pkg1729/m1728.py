@@ -0,0 +1,11 @@
+"""Module 1728."""
+import pkg7.pkg94.pkg1228.m1227
+from pkg7.pkg93.pkg1220 import m1219
+import pkg1.pkg15.pkg200.m199
+
+
+def helper_1728_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
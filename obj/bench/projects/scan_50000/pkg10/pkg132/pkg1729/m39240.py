@@ -0,0 +1,33 @@
+"""Module 39240."""
+from . import m7980
+from pkg7.pkg104.pkg1355 import m1354
+import pkg3.pkg50.pkg654.m653
+from . import m32988
+import pkg12.pkg157.pkg2047.m12466
+from pkg5.pkg78.pkg1024 import m1023
+import pkg4.pkg60.pkg785.m784
+from pkg1.pkg23.pkg310 import m2393
+from . import m35072
+from pkg7.pkg100 import m99
+import pkg6.pkg81.pkg1064.m1063
+
+
+def helper_39240_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39240_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_39240_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
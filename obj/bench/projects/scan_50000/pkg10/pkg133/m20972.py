@@ -0,0 +1,29 @@
+"""Module 20972."""
+from . import m4300
+from pkg7.pkg93.pkg1221 import m1220
+import pkg1.pkg14.pkg195.m194
+from pkg1.pkg21 import m20
+import pkg11.pkg153.pkg2000.m1999
+from pkg7.pkg103.pkg1349 import m3432
+import pkg12.pkg159.pkg2079.m8330
+
+
+def helper_20972_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_20972_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_20972_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,39 @@
+"""Module 48064."""
+import pkg1.m0
+from pkg6.pkg89 import m88
+import pkg5.pkg68.pkg896.m7147
+from pkg9.pkg128.pkg1668 import m41263
+import pkg7.pkg94.pkg1234.m3317
+from pkg6.pkg86.pkg1127 import m40722
+from . import m20972
+from pkg7.pkg103.pkg1347 import m13850
+import pkg8.pkg112.pkg1462.m1461
+from pkg3.pkg45.pkg594 import m11013
+
+
+def helper_48064_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_48064_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_48064_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_48064_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
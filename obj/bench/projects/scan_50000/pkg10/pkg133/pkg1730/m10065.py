@@ -0,0 +1,12 @@
+"""Module 10065."""
+from . import m7981
+from pkg2.pkg31.pkg415 import m414
+from . import m5897
+from pkg4.pkg59.pkg769 import m4936
+
+
+def helper_10065_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,31 @@
+"""Module 14233."""
+import pkg3.m2
+from pkg3.pkg40.pkg527 import m526
+import pkg5.pkg71.pkg927.m11346
+from . import m3813
+import pkg2.pkg27.pkg352.m4519
+from pkg6.pkg91 import m90
+import pkg3.pkg44.pkg577.m4744
+from pkg1.pkg21.pkg282 import m4449
+import pkg9.pkg126.m125
+
+
+def helper_14233_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14233_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_14233_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,33 @@
+"""Module 28821."""
+import pkg10.pkg138.m137
+from pkg11.pkg154 import m8489
+import pkg6.pkg85.pkg1118.m13621
+from . import m7981
+import pkg3.pkg49.pkg649.m4816
+from pkg5.pkg68.pkg887 import m886
+import pkg9.pkg124.m123
+from pkg5.pkg72.pkg942 import m941
+from . import m20485
+from pkg9.pkg124.pkg1613 import m18284
+import pkg1.pkg20.m19
+
+
+def helper_28821_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_28821_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_28821_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,30 @@
+"""Module 18402."""
+import pkg7.pkg102.pkg1334.m5501
+from pkg5.pkg67.pkg874 import m13377
+import pkg3.m2
+from pkg6.pkg79 import m12582
+import pkg1.m0
+from pkg5.pkg69.pkg903 import m11322
+import pkg4.pkg57.pkg745.m744
+from pkg10.pkg135.pkg1764 import m3847
+
+
+def helper_18402_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_18402_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_18402_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
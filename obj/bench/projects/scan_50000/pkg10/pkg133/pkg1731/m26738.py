@@ -0,0 +1,21 @@
+"""Module 26738."""
+import pkg4.pkg61.pkg802.m2885
+from pkg10 import m25017
+import pkg2.pkg33.pkg440.m2523
+from . import m7982
+import pkg1.pkg25.m4192
+from pkg4.pkg58.pkg756 import m755
+
+
+def helper_26738_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_26738_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
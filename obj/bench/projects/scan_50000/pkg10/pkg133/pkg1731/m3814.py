@@ -0,0 +1,12 @@
+"""Module 3814."""
+import pkg7.pkg99.pkg1289.m1288
+from pkg1 import m0
+import pkg4.pkg57.pkg744.m2827
+from pkg3.pkg49.pkg641 import m640
+
+
+def helper_3814_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,43 @@
+"""Module 5898."""
+import pkg4.pkg53.pkg692.m4859
+from pkg8.pkg105 import m4272
+import pkg1.pkg15.pkg196.m195
+from pkg2.pkg33.pkg435 import m434
+from . import m3814
+from pkg11.pkg146.pkg1911 import m1910
+import pkg7.pkg104.pkg1361.m3444
+
+
+def helper_5898_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5898_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5898_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5898_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_5898_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
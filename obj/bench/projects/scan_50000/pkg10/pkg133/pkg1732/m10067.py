@@ -0,0 +1,55 @@
+"""Module 10067."""
+import pkg2.pkg28.pkg376.m375
+from pkg6.pkg83.pkg1086 import m9421
+import pkg2.pkg28.pkg368.m367
+from pkg8.pkg116.pkg1509 import m1508
+import pkg4.pkg55.pkg717.m2800
+from pkg9.pkg130.pkg1701 import m3784
+import pkg2.pkg31.pkg413.m412
+from pkg8.pkg109.pkg1430 import m7681
+import pkg1.pkg19.pkg249.m2332
+from pkg1 import m0
+import pkg4.pkg54.pkg704.m2787
+from pkg4.pkg65.pkg854 import m2937
+
+
+def helper_10067_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10067_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_10067_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_10067_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_10067_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_10067_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 16319."""
+import pkg11.pkg147.pkg1921.m8172
+from pkg7.pkg104.pkg1354 import m15941
+import pkg5.pkg77.pkg1011.m5178
+from pkg6.pkg82.pkg1069 import m1068
+
+
+def helper_16319_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16319_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_16319_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
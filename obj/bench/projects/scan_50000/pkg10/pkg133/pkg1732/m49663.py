@@ -0,0 +1,38 @@
+"""Module 49663."""
+import pkg8.pkg114.pkg1483.m28574
+from pkg13 import m12
+import pkg7.pkg101.pkg1318.m1317
+from pkg10.pkg132.pkg1726 import m1725
+from . import m22571
+from pkg2.pkg36.pkg480 import m6731
+import pkg1.m0
+from . import m45495
+import pkg5.pkg69.pkg900.m19655
+
+
+def helper_49663_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_49663_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_49663_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_49663_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,34 @@
+"""Module 14236."""
+from . import m1732
+from pkg6.pkg91.pkg1196 import m11615
+import pkg1.m0
+from pkg6.pkg86.pkg1120 import m1119
+import pkg7.pkg93.pkg1221.m11640
+from pkg2.pkg38.pkg495 import m494
+import pkg5.pkg73.pkg950.m7201
+from pkg6.pkg83.pkg1090 import m1089
+import pkg10.pkg136.pkg1776.m3859
+from pkg7.pkg99.pkg1293 import m13796
+import pkg11.pkg150.pkg1956.m8207
+from pkg10.pkg135 import m8470
+
+
+def helper_14236_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14236_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_14236_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
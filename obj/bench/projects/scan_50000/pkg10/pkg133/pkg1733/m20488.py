@@ -0,0 +1,45 @@
+"""Module 20488."""
+import pkg11.pkg146.pkg1906.m6073
+from pkg7.pkg97.pkg1262 import m5429
+import pkg2.pkg39.pkg511.m510
+from pkg6.pkg85.pkg1109 import m1108
+import pkg8.pkg112.m111
+from pkg5.pkg66.pkg866 import m2949
+import pkg1.pkg16.pkg217.m216
+from pkg1.pkg19.pkg250 import m249
+from . import m10068
+
+
+def helper_20488_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_20488_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_20488_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_20488_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_20488_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
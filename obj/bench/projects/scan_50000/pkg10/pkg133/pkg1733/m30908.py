@@ -0,0 +1,12 @@
+"""Module 30908."""
+import pkg1.m0
+from . import m7984
+import pkg9.pkg130.pkg1702.m1701
+from pkg3.pkg47.pkg613 import m612
+
+
+def helper_30908_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 35076."""
+import pkg7.pkg95.pkg1241.m28332
+from pkg5.pkg74 import m31333
+import pkg10.pkg135.m134
+from pkg2.pkg39.pkg512 import m6763
+import pkg3.pkg46.pkg600.m2683
+
+
+def helper_35076_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35076_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_35076_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,37 @@
+"""Module 37160."""
+import pkg8.pkg117.pkg1530.m5697
+from pkg12.pkg165 import m164
+import pkg8.pkg106.pkg1391.m5558
+from . import m10068
+import pkg12.pkg157.pkg2043.m33302
+from pkg7.pkg103 import m102
+from . import m20488
+from pkg2.pkg30.pkg391 import m390
+
+
+def helper_37160_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37160_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_37160_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_37160_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 39244."""
+from . import m32992
+from pkg8.pkg115.pkg1506 import m1505
+import pkg1.pkg15.m14
+
+
+def helper_39244_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39244_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
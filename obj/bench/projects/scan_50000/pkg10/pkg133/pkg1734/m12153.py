@@ -0,0 +1,25 @@
+"""Module 12153."""
+import pkg12.pkg157.m156
+from pkg9.pkg130.pkg1702 import m5869
+import pkg1.m0
+from pkg8.pkg107.pkg1398 import m9733
+import pkg8.pkg116.pkg1510.m9845
+from pkg3.pkg52.pkg677 import m4844
+import pkg11.pkg148.pkg1925.m4008
+from . import m5901
+import pkg5.pkg77.m76
+from . import m1733
+
+
+def helper_12153_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12153_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,23 @@
+"""Module 14237."""
+import pkg11.pkg156.pkg2036.m6203
+from . import m3817
+import pkg3.pkg47.pkg620.m6871
+from pkg2.pkg28.pkg365 import m2448
+import pkg1.pkg24.m23
+from pkg4.pkg62.pkg812 import m7063
+import pkg1.pkg18.pkg244.m243
+from . import m10069
+
+
+def helper_14237_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14237_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
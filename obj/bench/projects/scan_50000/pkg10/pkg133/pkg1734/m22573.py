@@ -0,0 +1,54 @@
+"""Module 22573."""
+import pkg2.pkg27.pkg361.m12864
+from pkg10.pkg134.pkg1752 import m16339
+from . import m12153
+from pkg7.pkg92.pkg1204 import m3287
+import pkg1.pkg14.pkg184.m183
+from pkg1.pkg21 import m20
+import pkg8.pkg106.pkg1380.m18051
+from pkg5.pkg70.pkg913 import m21752
+from . import m16321
+from pkg2.pkg31.pkg408 import m407
+import pkg6.pkg86.pkg1123.m1122
+
+
+def helper_22573_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_22573_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_22573_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_22573_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_22573_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_22573_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,61 @@
+"""Module 28825."""
+import pkg11.pkg152.pkg1977.m4060
+from pkg8.pkg109.pkg1421 import m16008
+import pkg3.pkg43.pkg564.m27655
+from . import m3817
+import pkg4.pkg65.pkg857.m15444
+from pkg11.pkg147.pkg1912 import m8163
+import pkg6.pkg80.m79
+from pkg6.pkg91.pkg1185 import m22024
+import pkg6.pkg80.pkg1046.m1045
+from pkg12.pkg158.pkg2065 import m22904
+import pkg5.pkg67.pkg874.m5041
+
+
+def helper_28825_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_28825_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_28825_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_28825_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_28825_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_28825_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_28825_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,35 @@
+"""Module 7985."""
+import pkg3.pkg46.pkg605.m604
+from pkg10.pkg137.pkg1793 import m5960
+import pkg4.pkg62.pkg817.m816
+from pkg8.pkg115.pkg1507 import m3590
+import pkg11.pkg156.pkg2030.m4113
+from pkg6.pkg89.pkg1159 import m1158
+
+
+def helper_7985_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7985_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_7985_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_7985_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 16322."""
+import pkg12.pkg158.pkg2061.m2060
+from pkg6.pkg81.pkg1054 import m13557
+import pkg2.pkg29.pkg379.m378
+from pkg1.pkg20.pkg269 import m12772
+
+
+def helper_16322_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16322_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_16322_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
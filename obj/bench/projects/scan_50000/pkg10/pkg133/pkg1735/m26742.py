@@ -0,0 +1,46 @@
+"""Module 26742."""
+import pkg5.m22928
+from pkg11.pkg148.pkg1927 import m14430
+import pkg5.pkg75.pkg979.m11398
+from pkg11.pkg150.pkg1955 import m20710
+import pkg9.pkg118.pkg1546.m7797
+from . import m5902
+import pkg4.pkg56.pkg736.m2819
+from pkg6.pkg79.pkg1038 import m7289
+import pkg1.pkg24.m23
+from pkg6.pkg88 import m4255
+
+
+def helper_26742_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_26742_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_26742_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_26742_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_26742_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
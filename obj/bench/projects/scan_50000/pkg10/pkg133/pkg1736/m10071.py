@@ -0,0 +1,16 @@
+"""Module 10071."""
+import pkg10.pkg141.m140
+from . import m1735
+import pkg2.pkg34.pkg454.m453
+from pkg11.pkg153.pkg2001 import m2000
+import pkg2.pkg29.pkg378.m377
+from pkg8.pkg111.pkg1446 import m3529
+import pkg3.pkg40.pkg523.m6774
+from pkg1.pkg16 import m15
+
+
+def helper_10071_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
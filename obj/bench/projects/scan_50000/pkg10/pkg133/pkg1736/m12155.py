@@ -0,0 +1,40 @@
+"""Module 12155."""
+from . import m7987
+from pkg10.pkg136.pkg1770 import m1769
+import pkg6.pkg84.pkg1097.m7348
+from pkg2.pkg38.pkg499 import m498
+from . import m5903
+from pkg13.pkg180 import m179
+import pkg6.pkg90.pkg1181.m3264
+from pkg8.pkg106.pkg1382 import m1381
+import pkg1.pkg16.pkg221.m220
+from pkg11.pkg151.pkg1968 import m4051
+import pkg2.pkg29.pkg380.m379
+
+
+def helper_12155_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12155_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_12155_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_12155_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 22575."""
+import pkg11.pkg147.pkg1923.m1922
+from . import m14239
+import pkg12.pkg157.pkg2052.m2051
+
+
+def helper_22575_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
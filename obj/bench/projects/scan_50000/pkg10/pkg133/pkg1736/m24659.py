@@ -0,0 +1,24 @@
+"""Module 24659."""
+from . import m7987
+from . import m12155
+import pkg10.pkg131.pkg1714.m20469
+from . import m10071
+import pkg4.pkg63.pkg828.m13331
+from pkg8.pkg108.pkg1411 import m15998
+import pkg5.pkg68.pkg890.m889
+from pkg1.pkg26 import m25
+import pkg7.pkg95.pkg1240.m1239
+
+
+def helper_24659_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_24659_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 32995."""
+import pkg2.pkg27.pkg354.m353
+from pkg4 import m2087
+import pkg7.pkg97.pkg1273.m1272
+from . import m3819
+from . import m26743
+from . import m18407
+import pkg8.pkg116.pkg1519.m5686
+from pkg6.pkg80.pkg1045 import m15632
+import pkg4.pkg55.pkg721.m2804
+from pkg11.pkg149.pkg1945 import m12364
+import pkg6.pkg79.pkg1037.m3120
+
+
+def helper_32995_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_32995_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
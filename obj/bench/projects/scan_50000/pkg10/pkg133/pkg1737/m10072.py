@@ -0,0 +1,52 @@
+"""Module 10072."""
+import pkg6.pkg90.pkg1179.m5346
+from . import m5904
+import pkg4.pkg54.pkg705.m704
+from pkg6.pkg83.pkg1089 import m3172
+import pkg4.pkg54.pkg710.m709
+from pkg5.pkg72 import m71
+import pkg12.pkg157.pkg2051.m8302
+from pkg2.pkg27.pkg353 import m2436
+import pkg8.pkg111.pkg1447.m3530
+
+
+def helper_10072_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10072_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_10072_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_10072_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_10072_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_10072_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
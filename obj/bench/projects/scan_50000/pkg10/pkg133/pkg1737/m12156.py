@@ -0,0 +1,17 @@
+"""Module 12156."""
+from . import m10072
+from pkg7.pkg103.pkg1347 import m1346
+import pkg1.pkg24.pkg321.m320
+from pkg4.pkg56.pkg737 import m736
+import pkg1.m0
+from pkg2.pkg38.pkg496 import m6747
+import pkg3.pkg44.pkg578.m4745
+from pkg3.pkg47.pkg619 import m618
+import pkg11.pkg152.pkg1988.m1987
+
+
+def helper_12156_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
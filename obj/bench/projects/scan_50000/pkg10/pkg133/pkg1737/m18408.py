@@ -0,0 +1,55 @@
+"""Module 18408."""
+import pkg8.pkg109.pkg1425.m16012
+from . import m1736
+from . import m3820
+from pkg1.pkg25.pkg335 import m334
+from . import m10072
+from pkg11.pkg149 import m6400
+import pkg1.pkg19.pkg256.m255
+from pkg5.pkg70.pkg912 import m911
+import pkg2.pkg32.m4199
+from pkg9.pkg120.pkg1567 import m9902
+import pkg5.pkg69.pkg904.m11323
+from pkg7.pkg102.pkg1331 import m18002
+
+
+def helper_18408_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_18408_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_18408_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_18408_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_18408_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_18408_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,53 @@
+"""Module 26744."""
+import pkg2.pkg27.pkg359.m358
+from . import m12156
+from . import m3820
+from pkg10.pkg131.pkg1704 import m5871
+import pkg9.pkg129.pkg1688.m3771
+from pkg3.pkg44.pkg582 import m21421
+import pkg11.pkg155.pkg2018.m6185
+from . import m22576
+import pkg12.pkg159.pkg2069.m4152
+from pkg7.pkg93.pkg1212 import m17883
+
+
+def helper_26744_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_26744_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_26744_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_26744_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_26744_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_26744_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,13 @@
+"""Module 28828."""
+import pkg9.pkg127.pkg1653.m22492
+from pkg7.pkg98.pkg1279 import m13782
+import pkg7.pkg94.pkg1223.m5390
+from pkg3.pkg49.pkg643 import m2726
+import pkg9.pkg130.pkg1703.m1702
+from pkg6.pkg81.pkg1059 import m1058
+import pkg4.pkg63.pkg827.m11246
+from pkg11.pkg144.pkg1883 import m14386
+from . import m14240
+from pkg9.pkg124.pkg1617 import m3700
+import pkg3.m2
+from pkg11.pkg146.pkg1905 import m12324
@@ -0,0 +1 @@
+"""Module 32996."""
@@ -0,0 +1,25 @@
+"""Module 3820."""
+import pkg5.pkg74.m73
+from pkg3.pkg45.pkg596 import m2679
+import pkg11.pkg147.pkg1924.m1923
+from pkg3.pkg48.pkg631 import m630
+import pkg10.pkg131.pkg1709.m1708
+from pkg1.pkg22.pkg296 import m295
+import pkg10.pkg132.pkg1717.m3800
+from pkg1.pkg21.pkg285 import m284
+from . import m1736
+from pkg6.pkg89.pkg1159 import m1158
+
+
+def helper_3820_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3820_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,54 @@
+"""Module 5904."""
+import pkg2.pkg29.m28
+from pkg6.pkg89.pkg1168 import m1167
+import pkg3.pkg49.pkg647.m4814
+from pkg7.pkg97.pkg1268 import m3351
+from . import m3820
+from . import m1736
+import pkg5.pkg76.pkg1001.m3084
+from pkg9.pkg120.pkg1573 import m3656
+import pkg1.m0
+from pkg6 import m5
+import pkg1.pkg14.pkg190.m4357
+
+
+def helper_5904_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5904_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5904_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5904_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_5904_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_5904_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,52 @@
+"""Module 22577."""
+import pkg1.pkg26.pkg345.m344
+from pkg3.pkg41.pkg545 import m2628
+import pkg4.pkg53.pkg695.m6946
+from pkg2.pkg32.pkg419 import m418
+from . import m1737
+from pkg8.pkg109.pkg1430 import m1429
+import pkg1.m0
+from pkg7 import m6
+import pkg8.pkg116.pkg1518.m1517
+
+
+def helper_22577_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_22577_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_22577_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_22577_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_22577_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_22577_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
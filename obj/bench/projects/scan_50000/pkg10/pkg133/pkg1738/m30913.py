@@ -0,0 +1,10 @@
+"""Module 30913."""
+import pkg6.m5
+from pkg10.pkg133.pkg1730 import m14233
+
+
+def helper_30913_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,39 @@
+"""Module 49669."""
+import pkg3.pkg47.pkg612.m611
+from pkg7.pkg100.pkg1301 import m13804
+import pkg9.pkg125.pkg1637.m14140
+from pkg4.pkg60.pkg786 import m9121
+from . import m1737
+from pkg8.pkg109.pkg1423 import m26430
+import pkg1.m0
+from pkg6.pkg90.pkg1180 import m11599
+import pkg4.pkg54.pkg709.m40304
+from . import m47585
+
+
+def helper_49669_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_49669_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_49669_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_49669_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
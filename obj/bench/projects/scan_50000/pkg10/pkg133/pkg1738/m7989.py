@@ -0,0 +1,9 @@
+"""Module 7989."""
+import pkg2.pkg27.m26
+
+
+def helper_7989_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
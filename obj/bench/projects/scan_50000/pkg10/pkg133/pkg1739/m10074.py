@@ -0,0 +1,21 @@
+"""Module 10074."""
+import pkg1.m0
+from pkg1.pkg16.pkg219 import m218
+import pkg4.pkg59.pkg769.m4936
+from . import m3822
+import pkg7.pkg92.pkg1200.m1199
+from pkg7.pkg97.pkg1274 import m5441
+
+
+def helper_10074_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10074_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,8 @@
+"""Module 12158."""
+import pkg8.pkg115.pkg1499.m1498
+from . import m7990
+from . import m3822
+from pkg1 import m0
+import pkg9.pkg125.pkg1627.m1626
+from pkg5.pkg68.pkg888 import m9223
+import pkg4.pkg59.pkg776.m4943
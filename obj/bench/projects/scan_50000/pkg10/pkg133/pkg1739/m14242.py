@@ -0,0 +1,40 @@
+"""Module 14242."""
+import pkg8.pkg114.pkg1486.m13989
+from pkg11.pkg152.pkg1978 import m6145
+from . import m12158
+from pkg12.pkg167 import m2250
+import pkg1.pkg22.pkg288.m6539
+from pkg11.pkg155.pkg2023 import m4106
+import pkg2.pkg29.pkg388.m387
+from pkg9.pkg128 import m127
+import pkg1.m0
+from pkg2.pkg39.pkg516 import m6767
+import pkg2.pkg28.pkg367.m12870
+
+
+def helper_14242_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14242_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_14242_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_14242_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
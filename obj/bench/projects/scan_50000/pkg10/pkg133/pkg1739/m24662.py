@@ -0,0 +1,24 @@
+"""Module 24662."""
+import pkg3.pkg44.m4211
+from pkg5.pkg72.pkg942 import m23865
+import pkg2.pkg33.m32
+from . import m10074
+import pkg1.pkg19.pkg251.m2334
+from pkg6.pkg83.pkg1092 import m5259
+import pkg3.pkg50.pkg655.m2738
+from pkg1.pkg21.pkg280 import m279
+import pkg1.m0
+
+
+def helper_24662_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_24662_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
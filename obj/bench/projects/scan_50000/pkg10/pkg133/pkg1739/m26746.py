@@ -0,0 +1,62 @@
+"""Module 26746."""
+import pkg1.pkg20.m2103
+from pkg8.pkg106.pkg1386 import m9721
+import pkg13.pkg180.m179
+from pkg5.pkg68.pkg896 import m7147
+import pkg12.pkg168.m16839
+from . import m18410
+import pkg2.pkg29.pkg384.m12887
+from pkg1.pkg16.pkg221 import m220
+import pkg1.pkg22.pkg288.m16959
+from . import m1738
+import pkg5.pkg69.pkg900.m13403
+from pkg1 import m0
+
+
+def helper_26746_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_26746_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_26746_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_26746_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_26746_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_26746_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_26746_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,54 @@
+"""Module 41334."""
+from . import m37166
+from pkg1 import m0
+import pkg8.pkg110.pkg1435.m3518
+from pkg6.pkg89.pkg1160 import m1159
+import pkg5.pkg67.pkg879.m11298
+from . import m18410
+import pkg9.pkg122.pkg1599.m1598
+from pkg5.pkg69.pkg899 import m898
+import pkg4.pkg56.pkg734.m6985
+from pkg5.pkg73.pkg953 import m28044
+import pkg1.pkg24.pkg313.m8648
+
+
+def helper_41334_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_41334_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_41334_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_41334_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_41334_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_41334_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
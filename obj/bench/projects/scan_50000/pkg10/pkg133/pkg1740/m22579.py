@@ -0,0 +1,45 @@
+"""Module 22579."""
+from . import m20495
+from pkg1.pkg23.pkg309 import m2392
+from . import m18411
+from pkg8.pkg117 import m4284
+import pkg7.pkg95.pkg1240.m5407
+from pkg5.pkg68.pkg888 import m2971
+import pkg10.pkg143.pkg1860.m14363
+from pkg1 import m0
+import pkg10.pkg140.m139
+
+
+def helper_22579_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_22579_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_22579_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_22579_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_22579_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
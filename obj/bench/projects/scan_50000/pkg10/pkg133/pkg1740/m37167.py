@@ -0,0 +1,36 @@
+"""Module 37167."""
+import pkg3.m2
+from pkg6.pkg89.pkg1165 import m26172
+import pkg1.pkg21.m20
+from pkg3.pkg51 import m50
+import pkg3.pkg48.pkg629.m8964
+from pkg8 import m7
+from . import m5907
+
+
+def helper_37167_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37167_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_37167_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_37167_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
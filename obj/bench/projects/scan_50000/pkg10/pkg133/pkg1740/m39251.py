@@ -0,0 +1,48 @@
+"""Module 39251."""
+import pkg3.pkg50.pkg662.m19417
+from pkg6.pkg90.pkg1175 import m9510
+import pkg10.pkg135.pkg1764.m5931
+from pkg8.pkg109.pkg1422 import m1421
+import pkg7.pkg100.pkg1312.m1311
+from pkg10.pkg131.pkg1706 import m3789
+import pkg5.pkg72.pkg941.m34284
+from . import m7991
+import pkg4.pkg56.pkg739.m738
+from pkg9.pkg130.pkg1701 import m7952
+from . import m1739
+from pkg3.pkg52.pkg677 import m676
+
+
+def helper_39251_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39251_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_39251_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_39251_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_39251_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
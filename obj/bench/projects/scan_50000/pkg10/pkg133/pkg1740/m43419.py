@@ -0,0 +1,20 @@
+"""Module 43419."""
+import pkg8.pkg105.pkg1378.m1377
+from . import m12159
+import pkg2.pkg35.pkg467.m12970
+from pkg7.pkg103.pkg1340 import m26347
+import pkg10.pkg139.pkg1816.m3899
+
+
+def helper_43419_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_43419_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,39 @@
+"""Module 45503."""
+import pkg11.pkg148.m147
+from . import m12159
+from . import m32999
+from . import m5907
+import pkg10.pkg136.pkg1774.m3857
+from . import m30915
+import pkg6.pkg90.pkg1181.m1180
+from . import m18411
+import pkg11.pkg148.pkg1931.m14434
+from . import m14243
+
+
+def helper_45503_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_45503_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_45503_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_45503_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,28 @@
+"""Module 5907."""
+from . import m3823
+from pkg10.pkg135.pkg1765 import m3848
+import pkg1.pkg26.pkg347.m346
+from pkg5.pkg75.pkg982 import m981
+import pkg4.pkg64.m63
+from pkg4 import m3
+
+
+def helper_5907_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5907_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5907_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,37 @@
+"""Module 35084."""
+import pkg1.pkg15.pkg207.m206
+from pkg7.pkg99.pkg1288 import m13791
+import pkg8.pkg106.pkg1379.m32638
+from pkg1.pkg26 import m25
+import pkg4.pkg54.pkg708.m707
+from pkg1.pkg23.pkg305 import m4472
+import pkg2.pkg38.m37
+from . import m7992
+
+
+def helper_35084_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35084_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_35084_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_35084_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,13 @@
+"""Module 3824."""
+import pkg8.pkg117.pkg1531.m1530
+from pkg5.pkg66.pkg868 import m2951
+import pkg3.pkg42.pkg548.m547
+from pkg10 import m9
+import pkg1.pkg25.pkg329.m328
+
+
+def helper_3824_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
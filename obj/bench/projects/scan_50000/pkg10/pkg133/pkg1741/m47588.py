@@ -0,0 +1,31 @@
+"""Module 47588."""
+import pkg11.pkg145.pkg1896.m3979
+from pkg2.pkg32.pkg417 import m416
+from . import m45504
+from . import m16328
+import pkg8.pkg107.m106
+from pkg2.pkg30 import m29
+import pkg1.pkg16.pkg218.m4385
+from pkg1.pkg14 import m13
+import pkg6.pkg82.pkg1068.m11487
+
+
+def helper_47588_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_47588_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_47588_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
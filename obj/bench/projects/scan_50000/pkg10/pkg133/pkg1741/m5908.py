@@ -0,0 +1,39 @@
+"""Module 5908."""
+import pkg8.pkg107.pkg1397.m3480
+from pkg7.pkg92.pkg1203 import m1202
+import pkg2.pkg34.m33
+from pkg3.pkg49.pkg646 import m4813
+import pkg2.pkg35.pkg468.m467
+from pkg10.pkg141.pkg1837 import m1836
+from . import m3824
+from pkg3.pkg40.pkg526 import m525
+import pkg7.pkg102.pkg1332.m5499
+from pkg1.pkg18 import m17
+
+
+def helper_5908_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5908_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5908_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5908_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
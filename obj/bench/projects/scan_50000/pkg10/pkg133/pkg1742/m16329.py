@@ -0,0 +1,34 @@
+"""Module 16329."""
+import pkg9.pkg121.pkg1582.m3665
+from pkg4.pkg55 import m54
+import pkg6.pkg91.pkg1186.m5353
+from pkg2.pkg37.pkg492 import m15079
+import pkg7.m6
+
+
+def helper_16329_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16329_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_16329_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_16329_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 22581."""
+import pkg12.pkg158.pkg2067.m12486
+from pkg9.pkg129 import m128
+import pkg5.pkg76.pkg997.m3080
+
+
+def helper_22581_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
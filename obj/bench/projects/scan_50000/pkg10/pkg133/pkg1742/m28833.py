@@ -0,0 +1,18 @@
+"""Module 28833."""
+import pkg1.pkg19.pkg256.m14843
+from . import m5909
+import pkg12.pkg158.pkg2066.m6233
+
+
+def helper_28833_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_28833_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,9 @@
+"""Module 45505."""
+import pkg4.pkg64.m4231
+
+
+def helper_45505_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
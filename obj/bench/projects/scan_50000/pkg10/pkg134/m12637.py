@@ -0,0 +1,14 @@
+"""Module 12637."""
+import pkg5.pkg70.pkg922.m5089
+from pkg3.pkg40.pkg524 import m2607
+import pkg5.pkg76.pkg989.m988
+from pkg2.pkg31 import m30
+import pkg11.pkg154.pkg2011.m2010
+from pkg8.pkg106.pkg1385 import m3468
+
+
+def helper_12637_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
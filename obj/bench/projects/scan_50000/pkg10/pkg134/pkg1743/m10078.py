@@ -0,0 +1,27 @@
+"""Module 10078."""
+import pkg6.pkg79.pkg1030.m1029
+from pkg1.pkg22.pkg295 import m6546
+import pkg4.pkg62.pkg807.m9142
+from pkg5.pkg66.pkg865 import m2948
+import pkg3.pkg45.pkg586.m585
+
+
+def helper_10078_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10078_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_10078_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
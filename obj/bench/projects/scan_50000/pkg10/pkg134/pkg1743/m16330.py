@@ -0,0 +1,27 @@
+"""Module 16330."""
+import pkg9.pkg123.pkg1611.m1610
+from pkg6.pkg86.pkg1127 import m5294
+import pkg1.pkg16.m15
+from pkg7.pkg94.pkg1225 import m7476
+from . import m1742
+
+
+def helper_16330_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16330_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_16330_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,6 @@
+"""Module 26750."""
+import pkg3.pkg47.pkg613.m2696
+from pkg8.pkg117.pkg1523 import m3606
+import pkg3.pkg47.pkg619.m6870
+from pkg3.pkg47.pkg622 import m4789
+import pkg2.pkg35.pkg465.m464
@@ -0,0 +1,40 @@
+"""Module 35086."""
+import pkg10.m9
+from . import m28834
+import pkg2.pkg33.pkg433.m10852
+from pkg10.pkg137.pkg1786 import m30961
+import pkg9.pkg129.pkg1680.m10015
+from pkg4.pkg54.pkg704 import m2787
+from . import m26750
+from . import m12162
+import pkg3.pkg41.pkg537.m2620
+from pkg4 import m3
+from . import m33002
+
+
+def helper_35086_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35086_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_35086_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_35086_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,53 @@
+"""Module 39254."""
+from . import m37170
+from pkg4.pkg53.pkg694 import m13197
+import pkg7.pkg93.pkg1221.m3304
+from pkg1.pkg15.pkg205 import m6456
+from . import m3826
+from pkg1.pkg19.pkg258 import m257
+import pkg9.pkg125.pkg1637.m22476
+from pkg1.pkg24.pkg321 import m4488
+import pkg7.pkg102.m101
+from pkg5.pkg78.pkg1027 import m1026
+
+
+def helper_39254_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39254_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_39254_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_39254_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_39254_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_39254_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
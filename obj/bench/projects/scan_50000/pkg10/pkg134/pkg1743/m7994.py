@@ -0,0 +1,22 @@
+"""Module 7994."""
+import pkg1.pkg17.m16
+from . import m5910
+import pkg6.pkg83.pkg1084.m5251
+from pkg9.pkg118 import m6369
+import pkg4.pkg60.pkg791.m790
+from pkg4.pkg60 import m59
+import pkg4.pkg62.pkg818.m2901
+
+
+def helper_7994_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_7994_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 10079."""
+import pkg2.pkg30.m29
+from pkg8.pkg116.pkg1519 import m9854
+from . import m1743
+
+
+def helper_10079_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,35 @@
+"""Module 12163."""
+import pkg1.m0
+from pkg6.pkg80 import m79
+import pkg9.pkg122.pkg1599.m1598
+from pkg1.pkg20.pkg267 import m8602
+import pkg12.pkg157.pkg2048.m2047
+from . import m3827
+
+
+def helper_12163_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12163_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_12163_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_12163_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
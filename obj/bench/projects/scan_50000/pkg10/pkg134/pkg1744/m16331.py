@@ -0,0 +1,30 @@
+"""Module 16331."""
+import pkg1.pkg18.pkg244.m243
+from . import m5911
+import pkg7.pkg94.pkg1235.m5402
+from pkg1 import m0
+import pkg10.pkg137.pkg1784.m8035
+from pkg1.pkg25.pkg335 import m8670
+import pkg6.pkg84.pkg1097.m1096
+from pkg6.pkg80.pkg1053 import m13556
+
+
+def helper_16331_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16331_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_16331_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,47 @@
+"""Module 18415."""
+from . import m16331
+from pkg1.pkg15.pkg205 import m2288
+import pkg8.pkg111.pkg1450.m11869
+from . import m5911
+import pkg3.pkg52.m51
+from pkg7.pkg95.pkg1240 import m5407
+import pkg12.pkg160.pkg2081.m2080
+from pkg5.pkg75.pkg982 import m7233
+import pkg1.pkg18.m4185
+from pkg2.pkg27.pkg361 import m360
+from . import m3827
+
+
+def helper_18415_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_18415_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_18415_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_18415_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_18415_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 20499."""
+import pkg4.pkg54.pkg705.m2788
+from pkg1 import m0
+import pkg1.pkg21.pkg279.m278
+from . import m18415
+import pkg1.pkg24.pkg315.m314
+from pkg4.pkg53.pkg701 import m6952
+import pkg8.pkg114.pkg1492.m3575
+from pkg8.pkg106.pkg1383 import m1382
+import pkg2.pkg28.pkg377.m8712
+from pkg2.pkg32.pkg425 import m424
+import pkg8.pkg117.pkg1524.m5691
+from pkg8.pkg113.pkg1481 import m18152
+
+
+def helper_20499_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_20499_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 35087."""
+import pkg2.pkg30.pkg403.m19158
+from pkg9.pkg120.pkg1562 import m16149
+import pkg1.pkg26.pkg346.m345
+from pkg5.pkg74.pkg972 import m13475
+from . import m20499
+from pkg5.pkg78.pkg1020 import m26027
+import pkg5.pkg70.pkg918.m3001
+from pkg1 import m0
+import pkg10.pkg143.pkg1862.m10197
+from . import m22583
+import pkg10.pkg135.pkg1758.m3841
+
+
+def helper_35087_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
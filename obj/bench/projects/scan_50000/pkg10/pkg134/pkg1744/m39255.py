@@ -0,0 +1,23 @@
+"""Module 39255."""
+import pkg4.pkg57.pkg754.m753
+from pkg2.pkg33 import m32
+import pkg1.m0
+from pkg8.pkg106.pkg1381 import m3464
+import pkg4.pkg64.pkg844.m11263
+from pkg1.pkg20 import m4187
+from . import m20499
+from . import m1743
+
+
+def helper_39255_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39255_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 14248."""
+import pkg3.pkg49.pkg642.m6893
+from pkg1 import m0
+from . import m1744
+from . import m5912
+import pkg8.pkg105.m104
+
+
+def helper_14248_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14248_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_14248_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,32 @@
+"""Module 16332."""
+import pkg4.pkg56.pkg740.m739
+from . import m12164
+import pkg2.pkg38.pkg497.m496
+from pkg1.pkg20.pkg268 import m4435
+import pkg2.pkg37.pkg489.m6740
+from pkg2.pkg37.pkg494 import m493
+import pkg7.pkg104.m103
+from pkg2.pkg31.pkg415 import m414
+import pkg2.pkg37.pkg493.m8828
+from pkg13 import m12
+
+
+def helper_16332_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16332_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_16332_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
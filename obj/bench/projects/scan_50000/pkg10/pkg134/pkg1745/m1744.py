@@ -0,0 +1,34 @@
+"""Module 1744."""
+import pkg1.pkg25.pkg332.m331
+from pkg2.pkg31.pkg415 import m414
+import pkg9.pkg128.m127
+from pkg6.pkg79.pkg1032 import m1031
+import pkg5.pkg72.m71
+from pkg8.pkg107.pkg1398 import m1397
+import pkg9.pkg126.pkg1650.m1649
+from pkg4.pkg62.pkg807 import m806
+import pkg1.pkg18.m17
+from pkg5.pkg69.pkg908 import m907
+import pkg1.m0
+from pkg8 import m7
+
+
+def helper_1744_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1744_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1744_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,12 @@
+"""Module 30920."""
+import pkg3.pkg44.m8379
+from pkg1.pkg22.pkg291 import m290
+import pkg3.pkg44.pkg585.m17256
+from pkg12.pkg158.pkg2066 import m18737
+import pkg8.pkg110.pkg1441.m3524
+from pkg5.pkg77.pkg1005 import m17676
+import pkg3.pkg41.m40
+from pkg8.pkg109.pkg1421 import m1420
+import pkg2.pkg38.pkg499.m498
+from pkg7.pkg102.pkg1334 import m3417
+from . import m18416
@@ -0,0 +1,22 @@
+"""Module 35088."""
+import pkg6.pkg79.pkg1030.m1029
+from pkg4.pkg56.pkg739 import m738
+import pkg5.pkg77.pkg1005.m3088
+from pkg1.pkg24.pkg317 import m316
+from . import m16332
+from . import m26752
+import pkg11.pkg153.pkg1990.m1989
+
+
+def helper_35088_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35088_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
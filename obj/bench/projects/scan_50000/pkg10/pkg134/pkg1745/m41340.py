@@ -0,0 +1,32 @@
+"""Module 41340."""
+import pkg1.pkg18.pkg236.m33579
+from pkg7.pkg97.pkg1263 import m3346
+import pkg11.pkg154.pkg2008.m8259
+from pkg8.pkg114.pkg1490 import m9825
+from . import m16332
+from pkg2.pkg35.pkg462 import m17133
+from . import m12164
+from pkg2.pkg37.pkg494 import m493
+import pkg2.m1
+from pkg8.pkg112.pkg1463 import m13966
+
+
+def helper_41340_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_41340_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_41340_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,47 @@
+"""Module 14249."""
+from . import m7997
+from pkg10.pkg138.pkg1801 import m3884
+import pkg2.pkg30.m29
+from pkg2.pkg33.pkg434 import m2517
+import pkg3.pkg46.pkg603.m602
+from pkg1.pkg20.pkg267 import m2350
+import pkg11.pkg150.pkg1954.m10289
+from pkg2.pkg29.pkg382 import m381
+import pkg1.pkg18.m17
+from pkg3 import m2
+import pkg9.pkg120.pkg1572.m5739
+
+
+def helper_14249_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14249_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_14249_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_14249_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_14249_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
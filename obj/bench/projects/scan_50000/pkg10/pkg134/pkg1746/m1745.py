@@ -0,0 +1 @@
+"""Module 1745."""
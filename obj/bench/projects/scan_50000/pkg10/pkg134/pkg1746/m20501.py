@@ -0,0 +1,21 @@
+"""Module 20501."""
+import pkg2.pkg32.pkg428.m6679
+from pkg2 import m1
+from . import m3829
+from pkg7.pkg99.pkg1292 import m7543
+import pkg4.m6255
+from . import m16333
+
+
+def helper_20501_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_20501_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
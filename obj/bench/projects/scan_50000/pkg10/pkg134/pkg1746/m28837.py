@@ -0,0 +1,9 @@
+"""Module 28837."""
+import pkg10.pkg138.pkg1800.m12219
+
+
+def helper_28837_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
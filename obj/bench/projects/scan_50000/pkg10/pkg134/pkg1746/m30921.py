@@ -0,0 +1,8 @@
+"""Module 30921."""
+import pkg3.m2
+from . import m14249
+import pkg7.pkg94.pkg1226.m5393
+from pkg2.pkg34 import m25041
+import pkg1.m0
+from . import m26753
+import pkg8.pkg106.pkg1384.m1383
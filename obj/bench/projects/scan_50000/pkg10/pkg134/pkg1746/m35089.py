@@ -0,0 +1,47 @@
+"""Module 35089."""
+import pkg9.pkg130.pkg1693.m14196
+from pkg9.pkg124.pkg1620 import m28711
+import pkg2.pkg33.pkg440.m2523
+from pkg1 import m0
+import pkg5.pkg68.pkg889.m13392
+from pkg3.pkg51.pkg673 import m672
+from . import m24669
+from pkg6.pkg89.pkg1158 import m7409
+from . import m28837
+from pkg9.pkg124.pkg1613 import m5780
+from . import m20501
+
+
+def helper_35089_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35089_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_35089_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_35089_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_35089_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,44 @@
+"""Module 10082."""
+import pkg5.pkg75.pkg982.m5149
+from pkg4.pkg53.pkg702 import m9037
+import pkg3.pkg45.m44
+from pkg1 import m0
+import pkg11.pkg146.pkg1911.m1910
+from pkg5.pkg76 import m75
+import pkg11.pkg149.m6400
+from pkg1.pkg26.pkg342 import m341
+
+
+def helper_10082_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10082_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_10082_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_10082_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_10082_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
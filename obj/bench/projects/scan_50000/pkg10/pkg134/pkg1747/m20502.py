@@ -0,0 +1,18 @@
+"""Module 20502."""
+import pkg12.pkg158.pkg2061.m2060
+from pkg9.pkg129.pkg1685 import m5852
+import pkg12.m11
+from pkg6.pkg86.pkg1124 import m3207
+import pkg3.pkg48.pkg626.m625
+from pkg8.pkg112 import m2195
+import pkg9.pkg121.pkg1579.m1578
+from pkg6.pkg85 import m84
+import pkg8.pkg108.pkg1416.m3499
+from pkg11.pkg155.pkg2019 import m2018
+
+
+def helper_20502_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
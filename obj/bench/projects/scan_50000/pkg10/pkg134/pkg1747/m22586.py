@@ -0,0 +1,21 @@
+"""Module 22586."""
+import pkg7.pkg92.pkg1209.m22048
+from . import m5914
+import pkg3.pkg49.m48
+from pkg7.pkg92 import m12595
+import pkg3.pkg45.pkg595.m594
+from pkg11.pkg154.pkg2008 import m8259
+
+
+def helper_22586_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_22586_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
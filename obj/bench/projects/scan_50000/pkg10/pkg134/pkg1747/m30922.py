@@ -0,0 +1,39 @@
+"""Module 30922."""
+import pkg3.pkg43.pkg571.m6822
+from pkg2.pkg36 import m35
+from . import m20502
+from . import m10082
+from . import m12166
+from pkg1.pkg21.pkg280 import m279
+import pkg4.pkg57.pkg754.m753
+from pkg6.pkg82.pkg1070 import m1069
+import pkg9.pkg122.pkg1593.m16180
+from pkg3.pkg44.pkg575 import m574
+
+
+def helper_30922_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_30922_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_30922_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_30922_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
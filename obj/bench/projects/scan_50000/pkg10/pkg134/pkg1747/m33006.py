@@ -0,0 +1,37 @@
+"""Module 33006."""
+import pkg1.m0
+from pkg1.pkg16.pkg221 import m27312
+import pkg9.pkg127.pkg1661.m5828
+from pkg5.pkg73.pkg961 import m960
+import pkg3.pkg40.pkg528.m10947
+from pkg11.pkg145.pkg1897 import m18568
+import pkg10.pkg139.pkg1813.m16400
+from pkg11.pkg149.pkg1944 import m20699
+
+
+def helper_33006_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_33006_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_33006_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_33006_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
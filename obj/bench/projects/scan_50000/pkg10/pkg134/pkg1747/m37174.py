@@ -0,0 +1 @@
+"""Module 37174."""
@@ -0,0 +1,61 @@
+"""Module 47594."""
+import pkg2.pkg30.m29
+from pkg7.pkg96.pkg1256 import m11675
+import pkg7.pkg99.pkg1291.m3374
+from pkg2.pkg28.pkg373 import m372
+import pkg12.pkg159.pkg2071.m24994
+from pkg8.pkg108.pkg1417 import m3500
+import pkg4.pkg55.pkg718.m717
+from pkg1.pkg25.pkg328 import m37839
+import pkg11.pkg147.pkg1914.m8165
+from . import m16334
+import pkg8.pkg110.m2193
+
+
+def helper_47594_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_47594_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_47594_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_47594_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_47594_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_47594_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_47594_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
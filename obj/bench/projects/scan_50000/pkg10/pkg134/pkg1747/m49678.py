@@ -0,0 +1,20 @@
+"""Module 49678."""
+import pkg9.pkg118.pkg1546.m34889
+from . import m41342
+from . import m10082
+from pkg7.pkg95.pkg1246 import m1245
+from . import m22586
+
+
+def helper_49678_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_49678_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,36 @@
+"""Module 5914."""
+import pkg9.pkg122.pkg1590.m1589
+from pkg10.pkg135.pkg1766 import m3849
+import pkg2.pkg28.pkg365.m364
+from pkg5.pkg69.pkg907 import m906
+import pkg10.pkg138.m137
+from . import m3830
+import pkg9.pkg128.pkg1667.m1666
+
+
+def helper_5914_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5914_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5914_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5914_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,9 @@
+"""Module 16335."""
+import pkg5.pkg78.pkg1024.m5191
+from pkg5.pkg69.pkg910 import m9245
+from . import m10083
+from pkg1.pkg21.pkg286 import m285
+import pkg1.m0
+from . import m12167
+import pkg6.pkg88.m87
+from pkg4.pkg59.pkg775 import m774
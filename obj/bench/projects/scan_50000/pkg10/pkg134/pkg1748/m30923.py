@@ -0,0 +1,17 @@
+"""Module 30923."""
+import pkg5.pkg77.pkg1013.m3096
+from pkg9.pkg125.pkg1634 import m7885
+import pkg2.pkg27.m4194
+from pkg3.pkg45.pkg593 import m17264
+import pkg4.pkg56.pkg731.m730
+from pkg4.pkg64.pkg833 import m15420
+import pkg11.pkg154.pkg2004.m2003
+from . import m3831
+import pkg3.pkg45.pkg586.m585
+
+
+def helper_30923_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,34 @@
+"""Module 33007."""
+import pkg3.pkg48.m47
+from pkg1.pkg14.pkg183 import m182
+import pkg3.pkg50.m49
+from pkg5.pkg67.pkg881 import m880
+import pkg1.pkg26.m25
+from pkg4.pkg55.pkg716 import m31975
+import pkg2.pkg32.pkg421.m2504
+from pkg11.pkg145.pkg1898 import m8149
+import pkg3.pkg43.pkg560.m2643
+from pkg8.pkg113.pkg1482 import m3565
+from . import m10083
+from pkg4.pkg59.pkg780 import m9115
+
+
+def helper_33007_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_33007_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_33007_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
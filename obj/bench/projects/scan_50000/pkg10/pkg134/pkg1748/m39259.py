@@ -0,0 +1,27 @@
+"""Module 39259."""
+import pkg1.pkg14.m13
+from pkg1.pkg14.pkg183 import m14770
+import pkg3.pkg45.pkg592.m11011
+from pkg4.pkg59.pkg769 import m768
+import pkg4.pkg56.pkg730.m17401
+
+
+def helper_39259_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39259_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_39259_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
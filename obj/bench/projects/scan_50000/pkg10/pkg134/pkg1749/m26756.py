@@ -0,0 +1,20 @@
+"""Module 26756."""
+from . import m5916
+from pkg3.pkg48.pkg625 import m19380
+import pkg8.pkg113.pkg1479.m3562
+from pkg6.pkg85.pkg1110 import m9445
+import pkg3.pkg52.m6303
+
+
+def helper_26756_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_26756_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
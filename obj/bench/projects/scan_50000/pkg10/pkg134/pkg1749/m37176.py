@@ -0,0 +1,9 @@
+"""Module 37176."""
+from . import m26756
+
+
+def helper_37176_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,43 @@
+"""Module 41344."""
+import pkg3.pkg48.pkg626.m8961
+from pkg3.pkg48.pkg632 import m631
+import pkg12.pkg159.pkg2073.m2072
+from pkg7.pkg96.pkg1257 import m40852
+import pkg1.m0
+from . import m35092
+import pkg8.pkg112.pkg1461.m3544
+
+
+def helper_41344_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_41344_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_41344_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_41344_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_41344_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,39 @@
+"""Module 45512."""
+import pkg3.pkg46.pkg606.m23529
+from pkg3.pkg45 import m44
+import pkg7.pkg99.pkg1293.m24216
+from pkg8.pkg117.pkg1523 import m1522
+import pkg5.pkg71.pkg933.m932
+from pkg1.pkg26.pkg343 import m31602
+import pkg8.pkg105.pkg1377.m28468
+from pkg2.pkg39.pkg518 import m517
+import pkg5.pkg76.m75
+from pkg9.pkg121.pkg1579 import m1578
+
+
+def helper_45512_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_45512_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_45512_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_45512_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
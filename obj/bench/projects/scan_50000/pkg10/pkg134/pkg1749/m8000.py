@@ -0,0 +1,18 @@
+"""Module 8000."""
+import pkg10.pkg139.pkg1808.m3891
+from pkg3.pkg40.pkg531 import m2614
+import pkg4.pkg65.pkg847.m846
+from pkg6.pkg87.pkg1137 import m1136
+from . import m3832
+from pkg4.pkg58.pkg763 import m7014
+import pkg3.pkg52.pkg687.m4854
+from pkg8.pkg109.pkg1426 import m3509
+import pkg1.pkg17.pkg234.m233
+from . import m1748
+
+
+def helper_8000_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
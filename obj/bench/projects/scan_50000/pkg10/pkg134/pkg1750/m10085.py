@@ -0,0 +1,5 @@
+"""Module 10085."""
+import pkg1.pkg17.pkg228.m227
+from pkg5.pkg78.pkg1023 import m1022
+import pkg4.pkg64.pkg845.m844
+from pkg4.pkg65 import m64
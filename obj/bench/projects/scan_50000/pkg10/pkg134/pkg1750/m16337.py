@@ -0,0 +1,11 @@
+"""Module 16337."""
+import pkg1.pkg16.pkg219.m218
+from . import m14253
+import pkg1.pkg25.pkg335.m10754
+
+
+def helper_16337_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
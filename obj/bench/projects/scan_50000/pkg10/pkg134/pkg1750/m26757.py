@@ -0,0 +1,38 @@
+"""Module 26757."""
+from . import m20505
+from pkg11.pkg144.pkg1881 import m10216
+import pkg7.pkg100.pkg1305.m5472
+from pkg10 import m9
+import pkg7.pkg98.m20937
+from pkg3.pkg44.pkg584 import m2667
+import pkg5.pkg75.m8410
+from pkg4.pkg60 import m59
+from . import m24673
+
+
+def helper_26757_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_26757_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_26757_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_26757_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
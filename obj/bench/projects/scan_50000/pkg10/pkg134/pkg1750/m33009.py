@@ -0,0 +1,31 @@
+"""Module 33009."""
+import pkg11.pkg154.pkg2003.m12422
+from pkg5.pkg77.pkg1006 import m26013
+from . import m24673
+from pkg2.pkg29.pkg389 import m4556
+import pkg10.pkg140.pkg1821.m8072
+from . import m10085
+import pkg2.pkg30.pkg401.m4568
+from . import m5917
+from . import m26757
+
+
+def helper_33009_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_33009_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_33009_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 8001."""
+import pkg10.pkg134.m133
+from pkg11.pkg144.pkg1882 import m1881
+import pkg4.pkg54.pkg709.m6960
+from pkg7.pkg101.pkg1316 import m1315
+
+
+def helper_8001_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8001_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,53 @@
+"""Module 1750."""
+import pkg6.pkg91.pkg1192.m1191
+from pkg1 import m0
+import pkg4.pkg54.m53
+from pkg5.pkg70.pkg922 import m921
+import pkg1.pkg22.m21
+from pkg3.pkg40.pkg528 import m527
+import pkg6.pkg82.pkg1071.m1070
+from pkg2.pkg33.pkg435 import m434
+import pkg3.pkg40.pkg533.m532
+from pkg1.pkg15 import m14
+
+
+def helper_1750_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1750_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1750_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1750_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_1750_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_1750_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
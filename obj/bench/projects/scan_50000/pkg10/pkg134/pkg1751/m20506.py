@@ -0,0 +1,13 @@
+"""Module 20506."""
+import pkg8.pkg110.pkg1439.m1438
+from pkg1.pkg15.pkg207 import m206
+import pkg11.pkg156.m155
+from pkg1 import m0
+import pkg10.pkg131.pkg1713.m10048
+
+
+def helper_20506_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 24674."""
+import pkg1.pkg16.m15
+from pkg4.pkg55.pkg716 import m2799
+import pkg4.pkg59.m8394
+from . import m8002
+from . import m10086
+
+
+def helper_24674_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_24674_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
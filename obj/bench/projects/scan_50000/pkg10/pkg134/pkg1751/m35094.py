@@ -0,0 +1,17 @@
+"""Module 35094."""
+from . import m33010
+from pkg4.pkg58.pkg757 import m756
+import pkg1.m0
+from pkg1.pkg23 import m22
+import pkg3.pkg48.pkg627.m626
+from . import m30926
+import pkg1.pkg18.m17
+from pkg1.pkg26.pkg344 import m27435
+import pkg1.pkg20.pkg266.m265
+
+
+def helper_35094_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
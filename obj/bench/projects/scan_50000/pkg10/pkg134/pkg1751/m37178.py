@@ -0,0 +1,30 @@
+"""Module 37178."""
+import pkg1.m0
+from pkg9.pkg129.pkg1684 import m1683
+import pkg1.pkg14.m27105
+from pkg8.pkg114.pkg1494 import m3577
+from . import m8002
+from . import m22590
+import pkg5.pkg70.pkg911.m7162
+from pkg4.pkg59 import m58
+
+
+def helper_37178_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37178_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_37178_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,55 @@
+"""Module 45514."""
+from . import m5918
+from pkg9.pkg120.pkg1567 import m43246
+import pkg2.m1
+from pkg2.pkg27 import m26
+from . import m41346
+from pkg10.pkg141.pkg1841 import m12260
+import pkg6.pkg80.pkg1046.m5213
+from pkg7.pkg94.pkg1223 import m7474
+import pkg8.pkg110.pkg1437.m20192
+from pkg8.pkg108 import m107
+from . import m43430
+from pkg2.pkg36.pkg477 import m12980
+
+
+def helper_45514_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_45514_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_45514_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_45514_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_45514_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_45514_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
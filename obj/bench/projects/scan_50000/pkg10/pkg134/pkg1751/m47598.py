@@ -0,0 +1,39 @@
+"""Module 47598."""
+import pkg6.pkg87.pkg1136.m9471
+from pkg9 import m8
+import pkg1.pkg16.pkg217.m18972
+from pkg1.pkg18.pkg238 import m237
+import pkg8.pkg117.m116
+from pkg7.pkg95.pkg1242 import m1241
+import pkg10.pkg133.m132
+from pkg8.pkg108.pkg1416 import m3499
+import pkg9.pkg127.pkg1659.m32918
+from pkg9.pkg127.pkg1656 import m9991
+
+
+def helper_47598_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_47598_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_47598_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_47598_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 12171."""
+from . import m3835
+from pkg5.pkg72.pkg946 import m3029
+import pkg2.pkg35.pkg463.m462
+from pkg6.pkg87 import m10506
+import pkg3.pkg45.m44
+from pkg1 import m0
+from . import m8003
+from . import m10087
+import pkg5.m4
+from pkg13.pkg175 import m174
+
+
+def helper_12171_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12171_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 30927."""
+import pkg7.pkg104.pkg1360.m7611
+from . import m1751
+import pkg5.pkg74.m73
+from pkg1 import m0
+import pkg1.pkg20.pkg268.m267
+from . import m18423
+import pkg3.pkg46.pkg600.m8935
+from . import m28843
+import pkg11.pkg151.pkg1975.m6142
+from pkg2.pkg39.pkg518 import m517
+
+
+def helper_30927_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_30927_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
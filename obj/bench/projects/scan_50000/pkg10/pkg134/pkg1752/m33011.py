@@ -0,0 +1,34 @@
+"""Module 33011."""
+import pkg3.pkg50.m4217
+from pkg4.pkg55 import m54
+from . import m26759
+from pkg12 import m11
+import pkg1.pkg19.m2102
+from pkg3.pkg49.pkg649 import m19404
+import pkg11.pkg154.pkg2003.m20758
+from pkg10.pkg143.pkg1868 import m20623
+import pkg2.pkg34.pkg446.m445
+from pkg7.pkg96 import m95
+import pkg2.pkg33.pkg439.m10858
+from pkg1.pkg23.pkg308 import m307
+
+
+def helper_33011_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_33011_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_33011_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,44 @@
+"""Module 39263."""
+import pkg8.pkg110.pkg1435.m5602
+from pkg1.pkg22.pkg291 import m290
+import pkg4.pkg60.pkg789.m2872
+from pkg6.pkg89 import m4256
+import pkg3.pkg45.pkg591.m4758
+from pkg1.pkg24.pkg322 import m321
+import pkg10.pkg140.pkg1823.m1822
+from pkg3.pkg51.pkg666 import m13169
+
+
+def helper_39263_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39263_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_39263_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_39263_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_39263_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
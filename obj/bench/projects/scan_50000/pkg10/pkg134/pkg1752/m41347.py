@@ -0,0 +1,31 @@
+"""Module 41347."""
+from . import m16339
+from . import m12171
+import pkg8.pkg108.pkg1407.m34750
+from pkg9.pkg126.pkg1640 import m1639
+import pkg10.pkg135.m134
+from pkg3.pkg44.pkg580 import m6831
+import pkg8.m7
+from pkg3.pkg42.pkg551 import m550
+import pkg3.pkg42.pkg548.m4715
+
+
+def helper_41347_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_41347_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_41347_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
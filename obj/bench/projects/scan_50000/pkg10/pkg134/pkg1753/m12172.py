@@ -0,0 +1,44 @@
+"""Module 12172."""
+import pkg2.pkg33.pkg431.m430
+from pkg9.pkg123.pkg1610 import m1609
+from . import m8004
+from pkg1 import m0
+import pkg11.pkg148.pkg1935.m1934
+from pkg1.pkg15 import m14
+import pkg1.pkg25.m24
+from pkg7.pkg104.pkg1353 import m3436
+
+
+def helper_12172_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12172_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_12172_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_12172_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_12172_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,36 @@
+"""Module 24676."""
+import pkg1.pkg17.pkg229.m8564
+from pkg9.pkg118.pkg1535 import m3618
+import pkg1.pkg17.m16
+from pkg3.pkg43.pkg563 import m562
+import pkg7.pkg96.pkg1258.m24181
+from pkg1 import m0
+import pkg4.pkg59.pkg774.m2857
+
+
+def helper_24676_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_24676_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_24676_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_24676_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 28844."""
+import pkg3.pkg46.pkg601.m17272
+from pkg3.pkg52.pkg679 import m13182
+from . import m10088
+from . import m1752
+import pkg3.pkg45.pkg586.m585
+from pkg3.pkg47.pkg618 import m15205
+import pkg3.pkg49.pkg638.m21477
+from pkg4.pkg60 import m20899
+import pkg3.m2
+from pkg5.pkg75.pkg985 import m13488
+from . import m20508
+from . import m16340
+
+
+def helper_28844_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,10 @@
+"""Module 37180."""
+import pkg1.pkg16.pkg209.m2292
+from pkg3.pkg42 import m41
+
+
+def helper_37180_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,44 @@
+"""Module 45516."""
+import pkg3.pkg41.pkg545.m544
+from pkg6.pkg81.pkg1066 import m1065
+import pkg10.pkg139.pkg1813.m24736
+from pkg1.pkg21.pkg280 import m27371
+import pkg9.pkg121.pkg1585.m1584
+from pkg9.pkg126.pkg1647 import m32906
+from . import m10088
+from pkg1.pkg22.pkg296 import m4463
+
+
+def helper_45516_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_45516_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_45516_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_45516_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_45516_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
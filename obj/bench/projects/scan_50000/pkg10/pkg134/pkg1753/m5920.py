@@ -0,0 +1,18 @@
+"""Module 5920."""
+from . import m1752
+from pkg6.pkg88.pkg1148 import m5315
+import pkg9.pkg119.m118
+from pkg5.pkg72 import m71
+import pkg4.pkg54.pkg711.m710
+from pkg9.pkg125.pkg1637 import m1636
+import pkg2.pkg34.pkg445.m444
+from pkg2 import m1
+import pkg6.pkg90.pkg1174.m3257
+from pkg5.pkg76.pkg989 import m3072
+
+
+def helper_5920_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,21 @@
+"""Module 14257."""
+import pkg9.pkg129.pkg1688.m1687
+from . import m10089
+import pkg6.pkg81.pkg1064.m1063
+from pkg2.pkg38.pkg504 import m503
+import pkg9.pkg128.pkg1665.m1664
+from pkg4.pkg58.pkg767 import m9102
+
+
+def helper_14257_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14257_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
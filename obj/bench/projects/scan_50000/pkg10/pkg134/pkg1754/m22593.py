@@ -0,0 +1,19 @@
+"""Module 22593."""
+import pkg1.pkg21.pkg285.m8620
+from pkg4.pkg53 import m52
+import pkg8.m7
+from . import m5921
+import pkg4.m3
+from pkg9.pkg126.pkg1648 import m14151
+import pkg11.pkg147.pkg1920.m4003
+from pkg12.pkg169 import m10588
+from . import m1753
+from . import m18425
+import pkg2.m1
+
+
+def helper_22593_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,47 @@
+"""Module 3837."""
+import pkg3.pkg48.pkg632.m2715
+from pkg2.pkg30.pkg398 import m397
+import pkg2.pkg33.m32
+from . import m1753
+import pkg2.pkg39.pkg517.m2600
+from pkg9.pkg122 import m2205
+import pkg6.pkg79.pkg1036.m1035
+from pkg1.pkg20 import m19
+import pkg5.pkg74.pkg975.m3058
+from pkg2.pkg38.pkg498 import m497
+import pkg1.pkg21.pkg280.m279
+
+
+def helper_3837_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3837_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3837_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3837_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_3837_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
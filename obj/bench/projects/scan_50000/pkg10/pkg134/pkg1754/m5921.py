@@ -0,0 +1,37 @@
+"""Module 5921."""
+import pkg9.m8
+from . import m1753
+import pkg1.pkg25.m24
+from pkg1.pkg19.pkg257 import m256
+import pkg9.pkg128.pkg1676.m3759
+from pkg5.pkg66.pkg860 import m2943
+import pkg3.pkg46.pkg602.m601
+from pkg8.pkg106.pkg1379 import m5546
+
+
+def helper_5921_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5921_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5921_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5921_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
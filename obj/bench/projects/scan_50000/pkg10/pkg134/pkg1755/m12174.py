@@ -0,0 +1,37 @@
+"""Module 12174."""
+import pkg7.pkg99.pkg1294.m7545
+from pkg3.pkg47.pkg620 import m619
+import pkg4.pkg57.pkg751.m750
+from pkg1 import m0
+import pkg7.pkg99.m98
+from pkg7 import m6
+from . import m5922
+from pkg6.pkg80.pkg1045 import m1044
+
+
+def helper_12174_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12174_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_12174_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_12174_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 16342."""
+import pkg5.m4
+from pkg10.pkg143.pkg1866 import m1865
+import pkg2.pkg29.m28
+from pkg4.pkg57.pkg744 import m15331
+from . import m10090
+from pkg6.pkg79.pkg1040 import m1039
+import pkg12.pkg159.pkg2072.m4155
+from pkg1.pkg14 import m13
+import pkg8.pkg108.pkg1414.m1413
+from pkg1.pkg24 import m23
+
+
+def helper_16342_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
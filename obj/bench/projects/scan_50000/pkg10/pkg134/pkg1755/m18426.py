@@ -0,0 +1,10 @@
+"""Module 18426."""
+import pkg4.pkg63.pkg828.m7079
+from pkg8.pkg117.pkg1522 import m5689
+import pkg2.pkg31.pkg407.m406
+from pkg7.pkg104.pkg1357 import m13860
+import pkg9.pkg130.m2213
+from pkg8.pkg109 import m108
+import pkg11.pkg148.pkg1931.m1930
+from pkg3.pkg42.pkg557 import m15144
+import pkg7.pkg102.pkg1337.m9672
@@ -0,0 +1,22 @@
+"""Module 22594."""
+from . import m3838
+from pkg4.pkg56 import m55
+from . import m20510
+from pkg6.pkg90.pkg1174 import m5341
+import pkg1.pkg22.pkg295.m10714
+from pkg5.pkg74.pkg966 import m965
+import pkg3.pkg45.pkg589.m13092
+
+
+def helper_22594_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_22594_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,31 @@
+"""Module 26762."""
+from . import m12174
+from pkg2.pkg31.pkg411 import m410
+import pkg6.pkg83.pkg1084.m1083
+from pkg9.pkg123.pkg1603 import m26610
+import pkg5.pkg71.m70
+from pkg7.pkg92.pkg1202 import m13705
+import pkg1.pkg26.pkg340.m339
+from pkg6.pkg88 import m16759
+import pkg1.pkg22.pkg297.m2380
+
+
+def helper_26762_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_26762_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_26762_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
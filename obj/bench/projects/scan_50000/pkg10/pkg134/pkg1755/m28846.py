@@ -0,0 +1,27 @@
+"""Module 28846."""
+from . import m14258
+from pkg2.pkg38.pkg504 import m6755
+from . import m3838
+from pkg2.pkg28.pkg368 import m4535
+import pkg3.pkg49.pkg647.m25654
+from . import m8006
+import pkg10.pkg140.pkg1829.m12248
+from pkg7.pkg95.pkg1237 import m3320
+from . import m22594
+from . import m12174
+import pkg7.pkg104.pkg1353.m28444
+from pkg4.pkg61.pkg794 import m793
+
+
+def helper_28846_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_28846_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
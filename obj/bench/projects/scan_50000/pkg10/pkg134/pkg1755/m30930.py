@@ -0,0 +1,25 @@
+"""Module 30930."""
+import pkg1.pkg20.pkg267.m2350
+from pkg7.pkg94 import m12597
+import pkg5.m4
+from pkg1.pkg16.pkg211 import m6462
+import pkg10.pkg140.m139
+from pkg4.pkg54.pkg711 import m710
+import pkg12.pkg169.m168
+from pkg1.pkg23.pkg308 import m23231
+import pkg1.m0
+from pkg8.pkg105 import m6356
+
+
+def helper_30930_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_30930_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
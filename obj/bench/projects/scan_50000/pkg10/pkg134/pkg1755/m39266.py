@@ -0,0 +1,29 @@
+"""Module 39266."""
+from . import m18426
+from pkg1 import m0
+import pkg1.pkg21.pkg283.m8618
+from . import m20510
+import pkg3.pkg49.pkg638.m637
+from . import m37182
+import pkg2.pkg28.pkg366.m6617
+
+
+def helper_39266_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39266_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_39266_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,9 @@
+"""Module 43434."""
+from . import m39266
+
+
+def helper_43434_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 8006."""
+import pkg8.pkg113.pkg1471.m1470
+from pkg7.pkg92.pkg1203 import m5370
+import pkg5.pkg78.pkg1016.m3099
+from pkg10.pkg132.pkg1722 import m1721
+import pkg13.pkg178.m177
+from . import m1754
+import pkg9.pkg127.pkg1656.m1655
+from pkg9.pkg127.pkg1653 import m1652
+import pkg8.pkg115.pkg1496.m1495
+from pkg1.pkg22.pkg288 import m287
+
+
+def helper_8006_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,40 @@
+"""Module 23058."""
+import pkg3.pkg46.pkg605.m17276
+from pkg3.pkg47.pkg622 import m15209
+import pkg4.pkg62.pkg814.m11233
+from pkg4.pkg53.pkg690 import m689
+from . import m2218
+from pkg8.pkg112.pkg1463 import m3546
+import pkg6.pkg82.pkg1077.m1076
+from . import m4302
+import pkg1.m0
+from pkg9.pkg129 import m12632
+import pkg7.pkg101.pkg1316.m1315
+
+
+def helper_23058_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_23058_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_23058_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_23058_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,46 @@
+"""Module 39730."""
+import pkg2.pkg33.pkg439.m6690
+from . import m29310
+import pkg10.pkg136.pkg1772.m22611
+from . import m35562
+import pkg2.pkg34.pkg452.m8787
+from . import m14722
+import pkg9.pkg119.pkg1550.m5717
+from . import m20974
+from . import m4302
+from pkg1 import m0
+
+
+def helper_39730_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39730_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_39730_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_39730_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_39730_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,9 @@
+"""Module 22595."""
+from . import m14259
+
+
+def helper_22595_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
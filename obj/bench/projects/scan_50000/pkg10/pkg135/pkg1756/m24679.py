@@ -0,0 +1,33 @@
+"""Module 24679."""
+import pkg1.pkg22.m21
+from pkg3.pkg46 import m45
+import pkg7.pkg104.pkg1359.m7610
+from pkg5.pkg72.pkg943 import m942
+import pkg6.pkg88.pkg1154.m1153
+from . import m18427
+from . import m16343
+from pkg10.pkg133.pkg1740 import m1739
+import pkg6.pkg84.pkg1095.m13598
+from pkg5 import m4
+import pkg9.pkg118.pkg1547.m1546
+
+
+def helper_24679_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_24679_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_24679_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,32 @@
+"""Module 45519."""
+import pkg1.pkg18.m17
+from pkg1.pkg26.pkg340 import m29515
+import pkg2.pkg38.pkg504.m2587
+from pkg1.pkg18.pkg246 import m4413
+import pkg6.pkg87.pkg1134.m5301
+from pkg7.pkg102 import m101
+import pkg3.pkg45.pkg590.m589
+from pkg10.pkg141.pkg1834 import m28925
+import pkg8.pkg108.pkg1414.m24337
+from pkg4.pkg58.pkg758 import m9093
+
+
+def helper_45519_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_45519_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_45519_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
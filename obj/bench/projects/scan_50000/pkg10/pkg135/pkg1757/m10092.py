@@ -0,0 +1,9 @@
+"""Module 10092."""
+import pkg2.pkg30.pkg403.m402
+
+
+def helper_10092_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,60 @@
+"""Module 14260."""
+from . import m3840
+from . import m10092
+import pkg10.pkg133.pkg1740.m3823
+from pkg6.pkg81.pkg1066 import m13569
+import pkg2.pkg33.pkg434.m6685
+from pkg11.pkg151.pkg1965 import m12384
+import pkg6.pkg83.pkg1091.m1090
+from pkg7.pkg94.pkg1228 import m11647
+import pkg9.pkg120.pkg1564.m7815
+from pkg3.pkg50.pkg662 import m13165
+
+
+def helper_14260_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14260_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_14260_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_14260_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_14260_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_14260_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14260_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
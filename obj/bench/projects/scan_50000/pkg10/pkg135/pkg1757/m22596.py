@@ -0,0 +1,21 @@
+"""Module 22596."""
+from . import m1756
+from pkg3.pkg52.pkg678 import m2761
+import pkg11.pkg153.pkg1995.m14498
+from . import m8008
+import pkg6.pkg87.pkg1135.m5302
+from pkg10.pkg143 import m16814
+
+
+def helper_22596_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_22596_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
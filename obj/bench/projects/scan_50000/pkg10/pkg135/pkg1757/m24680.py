@@ -0,0 +1,52 @@
+"""Module 24680."""
+import pkg7.pkg97.m4264
+from pkg5.pkg74.pkg963 import m13466
+import pkg2.pkg32.pkg420.m10839
+from pkg1 import m0
+import pkg6.pkg82.pkg1072.m21911
+from pkg1.pkg25.pkg334 import m14921
+import pkg1.pkg14.pkg190.m189
+from pkg2.pkg28.pkg365 import m17036
+import pkg13.pkg172.m14759
+
+
+def helper_24680_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_24680_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_24680_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_24680_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_24680_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_24680_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,22 @@
+"""Module 26764."""
+import pkg3.pkg41.pkg535.m25542
+from . import m12176
+import pkg1.pkg14.pkg184.m183
+from pkg2.pkg35.pkg460 import m4627
+import pkg6.pkg84.pkg1097.m26104
+from pkg12.pkg157.pkg2050 import m2049
+from . import m18428
+
+
+def helper_26764_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_26764_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
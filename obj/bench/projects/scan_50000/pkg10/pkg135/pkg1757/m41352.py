@@ -0,0 +1,25 @@
+"""Module 41352."""
+import pkg2.pkg38.pkg504.m503
+from pkg2.pkg35.pkg466 import m8801
+import pkg2.pkg37.pkg493.m31752
+
+
+def helper_41352_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_41352_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_41352_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
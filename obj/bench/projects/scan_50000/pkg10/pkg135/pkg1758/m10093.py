@@ -0,0 +1,16 @@
+"""Module 10093."""
+import pkg12.pkg159.pkg2070.m2069
+from pkg1.pkg14.pkg194 import m193
+import pkg1.m0
+from . import m8009
+import pkg6.pkg91.pkg1194.m1193
+from pkg2.pkg27.pkg364 import m4531
+from . import m5925
+from pkg5 import m4
+
+
+def helper_10093_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
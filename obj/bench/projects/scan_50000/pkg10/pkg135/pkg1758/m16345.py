@@ -0,0 +1,11 @@
+"""Module 16345."""
+import pkg6.pkg84.pkg1104.m9439
+from pkg2.pkg27 import m26
+import pkg3.m2
+
+
+def helper_16345_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
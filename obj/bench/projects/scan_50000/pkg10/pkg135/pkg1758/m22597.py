@@ -0,0 +1,31 @@
+"""Module 22597."""
+from . import m20513
+from pkg2.pkg28.pkg374 import m6625
+import pkg3.pkg46.pkg607.m606
+from pkg7.pkg101.pkg1322 import m20077
+import pkg2.pkg27.pkg353.m352
+from pkg1.pkg21.pkg285 import m10704
+import pkg7.pkg92.pkg1201.m15788
+from pkg2.pkg30.pkg397 import m2480
+import pkg1.pkg20.pkg267.m10686
+
+
+def helper_22597_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_22597_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_22597_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
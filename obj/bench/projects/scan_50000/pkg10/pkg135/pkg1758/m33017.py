@@ -0,0 +1,55 @@
+"""Module 33017."""
+from . import m8009
+from pkg10.pkg134.pkg1747 import m26754
+import pkg12.pkg160.pkg2082.m4165
+from . import m18429
+import pkg3.pkg48.pkg632.m31891
+from pkg5.pkg76.pkg991 import m990
+import pkg7.pkg92.pkg1203.m24126
+from pkg9.pkg122.pkg1587 import m24510
+import pkg13.pkg176.m175
+from pkg2.pkg36.pkg470 import m6721
+import pkg6.pkg85.pkg1115.m5282
+from pkg2.pkg30.pkg395 import m2478
+
+
+def helper_33017_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_33017_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_33017_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_33017_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_33017_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_33017_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
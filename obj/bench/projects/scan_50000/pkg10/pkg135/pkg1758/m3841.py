@@ -0,0 +1,26 @@
+"""Module 3841."""
+from . import m1757
+from pkg6.pkg82.pkg1072 import m3155
+import pkg4.pkg53.pkg701.m700
+from pkg9.pkg130.pkg1698 import m1697
+
+
+def helper_3841_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3841_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3841_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,13 @@
+"""Module 5925."""
+import pkg1.m0
+from pkg6.pkg87.pkg1132 import m1131
+import pkg5.pkg73.pkg953.m3036
+from pkg8.pkg106.pkg1380 import m1379
+from . import m3841
+
+
+def helper_5925_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
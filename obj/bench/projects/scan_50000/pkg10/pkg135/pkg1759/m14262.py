@@ -0,0 +1,29 @@
+"""Module 14262."""
+import pkg9.pkg130.pkg1693.m14196
+from pkg1.pkg20.pkg271 import m6522
+from . import m12178
+from pkg4 import m3
+from . import m3842
+from pkg9.pkg128.pkg1668 import m1667
+import pkg1.m0
+
+
+def helper_14262_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14262_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_14262_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
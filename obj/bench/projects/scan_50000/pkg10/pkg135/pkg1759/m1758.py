@@ -0,0 +1,10 @@
+"""Module 1758."""
+import pkg2.pkg28.m27
+from pkg7.pkg92.pkg1200 import m1199
+
+
+def helper_1758_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
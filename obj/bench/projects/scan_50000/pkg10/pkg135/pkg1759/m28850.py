@@ -0,0 +1,35 @@
+"""Module 28850."""
+import pkg7.pkg94.pkg1234.m15821
+from pkg9.pkg122.pkg1588 import m28679
+import pkg1.pkg23.m22
+from . import m5926
+import pkg3.pkg49.pkg642.m6893
+from pkg10.pkg135 import m134
+
+
+def helper_28850_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_28850_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_28850_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_28850_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
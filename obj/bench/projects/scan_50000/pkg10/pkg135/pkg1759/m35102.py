@@ -0,0 +1,43 @@
+"""Module 35102."""
+import pkg8.pkg105.pkg1375.m1374
+from pkg5.pkg76.pkg990 import m3073
+import pkg9.pkg130.pkg1692.m1691
+from pkg10.pkg133.pkg1731 import m5898
+import pkg8.pkg117.pkg1526.m1525
+from pkg8.pkg113.pkg1481 import m5648
+from . import m1758
+
+
+def helper_35102_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35102_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_35102_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_35102_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_35102_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,61 @@
+"""Module 43438."""
+import pkg9.pkg120.pkg1564.m18235
+from . import m22598
+import pkg9.pkg120.pkg1573.m7824
+from . import m33018
+import pkg11.pkg144.pkg1879.m22718
+from pkg11.pkg146.pkg1899 import m33158
+import pkg8.pkg115.pkg1501.m11920
+from pkg8.pkg114 import m113
+import pkg5.pkg75.pkg981.m15568
+from pkg3 import m2
+import pkg1.pkg16.pkg209.m2292
+
+
+def helper_43438_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_43438_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_43438_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_43438_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_43438_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_43438_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_43438_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
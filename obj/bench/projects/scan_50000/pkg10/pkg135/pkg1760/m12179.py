@@ -0,0 +1,33 @@
+"""Module 12179."""
+import pkg5.pkg70.m69
+from pkg3.pkg41 import m40
+from . import m1759
+from pkg6.pkg80.pkg1051 import m1050
+import pkg8.pkg109.pkg1423.m1422
+from pkg8.pkg112.pkg1459 import m1458
+from . import m3843
+from pkg3.pkg45.pkg591 import m590
+import pkg9.pkg127.pkg1658.m7909
+from pkg4.pkg56.pkg733 import m2816
+import pkg1.pkg14.pkg188.m187
+
+
+def helper_12179_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12179_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_12179_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
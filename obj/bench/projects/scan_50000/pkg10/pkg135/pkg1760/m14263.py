@@ -0,0 +1,39 @@
+"""Module 14263."""
+import pkg7.pkg94.m93
+from pkg4.pkg55 import m54
+from . import m12179
+from pkg6.pkg81.pkg1054 import m1053
+import pkg4.pkg61.pkg795.m2878
+from pkg11.pkg146.pkg1900 import m12319
+import pkg8.pkg116.pkg1521.m7772
+from pkg1 import m0
+from . import m10095
+from pkg7.pkg100.pkg1305 import m1304
+
+
+def helper_14263_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14263_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_14263_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_14263_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
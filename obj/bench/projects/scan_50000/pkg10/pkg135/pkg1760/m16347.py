@@ -0,0 +1,8 @@
+"""Module 16347."""
+import pkg3.pkg52.m51
+from . import m5927
+import pkg1.pkg14.pkg191.m190
+from . import m12179
+import pkg11.pkg156.pkg2031.m4114
+from pkg1.pkg16.pkg213 import m212
+import pkg3.pkg45.pkg597.m2680
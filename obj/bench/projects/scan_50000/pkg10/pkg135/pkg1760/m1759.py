@@ -0,0 +1,36 @@
+"""Module 1759."""
+import pkg2.m1
+from pkg2.pkg38.pkg496 import m495
+import pkg3.pkg48.pkg630.m629
+from pkg1.pkg26.pkg346 import m345
+import pkg2.pkg27.pkg353.m352
+from pkg2.pkg27.pkg360 import m359
+import pkg2.pkg31.pkg410.m409
+
+
+def helper_1759_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1759_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1759_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1759_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
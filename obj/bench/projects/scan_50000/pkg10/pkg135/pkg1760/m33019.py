@@ -0,0 +1,53 @@
+"""Module 33019."""
+from . import m24683
+from pkg13 import m12
+import pkg3.pkg43.pkg566.m565
+from pkg7.pkg103.pkg1344 import m28435
+from . import m14263
+from pkg9.pkg129.pkg1689 import m14192
+import pkg1.pkg19.pkg249.m2332
+from . import m16347
+import pkg7.pkg92.pkg1207.m5374
+from pkg8.pkg106 import m105
+
+
+def helper_33019_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_33019_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_33019_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_33019_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_33019_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_33019_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
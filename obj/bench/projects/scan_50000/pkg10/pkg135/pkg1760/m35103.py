@@ -0,0 +1,17 @@
+"""Module 35103."""
+import pkg5.pkg73.pkg958.m3041
+from pkg9.pkg120.pkg1570 import m5737
+import pkg3.pkg41.pkg541.m540
+from pkg11 import m10
+import pkg3.pkg43.m42
+from . import m3843
+import pkg6.pkg80.pkg1042.m15629
+from pkg7.pkg97.pkg1263 import m13766
+import pkg13.m4180
+
+
+def helper_35103_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,34 @@
+"""Module 47607."""
+import pkg6.pkg82.pkg1071.m1070
+from pkg6 import m5
+import pkg1.pkg16.pkg217.m33560
+from pkg6.pkg85.pkg1112 import m9447
+import pkg4.pkg56.pkg738.m15325
+from . import m16347
+import pkg5.pkg71.pkg932.m7183
+from pkg4.pkg63.pkg827 import m2910
+import pkg3.pkg44.pkg577.m33920
+from pkg1.pkg18 import m17
+import pkg10.pkg139.pkg1816.m5983
+from pkg3.pkg42.pkg549 import m548
+
+
+def helper_47607_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_47607_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_47607_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
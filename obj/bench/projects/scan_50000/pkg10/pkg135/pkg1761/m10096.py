@@ -0,0 +1,21 @@
+"""Module 10096."""
+from . import m5928
+from . import m3844
+from . import m1760
+from pkg1.pkg15.pkg203 import m202
+import pkg7.pkg96.pkg1259.m1258
+from pkg10.pkg140 import m139
+
+
+def helper_10096_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10096_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
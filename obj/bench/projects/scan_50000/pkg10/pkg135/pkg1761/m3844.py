@@ -0,0 +1,21 @@
+"""Module 3844."""
+import pkg7.pkg97.pkg1268.m3351
+from pkg9.pkg119.pkg1560 import m1559
+import pkg7.pkg103.pkg1343.m1342
+from pkg5.pkg75.pkg983 import m982
+from . import m1760
+from pkg1.pkg20 import m19
+
+
+def helper_3844_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3844_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,8 @@
+"""Module 39272."""
+import pkg7.pkg99.m98
+from pkg10.pkg132.pkg1727 import m3810
+import pkg7.pkg99.pkg1290.m17961
+from . import m22600
+import pkg3.pkg48.pkg631.m17302
+from pkg11.pkg153.pkg1994 import m16581
+import pkg1.pkg26.m4193
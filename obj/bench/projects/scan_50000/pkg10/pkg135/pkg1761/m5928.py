@@ -0,0 +1,12 @@
+"""Module 5928."""
+from . import m1760
+from pkg1.pkg25.pkg330 import m329
+from . import m3844
+from pkg3.pkg43.pkg572 import m4739
+
+
+def helper_5928_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
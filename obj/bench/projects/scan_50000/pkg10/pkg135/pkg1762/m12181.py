@@ -0,0 +1,27 @@
+"""Module 12181."""
+import pkg9.pkg126.m125
+from pkg6.pkg83.pkg1085 import m1084
+import pkg6.pkg91.pkg1195.m1194
+from pkg7.pkg94 import m2177
+import pkg2.m1
+from pkg1 import m0
+from . import m8013
+from pkg10.pkg141.pkg1841 import m1840
+import pkg11.pkg151.pkg1973.m1972
+from pkg1.pkg26.pkg347 import m346
+import pkg9.pkg122.pkg1589.m9924
+from pkg10.pkg137.pkg1787 import m1786
+
+
+def helper_12181_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12181_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
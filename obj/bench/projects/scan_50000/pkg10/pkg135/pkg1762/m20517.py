@@ -0,0 +1,13 @@
+"""Module 20517."""
+import pkg10.m9
+from . import m10097
+import pkg2.pkg36.pkg474.m4641
+from pkg4.pkg59.pkg774 import m7025
+import pkg3.pkg42.m41
+
+
+def helper_20517_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 26769."""
+import pkg4.pkg61.pkg799.m798
+from pkg4.pkg53.pkg692 import m6943
+import pkg1.pkg22.pkg293.m292
+from pkg2.pkg35.pkg459 import m458
+import pkg9.pkg128.pkg1665.m7916
+from pkg6.pkg84.pkg1101 import m5268
+import pkg8.pkg110.pkg1435.m5602
+from pkg9 import m8
+import pkg1.pkg17.pkg233.m2316
+from pkg2.pkg27.pkg352 import m351
+from . import m10097
+
+
+def helper_26769_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_26769_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
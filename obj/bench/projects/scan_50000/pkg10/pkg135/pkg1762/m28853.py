@@ -0,0 +1,61 @@
+"""Module 28853."""
+import pkg4.pkg54.pkg715.m714
+from . import m16349
+import pkg3.pkg45.m44
+from pkg2.pkg37.pkg490 import m25497
+import pkg9.pkg118.pkg1544.m24467
+from pkg5.pkg75.pkg983 import m19738
+import pkg6.pkg85.pkg1118.m9453
+from . import m20517
+import pkg1.pkg16.pkg214.m14801
+from pkg11.pkg144.pkg1885 import m14388
+import pkg6.pkg90.pkg1175.m11594
+
+
+def helper_28853_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_28853_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_28853_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_28853_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_28853_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_28853_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_28853_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
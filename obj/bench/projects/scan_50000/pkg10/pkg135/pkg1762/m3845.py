@@ -0,0 +1,31 @@
+"""Module 3845."""
+import pkg8.pkg116.pkg1521.m1520
+from pkg10.pkg141.pkg1843 import m1842
+from . import m1761
+from pkg2.pkg32.pkg417 import m2500
+import pkg11.m10
+from pkg9.pkg122.pkg1595 import m1594
+import pkg3.pkg47.pkg614.m613
+from pkg4.pkg58 import m57
+import pkg3.pkg46.pkg599.m598
+
+
+def helper_3845_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3845_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3845_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
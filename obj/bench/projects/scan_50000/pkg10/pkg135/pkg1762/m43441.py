@@ -0,0 +1,11 @@
+"""Module 43441."""
+import pkg1.pkg16.pkg215.m8550
+from . import m28853
+import pkg12.pkg157.m2240
+
+
+def helper_43441_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
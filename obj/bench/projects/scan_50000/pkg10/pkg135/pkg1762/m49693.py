@@ -0,0 +1,19 @@
+"""Module 49693."""
+from . import m3845
+from pkg1.pkg24.pkg317 import m316
+import pkg1.pkg14.pkg191.m18946
+from pkg11.pkg146.pkg1907 import m10242
+
+
+def helper_49693_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_49693_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
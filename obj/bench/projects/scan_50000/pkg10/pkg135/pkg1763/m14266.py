@@ -0,0 +1,55 @@
+"""Module 14266."""
+from . import m1762
+from pkg6.pkg79.pkg1039 import m3122
+from . import m8014
+from pkg9.pkg125.pkg1634 import m14137
+import pkg5.pkg71.pkg926.m7177
+from pkg9.pkg119.pkg1550 import m1549
+import pkg9.pkg129.m12632
+from pkg4.pkg60 import m59
+import pkg1.pkg24.pkg323.m322
+from pkg1 import m0
+import pkg1.pkg15.pkg199.m198
+from pkg10.pkg134.pkg1744 import m12163
+
+
+def helper_14266_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14266_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_14266_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_14266_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_14266_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_14266_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 18434."""
+import pkg2.pkg35.pkg458.m8793
+from . import m8014
+import pkg9.pkg123.pkg1612.m3695
+from pkg3.pkg46.pkg606 import m605
+import pkg4.pkg57.pkg752.m7003
+from . import m3846
+import pkg2.pkg39.pkg510.m4677
+from pkg4.pkg60 import m59
+from . import m5930
+from pkg5.pkg78.pkg1026 import m13529
+import pkg3.pkg42.pkg550.m549
+from pkg10.pkg140 import m139
+
+
+def helper_18434_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
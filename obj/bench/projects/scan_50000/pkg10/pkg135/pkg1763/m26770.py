@@ -0,0 +1,35 @@
+"""Module 26770."""
+import pkg4.pkg63.pkg830.m829
+from . import m22602
+import pkg6.pkg82.pkg1079.m17750
+from pkg5.pkg68.pkg891 import m11310
+import pkg10.pkg134.pkg1755.m1754
+from pkg8.pkg113.pkg1473 import m1472
+
+
+def helper_26770_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_26770_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_26770_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_26770_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
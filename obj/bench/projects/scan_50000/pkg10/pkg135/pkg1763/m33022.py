@@ -0,0 +1,47 @@
+"""Module 33022."""
+import pkg1.pkg23.m22
+from pkg6.pkg89.pkg1159 import m1158
+import pkg2.pkg33.pkg438.m27529
+from pkg2.pkg29.pkg385 import m2468
+import pkg2.pkg38.pkg498.m31757
+from pkg8.pkg113.pkg1471 import m11890
+import pkg10.pkg139.pkg1819.m5986
+from pkg1.pkg15.pkg202 import m16873
+import pkg10.pkg143.pkg1860.m3943
+from . import m30938
+import pkg1.m0
+
+
+def helper_33022_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_33022_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_33022_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_33022_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_33022_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
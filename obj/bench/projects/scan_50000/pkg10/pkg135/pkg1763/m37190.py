@@ -0,0 +1,14 @@
+"""Module 37190."""
+import pkg1.pkg22.pkg290.m12793
+from pkg5.pkg67.pkg877 import m19632
+from . import m14266
+from pkg2.pkg29.pkg390 import m389
+import pkg6.pkg86.pkg1128.m1127
+from . import m28854
+
+
+def helper_37190_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,48 @@
+"""Module 39274."""
+import pkg4.pkg64.m27155
+from pkg1.pkg17.pkg226 import m225
+import pkg4.pkg61.pkg806.m32065
+from . import m35106
+import pkg6.pkg85.pkg1114.m36541
+from . import m28854
+import pkg9.pkg124.pkg1618.m1617
+from . import m16350
+import pkg3.pkg49.pkg648.m38159
+from pkg9.pkg120.pkg1572 import m1571
+import pkg8.pkg117.pkg1525.m3608
+from . import m33022
+
+
+def helper_39274_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39274_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_39274_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_39274_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_39274_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
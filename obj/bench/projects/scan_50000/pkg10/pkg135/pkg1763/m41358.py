@@ -0,0 +1,54 @@
+"""Module 41358."""
+import pkg4.pkg61.pkg796.m7047
+from pkg10.pkg132.pkg1727 import m16314
+from . import m14266
+from pkg6.pkg88.pkg1149 import m30324
+import pkg5.pkg68.pkg888.m9223
+from pkg1.pkg24.pkg319 import m23242
+from . import m24686
+from pkg1.pkg18.pkg238 import m35665
+import pkg12.pkg158.m4325
+from . import m8014
+import pkg7.pkg102.m101
+
+
+def helper_41358_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_41358_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_41358_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_41358_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_41358_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_41358_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
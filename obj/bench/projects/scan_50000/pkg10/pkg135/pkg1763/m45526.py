@@ -0,0 +1,15 @@
+"""Module 45526."""
+import pkg6.pkg79.pkg1032.m40627
+from pkg11.pkg148.pkg1933 import m12352
+import pkg1.pkg17.pkg222.m25229
+from pkg5.pkg70.pkg918 import m40513
+from . import m3846
+from pkg2.pkg27.pkg360 import m4527
+import pkg1.pkg18.pkg244.m243
+
+
+def helper_45526_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,13 @@
+"""Module 1763."""
+import pkg6.m5
+from pkg8.pkg114.pkg1490 import m1489
+import pkg3.pkg44.pkg575.m574
+from pkg9.pkg125 import m124
+import pkg1.m0
+
+
+def helper_1763_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 20519."""
+from . import m5931
+from pkg1.pkg24 import m23
+import pkg1.m0
+from pkg9.pkg130.pkg1694 import m16281
+
+
+def helper_20519_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_20519_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_20519_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,28 @@
+"""Module 30939."""
+import pkg2.pkg30.m29
+from pkg1 import m0
+import pkg7.pkg92.pkg1203.m5370
+from pkg6.pkg90.pkg1183 import m22022
+import pkg12.pkg159.pkg2074.m12493
+from pkg4.pkg60.pkg790 import m2873
+
+
+def helper_30939_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_30939_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_30939_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
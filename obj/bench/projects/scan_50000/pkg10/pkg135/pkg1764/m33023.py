@@ -0,0 +1,47 @@
+"""Module 33023."""
+import pkg8.pkg116.pkg1512.m16099
+from . import m26771
+import pkg1.pkg19.pkg255.m23178
+from pkg11.pkg150.pkg1961 import m1960
+import pkg8.pkg107.pkg1401.m15988
+from pkg11.pkg154.pkg2009 import m2008
+import pkg11.pkg148.pkg1927.m1926
+from pkg4.pkg62.pkg811 import m810
+import pkg2.m1
+from pkg1.pkg25.pkg336 import m4503
+import pkg5.pkg78.pkg1015.m13518
+
+
+def helper_33023_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_33023_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_33023_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_33023_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_33023_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
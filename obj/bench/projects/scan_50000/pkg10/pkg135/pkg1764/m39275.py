@@ -0,0 +1,53 @@
+"""Module 39275."""
+from . import m12183
+from . import m30939
+import pkg6.pkg83.pkg1092.m1091
+from pkg10.pkg142.pkg1856 import m31031
+import pkg1.pkg14.m18769
+from pkg5.pkg71.pkg934 import m23857
+import pkg2.pkg33.pkg433.m4600
+from pkg2.pkg30.pkg391 import m2474
+import pkg1.pkg21.pkg277.m14864
+from pkg4 import m3
+
+
+def helper_39275_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39275_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_39275_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_39275_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_39275_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_39275_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,24 @@
+"""Module 49695."""
+import pkg9.pkg126.pkg1645.m1644
+from pkg8.pkg107.pkg1399 import m49330
+import pkg10.pkg135.pkg1759.m49690
+from pkg3.pkg51.pkg667 import m27758
+import pkg6.pkg82.pkg1067.m3150
+from pkg12.pkg159.pkg2075 import m22914
+import pkg6.pkg89.pkg1164.m26171
+from pkg1.pkg16.pkg219 import m12722
+import pkg3.pkg43.pkg564.m42243
+
+
+def helper_49695_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_49695_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
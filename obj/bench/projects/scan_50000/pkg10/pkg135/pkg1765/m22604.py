@@ -0,0 +1,48 @@
+"""Module 22604."""
+import pkg4.pkg63.pkg822.m821
+from pkg10.pkg137.pkg1785 import m1784
+import pkg4.pkg62.pkg816.m15403
+from pkg7.pkg94.pkg1226 import m7477
+from . import m5932
+from . import m3848
+from . import m16352
+from pkg10.pkg134 import m133
+from . import m10100
+from pkg3.pkg49.pkg638 import m637
+import pkg1.pkg18.pkg247.m19002
+from pkg9 import m8
+
+
+def helper_22604_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_22604_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_22604_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_22604_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_22604_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,22 @@
+"""Module 37192."""
+import pkg8.pkg116.pkg1518.m1517
+from pkg2.pkg28.pkg377 import m376
+import pkg9.pkg124.pkg1618.m5785
+from pkg4.pkg63.pkg829 import m23752
+import pkg5.pkg66.pkg870.m13373
+from pkg2.pkg31.pkg410 import m4577
+import pkg5.pkg77.pkg1014.m7265
+
+
+def helper_37192_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37192_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 3848."""
+import pkg1.pkg16.m15
+from pkg1.pkg17.pkg230 import m229
+import pkg2.pkg33.pkg441.m440
+from pkg4.pkg63.pkg830 import m2913
+import pkg3.pkg51.pkg664.m663
+from pkg2.pkg30.pkg403 import m402
+import pkg1.m0
+from pkg6.pkg86.pkg1129 import m3212
+import pkg1.pkg18.m17
+from pkg2 import m1
+
+
+def helper_3848_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,15 @@
+"""Module 5932."""
+import pkg1.pkg22.pkg297.m4464
+from pkg2.pkg38.pkg505 import m504
+import pkg6.pkg82.pkg1077.m5244
+from pkg10 import m9
+from . import m1764
+from pkg5.pkg74.pkg972 import m971
+import pkg7.pkg100.pkg1306.m1305
+
+
+def helper_5932_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
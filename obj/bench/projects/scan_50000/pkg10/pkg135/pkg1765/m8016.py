@@ -0,0 +1,26 @@
+"""Module 8016."""
+import pkg2.pkg33.m32
+from pkg8.pkg114.pkg1494 import m7745
+import pkg10.pkg131.pkg1714.m1713
+from . import m1764
+
+
+def helper_8016_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8016_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8016_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,12 @@
+"""Module 18437."""
+from . import m8017
+from pkg11.pkg152.pkg1978 import m8229
+import pkg4.pkg56.pkg735.m4902
+from pkg10 import m9
+
+
+def helper_18437_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
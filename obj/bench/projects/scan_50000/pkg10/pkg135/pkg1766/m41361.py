@@ -0,0 +1,11 @@
+"""Module 41361."""
+import pkg1.m0
+from . import m35109
+from . import m8017
+
+
+def helper_41361_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,3 @@
+"""Module 43445."""
+import pkg11.pkg148.m147
+from pkg6.pkg89 import m88
@@ -0,0 +1,33 @@
+"""Module 45529."""
+import pkg11.pkg146.pkg1909.m29000
+from . import m39277
+import pkg1.pkg19.pkg254.m253
+from pkg1.pkg17.pkg224 import m223
+import pkg6.pkg84.pkg1094.m38605
+from pkg1.pkg21.pkg279 import m278
+from . import m12185
+from pkg3.pkg41.pkg534 import m6785
+import pkg3.pkg51.pkg671.m31930
+from pkg1 import m0
+import pkg12.m25019
+
+
+def helper_45529_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_45529_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_45529_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
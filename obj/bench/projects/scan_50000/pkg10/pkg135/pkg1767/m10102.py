@@ -0,0 +1,9 @@
+"""Module 10102."""
+import pkg11.pkg147.m146
+
+
+def helper_10102_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
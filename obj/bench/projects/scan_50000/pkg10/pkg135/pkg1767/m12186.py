@@ -0,0 +1,47 @@
+"""Module 12186."""
+import pkg11.pkg154.pkg2015.m2014
+from pkg9.pkg127.pkg1660 import m1659
+import pkg8.pkg113.pkg1476.m5643
+from pkg3.pkg42.pkg551 import m550
+import pkg9.pkg127.m2210
+from . import m10102
+import pkg7.pkg97.m2180
+from pkg4.pkg62 import m61
+import pkg2.pkg29.pkg382.m381
+from pkg7.pkg97.pkg1273 import m1272
+import pkg4.pkg62.pkg816.m4983
+
+
+def helper_12186_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12186_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_12186_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_12186_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_12186_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
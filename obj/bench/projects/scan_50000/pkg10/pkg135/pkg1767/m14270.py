@@ -0,0 +1,18 @@
+"""Module 14270."""
+import pkg11.pkg145.pkg1888.m1887
+from pkg6.pkg90.pkg1182 import m1181
+from . import m10102
+
+
+def helper_14270_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14270_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
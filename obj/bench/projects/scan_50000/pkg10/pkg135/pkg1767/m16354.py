@@ -0,0 +1,17 @@
+"""Module 16354."""
+import pkg7.pkg94.pkg1231.m9566
+from pkg4.pkg56.pkg734 import m4901
+
+
+def helper_16354_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16354_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,12 @@
+"""Module 24690."""
+import pkg3.pkg44.pkg584.m4751
+from pkg5.pkg75.pkg987 import m19742
+from . import m12186
+from pkg6.pkg85.pkg1114 import m1113
+
+
+def helper_24690_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 39278."""
+from . import m28858
+from . import m1766
+import pkg6.pkg89.pkg1168.m3251
+from . import m24690
+import pkg5.pkg71.pkg929.m928
+from pkg3.pkg42.pkg558 import m25565
+from . import m22606
+from pkg2.pkg30 import m29
+import pkg3.pkg42.m12545
+from pkg1.pkg18 import m17
+
+
+def helper_39278_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39278_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
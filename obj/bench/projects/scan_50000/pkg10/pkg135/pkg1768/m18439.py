@@ -0,0 +1,31 @@
+"""Module 18439."""
+from . import m3851
+from pkg6.pkg90.pkg1174 import m5341
+import pkg9.pkg129.pkg1686.m1685
+from pkg6.pkg89.pkg1159 import m5326
+from . import m16355
+from pkg4.pkg56 import m55
+import pkg5.m4
+from pkg4.pkg63.pkg826 import m4993
+import pkg2.m1
+
+
+def helper_18439_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_18439_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_18439_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
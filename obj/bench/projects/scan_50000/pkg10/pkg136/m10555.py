@@ -0,0 +1,14 @@
+"""Module 10555."""
+import pkg8.pkg108.pkg1406.m3489
+from pkg7.pkg96.pkg1261 import m1260
+import pkg5.pkg70.pkg913.m5080
+from pkg1.pkg19.pkg257 import m4424
+from . import m8471
+from pkg4.pkg63.pkg821 import m820
+
+
+def helper_10555_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
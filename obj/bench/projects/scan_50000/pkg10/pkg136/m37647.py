@@ -0,0 +1,20 @@
+"""Module 37647."""
+import pkg8.pkg109.pkg1425.m7676
+from pkg3.pkg50.pkg657 import m656
+import pkg1.m0
+from . import m23059
+import pkg9.pkg119.pkg1553.m16140
+from . import m33479
+import pkg10.pkg143.pkg1869.m16456
+from pkg6.pkg83.pkg1087 import m3170
+import pkg2.m1
+from pkg6.pkg84.pkg1099 import m1098
+import pkg7.pkg103.pkg1343.m5510
+from . import m14723
+
+
+def helper_37647_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 41815."""
+from . import m39731
+from pkg10.pkg137.pkg1790 import m3873
+import pkg4.pkg58.pkg762.m27853
+from pkg1.pkg16.pkg219 import m6470
+
+
+def helper_41815_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_41815_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_41815_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,37 @@
+"""Module 1768."""
+import pkg4.pkg61.pkg803.m802
+from pkg3 import m2
+import pkg6.m5
+from pkg9.pkg128.pkg1667 import m1666
+import pkg5.pkg69.pkg899.m898
+from pkg3.pkg48.pkg625 import m624
+import pkg2.pkg38.pkg504.m503
+from pkg3.pkg47.pkg624 import m623
+
+
+def helper_1768_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1768_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1768_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1768_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
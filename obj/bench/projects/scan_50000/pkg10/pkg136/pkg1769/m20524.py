@@ -0,0 +1,14 @@
+"""Module 20524."""
+from . import m14272
+from pkg3.pkg40.pkg525 import m524
+import pkg10.pkg135.pkg1762.m1761
+from pkg7.pkg102.pkg1334 import m5501
+import pkg1.pkg25.m24
+from pkg9.pkg118.pkg1544 import m1543
+
+
+def helper_20524_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,9 @@
+"""Module 22608."""
+from . import m14272
+
+
+def helper_22608_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
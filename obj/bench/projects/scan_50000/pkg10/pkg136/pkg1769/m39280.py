@@ -0,0 +1,51 @@
+"""Module 39280."""
+from . import m37196
+from pkg1.pkg17.pkg231 import m230
+import pkg7.pkg99.pkg1292.m3375
+from pkg3.pkg47.pkg620 import m33963
+import pkg2.pkg37.pkg493.m492
+from pkg5.pkg68.pkg894 import m9229
+import pkg1.pkg14.pkg194.m193
+from pkg10.pkg140.pkg1823 import m10158
+
+
+def helper_39280_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39280_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_39280_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_39280_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_39280_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_39280_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
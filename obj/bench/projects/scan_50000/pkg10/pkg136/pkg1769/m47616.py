@@ -0,0 +1,27 @@
+"""Module 47616."""
+import pkg4.pkg60.pkg783.m25790
+from pkg1.pkg16.pkg210 import m18965
+import pkg11.pkg148.pkg1927.m33186
+from . import m35112
+import pkg7.pkg98.pkg1281.m11700
+from . import m3852
+import pkg10.pkg132.pkg1724.m1723
+from pkg4.pkg54.pkg708 import m707
+import pkg6.pkg83.pkg1082.m15669
+from pkg1.pkg14.pkg191 import m39786
+import pkg1.pkg18.pkg239.m238
+from pkg1.pkg26 import m25
+
+
+def helper_47616_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_47616_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
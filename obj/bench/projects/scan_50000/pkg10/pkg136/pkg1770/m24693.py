@@ -0,0 +1,26 @@
+"""Module 24693."""
+import pkg1.pkg26.pkg349.m348
+from pkg2.pkg29.pkg390 import m2473
+import pkg7.pkg94.pkg1235.m9570
+from pkg4.pkg53.pkg694 import m693
+
+
+def helper_24693_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_24693_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_24693_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
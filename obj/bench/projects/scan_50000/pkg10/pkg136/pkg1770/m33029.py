@@ -0,0 +1,55 @@
+"""Module 33029."""
+import pkg4.pkg59.pkg777.m25784
+from pkg3.pkg41.pkg538 import m537
+import pkg8.m7
+from pkg4 import m3
+import pkg6.pkg80.m25087
+from pkg5.pkg71.pkg927 import m926
+import pkg3.pkg46.pkg604.m603
+from pkg8.pkg107.pkg1402 import m1401
+import pkg1.m0
+from pkg1.pkg17 import m16
+from . import m1769
+from pkg3.pkg51.pkg668 import m667
+
+
+def helper_33029_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_33029_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_33029_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_33029_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_33029_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_33029_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
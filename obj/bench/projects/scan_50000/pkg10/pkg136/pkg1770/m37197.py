@@ -0,0 +1,62 @@
+"""Module 37197."""
+import pkg1.pkg14.pkg187.m21026
+from pkg1.pkg18.pkg241 import m29416
+import pkg4.pkg54.m53
+from pkg8.pkg105.pkg1374 import m32633
+import pkg4.pkg53.pkg695.m23618
+from pkg9.pkg129.pkg1681 import m1680
+import pkg9.pkg124.pkg1623.m9958
+from pkg9.pkg125.pkg1632 import m5799
+import pkg4.pkg57.pkg753.m752
+from pkg1 import m0
+import pkg3.m2
+from pkg1.pkg21.pkg278 import m277
+
+
+def helper_37197_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37197_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_37197_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_37197_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_37197_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_37197_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37197_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,35 @@
+"""Module 22610."""
+from . import m5938
+from pkg2.pkg35 import m34
+import pkg10.pkg141.pkg1835.m3918
+from pkg4.pkg61.pkg803 import m802
+import pkg4.pkg61.m60
+from . import m12190
+
+
+def helper_22610_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_22610_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_22610_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_22610_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
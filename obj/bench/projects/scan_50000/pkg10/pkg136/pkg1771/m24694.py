@@ -0,0 +1,17 @@
+"""Module 24694."""
+import pkg10.pkg133.pkg1737.m7988
+from pkg8.pkg107.pkg1395 import m3478
+from . import m16358
+from pkg1 import m0
+import pkg7.pkg98.pkg1285.m7536
+from pkg2.pkg32.pkg417 import m416
+import pkg10.pkg143.pkg1871.m10206
+from pkg8.pkg105 import m104
+import pkg10.pkg138.pkg1806.m1805
+
+
+def helper_24694_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 49702."""
+import pkg1.pkg20.pkg269.m4436
+from pkg7.pkg97.pkg1272 import m7523
+from . import m3854
+from pkg2.pkg32.pkg425 import m6676
+
+
+def helper_49702_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_49702_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,10 @@
+"""Module 8022."""
+import pkg1.m0
+from pkg6.pkg91.pkg1186 import m1185
+
+
+def helper_8022_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,33 @@
+"""Module 14275."""
+import pkg1.m0
+from pkg7.pkg97 import m96
+import pkg10.pkg132.pkg1725.m1724
+from pkg8.pkg111.pkg1456 import m7707
+from . import m1771
+from . import m8023
+import pkg2.pkg28.pkg370.m369
+from pkg9 import m8
+import pkg2.pkg34.pkg443.m12946
+from pkg11.pkg150.pkg1961 import m10296
+import pkg1.pkg25.pkg327.m4494
+
+
+def helper_14275_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14275_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_14275_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
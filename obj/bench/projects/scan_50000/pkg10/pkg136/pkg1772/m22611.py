@@ -0,0 +1,14 @@
+"""Module 22611."""
+import pkg6.pkg85.pkg1111.m1110
+from pkg4.pkg56.pkg729 import m15316
+import pkg11.pkg148.pkg1926.m1925
+from . import m3855
+from . import m8023
+from pkg10.pkg141 import m2224
+
+
+def helper_22611_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
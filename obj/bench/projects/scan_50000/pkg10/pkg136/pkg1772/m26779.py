@@ -0,0 +1,62 @@
+"""Module 26779."""
+from . import m22611
+from . import m16359
+import pkg11.pkg145.pkg1891.m1890
+from pkg9.pkg128.pkg1674 import m1673
+import pkg9.pkg119.pkg1549.m1548
+from . import m18443
+import pkg1.m0
+from pkg9.pkg130.pkg1700 import m12119
+import pkg3.pkg41.pkg539.m538
+from pkg2.pkg33.pkg436 import m23359
+import pkg1.pkg18.pkg235.m234
+from pkg1.pkg21.pkg279 import m14866
+
+
+def helper_26779_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_26779_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_26779_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_26779_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_26779_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_26779_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_26779_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,28 @@
+"""Module 28863."""
+import pkg3.pkg50.pkg661.m8996
+from pkg7.pkg100.pkg1308 import m1307
+from . import m22611
+from pkg3 import m2
+import pkg1.pkg16.pkg218.m217
+from pkg8.pkg117.pkg1534 import m1533
+
+
+def helper_28863_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_28863_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_28863_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
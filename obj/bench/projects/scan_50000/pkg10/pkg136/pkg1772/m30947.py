@@ -0,0 +1,22 @@
+"""Module 30947."""
+import pkg5.pkg71.pkg925.m3008
+from pkg9.pkg125.pkg1634 import m28725
+import pkg4.pkg59.pkg777.m17448
+from . import m5939
+import pkg1.pkg20.pkg262.m2345
+from . import m1771
+import pkg11.pkg152.m8487
+
+
+def helper_30947_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_30947_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
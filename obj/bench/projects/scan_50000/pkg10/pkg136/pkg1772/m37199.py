@@ -0,0 +1,25 @@
+"""Module 37199."""
+import pkg6.pkg88.m23011
+from pkg6.pkg86.pkg1130 import m3213
+import pkg4.pkg58.pkg764.m17435
+
+
+def helper_37199_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37199_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_37199_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,41 @@
+"""Module 41367."""
+import pkg9.pkg122.pkg1598.m41193
+from pkg6.pkg87.pkg1134 import m15721
+import pkg2.pkg33.pkg435.m434
+from pkg1.pkg24.pkg324 import m323
+import pkg7.pkg104.pkg1355.m1354
+from pkg6.pkg90.pkg1172 import m28263
+import pkg4.pkg57.pkg745.m744
+from pkg6.pkg84.pkg1096 import m21935
+import pkg13.m12
+from pkg9.pkg124 import m123
+import pkg3.pkg41.pkg545.m544
+from pkg3.pkg46.pkg602 import m15189
+
+
+def helper_41367_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_41367_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_41367_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_41367_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,30 @@
+"""Module 14276."""
+import pkg3.pkg49.pkg641.m640
+from pkg4.pkg57 import m56
+from . import m3856
+from pkg2.pkg29 import m2112
+import pkg8.pkg114.pkg1494.m9829
+from pkg1.pkg17.pkg232 import m2315
+import pkg9.pkg118.pkg1540.m1539
+from pkg6.pkg81.pkg1054 import m1053
+
+
+def helper_14276_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14276_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_14276_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,23 @@
+"""Module 18444."""
+import pkg4.pkg59.pkg771.m4938
+from pkg10.pkg138.pkg1807 import m1806
+import pkg1.m0
+from pkg6.pkg88 import m87
+import pkg9.m8
+from . import m10108
+import pkg1.m8336
+from . import m16360
+
+
+def helper_18444_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_18444_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
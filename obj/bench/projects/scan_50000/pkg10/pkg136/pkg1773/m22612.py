@@ -0,0 +1,20 @@
+"""Module 22612."""
+import pkg3.pkg51.pkg667.m19422
+from pkg2.pkg38.pkg496 import m10915
+import pkg4.pkg54.pkg709.m708
+from pkg6.pkg84.pkg1103 import m5270
+import pkg6.pkg84.pkg1094.m3177
+
+
+def helper_22612_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_22612_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 26780."""
+import pkg6.pkg86.m85
+from . import m1772
+from . import m22612
+from pkg7.pkg101.pkg1316 import m9651
+import pkg3.pkg52.m51
+from . import m18444
+import pkg1.pkg25.pkg328.m327
+from . import m10108
+import pkg1.pkg23.pkg308.m307
+from pkg11.pkg156.pkg2030 import m6197
+
+
+def helper_26780_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_26780_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,60 @@
+"""Module 28864."""
+import pkg1.pkg21.pkg283.m282
+from pkg10.pkg140.pkg1831 import m3914
+import pkg7.pkg96.pkg1249.m9584
+from pkg2.pkg39.pkg516 import m2599
+import pkg1.pkg22.pkg294.m8629
+from . import m16360
+import pkg3.pkg42.pkg547.m546
+from pkg5.pkg67.pkg877 import m876
+import pkg2.pkg37.m4204
+from pkg2.pkg31 import m8366
+
+
+def helper_28864_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_28864_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_28864_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_28864_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_28864_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_28864_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_28864_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
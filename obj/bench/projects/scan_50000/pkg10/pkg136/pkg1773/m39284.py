@@ -0,0 +1,18 @@
+"""Module 39284."""
+import pkg6.pkg90.pkg1174.m5341
+from . import m33032
+import pkg2.pkg39.pkg512.m511
+from pkg7.pkg94.pkg1235 import m1234
+import pkg5.pkg66.pkg860.m32119
+from pkg9.pkg119.pkg1553 import m1552
+import pkg1.pkg15.pkg204.m203
+from pkg5.pkg73.pkg954 import m32213
+import pkg4.pkg57.pkg747.m21586
+from pkg5 import m4
+
+
+def helper_39284_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
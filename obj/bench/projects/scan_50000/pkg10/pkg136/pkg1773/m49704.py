@@ -0,0 +1,26 @@
+"""Module 49704."""
+import pkg10.pkg137.pkg1794.m1793
+from pkg4.pkg58.pkg755 import m27846
+from . import m3856
+from . import m37200
+
+
+def helper_49704_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_49704_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_49704_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,35 @@
+"""Module 8024."""
+import pkg3.pkg43.pkg561.m6812
+from . import m5940
+import pkg8.pkg115.pkg1502.m3585
+from pkg2.pkg38 import m37
+import pkg1.pkg20.m19
+from pkg5 import m4
+
+
+def helper_8024_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8024_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8024_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8024_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
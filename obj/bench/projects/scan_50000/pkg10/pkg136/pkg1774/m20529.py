@@ -0,0 +1,62 @@
+"""Module 20529."""
+import pkg3.pkg46.pkg602.m601
+from pkg11.pkg154.pkg2003 import m2002
+import pkg5.pkg66.m65
+from pkg6.pkg90.pkg1177 import m17848
+import pkg5.pkg72.pkg939.m5106
+from pkg3.pkg42.pkg559 import m17230
+import pkg3.pkg44.pkg580.m579
+from pkg1.pkg14 import m13
+import pkg6.pkg83.pkg1087.m1086
+from pkg11.pkg153.pkg1992 import m10327
+import pkg3.pkg49.pkg639.m638
+from pkg7.pkg101.pkg1315 import m5482
+
+
+def helper_20529_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_20529_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_20529_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_20529_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_20529_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_20529_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_20529_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
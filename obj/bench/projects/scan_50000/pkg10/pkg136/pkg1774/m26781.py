@@ -0,0 +1,53 @@
+"""Module 26781."""
+import pkg1.pkg21.pkg280.m8615
+from pkg3.pkg47.pkg612 import m11031
+import pkg9.pkg128.m127
+from pkg11.pkg144 import m143
+import pkg1.pkg22.pkg291.m2374
+from pkg4.pkg57.pkg746 import m745
+import pkg11.pkg156.pkg2031.m4114
+from pkg8.pkg113.pkg1481 import m24404
+import pkg3.pkg52.pkg677.m2760
+from . import m5941
+
+
+def helper_26781_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_26781_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_26781_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_26781_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_26781_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_26781_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
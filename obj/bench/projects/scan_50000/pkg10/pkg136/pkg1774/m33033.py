@@ -0,0 +1,12 @@
+"""Module 33033."""
+import pkg11.pkg154.pkg2005.m2004
+from pkg10.pkg138.pkg1801 import m18472
+from . import m1773
+from pkg7.pkg104.pkg1364 import m3447
+
+
+def helper_33033_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
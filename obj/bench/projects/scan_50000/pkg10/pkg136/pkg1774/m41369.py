@@ -0,0 +1,13 @@
+"""Module 41369."""
+import pkg2.pkg33.pkg438.m437
+from pkg7.pkg99.pkg1291 import m3374
+import pkg11.pkg153.pkg1995.m4078
+from pkg3.pkg43.pkg567 import m8902
+import pkg9.pkg124.pkg1625.m1624
+from pkg8.pkg110.pkg1433 import m30608
+import pkg2.pkg38.m37
+from pkg4.pkg53.pkg698 import m40293
+from . import m16361
+from pkg12.pkg158 import m16829
+import pkg10.pkg131.pkg1710.m1709
+from pkg4.pkg58.pkg758 import m7009
@@ -0,0 +1,19 @@
+"""Module 43453."""
+import pkg3.m2
+from . import m3857
+import pkg12.pkg165.m164
+from pkg5.pkg71.pkg932 import m7183
+from . import m41369
+from pkg2.pkg27 import m26
+import pkg5.pkg70.pkg913.m9248
+from . import m10109
+import pkg1.pkg22.pkg294.m33637
+from . import m14277
+import pkg12.pkg157.pkg2053.m4136
+
+
+def helper_43453_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,44 @@
+"""Module 47621."""
+import pkg5.pkg73.pkg952.m951
+from . import m20529
+import pkg3.pkg42.pkg556.m6807
+from pkg9.pkg123.pkg1610 import m5777
+from . import m16361
+from pkg7.pkg104 import m103
+import pkg10.pkg139.pkg1820.m43499
+from pkg12.pkg166 import m165
+
+
+def helper_47621_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_47621_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_47621_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_47621_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_47621_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
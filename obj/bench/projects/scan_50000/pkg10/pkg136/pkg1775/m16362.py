@@ -0,0 +1,55 @@
+"""Module 16362."""
+import pkg2.pkg36.pkg476.m15063
+from pkg3.pkg48.pkg632 import m631
+import pkg6.pkg85.pkg1110.m5277
+from . import m12194
+from . import m10110
+from pkg10.pkg135.pkg1768 import m1767
+import pkg5.pkg76.pkg999.m7250
+from pkg8.pkg112 import m6363
+import pkg8.pkg105.pkg1373.m5540
+from pkg3.pkg46.pkg601 import m11020
+from . import m5942
+from pkg6.pkg85 import m84
+
+
+def helper_16362_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16362_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_16362_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_16362_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_16362_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_16362_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
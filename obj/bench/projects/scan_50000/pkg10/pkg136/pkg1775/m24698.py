@@ -0,0 +1,53 @@
+"""Module 24698."""
+import pkg6.pkg86.pkg1125.m3208
+from pkg4.pkg60.pkg784 import m783
+import pkg10.pkg140.pkg1833.m6000
+from pkg9.pkg125.pkg1629 import m7880
+from . import m22614
+from . import m8026
+from . import m5942
+from pkg6.pkg83.pkg1091 import m1090
+import pkg8.pkg109.pkg1418.m20173
+from pkg4.pkg60.pkg791 import m4958
+
+
+def helper_24698_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_24698_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_24698_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_24698_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_24698_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_24698_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,29 @@
+"""Module 30950."""
+import pkg11.pkg153.pkg2002.m4085
+from pkg7.pkg92.pkg1201 import m19956
+import pkg6.pkg83.pkg1085.m11504
+from pkg2.pkg30.pkg397 import m396
+import pkg5.pkg67.pkg879.m878
+from pkg11.pkg144.pkg1883 import m8134
+import pkg8.pkg109.pkg1427.m13930
+
+
+def helper_30950_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_30950_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_30950_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
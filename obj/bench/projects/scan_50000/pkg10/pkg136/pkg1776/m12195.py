@@ -0,0 +1,35 @@
+"""Module 12195."""
+import pkg1.pkg23.pkg309.m308
+from pkg5.pkg68.pkg894 import m7145
+import pkg1.pkg19.pkg253.m252
+from pkg1 import m0
+import pkg5.pkg75.pkg979.m7230
+from pkg7.pkg104.pkg1353 import m1352
+
+
+def helper_12195_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12195_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_12195_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_12195_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 28867."""
+import pkg10.pkg141.pkg1839.m6006
+from pkg5.pkg69.pkg900 import m19655
+from . import m14279
+
+
+def helper_28867_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_28867_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
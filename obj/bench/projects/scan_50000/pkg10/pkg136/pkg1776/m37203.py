@@ -0,0 +1,19 @@
+"""Module 37203."""
+import pkg5.pkg69.pkg901.m36328
+from pkg3.pkg47.pkg617 import m15204
+import pkg12.pkg166.m165
+from pkg13 import m12
+import pkg6.pkg81.pkg1063.m1062
+from . import m26783
+import pkg9.pkg125.pkg1632.m7883
+from pkg6.pkg90.pkg1175 import m19930
+import pkg7.pkg94.pkg1223.m13726
+from pkg4.pkg65.pkg855 import m27946
+import pkg2.pkg30.pkg392.m29567
+
+
+def helper_37203_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
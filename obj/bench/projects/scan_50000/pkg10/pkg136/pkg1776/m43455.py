@@ -0,0 +1,16 @@
+"""Module 43455."""
+import pkg4.pkg55.pkg723.m722
+from . import m20531
+import pkg9.pkg118.pkg1545.m22384
+from pkg1 import m6252
+import pkg3.pkg44.pkg579.m2662
+from pkg7.pkg94.pkg1230 import m7481
+import pkg5.pkg70.pkg920.m11339
+from pkg9.pkg129.pkg1680 import m14183
+
+
+def helper_43455_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
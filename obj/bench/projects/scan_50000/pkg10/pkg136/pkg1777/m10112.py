@@ -0,0 +1,32 @@
+"""Module 10112."""
+import pkg5.pkg66.m65
+from pkg7.pkg92.pkg1209 import m5376
+import pkg1.pkg26.pkg347.m346
+from pkg9.pkg119 import m4286
+import pkg12.pkg157.pkg2045.m6212
+from pkg3.pkg49.pkg645 import m6896
+import pkg7.pkg97.pkg1262.m5429
+from pkg3.pkg47.pkg612 import m6863
+import pkg1.pkg14.pkg189.m188
+from pkg5.pkg71 import m70
+
+
+def helper_10112_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10112_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_10112_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,28 @@
+"""Module 14280."""
+import pkg4.m3
+from . import m5944
+from . import m12196
+from pkg2.pkg38.pkg499 import m13002
+import pkg1.pkg14.pkg188.m187
+from pkg1.pkg19.pkg251 import m4418
+
+
+def helper_14280_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14280_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_14280_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 37204."""
+import pkg1.pkg15.pkg206.m205
+from pkg11.pkg146.pkg1899 import m1898
+import pkg5.pkg75.pkg979.m13482
+from pkg7.pkg103 import m102
+import pkg6.pkg85.pkg1110.m1109
+from pkg11.pkg146.pkg1907 import m8158
+import pkg11.pkg154.pkg2003.m2002
+from . import m12196
+from . import m18448
+from . import m33036
+import pkg5.pkg69.m68
+
+
+def helper_37204_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37204_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,54 @@
+"""Module 43456."""
+import pkg10.pkg136.pkg1775.m3858
+from pkg5.pkg77.pkg1014 import m1013
+import pkg6.pkg82.pkg1077.m30252
+from pkg8.pkg115.pkg1501 import m41096
+import pkg8.pkg110.pkg1443.m3526
+from pkg6.pkg85.pkg1112 import m1111
+import pkg6.pkg79.pkg1029.m1028
+from pkg2.pkg28 import m27
+from . import m1776
+from pkg2.pkg32.pkg422 import m2505
+import pkg13.pkg181.m8516
+
+
+def helper_43456_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_43456_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_43456_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_43456_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_43456_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_43456_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
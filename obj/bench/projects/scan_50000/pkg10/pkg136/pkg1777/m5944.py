@@ -0,0 +1,20 @@
+"""Module 5944."""
+import pkg12.pkg162.m161
+from pkg5.pkg67.pkg877 import m876
+import pkg2.pkg39.pkg518.m2601
+from . import m1776
+import pkg2.pkg27.pkg359.m358
+
+
+def helper_5944_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5944_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 8028."""
+import pkg5.pkg76.pkg1001.m1000
+from pkg2.pkg36.pkg471 import m2554
+import pkg3.pkg49.m48
+
+
+def helper_8028_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8028_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
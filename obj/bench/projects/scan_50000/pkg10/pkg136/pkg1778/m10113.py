@@ -0,0 +1,27 @@
+"""Module 10113."""
+import pkg1.pkg14.pkg192.m191
+from pkg6.pkg81.pkg1065 import m3148
+import pkg4.pkg56.pkg732.m731
+from pkg8.pkg114.pkg1489 import m3572
+import pkg1.pkg22.m21
+
+
+def helper_10113_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10113_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_10113_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
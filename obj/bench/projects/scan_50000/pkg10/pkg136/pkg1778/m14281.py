@@ -0,0 +1,13 @@
+"""Module 14281."""
+from . import m3861
+from . import m12197
+import pkg8.pkg108.pkg1416.m13919
+from pkg6.pkg87.pkg1142 import m1141
+import pkg3.pkg50.pkg654.m653
+
+
+def helper_14281_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
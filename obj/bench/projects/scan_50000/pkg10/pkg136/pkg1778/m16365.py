@@ -0,0 +1,17 @@
+"""Module 16365."""
+from . import m12197
+from pkg1.pkg19.pkg257 import m256
+
+
+def helper_16365_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16365_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 22617."""
+import pkg8.pkg112.pkg1462.m20217
+from pkg8.pkg108.pkg1406 import m18077
+import pkg8.pkg117.pkg1527.m20282
+from pkg3.pkg43.pkg561 import m560
+
+
+def helper_22617_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_22617_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_22617_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,16 @@
+"""Module 28869."""
+import pkg8.pkg111.pkg1448.m26455
+from pkg13.pkg179 import m178
+import pkg4.pkg62.m61
+from pkg9.pkg122.pkg1588 import m7839
+import pkg1.m0
+from pkg1.pkg16.pkg211 import m210
+from . import m20533
+from pkg8.pkg105.pkg1371 import m15958
+
+
+def helper_28869_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
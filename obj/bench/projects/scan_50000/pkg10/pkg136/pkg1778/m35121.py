@@ -0,0 +1,20 @@
+"""Module 35121."""
+import pkg5.pkg68.pkg893.m892
+from pkg4.pkg53.pkg690 import m9025
+import pkg3.pkg49.m48
+from pkg9.pkg118 import m117
+import pkg2.pkg28.pkg365.m364
+
+
+def helper_35121_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35121_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
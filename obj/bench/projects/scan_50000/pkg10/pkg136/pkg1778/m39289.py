@@ -0,0 +1,41 @@
+"""Module 39289."""
+import pkg4.pkg64.pkg841.m38352
+from . import m3861
+import pkg8.pkg111.pkg1448.m9783
+from pkg8.pkg108.pkg1407 import m1406
+import pkg8.pkg114.pkg1493.m5660
+from pkg5.pkg77.pkg1010 import m3093
+import pkg3.pkg48.pkg626.m38137
+from pkg3.pkg45.pkg587 import m6838
+from . import m8029
+from pkg5.pkg75 import m2158
+import pkg1.pkg26.pkg343.m342
+from pkg12.pkg159 import m158
+
+
+def helper_39289_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39289_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_39289_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_39289_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,47 @@
+"""Module 5945."""
+import pkg1.pkg17.pkg230.m229
+from pkg4.pkg64.pkg842 import m5009
+from . import m3861
+from pkg8.pkg113 import m112
+import pkg7.pkg103.pkg1342.m5509
+from pkg8.pkg105.pkg1367 import m5534
+import pkg2.pkg28.pkg374.m373
+from pkg4 import m3
+import pkg7.pkg98.pkg1287.m3370
+from pkg4.pkg64.pkg834 import m5001
+import pkg4.pkg53.m52
+
+
+def helper_5945_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5945_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5945_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5945_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_5945_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
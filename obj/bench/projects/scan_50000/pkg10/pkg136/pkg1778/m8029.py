@@ -0,0 +1,18 @@
+"""Module 8029."""
+import pkg7.pkg103.pkg1344.m1343
+from . import m3861
+import pkg8.pkg116.pkg1514.m7765
+from pkg8.pkg110.pkg1431 import m1430
+import pkg1.pkg19.pkg258.m2341
+from pkg1 import m0
+import pkg10.pkg138.pkg1800.m3883
+from pkg3.pkg49.pkg643 import m2726
+import pkg5.pkg78.pkg1024.m1023
+from . import m5945
+
+
+def helper_8029_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
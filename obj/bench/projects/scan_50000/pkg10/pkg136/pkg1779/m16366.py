@@ -0,0 +1,28 @@
+"""Module 16366."""
+import pkg5.pkg68.pkg893.m5060
+from pkg9.pkg125.pkg1626 import m7877
+import pkg2.pkg39.pkg510.m4677
+from pkg1 import m0
+from . import m5946
+from pkg4.pkg61.pkg798 import m797
+
+
+def helper_16366_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16366_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_16366_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
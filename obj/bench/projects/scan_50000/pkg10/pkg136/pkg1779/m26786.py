@@ -0,0 +1,40 @@
+"""Module 26786."""
+import pkg8.pkg112.pkg1459.m3542
+from pkg4.pkg53.pkg694 import m693
+from . import m1778
+from pkg2.pkg36.pkg471 import m12974
+import pkg4.pkg58.pkg761.m9096
+from pkg7.pkg101.pkg1320 import m3403
+import pkg5.pkg71.pkg935.m11354
+from pkg1 import m0
+import pkg2.pkg38.pkg496.m495
+from pkg1.pkg19.pkg248 import m21087
+import pkg5.pkg73.pkg957.m5124
+
+
+def helper_26786_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_26786_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_26786_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_26786_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,23 @@
+"""Module 28870."""
+import pkg2.pkg39.pkg518.m517
+from pkg9.pkg119.pkg1549 import m24472
+from . import m22618
+from . import m14282
+import pkg1.m0
+from . import m3862
+import pkg1.pkg24.pkg323.m322
+from pkg8.pkg116.pkg1514 import m3597
+
+
+def helper_28870_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_28870_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
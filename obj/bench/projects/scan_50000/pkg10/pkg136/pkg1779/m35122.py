@@ -0,0 +1,10 @@
+"""Module 35122."""
+import pkg11.pkg153.m152
+from pkg10.pkg131.pkg1714 import m24637
+
+
+def helper_35122_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 37206."""
+import pkg8.pkg105.pkg1376.m1375
+from pkg2.pkg27.pkg360 import m359
+import pkg5.m4
+
+
+def helper_37206_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
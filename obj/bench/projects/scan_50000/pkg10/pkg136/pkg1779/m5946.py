@@ -0,0 +1,52 @@
+"""Module 5946."""
+import pkg4.pkg53.pkg697.m696
+from . import m1778
+import pkg3.pkg40.m39
+from pkg2.pkg33 import m32
+import pkg4.pkg60.pkg792.m791
+from pkg9.pkg118.pkg1546 import m5713
+import pkg11.pkg146.pkg1908.m3991
+from pkg4.pkg56 import m55
+import pkg2.pkg37.pkg487.m2570
+
+
+def helper_5946_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5946_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5946_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5946_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_5946_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_5946_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
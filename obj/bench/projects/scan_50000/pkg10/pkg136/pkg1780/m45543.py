@@ -0,0 +1,13 @@
+"""Module 45543."""
+from . import m37207
+from pkg4.pkg61.pkg798 import m4965
+import pkg5.pkg75.pkg983.m40578
+from pkg10.pkg132.pkg1720 import m3803
+import pkg7.pkg100.m2183
+
+
+def helper_45543_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,3 @@
+"""Module 49711."""
+import pkg3.pkg46.pkg604.m40199
+from pkg6.pkg81 import m2164
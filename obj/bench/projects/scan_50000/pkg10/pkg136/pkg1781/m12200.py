@@ -0,0 +1,55 @@
+"""Module 12200."""
+import pkg5.m4
+from pkg1.pkg15.pkg204 import m203
+from . import m1780
+from . import m10116
+import pkg3.pkg48.pkg629.m628
+from . import m8032
+from . import m3864
+from pkg2.pkg27.pkg360 import m2443
+import pkg6.pkg87.pkg1144.m3227
+from pkg11.pkg146.pkg1908 import m3991
+import pkg8.pkg116.pkg1521.m9856
+from pkg3.pkg41.pkg541 import m540
+
+
+def helper_12200_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12200_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_12200_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_12200_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_12200_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_12200_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,24 @@
+"""Module 35124."""
+import pkg4.m3
+from pkg5.pkg75.pkg983 import m9318
+import pkg3.pkg44.pkg579.m4746
+from pkg1 import m0
+import pkg4.pkg59.pkg774.m4941
+from pkg1.pkg14.pkg183 import m10602
+import pkg4.pkg60.pkg789.m788
+from pkg1.pkg24 import m23
+from . import m14284
+
+
+def helper_35124_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35124_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
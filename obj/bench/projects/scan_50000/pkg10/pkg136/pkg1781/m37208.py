@@ -0,0 +1,20 @@
+"""Module 37208."""
+import pkg8.pkg117.pkg1530.m3613
+from pkg5.pkg71.pkg933 import m7184
+import pkg2.pkg30.pkg392.m391
+from pkg3 import m2
+import pkg2.pkg39.m38
+
+
+def helper_37208_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37208_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,62 @@
+"""Module 41376."""
+import pkg7.pkg95.m4262
+from . import m35124
+from . import m8032
+from pkg4.pkg60.pkg784 import m2867
+import pkg11.pkg144.pkg1876.m12295
+from pkg4.pkg65.pkg847 import m2930
+from . import m16368
+from pkg6.pkg83.pkg1082 import m17753
+import pkg6.pkg80.pkg1043.m28134
+from pkg1.pkg15 import m14
+import pkg5.pkg68.pkg885.m884
+from pkg6 import m5
+
+
+def helper_41376_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_41376_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_41376_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_41376_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_41376_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_41376_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_41376_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
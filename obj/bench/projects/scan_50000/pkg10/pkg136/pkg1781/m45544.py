@@ -0,0 +1,51 @@
+"""Module 45544."""
+import pkg7.pkg101.pkg1322.m11741
+from pkg5.pkg73 import m72
+import pkg9.pkg128.pkg1667.m3750
+from pkg5.pkg68.pkg896 import m2979
+import pkg2.pkg34.pkg454.m29629
+from pkg9.pkg128.pkg1667 import m1666
+import pkg7.pkg92.pkg1203.m1202
+from pkg1.pkg26.pkg347 import m4514
+
+
+def helper_45544_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_45544_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_45544_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_45544_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_45544_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_45544_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
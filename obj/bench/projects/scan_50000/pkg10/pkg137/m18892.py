@@ -0,0 +1,11 @@
+"""Module 18892."""
+import pkg4.pkg65.pkg854.m11273
+from . import m4304
+import pkg5.pkg71.pkg926.m15513
+
+
+def helper_18892_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 8472."""
+import pkg12.pkg158.pkg2065.m2064
+from pkg1 import m0
+from . import m4304
+from pkg4.pkg53 import m52
+import pkg5.pkg67.pkg875.m7126
+from pkg2.pkg39.pkg508 import m507
+import pkg1.pkg18.pkg239.m2322
+from . import m136
+import pkg3.m2
+from pkg2.pkg33.pkg434 import m2517
+
+
+def helper_8472_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8472_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,24 @@
+"""Module 24705."""
+import pkg6.pkg82.pkg1079.m19834
+from pkg6.pkg79 import m78
+import pkg1.pkg24.pkg313.m2396
+from pkg10.pkg141.pkg1834 import m12253
+import pkg1.m0
+from pkg3.pkg47 import m46
+import pkg3.pkg41.pkg545.m8880
+from pkg5.pkg68.pkg897 import m11316
+import pkg2.pkg32.pkg417.m416
+
+
+def helper_24705_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_24705_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
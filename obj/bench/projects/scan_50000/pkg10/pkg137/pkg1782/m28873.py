@@ -0,0 +1,27 @@
+"""Module 28873."""
+import pkg2.pkg37.pkg485.m23408
+from . import m16369
+import pkg11.pkg156.pkg2031.m2030
+from pkg8.pkg108.pkg1411 import m1410
+import pkg2.pkg36.pkg477.m17148
+
+
+def helper_28873_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_28873_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_28873_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,10 @@
+"""Module 30957."""
+import pkg12.pkg159.pkg2068.m6235
+from . import m1781
+
+
+def helper_30957_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
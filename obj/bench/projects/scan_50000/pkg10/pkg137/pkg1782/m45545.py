@@ -0,0 +1,69 @@
+"""Module 45545."""
+import pkg10.pkg141.pkg1836.m43515
+from pkg9.pkg129.pkg1679 import m30854
+import pkg4.pkg59.pkg777.m776
+from pkg10.pkg135 import m134
+import pkg6.pkg82.pkg1079.m1078
+from pkg6.pkg85.pkg1118 import m1117
+import pkg5.pkg77.pkg1014.m5181
+from pkg5 import m4
+import pkg8.pkg111.pkg1448.m43127
+from pkg2.pkg39.pkg514 import m15101
+import pkg7.pkg98.m97
+from pkg11 import m10
+
+
+def helper_45545_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_45545_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_45545_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_45545_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_45545_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_45545_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_45545_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_45545_42(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
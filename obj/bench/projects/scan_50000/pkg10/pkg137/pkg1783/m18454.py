@@ -0,0 +1,27 @@
+"""Module 18454."""
+import pkg2.pkg30.pkg399.m398
+from pkg2.pkg37.pkg489 import m15076
+import pkg5.pkg67.pkg874.m2957
+from . import m8034
+from . import m3866
+
+
+def helper_18454_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_18454_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_18454_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,43 @@
+"""Module 26790."""
+import pkg8.pkg109.pkg1423.m26430
+from pkg8.pkg115.pkg1505 import m26512
+import pkg11.pkg152.pkg1977.m1976
+from pkg8.pkg115.pkg1501 import m11920
+import pkg10.pkg131.pkg1705.m12124
+from pkg4.pkg56.pkg732 import m17403
+import pkg7.pkg93.pkg1210.m26217
+
+
+def helper_26790_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_26790_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_26790_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_26790_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_26790_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
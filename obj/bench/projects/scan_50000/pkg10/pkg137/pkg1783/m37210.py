@@ -0,0 +1,33 @@
+"""Module 37210."""
+import pkg1.pkg23.pkg308.m25315
+from pkg3.pkg42.pkg559 import m558
+import pkg9.pkg127.pkg1656.m5823
+from . import m20538
+import pkg4.pkg53.pkg701.m6952
+from pkg3.pkg50.pkg659 import m4826
+import pkg7.pkg92.pkg1197.m11616
+from pkg3.pkg46.pkg607 import m606
+from . import m18454
+from . import m5950
+import pkg1.m0
+
+
+def helper_37210_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37210_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_37210_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,36 @@
+"""Module 43462."""
+import pkg6.pkg87.pkg1135.m13638
+from pkg6.pkg89 import m88
+from . import m33042
+from pkg4.pkg62.pkg813 import m11232
+from . import m26790
+from . import m39294
+import pkg8.pkg109.pkg1426.m1425
+
+
+def helper_43462_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_43462_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_43462_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_43462_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
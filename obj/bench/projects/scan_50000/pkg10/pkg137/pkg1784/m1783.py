@@ -0,0 +1,5 @@
+"""Module 1783."""
+import pkg3.pkg44.pkg579.m578
+from pkg4.pkg53.pkg700 import m699
+import pkg7.pkg97.pkg1265.m1264
+from pkg3.pkg41.pkg536 import m535
@@ -0,0 +1,19 @@
+"""Module 20539."""
+import pkg8.pkg107.pkg1400.m3483
+from pkg1.pkg14 import m13
+import pkg2.pkg31.m30
+from . import m8035
+
+
+def helper_20539_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_20539_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,13 @@
+"""Module 37211."""
+import pkg10.pkg137.pkg1788.m1787
+from pkg1.pkg21.pkg279 import m278
+import pkg5.pkg77.pkg1013.m3096
+from pkg2.pkg35.pkg467 import m8802
+import pkg7.pkg99.pkg1295.m24218
+
+
+def helper_37211_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,44 @@
+"""Module 5951."""
+import pkg3.pkg40.m39
+from pkg7.pkg95.pkg1238 import m1237
+import pkg8.pkg113.pkg1480.m5647
+from pkg1.pkg17.pkg227 import m226
+import pkg8.pkg112.pkg1463.m3546
+from pkg10.pkg131.pkg1706 import m1705
+import pkg8.pkg115.pkg1496.m1495
+from pkg3.pkg44 import m43
+
+
+def helper_5951_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5951_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5951_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5951_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_5951_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
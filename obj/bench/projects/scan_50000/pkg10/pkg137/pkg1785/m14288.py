@@ -0,0 +1,19 @@
+"""Module 14288."""
+import pkg6.pkg87.pkg1141.m1140
+from . import m3868
+import pkg2.pkg27.pkg358.m357
+from pkg9.pkg118 import m10537
+
+
+def helper_14288_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14288_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,45 @@
+"""Module 16372."""
+import pkg2.pkg32.pkg426.m8761
+from pkg1.pkg22.pkg295 import m294
+import pkg7.pkg93.pkg1212.m13715
+from . import m1784
+import pkg3.pkg40.pkg521.m8856
+from pkg1.pkg15.pkg197 import m196
+from . import m5952
+from pkg1.pkg25.pkg328 import m327
+import pkg4.pkg58.pkg755.m2838
+
+
+def helper_16372_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16372_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_16372_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_16372_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_16372_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,31 @@
+"""Module 20540."""
+import pkg10.pkg143.pkg1869.m6036
+from pkg5.pkg67.pkg873 import m19628
+import pkg7.pkg98.pkg1277.m5444
+from pkg8 import m7
+import pkg10.pkg138.m137
+from pkg10.pkg132.pkg1721 import m3804
+import pkg1.pkg20.pkg270.m269
+from pkg8.pkg108 import m107
+import pkg4.m3
+
+
+def helper_20540_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_20540_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_20540_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
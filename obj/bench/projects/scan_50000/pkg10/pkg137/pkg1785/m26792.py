@@ -0,0 +1,26 @@
+"""Module 26792."""
+import pkg8.pkg105.pkg1373.m18044
+from pkg9.pkg128.pkg1666 import m7917
+from . import m5952
+from pkg9.pkg129.pkg1678 import m5845
+import pkg6.pkg85.pkg1108.m9443
+from pkg9.pkg128.pkg1676 import m12095
+import pkg2.pkg31.pkg410.m4577
+from pkg5.pkg75.pkg976 import m975
+import pkg7.pkg95.pkg1246.m7497
+from . import m24708
+from . import m20540
+
+
+def helper_26792_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_26792_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,12 @@
+"""Module 33044."""
+import pkg7.pkg95.pkg1244.m1243
+from pkg1.pkg24.pkg319 import m6570
+from . import m1784
+from pkg4.pkg54.pkg710 import m709
+import pkg4.pkg60.m59
+from pkg5.pkg73.pkg955 import m954
+import pkg4.pkg56.pkg731.m730
+from pkg6.pkg80.pkg1051 import m1050
+import pkg10.pkg132.pkg1721.m18392
+from pkg4.pkg65 import m64
+import pkg3.pkg40.pkg530.m25537
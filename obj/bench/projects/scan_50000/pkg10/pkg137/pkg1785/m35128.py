@@ -0,0 +1,62 @@
+"""Module 35128."""
+import pkg1.pkg25.pkg333.m21172
+from pkg3.pkg47.pkg613 import m2696
+import pkg8.pkg109.pkg1430.m20185
+from pkg3.pkg51.pkg674 import m4841
+import pkg1.pkg15.pkg208.m33551
+from pkg3.pkg46.pkg604 import m603
+import pkg1.pkg24.pkg313.m4480
+from pkg3.pkg51 import m50
+from . import m24708
+from pkg7.pkg93.pkg1220 import m26227
+import pkg6.pkg82.pkg1069.m9404
+from pkg1.pkg23 import m22
+
+
+def helper_35128_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35128_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_35128_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_35128_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_35128_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_35128_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35128_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,14 @@
+"""Module 37212."""
+from . import m10120
+from . import m30960
+import pkg6.pkg83.pkg1080.m13583
+from pkg1.pkg26.pkg351 import m350
+import pkg4.pkg60.pkg790.m27881
+from pkg7.pkg96.pkg1260 import m5427
+
+
+def helper_37212_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
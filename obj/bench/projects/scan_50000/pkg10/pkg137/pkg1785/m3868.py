@@ -0,0 +1,45 @@
+"""Module 3868."""
+import pkg2.pkg32.pkg422.m2505
+from pkg1 import m0
+import pkg2.pkg28.pkg365.m2448
+from pkg3.pkg45.pkg596 import m595
+from . import m1784
+from pkg5.pkg77.pkg1007 import m3090
+import pkg1.pkg17.pkg231.m230
+from pkg2.pkg33.pkg439 import m438
+import pkg6.pkg81.pkg1061.m1060
+
+
+def helper_3868_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3868_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3868_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3868_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_3868_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 39296."""
+import pkg3.pkg44.pkg579.m27670
+from . import m26792
+import pkg7.pkg102.pkg1327.m1326
+from pkg9.pkg120.pkg1565 import m11984
+import pkg10.pkg142.m141
+from pkg9.pkg129.pkg1683 import m10018
+import pkg7.pkg92.m91
+from pkg6.pkg80.pkg1045 import m1044
+import pkg5.pkg72.pkg949.m19704
+from pkg8.pkg105.pkg1378 import m5545
+import pkg7.pkg102.pkg1332.m3415
+
+
+def helper_39296_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
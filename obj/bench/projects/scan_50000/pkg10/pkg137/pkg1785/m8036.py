@@ -0,0 +1,20 @@
+"""Module 8036."""
+import pkg12.pkg158.pkg2061.m2060
+from pkg11.pkg146 import m145
+from . import m5952
+from pkg7.pkg99.pkg1299 import m1298
+import pkg8.pkg110.pkg1440.m5607
+
+
+def helper_8036_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8036_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
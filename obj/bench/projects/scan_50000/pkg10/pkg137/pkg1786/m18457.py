@@ -0,0 +1,52 @@
+"""Module 18457."""
+from . import m3869
+from pkg4.pkg63 import m62
+import pkg7.pkg92.pkg1209.m1208
+from pkg1.pkg16 import m15
+import pkg6.pkg82.pkg1070.m5237
+from pkg4.pkg64 import m6315
+import pkg4.pkg55.pkg718.m13221
+from pkg4.pkg63.pkg821 import m820
+import pkg2.pkg37.pkg492.m17163
+
+
+def helper_18457_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_18457_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_18457_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_18457_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_18457_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_18457_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,28 @@
+"""Module 39297."""
+import pkg1.m0
+from pkg8.pkg117.pkg1534 import m39045
+import pkg1.pkg25.pkg337.m336
+from pkg5.pkg71.pkg933 import m15520
+import pkg5.pkg76.pkg997.m996
+from pkg5.pkg76.pkg994 import m3077
+
+
+def helper_39297_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39297_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_39297_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 45549."""
+import pkg13.m12
+from . import m33045
+from . import m1785
+from pkg4.pkg61.pkg803 import m13306
+import pkg5.pkg70.pkg913.m23836
+
+
+def helper_45549_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_45549_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
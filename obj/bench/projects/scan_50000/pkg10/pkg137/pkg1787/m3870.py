@@ -0,0 +1,10 @@
+"""Module 3870."""
+from . import m1786
+from pkg1 import m0
+
+
+def helper_3870_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
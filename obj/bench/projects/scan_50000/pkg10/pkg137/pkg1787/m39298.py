@@ -0,0 +1,9 @@
+"""Module 39298."""
+import pkg10.pkg142.pkg1855.m37282
+
+
+def helper_39298_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
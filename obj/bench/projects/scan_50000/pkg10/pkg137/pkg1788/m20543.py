@@ -0,0 +1,52 @@
+"""Module 20543."""
+import pkg5.pkg70.m18825
+from pkg10.pkg141.pkg1837 import m6004
+import pkg12.pkg158.pkg2062.m2061
+from pkg9.pkg122 import m121
+import pkg1.pkg20.pkg269.m10688
+from . import m8039
+import pkg6.pkg81.pkg1060.m3143
+from pkg12.pkg163 import m162
+import pkg7.pkg94.pkg1233.m7484
+
+
+def helper_20543_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_20543_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_20543_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_20543_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_20543_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_20543_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
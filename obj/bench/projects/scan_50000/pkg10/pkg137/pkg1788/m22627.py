@@ -0,0 +1,22 @@
+"""Module 22627."""
+import pkg9.pkg122.pkg1594.m1593
+from pkg8.pkg114.pkg1483 import m18154
+import pkg7.pkg93.pkg1220.m22059
+from pkg11.pkg151.pkg1967 import m10302
+import pkg8.pkg109.pkg1420.m5587
+from . import m3871
+import pkg1.m0
+
+
+def helper_22627_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_22627_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,31 @@
+"""Module 26795."""
+import pkg8.pkg112.pkg1468.m1467
+from pkg2 import m1
+import pkg3.m2
+from pkg9.pkg120.pkg1561 import m1560
+import pkg4.pkg55.pkg716.m715
+from pkg11.pkg151.pkg1974 import m12393
+import pkg1.pkg20.m19
+from pkg1.pkg26.pkg341 import m6592
+import pkg1.m0
+
+
+def helper_26795_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_26795_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_26795_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
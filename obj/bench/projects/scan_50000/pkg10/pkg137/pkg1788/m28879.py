@@ -0,0 +1,25 @@
+"""Module 28879."""
+import pkg11.pkg144.pkg1873.m6040
+from pkg8.pkg112.pkg1461 import m5628
+from . import m24711
+from pkg8.pkg109.pkg1422 import m28513
+import pkg2.pkg38.pkg497.m21336
+from pkg10.pkg136.pkg1772 import m10107
+import pkg8.pkg113.pkg1478.m18149
+from pkg9.pkg130.pkg1702 import m5869
+import pkg8.pkg113.m112
+from pkg3.pkg40.pkg527 import m526
+
+
+def helper_28879_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_28879_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
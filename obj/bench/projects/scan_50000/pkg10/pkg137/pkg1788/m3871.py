@@ -0,0 +1,10 @@
+"""Module 3871."""
+import pkg6.pkg80.pkg1045.m1044
+from pkg11.pkg147 import m146
+
+
+def helper_3871_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
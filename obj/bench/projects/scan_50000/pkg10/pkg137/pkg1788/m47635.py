@@ -0,0 +1,46 @@
+"""Module 47635."""
+from . import m35131
+from . import m20543
+import pkg9.pkg120.pkg1571.m1570
+from . import m30963
+import pkg13.pkg177.m2260
+from pkg3.pkg41.pkg535 import m534
+import pkg11.pkg150.m8485
+from pkg13 import m12
+import pkg13.pkg176.m4343
+from pkg9.pkg125.pkg1638 import m24561
+
+
+def helper_47635_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_47635_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_47635_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_47635_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_47635_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
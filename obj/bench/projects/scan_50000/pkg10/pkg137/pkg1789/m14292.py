@@ -0,0 +1,6 @@
+"""Module 14292."""
+from . import m3872
+from pkg5.pkg73.pkg957 import m956
+import pkg3.pkg45.pkg587.m2670
+from pkg9.pkg120.pkg1568 import m14071
+from . import m10124
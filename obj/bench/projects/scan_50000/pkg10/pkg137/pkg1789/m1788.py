@@ -0,0 +1,18 @@
+"""Module 1788."""
+import pkg4.pkg60.pkg787.m786
+from pkg10.pkg142 import m141
+import pkg8.pkg117.m116
+from pkg9.pkg123 import m122
+import pkg8.pkg114.pkg1486.m1485
+from pkg1.pkg20.pkg270 import m269
+import pkg2.pkg34.m33
+from pkg3.pkg43.pkg563 import m562
+import pkg2.pkg28.pkg374.m373
+from pkg13 import m12
+
+
+def helper_1788_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
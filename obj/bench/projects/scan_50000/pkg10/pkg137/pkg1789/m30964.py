@@ -0,0 +1,61 @@
+"""Module 30964."""
+import pkg6.m5
+from pkg8.pkg116.pkg1515 import m9850
+import pkg11.pkg155.pkg2019.m18690
+from pkg7.pkg104.pkg1354 import m11773
+import pkg10.pkg138.pkg1799.m14302
+from pkg7.pkg94 import m12597
+import pkg3.pkg50.pkg654.m17325
+from pkg4.pkg55.pkg720 import m719
+import pkg11.pkg146.pkg1901.m20656
+from pkg7.pkg104.pkg1353 import m20108
+import pkg8.pkg116.pkg1514.m1513
+
+
+def helper_30964_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_30964_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_30964_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_30964_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_30964_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_30964_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_30964_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,55 @@
+"""Module 45552."""
+import pkg6.m5
+from pkg5.pkg78.pkg1025 import m7276
+import pkg11.pkg152.pkg1980.m8231
+from pkg8.pkg111.pkg1446 import m16033
+import pkg8.pkg108.pkg1412.m1411
+from pkg10.pkg138.pkg1805 import m14308
+import pkg1.pkg24.pkg319.m2402
+from pkg2.pkg27 import m26
+from . import m5956
+from pkg4.pkg54.pkg706 import m4873
+import pkg7.pkg96.pkg1260.m5427
+from . import m28880
+
+
+def helper_45552_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_45552_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_45552_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_45552_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_45552_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_45552_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,53 @@
+"""Module 10125."""
+import pkg3.pkg45.pkg596.m4763
+from pkg1.pkg20.pkg268 import m4435
+import pkg13.m12
+from pkg2.pkg27.pkg360 import m6611
+import pkg12.pkg160.pkg2081.m8332
+from pkg2.pkg34 import m4201
+import pkg7.pkg103.pkg1342.m3425
+from pkg4.pkg65.pkg857 import m2940
+import pkg6.m5
+from pkg7.pkg97.pkg1268 import m5435
+
+
+def helper_10125_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10125_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_10125_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_10125_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_10125_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_10125_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 14293."""
+import pkg4.pkg65.pkg856.m855
+from pkg9.pkg122.pkg1587 import m5754
+import pkg11.pkg151.pkg1964.m6131
+from pkg1.pkg24.pkg313 import m312
+
+
+def helper_14293_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14293_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,31 @@
+"""Module 16377."""
+from . import m10125
+from pkg2.pkg29.pkg386 import m12889
+from . import m8041
+from pkg1.pkg23 import m22
+import pkg5.pkg78.pkg1025.m3108
+from pkg2 import m1
+from . import m5957
+from pkg4.pkg60 import m59
+import pkg4.pkg63.pkg832.m7083
+
+
+def helper_16377_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16377_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_16377_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
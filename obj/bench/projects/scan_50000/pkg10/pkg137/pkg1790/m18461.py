@@ -0,0 +1,27 @@
+"""Module 18461."""
+import pkg7.pkg92.pkg1200.m3283
+from pkg2.pkg30.pkg394 import m393
+import pkg7.pkg100.pkg1309.m1308
+from pkg12.pkg158.pkg2066 import m14569
+import pkg6.pkg85.pkg1109.m1108
+
+
+def helper_18461_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_18461_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_18461_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
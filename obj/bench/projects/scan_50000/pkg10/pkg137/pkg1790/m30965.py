@@ -0,0 +1,19 @@
+"""Module 30965."""
+from . import m20545
+from pkg2.pkg28.pkg374 import m4541
+import pkg9.pkg130.pkg1696.m1695
+from pkg9.pkg127 import m12630
+import pkg7.pkg102.pkg1327.m1326
+from . import m26797
+import pkg1.m0
+from pkg4.pkg57 import m4224
+from . import m3873
+from pkg10.pkg131 import m130
+import pkg2.pkg32.pkg425.m8760
+
+
+def helper_30965_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
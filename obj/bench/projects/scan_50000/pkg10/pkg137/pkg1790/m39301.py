@@ -0,0 +1,13 @@
+"""Module 39301."""
+import pkg3.pkg41.pkg540.m539
+from . import m26797
+import pkg10.pkg135.pkg1762.m22601
+from pkg1.pkg18.pkg243 import m10662
+import pkg2.pkg30.pkg392.m2475
+
+
+def helper_39301_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,24 @@
+"""Module 47637."""
+import pkg2.pkg39.pkg518.m517
+from pkg6.pkg80.pkg1047 import m1046
+import pkg11.pkg155.m154
+from pkg7.pkg97.pkg1265 import m42944
+import pkg3.pkg45.pkg592.m4759
+from . import m26797
+import pkg1.m0
+from pkg1.pkg21.pkg281 import m35708
+import pkg7.pkg94.pkg1234.m13737
+
+
+def helper_47637_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_47637_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,15 @@
+"""Module 1790."""
+import pkg3.pkg40.pkg522.m521
+from pkg1.pkg21.pkg274 import m273
+import pkg1.m0
+from pkg2 import m1
+import pkg4.pkg62.pkg807.m806
+from pkg8.pkg111 import m110
+import pkg4.pkg57.pkg745.m744
+
+
+def helper_1790_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 18462."""
+from . import m12210
+from pkg7.pkg104.pkg1364 import m7615
+import pkg1.m0
+
+
+def helper_18462_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
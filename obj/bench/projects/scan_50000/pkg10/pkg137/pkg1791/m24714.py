@@ -0,0 +1,27 @@
+"""Module 24714."""
+import pkg9.pkg121.m120
+from pkg5.pkg76.pkg997 import m3080
+import pkg4.pkg64.pkg838.m837
+from pkg8.pkg105.pkg1372 import m22211
+import pkg10.pkg142.pkg1850.m10185
+from . import m20546
+import pkg3.pkg48.pkg627.m6878
+from . import m14294
+import pkg6.pkg90.pkg1179.m3262
+from pkg6.pkg88.pkg1147 import m5314
+import pkg2.pkg34.pkg450.m8785
+from pkg7 import m6
+
+
+def helper_24714_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_24714_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 28882."""
+import pkg1.m0
+from pkg5.pkg77.pkg1013 import m1012
+import pkg3.pkg43.pkg570.m19325
+from pkg1.pkg22 import m21
+
+
+def helper_28882_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_28882_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_28882_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,54 @@
+"""Module 33050."""
+import pkg9.pkg120.pkg1573.m1572
+from . import m8042
+import pkg2.pkg36.m8371
+from pkg10.pkg136.pkg1772 import m8023
+import pkg1.pkg14.pkg195.m194
+from pkg4.pkg62.pkg815 import m19570
+from . import m3874
+from pkg5.pkg67.pkg884 import m2967
+import pkg2.pkg32.pkg417.m23340
+from pkg5.pkg67.pkg879 import m9214
+import pkg1.pkg23.pkg304.m16975
+
+
+def helper_33050_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_33050_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_33050_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_33050_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_33050_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_33050_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 37218."""
+import pkg1.pkg26.pkg351.m2434
+from pkg6.pkg82.pkg1079 import m7330
+import pkg4.pkg58.pkg758.m757
+from pkg11.pkg144 import m4311
+import pkg2.pkg38.m10457
+from . import m3874
+import pkg10.pkg137.pkg1785.m12204
+from pkg6.pkg79 import m78
+import pkg12.pkg158.m4325
+from pkg11 import m4178
+
+
+def helper_37218_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37218_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,46 @@
+"""Module 47638."""
+from . import m3874
+from . import m33050
+import pkg9.pkg129.pkg1689.m47536
+from pkg3.pkg51.pkg666 import m44429
+import pkg2.pkg29.pkg381.m380
+from pkg10.pkg132.pkg1723 import m12142
+import pkg9.pkg128.pkg1667.m1666
+from pkg6.pkg83.pkg1080 import m15667
+import pkg4.pkg62.pkg810.m32069
+from pkg4.pkg62.pkg808 import m40403
+
+
+def helper_47638_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_47638_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_47638_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_47638_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_47638_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
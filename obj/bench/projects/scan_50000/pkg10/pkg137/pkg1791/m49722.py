@@ -0,0 +1,11 @@
+"""Module 49722."""
+import pkg11.pkg149.pkg1939.m22778
+from . import m20546
+import pkg8.pkg112.pkg1462.m28553
+
+
+def helper_49722_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,44 @@
+"""Module 10127."""
+import pkg8.pkg107.pkg1393.m1392
+from pkg8.pkg114 import m113
+import pkg9.pkg121.m120
+from pkg7.pkg102.pkg1334 import m7585
+import pkg7.pkg97.pkg1272.m3355
+from pkg5.pkg73.pkg955 import m5122
+import pkg7.pkg100.pkg1312.m1311
+from pkg5.pkg75.pkg985 import m7236
+
+
+def helper_10127_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10127_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_10127_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_10127_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_10127_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,9 @@
+"""Module 14295."""
+import pkg9.pkg123.m12626
+
+
+def helper_14295_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
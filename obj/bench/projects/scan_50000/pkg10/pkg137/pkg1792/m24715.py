@@ -0,0 +1,45 @@
+"""Module 24715."""
+import pkg2.pkg36.pkg479.m6730
+from pkg9.pkg130.pkg1697 import m24620
+import pkg2.pkg30.m29
+from pkg1.pkg20.pkg267 import m16938
+from . import m14295
+from pkg10.pkg137.pkg1791 import m3874
+import pkg3.pkg45.pkg589.m588
+from pkg1.pkg26.pkg350 import m2433
+import pkg9.pkg120.pkg1563.m9898
+
+
+def helper_24715_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_24715_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_24715_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_24715_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_24715_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,40 @@
+"""Module 30967."""
+import pkg12.pkg163.m16834
+from pkg3.pkg43.pkg563 import m6814
+import pkg6.pkg85.pkg1112.m3195
+from pkg5.pkg73.pkg951 import m3034
+import pkg5.pkg67.pkg875.m21714
+from pkg8.pkg114.pkg1483 import m22322
+import pkg2.pkg38.pkg501.m500
+from . import m16379
+import pkg8.pkg110.pkg1431.m20186
+from pkg9.pkg129.pkg1687 import m20442
+import pkg2.pkg37.pkg488.m2571
+
+
+def helper_30967_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_30967_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_30967_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_30967_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,23 @@
+"""Module 12212."""
+import pkg3.pkg43.pkg560.m559
+from pkg1.pkg14 import m13
+import pkg9.pkg128.m127
+from pkg12.pkg157.pkg2053 import m2052
+import pkg10.pkg143.pkg1861.m8112
+from pkg3.pkg41.pkg535 import m2618
+import pkg6.m5
+from pkg8.pkg109.pkg1426 import m1425
+
+
+def helper_12212_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12212_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,21 @@
+"""Module 14296."""
+import pkg10.m9
+from pkg12.pkg168 import m167
+import pkg8.pkg112.pkg1459.m7710
+from pkg11.pkg149 import m148
+import pkg3.pkg40.pkg523.m522
+from pkg1 import m0
+
+
+def helper_14296_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14296_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
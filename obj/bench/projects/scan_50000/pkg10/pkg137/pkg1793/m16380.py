@@ -0,0 +1,61 @@
+"""Module 16380."""
+import pkg3.pkg51.m50
+from pkg6.pkg82.pkg1074 import m3157
+import pkg7.pkg95.pkg1237.m3320
+from pkg5.pkg70.pkg919 import m918
+from . import m5960
+from pkg2.pkg37 import m36
+import pkg6.pkg82.m81
+from pkg8.pkg115.pkg1507 import m14010
+import pkg1.m0
+from pkg7.pkg95 import m2178
+import pkg1.pkg25.pkg337.m8672
+
+
+def helper_16380_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16380_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_16380_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_16380_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_16380_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_16380_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16380_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,21 @@
+"""Module 18464."""
+import pkg9.pkg126.m125
+from pkg5.pkg77.pkg1014 import m17685
+import pkg3.pkg44.pkg580.m4747
+from pkg13.pkg181 import m6432
+import pkg7.pkg94.pkg1235.m7486
+from pkg7.pkg93.pkg1222 import m17893
+
+
+def helper_18464_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_18464_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
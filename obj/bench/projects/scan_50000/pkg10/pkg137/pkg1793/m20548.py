@@ -0,0 +1,18 @@
+"""Module 20548."""
+import pkg1.pkg18.pkg239.m6490
+from . import m3876
+import pkg7.pkg94.pkg1230.m11649
+from pkg12.pkg160 import m159
+from . import m5960
+from pkg3.pkg46.pkg605 import m4772
+import pkg1.pkg26.pkg346.m345
+from pkg3.pkg43.pkg565 import m17236
+import pkg2.pkg30.pkg403.m8738
+from pkg10.pkg131 import m2214
+
+
+def helper_20548_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,45 @@
+"""Module 45557."""
+import pkg8.pkg105.pkg1374.m15961
+from pkg11.pkg146.pkg1908 import m16495
+import pkg11.pkg146.pkg1902.m3985
+from pkg2.pkg31.pkg415 import m8750
+import pkg7.pkg101.pkg1315.m3398
+from pkg7.pkg97.pkg1274 import m26281
+import pkg10.pkg134.pkg1749.m24672
+from . import m43473
+import pkg11.pkg146.pkg1904.m1903
+
+
+def helper_45557_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_45557_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_45557_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_45557_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_45557_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
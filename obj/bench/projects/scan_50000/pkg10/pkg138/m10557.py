@@ -0,0 +1,34 @@
+"""Module 10557."""
+import pkg3.m2
+from pkg7.pkg94.pkg1223 import m1222
+import pkg4.pkg55.pkg723.m9058
+from pkg1.pkg14.pkg189 import m6440
+import pkg9.pkg130.pkg1698.m1697
+
+
+def helper_10557_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10557_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_10557_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_10557_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
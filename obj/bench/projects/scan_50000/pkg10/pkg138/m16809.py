@@ -0,0 +1,40 @@
+"""Module 16809."""
+import pkg1.pkg19.m18
+from . import m14725
+import pkg1.pkg17.pkg223.m222
+from pkg10 import m9
+import pkg3.m2
+from pkg5.pkg69.pkg898 import m5065
+from . import m12641
+from pkg4.pkg63.pkg827 import m9162
+from . import m6389
+from pkg6.pkg84.pkg1099 import m11518
+import pkg6.pkg79.pkg1030.m3113
+
+
+def helper_16809_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16809_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_16809_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_16809_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
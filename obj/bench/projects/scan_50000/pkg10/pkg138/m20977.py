@@ -0,0 +1,14 @@
+"""Module 20977."""
+import pkg13.m12
+from pkg3.pkg47.pkg613 import m2696
+import pkg1.pkg22.pkg290.m4457
+from pkg3.pkg45.pkg593 import m4760
+import pkg2.pkg38.pkg504.m503
+from pkg12.pkg159.pkg2080 import m2079
+
+
+def helper_20977_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,43 @@
+"""Module 2221."""
+import pkg1.pkg14.m13
+from pkg4.pkg55.pkg726 import m725
+import pkg1.pkg15.m14
+from pkg9.pkg127 import m126
+import pkg11.pkg148.pkg1925.m1924
+from pkg2.pkg29.pkg381 import m380
+import pkg5.pkg68.pkg890.m889
+
+
+def helper_2221_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2221_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2221_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_2221_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_2221_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,21 @@
+"""Module 35565."""
+import pkg9.pkg121.pkg1574.m5741
+from . import m137
+import pkg7.pkg102.pkg1328.m9663
+from pkg6.pkg86.pkg1126 import m21965
+import pkg2.pkg34.m33
+from pkg3.pkg51.pkg669 import m25676
+
+
+def helper_35565_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35565_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 39733."""
+import pkg1.pkg21.m20
+from pkg5.pkg72 import m71
+from . import m27229
+from pkg4.pkg63.pkg822 import m23745
+import pkg4.pkg59.pkg774.m21613
+from . import m137
+import pkg10.pkg133.pkg1731.m20486
+from pkg1.pkg26 import m25
+import pkg12.pkg158.pkg2058.m20813
+
+
+def helper_39733_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
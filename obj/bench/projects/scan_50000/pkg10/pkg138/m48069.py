@@ -0,0 +1,26 @@
+"""Module 48069."""
+import pkg11.pkg146.pkg1906.m24829
+from pkg7.pkg98.pkg1283 import m5450
+import pkg9.pkg125.pkg1628.m3711
+from pkg6.pkg79.pkg1040 import m38551
+import pkg5.pkg77.pkg1002.m7253
+from pkg1.pkg15.pkg198 import m4365
+import pkg10.pkg139.pkg1817.m12236
+from pkg4.pkg65.pkg848 import m5015
+import pkg1.pkg15.pkg206.m205
+from pkg6.pkg84.pkg1098 import m1097
+import pkg4.pkg59.pkg771.m2854
+
+
+def helper_48069_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_48069_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
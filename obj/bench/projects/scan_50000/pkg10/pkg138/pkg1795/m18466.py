@@ -0,0 +1,17 @@
+"""Module 18466."""
+import pkg1.pkg22.pkg296.m295
+from . import m5962
+
+
+def helper_18466_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_18466_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
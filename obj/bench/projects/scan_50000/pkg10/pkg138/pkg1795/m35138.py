@@ -0,0 +1,26 @@
+"""Module 35138."""
+from . import m26802
+from pkg4.pkg54.pkg704 import m2787
+import pkg1.pkg23.pkg309.m29484
+from pkg2.pkg34.pkg450 import m25457
+import pkg6.pkg83.pkg1092.m21931
+from pkg6.pkg84 import m83
+from . import m14298
+from . import m10130
+import pkg2.pkg32.pkg420.m12923
+from pkg9.pkg120.pkg1568 import m24491
+import pkg6.pkg89.pkg1158.m1157
+
+
+def helper_35138_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35138_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,29 @@
+"""Module 43474."""
+import pkg10.pkg135.m134
+from pkg4.pkg62.pkg817 import m9152
+from . import m10130
+from . import m22634
+from . import m33054
+from pkg2.pkg31 import m30
+import pkg7.pkg94.m2177
+
+
+def helper_43474_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_43474_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_43474_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
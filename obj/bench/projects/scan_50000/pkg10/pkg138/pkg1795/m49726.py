@@ -0,0 +1,24 @@
+"""Module 49726."""
+import pkg5.pkg72.pkg944.m943
+from pkg5.pkg76.pkg991 import m990
+import pkg10.pkg134.pkg1755.m30930
+from pkg1 import m0
+import pkg2.pkg31.m43794
+from pkg3.pkg49.pkg649 import m648
+import pkg4.pkg58.pkg767.m21606
+from pkg4 import m3
+import pkg2.m1
+
+
+def helper_49726_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_49726_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,35 @@
+"""Module 5962."""
+import pkg8.m7
+from pkg1.pkg19 import m18
+import pkg8.pkg106.pkg1379.m5546
+from pkg8.pkg109.pkg1430 import m5597
+import pkg2.pkg37.pkg484.m483
+from . import m1794
+
+
+def helper_5962_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5962_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5962_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5962_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,23 @@
+"""Module 1795."""
+import pkg1.pkg19.m18
+from pkg2.pkg38.pkg503 import m502
+import pkg7.pkg99.m98
+from pkg1.pkg21.pkg286 import m285
+import pkg1.pkg19.pkg253.m252
+from pkg1.pkg20 import m19
+import pkg1.m0
+from pkg7.pkg99.pkg1291 import m1290
+
+
+def helper_1795_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1795_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
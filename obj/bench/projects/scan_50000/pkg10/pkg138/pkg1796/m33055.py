@@ -0,0 +1,26 @@
+"""Module 33055."""
+import pkg6.pkg83.pkg1080.m3163
+from . import m20551
+import pkg5.pkg69.m68
+from pkg12.pkg158.pkg2056 import m2055
+import pkg1.pkg14.pkg194.m8529
+from pkg1.pkg14.pkg192 import m10611
+import pkg5.pkg77.pkg1009.m23932
+from pkg10.pkg135.pkg1766 import m3849
+import pkg9.pkg130.m4297
+from pkg9.pkg129.pkg1690 import m1689
+import pkg2.pkg28.pkg366.m17037
+
+
+def helper_33055_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_33055_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,15 @@
+"""Module 47643."""
+import pkg3.pkg49.pkg646.m21485
+from pkg1.pkg22.pkg296 import m39891
+from . import m12215
+from pkg1.pkg17.pkg228 import m23151
+import pkg6.pkg91.m6342
+from . import m1795
+import pkg1.pkg14.pkg188.m187
+
+
+def helper_47643_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
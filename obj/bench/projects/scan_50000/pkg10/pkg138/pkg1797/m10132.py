@@ -0,0 +1,15 @@
+"""Module 10132."""
+import pkg1.m0
+from pkg10.pkg143.pkg1872 import m3955
+import pkg7.pkg94.pkg1226.m9561
+from . import m5964
+import pkg3.pkg46.m4213
+from . import m8048
+import pkg10.pkg141.pkg1845.m1844
+
+
+def helper_10132_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
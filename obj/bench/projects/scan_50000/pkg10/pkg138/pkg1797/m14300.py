@@ -0,0 +1,23 @@
+"""Module 14300."""
+import pkg8.pkg106.pkg1381.m1380
+from pkg10.pkg142.pkg1855 import m1854
+import pkg2.pkg28.pkg365.m2448
+from . import m12216
+from . import m1796
+from pkg10.pkg138.pkg1807 import m1806
+import pkg1.pkg26.pkg342.m2425
+from pkg8 import m7
+
+
+def helper_14300_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14300_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,62 @@
+"""Module 16384."""
+import pkg1.pkg15.pkg205.m4372
+from pkg6.pkg80.pkg1051 import m15638
+import pkg2.pkg29.pkg387.m4554
+from . import m12216
+import pkg2.pkg27.pkg356.m355
+from . import m14300
+import pkg2.pkg29.pkg381.m380
+from pkg8.pkg111.pkg1454 import m11873
+import pkg5.pkg72.pkg943.m942
+from pkg8.pkg115.pkg1504 import m9839
+import pkg1.pkg22.pkg297.m14884
+from . import m10132
+
+
+def helper_16384_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16384_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_16384_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_16384_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_16384_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_16384_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16384_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
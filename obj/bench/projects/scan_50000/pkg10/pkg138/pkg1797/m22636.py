@@ -0,0 +1,62 @@
+"""Module 22636."""
+import pkg2.pkg27.pkg359.m358
+from pkg1.pkg26 import m25
+import pkg2.m1
+from pkg12.pkg164 import m163
+import pkg8.pkg107.pkg1401.m13904
+from pkg1.pkg15.pkg199 import m21038
+import pkg1.pkg25.pkg334.m4501
+from pkg6.pkg85.pkg1118 import m3201
+import pkg4.pkg59.pkg772.m11191
+from pkg6.pkg90.pkg1175 import m22014
+import pkg2.pkg31.pkg414.m6665
+from pkg6.pkg90.pkg1178 import m7429
+
+
+def helper_22636_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_22636_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_22636_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_22636_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_22636_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_22636_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_22636_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
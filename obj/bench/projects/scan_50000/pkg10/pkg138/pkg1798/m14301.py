@@ -0,0 +1,20 @@
+"""Module 14301."""
+import pkg6.pkg86.pkg1122.m1121
+from . import m10133
+import pkg4.pkg61.pkg802.m11221
+from pkg11.pkg155.pkg2019 import m10354
+from . import m3881
+
+
+def helper_14301_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14301_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
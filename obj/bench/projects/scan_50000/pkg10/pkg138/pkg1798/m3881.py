@@ -0,0 +1,30 @@
+"""Module 3881."""
+import pkg12.pkg161.m160
+from pkg10.pkg136 import m2219
+import pkg2.pkg30.pkg393.m2476
+from pkg7.pkg103.pkg1347 import m1346
+import pkg4.pkg56.pkg731.m730
+from pkg5.pkg71.pkg930 import m929
+import pkg2.pkg32.pkg422.m421
+from pkg3.pkg41.pkg534 import m2617
+
+
+def helper_3881_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3881_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3881_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
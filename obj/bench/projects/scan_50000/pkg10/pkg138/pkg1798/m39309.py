@@ -0,0 +1,14 @@
+"""Module 39309."""
+import pkg9.pkg119.m4286
+from pkg7.pkg103.pkg1350 import m5517
+import pkg8.pkg112.pkg1462.m24385
+from pkg1.pkg19.pkg259 import m258
+import pkg9.pkg128.pkg1665.m1664
+from pkg6 import m5
+
+
+def helper_39309_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,51 @@
+"""Module 43477."""
+import pkg9.pkg130.pkg1701.m7952
+from pkg9.pkg129 import m128
+import pkg6.pkg81.pkg1058.m11477
+from pkg6.pkg79.pkg1034 import m28125
+import pkg1.pkg14.pkg183.m2266
+from pkg3.pkg41.pkg545 import m544
+import pkg13.m6264
+from pkg1.pkg25.pkg331 import m10750
+
+
+def helper_43477_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_43477_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_43477_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_43477_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_43477_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_43477_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,43 @@
+"""Module 45561."""
+from . import m1797
+from pkg1.pkg17.pkg227 import m8562
+import pkg6.pkg85.pkg1117.m28208
+from . import m37225
+import pkg5.pkg67.pkg882.m881
+from pkg2.pkg28.pkg367 import m366
+import pkg11.pkg155.pkg2026.m4109
+
+
+def helper_45561_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_45561_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_45561_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_45561_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_45561_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
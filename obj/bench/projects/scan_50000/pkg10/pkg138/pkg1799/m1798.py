@@ -0,0 +1,20 @@
+"""Module 1798."""
+import pkg1.pkg23.m22
+from pkg7.pkg102 import m101
+import pkg6.pkg91.pkg1194.m1193
+from pkg1 import m0
+import pkg1.pkg26.pkg350.m349
+from pkg8.pkg112.pkg1467 import m1466
+import pkg3.pkg48.pkg632.m631
+from pkg4.pkg63.pkg832 import m831
+import pkg5.pkg74.pkg970.m969
+from pkg5.pkg78.pkg1017 import m1016
+import pkg1.pkg15.m14
+from pkg2 import m1
+
+
+def helper_1798_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
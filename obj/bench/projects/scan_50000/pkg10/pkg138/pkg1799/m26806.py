@@ -0,0 +1,43 @@
+"""Module 26806."""
+import pkg9.pkg124.pkg1613.m20368
+from pkg6.pkg80.pkg1048 import m1047
+import pkg2.pkg35.pkg466.m6717
+from . import m22638
+import pkg9.pkg124.pkg1619.m7870
+from . import m18470
+import pkg8.pkg114.pkg1487.m13990
+
+
+def helper_26806_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_26806_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_26806_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_26806_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_26806_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 35142."""
+import pkg5.pkg70.m69
+from pkg10.pkg132 import m2215
+from . import m22638
+from pkg3.pkg44.pkg582 import m21421
+import pkg7.m6
+from pkg4.pkg59.pkg772 import m771
+import pkg12.pkg160.pkg2084.m12503
+from . import m16386
+import pkg1.pkg21.pkg283.m12786
+from pkg11.pkg151.pkg1965 import m1964
+import pkg1.pkg23.m6274
+
+
+def helper_35142_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35142_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
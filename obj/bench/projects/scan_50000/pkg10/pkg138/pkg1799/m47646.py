@@ -0,0 +1,51 @@
+"""Module 47646."""
+import pkg6.pkg83.pkg1087.m1086
+from pkg1 import m0
+import pkg10.pkg135.pkg1763.m47610
+from pkg3.pkg40.pkg530 import m529
+import pkg5.pkg78.pkg1017.m7268
+from pkg10.pkg142.pkg1857 import m22696
+import pkg5.pkg73.pkg960.m7211
+from pkg1.pkg19.pkg249 import m2332
+
+
+def helper_47646_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_47646_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_47646_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_47646_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_47646_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_47646_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,54 @@
+"""Module 12219."""
+import pkg1.m0
+from . import m1799
+import pkg2.pkg30.pkg392.m391
+from pkg4.pkg65.pkg847 import m2930
+import pkg5.pkg71.pkg929.m928
+from pkg1.pkg15 import m14
+import pkg5.pkg67.pkg877.m5044
+from pkg5.pkg78.pkg1017 import m9352
+from . import m3883
+from pkg5.pkg71 import m10490
+import pkg9.pkg130.m129
+
+
+def helper_12219_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12219_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_12219_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_12219_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_12219_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_12219_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
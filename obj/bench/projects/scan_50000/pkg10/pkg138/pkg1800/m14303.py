@@ -0,0 +1,40 @@
+"""Module 14303."""
+import pkg6.pkg79.pkg1034.m7285
+from pkg7.pkg102 import m4269
+import pkg12.pkg159.m4326
+from pkg8.pkg105.pkg1374 import m1373
+import pkg7.pkg102.pkg1335.m11754
+from pkg2.pkg36.pkg472 import m4639
+import pkg7.pkg94.pkg1224.m1223
+from pkg8.pkg109.pkg1418 import m5585
+import pkg9.pkg130.pkg1697.m1696
+from pkg2.pkg34.pkg445 import m444
+import pkg8.pkg114.m113
+
+
+def helper_14303_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14303_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_14303_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_14303_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
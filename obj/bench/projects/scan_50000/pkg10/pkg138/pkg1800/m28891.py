@@ -0,0 +1,5 @@
+"""Module 28891."""
+import pkg5.pkg72.pkg945.m944
+from pkg10.pkg139 import m138
+import pkg2.pkg27.pkg354.m2437
+from pkg4.pkg62.pkg815 import m19570
@@ -0,0 +1,9 @@
+"""Module 43479."""
+import pkg12.pkg159.pkg2080.m10415
+
+
+def helper_43479_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
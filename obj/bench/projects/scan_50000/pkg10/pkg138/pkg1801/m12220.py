@@ -0,0 +1,11 @@
+"""Module 12220."""
+import pkg4.pkg53.pkg698.m697
+from pkg2.pkg32 import m31
+from . import m10136
+
+
+def helper_12220_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
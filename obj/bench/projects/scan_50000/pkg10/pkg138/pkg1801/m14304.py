@@ -0,0 +1,44 @@
+"""Module 14304."""
+import pkg7.pkg102.m101
+from pkg5.pkg69.pkg907 import m2990
+import pkg11.pkg145.pkg1893.m10228
+from pkg1 import m0
+import pkg11.pkg152.pkg1980.m4063
+from pkg3.pkg46.pkg605 import m8940
+import pkg4.pkg64.pkg837.m7088
+from . import m10136
+
+
+def helper_14304_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14304_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_14304_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_14304_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_14304_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
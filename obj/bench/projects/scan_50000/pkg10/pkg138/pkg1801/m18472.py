@@ -0,0 +1,9 @@
+"""Module 18472."""
+import pkg12.pkg167.m166
+from pkg7.pkg99 import m98
+import pkg6.pkg89.pkg1160.m1159
+from pkg10.pkg131.pkg1705 import m10040
+import pkg2.pkg33.m32
+from . import m3884
+import pkg4.pkg59.pkg768.m4935
+from pkg4.pkg59.pkg773 import m772
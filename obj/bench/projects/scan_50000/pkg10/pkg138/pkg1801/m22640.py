@@ -0,0 +1,17 @@
+"""Module 22640."""
+import pkg6.pkg89.pkg1168.m17839
+from pkg10.pkg142.pkg1848 import m10183
+
+
+def helper_22640_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_22640_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,55 @@
+"""Module 30976."""
+import pkg3.pkg49.pkg645.m644
+from pkg10.pkg131.pkg1715 import m12134
+import pkg9.pkg120.pkg1568.m1567
+from pkg3.pkg50.pkg662 import m6913
+import pkg6.m5
+from pkg2.pkg34.pkg444 import m10863
+import pkg9.pkg119.pkg1553.m28644
+from pkg2.pkg32.pkg422 import m2505
+from . import m28892
+from pkg4.pkg64.pkg841 import m15428
+import pkg2.pkg39.pkg513.m2596
+from pkg9.pkg126.pkg1649 import m5816
+
+
+def helper_30976_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_30976_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_30976_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_30976_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_30976_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_30976_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,12 @@
+"""Module 33060."""
+from . import m5968
+from . import m10136
+import pkg10.pkg134.pkg1754.m5921
+from . import m24724
+
+
+def helper_33060_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,53 @@
+"""Module 39312."""
+import pkg7.m6
+from pkg2.pkg39.pkg515 import m21354
+import pkg1.m0
+from pkg3.pkg48.pkg635 import m634
+import pkg10.pkg137.m136
+from . import m33060
+import pkg5.pkg69.pkg909.m21748
+from pkg2.pkg33.pkg439 import m25446
+import pkg11.pkg155.pkg2024.m18695
+from pkg11.pkg148.pkg1929 import m1928
+
+
+def helper_39312_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39312_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_39312_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_39312_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_39312_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_39312_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 41396."""
+import pkg9.pkg128.pkg1669.m1668
+from pkg3.pkg49.pkg650 import m4817
+import pkg12.pkg160.pkg2084.m2083
+from . import m22640
+import pkg1.pkg23.pkg308.m307
+from pkg11.pkg151.pkg1972 import m16559
+import pkg1.m0
+from pkg1.pkg18.pkg242 import m241
+import pkg2.pkg36.pkg472.m12975
+
+
+def helper_41396_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
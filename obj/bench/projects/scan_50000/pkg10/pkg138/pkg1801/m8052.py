@@ -0,0 +1,31 @@
+"""Module 8052."""
+import pkg4.pkg57.pkg748.m2831
+from pkg4.pkg63.pkg826 import m825
+import pkg9.pkg119.m118
+from pkg5.pkg76.pkg1000 import m999
+from . import m5968
+from pkg3.pkg40.pkg528 import m527
+import pkg11.pkg146.pkg1910.m1909
+from pkg1.pkg24.pkg321 import m320
+import pkg7.pkg94.pkg1227.m3310
+
+
+def helper_8052_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8052_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8052_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,45 @@
+"""Module 33061."""
+import pkg3.pkg40.pkg533.m10952
+from pkg4.pkg61.pkg802 import m801
+import pkg11.pkg152.m151
+from pkg10.pkg137.pkg1793 import m3876
+import pkg10.pkg140.pkg1822.m3905
+from pkg7.pkg99.pkg1288 import m5455
+import pkg8.pkg115.m114
+from pkg2 import m1
+import pkg6.pkg89.pkg1165.m26172
+
+
+def helper_33061_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_33061_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_33061_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_33061_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_33061_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
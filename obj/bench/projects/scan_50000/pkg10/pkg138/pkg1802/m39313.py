@@ -0,0 +1,21 @@
+"""Module 39313."""
+import pkg5.pkg78.pkg1015.m1014
+from pkg5.pkg75 import m10494
+import pkg7.pkg100.pkg1313.m5480
+from pkg7.pkg100.pkg1306 import m11725
+import pkg5.pkg78.pkg1016.m15603
+from pkg8.pkg105.pkg1369 import m26376
+
+
+def helper_39313_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39313_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
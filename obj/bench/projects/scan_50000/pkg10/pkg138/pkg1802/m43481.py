@@ -0,0 +1,11 @@
+"""Module 43481."""
+import pkg5.pkg78.pkg1015.m1014
+from pkg6.pkg90.pkg1175 import m7426
+import pkg10.pkg141.pkg1844.m1843
+
+
+def helper_43481_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,44 @@
+"""Module 47649."""
+from . import m37229
+from . import m35145
+import pkg7.pkg99.pkg1300.m22139
+from pkg8.pkg116.pkg1511 import m36938
+import pkg5.pkg67.pkg872.m13375
+from pkg8.pkg113.pkg1480 import m3563
+import pkg3.pkg45.m44
+from . import m24725
+
+
+def helper_47649_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_47649_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_47649_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_47649_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_47649_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,23 @@
+"""Module 10138."""
+import pkg7.pkg102.m4269
+from pkg11.pkg154.pkg2007 import m6174
+import pkg1.pkg26.pkg351.m350
+from pkg2.pkg39.pkg519 import m518
+import pkg4.pkg59.m8394
+from pkg1.pkg19.pkg253 import m6504
+import pkg2.m1
+from pkg6.pkg86.pkg1120 import m3203
+
+
+def helper_10138_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10138_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,54 @@
+"""Module 14306."""
+from . import m3886
+from . import m8054
+import pkg11.pkg147.pkg1915.m12334
+from pkg1.pkg24.pkg313 import m4480
+import pkg7.pkg96.m95
+from pkg5.pkg78.pkg1024 import m9359
+import pkg10.pkg137.pkg1788.m10123
+from pkg9.pkg124.pkg1625 import m7876
+import pkg7.pkg96.m2179
+from pkg9.pkg119 import m2202
+from . import m5970
+
+
+def helper_14306_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14306_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_14306_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_14306_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_14306_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_14306_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 45566."""
+import pkg9.pkg128.pkg1667.m20422
+from pkg1.pkg25 import m24
+from . import m18474
+from pkg1 import m0
+
+
+def helper_45566_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_45566_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,29 @@
+"""Module 49734."""
+import pkg10.pkg138.pkg1795.m47642
+from pkg3.pkg43.pkg566 import m565
+from . import m39314
+from pkg13 import m12
+from . import m3886
+from pkg5.pkg74.pkg972 import m15559
+import pkg10.pkg142.pkg1851.m18522
+
+
+def helper_49734_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_49734_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_49734_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,12 @@
+"""Module 10139."""
+import pkg5.pkg66.pkg864.m7115
+from pkg3.pkg47 import m46
+import pkg8.pkg114.pkg1487.m7738
+from pkg7.pkg95.pkg1239 import m5406
+
+
+def helper_10139_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 20559."""
+import pkg6.pkg87.m8422
+from pkg2.pkg31.pkg416 import m8751
+import pkg3.pkg45.pkg589.m11008
+from pkg7.pkg101.pkg1317 import m13820
+import pkg2.pkg36.pkg478.m477
+from . import m5971
+import pkg9.pkg123.m122
+from pkg3.pkg46.pkg610 import m609
+from . import m8055
+from pkg3.pkg42.pkg547 import m546
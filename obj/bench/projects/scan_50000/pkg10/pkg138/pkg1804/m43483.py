@@ -0,0 +1,16 @@
+"""Module 43483."""
+from . import m22643
+from pkg1.pkg21.pkg274 import m23197
+import pkg8.pkg113.pkg1473.m11892
+from pkg1 import m0
+import pkg6.pkg85.pkg1110.m26117
+from . import m18475
+import pkg3.pkg48.pkg628.m36055
+from pkg4.pkg65.pkg850 import m7101
+
+
+def helper_43483_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
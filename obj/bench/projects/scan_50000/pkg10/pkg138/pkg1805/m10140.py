@@ -0,0 +1,53 @@
+"""Module 10140."""
+import pkg7.pkg92.pkg1199.m5366
+from pkg5.pkg77 import m76
+import pkg12.pkg161.m160
+from pkg2.pkg34.pkg454 import m2537
+import pkg8.pkg116.pkg1521.m1520
+from pkg12 import m11
+import pkg8.pkg116.pkg1517.m9852
+from pkg1.pkg15.pkg196 import m2279
+import pkg1.pkg24.m23
+from pkg11.pkg144.pkg1873 import m1872
+
+
+def helper_10140_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10140_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_10140_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_10140_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_10140_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_10140_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
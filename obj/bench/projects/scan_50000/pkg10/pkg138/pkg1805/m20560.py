@@ -0,0 +1,47 @@
+"""Module 20560."""
+import pkg3.pkg44.pkg573.m8908
+from pkg5.pkg78.pkg1027 import m5194
+import pkg10.pkg140.pkg1826.m1825
+from pkg6.pkg85.pkg1113 import m1112
+import pkg10.pkg136.m135
+from pkg3.pkg45.pkg594 import m593
+import pkg8.pkg110.pkg1436.m20191
+from . import m8056
+import pkg3.pkg52.pkg685.m13188
+from pkg7.pkg92.pkg1206 import m3289
+import pkg5.pkg70.pkg920.m15507
+
+
+def helper_20560_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_20560_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_20560_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_20560_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_20560_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
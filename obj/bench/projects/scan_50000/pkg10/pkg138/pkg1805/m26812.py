@@ -0,0 +1,54 @@
+"""Module 26812."""
+import pkg12.pkg158.pkg2055.m6222
+from . import m8056
+from . import m14308
+from pkg1.pkg24.pkg322 import m321
+from . import m18476
+from . import m10140
+import pkg6.pkg81.pkg1054.m11473
+from pkg6.pkg81.pkg1062 import m19817
+import pkg9.pkg121.m120
+from pkg6.pkg80.pkg1052 import m7303
+import pkg10.pkg133.pkg1741.m1740
+
+
+def helper_26812_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_26812_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_26812_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_26812_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_26812_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_26812_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
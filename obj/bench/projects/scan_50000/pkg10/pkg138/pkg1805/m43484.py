@@ -0,0 +1,35 @@
+"""Module 43484."""
+import pkg4.pkg59.pkg779.m17450
+from pkg9.pkg130.pkg1702 import m14205
+import pkg3.pkg50.pkg652.m8987
+from . import m14308
+import pkg6.pkg89.pkg1169.m32428
+from pkg1 import m0
+
+
+def helper_43484_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_43484_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_43484_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_43484_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 47652."""
+import pkg8.pkg105.pkg1374.m1373
+from pkg3.pkg52.pkg682 import m13185
+import pkg3.pkg40.pkg528.m527
+from pkg10.pkg138.pkg1802 import m41397
+import pkg6.pkg82.pkg1071.m5238
+
+
+def helper_47652_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_47652_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_47652_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,34 @@
+"""Module 5972."""
+import pkg6.pkg82.pkg1068.m5235
+from pkg2.pkg29.pkg390 import m389
+import pkg2.pkg31.pkg410.m409
+from pkg7.pkg101.pkg1319 import m3402
+import pkg1.pkg17.m16
+
+
+def helper_5972_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5972_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5972_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_5972_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,45 @@
+"""Module 10141."""
+import pkg6.pkg80.pkg1047.m1046
+from pkg6.pkg80.pkg1051 import m1050
+import pkg7.pkg95.pkg1240.m3323
+from pkg5.pkg75 import m74
+import pkg6.pkg79.pkg1035.m3118
+from pkg6.pkg82 import m81
+import pkg5.pkg69.pkg905.m904
+from pkg5.pkg68.pkg893 import m2976
+import pkg1.pkg19.m18
+
+
+def helper_10141_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10141_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_10141_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_10141_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_10141_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
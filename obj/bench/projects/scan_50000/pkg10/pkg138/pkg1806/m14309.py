@@ -0,0 +1,15 @@
+"""Module 14309."""
+import pkg8.pkg111.pkg1444.m3527
+from pkg12.pkg157.pkg2053 import m6220
+import pkg6.pkg83.pkg1082.m7333
+from pkg10.pkg131.pkg1713 import m7964
+import pkg5.pkg71.pkg925.m924
+from . import m1805
+import pkg6.pkg85.pkg1112.m11531
+
+
+def helper_14309_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
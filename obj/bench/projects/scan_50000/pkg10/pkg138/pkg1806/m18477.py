@@ -0,0 +1,17 @@
+"""Module 18477."""
+import pkg2.pkg35.pkg467.m466
+from pkg8.pkg107.pkg1402 import m7653
+
+
+def helper_18477_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_18477_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,31 @@
+"""Module 22645."""
+import pkg8.pkg112.pkg1467.m13970
+from pkg5.pkg72.pkg938 import m15525
+import pkg11.pkg150.m6401
+from pkg3 import m2
+import pkg7.pkg96.pkg1256.m13759
+from pkg1.pkg23.pkg301 import m300
+from . import m3889
+from . import m12225
+import pkg3.pkg47.pkg616.m615
+
+
+def helper_22645_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_22645_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_22645_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,45 @@
+"""Module 30981."""
+from . import m28897
+from pkg9.pkg125.pkg1630 import m5797
+import pkg1.pkg25.pkg327.m6578
+from pkg2.pkg33.pkg435 import m2518
+import pkg5.pkg77.pkg1007.m11426
+from pkg6.pkg86.pkg1131 import m3214
+import pkg1.pkg20.pkg273.m4440
+from pkg2.pkg30.pkg395 import m6646
+import pkg5.pkg72.pkg939.m938
+
+
+def helper_30981_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_30981_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_30981_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_30981_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_30981_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
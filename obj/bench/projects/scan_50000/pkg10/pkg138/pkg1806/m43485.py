@@ -0,0 +1,20 @@
+"""Module 43485."""
+import pkg8.pkg110.pkg1438.m11857
+from pkg4.pkg55.pkg716 import m34059
+import pkg3.pkg52.m10471
+from pkg10.pkg142 import m141
+import pkg10.pkg136.pkg1780.m1779
+
+
+def helper_43485_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_43485_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,53 @@
+"""Module 8057."""
+import pkg1.pkg20.pkg273.m272
+from pkg2 import m1
+import pkg9.pkg120.pkg1562.m5729
+from pkg8.pkg107.pkg1401 import m5568
+import pkg12.pkg159.pkg2075.m4158
+from pkg1 import m0
+import pkg5.pkg70.pkg922.m921
+from . import m1805
+import pkg1.pkg17.pkg234.m233
+from pkg9.pkg118.pkg1539 import m1538
+
+
+def helper_8057_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8057_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8057_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8057_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_8057_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_8057_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,21 @@
+"""Module 10142."""
+import pkg6.pkg87.m86
+from pkg4.pkg64.pkg838 import m837
+from . import m3890
+from pkg1.pkg23.pkg303 import m2386
+from . import m5974
+from pkg2.pkg35.pkg457 import m456
+
+
+def helper_10142_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10142_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,13 @@
+"""Module 49738."""
+import pkg9.pkg120.pkg1562.m39073
+from . import m20562
+import pkg4.pkg55.pkg722.m6973
+from . import m28898
+from . import m41402
+
+
+def helper_49738_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
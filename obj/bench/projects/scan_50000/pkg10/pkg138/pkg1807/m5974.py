@@ -0,0 +1,19 @@
+"""Module 5974."""
+import pkg3.pkg45.pkg589.m4756
+from . import m3890
+import pkg1.pkg25.pkg336.m335
+from pkg12.pkg163 import m162
+import pkg8.pkg108.pkg1407.m5574
+from pkg4.pkg63.pkg827 import m4994
+import pkg10.pkg141.m140
+from pkg5.pkg72 import m71
+import pkg1.pkg19.pkg248.m247
+from . import m1806
+import pkg5.pkg67.pkg879.m878
+
+
+def helper_5974_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,45 @@
+"""Module 8058."""
+import pkg4.pkg53.m52
+from pkg10.pkg134 import m133
+import pkg8.pkg112.pkg1467.m1466
+from . import m5974
+from . import m3890
+from pkg10.pkg137.pkg1793 import m3876
+import pkg3.pkg52.pkg677.m2760
+from pkg4.pkg62.pkg809 import m4976
+from . import m1806
+
+
+def helper_8058_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8058_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8058_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8058_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_8058_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,47 @@
+"""Module 10558."""
+from . import m2222
+from pkg12.pkg164 import m163
+import pkg5.pkg74.pkg971.m7222
+from pkg11.pkg146 import m145
+import pkg4.pkg65.pkg858.m857
+from pkg3.pkg41 import m40
+from . import m6390
+from . import m4306
+import pkg1.pkg25.pkg334.m333
+from pkg1 import m0
+import pkg2.pkg28.pkg366.m8701
+
+
+def helper_10558_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10558_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_10558_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_10558_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_10558_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
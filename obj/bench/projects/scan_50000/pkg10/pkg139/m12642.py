@@ -0,0 +1,10 @@
+"""Module 12642."""
+import pkg3.pkg50.pkg655.m654
+from pkg7.pkg93.pkg1212 import m3295
+
+
+def helper_12642_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
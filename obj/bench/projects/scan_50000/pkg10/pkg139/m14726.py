@@ -0,0 +1,27 @@
+"""Module 14726."""
+import pkg12.pkg166.m165
+from pkg1.pkg26.pkg349 import m6600
+from . import m10558
+from pkg6.pkg80 import m79
+import pkg5.m4
+from pkg3.pkg44.pkg582 import m581
+import pkg2.pkg31.pkg406.m4573
+from pkg2.pkg35.pkg459 import m458
+import pkg2.pkg37.m36
+from pkg4.pkg56.pkg733 import m732
+import pkg13.pkg180.m8515
+from . import m2222
+
+
+def helper_14726_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14726_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
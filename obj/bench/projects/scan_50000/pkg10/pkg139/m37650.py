@@ -0,0 +1,27 @@
+"""Module 37650."""
+import pkg2.pkg38.pkg496.m495
+from pkg1 import m0
+import pkg2.pkg36.pkg469.m468
+from . import m27230
+import pkg1.pkg22.pkg296.m4463
+
+
+def helper_37650_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37650_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_37650_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 48070."""
+import pkg3.pkg45.pkg587.m586
+from pkg2.pkg32.pkg418 import m10837
+from . import m2222
+
+
+def helper_48070_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
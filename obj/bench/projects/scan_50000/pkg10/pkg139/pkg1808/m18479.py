@@ -0,0 +1,33 @@
+"""Module 18479."""
+import pkg2.pkg39.m38
+from pkg2 import m1
+from . import m3891
+from pkg5.pkg75.pkg985 import m984
+import pkg9.pkg118.pkg1545.m1544
+from pkg10.pkg143.pkg1869 import m14372
+import pkg3.pkg48.pkg635.m2718
+from pkg4.pkg54.pkg707 import m13210
+import pkg9.pkg122.pkg1597.m9932
+from . import m1807
+import pkg1.m0
+
+
+def helper_18479_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_18479_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_18479_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
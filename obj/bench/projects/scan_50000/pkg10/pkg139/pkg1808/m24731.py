@@ -0,0 +1,55 @@
+"""Module 24731."""
+import pkg9.pkg123.m122
+from . import m16395
+from . import m10143
+from pkg6.pkg83.pkg1086 import m1085
+import pkg4.pkg62.pkg818.m4985
+from pkg9 import m8
+import pkg2.pkg36.pkg474.m473
+from pkg1.pkg22.pkg292 import m23215
+import pkg2.pkg28.m27
+from pkg10.pkg131.pkg1709 import m1708
+import pkg8.pkg112.pkg1461.m20216
+from pkg3.pkg47.pkg621 import m620
+
+
+def helper_24731_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_24731_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_24731_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_24731_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_24731_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_24731_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 28899."""
+import pkg4.pkg54.pkg709.m11128
+from pkg2.pkg34 import m33
+from . import m10143
+from pkg3.pkg45.pkg598 import m6849
+
+
+def helper_28899_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_28899_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,40 @@
+"""Module 33067."""
+import pkg1.m0
+from pkg11.pkg145.pkg1894 import m28985
+import pkg3.pkg47.pkg622.m6873
+from . import m10143
+import pkg1.pkg14.pkg185.m184
+from . import m24731
+import pkg5.pkg66.pkg863.m9198
+from pkg1.pkg18.pkg236 import m31495
+import pkg5.pkg78.pkg1024.m1023
+from pkg7.pkg93.pkg1222 import m5389
+import pkg6.pkg90.pkg1176.m1175
+
+
+def helper_33067_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_33067_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_33067_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_33067_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,53 @@
+"""Module 35151."""
+import pkg1.m0
+from pkg1.pkg14.pkg188 import m187
+import pkg8.pkg109.pkg1422.m7673
+from pkg9.pkg118 import m20957
+import pkg9.pkg123.pkg1605.m5772
+from pkg9.pkg121.pkg1576 import m14079
+from . import m22647
+from pkg8.pkg111.pkg1444 import m5611
+from . import m3891
+from pkg7.pkg101.pkg1319 import m5486
+
+
+def helper_35151_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35151_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_35151_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_35151_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_35151_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_35151_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
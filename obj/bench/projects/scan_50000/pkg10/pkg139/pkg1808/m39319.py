@@ -0,0 +1,15 @@
+"""Module 39319."""
+import pkg5.pkg77.pkg1011.m23934
+from pkg8.pkg115.pkg1506 import m24429
+import pkg11.pkg148.pkg1931.m14434
+from . import m18479
+import pkg4.pkg56.pkg733.m11152
+from pkg9.pkg121.pkg1576 import m1575
+import pkg5.pkg72.pkg938.m19693
+
+
+def helper_39319_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
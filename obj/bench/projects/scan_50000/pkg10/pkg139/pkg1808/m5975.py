@@ -0,0 +1,21 @@
+"""Module 5975."""
+from . import m1807
+from pkg8.pkg107.pkg1400 import m1399
+import pkg3.pkg51.pkg667.m2750
+from pkg8.pkg117.pkg1534 import m5701
+import pkg4.pkg63.pkg827.m4994
+from pkg4.pkg59.pkg769 import m2852
+
+
+def helper_5975_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5975_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,62 @@
+"""Module 28901."""
+import pkg1.pkg17.pkg234.m4401
+from pkg2.pkg33.pkg430 import m2513
+from . import m20565
+from pkg10.pkg140.pkg1824 import m3907
+import pkg5.pkg77.pkg1002.m28093
+from pkg2 import m4169
+import pkg6.pkg82.pkg1069.m26076
+from pkg3.pkg48.pkg631 import m25638
+import pkg3.pkg47.pkg623.m622
+from . import m8061
+import pkg5.m4
+from . import m16397
+
+
+def helper_28901_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_28901_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_28901_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_28901_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_28901_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_28901_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_28901_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
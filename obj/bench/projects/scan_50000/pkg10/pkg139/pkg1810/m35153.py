@@ -0,0 +1,15 @@
+"""Module 35153."""
+import pkg2.pkg27.pkg361.m14948
+from pkg9.pkg125.pkg1634 import m30809
+from . import m26817
+from pkg3.pkg46.pkg611 import m15198
+from . import m10145
+from pkg9.pkg122.pkg1592 import m14095
+from . import m30985
+
+
+def helper_35153_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,15 @@
+"""Module 14314."""
+import pkg1.pkg22.pkg289.m288
+from . import m10146
+import pkg1.pkg14.m13
+from . import m5978
+import pkg7.pkg98.pkg1279.m1278
+from pkg7.pkg100.pkg1307 import m1306
+from . import m1810
+
+
+def helper_14314_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,30 @@
+"""Module 20566."""
+import pkg6.pkg79.pkg1040.m9375
+from pkg3.pkg51.pkg666 import m6917
+import pkg4.pkg57.pkg752.m15339
+from . import m8062
+import pkg9.m8
+from . import m14314
+import pkg9.pkg122.m121
+from pkg1.pkg15.pkg206 import m205
+
+
+def helper_20566_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_20566_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_20566_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,53 @@
+"""Module 24734."""
+import pkg8.pkg107.pkg1404.m5571
+from pkg12.pkg158.pkg2060 import m20815
+import pkg1.pkg22.m21
+from . import m1810
+import pkg4.pkg58.pkg759.m2842
+from . import m12230
+import pkg10.pkg135.pkg1768.m5935
+from pkg1 import m0
+import pkg1.pkg25.pkg332.m4499
+from pkg2.pkg36.pkg472 import m471
+
+
+def helper_24734_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_24734_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_24734_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_24734_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_24734_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_24734_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
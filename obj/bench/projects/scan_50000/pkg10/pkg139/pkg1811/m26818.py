@@ -0,0 +1,32 @@
+"""Module 26818."""
+import pkg3.pkg47.pkg619.m2702
+from pkg6.pkg88.pkg1151 import m1150
+import pkg11.pkg148.pkg1929.m1928
+from pkg10.pkg133.pkg1739 import m3822
+import pkg3.pkg40.pkg529.m528
+from pkg6.pkg82.pkg1079 import m9414
+import pkg12.m11
+from pkg3.pkg48.pkg629 import m13132
+from . import m18482
+from . import m24734
+
+
+def helper_26818_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_26818_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_26818_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 10147."""
+import pkg2.pkg37.m36
+from pkg2.pkg32.pkg429 import m428
+import pkg11.m10
+
+
+def helper_10147_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10147_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 14315."""
+import pkg6.pkg83.pkg1081.m1080
+from pkg1.pkg17.pkg228 import m6479
+from . import m10147
+from pkg1.pkg14.pkg187 import m186
+import pkg4.m3
+
+
+def helper_14315_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14315_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,31 @@
+"""Module 24735."""
+import pkg2.pkg38.pkg500.m499
+from pkg1.pkg14.pkg189 import m4356
+import pkg3.pkg42.pkg555.m17226
+from pkg6 import m5
+import pkg8.pkg109.pkg1423.m9758
+from pkg2.pkg28.pkg366 import m365
+import pkg1.pkg26.m25
+from pkg1.pkg14.pkg194 import m193
+import pkg10.pkg133.pkg1742.m22581
+
+
+def helper_24735_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_24735_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_24735_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
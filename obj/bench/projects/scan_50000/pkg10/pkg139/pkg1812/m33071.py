@@ -0,0 +1,36 @@
+"""Module 33071."""
+import pkg1.pkg23.pkg302.m27393
+from pkg12.pkg167 import m166
+import pkg11.pkg149.m2232
+from pkg1.pkg15.pkg207 import m206
+from . import m1811
+from pkg4.pkg62.pkg810 import m29985
+import pkg5.pkg72.pkg939.m9274
+
+
+def helper_33071_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_33071_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_33071_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_33071_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
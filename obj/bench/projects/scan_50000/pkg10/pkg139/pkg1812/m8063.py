@@ -0,0 +1,5 @@
+"""Module 8063."""
+import pkg2.pkg32.pkg424.m423
+from pkg1.pkg24.pkg317 import m316
+import pkg11.pkg156.pkg2029.m2028
+from pkg1.pkg26.pkg340 import m2423
@@ -0,0 +1,31 @@
+"""Module 1812."""
+import pkg10.pkg139.m138
+from pkg4.pkg59.pkg772 import m771
+import pkg1.pkg23.pkg306.m305
+from pkg6.pkg85 import m84
+import pkg10.pkg135.m134
+from pkg1 import m0
+import pkg5.m4
+from pkg11.pkg148 import m147
+import pkg10.pkg138.m137
+
+
+def helper_1812_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1812_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1812_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 18484."""
+import pkg2.pkg30.pkg403.m402
+from pkg4.pkg56.pkg739 import m6990
+import pkg2.pkg31.pkg414.m10833
+from pkg11.pkg145.pkg1897 import m3980
+from . import m1812
+from pkg8.pkg107.pkg1398 import m1397
+import pkg4.pkg63.pkg830.m13333
+from pkg6.pkg81 import m80
+import pkg8.pkg112.pkg1468.m1467
+from . import m10148
+
+
+def helper_18484_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 24736."""
+import pkg10.pkg136.pkg1773.m3856
+from pkg5.pkg69.pkg904 import m2987
+import pkg8.pkg108.pkg1409.m5576
+from pkg2.pkg36.pkg476 import m475
+from . import m22652
+from pkg5.pkg75.pkg983 import m19738
+from . import m18484
+from pkg9.pkg120.pkg1572 import m1571
+import pkg11.pkg144.pkg1876.m1875
+from pkg9.pkg127.pkg1653 import m9988
+
+
+def helper_24736_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_24736_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 30988."""
+import pkg6.pkg83.pkg1081.m3164
+from . import m14316
+import pkg7.pkg98.pkg1281.m5448
+from pkg5.pkg75.pkg976 import m975
+import pkg7.pkg95.m94
+from pkg2.pkg33.pkg438 import m29613
+import pkg2.pkg38.pkg503.m17174
+from pkg2.pkg27.pkg360 import m2443
+import pkg10.pkg142.pkg1847.m1846
+
+
+def helper_30988_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,62 @@
+"""Module 41408."""
+from . import m28904
+from . import m20568
+import pkg2.pkg30.pkg395.m394
+from . import m1812
+import pkg9.pkg122.pkg1591.m5758
+from pkg7.pkg95.pkg1237 import m5404
+import pkg9.pkg121.pkg1585.m1584
+from pkg1 import m0
+import pkg7.pkg104.pkg1356.m7607
+from pkg1.pkg23 import m22
+import pkg8.pkg114.m2197
+from pkg5.pkg66.pkg865 import m864
+
+
+def helper_41408_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_41408_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_41408_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_41408_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_41408_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_41408_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_41408_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,38 @@
+"""Module 8064."""
+from . import m5980
+from pkg10.pkg143.pkg1872 import m6039
+import pkg6.pkg89.pkg1162.m5329
+from . import m3896
+import pkg6.pkg89.pkg1158.m1157
+from pkg12.pkg158 import m6409
+import pkg10.pkg135.m134
+from pkg7.pkg93.pkg1218 import m1217
+import pkg3.pkg50.pkg653.m652
+
+
+def helper_8064_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8064_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8064_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8064_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
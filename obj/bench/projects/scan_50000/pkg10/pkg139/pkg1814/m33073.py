@@ -0,0 +1,34 @@
+"""Module 33073."""
+import pkg8.pkg110.m29285
+from pkg11.pkg150 import m149
+import pkg3.pkg44.pkg575.m2658
+from pkg8.pkg105.pkg1375 import m7626
+import pkg5.pkg72.pkg948.m947
+
+
+def helper_33073_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_33073_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_33073_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_33073_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
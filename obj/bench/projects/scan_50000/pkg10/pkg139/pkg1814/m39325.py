@@ -0,0 +1,53 @@
+"""Module 39325."""
+import pkg4.pkg61.pkg805.m11224
+from pkg7.pkg102.pkg1331 import m11750
+import pkg10.pkg137.pkg1789.m10124
+from pkg9 import m8
+import pkg5.pkg76.pkg1000.m13503
+from pkg11.pkg144 import m35571
+from . import m10149
+from pkg1 import m0
+import pkg5.pkg77.pkg1006.m38517
+from pkg9.pkg122.pkg1596 import m1595
+
+
+def helper_39325_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39325_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_39325_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_39325_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_39325_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_39325_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
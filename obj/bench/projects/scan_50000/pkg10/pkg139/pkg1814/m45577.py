@@ -0,0 +1,17 @@
+"""Module 45577."""
+import pkg7.pkg96.pkg1252.m26259
+from pkg2.pkg39.pkg516 import m4683
+import pkg2.pkg37.m36
+from . import m37241
+import pkg4.pkg53.pkg699.m698
+from pkg2.pkg32 import m31
+import pkg5.pkg77.pkg1013.m9348
+from pkg2.pkg33.pkg430 import m35857
+from . import m18485
+
+
+def helper_45577_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
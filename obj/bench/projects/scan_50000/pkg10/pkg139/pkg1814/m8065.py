@@ -0,0 +1,21 @@
+"""Module 8065."""
+import pkg13.pkg178.m4345
+from pkg3.pkg41.pkg543 import m542
+import pkg1.pkg18.pkg247.m246
+from pkg3 import m2
+import pkg6.m5
+from pkg9.pkg128 import m127
+
+
+def helper_8065_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8065_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
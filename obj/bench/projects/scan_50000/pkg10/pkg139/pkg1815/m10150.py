@@ -0,0 +1,15 @@
+"""Module 10150."""
+import pkg7.pkg102.pkg1337.m5504
+from pkg5.pkg72.pkg940 import m939
+from . import m1814
+from pkg10.pkg143 import m2226
+import pkg11.pkg147.pkg1918.m6085
+from pkg7.pkg98.pkg1284 import m1283
+import pkg1.pkg24.pkg316.m2399
+
+
+def helper_10150_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
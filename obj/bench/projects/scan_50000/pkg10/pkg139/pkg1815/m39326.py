@@ -0,0 +1,22 @@
+"""Module 39326."""
+from . import m30990
+from pkg7.pkg92.pkg1209 import m5376
+import pkg5.pkg71.pkg929.m11348
+from pkg11.pkg147.pkg1921 import m6088
+import pkg1.pkg22.m21
+from . import m37242
+import pkg1.m0
+
+
+def helper_39326_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39326_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
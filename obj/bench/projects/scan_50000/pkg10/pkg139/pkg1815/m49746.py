@@ -0,0 +1,35 @@
+"""Module 49746."""
+import pkg10.pkg142.pkg1849.m1848
+from pkg11.pkg154.pkg2013 import m22852
+import pkg10.pkg139.pkg1820.m8071
+from pkg4.pkg55.pkg722 import m721
+import pkg8.pkg113.pkg1472.m9807
+from pkg10.pkg140.pkg1825 import m5992
+
+
+def helper_49746_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_49746_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_49746_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_49746_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
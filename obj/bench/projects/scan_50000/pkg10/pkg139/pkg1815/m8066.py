@@ -0,0 +1,26 @@
+"""Module 8066."""
+import pkg13.pkg179.m178
+from pkg4.pkg62.pkg814 import m813
+import pkg9.pkg119.pkg1557.m3640
+from pkg6.pkg83 import m82
+
+
+def helper_8066_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8066_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8066_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,21 @@
+"""Module 20571."""
+import pkg9.pkg130.pkg1702.m16289
+from . import m12235
+import pkg1.pkg15.pkg207.m206
+from . import m1815
+import pkg9.pkg121.pkg1586.m3669
+from pkg4 import m3
+
+
+def helper_20571_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_20571_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,53 @@
+"""Module 22655."""
+import pkg1.pkg24.pkg324.m323
+from . import m8067
+import pkg8.pkg117.pkg1522.m1521
+from pkg3.pkg43.pkg571 import m570
+import pkg6.pkg91.pkg1196.m1195
+from pkg5 import m4
+from . import m1815
+from pkg6.pkg85.pkg1110 import m5277
+import pkg11.pkg147.pkg1919.m4002
+from pkg1.pkg19.pkg251 import m10670
+
+
+def helper_22655_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_22655_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_22655_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_22655_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_22655_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_22655_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
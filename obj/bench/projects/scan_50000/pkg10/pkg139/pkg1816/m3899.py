@@ -0,0 +1,17 @@
+"""Module 3899."""
+import pkg4.pkg56.m55
+from . import m1815
+import pkg3.pkg42.pkg548.m547
+from pkg9 import m8
+import pkg1.pkg14.pkg192.m191
+from pkg1.pkg23.pkg300 import m299
+import pkg3.pkg41.pkg545.m544
+from pkg5.pkg72.pkg947 import m946
+import pkg4.pkg57.pkg750.m749
+
+
+def helper_3899_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
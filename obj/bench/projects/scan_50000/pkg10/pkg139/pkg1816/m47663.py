@@ -0,0 +1,18 @@
+"""Module 47663."""
+import pkg13.pkg179.m178
+from pkg3.pkg52 import m51
+import pkg5.pkg71.pkg927.m34270
+
+
+def helper_47663_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_47663_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 10152."""
+import pkg3.m2
+from . import m3900
+from . import m1816
+
+
+def helper_10152_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10152_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 1816."""
+import pkg4.m3
+from pkg4.pkg56.pkg735 import m734
+
+
+def helper_1816_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1816_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
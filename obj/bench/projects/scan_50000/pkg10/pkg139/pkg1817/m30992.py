@@ -0,0 +1,46 @@
+"""Module 30992."""
+from . import m10152
+from pkg1 import m0
+import pkg1.pkg20.pkg268.m14855
+from . import m26824
+from . import m8068
+from pkg7.pkg99 import m98
+import pkg8.pkg106.pkg1386.m22225
+from pkg7.pkg92.pkg1204 import m17875
+import pkg7.pkg94.pkg1229.m1228
+from pkg10.pkg139 import m138
+
+
+def helper_30992_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_30992_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_30992_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_30992_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_30992_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,32 @@
+"""Module 14321."""
+import pkg8.pkg117.pkg1534.m5701
+from pkg1.pkg23.pkg301 import m6552
+import pkg5.pkg77.pkg1013.m5180
+from . import m1817
+import pkg3.pkg40.pkg522.m2605
+from pkg10.pkg135.pkg1761 import m3844
+import pkg10.pkg136.pkg1769.m3852
+from pkg5.pkg68.pkg886 import m9221
+import pkg11.pkg145.pkg1892.m12311
+from . import m10153
+
+
+def helper_14321_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14321_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_14321_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,22 @@
+"""Module 26825."""
+import pkg1.pkg20.pkg273.m2356
+from pkg7.pkg101.pkg1315 import m1314
+import pkg9.pkg122.m8457
+from pkg7.pkg93.pkg1219 import m7470
+from . import m12237
+from pkg5.pkg69.pkg909 import m19664
+import pkg5.pkg71.pkg930.m11349
+
+
+def helper_26825_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_26825_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,30 @@
+"""Module 33077."""
+import pkg2.pkg33.pkg433.m432
+from pkg5.pkg75.pkg988 import m13491
+import pkg6.pkg87.pkg1132.m11551
+from pkg6.pkg90 import m89
+import pkg5.pkg67.pkg878.m7129
+from pkg7.pkg102 import m101
+import pkg5.pkg70.pkg916.m915
+from pkg7.pkg95.pkg1236 import m17907
+
+
+def helper_33077_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_33077_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_33077_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
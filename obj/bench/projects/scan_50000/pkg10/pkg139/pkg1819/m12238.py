@@ -0,0 +1,9 @@
+"""Module 12238."""
+import pkg1.pkg15.pkg196.m195
+
+
+def helper_12238_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
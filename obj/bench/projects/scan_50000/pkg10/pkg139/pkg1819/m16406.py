@@ -0,0 +1,18 @@
+"""Module 16406."""
+import pkg1.pkg16.pkg209.m6460
+from pkg8.pkg117 import m14704
+import pkg3.pkg52.pkg686.m685
+
+
+def helper_16406_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16406_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
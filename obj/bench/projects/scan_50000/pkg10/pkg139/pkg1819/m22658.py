@@ -0,0 +1,12 @@
+"""Module 22658."""
+from . import m8070
+from pkg7.pkg95.pkg1239 import m1238
+import pkg2.pkg32.pkg426.m425
+from pkg1.pkg25.pkg329 import m328
+import pkg1.m0
+from pkg3.pkg45 import m44
+import pkg7.pkg92.m18847
+from pkg3.pkg50 import m49
+import pkg1.pkg25.pkg333.m332
+from pkg4.pkg61.pkg803 import m2886
+import pkg8.pkg114.m6365
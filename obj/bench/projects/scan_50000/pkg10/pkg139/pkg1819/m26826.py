@@ -0,0 +1,16 @@
+"""Module 26826."""
+import pkg11.pkg156.pkg2030.m22869
+from pkg4.pkg60.pkg793 import m792
+import pkg9.pkg121.pkg1575.m5742
+from pkg9.pkg128.pkg1667 import m12086
+import pkg1.pkg23.pkg301.m300
+from . import m14322
+from . import m12238
+from pkg5.pkg73.pkg958 import m7209
+
+
+def helper_26826_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
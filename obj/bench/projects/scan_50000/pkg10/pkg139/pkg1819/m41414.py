@@ -0,0 +1,26 @@
+"""Module 41414."""
+import pkg1.pkg18.pkg239.m238
+from pkg9.pkg129.pkg1689 import m14192
+from . import m24742
+from . import m37246
+import pkg4.pkg54.pkg705.m704
+from pkg9.pkg127.pkg1663 import m7914
+import pkg1.pkg25.pkg332.m14919
+from . import m20574
+import pkg6.pkg83.pkg1082.m17753
+from pkg6.pkg82.pkg1069 import m3152
+import pkg2.pkg29.pkg387.m19142
+
+
+def helper_41414_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_41414_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
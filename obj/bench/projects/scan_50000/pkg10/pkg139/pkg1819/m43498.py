@@ -0,0 +1,27 @@
+"""Module 43498."""
+import pkg2.pkg37.m36
+from pkg1.pkg22.pkg297 import m296
+import pkg9.pkg125.pkg1630.m28721
+from pkg5.pkg68.pkg891 import m7142
+import pkg8.pkg109.pkg1430.m11849
+from pkg8.pkg115.pkg1498 import m26505
+import pkg9.pkg125.pkg1626.m18297
+from pkg4.pkg62.pkg807 import m4974
+import pkg5.pkg71.pkg930.m3013
+from pkg3.pkg48.pkg625 import m40220
+import pkg2.pkg29.pkg389.m388
+from pkg10.pkg132.pkg1724 import m3807
+
+
+def helper_43498_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_43498_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 47666."""
+import pkg3.pkg43.pkg567.m4734
+from pkg2.pkg32.pkg429 import m8764
+from . import m18490
+from pkg8.pkg107.pkg1394 import m1393
+
+
+def helper_47666_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_47666_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_47666_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
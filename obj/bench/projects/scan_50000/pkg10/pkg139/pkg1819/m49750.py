@@ -0,0 +1,44 @@
+"""Module 49750."""
+from . import m22658
+from . import m45582
+import pkg9.pkg129.pkg1685.m32944
+from . import m16406
+import pkg5.pkg72.m71
+from pkg9.pkg126.pkg1639 import m7890
+import pkg10.pkg132.pkg1726.m3809
+from pkg2.pkg37.pkg488 import m8823
+
+
+def helper_49750_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_49750_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_49750_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_49750_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_49750_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
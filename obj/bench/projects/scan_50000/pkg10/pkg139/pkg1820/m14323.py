@@ -0,0 +1,47 @@
+"""Module 14323."""
+import pkg6.pkg90.pkg1180.m7431
+from pkg10.pkg141 import m140
+import pkg11.pkg152.m2235
+from pkg1.pkg21.pkg283 import m282
+import pkg7.pkg100.m99
+from pkg1.pkg21.pkg285 import m6536
+import pkg4.pkg62.pkg807.m9142
+from . import m10155
+from . import m12239
+from pkg9.pkg130.pkg1696 import m10031
+import pkg2.pkg38.pkg506.m505
+
+
+def helper_14323_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14323_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_14323_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_14323_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_14323_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
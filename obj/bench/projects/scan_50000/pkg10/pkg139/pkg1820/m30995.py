@@ -0,0 +1,36 @@
+"""Module 30995."""
+import pkg5.pkg70.pkg916.m915
+from pkg3.pkg40.pkg522 import m521
+from . import m18491
+from pkg3.pkg52.pkg681 import m680
+import pkg10.pkg135.pkg1756.m16343
+from . import m16407
+import pkg7.pkg102.pkg1330.m24253
+
+
+def helper_30995_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_30995_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_30995_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_30995_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
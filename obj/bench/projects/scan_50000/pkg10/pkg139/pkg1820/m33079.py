@@ -0,0 +1,36 @@
+"""Module 33079."""
+import pkg8.m7
+from pkg7.pkg103.pkg1345 import m1344
+import pkg3.pkg42.pkg549.m548
+from pkg10.pkg143.pkg1864 import m16451
+import pkg10.pkg137.pkg1791.m3874
+from pkg11.pkg155.pkg2027 import m2026
+import pkg11.m10
+
+
+def helper_33079_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_33079_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_33079_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_33079_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,61 @@
+"""Module 3903."""
+import pkg1.pkg15.pkg199.m198
+from pkg2.pkg27.pkg353 import m2436
+import pkg5.pkg78.pkg1027.m1026
+from . import m1819
+import pkg3.pkg40.m39
+from pkg3.pkg46.pkg606 import m605
+import pkg3.pkg51.pkg670.m669
+from pkg2.pkg27.pkg360 import m359
+import pkg2.pkg29.pkg390.m389
+from pkg1.pkg18.pkg242 import m241
+import pkg1.m0
+
+
+def helper_3903_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3903_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3903_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3903_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_3903_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_3903_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3903_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,40 @@
+"""Module 12643."""
+import pkg4.m3
+from pkg1.pkg16.pkg219 import m218
+import pkg2.m1
+from . import m10559
+import pkg6.pkg88.pkg1156.m3239
+from pkg8.pkg112.pkg1458 import m1457
+import pkg11.pkg149.m148
+from pkg7 import m6
+from . import m2223
+from pkg3 import m2
+import pkg1.pkg22.m21
+
+
+def helper_12643_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12643_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_12643_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_12643_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,23 @@
+"""Module 25147."""
+import pkg3.pkg45.pkg594.m593
+from pkg8.pkg112.pkg1466 import m3549
+from . import m4307
+from pkg5.pkg74.pkg963 import m962
+import pkg2.pkg27.pkg358.m357
+from pkg8.pkg116.pkg1520 import m1519
+import pkg11.pkg154.pkg2006.m8257
+from pkg8.pkg109.pkg1426 import m1425
+
+
+def helper_25147_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_25147_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
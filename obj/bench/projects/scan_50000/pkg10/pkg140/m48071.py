@@ -0,0 +1,43 @@
+"""Module 48071."""
+from . import m8475
+from . import m23063
+import pkg6.pkg79.pkg1030.m13533
+from pkg4.pkg63.pkg826 import m825
+import pkg6.pkg84.pkg1094.m15681
+from pkg2.pkg30.pkg392 import m23315
+import pkg7.pkg102.pkg1335.m11754
+
+
+def helper_48071_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_48071_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_48071_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_48071_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_48071_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
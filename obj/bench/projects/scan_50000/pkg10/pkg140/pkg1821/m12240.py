@@ -0,0 +1,28 @@
+"""Module 12240."""
+import pkg2.pkg29.pkg386.m385
+from pkg9.pkg120.pkg1562 import m1561
+import pkg1.pkg16.pkg220.m219
+from pkg9.pkg130.pkg1701 import m10036
+import pkg2.pkg36.pkg476.m475
+from pkg10 import m9
+
+
+def helper_12240_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12240_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_12240_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
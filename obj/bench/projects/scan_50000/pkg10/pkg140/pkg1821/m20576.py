@@ -0,0 +1,62 @@
+"""Module 20576."""
+import pkg5.pkg74.m73
+from pkg1.pkg14.pkg194 import m193
+import pkg9.pkg127.pkg1658.m1657
+from pkg7.pkg104.pkg1353 import m3436
+import pkg9.pkg119.m118
+from pkg4 import m3
+import pkg3.pkg42.pkg554.m553
+from pkg5.pkg74.pkg972 import m3055
+import pkg8.pkg113.pkg1475.m9810
+from pkg1.pkg19.pkg260 import m259
+import pkg5.pkg73.pkg957.m7208
+from . import m18492
+
+
+def helper_20576_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_20576_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_20576_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_20576_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_20576_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_20576_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_20576_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
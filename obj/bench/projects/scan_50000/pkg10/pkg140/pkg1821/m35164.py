@@ -0,0 +1,20 @@
+"""Module 35164."""
+import pkg8.pkg112.pkg1457.m28548
+from pkg2.pkg36.pkg478 import m2561
+import pkg1.pkg18.pkg238.m237
+from pkg7.pkg99.pkg1298 import m26305
+import pkg1.pkg24.pkg322.m321
+from pkg1.pkg26.pkg345 import m8680
+import pkg8.pkg112.pkg1462.m7713
+from pkg11.pkg148.pkg1934 import m16521
+import pkg2.pkg36.pkg477.m476
+from pkg5.pkg74.pkg975 import m974
+import pkg2.pkg30.pkg391.m390
+from . import m12240
+
+
+def helper_35164_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,22 @@
+"""Module 41416."""
+import pkg8.pkg107.pkg1403.m26410
+from pkg1.pkg15.pkg206 import m8541
+import pkg10.pkg132.pkg1727.m5894
+from pkg9.pkg121.pkg1583 import m16170
+from . import m14324
+from pkg11.pkg153.pkg1999 import m12418
+from . import m8072
+
+
+def helper_41416_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_41416_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 8072."""
+import pkg1.pkg17.pkg234.m233
+from pkg1.pkg14.pkg192 import m191
+import pkg6.pkg90.pkg1179.m3262
+from pkg1.pkg26.pkg343 import m4510
+import pkg1.pkg22.pkg292.m2375
+from pkg7.pkg101 import m6352
+from . import m1820
+from pkg2.pkg29 import m28
+import pkg6.pkg91.m90
+from pkg4.pkg60.pkg783 import m2866
+
+
+def helper_8072_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8072_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,45 @@
+"""Module 22661."""
+import pkg13.pkg177.m176
+from pkg9.pkg129 import m16800
+import pkg11.pkg144.m4311
+from pkg6.pkg87.pkg1139 import m9474
+from . import m3905
+from pkg9.pkg124.pkg1614 import m3697
+import pkg8.pkg109.pkg1426.m16013
+from pkg1 import m0
+import pkg11.pkg152.pkg1981.m6148
+
+
+def helper_22661_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_22661_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_22661_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_22661_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_22661_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
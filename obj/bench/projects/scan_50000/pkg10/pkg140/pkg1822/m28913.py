@@ -0,0 +1,44 @@
+"""Module 28913."""
+import pkg13.pkg176.m10595
+from pkg7.pkg95.pkg1246 import m24169
+import pkg6.pkg82.m20921
+from pkg3.pkg46.pkg610 import m6861
+import pkg12.pkg162.m161
+from pkg11.pkg147.pkg1915 import m3998
+import pkg10.pkg135.pkg1761.m14264
+from pkg1.pkg20.pkg270 import m12773
+
+
+def helper_28913_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_28913_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_28913_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_28913_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_28913_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
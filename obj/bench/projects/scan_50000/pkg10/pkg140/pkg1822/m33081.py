@@ -0,0 +1,37 @@
+"""Module 33081."""
+import pkg10.pkg137.pkg1785.m24708
+from pkg2.pkg33.pkg433 import m432
+import pkg4.pkg63.pkg827.m15414
+from pkg5.pkg75.pkg982 import m5149
+from . import m12241
+from pkg2.pkg28.pkg375 import m10794
+from . import m8073
+from pkg10.pkg140.pkg1821 import m3904
+
+
+def helper_33081_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_33081_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_33081_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_33081_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,34 @@
+"""Module 3905."""
+import pkg9.pkg128.pkg1667.m1666
+from pkg1.pkg24 import m23
+import pkg1.pkg24.pkg324.m323
+from pkg11.pkg154 import m153
+import pkg5.pkg73.pkg954.m953
+
+
+def helper_3905_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3905_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_3905_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_3905_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
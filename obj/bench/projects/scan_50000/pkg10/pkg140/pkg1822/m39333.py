@@ -0,0 +1,24 @@
+"""Module 39333."""
+from . import m3905
+from pkg1 import m0
+import pkg7.pkg95.m8430
+from pkg2.pkg39.pkg514 import m513
+import pkg3.pkg40.m39
+from . import m24745
+import pkg9.pkg126.pkg1644.m34987
+from pkg4.pkg65 import m64
+import pkg10.pkg140.pkg1827.m12246
+
+
+def helper_39333_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39333_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
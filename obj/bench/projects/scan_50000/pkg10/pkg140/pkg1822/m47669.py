@@ -0,0 +1,41 @@
+"""Module 47669."""
+import pkg7.pkg101.pkg1323.m3406
+from pkg4.pkg61 import m25068
+import pkg9.pkg123.pkg1612.m1611
+from pkg2.pkg30.pkg400 import m6651
+import pkg3.pkg46.pkg605.m17276
+from pkg6.pkg89 import m88
+import pkg1.m0
+from pkg11.pkg150 import m20989
+from . import m35165
+from pkg9.pkg130.pkg1691 import m1690
+import pkg8.pkg114.m113
+from pkg6.pkg81.pkg1059 import m15646
+
+
+def helper_47669_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_47669_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_47669_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_47669_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,15 @@
+"""Module 49753."""
+import pkg2.pkg33.m32
+from pkg4.pkg55.pkg721 import m27812
+import pkg3.pkg44.pkg581.m31840
+from pkg9.pkg130 import m12633
+import pkg6.pkg91.pkg1195.m17866
+from pkg1.pkg21.pkg276 import m275
+import pkg6.pkg87.m86
+
+
+def helper_49753_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
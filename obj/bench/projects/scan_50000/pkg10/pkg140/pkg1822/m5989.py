@@ -0,0 +1,19 @@
+"""Module 5989."""
+from . import m1821
+from pkg12.pkg162 import m161
+import pkg1.pkg19.pkg251.m250
+from pkg7.pkg100.pkg1309 import m1308
+
+
+def helper_5989_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5989_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,23 @@
+"""Module 12242."""
+import pkg1.m0
+from . import m5990
+import pkg2.pkg37.pkg487.m2570
+from pkg2.pkg34.pkg447 import m446
+import pkg4.pkg54.pkg706.m705
+from pkg6.pkg84 import m4251
+import pkg7.pkg94.pkg1232.m9567
+from . import m10158
+
+
+def helper_12242_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12242_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
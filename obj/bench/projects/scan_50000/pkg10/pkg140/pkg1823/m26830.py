@@ -0,0 +1,69 @@
+"""Module 26830."""
+import pkg5.pkg69.pkg904.m903
+from . import m3906
+import pkg8.pkg105.pkg1377.m1376
+from pkg9.pkg120.pkg1561 import m1560
+import pkg3.pkg49.pkg645.m644
+from . import m16410
+import pkg4.pkg55.m54
+from pkg2.pkg32.pkg428 import m427
+import pkg3.pkg46.pkg607.m21446
+from pkg1.pkg20.pkg273 import m272
+import pkg9.pkg129.pkg1690.m12109
+from pkg10.pkg142.pkg1850 import m1849
+
+
+def helper_26830_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_26830_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_26830_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_26830_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_26830_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_26830_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_26830_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_26830_42(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 28914."""
+import pkg4.m3
+from pkg3.pkg49 import m48
+import pkg3.pkg40.pkg525.m21364
+from . import m24746
+import pkg6.pkg84.pkg1096.m17767
+
+
+def helper_28914_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_28914_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,32 @@
+"""Module 41418."""
+import pkg2.pkg34.pkg454.m8789
+from pkg2.pkg37.pkg482 import m33825
+import pkg3.pkg51.pkg673.m672
+from pkg7.pkg92 import m91
+from . import m3906
+from pkg12.pkg168 import m27259
+import pkg5.pkg78.m77
+from pkg4.pkg60.pkg781 import m2864
+import pkg7.pkg95.pkg1243.m9578
+from pkg7.pkg95.pkg1244 import m1243
+
+
+def helper_41418_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_41418_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_41418_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 12243."""
+import pkg6.pkg79.pkg1028.m1027
+from pkg9.pkg129.pkg1688 import m10023
+import pkg4.pkg57.pkg749.m748
+
+
+def helper_12243_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12243_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 28915."""
+import pkg13.m12
+from pkg8.pkg108.pkg1417 import m5584
+from . import m20579
+from pkg3.pkg46.pkg606 import m605
+import pkg1.pkg18.pkg245.m2328
+
+
+def helper_28915_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_28915_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_28915_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,24 @@
+"""Module 30999."""
+import pkg11.pkg153.pkg1990.m22829
+from pkg8.pkg110.pkg1438 import m3521
+import pkg4.pkg53.pkg690.m17361
+from pkg2.pkg33.pkg432 import m431
+import pkg1.pkg20.m19
+from . import m22663
+import pkg6.pkg85.pkg1116.m1115
+from pkg1.pkg23.pkg311 import m310
+import pkg12.pkg158.pkg2055.m10390
+
+
+def helper_30999_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_30999_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 37251."""
+import pkg7.pkg98.pkg1277.m20032
+from pkg2.pkg39.pkg513 import m8848
+from . import m3907
+from pkg4.pkg64.pkg833 import m832
+import pkg1.pkg18.pkg242.m4409
+from pkg10.pkg142.pkg1848 import m1847
+import pkg3.pkg48.pkg634.m17305
+from pkg8.pkg110.pkg1439 import m24362
+import pkg8.pkg112.m111
+from pkg3.pkg52.pkg681 import m36108
+import pkg1.pkg25.m4192
+from pkg11.pkg146.pkg1906 import m14409
+
+
+def helper_37251_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37251_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 12244."""
+import pkg7.pkg94.pkg1231.m1230
+from pkg4.pkg60 import m59
+import pkg6.pkg89.pkg1161.m1160
+from pkg5.pkg78.pkg1019 import m3102
+import pkg7.pkg92.pkg1204.m3287
+from pkg1.pkg22.pkg293 import m8628
+import pkg1.m0
+from pkg4.pkg62 import m8397
+from . import m5992
+from pkg11.pkg145.pkg1893 import m3976
+import pkg1.pkg14.pkg188.m187
+
+
+def helper_12244_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12244_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 14328."""
+import pkg7.pkg98.pkg1286.m1285
+from pkg8.pkg116.pkg1510 import m3593
+
+
+def helper_14328_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14328_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,28 @@
+"""Module 1824."""
+import pkg10.pkg134.m133
+from pkg1 import m0
+import pkg4.pkg65.m64
+from pkg1.pkg20.pkg268 import m267
+import pkg13.pkg174.m173
+from pkg10.pkg138.pkg1807 import m1806
+
+
+def helper_1824_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1824_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1824_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,44 @@
+"""Module 18496."""
+import pkg10.pkg133.m132
+from pkg1.pkg16.pkg219 import m218
+import pkg6.pkg88.pkg1156.m1155
+from pkg7.pkg102.pkg1329 import m11748
+from . import m1824
+from pkg3.pkg43.pkg560 import m8895
+import pkg10.pkg141.pkg1841.m3924
+from . import m16412
+
+
+def helper_18496_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_18496_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_18496_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_18496_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_18496_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
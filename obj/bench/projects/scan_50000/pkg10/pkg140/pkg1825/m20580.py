@@ -0,0 +1,23 @@
+"""Module 20580."""
+import pkg5.pkg66.pkg866.m13369
+from pkg4.pkg60.pkg784 import m2867
+import pkg7.pkg103.m2186
+from pkg4.pkg53.pkg700 import m6951
+from . import m3908
+from . import m8076
+import pkg4.pkg62.pkg814.m15401
+from pkg10.pkg137.pkg1787 import m10122
+
+
+def helper_20580_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_20580_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 28916."""
+import pkg8.pkg106.pkg1386.m11805
+from pkg3.pkg42.pkg552 import m551
+import pkg4.pkg63.pkg820.m4987
+
+
+def helper_28916_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 41420."""
+import pkg5.pkg72.pkg947.m38458
+from pkg12.pkg159 import m158
+import pkg3.pkg45.pkg596.m595
+from . import m3908
+from . import m8076
+
+
+def helper_41420_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_41420_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_41420_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
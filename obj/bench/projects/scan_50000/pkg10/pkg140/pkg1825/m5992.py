@@ -0,0 +1,24 @@
+"""Module 5992."""
+import pkg1.m0
+from . import m1824
+from . import m3908
+from pkg1.pkg15.pkg201 import m200
+import pkg6.pkg88.pkg1151.m3234
+from pkg4 import m3
+import pkg9.pkg127.pkg1658.m5825
+from pkg7.pkg103.pkg1350 import m3433
+import pkg4.pkg54.pkg706.m4873
+
+
+def helper_5992_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5992_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,61 @@
+"""Module 10161."""
+import pkg11.pkg150.pkg1958.m1957
+from pkg2.pkg28.pkg371 import m370
+import pkg3.pkg42.m41
+from pkg8.pkg115.pkg1503 import m7754
+import pkg1.pkg24.pkg319.m4486
+from pkg2.pkg34 import m33
+from . import m3909
+from pkg3.pkg43.pkg572 import m571
+import pkg9.pkg130.pkg1697.m1696
+from pkg11.pkg146 import m145
+import pkg7.pkg96.m95
+
+
+def helper_10161_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10161_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_10161_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_10161_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_10161_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_10161_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10161_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
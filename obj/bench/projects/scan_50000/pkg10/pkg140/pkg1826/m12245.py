@@ -0,0 +1,53 @@
+"""Module 12245."""
+from . import m3909
+from pkg3.pkg48.pkg631 import m630
+import pkg2.pkg29.m28
+from pkg1.pkg20.pkg265 import m264
+import pkg7.pkg97.pkg1267.m1266
+from pkg2.pkg33.pkg435 import m6686
+from . import m8077
+from pkg4.pkg61.pkg794 import m7045
+import pkg1.m0
+from pkg3.pkg43.pkg568 import m2651
+
+
+def helper_12245_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12245_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_12245_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_12245_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_12245_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_12245_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
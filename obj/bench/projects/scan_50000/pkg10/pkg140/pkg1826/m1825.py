@@ -0,0 +1,25 @@
+"""Module 1825."""
+import pkg3.m2
+from pkg1.pkg17.pkg232 import m231
+import pkg3.pkg45.m44
+from pkg4 import m3
+import pkg1.pkg21.pkg275.m274
+from pkg1 import m0
+import pkg2.pkg30.pkg401.m400
+from pkg2 import m1
+import pkg3.pkg46.m45
+from pkg2.pkg30.pkg392 import m391
+
+
+def helper_1825_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1825_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
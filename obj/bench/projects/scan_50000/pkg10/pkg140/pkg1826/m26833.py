@@ -0,0 +1,31 @@
+"""Module 26833."""
+import pkg1.pkg16.pkg216.m215
+from pkg4.pkg63.pkg821 import m11240
+import pkg2.pkg29.pkg385.m2468
+from pkg1 import m0
+import pkg4.pkg63.pkg826.m825
+from pkg10.pkg133.pkg1734 import m10069
+import pkg11.pkg149.pkg1939.m4022
+from pkg2.pkg30 import m29
+import pkg9.pkg123.pkg1611.m22450
+
+
+def helper_26833_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_26833_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_26833_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
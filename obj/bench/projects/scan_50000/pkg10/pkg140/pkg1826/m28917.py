@@ -0,0 +1,44 @@
+"""Module 28917."""
+import pkg4.pkg65.pkg856.m7107
+from pkg4.pkg53.pkg690 import m689
+import pkg6.pkg86.pkg1131.m11550
+from . import m10161
+import pkg10.pkg133.m12636
+from pkg7.pkg92.pkg1207 import m26214
+import pkg4.pkg56.pkg741.m9076
+from pkg5.pkg72.pkg944 import m9279
+
+
+def helper_28917_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_28917_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_28917_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_28917_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_28917_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
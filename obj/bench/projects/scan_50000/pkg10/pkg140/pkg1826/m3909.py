@@ -0,0 +1,9 @@
+"""Module 3909."""
+import pkg3.pkg47.pkg612.m611
+
+
+def helper_3909_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,39 @@
+"""Module 8077."""
+import pkg5.pkg66.m65
+from pkg11.pkg145.pkg1895 import m1894
+import pkg8.pkg113.pkg1478.m1477
+from pkg11.pkg156 import m155
+import pkg6.pkg80.pkg1052.m1051
+from pkg1 import m0
+import pkg8.pkg108.pkg1410.m5577
+from pkg10.pkg134 import m133
+import pkg1.pkg22.pkg291.m2374
+from pkg9.pkg126.pkg1644 import m7895
+
+
+def helper_8077_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8077_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8077_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8077_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
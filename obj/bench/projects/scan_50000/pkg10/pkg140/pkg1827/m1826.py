@@ -0,0 +1,33 @@
+"""Module 1826."""
+import pkg10.pkg136.pkg1781.m1780
+from pkg9.pkg129.pkg1682 import m1681
+import pkg2.m1
+from pkg1 import m0
+import pkg6.pkg84.pkg1096.m1095
+from pkg3.pkg49.pkg649 import m648
+import pkg13.m12
+from pkg5 import m4
+import pkg1.pkg20.pkg264.m263
+from pkg1.pkg16.pkg209 import m208
+import pkg6.pkg79.pkg1040.m1039
+
+
+def helper_1826_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1826_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1826_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
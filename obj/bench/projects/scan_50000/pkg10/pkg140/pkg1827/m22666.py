@@ -0,0 +1,23 @@
+"""Module 22666."""
+import pkg6.pkg80.pkg1044.m1043
+from pkg3.pkg52.pkg682 import m17353
+import pkg6.pkg88.pkg1150.m1149
+from pkg3.pkg48 import m4215
+import pkg9.pkg119.pkg1551.m3634
+from pkg2.pkg35 import m34
+import pkg8.pkg110.pkg1443.m13946
+from . import m1826
+
+
+def helper_22666_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_22666_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
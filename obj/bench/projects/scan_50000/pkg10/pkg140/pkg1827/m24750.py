@@ -0,0 +1,40 @@
+"""Module 24750."""
+import pkg1.pkg19.pkg248.m8583
+from pkg7.pkg100 import m8435
+import pkg7.pkg103.pkg1342.m24265
+from pkg10.pkg136.pkg1780 import m3863
+import pkg1.pkg16.m15
+from pkg1.pkg20 import m19
+import pkg1.pkg17.pkg234.m233
+from pkg4.pkg55.pkg727 import m11146
+import pkg13.pkg170.m21009
+from pkg5.pkg68.pkg896 import m895
+from . import m3910
+
+
+def helper_24750_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_24750_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_24750_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_24750_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
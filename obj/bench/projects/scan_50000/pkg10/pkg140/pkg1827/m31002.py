@@ -0,0 +1,17 @@
+"""Module 31002."""
+import pkg7.pkg103.m102
+from pkg1 import m0
+
+
+def helper_31002_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_31002_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
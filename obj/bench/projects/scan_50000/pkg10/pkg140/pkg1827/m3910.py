@@ -0,0 +1,17 @@
+"""Module 3910."""
+import pkg6.pkg80.pkg1049.m1048
+from pkg3.pkg44.pkg574 import m573
+import pkg13.pkg180.m179
+from pkg1 import m0
+import pkg7.pkg92.pkg1204.m3287
+from pkg9.pkg126.pkg1644 import m1643
+import pkg4.pkg59.m58
+from pkg1.pkg24.pkg321 import m320
+import pkg2.pkg36.pkg473.m472
+
+
+def helper_3910_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,32 @@
+"""Module 16415."""
+import pkg9.pkg125.pkg1627.m1626
+from pkg12.pkg158.pkg2064 import m10399
+import pkg6.pkg80.pkg1042.m1041
+from pkg9.pkg123 import m122
+import pkg9.pkg122.pkg1587.m1586
+from pkg11.pkg145.pkg1897 import m1896
+import pkg1.pkg25.pkg337.m336
+from . import m10163
+import pkg8.pkg105.pkg1374.m3457
+from pkg12.pkg157.pkg2043 import m8294
+
+
+def helper_16415_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16415_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_16415_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,5 @@
+"""Module 1827."""
+import pkg11.m10
+from pkg9.pkg126.pkg1643 import m1642
+import pkg5.pkg72.pkg943.m942
+from pkg2.pkg29.pkg381 import m380
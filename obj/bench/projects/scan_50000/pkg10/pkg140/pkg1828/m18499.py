@@ -0,0 +1,53 @@
+"""Module 18499."""
+import pkg2.pkg30.m29
+from pkg1.pkg14 import m12517
+import pkg6.pkg88.m87
+from . import m8079
+import pkg5.pkg66.pkg868.m867
+from pkg9.pkg129 import m128
+import pkg9.pkg123.pkg1600.m1599
+from pkg9.pkg127.pkg1652 import m9987
+import pkg1.pkg19.pkg260.m259
+from pkg2 import m1
+
+
+def helper_18499_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_18499_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_18499_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_18499_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_18499_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_18499_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
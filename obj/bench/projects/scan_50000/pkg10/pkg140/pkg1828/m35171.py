@@ -0,0 +1,21 @@
+"""Module 35171."""
+import pkg1.m0
+from . import m10163
+import pkg9.pkg126.m31385
+from pkg3.pkg43.pkg570 import m15157
+import pkg4.pkg57.pkg746.m4913
+from pkg1.pkg17.pkg233 import m2316
+
+
+def helper_35171_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35171_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
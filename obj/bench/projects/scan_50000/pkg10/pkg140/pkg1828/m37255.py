@@ -0,0 +1,18 @@
+"""Module 37255."""
+import pkg5.pkg74.pkg972.m3055
+from pkg1.pkg18.pkg238 import m2321
+import pkg11.pkg155.m2238
+
+
+def helper_37255_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37255_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 39339."""
+import pkg6.pkg89.pkg1169.m3252
+from . import m12247
+import pkg7.pkg96.pkg1260.m22099
+from pkg10.pkg141.pkg1838 import m20593
+import pkg10.pkg133.pkg1738.m39249
+from . import m3911
+import pkg4.pkg56.pkg737.m736
+from pkg11.pkg146 import m145
+from . import m31003
+from pkg8.pkg107 import m106
+import pkg4.pkg55.m54
+
+
+def helper_39339_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39339_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 47675."""
+import pkg5.pkg72.pkg938.m9273
+from pkg10.pkg133.pkg1731 import m7982
+import pkg6.pkg85.pkg1112.m7363
+from pkg6.pkg88.pkg1147 import m1146
+import pkg1.pkg23.m22
+from pkg3.pkg43.pkg567 import m10986
+import pkg6.pkg85.pkg1114.m30289
+from . import m12247
+import pkg11.pkg150.pkg1957.m1956
+from pkg6.pkg80.pkg1046 import m38557
+import pkg12.pkg158.pkg2065.m4148
+
+
+def helper_47675_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_47675_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,10 @@
+"""Module 12248."""
+import pkg8.pkg113.pkg1479.m5646
+from pkg5 import m4
+
+
+def helper_12248_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
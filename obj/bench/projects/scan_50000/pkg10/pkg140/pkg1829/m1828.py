@@ -0,0 +1,38 @@
+"""Module 1828."""
+import pkg9.pkg118.pkg1544.m1543
+from pkg10.pkg134.pkg1743 import m1742
+import pkg5.pkg72.m71
+from pkg8 import m7
+import pkg1.pkg25.pkg334.m333
+from pkg1.pkg16 import m15
+import pkg6.pkg81.m80
+from pkg2.pkg31.pkg416 import m415
+import pkg3.pkg52.pkg687.m686
+
+
+def helper_1828_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1828_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1828_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1828_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
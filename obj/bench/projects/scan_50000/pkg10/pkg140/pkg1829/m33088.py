@@ -0,0 +1,40 @@
+"""Module 33088."""
+import pkg11.pkg151.pkg1970.m18641
+from pkg2.pkg32.pkg426 import m425
+from . import m26836
+from pkg9.pkg125.pkg1634 import m3717
+import pkg10.pkg137.pkg1791.m1790
+from pkg8.pkg114.pkg1491 import m16078
+import pkg6.pkg81.pkg1060.m9395
+from pkg1.pkg23.pkg310 import m309
+import pkg1.pkg20.pkg270.m31529
+from . import m18500
+import pkg13.pkg171.m170
+
+
+def helper_33088_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_33088_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_33088_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_33088_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,22 @@
+"""Module 35172."""
+import pkg1.pkg17.m16
+from pkg1.pkg21.pkg278 import m277
+from . import m33088
+from pkg6.pkg83.pkg1084 import m5251
+import pkg5.pkg77.pkg1004.m30179
+from pkg5.pkg76.pkg990 import m3073
+import pkg2.m1
+
+
+def helper_35172_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35172_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,23 @@
+"""Module 8080."""
+from . import m1828
+from . import m5996
+import pkg2.pkg27.m26
+from pkg12.pkg157.pkg2043 import m2042
+import pkg4.pkg58.pkg757.m7008
+from pkg9.pkg128.pkg1666 import m3749
+import pkg4.pkg64.pkg844.m843
+from pkg7.pkg95 import m94
+
+
+def helper_8080_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8080_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
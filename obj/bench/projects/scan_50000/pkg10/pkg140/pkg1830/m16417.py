@@ -0,0 +1,18 @@
+"""Module 16417."""
+import pkg6.m5
+from pkg11.pkg154.pkg2015 import m12434
+import pkg5.pkg69.pkg901.m7152
+from pkg2.pkg31.pkg413 import m412
+from . import m10165
+from . import m8081
+import pkg7.pkg92.pkg1201.m3284
+from pkg9.pkg122 import m121
+import pkg1.pkg21.pkg286.m10705
+from . import m5997
+
+
+def helper_16417_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,38 @@
+"""Module 24753."""
+import pkg3.pkg40.pkg533.m17204
+from . import m10165
+import pkg6.pkg91.m8426
+from . import m18501
+import pkg7.pkg99.pkg1300.m1299
+from pkg1 import m0
+from . import m8081
+from pkg9.pkg126.pkg1640 import m3723
+from . import m12249
+
+
+def helper_24753_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_24753_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_24753_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_24753_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
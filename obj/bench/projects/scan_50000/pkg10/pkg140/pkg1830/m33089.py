@@ -0,0 +1,27 @@
+"""Module 33089."""
+from . import m10165
+from pkg1.pkg15.pkg203 import m23126
+from . import m28921
+from pkg1.pkg16.pkg212 import m4379
+import pkg6.pkg87.pkg1144.m1143
+
+
+def helper_33089_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_33089_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_33089_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
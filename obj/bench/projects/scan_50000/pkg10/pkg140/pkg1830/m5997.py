@@ -0,0 +1,17 @@
+"""Module 5997."""
+import pkg4.pkg60.pkg791.m790
+from pkg8.pkg116 import m115
+
+
+def helper_5997_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5997_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
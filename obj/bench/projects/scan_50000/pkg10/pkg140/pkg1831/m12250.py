@@ -0,0 +1,38 @@
+"""Module 12250."""
+import pkg1.pkg24.m23
+from . import m5998
+import pkg8.pkg108.pkg1415.m1414
+from pkg4 import m3
+import pkg4.pkg62.pkg818.m2901
+from pkg6.pkg80.pkg1049 import m3132
+import pkg2.pkg27.pkg361.m360
+from pkg2.pkg38.pkg500 import m6751
+import pkg9.pkg129.pkg1685.m3768
+
+
+def helper_12250_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12250_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_12250_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_12250_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 16418."""
+import pkg11.pkg146.pkg1910.m8161
+from pkg2.pkg32.pkg422 import m421
+import pkg2.pkg27.pkg360.m359
+from pkg2.pkg32.pkg429 import m428
+import pkg6.pkg90.m89
+from . import m3914
+import pkg6.pkg87.pkg1135.m15722
+from pkg2 import m1
+import pkg2.pkg36.pkg473.m6724
+from pkg2.pkg37.pkg488 import m487
+import pkg5.pkg71.pkg931.m930
+from pkg2.pkg30 import m29
+
+
+def helper_16418_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
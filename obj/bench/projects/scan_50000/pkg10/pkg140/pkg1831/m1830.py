@@ -0,0 +1,26 @@
+"""Module 1830."""
+import pkg3.pkg48.pkg636.m635
+from pkg1 import m0
+import pkg5.pkg72.pkg947.m946
+from pkg9.pkg120.pkg1573 import m1572
+
+
+def helper_1830_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1830_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1830_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,38 @@
+"""Module 18502."""
+import pkg11.pkg147.pkg1917.m4000
+from pkg2.pkg36.pkg480 import m479
+import pkg8.pkg109.pkg1429.m5596
+from pkg6.pkg85.pkg1111 import m1110
+import pkg4.pkg65.pkg850.m13353
+from pkg4.pkg58.pkg765 import m13268
+import pkg6.pkg85.pkg1109.m1108
+from pkg13.pkg182 import m181
+import pkg10.pkg141.pkg1846.m16433
+
+
+def helper_18502_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_18502_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_18502_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_18502_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 20586."""
+import pkg11.pkg148.pkg1934.m16521
+from pkg4.pkg58.pkg764 import m4931
+from . import m18502
+from pkg6.pkg88.pkg1147 import m13650
+import pkg1.pkg20.pkg270.m269
+from pkg6.pkg85.pkg1113 import m5280
+import pkg4.pkg57.pkg754.m753
+from pkg8.pkg107 import m106
+from . import m1830
+from . import m16418
+
+
+def helper_20586_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
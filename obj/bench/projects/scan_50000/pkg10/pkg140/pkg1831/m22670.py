@@ -0,0 +1,52 @@
+"""Module 22670."""
+import pkg2.pkg31.m30
+from pkg3 import m2
+import pkg5.pkg67.pkg879.m5046
+from pkg1.pkg25.pkg336 import m4503
+import pkg6.pkg82.pkg1071.m3154
+from pkg5.pkg74 import m73
+import pkg1.pkg20.pkg271.m19026
+from pkg2 import m1
+import pkg9.pkg120.pkg1567.m7818
+
+
+def helper_22670_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_22670_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_22670_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_22670_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_22670_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_22670_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
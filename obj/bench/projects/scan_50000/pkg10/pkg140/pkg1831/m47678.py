@@ -0,0 +1,53 @@
+"""Module 47678."""
+import pkg4.pkg53.pkg698.m15285
+from . import m43510
+import pkg8.pkg117.pkg1532.m11951
+from . import m26838
+import pkg3.pkg49.pkg638.m637
+from pkg6.pkg80.pkg1047 import m5214
+from . import m8082
+from pkg3.pkg40.pkg525 import m27616
+from . import m18502
+from pkg9.pkg130.pkg1695 import m22534
+
+
+def helper_47678_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_47678_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_47678_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_47678_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_47678_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_47678_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,41 @@
+"""Module 49762."""
+import pkg7.pkg94.pkg1231.m15818
+from . import m3914
+import pkg1.pkg14.pkg191.m2274
+from pkg12.pkg158.pkg2067 import m4150
+import pkg3.pkg45.m44
+from pkg1.pkg17.pkg231 import m230
+from . import m14334
+from pkg4.pkg53.pkg698 import m697
+from . import m31006
+from pkg6.pkg80.pkg1050 import m11469
+import pkg1.pkg15.pkg200.m2283
+from pkg1.pkg20 import m19
+
+
+def helper_49762_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_49762_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_49762_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_49762_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,32 @@
+"""Module 5998."""
+import pkg9.pkg130.m129
+from pkg5.pkg74.pkg975 import m3058
+import pkg1.m0
+from pkg11.pkg151.pkg1965 import m4048
+import pkg9.pkg127.pkg1659.m3742
+from pkg11 import m10
+from . import m3914
+from pkg9.pkg121.pkg1583 import m5750
+import pkg2.m1
+from pkg8.pkg114.pkg1484 import m1483
+
+
+def helper_5998_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_5998_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_5998_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
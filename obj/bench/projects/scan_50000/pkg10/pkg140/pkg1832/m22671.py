@@ -0,0 +1,47 @@
+"""Module 22671."""
+import pkg7.pkg96.pkg1256.m1255
+from pkg1.pkg19.pkg253 import m8588
+import pkg11.pkg149.pkg1950.m1949
+from pkg1.pkg23.pkg301 import m19056
+import pkg6.pkg85.pkg1116.m21955
+from pkg11.pkg144.pkg1879 import m6046
+from . import m20587
+from . import m5999
+import pkg10.pkg143.pkg1861.m16448
+from pkg1 import m0
+from . import m8083
+
+
+def helper_22671_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_22671_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_22671_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_22671_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_22671_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
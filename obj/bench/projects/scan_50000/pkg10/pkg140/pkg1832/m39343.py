@@ -0,0 +1,62 @@
+"""Module 39343."""
+import pkg4.pkg65.pkg858.m11277
+from pkg3.pkg47.pkg613 import m2696
+from . import m16419
+from pkg1.pkg22.pkg293 import m292
+import pkg7.pkg95.pkg1237.m9572
+from pkg2.pkg30.pkg396 import m395
+import pkg9.pkg125.pkg1631.m3714
+from pkg6.pkg85.pkg1110 import m5277
+import pkg5.pkg78.pkg1018.m13521
+from pkg7.pkg93.pkg1218 import m38729
+from . import m8083
+from pkg1.pkg22 import m21
+
+
+def helper_39343_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39343_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_39343_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_39343_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_39343_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_39343_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39343_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
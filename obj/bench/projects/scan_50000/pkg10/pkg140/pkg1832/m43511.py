@@ -0,0 +1,26 @@
+"""Module 43511."""
+import pkg5.pkg68.pkg897.m896
+from pkg5.pkg76.pkg994 import m28085
+from . import m39343
+from pkg2.pkg28.pkg372 import m371
+import pkg2.pkg27.m26
+from pkg7.pkg101.pkg1323 import m9658
+import pkg7.pkg96.pkg1259.m3342
+from pkg2.pkg35.pkg456 import m2539
+import pkg10.pkg137.pkg1791.m12210
+from pkg5.pkg68.pkg886 import m885
+import pkg1.m0
+
+
+def helper_43511_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_43511_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,35 @@
+"""Module 49763."""
+import pkg6.pkg86.pkg1122.m19877
+from pkg10.pkg135.pkg1763 import m3846
+import pkg1.pkg20.m19
+from pkg6.pkg90.pkg1182 import m15769
+import pkg5.pkg67.pkg874.m7125
+from pkg3.pkg43.pkg568 import m19323
+
+
+def helper_49763_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_49763_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_49763_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_49763_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,9 @@
+"""Module 5999."""
+import pkg3.pkg46.pkg606.m605
+
+
+def helper_5999_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
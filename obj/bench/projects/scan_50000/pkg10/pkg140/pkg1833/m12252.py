@@ -0,0 +1,34 @@
+"""Module 12252."""
+import pkg1.pkg25.pkg328.m327
+from pkg1.pkg24 import m23
+import pkg7.pkg93.pkg1219.m9554
+from pkg5.pkg74.pkg972 import m9307
+import pkg8.pkg113.pkg1478.m5645
+from . import m6000
+import pkg2.pkg37.pkg483.m10902
+from pkg6.pkg86.pkg1129 import m3212
+import pkg9.pkg122.pkg1597.m1596
+from pkg1 import m0
+import pkg2.pkg36.pkg480.m4647
+from pkg4.pkg64 import m63
+
+
+def helper_12252_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12252_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_12252_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,22 @@
+"""Module 37260."""
+import pkg2.pkg36.m35
+from . import m8084
+import pkg4.pkg60.pkg785.m784
+from pkg11.pkg152 import m151
+import pkg10.m9
+from . import m3916
+import pkg8.pkg111.pkg1444.m1443
+
+
+def helper_37260_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37260_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
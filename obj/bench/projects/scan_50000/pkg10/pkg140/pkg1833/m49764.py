@@ -0,0 +1,26 @@
+"""Module 49764."""
+import pkg5.pkg66.pkg859.m858
+from pkg13.pkg178 import m177
+import pkg9.pkg128.pkg1673.m3756
+from pkg2.pkg28.pkg367 import m21206
+import pkg6.pkg87.pkg1137.m3220
+from . import m10168
+from . import m39344
+from pkg7.pkg103.pkg1348 import m13851
+import pkg1.pkg14.pkg193.m192
+from pkg7.pkg98.pkg1275 import m5442
+import pkg8.pkg107.pkg1398.m15985
+
+
+def helper_49764_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_49764_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
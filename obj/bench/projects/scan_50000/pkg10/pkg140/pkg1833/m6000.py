@@ -0,0 +1,9 @@
+"""Module 6000."""
+import pkg5.pkg76.m2159
+
+
+def helper_6000_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,33 @@
+"""Module 10560."""
+import pkg8.pkg114.m113
+from pkg4.pkg65.pkg855 import m854
+import pkg1.pkg17.pkg222.m221
+from . import m4308
+import pkg1.pkg24.pkg323.m6574
+from . import m8476
+import pkg1.m0
+from pkg10.pkg139.pkg1812 import m3895
+from . import m6392
+from pkg4.pkg64.pkg835 import m834
+from . import m140
+
+
+def helper_10560_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10560_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_10560_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,33 @@
+"""Module 14728."""
+import pkg5.pkg70.pkg916.m5083
+from pkg1.pkg26.pkg339 import m8674
+from . import m140
+from . import m6392
+import pkg1.m0
+from pkg4.pkg58 import m8393
+import pkg8.pkg108.pkg1409.m13912
+from pkg10.pkg138.pkg1802 import m3885
+import pkg13.pkg173.m8508
+from pkg4.pkg63.pkg828 import m827
+import pkg7.pkg94.pkg1227.m9562
+
+
+def helper_14728_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14728_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_14728_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
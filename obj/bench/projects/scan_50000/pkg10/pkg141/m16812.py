@@ -0,0 +1,45 @@
+"""Module 16812."""
+import pkg7.pkg102.pkg1337.m3420
+from pkg3.pkg51.pkg675 import m15262
+import pkg8.pkg116.pkg1521.m3604
+from pkg9.pkg123.pkg1608 import m1607
+import pkg8.pkg117.pkg1524.m3607
+from pkg11.pkg151.pkg1973 import m4056
+import pkg11.pkg155.pkg2018.m8269
+from pkg9.pkg130.pkg1700 import m3783
+import pkg4.pkg64.pkg835.m15422
+
+
+def helper_16812_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16812_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_16812_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_16812_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_16812_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,29 @@
+"""Module 37652."""
+import pkg12.pkg164.m163
+from pkg3 import m2
+import pkg13.m12
+from pkg7.pkg103.pkg1348 import m15935
+import pkg7.pkg94.pkg1225.m9560
+from pkg10.pkg135.pkg1757 import m1756
+import pkg5.pkg75.pkg976.m17647
+
+
+def helper_37652_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37652_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_37652_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
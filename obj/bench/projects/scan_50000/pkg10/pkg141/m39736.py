@@ -0,0 +1,10 @@
+"""Module 39736."""
+import pkg3.m2
+from pkg4 import m3
+import pkg5.pkg78.pkg1016.m36443
+from pkg3.pkg52.pkg684 import m683
+import pkg5.pkg73.pkg951.m950
+from pkg3.pkg43 import m42
+from . import m6392
+from pkg1 import m0
+from . import m14728
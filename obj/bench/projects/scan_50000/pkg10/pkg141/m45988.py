@@ -0,0 +1,44 @@
+"""Module 45988."""
+import pkg2.pkg39.pkg509.m6760
+from . import m37652
+import pkg8.pkg106.pkg1382.m20137
+from pkg6 import m5
+import pkg8.pkg105.pkg1376.m7627
+from pkg12.pkg157.pkg2046 import m4129
+from . import m2224
+from pkg2.pkg34 import m33
+
+
+def helper_45988_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_45988_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_45988_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_45988_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_45988_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 10169."""
+import pkg6.pkg82.pkg1068.m3151
+from pkg7.pkg94.pkg1226 import m1225
+
+
+def helper_10169_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10169_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 12253."""
+import pkg11.pkg149.pkg1944.m4027
+from pkg9.pkg129.pkg1684 import m1683
+import pkg10.pkg143.pkg1870.m1869
+
+
+def helper_12253_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12253_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,33 @@
+"""Module 26841."""
+from . import m16421
+from pkg5.pkg74.pkg968 import m3051
+import pkg10.pkg135.pkg1757.m20512
+from pkg2.pkg27.pkg353 import m352
+from . import m1833
+from . import m22673
+import pkg1.m0
+from pkg8.pkg113.pkg1478 import m1477
+import pkg7.pkg95.m25102
+from pkg4.pkg58 import m57
+import pkg5.pkg75.pkg977.m17648
+
+
+def helper_26841_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_26841_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_26841_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
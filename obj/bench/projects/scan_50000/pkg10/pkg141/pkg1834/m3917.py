@@ -0,0 +1,22 @@
+"""Module 3917."""
+import pkg5.pkg73.pkg961.m3044
+from pkg3.pkg50 import m49
+import pkg3.pkg52.m51
+from pkg2.pkg33.pkg433 import m432
+import pkg12.pkg158.pkg2055.m2054
+from pkg10.pkg133.pkg1731 import m1730
+import pkg4.pkg60.pkg784.m783
+
+
+def helper_3917_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3917_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,32 @@
+"""Module 39345."""
+import pkg2.pkg35.pkg467.m466
+from . import m37261
+import pkg2.pkg36.pkg469.m2552
+from pkg2.pkg30.pkg395 import m12898
+import pkg7.pkg93.pkg1210.m1209
+from pkg6.pkg86.pkg1121 import m5288
+import pkg3.pkg43.pkg563.m562
+from pkg4.pkg53.pkg691 import m25698
+import pkg4.pkg65.pkg852.m25859
+from pkg3.pkg51.pkg669 import m34012
+
+
+def helper_39345_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39345_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_39345_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
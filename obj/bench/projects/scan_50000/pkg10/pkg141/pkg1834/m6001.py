@@ -0,0 +1,53 @@
+"""Module 6001."""
+import pkg4.m3
+from pkg4.pkg60 import m59
+import pkg2.pkg34.pkg445.m444
+from pkg3.pkg45.pkg595 import m2678
+import pkg4.pkg55.pkg728.m727
+from pkg7.pkg100.pkg1305 import m1304
+import pkg8.pkg109.pkg1420.m1419
+from pkg1.pkg25.pkg333 import m4500
+import pkg3.pkg51.m50
+from pkg6.pkg89 import m88
+
+
+def helper_6001_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6001_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6001_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6001_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_6001_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_6001_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
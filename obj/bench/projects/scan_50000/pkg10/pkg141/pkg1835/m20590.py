@@ -0,0 +1,16 @@
+"""Module 20590."""
+from . import m10170
+from . import m18506
+import pkg1.m0
+from pkg10.pkg141.pkg1846 import m14349
+import pkg1.pkg18.pkg244.m6495
+from pkg7.pkg94 import m2177
+import pkg7.pkg93.pkg1219.m11638
+from . import m1834
+
+
+def helper_20590_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,47 @@
+"""Module 22674."""
+import pkg5.pkg76.pkg994.m19749
+from . import m3918
+import pkg1.m0
+from pkg6.pkg82.pkg1072 import m1071
+import pkg8.pkg110.pkg1434.m7685
+from pkg8.pkg106.pkg1388 import m15975
+import pkg10.pkg132.pkg1727.m12146
+from pkg8.pkg110 import m10529
+import pkg5.pkg78.pkg1021.m3104
+from pkg11.pkg144.pkg1873 import m8124
+import pkg5.pkg73.pkg953.m952
+
+
+def helper_22674_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_22674_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_22674_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_22674_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_22674_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,13 @@
+"""Module 33094."""
+import pkg3.pkg40.pkg522.m521
+from pkg4.pkg65.pkg847 import m9182
+import pkg1.pkg16.pkg217.m216
+from pkg2.pkg28.pkg365 import m12868
+from . import m16422
+
+
+def helper_33094_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
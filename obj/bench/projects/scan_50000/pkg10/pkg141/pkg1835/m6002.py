@@ -0,0 +1,24 @@
+"""Module 6002."""
+import pkg7.pkg98.m97
+from pkg1.pkg20.pkg271 import m270
+import pkg1.pkg20.pkg264.m4431
+from . import m3918
+import pkg3.m2
+from pkg4.pkg56.pkg731 import m4898
+from . import m1834
+from pkg2.pkg28.pkg369 import m368
+import pkg1.pkg24.pkg314.m313
+
+
+def helper_6002_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6002_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
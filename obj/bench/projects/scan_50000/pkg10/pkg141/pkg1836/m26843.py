@@ -0,0 +1,17 @@
+"""Module 26843."""
+import pkg11.pkg151.pkg1969.m1968
+from pkg1.pkg16.pkg218 import m2301
+import pkg2.pkg33.pkg433.m432
+from . import m22675
+import pkg7.pkg97.pkg1262.m1261
+from . import m10171
+import pkg6.pkg88.pkg1157.m1156
+from . import m6003
+import pkg10.pkg137.pkg1782.m10117
+
+
+def helper_26843_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
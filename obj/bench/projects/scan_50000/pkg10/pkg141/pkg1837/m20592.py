@@ -0,0 +1,46 @@
+"""Module 20592."""
+import pkg2.pkg27.m26
+from . import m8088
+import pkg1.pkg21.pkg284.m283
+from pkg3.pkg46.pkg605 import m4772
+import pkg9.pkg129.pkg1678.m12097
+from pkg10.pkg139 import m138
+import pkg9.pkg122.pkg1589.m5756
+from pkg7.pkg92.pkg1200 import m13703
+import pkg12.pkg158.pkg2066.m10401
+from pkg6.pkg80.pkg1048 import m11467
+
+
+def helper_20592_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_20592_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_20592_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_20592_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_20592_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,30 @@
+"""Module 22676."""
+from . import m18508
+from pkg6.pkg81.pkg1063 import m3146
+import pkg2.m1
+from . import m3920
+from . import m6004
+from pkg1 import m0
+import pkg10.pkg141.pkg1843.m8094
+from pkg11.pkg155.pkg2020 import m4103
+
+
+def helper_22676_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_22676_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_22676_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 37264."""
+import pkg7.pkg96.pkg1258.m1257
+from . import m26844
+import pkg6.pkg81.pkg1060.m3143
+from pkg6.pkg91.pkg1193 import m1192
+
+
+def helper_37264_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37264_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
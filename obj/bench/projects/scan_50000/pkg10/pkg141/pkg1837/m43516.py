@@ -0,0 +1,13 @@
+"""Module 43516."""
+from . import m12256
+from pkg7.pkg100.pkg1310 import m1309
+import pkg7.pkg93.pkg1211.m3294
+from pkg5.pkg74.pkg969 import m36396
+import pkg1.pkg21.pkg285.m8620
+
+
+def helper_43516_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
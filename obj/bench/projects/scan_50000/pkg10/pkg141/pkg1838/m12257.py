@@ -0,0 +1,10 @@
+"""Module 12257."""
+import pkg6.m5
+from pkg8.pkg117.pkg1531 import m5698
+
+
+def helper_12257_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 14341."""
+from . import m8089
+from pkg3.pkg44 import m43
+import pkg1.pkg18.m17
+
+
+def helper_14341_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14341_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
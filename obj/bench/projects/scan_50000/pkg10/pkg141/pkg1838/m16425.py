@@ -0,0 +1,27 @@
+"""Module 16425."""
+import pkg1.pkg23.pkg307.m2390
+from pkg4 import m3
+from . import m14341
+from pkg8.pkg113.pkg1476 import m5643
+from . import m10173
+
+
+def helper_16425_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16425_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_16425_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
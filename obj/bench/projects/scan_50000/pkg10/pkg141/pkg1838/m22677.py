@@ -0,0 +1,40 @@
+"""Module 22677."""
+import pkg5.pkg78.m2161
+from pkg3.pkg50.pkg660 import m659
+import pkg3.pkg51.pkg675.m15262
+from . import m16425
+import pkg1.pkg23.pkg300.m2383
+from pkg8.pkg117.pkg1530 import m7781
+import pkg10.pkg143.pkg1872.m16459
+from pkg4.pkg53.pkg692 import m2775
+import pkg1.m0
+from pkg5.pkg75.pkg985 import m17656
+import pkg9.pkg125.pkg1630.m1629
+
+
+def helper_22677_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_22677_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_22677_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_22677_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 24761."""
+import pkg8.pkg109.m12612
+from pkg7.pkg104.pkg1361 import m3444
+import pkg11.pkg147.pkg1912.m10247
+from pkg5.pkg72.pkg949 import m7200
+import pkg11.pkg145.pkg1888.m1887
+from pkg2.pkg36.pkg476 import m475
+import pkg4.pkg56.m55
+from pkg4.pkg53.pkg698 import m2781
+import pkg9.pkg128.m16799
+
+
+def helper_24761_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
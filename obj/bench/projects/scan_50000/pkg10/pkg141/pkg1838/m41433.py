@@ -0,0 +1,18 @@
+"""Module 41433."""
+import pkg3.pkg42.pkg551.m550
+from pkg6.pkg89.pkg1169 import m13672
+import pkg11.pkg150.pkg1962.m14465
+from pkg4.pkg61.pkg798 import m797
+import pkg3.pkg51.pkg664.m31923
+from pkg2.pkg27.pkg364 import m29539
+import pkg7.pkg97.pkg1268.m3351
+from pkg1 import m0
+import pkg5.pkg71.pkg936.m38447
+from pkg7.pkg100 import m99
+
+
+def helper_41433_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 10174."""
+from . import m8090
+from . import m6006
+from . import m1838
+from pkg1.pkg23 import m22
+import pkg7.pkg98.pkg1276.m3359
+from pkg4 import m3
+import pkg4.pkg53.m2136
+from pkg5.pkg69.pkg902 import m901
+import pkg4.pkg59.pkg780.m9115
+from pkg4.pkg59.pkg771 import m9106
+
+
+def helper_10174_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10174_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
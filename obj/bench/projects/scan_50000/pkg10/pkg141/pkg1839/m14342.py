@@ -0,0 +1,29 @@
+"""Module 14342."""
+from . import m6006
+from pkg5.pkg72.pkg945 import m11364
+import pkg5.m4
+from pkg2.pkg33.pkg430 import m429
+import pkg5.pkg66.pkg860.m11279
+from . import m3922
+import pkg11.pkg155.m154
+
+
+def helper_14342_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14342_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_14342_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
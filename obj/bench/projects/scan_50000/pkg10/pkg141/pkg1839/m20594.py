@@ -0,0 +1,27 @@
+"""Module 20594."""
+import pkg7.pkg92.pkg1198.m7449
+from pkg2.pkg28.pkg365 import m2448
+import pkg6.pkg85.pkg1108.m3191
+from pkg8.pkg113.pkg1481 import m3564
+import pkg4.pkg53.pkg692.m9027
+from pkg9.pkg127.pkg1652 import m7903
+import pkg8.m7
+from pkg7.pkg98.pkg1281 import m1280
+import pkg2.pkg30.pkg395.m2478
+from pkg7 import m6
+import pkg2.pkg30.pkg393.m6644
+from pkg2.pkg37.pkg482 import m2565
+
+
+def helper_20594_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_20594_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
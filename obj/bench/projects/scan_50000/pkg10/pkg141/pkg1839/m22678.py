@@ -0,0 +1,32 @@
+"""Module 22678."""
+import pkg1.pkg24.m23
+from . import m10174
+import pkg11.pkg148.pkg1937.m14440
+from pkg1.pkg22 import m21
+from . import m14342
+from . import m6006
+from . import m1838
+from pkg11.pkg155.pkg2028 import m2027
+import pkg9.pkg122.pkg1588.m12007
+from pkg8.pkg107.pkg1403 import m3486
+
+
+def helper_22678_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_22678_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_22678_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
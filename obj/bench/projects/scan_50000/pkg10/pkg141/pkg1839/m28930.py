@@ -0,0 +1,26 @@
+"""Module 28930."""
+import pkg8.pkg116.pkg1520.m1519
+from pkg6.pkg85.pkg1111 import m5278
+from . import m26846
+from . import m8090
+from . import m24762
+from pkg1.pkg14 import m13
+import pkg10.m9
+from pkg2.pkg34.pkg447 import m25454
+import pkg11.pkg156.pkg2032.m18703
+from pkg2.pkg31.pkg413 import m17084
+from . import m12258
+
+
+def helper_28930_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_28930_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 35182."""
+import pkg6.pkg84.pkg1102.m1101
+from . import m31014
+import pkg2.pkg34.pkg449.m6700
+from pkg8 import m7
+
+
+def helper_35182_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35182_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,15 @@
+"""Module 47686."""
+import pkg8.pkg112.pkg1464.m1463
+from . import m16426
+import pkg12.pkg157.pkg2044.m14547
+from pkg6.pkg86 import m85
+import pkg6.pkg82.pkg1078.m36505
+from pkg9.pkg124.pkg1617 import m20372
+import pkg10.pkg132.pkg1718.m45481
+
+
+def helper_47686_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,35 @@
+"""Module 6006."""
+import pkg1.pkg21.m2104
+from pkg1.pkg23.pkg304 import m303
+from . import m1838
+from pkg1.pkg25.pkg330 import m329
+import pkg1.pkg16.pkg221.m220
+from pkg7.pkg99.pkg1299 import m5466
+
+
+def helper_6006_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6006_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6006_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6006_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,35 @@
+"""Module 18511."""
+import pkg1.pkg16.pkg213.m212
+from pkg2 import m1
+import pkg9.m8
+from pkg1.pkg18.pkg246 import m245
+import pkg10.pkg131.pkg1714.m1713
+from . import m12259
+
+
+def helper_18511_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_18511_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_18511_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_18511_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
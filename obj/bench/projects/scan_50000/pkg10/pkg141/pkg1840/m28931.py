@@ -0,0 +1,61 @@
+"""Module 28931."""
+import pkg1.pkg24.pkg313.m312
+from pkg4.pkg59.pkg774 import m4941
+import pkg12.pkg157.pkg2043.m4126
+from pkg2.pkg33.pkg430 import m8765
+from . import m14343
+from pkg5.pkg73.pkg953 import m7204
+import pkg6.pkg80.pkg1044.m5211
+from . import m3923
+import pkg4.pkg63.pkg829.m828
+from pkg1.pkg15.pkg197 import m2280
+from . import m6007
+
+
+def helper_28931_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_28931_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_28931_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_28931_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_28931_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_28931_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_28931_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,46 @@
+"""Module 31015."""
+from . import m3923
+from pkg9 import m8
+import pkg11.pkg146.pkg1910.m6077
+from pkg2.pkg28.pkg370 import m369
+import pkg10.pkg137.pkg1789.m3872
+from pkg1.pkg16.pkg213 import m212
+from . import m20595
+from pkg11.pkg146.pkg1903 import m12322
+import pkg5.pkg74.pkg972.m3055
+from pkg2.pkg34.pkg446 import m445
+
+
+def helper_31015_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_31015_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_31015_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_31015_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_31015_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,12 @@
+"""Module 1840."""
+import pkg6.pkg87.pkg1139.m1138
+from pkg6.pkg82.pkg1070 import m1069
+import pkg8.m7
+from pkg5.pkg67.pkg877 import m876
+
+
+def helper_1840_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,13 @@
+"""Module 24764."""
+from . import m16428
+from pkg11.pkg149.pkg1938 import m16525
+import pkg2.m1
+from pkg4.pkg56.pkg736 import m6987
+import pkg12.pkg168.m2251
+
+
+def helper_24764_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
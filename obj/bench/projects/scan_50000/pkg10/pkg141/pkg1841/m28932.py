@@ -0,0 +1,27 @@
+"""Module 28932."""
+import pkg7.pkg104.m8439
+from . import m1840
+import pkg7.pkg99.pkg1289.m3372
+from pkg5.pkg71 import m70
+from . import m18512
+
+
+def helper_28932_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_28932_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_28932_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
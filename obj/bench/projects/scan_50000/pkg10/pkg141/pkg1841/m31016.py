@@ -0,0 +1,42 @@
+"""Module 31016."""
+import pkg2.pkg35.m6286
+from pkg9.pkg128.pkg1669 import m5836
+import pkg7.pkg103.pkg1342.m5509
+from pkg6.pkg84.pkg1104 import m1103
+import pkg1.pkg15.pkg199.m10618
+from pkg9.pkg119.pkg1555 import m9890
+
+
+def helper_31016_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_31016_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_31016_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_31016_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_31016_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
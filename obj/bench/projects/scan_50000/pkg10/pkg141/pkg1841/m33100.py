@@ -0,0 +1,19 @@
+"""Module 33100."""
+import pkg1.pkg14.pkg190.m189
+from pkg11.pkg151.pkg1965 import m4048
+import pkg1.pkg24.pkg317.m316
+from pkg9 import m8
+import pkg3.pkg51.pkg676.m675
+from . import m3924
+import pkg7.pkg99.pkg1293.m1292
+from pkg2.pkg36.pkg470 import m469
+import pkg6.pkg84.pkg1093.m26100
+from pkg11.pkg146.pkg1902 import m10237
+import pkg2.pkg29.m28
+
+
+def helper_33100_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
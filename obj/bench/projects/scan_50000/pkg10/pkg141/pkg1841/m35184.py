@@ -0,0 +1,34 @@
+"""Module 35184."""
+from . import m1840
+from pkg1.pkg25.pkg329 import m10748
+import pkg6.pkg88.pkg1156.m24079
+from . import m20596
+import pkg1.m0
+from pkg1.pkg23.pkg312 import m2395
+import pkg4.pkg62.pkg807.m2890
+from pkg3.pkg45.pkg597 import m2680
+import pkg2.pkg33.pkg430.m429
+from pkg10.pkg143.pkg1870 import m3953
+from . import m18512
+from pkg7.pkg92.pkg1199 import m1198
+
+
+def helper_35184_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35184_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_35184_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
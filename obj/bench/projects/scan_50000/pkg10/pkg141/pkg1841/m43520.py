@@ -0,0 +1,37 @@
+"""Module 43520."""
+import pkg3.pkg44.pkg583.m582
+from pkg6.pkg91.pkg1190 import m1189
+from . import m6008
+from pkg5.pkg75.pkg977 import m5144
+import pkg11.pkg153.pkg1993.m24916
+from pkg9.pkg118.pkg1538 import m5705
+import pkg2.pkg27.pkg354.m39949
+from pkg4.pkg58.pkg756 import m4923
+
+
+def helper_43520_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_43520_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_43520_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_43520_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,30 @@
+"""Module 47688."""
+import pkg13.m12
+from pkg12.pkg157 import m43920
+from . import m3924
+from pkg4 import m3
+from . import m24764
+from . import m10176
+import pkg4.pkg60.pkg790.m21629
+from . import m45604
+
+
+def helper_47688_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_47688_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_47688_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
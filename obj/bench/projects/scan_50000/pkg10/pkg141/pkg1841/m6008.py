@@ -0,0 +1,32 @@
+"""Module 6008."""
+import pkg3.pkg46.pkg602.m601
+from pkg10.pkg143 import m142
+import pkg7.pkg101.pkg1315.m3398
+from . import m3924
+import pkg1.m0
+from pkg7 import m6
+import pkg7.pkg95.pkg1248.m3331
+from pkg5.pkg69.pkg898 import m2981
+from . import m1840
+from pkg3.pkg50.pkg661 import m660
+
+
+def helper_6008_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6008_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6008_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
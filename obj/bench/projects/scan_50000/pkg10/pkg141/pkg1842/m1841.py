@@ -0,0 +1,19 @@
+"""Module 1841."""
+import pkg1.pkg23.pkg303.m302
+from pkg10 import m9
+import pkg2.m1
+from pkg5.pkg77.pkg1004 import m1003
+
+
+def helper_1841_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1841_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
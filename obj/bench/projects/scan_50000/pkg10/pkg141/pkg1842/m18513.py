@@ -0,0 +1,48 @@
+"""Module 18513."""
+import pkg10.pkg143.pkg1862.m1861
+from . import m16429
+import pkg4.pkg61.pkg803.m4970
+from pkg3.pkg41.pkg544 import m2627
+import pkg12.pkg157.m2240
+from pkg11.pkg156.pkg2040 import m12459
+import pkg5.pkg72.pkg939.m938
+from pkg2.pkg27.pkg360 import m8695
+import pkg1.pkg14.pkg184.m183
+from . import m6009
+from . import m12261
+from pkg1 import m0
+
+
+def helper_18513_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_18513_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_18513_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_18513_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_18513_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
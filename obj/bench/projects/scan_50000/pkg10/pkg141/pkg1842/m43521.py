@@ -0,0 +1,20 @@
+"""Module 43521."""
+import pkg3.pkg49.pkg642.m25649
+from pkg3.pkg46.pkg603 import m6854
+import pkg6.pkg91.pkg1195.m9530
+from . import m28933
+import pkg11.pkg154.pkg2007.m8258
+from pkg11.pkg153.pkg1996 import m16583
+from . import m14345
+from pkg4.pkg56 import m55
+import pkg7.pkg94.pkg1230.m1229
+from pkg2.pkg34.pkg454 import m25461
+import pkg4.pkg63.pkg824.m9159
+from pkg10.pkg139.pkg1810 import m37237
+
+
+def helper_43521_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,62 @@
+"""Module 47689."""
+from . import m12261
+from pkg11.pkg156.pkg2041 import m16628
+import pkg5.m4
+from pkg8 import m7
+from . import m6009
+from . import m28933
+import pkg9.pkg120.pkg1564.m24487
+from pkg6.pkg88.pkg1150 import m1149
+import pkg1.pkg20.pkg264.m2347
+from pkg5.pkg76.pkg997 import m7248
+import pkg11.pkg153.pkg1992.m6159
+from pkg4.pkg54.pkg712 import m711
+
+
+def helper_47689_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_47689_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_47689_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_47689_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_47689_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_47689_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_47689_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
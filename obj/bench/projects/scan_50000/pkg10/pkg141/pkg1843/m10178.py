@@ -0,0 +1,55 @@
+"""Module 10178."""
+import pkg1.pkg19.m18
+from pkg2.pkg32.pkg418 import m417
+import pkg13.pkg178.m177
+from pkg1.pkg23.pkg312 import m311
+import pkg7.pkg95.pkg1241.m9576
+from pkg3.pkg48.pkg627 import m2710
+import pkg2.pkg27.pkg356.m2439
+from . import m6010
+import pkg2.pkg33.m32
+from pkg7.pkg99.pkg1300 import m9635
+import pkg3.pkg42.pkg558.m2641
+from pkg2.pkg35.pkg467 import m466
+
+
+def helper_10178_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10178_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_10178_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_10178_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_10178_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_10178_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,24 @@
+"""Module 14346."""
+import pkg9.pkg124.pkg1620.m1619
+from pkg7.pkg103.pkg1343 import m1342
+import pkg2.pkg38.pkg496.m2579
+from pkg10.pkg138 import m137
+import pkg4.pkg62.pkg816.m7067
+from pkg11.pkg155.pkg2017 import m2016
+from . import m3926
+from pkg4.pkg60.pkg781 import m780
+import pkg11.pkg153.pkg1997.m6164
+
+
+def helper_14346_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14346_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
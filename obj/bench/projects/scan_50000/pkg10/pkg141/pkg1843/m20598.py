@@ -0,0 +1,38 @@
+"""Module 20598."""
+import pkg1.pkg18.m17
+from pkg1.pkg17.pkg228 import m2311
+import pkg7.pkg100.pkg1304.m1303
+from pkg2.pkg37.pkg491 import m490
+from . import m8094
+from . import m12262
+import pkg3.pkg45.pkg590.m4757
+from pkg7.pkg98.pkg1280 import m5447
+import pkg12.pkg157.pkg2051.m16638
+
+
+def helper_20598_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_20598_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_20598_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_20598_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 22682."""
+import pkg3.pkg43.pkg569.m17240
+from pkg8.pkg106.pkg1380 import m20135
+import pkg13.m12
+from pkg8.pkg115.pkg1496 import m11915
+import pkg3.pkg41.pkg536.m8871
+
+
+def helper_22682_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_22682_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,35 @@
+"""Module 24766."""
+import pkg8.pkg107.m106
+from pkg9.pkg124.pkg1619 import m1618
+import pkg11.pkg146.pkg1900.m3983
+from . import m1842
+import pkg4.pkg62.pkg817.m2900
+from pkg4.pkg56.pkg739 import m738
+
+
+def helper_24766_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_24766_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_24766_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_24766_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
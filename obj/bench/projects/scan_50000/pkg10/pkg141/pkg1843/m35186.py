@@ -0,0 +1,54 @@
+"""Module 35186."""
+import pkg9.pkg128.pkg1676.m5843
+from pkg7.pkg93 import m92
+import pkg10.pkg142.pkg1848.m1847
+from pkg2.pkg33.pkg432 import m2515
+import pkg1.pkg15.pkg208.m207
+from pkg5.pkg69.pkg910 import m25917
+import pkg5.pkg70.pkg913.m2996
+from pkg3.pkg52.pkg684 import m4851
+import pkg1.m0
+from pkg7.pkg96.pkg1259 import m30434
+import pkg9.pkg128.pkg1674.m22513
+
+
+def helper_35186_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35186_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_35186_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_35186_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_35186_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_35186_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
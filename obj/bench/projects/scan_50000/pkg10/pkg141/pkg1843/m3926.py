@@ -0,0 +1,10 @@
+"""Module 3926."""
+import pkg1.pkg26.m25
+from pkg4.pkg54.pkg713 import m712
+
+
+def helper_3926_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 39354."""
+import pkg4.pkg54.pkg705.m704
+from pkg1.pkg22.pkg287 import m29462
+import pkg8.pkg117.pkg1526.m1525
+from pkg3.pkg51.pkg671 import m13174
+from . import m14346
+from . import m1842
+import pkg1.m0
+from pkg9.pkg121.pkg1584 import m18255
+import pkg9.pkg118.m117
+from pkg1.pkg19.pkg251 import m250
+import pkg3.pkg47.pkg619.m8954
+
+
+def helper_39354_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,13 @@
+"""Module 8094."""
+import pkg10.pkg138.m137
+from pkg8.pkg106.pkg1388 import m1387
+import pkg13.pkg178.m177
+from pkg11.pkg149.pkg1945 import m1944
+import pkg7.pkg99.pkg1289.m7540
+
+
+def helper_8094_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
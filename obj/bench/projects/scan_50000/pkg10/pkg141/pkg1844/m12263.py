@@ -0,0 +1,20 @@
+"""Module 12263."""
+import pkg1.m0
+from pkg11.pkg155 import m2238
+import pkg1.pkg18.pkg241.m240
+from pkg5.pkg68.pkg887 import m2970
+import pkg10.pkg140.pkg1821.m12240
+
+
+def helper_12263_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12263_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,45 @@
+"""Module 24767."""
+from . import m14347
+from pkg2.pkg32.pkg428 import m2511
+import pkg8.pkg111.m110
+from pkg10.pkg135.pkg1766 import m14269
+import pkg1.pkg17.m16
+from pkg3.pkg49.pkg642 import m23565
+import pkg2.pkg37.m36
+from pkg6.pkg83.pkg1089 import m15676
+import pkg5.pkg75.pkg986.m7237
+
+
+def helper_24767_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_24767_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_24767_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_24767_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_24767_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
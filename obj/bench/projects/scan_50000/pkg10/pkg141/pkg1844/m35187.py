@@ -0,0 +1,15 @@
+"""Module 35187."""
+import pkg11.pkg156.pkg2029.m22868
+from pkg1.pkg25.pkg334 import m4501
+import pkg1.pkg14.pkg189.m2272
+from pkg9.pkg121.pkg1586 import m3669
+import pkg3.pkg49.pkg648.m23571
+from pkg5.pkg72.pkg937 import m7188
+import pkg3.pkg50.m27141
+
+
+def helper_35187_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
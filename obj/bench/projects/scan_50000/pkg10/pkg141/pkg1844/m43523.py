@@ -0,0 +1,27 @@
+"""Module 43523."""
+import pkg11.pkg153.pkg2001.m2000
+from . import m16431
+import pkg10.pkg136.pkg1769.m3852
+from . import m12263
+import pkg11.pkg146.pkg1906.m12325
+from pkg10.pkg134.pkg1751 import m8002
+import pkg10.pkg139.pkg1811.m18482
+from pkg8.pkg106.pkg1380 import m30555
+from . import m22683
+from pkg7.pkg98 import m97
+import pkg8.pkg111.pkg1451.m13954
+from . import m39355
+
+
+def helper_43523_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_43523_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
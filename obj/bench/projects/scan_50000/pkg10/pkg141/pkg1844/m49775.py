@@ -0,0 +1,26 @@
+"""Module 49775."""
+import pkg6.pkg90.pkg1180.m15767
+from pkg9.pkg119.pkg1558 import m43237
+import pkg9.pkg120.pkg1566.m36993
+from pkg7.pkg103 import m2186
+
+
+def helper_49775_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_49775_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_49775_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,38 @@
+"""Module 10180."""
+import pkg2.pkg33.pkg442.m4609
+from . import m1844
+import pkg9.pkg118.pkg1540.m1539
+from pkg7.pkg95.pkg1237 import m1236
+from . import m3928
+from pkg5.pkg73 import m72
+import pkg3.pkg44.pkg581.m6832
+from pkg1 import m0
+import pkg10.pkg143.pkg1864.m3947
+
+
+def helper_10180_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10180_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_10180_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_10180_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
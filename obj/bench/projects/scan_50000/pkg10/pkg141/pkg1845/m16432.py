@@ -0,0 +1,16 @@
+"""Module 16432."""
+import pkg10.pkg142.pkg1859.m6026
+from pkg9.pkg126.pkg1650 import m7901
+import pkg7.pkg102.pkg1336.m15923
+from pkg8.pkg110.pkg1442 import m1441
+import pkg1.pkg19.m18
+from pkg10.pkg138.pkg1807 import m1806
+from . import m8096
+from . import m10180
+
+
+def helper_16432_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,12 @@
+"""Module 18516."""
+from . import m14348
+from pkg4.pkg60.pkg787 import m786
+from . import m1844
+from pkg4.pkg64.pkg844 import m13347
+
+
+def helper_18516_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,48 @@
+"""Module 37272."""
+import pkg8.pkg115.pkg1504.m1503
+from . import m31020
+import pkg2.pkg30.pkg395.m394
+from pkg7.pkg98.pkg1287 import m1286
+import pkg2.pkg28.pkg365.m29540
+from pkg4.pkg58.pkg762 import m761
+import pkg3.pkg50.pkg657.m4824
+from pkg3 import m2
+import pkg6.pkg84.pkg1101.m5268
+from pkg2.pkg36 import m10455
+import pkg2.pkg38.pkg499.m498
+from pkg4.pkg63.pkg828 import m7079
+
+
+def helper_37272_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37272_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_37272_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_37272_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_37272_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 10181."""
+import pkg12.pkg159.pkg2069.m2068
+from . import m3929
+import pkg12.m11
+from pkg2.pkg35.pkg467 import m466
+import pkg7.m6
+from pkg3.pkg40.pkg521 import m2604
+import pkg5.m4
+from pkg12.pkg157.pkg2049 import m2048
+import pkg8.pkg112.m111
+from pkg5.pkg69.pkg907 import m906
+
+
+def helper_10181_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10181_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
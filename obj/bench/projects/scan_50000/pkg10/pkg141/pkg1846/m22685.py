@@ -0,0 +1,20 @@
+"""Module 22685."""
+from . import m14349
+from pkg1.pkg19.pkg251 import m4418
+import pkg7.pkg100.m4267
+from pkg11.pkg152 import m151
+import pkg6.pkg83.pkg1083.m3166
+
+
+def helper_22685_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_22685_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,8 @@
+"""Module 28937."""
+
+
+def helper_28937_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,46 @@
+"""Module 33105."""
+import pkg1.m0
+from pkg3 import m2
+import pkg6.pkg90.pkg1172.m1171
+from pkg4.pkg61.pkg803 import m21642
+import pkg2.pkg32.m31
+from pkg6.pkg91.pkg1192 import m32451
+import pkg12.pkg159.pkg2074.m18745
+from pkg2 import m1
+from . import m28937
+from . import m10181
+
+
+def helper_33105_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_33105_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_33105_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_33105_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_33105_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
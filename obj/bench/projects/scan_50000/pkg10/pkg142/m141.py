@@ -0,0 +1,7 @@
+"""Module 141."""
+import pkg1.m0
+from pkg5.pkg75 import m74
+import pkg10.pkg141.m140
+from pkg3 import m2
+import pkg6.m5
+from pkg1.pkg22 import m21
@@ -0,0 +1,15 @@
+"""Module 18897."""
+import pkg2.pkg34.pkg447.m4614
+from pkg1 import m0
+from . import m6393
+from pkg9.pkg129.pkg1690 import m5857
+import pkg2.pkg35.pkg460.m459
+from pkg1.pkg20.pkg262 import m261
+from . import m16813
+
+
+def helper_18897_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
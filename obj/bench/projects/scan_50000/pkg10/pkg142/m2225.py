@@ -0,0 +1,29 @@
+"""Module 2225."""
+import pkg1.pkg17.m16
+from pkg2.pkg39.pkg518 import m517
+import pkg2.pkg35.pkg465.m464
+from pkg4 import m3
+import pkg4.pkg55.pkg727.m726
+from pkg9.pkg118 import m117
+import pkg10.pkg135.pkg1756.m1755
+
+
+def helper_2225_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_2225_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_2225_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,62 @@
+"""Module 27233."""
+import pkg10.pkg139.pkg1813.m1812
+from pkg5.pkg69 import m4236
+import pkg13.pkg181.m6432
+from pkg1.pkg15 import m14
+from . import m16813
+from pkg10.pkg140 import m139
+from . import m2225
+from pkg3.pkg40.pkg523 import m6774
+import pkg1.pkg25.pkg331.m19086
+from . import m4309
+import pkg9.pkg123.pkg1608.m7859
+from pkg6.pkg89.pkg1160 import m19915
+
+
+def helper_27233_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_27233_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_27233_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_27233_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_27233_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_27233_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_27233_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
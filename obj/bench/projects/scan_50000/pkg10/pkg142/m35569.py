@@ -0,0 +1,21 @@
+"""Module 35569."""
+import pkg4.pkg63.pkg820.m819
+from pkg1.pkg25.pkg335 import m2418
+import pkg11.pkg151.pkg1972.m8223
+from pkg8.pkg117 import m116
+import pkg3.pkg45.pkg592.m6843
+from . import m8477
+
+
+def helper_35569_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35569_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,45 @@
+"""Module 37653."""
+import pkg11.pkg150.pkg1951.m37378
+from pkg1.pkg19.pkg255 import m29430
+import pkg12.pkg161.m160
+from pkg12.pkg168 import m33511
+import pkg10.pkg143.pkg1866.m8117
+from pkg5.pkg72.pkg946 import m11365
+from . import m4309
+from pkg4.pkg63.pkg828 import m11247
+import pkg6.pkg88.pkg1149.m1148
+
+
+def helper_37653_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37653_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_37653_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_37653_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_37653_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 4309."""
+import pkg1.pkg14.pkg185.m184
+from . import m2225
+import pkg2.pkg34.pkg449.m448
+
+
+def helper_4309_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,12 @@
+"""Module 22686."""
+import pkg1.pkg20.pkg268.m16939
+from pkg3.pkg40.pkg521 import m2604
+import pkg9.pkg121.m2204
+from pkg5.pkg66.pkg863 import m9198
+import pkg5.pkg72.pkg945.m7196
+from pkg1 import m0
+import pkg8.pkg110.pkg1436.m11855
+from pkg3.pkg50.pkg663 import m6914
+import pkg3.m2
+from pkg11.pkg150.pkg1960 import m12379
+import pkg5.pkg71.pkg929.m7180
@@ -0,0 +1,23 @@
+"""Module 26854."""
+from . import m24770
+from pkg1 import m0
+import pkg8.pkg117.m116
+from pkg4.pkg58.pkg767 import m766
+import pkg3.pkg52.m51
+from pkg9.pkg122 import m121
+import pkg6.pkg89.pkg1160.m5327
+from . import m14350
+
+
+def helper_26854_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_26854_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
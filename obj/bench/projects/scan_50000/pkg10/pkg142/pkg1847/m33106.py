@@ -0,0 +1,17 @@
+"""Module 33106."""
+from . import m3930
+from . import m12266
+import pkg1.pkg25.pkg338.m2421
+from pkg3.pkg40 import m12543
+import pkg1.pkg21.pkg280.m279
+from pkg1.pkg24.pkg319 import m10738
+import pkg3.pkg49.pkg639.m17310
+from pkg12 import m11
+from . import m16434
+
+
+def helper_33106_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
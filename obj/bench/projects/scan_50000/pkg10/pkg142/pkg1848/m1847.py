@@ -0,0 +1,19 @@
+"""Module 1847."""
+import pkg1.m0
+from pkg4.pkg60 import m59
+import pkg2.pkg31.pkg410.m409
+from pkg7.pkg96.pkg1250 import m1249
+import pkg8.pkg108.pkg1416.m1415
+from pkg12.pkg165 import m164
+import pkg1.pkg17.pkg226.m225
+from pkg4.pkg63.pkg828 import m827
+import pkg4.pkg58.pkg759.m758
+from pkg6.pkg88 import m87
+import pkg2.pkg29.pkg390.m389
+
+
+def helper_1847_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,40 @@
+"""Module 35191."""
+import pkg12.pkg158.pkg2059.m22898
+from pkg1.pkg17.pkg234 import m2317
+import pkg2.pkg33.m32
+from pkg7.pkg92.pkg1206 import m11625
+import pkg11.pkg153.m152
+from pkg5.pkg67.pkg880 import m7131
+import pkg10.pkg137.m136
+from pkg6.pkg90.pkg1181 import m13684
+from . import m16435
+from pkg1.pkg24.pkg315 import m10734
+import pkg6.pkg91.m90
+
+
+def helper_35191_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35191_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_35191_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_35191_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
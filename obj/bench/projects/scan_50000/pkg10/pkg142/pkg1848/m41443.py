@@ -0,0 +1,40 @@
+"""Module 41443."""
+from . import m22687
+from pkg1.pkg15.pkg199 import m4366
+import pkg11.pkg144.pkg1884.m18555
+from pkg2.pkg28 import m27
+from . import m12267
+from pkg5.pkg66.pkg859 import m34202
+import pkg11.pkg146.pkg1911.m22750
+from pkg5.pkg75.pkg980 import m13483
+import pkg2.pkg38.pkg497.m2580
+from . import m1847
+import pkg2.pkg38.pkg498.m8833
+
+
+def helper_41443_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_41443_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_41443_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_41443_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,48 @@
+"""Module 37276."""
+import pkg11.pkg156.pkg2039.m6206
+from pkg6.pkg90.pkg1172 import m22011
+import pkg2.pkg29.pkg384.m383
+from pkg7.pkg101.pkg1315 import m9650
+import pkg12.pkg159.pkg2071.m2070
+from . import m8100
+import pkg1.m0
+from pkg1.pkg22.pkg296 import m4463
+import pkg1.pkg26.pkg351.m2434
+from pkg8.pkg114.pkg1485 import m16072
+import pkg9.pkg122.pkg1599.m24522
+from pkg7.pkg101.pkg1326 import m3409
+
+
+def helper_37276_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37276_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_37276_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_37276_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_37276_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
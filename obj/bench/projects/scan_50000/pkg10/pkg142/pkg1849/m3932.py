@@ -0,0 +1,13 @@
+"""Module 3932."""
+import pkg12.pkg158.m157
+from pkg1.pkg21.pkg281 import m280
+import pkg2.pkg28.pkg368.m367
+from pkg7.pkg92.pkg1207 import m1206
+import pkg5.pkg75.pkg984.m983
+
+
+def helper_3932_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
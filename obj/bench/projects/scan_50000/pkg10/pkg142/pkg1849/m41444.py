@@ -0,0 +1,11 @@
+"""Module 41444."""
+import pkg13.pkg180.m179
+from pkg7.pkg92.pkg1202 import m1201
+import pkg9.pkg130.pkg1703.m7954
+
+
+def helper_41444_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 45612."""
+from . import m33108
+from . import m8100
+import pkg9.pkg128.pkg1666.m26673
+from . import m3932
+import pkg8.pkg105.pkg1376.m1375
+
+
+def helper_45612_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_45612_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_45612_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,28 @@
+"""Module 10185."""
+import pkg5.pkg74.pkg973.m972
+from pkg3.pkg51.pkg666 import m4833
+from . import m1849
+from pkg1.pkg26.pkg346 import m2429
+import pkg2.pkg27.pkg358.m4525
+from pkg7.pkg104.pkg1356 import m1355
+
+
+def helper_10185_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10185_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_10185_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 37277."""
+import pkg4.pkg59.pkg777.m27868
+from . import m16437
+import pkg5.pkg77.pkg1008.m11427
+from pkg6.pkg84.pkg1105 import m7356
+import pkg11.pkg156.pkg2037.m14540
+
+
+def helper_37277_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37277_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
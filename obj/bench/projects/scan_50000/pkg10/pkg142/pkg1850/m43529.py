@@ -0,0 +1,45 @@
+"""Module 43529."""
+import pkg9.m8
+from pkg6.pkg85.pkg1109 import m3192
+import pkg3.m2
+from pkg6.pkg82.pkg1075 import m1074
+import pkg3.pkg52.pkg686.m685
+from pkg10.pkg140 import m139
+import pkg2.m1
+from pkg1.pkg19.pkg257 import m2340
+import pkg6.pkg86.m27177
+
+
+def helper_43529_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_43529_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_43529_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_43529_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_43529_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
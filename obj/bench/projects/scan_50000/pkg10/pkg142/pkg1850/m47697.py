@@ -0,0 +1,30 @@
+"""Module 47697."""
+import pkg2.pkg27.pkg352.m4519
+from pkg9.pkg125.pkg1628 import m22467
+import pkg2.pkg32.pkg423.m6674
+from pkg4.pkg62 import m2145
+import pkg1.m0
+from . import m24773
+import pkg7.pkg97.pkg1271.m3354
+from pkg3.pkg50.pkg657 import m17328
+
+
+def helper_47697_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_47697_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_47697_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,45 @@
+"""Module 6017."""
+import pkg7.pkg104.pkg1360.m1359
+from pkg9 import m8
+import pkg1.pkg19.pkg256.m4423
+from pkg5.pkg71.pkg924 import m3007
+import pkg6.pkg91.pkg1194.m3277
+from pkg9.pkg120 import m119
+import pkg9.pkg124.pkg1618.m5785
+from pkg3 import m2
+from . import m1849
+
+
+def helper_6017_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6017_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6017_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_6017_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_6017_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
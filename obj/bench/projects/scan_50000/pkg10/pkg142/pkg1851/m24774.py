@@ -0,0 +1,53 @@
+"""Module 24774."""
+from . import m22690
+from pkg1.pkg19.pkg254 import m4421
+from . import m18522
+from pkg8.pkg114.pkg1486 import m20241
+import pkg1.pkg16.pkg215.m12718
+from pkg6.pkg79.pkg1039 import m1038
+import pkg1.m0
+from pkg3 import m2
+import pkg6.pkg87.pkg1140.m9475
+from pkg5.pkg72.pkg946 import m945
+
+
+def helper_24774_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_24774_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_24774_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_24774_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_24774_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_24774_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
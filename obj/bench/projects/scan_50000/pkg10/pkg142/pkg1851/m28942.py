@@ -0,0 +1,35 @@
+"""Module 28942."""
+import pkg10.pkg140.pkg1829.m1828
+from . import m20606
+import pkg6.pkg82.pkg1070.m3153
+from pkg13 import m12
+import pkg6.pkg91.pkg1188.m26195
+from pkg1 import m0
+
+
+def helper_28942_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_28942_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_28942_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_28942_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,69 @@
+"""Module 37278."""
+import pkg6.pkg84.pkg1095.m3178
+from pkg2.pkg28.pkg374 import m373
+import pkg4.m3
+from pkg12.pkg159.pkg2080 import m25003
+import pkg10.pkg138.pkg1805.m22644
+from . import m10186
+import pkg2.pkg31.pkg407.m4574
+from pkg11.pkg152.pkg1984 import m8235
+import pkg9.pkg121.pkg1578.m16165
+from pkg11.pkg156.pkg2036 import m2035
+import pkg4.pkg64.pkg839.m5006
+from . import m31026
+
+
+def helper_37278_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37278_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_37278_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_37278_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_37278_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_37278_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37278_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_37278_42(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,23 @@
+"""Module 3934."""
+import pkg1.pkg26.pkg351.m350
+from pkg2.pkg34.pkg447 import m2530
+import pkg3.pkg52.m51
+from pkg11.pkg146 import m145
+import pkg1.m0
+from pkg5.pkg75.pkg987 import m986
+from . import m1850
+from pkg4.pkg60.pkg782 import m781
+
+
+def helper_3934_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3934_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
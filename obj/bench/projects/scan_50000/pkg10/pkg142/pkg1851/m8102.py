@@ -0,0 +1,19 @@
+"""Module 8102."""
+from . import m3934
+from pkg9.pkg125.pkg1638 import m1637
+import pkg3.pkg45.pkg595.m594
+from pkg2.pkg28.pkg365 import m2448
+
+
+def helper_8102_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8102_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,26 @@
+"""Module 1851."""
+import pkg1.m0
+from pkg4 import m3
+import pkg1.pkg21.pkg278.m277
+from pkg5.pkg70.pkg918 import m917
+
+
+def helper_1851_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1851_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1851_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
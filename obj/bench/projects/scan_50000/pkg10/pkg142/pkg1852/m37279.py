@@ -0,0 +1,27 @@
+"""Module 37279."""
+import pkg8.pkg110.pkg1435.m1434
+from pkg1.pkg23.pkg300 import m4467
+import pkg1.pkg18.pkg240.m6491
+from pkg4.pkg64.pkg833 import m15420
+import pkg3.pkg46.pkg603.m2686
+
+
+def helper_37279_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37279_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_37279_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,9 @@
+"""Module 41447."""
+import pkg2.pkg38.pkg501.m10920
+
+
+def helper_41447_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,12 @@
+"""Module 43531."""
+from . import m18523
+from pkg2.pkg29.pkg386 import m4553
+from . import m41447
+from pkg6.pkg91.pkg1196 import m1195
+
+
+def helper_43531_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
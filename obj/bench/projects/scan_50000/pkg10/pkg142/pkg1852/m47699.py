@@ -0,0 +1,25 @@
+"""Module 47699."""
+import pkg7.pkg94.pkg1235.m26242
+from pkg5.pkg76.pkg995 import m36422
+from . import m16439
+from pkg5.pkg69.pkg898 import m27989
+import pkg5.pkg69.pkg898.m897
+from pkg2.pkg38 import m37
+from . import m12271
+from pkg10.pkg135.pkg1764 import m1763
+import pkg2.pkg39.m38
+from pkg6.pkg80.pkg1050 import m5217
+
+
+def helper_47699_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_47699_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
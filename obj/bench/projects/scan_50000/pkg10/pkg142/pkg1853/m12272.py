@@ -0,0 +1,23 @@
+"""Module 12272."""
+from . import m1852
+from pkg8.pkg106.pkg1379 import m5546
+import pkg7.pkg104.pkg1357.m7608
+from pkg3.pkg44.pkg584 import m583
+from . import m10188
+from pkg2.pkg33.pkg431 import m2514
+import pkg10.pkg131.pkg1706.m1705
+from pkg10 import m9
+
+
+def helper_12272_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12272_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,14 @@
+"""Module 24776."""
+import pkg1.pkg26.pkg343.m342
+from pkg1.pkg20.pkg273 import m272
+from . import m18524
+from pkg2.pkg33 import m32
+import pkg1.pkg14.pkg192.m191
+from . import m12272
+
+
+def helper_24776_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 43532."""
+import pkg2.pkg32.pkg419.m29594
+from . import m26860
+import pkg2.pkg27.pkg356.m355
+
+
+def helper_43532_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_43532_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
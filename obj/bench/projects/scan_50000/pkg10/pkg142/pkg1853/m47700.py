@@ -0,0 +1,28 @@
+"""Module 47700."""
+import pkg4.pkg63.pkg828.m2911
+from . import m6020
+from . import m31028
+from pkg4.pkg63.pkg827 import m46674
+import pkg9.pkg122.pkg1593.m12012
+from pkg3.pkg41.pkg544 import m46391
+
+
+def helper_47700_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_47700_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_47700_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,68 @@
+"""Module 49784."""
+import pkg1.pkg14.pkg185.m184
+from pkg1.pkg21.pkg279 import m278
+import pkg2.pkg31.pkg404.m403
+from pkg1.pkg25.pkg335 import m17006
+import pkg4.pkg59.pkg773.m40368
+from pkg10.pkg131.pkg1714 import m7965
+import pkg2.pkg35.pkg461.m460
+from pkg3.pkg45.pkg592 import m13095
+import pkg1.m0
+from pkg7.pkg96.pkg1253 import m36680
+import pkg7.pkg94.pkg1229.m32488
+
+
+def helper_49784_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_49784_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_49784_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_49784_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_49784_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_49784_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_49784_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_49784_42(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,36 @@
+"""Module 12273."""
+import pkg9.pkg118.pkg1542.m1541
+from . import m1853
+import pkg1.pkg21.pkg274.m8609
+from pkg12 import m11
+import pkg5.pkg72.pkg942.m11361
+from pkg8.pkg112 import m111
+import pkg5.pkg67.pkg873.m872
+
+
+def helper_12273_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12273_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_12273_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_12273_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,23 @@
+"""Module 16441."""
+from . import m14357
+from pkg7.pkg98.pkg1283 import m1282
+import pkg10.pkg141.pkg1842.m6009
+from pkg7.pkg95.pkg1236 import m5403
+import pkg6.pkg80.pkg1052.m5219
+from pkg5.pkg78.pkg1020 import m1019
+import pkg4.pkg54.m53
+from pkg2.pkg28.pkg374 import m2457
+
+
+def helper_16441_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16441_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 24777."""
+import pkg4.pkg65.pkg851.m850
+from pkg4.pkg61.pkg796 import m17467
+import pkg4.pkg63.pkg830.m4997
+from pkg3.pkg50 import m49
+import pkg1.pkg19.pkg256.m2339
+
+
+def helper_24777_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_24777_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_24777_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,32 @@
+"""Module 49785."""
+import pkg4.pkg53.pkg702.m6953
+from pkg7.pkg92.pkg1207 import m15794
+import pkg4.pkg60.pkg785.m784
+from pkg1.pkg22.pkg295 import m294
+from . import m10189
+from pkg1.pkg21.pkg283 import m282
+import pkg9.pkg126.pkg1645.m7896
+from pkg10 import m9
+import pkg1.pkg19.pkg257.m8592
+from . import m20609
+
+
+def helper_49785_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_49785_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_49785_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
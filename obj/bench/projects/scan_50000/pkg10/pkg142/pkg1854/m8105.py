@@ -0,0 +1,32 @@
+"""Module 8105."""
+import pkg1.m0
+from . import m3937
+import pkg1.pkg23.pkg302.m2385
+from pkg7.pkg102.pkg1336 import m7587
+import pkg3.pkg46.m45
+from . import m6021
+import pkg2.m1
+from pkg1.pkg26 import m25
+import pkg13.pkg181.m4348
+from . import m1853
+
+
+def helper_8105_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8105_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8105_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,39 @@
+"""Module 12274."""
+import pkg9.pkg118.pkg1542.m9877
+from pkg1.pkg23 import m22
+import pkg11.pkg151.m150
+from pkg4.pkg58 import m57
+import pkg11.pkg152.pkg1977.m4060
+from pkg1.pkg18 import m17
+import pkg9.pkg122.pkg1589.m5756
+from pkg3.pkg52.pkg687 import m9022
+import pkg10.pkg140.pkg1824.m3907
+from pkg11.pkg152.pkg1987 import m1986
+
+
+def helper_12274_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_12274_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_12274_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_12274_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,38 @@
+"""Module 16442."""
+from . import m3938
+from pkg7.pkg102.pkg1333 import m1332
+import pkg5.pkg68.m67
+from pkg9.pkg118.pkg1536 import m5703
+import pkg4.pkg58.pkg762.m2845
+from pkg7.pkg99.pkg1299 import m3382
+from . import m8106
+from pkg1.pkg26 import m25
+import pkg6.pkg82.pkg1075.m9410
+
+
+def helper_16442_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16442_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_16442_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_16442_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
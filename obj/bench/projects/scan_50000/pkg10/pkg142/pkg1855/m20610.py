@@ -0,0 +1,31 @@
+"""Module 20610."""
+import pkg9.pkg123.pkg1608.m5775
+from pkg3.pkg51.pkg667 import m2750
+import pkg5.pkg69.pkg903.m902
+from pkg5.pkg66.pkg866 import m7117
+import pkg5.pkg72.pkg942.m941
+from pkg2 import m1
+import pkg2.pkg29.pkg380.m379
+from . import m10190
+import pkg8.pkg115.pkg1506.m3589
+
+
+def helper_20610_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_20610_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_20610_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
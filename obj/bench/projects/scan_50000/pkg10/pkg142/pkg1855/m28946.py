@@ -0,0 +1,17 @@
+"""Module 28946."""
+import pkg8.pkg109.pkg1424.m11843
+from . import m6022
+import pkg5.pkg70.pkg922.m23845
+from pkg9.pkg121 import m4288
+import pkg11.pkg144.pkg1885.m3968
+from pkg8.pkg114 import m113
+import pkg13.pkg178.m21017
+from pkg3.pkg43.pkg563 import m13066
+import pkg1.m0
+
+
+def helper_28946_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
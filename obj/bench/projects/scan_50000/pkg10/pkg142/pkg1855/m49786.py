@@ -0,0 +1,20 @@
+"""Module 49786."""
+import pkg1.pkg25.m4192
+from pkg1.pkg20.pkg263 import m39858
+import pkg10.pkg132.pkg1720.m3803
+from pkg5.pkg66.pkg864 import m5031
+import pkg5.pkg77.pkg1006.m5173
+from pkg9.pkg120.pkg1565 import m1564
+import pkg5.pkg73.pkg957.m956
+from pkg1.pkg18.pkg244 import m39839
+from . import m26862
+from pkg2.pkg31.pkg404 import m403
+import pkg6.pkg90.pkg1179.m5346
+from pkg10.pkg131.pkg1708 import m12127
+
+
+def helper_49786_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,32 @@
+"""Module 8106."""
+import pkg11.pkg146.pkg1910.m1909
+from pkg2 import m1
+import pkg3.pkg47.pkg618.m2701
+from pkg7.pkg94.pkg1228 import m5395
+from . import m6022
+from pkg4.pkg62.pkg815 import m814
+import pkg13.pkg172.m171
+from pkg6.pkg79.pkg1035 import m7286
+import pkg8.pkg106.pkg1383.m5550
+from pkg5.pkg69.pkg907 import m906
+
+
+def helper_8106_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8106_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8106_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
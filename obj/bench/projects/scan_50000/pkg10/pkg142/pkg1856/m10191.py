@@ -0,0 +1,46 @@
+"""Module 10191."""
+import pkg7.pkg97.pkg1267.m5434
+from pkg3.pkg45 import m44
+from . import m6023
+from . import m1855
+from . import m8107
+from pkg11.pkg148 import m8483
+import pkg5.pkg68.pkg885.m884
+from pkg2.pkg30.pkg394 import m393
+import pkg3.pkg41.pkg543.m542
+from pkg4.pkg64.pkg835 import m5002
+
+
+def helper_10191_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10191_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_10191_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_10191_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_10191_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,10 @@
+"""Module 14359."""
+import pkg10.pkg136.m6387
+from . import m10191
+
+
+def helper_14359_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
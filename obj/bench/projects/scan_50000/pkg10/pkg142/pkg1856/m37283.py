@@ -0,0 +1,25 @@
+"""Module 37283."""
+import pkg13.pkg179.m178
+from pkg7.pkg102.pkg1331 import m15918
+import pkg8.pkg117.pkg1531.m26538
+from pkg8.pkg105 import m12608
+import pkg3.pkg43.pkg560.m559
+from pkg1.pkg21 import m4188
+import pkg7.pkg101.pkg1316.m22155
+from pkg2 import m1
+import pkg3.pkg50.pkg660.m15247
+from pkg9.pkg129.pkg1680 import m5847
+
+
+def helper_37283_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37283_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 47703."""
+import pkg2.pkg32.pkg427.m426
+from . import m16443
+import pkg8.pkg113.pkg1482.m22321
+
+
+def helper_47703_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_47703_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,15 @@
+"""Module 6023."""
+from . import m1855
+from pkg3.pkg52 import m51
+import pkg2.pkg28.pkg373.m372
+from pkg9 import m8
+import pkg1.pkg17.pkg227.m4394
+from pkg5.pkg70.pkg912 import m911
+import pkg3.pkg49.pkg638.m637
+
+
+def helper_6023_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,52 @@
+"""Module 14360."""
+import pkg3.pkg52.pkg681.m6932
+from . import m8108
+import pkg2.pkg28.pkg365.m364
+from pkg7.pkg92.pkg1207 import m1206
+from . import m6024
+from pkg1.pkg15.pkg207 import m206
+import pkg12.pkg158.pkg2067.m6234
+from pkg2.pkg39 import m38
+import pkg1.pkg22.pkg298.m6549
+
+
+def helper_14360_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14360_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_14360_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_14360_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_14360_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_14360_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
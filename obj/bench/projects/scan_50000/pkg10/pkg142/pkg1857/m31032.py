@@ -0,0 +1,40 @@
+"""Module 31032."""
+from . import m14360
+from pkg5.pkg71.pkg929 import m15516
+import pkg6.pkg90.pkg1172.m3255
+from . import m12276
+import pkg1.pkg14.m13
+from pkg6.pkg83.pkg1090 import m3173
+import pkg9.pkg130.pkg1700.m10035
+from pkg8.pkg106.pkg1381 import m9716
+import pkg9.pkg123.pkg1606.m1605
+from pkg3 import m2
+import pkg8.pkg110.pkg1439.m3522
+
+
+def helper_31032_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_31032_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_31032_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_31032_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,19 @@
+"""Module 33116."""
+from . import m10192
+from pkg6 import m5
+import pkg10.pkg138.pkg1806.m1805
+from pkg2.pkg39.pkg517 import m516
+from . import m1856
+from pkg8.pkg106.pkg1385 import m9720
+import pkg8.pkg109.pkg1418.m5585
+from . import m6024
+import pkg1.pkg19.pkg255.m254
+from pkg12.pkg167 import m18922
+import pkg11.pkg147.m146
+
+
+def helper_33116_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 43536."""
+import pkg12.m11
+from pkg4.pkg61.pkg796 import m795
+import pkg3.pkg52.m51
+from . import m41452
+import pkg1.pkg23.m22
+from . import m14360
+import pkg8.pkg105.m104
+from pkg9.pkg120.pkg1573 import m32832
+import pkg3.pkg46.pkg599.m8934
+from . import m28948
+
+
+def helper_43536_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
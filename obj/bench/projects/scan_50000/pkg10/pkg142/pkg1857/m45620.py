@@ -0,0 +1,18 @@
+"""Module 45620."""
+import pkg5.pkg66.pkg868.m36295
+from pkg1.pkg20.pkg267 import m8602
+import pkg1.pkg23.m22
+
+
+def helper_45620_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_45620_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
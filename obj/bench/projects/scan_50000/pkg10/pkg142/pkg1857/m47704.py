@@ -0,0 +1,26 @@
+"""Module 47704."""
+import pkg10.pkg131.pkg1706.m18377
+from . import m37284
+import pkg9.pkg130.pkg1691.m16278
+from pkg1.pkg19 import m18
+import pkg6.pkg79.pkg1038.m1037
+from pkg4.pkg57.pkg748 import m19503
+import pkg11.pkg150.pkg1958.m26965
+from pkg5.pkg75.pkg976 import m3059
+import pkg9.pkg126.pkg1651.m26658
+from pkg2.pkg36.pkg474 import m4641
+import pkg5.pkg77.pkg1002.m46849
+
+
+def helper_47704_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_47704_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
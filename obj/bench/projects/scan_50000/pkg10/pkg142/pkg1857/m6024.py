@@ -0,0 +1,27 @@
+"""Module 6024."""
+import pkg3.pkg52.pkg688.m687
+from pkg1.pkg19.pkg256 import m255
+import pkg1.pkg15.pkg198.m197
+from pkg1 import m0
+import pkg2.pkg27.pkg355.m2438
+
+
+def helper_6024_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6024_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6024_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
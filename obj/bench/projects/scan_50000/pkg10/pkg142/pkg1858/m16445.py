@@ -0,0 +1 @@
+"""Module 16445."""
@@ -0,0 +1,69 @@
+"""Module 22697."""
+import pkg2.pkg38.pkg495.m17166
+from . import m20613
+import pkg10.pkg132.pkg1720.m1719
+from pkg10.pkg136.pkg1778 import m10113
+import pkg9.pkg125.pkg1637.m14140
+from pkg4.pkg64.pkg833 import m832
+import pkg6.pkg81.pkg1062.m3145
+from pkg2.pkg38 import m37
+import pkg9.pkg119.pkg1555.m3638
+from pkg2.pkg29.pkg383 import m14970
+import pkg7.pkg92.pkg1204.m7455
+from pkg1 import m0
+
+
+def helper_22697_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_22697_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_22697_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_22697_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_22697_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_22697_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_22697_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_22697_42(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
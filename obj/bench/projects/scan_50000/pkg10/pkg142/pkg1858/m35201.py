@@ -0,0 +1,29 @@
+"""Module 35201."""
+import pkg6.m5
+from pkg1.pkg25.pkg337 import m6588
+import pkg5.pkg66.pkg859.m9194
+from pkg10.pkg131.pkg1708 import m1707
+import pkg12.pkg159.pkg2075.m27082
+from pkg8.pkg112.pkg1461 import m1460
+import pkg1.pkg16.pkg217.m216
+
+
+def helper_35201_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_35201_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_35201_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,2 @@
+"""Module 12278."""
+import pkg5.pkg77.pkg1010.m9345
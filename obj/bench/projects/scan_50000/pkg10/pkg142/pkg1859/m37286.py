@@ -0,0 +1,60 @@
+"""Module 37286."""
+import pkg13.pkg172.m171
+from pkg1.pkg17.pkg227 import m226
+import pkg4.pkg59.pkg778.m777
+from pkg1.pkg17.pkg227 import m2310
+import pkg2.pkg35.pkg461.m460
+from pkg5.pkg71.pkg927 import m3010
+import pkg4.pkg53.pkg697.m696
+from pkg1 import m0
+import pkg6.pkg81.pkg1061.m28152
+from pkg10.pkg137.pkg1786 import m1785
+
+
+def helper_37286_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37286_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_37286_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_37286_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_37286_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_37286_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37286_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,39 @@
+"""Module 39370."""
+import pkg11.pkg146.pkg1904.m16491
+from pkg2.pkg30.pkg393 import m392
+import pkg5.pkg66.pkg866.m38377
+from pkg2.pkg32.pkg419 import m418
+from . import m16446
+from pkg4.pkg64.pkg833 import m2916
+from . import m18530
+from pkg3.pkg51.pkg676 import m675
+import pkg12.m11
+from pkg7.pkg98.pkg1275 import m5442
+
+
+def helper_39370_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_39370_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_39370_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_39370_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,40 @@
+"""Module 43538."""
+import pkg1.pkg26.pkg345.m33688
+from pkg8.pkg107.pkg1394 import m22233
+import pkg7.pkg98.pkg1281.m11700
+from pkg6.pkg90.pkg1176 import m15763
+import pkg5.pkg68.m67
+from pkg4.pkg63.pkg824 import m11243
+import pkg11.pkg152.pkg1983.m16570
+from pkg8.pkg109 import m108
+import pkg10.pkg131.pkg1712.m3795
+from . import m31034
+from . import m18530
+
+
+def helper_43538_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_43538_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_43538_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_43538_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
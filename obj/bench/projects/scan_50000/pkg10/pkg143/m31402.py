@@ -0,0 +1,21 @@
+"""Module 31402."""
+import pkg3.pkg42.pkg559.m6810
+from pkg7.pkg99.pkg1293 import m11712
+import pkg2.pkg32.pkg422.m6673
+from pkg8.pkg111.pkg1453 import m1452
+import pkg11.pkg155.pkg2021.m18692
+from pkg9.pkg130.pkg1699 import m5866
+
+
+def helper_31402_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_31402_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
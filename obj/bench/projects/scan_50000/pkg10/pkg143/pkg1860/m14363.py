@@ -0,0 +1,26 @@
+"""Module 14363."""
+import pkg11.pkg150.pkg1955.m8206
+from pkg5.pkg71.pkg926 import m9261
+import pkg6.pkg82.pkg1067.m1066
+from pkg5.pkg67 import m66
+
+
+def helper_14363_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14363_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_14363_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,53 @@
+"""Module 28951."""
+import pkg3.pkg51.pkg666.m4833
+from pkg2.pkg33.pkg437 import m2520
+import pkg12.pkg158.pkg2062.m24985
+from pkg4.pkg55.pkg728 import m727
+import pkg2.pkg31.m30
+from . import m12279
+import pkg6.pkg82.pkg1074.m13577
+from . import m6027
+import pkg2.pkg38.pkg507.m10926
+from pkg3.pkg43.pkg572 import m2655
+
+
+def helper_28951_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_28951_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_28951_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_28951_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_28951_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_28951_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 16448."""
+import pkg7.pkg104.pkg1357.m3440
+from pkg11.pkg149.pkg1939 import m4022
+import pkg1.pkg16.pkg219.m6470
+from pkg5.pkg70.pkg916 import m7167
+import pkg3.pkg46.pkg611.m6862
+
+
+def helper_16448_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_16448_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 18532."""
+import pkg6.pkg87.pkg1138.m13641
+from pkg4.pkg54.pkg714 import m2797
+from . import m1860
+
+
+def helper_18532_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
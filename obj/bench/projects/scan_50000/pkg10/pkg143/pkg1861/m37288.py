@@ -0,0 +1,45 @@
+"""Module 37288."""
+import pkg5.pkg76.pkg997.m17668
+from pkg7.pkg98.pkg1282 import m1281
+import pkg4.pkg57.m56
+from pkg2.pkg33 import m32
+import pkg4.pkg60.pkg792.m25799
+from pkg2.pkg32.pkg421 import m420
+from . import m31036
+from pkg11.pkg153.pkg1999 import m8250
+from . import m3944
+
+
+def helper_37288_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37288_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_37288_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_37288_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_37288_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1 @@
+"""Module 45624."""
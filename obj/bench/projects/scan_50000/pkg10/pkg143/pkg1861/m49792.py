@@ -0,0 +1,31 @@
+"""Module 49792."""
+import pkg10.pkg137.pkg1786.m18457
+from pkg7.pkg99.pkg1296 import m3379
+from . import m24784
+from pkg4.pkg55.pkg724 import m38235
+from . import m31036
+from . import m8112
+from . import m39372
+from . import m37288
+import pkg6.pkg84.m83
+
+
+def helper_49792_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_49792_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_49792_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 10197."""
+import pkg1.pkg19.m18
+from pkg8.pkg109.pkg1429 import m7680
+import pkg1.m0
+
+
+def helper_10197_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10197_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
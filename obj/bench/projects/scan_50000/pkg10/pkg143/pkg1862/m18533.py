@@ -0,0 +1,24 @@
+"""Module 18533."""
+import pkg4.m3
+from . import m10197
+import pkg9.pkg124.m8459
+from pkg9.pkg130 import m129
+import pkg2.pkg32.m31
+from pkg4.pkg54 import m53
+import pkg3.m2
+from pkg3.pkg40 import m6291
+import pkg10.pkg135.pkg1768.m1767
+
+
+def helper_18533_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_18533_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
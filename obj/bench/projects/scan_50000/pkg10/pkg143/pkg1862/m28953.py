@@ -0,0 +1,13 @@
+"""Module 28953."""
+from . import m1861
+from . import m10197
+import pkg1.pkg16.pkg214.m213
+from pkg5.pkg74.pkg967 import m25974
+import pkg1.m0
+
+
+def helper_28953_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,2 @@
+"""Module 37289."""
+import pkg8.pkg117.pkg1523.m5690
@@ -0,0 +1,14 @@
+"""Module 39373."""
+import pkg1.pkg20.pkg273.m4440
+from pkg6.pkg82.pkg1073 import m3156
+import pkg1.pkg19.m18
+from pkg7.pkg103.pkg1344 import m13847
+import pkg8.pkg116.pkg1515.m18186
+from . import m24785
+
+
+def helper_39373_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
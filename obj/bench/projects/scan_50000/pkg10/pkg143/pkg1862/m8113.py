@@ -0,0 +1,31 @@
+"""Module 8113."""
+import pkg4.pkg61.pkg804.m7055
+from pkg7.pkg94 import m93
+import pkg6.pkg89.pkg1165.m5332
+from pkg5.pkg73.pkg962 import m3045
+import pkg2.m1
+from pkg7.pkg101.pkg1317 import m3400
+import pkg9.pkg126.pkg1649.m5816
+from pkg6.pkg81.pkg1060 import m1059
+import pkg5.pkg75.pkg984.m5151
+
+
+def helper_8113_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8113_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8113_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 20618."""
+from . import m1862
+from pkg5.pkg70.pkg921 import m3004
+
+
+def helper_20618_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_20618_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
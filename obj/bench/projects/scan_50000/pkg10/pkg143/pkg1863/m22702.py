@@ -0,0 +1,36 @@
+"""Module 22702."""
+from . import m1862
+from pkg6.pkg87.pkg1138 import m17809
+import pkg4.pkg57.pkg754.m753
+from pkg2.pkg38.pkg507 import m13010
+from . import m18534
+from pkg9.pkg122.pkg1597 import m20352
+import pkg6.pkg83.pkg1084.m5251
+
+
+def helper_22702_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_22702_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_22702_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_22702_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,54 @@
+"""Module 41458."""
+import pkg4.pkg63.m62
+from pkg7.pkg95.pkg1241 import m1240
+import pkg4.m3
+from pkg4.pkg60.pkg791 import m9126
+import pkg9.pkg125.pkg1630.m34973
+from pkg8.pkg116.pkg1521 import m1520
+from . import m39374
+from pkg10.pkg143.pkg1862 import m1861
+import pkg12.pkg159.pkg2078.m20833
+from pkg2.pkg35 import m34
+import pkg3.pkg42.m6293
+
+
+def helper_41458_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_41458_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_41458_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_41458_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_41458_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_41458_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
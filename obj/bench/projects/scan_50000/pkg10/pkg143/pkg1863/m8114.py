@@ -0,0 +1,62 @@
+"""Module 8114."""
+import pkg3.pkg51.pkg671.m670
+from pkg4.pkg61 import m60
+import pkg9.pkg130.pkg1700.m1699
+from pkg2.pkg30 import m29
+import pkg4.pkg53.pkg693.m2776
+from pkg9.pkg119.pkg1554 import m7805
+import pkg1.pkg21.pkg274.m273
+from . import m3946
+import pkg1.pkg16.pkg217.m4384
+from pkg10.pkg136.pkg1774 import m8025
+from . import m1862
+from . import m6030
+
+
+def helper_8114_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8114_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8114_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8114_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_8114_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_8114_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8114_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,11 @@
+"""Module 12283."""
+import pkg7.pkg100.pkg1306.m3389
+from pkg6 import m5
+import pkg2.pkg33.pkg438.m6689
+
+
+def helper_12283_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,20 @@
+"""Module 14368."""
+import pkg3.pkg51.pkg673.m672
+from pkg4.pkg58.pkg765 import m764
+import pkg10.pkg136.pkg1773.m12192
+from pkg5.pkg74.pkg973 import m7224
+import pkg11.m10
+from . import m10200
+import pkg5.pkg77.pkg1002.m1001
+from pkg2 import m1
+import pkg10.pkg138.pkg1805.m1804
+from pkg1.pkg19.pkg257 import m6508
+from . import m3948
+from pkg6.pkg90.pkg1173 import m1172
+
+
+def helper_14368_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
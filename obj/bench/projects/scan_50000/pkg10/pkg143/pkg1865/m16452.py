@@ -0,0 +1,7 @@
+"""Module 16452."""
+import pkg11.pkg146.pkg1901.m1900
+from pkg9.pkg124.pkg1623 import m1622
+import pkg3.pkg43.pkg564.m6815
+from pkg1 import m0
+import pkg3.pkg51.pkg676.m15263
+from pkg10.pkg135.pkg1760 import m3843
@@ -0,0 +1,12 @@
+"""Module 1864."""
+import pkg2.pkg27.pkg352.m351
+from pkg2.pkg38.pkg495 import m494
+import pkg4.pkg57.pkg747.m746
+from pkg2.pkg32 import m31
+import pkg3.pkg52.m51
+from pkg1.pkg22 import m21
+import pkg8.pkg106.m105
+from pkg2.pkg33 import m32
+import pkg7.pkg97.m96
+from pkg1 import m0
+import pkg6.pkg88.m87
@@ -0,0 +1,22 @@
+"""Module 47712."""
+import pkg1.pkg22.pkg295.m294
+from pkg8.pkg109.pkg1422 import m5589
+import pkg4.pkg58.pkg762.m29937
+from pkg6.pkg80.pkg1047 import m1046
+import pkg9.pkg128.pkg1670.m20425
+from pkg7.pkg96.pkg1254 import m5421
+import pkg3.pkg40.pkg522.m8857
+
+
+def helper_47712_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_47712_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,34 @@
+"""Module 6032."""
+import pkg10.pkg135.pkg1759.m1758
+from pkg8.pkg114 import m113
+import pkg2.pkg38.pkg503.m2586
+from pkg9.pkg126 import m125
+import pkg7.pkg92.pkg1198.m1197
+from pkg9.pkg118.pkg1543 import m3626
+import pkg3.pkg41.pkg534.m533
+from pkg1.pkg14.pkg192 import m191
+import pkg7.pkg104.pkg1356.m1355
+from pkg5.pkg74 import m73
+import pkg6.pkg84.pkg1105.m5272
+from pkg10.pkg140 import m139
+
+
+def helper_6032_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_6032_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_6032_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
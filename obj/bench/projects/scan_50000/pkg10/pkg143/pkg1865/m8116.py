@@ -0,0 +1,20 @@
+"""Module 8116."""
+import pkg2.pkg31.pkg407.m406
+from pkg3.pkg52 import m51
+import pkg6.pkg89.m88
+from . import m1864
+import pkg1.pkg18.pkg236.m235
+
+
+def helper_8116_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8116_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 18537."""
+import pkg5.pkg72.pkg941.m940
+from pkg2.pkg37.pkg491 import m490
+
+
+def helper_18537_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_18537_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
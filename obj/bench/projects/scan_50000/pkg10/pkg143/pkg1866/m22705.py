@@ -0,0 +1,44 @@
+"""Module 22705."""
+import pkg3.pkg52.pkg689.m2772
+from pkg6.pkg87 import m86
+from . import m16453
+from . import m14369
+import pkg8.pkg111.pkg1451.m7702
+from pkg11.pkg149.pkg1941 import m1940
+from . import m10201
+from pkg3.pkg42.pkg550 import m549
+
+
+def helper_22705_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_22705_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_22705_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_22705_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_22705_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 28957."""
+from . import m24789
+from . import m14369
+import pkg2.pkg38.pkg501.m4668
+from pkg3.pkg43.pkg561 import m560
+import pkg6.pkg81.pkg1058.m23981
+from pkg1.pkg26.pkg343 import m2426
+from . import m16453
+from pkg9.pkg128.pkg1677 import m3760
+from . import m3949
+
+
+def helper_28957_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
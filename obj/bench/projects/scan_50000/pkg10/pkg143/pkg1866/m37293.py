@@ -0,0 +1,61 @@
+"""Module 37293."""
+import pkg5.pkg67.pkg881.m34224
+from pkg8.pkg105.pkg1373 import m1372
+import pkg2.pkg32.pkg418.m417
+from pkg9.pkg127.pkg1656 import m9991
+import pkg11.pkg146.m145
+from pkg7.pkg96.pkg1261 import m1260
+import pkg3.pkg43.pkg565.m564
+from . import m10201
+import pkg1.pkg24.pkg313.m4480
+from pkg9.pkg121.pkg1577 import m28668
+import pkg1.pkg19.m2102
+
+
+def helper_37293_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37293_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_37293_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_37293_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_37293_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_37293_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_37293_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
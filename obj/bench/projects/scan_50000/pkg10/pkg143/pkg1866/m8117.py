@@ -0,0 +1,51 @@
+"""Module 8117."""
+from . import m3949
+from pkg2.pkg29.pkg381 import m380
+import pkg2.pkg28.pkg367.m366
+from pkg2.pkg37.pkg491 import m2574
+import pkg7.pkg98.pkg1278.m3361
+from pkg1.pkg26.pkg346 import m6597
+import pkg11.pkg156.pkg2040.m4123
+from pkg6.pkg80.pkg1041 import m7292
+
+
+def helper_8117_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8117_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8117_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_8117_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_8117_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_8117_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,37 @@
+"""Module 14370."""
+import pkg3.pkg43.pkg563.m562
+from pkg3.pkg52.pkg682 import m681
+import pkg4.pkg55.m54
+from pkg1 import m0
+from . import m10202
+from pkg5.pkg68.pkg889 import m888
+import pkg12.pkg159.pkg2068.m4151
+from . import m6034
+
+
+def helper_14370_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_14370_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_14370_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_14370_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
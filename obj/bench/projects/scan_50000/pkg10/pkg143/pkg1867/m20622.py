@@ -0,0 +1,36 @@
+"""Module 20622."""
+import pkg7.pkg98.m97
+from pkg1 import m0
+from . import m8118
+from pkg10.pkg136.pkg1769 import m1768
+import pkg8.pkg117.pkg1523.m3606
+from . import m6034
+import pkg7.pkg96.pkg1256.m1255
+
+
+def helper_20622_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_20622_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_20622_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_20622_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 10203."""
+from . import m1867
+from pkg4.pkg61.pkg801 import m2884
+import pkg2.pkg32.pkg418.m417
+from . import m6035
+import pkg1.pkg14.pkg183.m2266
+from . import m8119
+import pkg7.m6
+from pkg4.pkg65.pkg846 import m845
+import pkg10.pkg143.pkg1871.m3954
+from pkg2.pkg37.pkg493 import m2576
+
+
+def helper_10203_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10203_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,17 @@
+"""Module 14371."""
+import pkg1.pkg16.pkg215.m10634
+from pkg1.pkg24 import m23
+import pkg11.pkg149.pkg1939.m6106
+from pkg7.pkg104.pkg1355 import m3438
+import pkg1.pkg21.pkg279.m278
+from pkg4.pkg54 import m53
+import pkg9.m8
+from pkg2.pkg27 import m26
+import pkg1.pkg22.pkg294.m293
+
+
+def helper_14371_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,18 @@
+"""Module 3951."""
+import pkg8.pkg115.pkg1503.m1502
+from . import m1867
+import pkg1.m0
+
+
+def helper_3951_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_3951_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
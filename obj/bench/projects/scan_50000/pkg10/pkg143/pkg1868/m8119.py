@@ -0,0 +1,25 @@
+"""Module 8119."""
+import pkg6.pkg80.pkg1043.m1042
+from pkg3.pkg46.pkg603 import m602
+import pkg1.pkg16.pkg218.m6469
+from pkg7.pkg102.pkg1333 import m1332
+import pkg1.pkg25.m24
+from pkg2.pkg33.pkg436 import m435
+from . import m1867
+from pkg7 import m6
+import pkg2.pkg33.pkg440.m4607
+from . import m6035
+
+
+def helper_8119_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8119_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
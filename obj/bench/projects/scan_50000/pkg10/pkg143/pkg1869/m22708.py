@@ -0,0 +1,21 @@
+"""Module 22708."""
+from . import m18540
+from pkg6.pkg88.pkg1147 import m21986
+from . import m14372
+from pkg6.pkg89.pkg1167 import m1166
+import pkg8.pkg114.pkg1493.m20248
+from pkg11.pkg146.pkg1901 import m8152
+
+
+def helper_22708_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_22708_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,15 @@
+"""Module 39380."""
+import pkg9.pkg124.pkg1621.m26628
+from . import m16456
+import pkg1.pkg21.pkg278.m277
+from pkg5 import m4
+import pkg10.pkg142.pkg1856.m12275
+from pkg13.pkg182 import m181
+import pkg11.pkg153.pkg2001.m24924
+
+
+def helper_39380_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,27 @@
+"""Module 8120."""
+import pkg1.pkg25.pkg338.m337
+from . import m1868
+import pkg6.pkg88.pkg1153.m3236
+from . import m3952
+import pkg3.pkg50.m49
+
+
+def helper_8120_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_8120_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_8120_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
@@ -0,0 +1,28 @@
+"""Module 18541."""
+import pkg1.pkg26.pkg341.m340
+from pkg10.pkg138.pkg1802 import m1801
+import pkg9.pkg127.pkg1657.m5824
+from pkg9.pkg128.pkg1674 import m1673
+import pkg2.pkg34.pkg455.m2538
+from . import m14373
+
+
+def helper_18541_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_18541_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_18541_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
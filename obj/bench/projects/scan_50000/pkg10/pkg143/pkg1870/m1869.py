@@ -0,0 +1,38 @@
+"""Module 1869."""
+import pkg8.pkg112.pkg1457.m1456
+from pkg3.pkg40 import m39
+import pkg9.pkg120.pkg1566.m1565
+from pkg3.pkg47.pkg618 import m617
+import pkg7.pkg96.pkg1255.m1254
+from pkg7.pkg94 import m93
+import pkg5.pkg75.m74
+from pkg2.pkg34 import m33
+import pkg4.pkg55.pkg728.m727
+
+
+def helper_1869_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_1869_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_1869_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_1869_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,32 @@
+"""Module 45633."""
+import pkg4.pkg65.pkg849.m848
+from pkg2.pkg30 import m29
+from . import m35213
+from . import m43549
+import pkg10.pkg136.pkg1775.m41370
+from pkg2.pkg34.pkg445 import m4612
+import pkg3.pkg41.pkg538.m537
+from pkg1.pkg19.pkg249 import m248
+import pkg8.pkg106.pkg1390.m20145
+from pkg10.pkg134.pkg1746 import m20501
+
+
+def helper_45633_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_45633_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_45633_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
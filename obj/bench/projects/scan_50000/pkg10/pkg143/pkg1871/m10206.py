@@ -0,0 +1,39 @@
+"""Module 10206."""
+from . import m6038
+from pkg5.pkg74.pkg972 import m3055
+import pkg8.pkg112.m111
+from pkg9.pkg119.pkg1551 import m5718
+from . import m3954
+from pkg13 import m4180
+from . import m8122
+from pkg9.pkg125.pkg1633 import m1632
+import pkg5.pkg75.pkg986.m5153
+from pkg9.pkg128.pkg1666 import m1665
+
+
+def helper_10206_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_10206_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_10206_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_10206_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
@@ -0,0 +1,12 @@
+"""Module 12290."""
+from . import m3954
+from pkg6.pkg84.pkg1101 import m3184
+import pkg3.pkg44.m43
+from . import m6038
+
+
+def helper_12290_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
@@ -0,0 +1,13 @@
+"""Module 18542."""
+import pkg13.m12
+from pkg9.pkg127.pkg1652 import m1651
+import pkg3.pkg47.m46
+from pkg11.pkg156.pkg2036 import m6203
+import pkg11.pkg146.pkg1911.m8162
+
+
+def helper_18542_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
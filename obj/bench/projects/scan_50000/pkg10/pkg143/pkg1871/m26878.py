@@ -0,0 +1,16 @@
+"""Module 26878."""
+from . import m16458
+from pkg2 import m1
+from . import m12290
+from pkg2.pkg30.pkg398 import m397
+import pkg2.pkg30.pkg391.m390
+from pkg1 import m0
+import pkg6.pkg87.pkg1144.m13647
+from pkg9.pkg129.pkg1690 import m1689
+
+
+def helper_26878_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
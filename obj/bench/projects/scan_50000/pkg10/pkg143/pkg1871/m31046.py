@@ -0,0 +1,27 @@
+"""Module 31046."""
+import pkg5.pkg76.pkg990.m989
+from pkg1.pkg19.pkg248 import m247
+import pkg10.pkg134.pkg1751.m10086
+from pkg11.pkg154.pkg2008 import m12427
+import pkg6.pkg79.m78
+from . import m10206
+import pkg10.pkg142.pkg1849.m3932
+from pkg13.pkg177 import m18932
+from . import m6038
+from . import m28962
+import pkg4.pkg64.pkg837.m7088
+from pkg1.pkg21.pkg284 import m4451
+
+
+def helper_31046_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_31046_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,62 @@
+"""Module 43550."""
+import pkg7.pkg93.pkg1213.m7464
+from pkg1.pkg16.pkg210 import m29385
+import pkg1.pkg14.pkg183.m182
+from pkg5 import m4
+import pkg1.pkg15.pkg208.m207
+from pkg3.pkg42 import m8377
+from . import m16458
+from pkg2.pkg36.pkg477 import m476
+import pkg1.pkg14.m13
+from pkg2.pkg33 import m32
+import pkg6.pkg82.m81
+from pkg6.pkg90.pkg1183 import m1182
+
+
+def helper_43550_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_43550_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_43550_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)
+
+
+def helper_43550_18(value, scale=5):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(5)]
+    return sum(result)
+
+
+def helper_43550_24(value, scale=4):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(6)]
+    return sum(result)
+
+
+def helper_43550_30(value, scale=3):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_43550_36(value, scale=2):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
@@ -0,0 +1,25 @@
+"""Module 45634."""
+import pkg4.pkg54.pkg704.m21543
+from pkg5.pkg74.pkg967 import m32226
+import pkg4.pkg63.pkg820.m36247
+
+
+def helper_45634_0(value, scale=1):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(2)]
+    return sum(result)
+
+
+def helper_45634_6(value, scale=7):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(3)]
+    return sum(result)
+
+
+def helper_45634_12(value, scale=6):
+    """Scales value; see the import notes."""
+    # from the old API: import value
+    result = [value * scale for _ in range(4)]
+    return sum(result)